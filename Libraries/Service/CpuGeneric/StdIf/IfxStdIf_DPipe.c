@@ -42,25 +42,66 @@
 
 #include "IfxStdIf_DPipe.h"
 #include "_Utilities/Ifx_Assert.h"
+#include "SysSe/General/Ifx_Format.h"
 
-#include <string.h>
-#include <stdio.h>
 #include <stdarg.h>
 
+boolean IfxStdIf_DPipe_formatOutput(void *context, const char *data, Ifx_SizeT count)
+{
+    return IfxStdIf_DPipe_write((IfxStdIf_DPipe *)context, (void *)data, &count, TIME_INFINITE);
+}
+
+
+boolean IfxStdIf_DPipe_vprint(IfxStdIf_DPipe *stdIf, Ifx_SizeT indent, pchar format, va_list args)
+{
+    char      message[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
+    Ifx_SizeT count;
+    sint32    length;
+    pchar     end = format;
+
+    count = (indent < STDIF_DPIPE_MAX_PRINT_SIZE) ? indent : STDIF_DPIPE_MAX_PRINT_SIZE;
+
+    for (length = 0; length < count; length++)
+    {
+        message[length] = ' ';
+    }
+
+    length = Ifx_Format_vsnprintf(&message[count], STDIF_DPIPE_MAX_PRINT_SIZE + 1 - count, format, args);
+
+    if (length < 0)
+    {
+        length = 0;
+    }
+    else if (length > (STDIF_DPIPE_MAX_PRINT_SIZE - count))
+    {
+        /* Truncated: keep the line break, the line is not continued */
+        length = STDIF_DPIPE_MAX_PRINT_SIZE - count;
+
+        while (*end != '\0')
+        {
+            end++;
+        }
+
+        if ((end != format) && (end[-1] == '\n') && (length > 0))
+        {
+            message[count + length - 1] = '\n';
+        }
+    }
+
+    count = (Ifx_SizeT)(count + length);
+
+    return (count == 0) || IfxStdIf_DPipe_write(stdIf, (void *)message, &count, TIME_INFINITE);
+}
+
+
 void IfxStdIf_DPipe_print(IfxStdIf_DPipe *stdIf, pchar format, ...)
 {
     if (!stdIf->txDisabled)
     {
-        char      message[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
-        Ifx_SizeT count;
-        va_list   args;
+        va_list args;
         va_start(args, format);
-        vsprintf((char *)message, format, args);
+        (void)IfxStdIf_DPipe_vprint(stdIf, 0, format, args);
         va_end(args);
-        count = (Ifx_SizeT)strlen(message);
-        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count < STDIF_DPIPE_MAX_PRINT_SIZE);
-        //return
-        IfxStdIf_DPipe_write(stdIf, (void *)message, &count, TIME_INFINITE);
     }
     else
     {
@@ -59,6 +59,7 @@
 #define STDIF_DPIPE_H_ 1
 
 #include "IfxStdIf.h"
+#include <stdarg.h>
 //----------------------------------------------------------------------------------------
 #ifndef ENDL
 #    define ENDL       "\r\n"
@@ -70,7 +71,7 @@ typedef struct IfxStdIf_DPipe_ IfxStdIf_DPipe;
 typedef volatile boolean      *IfxStdIf_DPipe_WriteEvent;
 typedef volatile boolean      *IfxStdIf_DPipe_ReadEvent;
 
-/** \brief Size of the buffer allocated on the stack for the print function */
+/** \brief Size of the buffer allocated on the stack for the print function, longer strings are truncated */
 #define STDIF_DPIPE_MAX_PRINT_SIZE (255)
 
 /** \brief Write binary data into the \ref IfxStdIf_DPipe.
@@ -390,8 +391,26 @@ IFX_INLINE void IfxStdIf_DPipe_resetSendCount(IfxStdIf_DPipe *stdIf)
 }
 
 
+/** \brief Print a printf-compatible formatted string
+ * \see IfxStdIf_DPipe_vprint()
+ */
 IFX_EXTERN void IfxStdIf_DPipe_print(IfxStdIf_DPipe *stdIf, pchar format, ...);
 
+/** \brief Print a printf-compatible formatted string, after indent blanks
+ *
+ * The string is formatted by Ifx_Format_vsnprintf() into a buffer of
+ * STDIF_DPIPE_MAX_PRINT_SIZE characters on the stack and written with a single
+ * IfxStdIf_DPipe_write() with TIME_INFINITE, so that prints of different tasks
+ * do not interleave within a string. A longer string is truncated; if the
+ * format ends with a line break, so does the truncated string.
+ *
+ * \return The result of the write, TRUE for an empty string
+ */
+IFX_EXTERN boolean IfxStdIf_DPipe_vprint(IfxStdIf_DPipe *stdIf, Ifx_SizeT indent, pchar format, va_list args);
+
+/** \brief Ifx_Format_Output function writing to the IfxStdIf_DPipe given as context */
+IFX_EXTERN boolean IfxStdIf_DPipe_formatOutput(void *context, const char *data, Ifx_SizeT count);
+
 /** \} */
 //----------------------------------------------------------------------------------------
 
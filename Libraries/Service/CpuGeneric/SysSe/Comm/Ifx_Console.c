@@ -39,8 +39,6 @@
  *
  */
 
-#include <string.h>
-#include <stdio.h>
 #include <stdarg.h>
 
 #include "Ifx_Console.h"
@@ -70,16 +68,13 @@ boolean Ifx_Console_print(pchar format, ...)
 {
     if (!Ifx_g_console.standardIo->txDisabled)
     {
-        char      message[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
-        Ifx_SizeT count;
-        va_list   args;
+        boolean result;
+        va_list args;
         va_start(args, format);
-        vsprintf((char *)message, format, args);
+        result = IfxStdIf_DPipe_vprint(Ifx_g_console.standardIo, 0, format, args);
         va_end(args);
-        count = (Ifx_SizeT)strlen(message);
-        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count < STDIF_DPIPE_MAX_PRINT_SIZE);
 
-        return IfxStdIf_DPipe_write(Ifx_g_console.standardIo, (void *)message, &count, TIME_INFINITE);
+        return result;
     }
     else
     {
@@ -99,26 +94,13 @@ boolean Ifx_Console_printAlign(pchar format, ...)
 {
     if (!Ifx_g_console.standardIo->txDisabled)
     {
-        char      message[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
-        Ifx_SizeT align, count;
-        char      spaces[17] = "                ";
-        va_list   args;
+        boolean result;
+        va_list args;
         va_start(args, format);
-        vsprintf((char *)message, format, args);
+        result = IfxStdIf_DPipe_vprint(Ifx_g_console.standardIo, Ifx_g_console.align, format, args);
         va_end(args);
-        count = (Ifx_SizeT)strlen(message);
-        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count < STDIF_DPIPE_MAX_PRINT_SIZE);
-        align = Ifx_g_console.align;
 
-        while (align > 0)
-        {
-            Ifx_SizeT scount;
-            scount = __min(align, 10);
-            IfxStdIf_DPipe_write(Ifx_g_console.standardIo, (void *)spaces, &scount, TIME_INFINITE);
-            align  = align - scount;
-        }
-
-        return IfxStdIf_DPipe_write(Ifx_g_console.standardIo, (void *)message, &count, TIME_INFINITE);
+        return result;
     }
     else
     {
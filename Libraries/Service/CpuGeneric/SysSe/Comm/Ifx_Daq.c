@@ -0,0 +1,986 @@
+/**
+ * \file Ifx_Daq.c
+ * \brief Measurement and calibration protocol (XCP subset) for the shell
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_Daq.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "Stm/Std/IfxStm.h"
+#include <string.h>
+
+#if ((IFX_CFG_DAQ_QUEUE_SIZE & (IFX_CFG_DAQ_QUEUE_SIZE - 1)) != 0)
+#error IFX_CFG_DAQ_QUEUE_SIZE must be a power of two
+#endif
+
+#if (IFX_CFG_DAQ_MAX_ODTS > 0xFC)
+#error IFX_CFG_DAQ_MAX_ODTS must leave the PIDs 0xFC to 0xFF free
+#endif
+
+#if (IFX_CFG_DAQ_MAX_DTO > 255)
+#error IFX_CFG_DAQ_MAX_DTO must fit into the ODT length
+#endif
+
+/** \brief Command codes */
+#define IFX_DAQ_CMD_CONNECT                 (0xFFU)
+#define IFX_DAQ_CMD_DISCONNECT              (0xFEU)
+#define IFX_DAQ_CMD_GET_STATUS              (0xFDU)
+#define IFX_DAQ_CMD_SET_MTA                 (0xF6U)
+#define IFX_DAQ_CMD_UPLOAD                  (0xF5U)
+#define IFX_DAQ_CMD_SHORT_UPLOAD            (0xF4U)
+#define IFX_DAQ_CMD_DOWNLOAD                (0xF0U)
+#define IFX_DAQ_CMD_SET_DAQ_PTR             (0xE2U)
+#define IFX_DAQ_CMD_WRITE_DAQ               (0xE1U)
+#define IFX_DAQ_CMD_SET_DAQ_LIST_MODE       (0xE0U)
+#define IFX_DAQ_CMD_START_STOP_DAQ_LIST     (0xDEU)
+#define IFX_DAQ_CMD_START_STOP_SYNCH        (0xDDU)
+#define IFX_DAQ_CMD_GET_DAQ_CLOCK           (0xDCU)
+#define IFX_DAQ_CMD_GET_DAQ_PROCESSOR_INFO  (0xDAU)
+#define IFX_DAQ_CMD_GET_DAQ_RESOLUTION_INFO (0xD9U)
+#define IFX_DAQ_CMD_FREE_DAQ                (0xD6U)
+#define IFX_DAQ_CMD_ALLOC_DAQ               (0xD5U)
+#define IFX_DAQ_CMD_ALLOC_ODT               (0xD4U)
+#define IFX_DAQ_CMD_ALLOC_ODT_ENTRY         (0xD3U)
+
+/** \brief Response PIDs and error codes */
+#define IFX_DAQ_RES_OK                      (0xFFU)
+#define IFX_DAQ_RES_ERROR                   (0xFEU)
+#define IFX_DAQ_ERR_CMD_BUSY                (0x10U)
+#define IFX_DAQ_ERR_DAQ_ACTIVE              (0x11U)
+#define IFX_DAQ_ERR_CMD_UNKNOWN             (0x20U)
+#define IFX_DAQ_ERR_CMD_SYNTAX              (0x21U)
+#define IFX_DAQ_ERR_OUT_OF_RANGE            (0x22U)
+#define IFX_DAQ_ERR_SEQUENCE                (0x29U)
+#define IFX_DAQ_ERR_DAQ_CONFIG              (0x2AU)
+#define IFX_DAQ_ERR_MEMORY_OVERFLOW         (0x30U)
+
+/** \brief SET_DAQ_LIST_MODE: timestamp in the first ODT */
+#define IFX_DAQ_MODE_TIMESTAMP              (0x10U)
+
+/** \brief GET_STATUS: at least one DAQ list runs */
+#define IFX_DAQ_STATUS_DAQ_RUNNING          (0x40U)
+
+/** \brief Frame header: length and counter */
+#define IFX_DAQ_HEADER_SIZE                 (4)
+
+/** \brief Timestamp size in a DAQ packet */
+#define IFX_DAQ_TIMESTAMP_SIZE              (4)
+
+/** \brief Response under construction */
+typedef struct
+{
+    uint8     data[IFX_DAQ_MAX_CTO];
+    Ifx_SizeT length;
+} Ifx_Daq_Response;
+
+IFX_STATIC uint16 Ifx_Daq_getU16(const uint8 *data)
+{
+    return (uint16)(data[0] | ((uint16)data[1] << 8));
+}
+
+
+IFX_STATIC uint32 Ifx_Daq_getU32(const uint8 *data)
+{
+    return (uint32)data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24);
+}
+
+
+IFX_STATIC void Ifx_Daq_setU16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)value;
+    data[1] = (uint8)(value >> 8);
+}
+
+
+IFX_STATIC void Ifx_Daq_setU32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)value;
+    data[1] = (uint8)(value >> 8);
+    data[2] = (uint8)(value >> 16);
+    data[3] = (uint8)(value >> 24);
+}
+
+
+/** \brief Start a positive response with length bytes, the PID included */
+IFX_STATIC uint8 *Ifx_Daq_ok(Ifx_Daq_Response *response, Ifx_SizeT length)
+{
+    memset(response->data, 0, sizeof(response->data));
+    response->data[0] = IFX_DAQ_RES_OK;
+    response->length  = length;
+    return response->data;
+}
+
+
+IFX_STATIC void Ifx_Daq_error(Ifx_Daq_Response *response, uint8 code)
+{
+    response->data[0] = IFX_DAQ_RES_ERROR;
+    response->data[1] = code;
+    response->length  = 2;
+}
+
+
+/** \brief Send a frame, the counter is assigned here */
+IFX_STATIC boolean Ifx_Daq_send(Ifx_Daq *daq, const uint8 *packet, Ifx_SizeT length, Ifx_TickTime timeout)
+{
+    uint8     frame[IFX_DAQ_HEADER_SIZE + IFX_CFG_DAQ_MAX_DTO];
+    Ifx_SizeT count  = IFX_DAQ_HEADER_SIZE + length;
+    boolean   result = FALSE;
+
+    if (IfxStdIf_DPipe_canWriteCount(daq->io, count, timeout) != FALSE)
+    {
+        Ifx_Daq_setU16(&frame[0], (uint16)length);
+        Ifx_Daq_setU16(&frame[2], daq->counter);
+        memcpy(&frame[IFX_DAQ_HEADER_SIZE], packet, length);
+        result = IfxStdIf_DPipe_write(daq->io, frame, &count, timeout);
+
+        if (result != FALSE)
+        {
+            daq->counter++;
+        }
+    }
+
+    return result;
+}
+
+
+IFX_STATIC boolean Ifx_Daq_isRunning(const Ifx_Daq *daq)
+{
+    uint16  list;
+    boolean running = FALSE;
+
+    for (list = 0; list < daq->listCount; list++)
+    {
+        running = running || (daq->lists[list].running != FALSE);
+    }
+
+    return running;
+}
+
+
+/** \brief Returns TRUE if Ifx_Daq_event() may still read a stopped list
+ *
+ * A list stopped by an earlier command can still be sampled by an event that
+ * saw it running. Its queue and copy operations must not be changed until the
+ * event is done; the command is then answered with ERR_CMD_BUSY and repeated
+ * by the host.
+ */
+IFX_STATIC boolean Ifx_Daq_isSampling(const Ifx_Daq_List *list)
+{
+    /* Orders the earlier write of running against the read of sampling, the
+     * event does the reverse */
+    __dsync();
+    return list->sampling != FALSE;
+}
+
+
+IFX_STATIC boolean Ifx_Daq_isAnySampling(const Ifx_Daq *daq)
+{
+    uint16  list;
+    boolean sampling = FALSE;
+
+    for (list = 0; list < daq->listCount; list++)
+    {
+        sampling = sampling || (Ifx_Daq_isSampling(&daq->lists[list]) != FALSE);
+    }
+
+    return sampling;
+}
+
+
+IFX_STATIC void Ifx_Daq_stopAll(Ifx_Daq *daq)
+{
+    uint16 list;
+
+    for (list = 0; list < daq->listCount; list++)
+    {
+        daq->lists[list].running  = FALSE;
+        daq->lists[list].selected = FALSE;
+    }
+}
+
+
+/** \brief Compile the entries of a DAQ list into copy operations
+ *
+ * Entries that continue the previous one are merged. A merged operation of 1, 2
+ * or 4 bytes at a matching alignment is done with a single load, so that such
+ * a signal is read consistently.
+ *
+ * \return FALSE if an ODT does not fit into a DAQ packet, or a sample does
+ * not fit into the queue
+ */
+IFX_STATIC boolean Ifx_Daq_compile(Ifx_Daq *daq, Ifx_Daq_List *list)
+{
+    uint16  odtIndex;
+    boolean result = (list->odtCount != 0) && (list->odtCount <= IFX_CFG_DAQ_QUEUE_SIZE);
+
+    for (odtIndex = list->firstOdt; (odtIndex < (list->firstOdt + list->odtCount)) && (result != FALSE); odtIndex++)
+    {
+        Ifx_Daq_Odt         *odt    = &daq->odts[odtIndex];
+        const Ifx_Daq_Entry *entry  = &daq->entries[odt->firstEntry];
+        Ifx_Daq_Copy        *copy   = &daq->copies[odt->firstEntry];
+        uint32               length = 1;
+        uint8                count  = 0;
+        uint8                index;
+
+        if ((odtIndex == list->firstOdt) && ((list->mode & IFX_DAQ_MODE_TIMESTAMP) != 0))
+        {
+            length += IFX_DAQ_TIMESTAMP_SIZE;
+        }
+
+        for (index = 0; index < odt->entryCount; index++)
+        {
+            if ((count != 0) && (entry[index].address == ((uint32)copy[count - 1].source + copy[count - 1].size))
+                && ((copy[count - 1].size + entry[index].size) <= 0xFFU))
+            {
+                copy[count - 1].size = (uint8)(copy[count - 1].size + entry[index].size);
+            }
+            else
+            {
+                copy[count].source = (const void *)entry[index].address;
+                copy[count].size   = entry[index].size;
+                count++;
+            }
+
+            length += entry[index].size;
+        }
+
+        for (index = 0; index < count; index++)
+        {
+            uint8 size = copy[index].size;
+
+            copy[index].width = 0;
+
+            if (((size == 1) || (size == 2) || (size == 4)) && (((uint32)copy[index].source & (size - 1U)) == 0))
+            {
+                copy[index].width = size;
+            }
+        }
+
+        odt->copyCount = count;
+        odt->length    = (uint8)length;
+        result         = (length <= IFX_CFG_DAQ_MAX_DTO);
+    }
+
+    return result;
+}
+
+
+/** \brief Fill one DAQ packet from the compiled copy operations of an ODT */
+IFX_STATIC void Ifx_Daq_sampleOdt(const Ifx_Daq *daq, uint16 odtIndex, uint8 *packet, boolean timestamp)
+{
+    const Ifx_Daq_Odt  *odt  = &daq->odts[odtIndex];
+    const Ifx_Daq_Copy *copy = &daq->copies[odt->firstEntry];
+    uint8              *data = &packet[1];
+    uint8               index;
+
+    packet[0] = (uint8)odtIndex;
+
+    if (timestamp != FALSE)
+    {
+        Ifx_Daq_setU32(data, IfxStm_getLower(&MODULE_STM0));
+        data = &data[IFX_DAQ_TIMESTAMP_SIZE];
+    }
+
+    for (index = 0; index < odt->copyCount; index++)
+    {
+        switch (copy[index].width)
+        {
+        case 1:
+            data[0] = *(volatile const uint8 *)copy[index].source;
+            break;
+        case 2:
+            Ifx_Daq_setU16(data, *(volatile const uint16 *)copy[index].source);
+            break;
+        case 4:
+            Ifx_Daq_setU32(data, *(volatile const uint32 *)copy[index].source);
+            break;
+        default:
+            memcpy(data, copy[index].source, copy[index].size);
+            break;
+        }
+
+        data = &data[copy[index].size];
+    }
+}
+
+
+/** \brief Send the queued DAQ packets, one per list and turn, while the pipe takes them */
+IFX_STATIC void Ifx_Daq_flush(Ifx_Daq *daq)
+{
+    boolean sent = TRUE;
+
+    while (sent != FALSE)
+    {
+        uint16 listIndex;
+
+        sent = FALSE;
+
+        for (listIndex = 0; listIndex < daq->listCount; listIndex++)
+        {
+            Ifx_Daq_List *list = &daq->lists[listIndex];
+            uint32        tail = list->tail;
+
+            if (tail != list->head)
+            {
+                const uint8 *packet = list->queue[tail & (IFX_CFG_DAQ_QUEUE_SIZE - 1)];
+
+                if (Ifx_Daq_send(daq, packet, daq->odts[packet[0]].length, 0) == FALSE)
+                {
+                    return;
+                }
+
+                /* The packet is read before the sampling core may reuse its slot */
+                __dsync();
+                list->tail = tail + 1;
+                sent       = TRUE;
+            }
+        }
+    }
+}
+
+
+/** \brief DAQ list configuration commands */
+IFX_STATIC void Ifx_Daq_configure(Ifx_Daq *daq, const uint8 *command, Ifx_SizeT length, Ifx_Daq_Response *response)
+{
+    switch (command[0])
+    {
+    case IFX_DAQ_CMD_FREE_DAQ:
+
+        if (Ifx_Daq_isRunning(daq) != FALSE)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_DAQ_ACTIVE);
+        }
+        else if (Ifx_Daq_isAnySampling(daq) != FALSE)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_BUSY);
+        }
+        else
+        {
+            daq->listCount   = 0;
+            daq->odtCount    = 0;
+            daq->entryCount  = 0;
+            daq->pointerList = NULL_PTR;
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    case IFX_DAQ_CMD_ALLOC_DAQ:
+    {
+        uint16 count = Ifx_Daq_getU16(&command[2]);
+
+        if (length < 4)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((daq->listCount != 0) || (daq->odtCount != 0))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_SEQUENCE);
+        }
+        else if (count > IFX_CFG_DAQ_MAX_LISTS)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_MEMORY_OVERFLOW);
+        }
+        else
+        {
+            memset(daq->lists, 0, sizeof(daq->lists[0]) * count);
+            daq->listCount = count;
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    }
+    case IFX_DAQ_CMD_ALLOC_ODT:
+    {
+        uint16 listIndex = Ifx_Daq_getU16(&command[2]);
+
+        if (length < 5)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if (listIndex >= daq->listCount)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else if ((daq->lists[listIndex].odtCount != 0) || (daq->entryCount != 0))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_SEQUENCE);
+        }
+        else if ((daq->odtCount + command[4]) > IFX_CFG_DAQ_MAX_ODTS)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_MEMORY_OVERFLOW);
+        }
+        else
+        {
+            Ifx_Daq_List *list = &daq->lists[listIndex];
+
+            list->firstOdt = daq->odtCount;
+            list->odtCount = command[4];
+            memset(&daq->odts[daq->odtCount], 0, sizeof(daq->odts[0]) * command[4]);
+            daq->odtCount  = (uint16)(daq->odtCount + command[4]);
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    }
+    case IFX_DAQ_CMD_ALLOC_ODT_ENTRY:
+    {
+        uint16 listIndex = Ifx_Daq_getU16(&command[2]);
+
+        if (length < 6)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((listIndex >= daq->listCount) || (command[4] >= daq->lists[listIndex].odtCount))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            Ifx_Daq_Odt *odt = &daq->odts[daq->lists[listIndex].firstOdt + command[4]];
+
+            if (odt->entryCount != 0)
+            {
+                Ifx_Daq_error(response, IFX_DAQ_ERR_SEQUENCE);
+            }
+            else if ((daq->entryCount + command[5]) > IFX_CFG_DAQ_MAX_ENTRIES)
+            {
+                Ifx_Daq_error(response, IFX_DAQ_ERR_MEMORY_OVERFLOW);
+            }
+            else
+            {
+                odt->firstEntry = daq->entryCount;
+                odt->entryCount = command[5];
+                memset(&daq->entries[daq->entryCount], 0, sizeof(daq->entries[0]) * command[5]);
+                daq->entryCount = (uint16)(daq->entryCount + command[5]);
+                (void)Ifx_Daq_ok(response, 1);
+            }
+        }
+
+        break;
+    }
+    case IFX_DAQ_CMD_SET_DAQ_PTR:
+    {
+        uint16 listIndex = Ifx_Daq_getU16(&command[2]);
+
+        if (length < 6)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((listIndex >= daq->listCount) || (command[4] >= daq->lists[listIndex].odtCount)
+                 || (command[5] >= daq->odts[daq->lists[listIndex].firstOdt + command[4]].entryCount))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            const Ifx_Daq_Odt *odt = &daq->odts[daq->lists[listIndex].firstOdt + command[4]];
+
+            daq->pointerList  = &daq->lists[listIndex];
+            daq->pointerEntry = (uint16)(odt->firstEntry + command[5]);
+            daq->pointerEnd   = (uint16)(odt->firstEntry + odt->entryCount);
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    }
+    case IFX_DAQ_CMD_WRITE_DAQ:
+
+        if (length < 8)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((daq->pointerList == NULL_PTR) || (daq->pointerEntry >= daq->pointerEnd))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_SEQUENCE);
+        }
+        else if (daq->pointerList->running != FALSE)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_DAQ_ACTIVE);
+        }
+        else if ((command[1] != 0xFFU) || (command[2] == 0) || (command[2] >= IFX_CFG_DAQ_MAX_DTO))
+        {
+            /* Bit entries are not supported */
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            daq->entries[daq->pointerEntry].size    = command[2];
+            daq->entries[daq->pointerEntry].address = Ifx_Daq_getU32(&command[4]);
+            daq->pointerEntry++;
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    case IFX_DAQ_CMD_SET_DAQ_LIST_MODE:
+    {
+        uint16 listIndex = Ifx_Daq_getU16(&command[2]);
+        uint16 event     = Ifx_Daq_getU16(&command[4]);
+
+        if (length < 8)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((listIndex >= daq->listCount) || (event >= IFX_CFG_DAQ_MAX_EVENTS) || (command[6] == 0)
+                 || ((command[1] & ~IFX_DAQ_MODE_TIMESTAMP) != 0))
+        {
+            /* Alternating, stimulation and PID_OFF are not supported */
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else if (daq->lists[listIndex].running != FALSE)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_DAQ_ACTIVE);
+        }
+        else
+        {
+            Ifx_Daq_List *list = &daq->lists[listIndex];
+
+            list->mode      = command[1];
+            list->event     = event;
+            list->prescaler = command[6];
+            (void)Ifx_Daq_ok(response, 1);
+        }
+
+        break;
+    }
+    default:
+        Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_UNKNOWN);
+        break;
+    }
+}
+
+
+/** \brief Start a DAQ list, the caller has checked that it is stopped and not sampled */
+IFX_STATIC boolean Ifx_Daq_startList(Ifx_Daq *daq, Ifx_Daq_List *list)
+{
+    boolean result = Ifx_Daq_compile(daq, list);
+
+    if (result != FALSE)
+    {
+        /* Packets left from the last run are dropped. The sampling core only
+         * touches the queue while it samples the list. */
+        list->tail           = list->head;
+        list->prescalerCount = 0;
+        __dsync();
+        list->running        = TRUE;
+    }
+
+    return result;
+}
+
+
+/** \brief DAQ start, stop and information commands */
+IFX_STATIC void Ifx_Daq_control(Ifx_Daq *daq, const uint8 *command, Ifx_SizeT length, Ifx_Daq_Response *response)
+{
+    uint8 *data;
+
+    switch (command[0])
+    {
+    case IFX_DAQ_CMD_START_STOP_DAQ_LIST:
+    {
+        uint16 listIndex = Ifx_Daq_getU16(&command[2]);
+
+        if (length < 4)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((listIndex >= daq->listCount) || (command[1] > 2))
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            Ifx_Daq_List *list   = &daq->lists[listIndex];
+            boolean       result = TRUE;
+            boolean       busy   = FALSE;
+
+            if (command[1] == 0)
+            {
+                list->running = FALSE;
+            }
+            else if (command[1] == 2)
+            {
+                list->selected = TRUE;
+            }
+            else if (list->running != FALSE)
+            {}
+            else if (Ifx_Daq_isSampling(list) != FALSE)
+            {
+                busy = TRUE;
+            }
+            else
+            {
+                result = Ifx_Daq_startList(daq, list);
+            }
+
+            if (busy != FALSE)
+            {
+                Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_BUSY);
+            }
+            else if (result != FALSE)
+            {
+                data    = Ifx_Daq_ok(response, 2);
+                data[1] = (uint8)list->firstOdt;
+            }
+            else
+            {
+                Ifx_Daq_error(response, IFX_DAQ_ERR_DAQ_CONFIG);
+            }
+        }
+
+        break;
+    }
+    case IFX_DAQ_CMD_START_STOP_SYNCH:
+
+        if (length < 2)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if (command[1] > 2)
+        {
+            Ifx_Daq_error(response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else if (command[1] == 0)
+        {
+            Ifx_Daq_stopAll(daq);
+            (void)Ifx_Daq_ok(response, 1);
+        }
+        else if ((command[1] == 1) && (Ifx_Daq_isAnySampling(daq) != FALSE))
+        {
+            /* No selected list is started until none of them is sampled */
+            Ifx_Daq_error(response, IFX_DAQ_ERR_CMD_BUSY);
+        }
+        else
+        {
+            uint16  listIndex;
+            boolean result = TRUE;
+
+            for (listIndex = 0; listIndex < daq->listCount; listIndex++)
+            {
+                Ifx_Daq_List *list = &daq->lists[listIndex];
+
+                if (list->selected != FALSE)
+                {
+                    if (command[1] == 2)
+                    {
+                        list->running = FALSE;
+                    }
+                    else if (list->running == FALSE)
+                    {
+                        result = (Ifx_Daq_startList(daq, list) != FALSE) && (result != FALSE);
+                    }
+                    else
+                    {}
+
+                    list->selected = FALSE;
+                }
+            }
+
+            if (result != FALSE)
+            {
+                (void)Ifx_Daq_ok(response, 1);
+            }
+            else
+            {
+                Ifx_Daq_error(response, IFX_DAQ_ERR_DAQ_CONFIG);
+            }
+        }
+
+        break;
+    case IFX_DAQ_CMD_GET_DAQ_CLOCK:
+        data = Ifx_Daq_ok(response, 8);
+        Ifx_Daq_setU32(&data[4], IfxStm_getLower(&MODULE_STM0));
+        break;
+    case IFX_DAQ_CMD_GET_DAQ_PROCESSOR_INFO:
+        data    = Ifx_Daq_ok(response, 8);
+        data[1] = 0x13;         /* Dynamic configuration, prescaler, timestamps */
+        Ifx_Daq_setU16(&data[2], IFX_CFG_DAQ_MAX_LISTS);
+        Ifx_Daq_setU16(&data[4], IFX_CFG_DAQ_MAX_EVENTS);
+        data[6] = 0;            /* No predefined lists */
+        data[7] = 0;            /* Absolute ODT number as PID */
+        break;
+    case IFX_DAQ_CMD_GET_DAQ_RESOLUTION_INFO:
+    {
+        float32 ticks = 1.0e9f / IfxStm_getFrequency(&MODULE_STM0);
+
+        data    = Ifx_Daq_ok(response, 8);
+        data[1] = 1;
+        data[2] = (uint8)(IFX_CFG_DAQ_MAX_DTO - 1);
+        data[5] = IFX_DAQ_TIMESTAMP_SIZE;   /* Unit 1 ns */
+        Ifx_Daq_setU16(&data[6], (uint16)(ticks + 0.5f));
+        break;
+    }
+    default:
+        Ifx_Daq_configure(daq, command, length, response);
+        break;
+    }
+}
+
+
+/** \brief Handle one command packet */
+IFX_STATIC void Ifx_Daq_handle(Ifx_Daq *daq, const uint8 *command, Ifx_SizeT length)
+{
+    Ifx_Daq_Response response;
+    uint8           *data;
+    boolean          disconnect = FALSE;
+
+    response.length = 0;
+
+    if ((daq->connected == FALSE) && (command[0] != IFX_DAQ_CMD_CONNECT))
+    {
+        /* Commands other than CONNECT are ignored until connected */
+        return;
+    }
+
+    switch (command[0])
+    {
+    case IFX_DAQ_CMD_CONNECT:
+        daq->connected = TRUE;
+        data           = Ifx_Daq_ok(&response, 8);
+        data[1]        = 0x04;      /* DAQ */
+        data[2]        = 0x00;      /* Intel byte order, byte granularity */
+        data[3]        = IFX_DAQ_MAX_CTO;
+        Ifx_Daq_setU16(&data[4], IFX_CFG_DAQ_MAX_DTO);
+        data[6]        = 1;         /* Protocol layer version */
+        data[7]        = 1;         /* Transport layer version */
+        break;
+    case IFX_DAQ_CMD_DISCONNECT:
+        Ifx_Daq_stopAll(daq);
+        (void)Ifx_Daq_ok(&response, 1);
+        disconnect = TRUE;
+        break;
+    case IFX_DAQ_CMD_GET_STATUS:
+        data    = Ifx_Daq_ok(&response, 6);
+        data[1] = (Ifx_Daq_isRunning(daq) != FALSE) ? IFX_DAQ_STATUS_DAQ_RUNNING : 0;
+        break;
+    case IFX_DAQ_CMD_SET_MTA:
+
+        if (length < 8)
+        {
+            Ifx_Daq_error(&response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else
+        {
+            daq->mta = Ifx_Daq_getU32(&command[4]);
+            (void)Ifx_Daq_ok(&response, 1);
+        }
+
+        break;
+    case IFX_DAQ_CMD_SHORT_UPLOAD:
+    case IFX_DAQ_CMD_UPLOAD:
+
+        if ((length < 2) || ((command[0] == IFX_DAQ_CMD_SHORT_UPLOAD) && (length < 8)))
+        {
+            Ifx_Daq_error(&response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if ((command[1] == 0) || (command[1] > (IFX_DAQ_MAX_CTO - 1)))
+        {
+            Ifx_Daq_error(&response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            if (command[0] == IFX_DAQ_CMD_SHORT_UPLOAD)
+            {
+                daq->mta = Ifx_Daq_getU32(&command[4]);
+            }
+
+            data = Ifx_Daq_ok(&response, (Ifx_SizeT)(1 + command[1]));
+            memcpy(&data[1], (const void *)daq->mta, command[1]);
+            daq->mta += command[1];
+        }
+
+        break;
+    case IFX_DAQ_CMD_DOWNLOAD:
+
+        if ((length < 2) || (length < (Ifx_SizeT)(2 + command[1])))
+        {
+            Ifx_Daq_error(&response, IFX_DAQ_ERR_CMD_SYNTAX);
+        }
+        else if (command[1] == 0)
+        {
+            Ifx_Daq_error(&response, IFX_DAQ_ERR_OUT_OF_RANGE);
+        }
+        else
+        {
+            memcpy((void *)daq->mta, &command[2], command[1]);
+            daq->mta += command[1];
+            (void)Ifx_Daq_ok(&response, 1);
+        }
+
+        break;
+    default:
+        Ifx_Daq_control(daq, command, length, &response);
+        break;
+    }
+
+    (void)Ifx_Daq_send(daq, response.data, response.length, TIME_INFINITE);
+
+    if (disconnect != FALSE)
+    {
+        daq->connected = FALSE;
+
+        if (daq->shell != NULL_PTR)
+        {
+            Ifx_Shell_protocolStop(daq->shell);
+        }
+    }
+}
+
+
+/** \brief Receive command frames, without waiting
+ * \return TRUE if a complete frame is in Ifx_Daq.rx
+ */
+IFX_STATIC boolean Ifx_Daq_receive(Ifx_Daq *daq)
+{
+    Ifx_Daq_Rx *rx       = &daq->rx;
+    Ifx_SizeT   expected = IFX_DAQ_HEADER_SIZE;
+    Ifx_SizeT   count;
+
+    if (rx->count >= IFX_DAQ_HEADER_SIZE)
+    {
+        expected = (Ifx_SizeT)(IFX_DAQ_HEADER_SIZE + Ifx_Daq_getU16(rx->frame));
+    }
+
+    count = (Ifx_SizeT)__min(IfxStdIf_DPipe_getReadCount(daq->io), expected - rx->count);
+
+    if (count > 0)
+    {
+        (void)IfxStdIf_DPipe_read(daq->io, &rx->frame[rx->count], &count, 0);
+        rx->count = (Ifx_SizeT)(rx->count + count);
+
+        if (rx->count == IFX_DAQ_HEADER_SIZE)
+        {
+            uint16 length = Ifx_Daq_getU16(rx->frame);
+
+            if ((length == 0) || (length > IFX_DAQ_MAX_CTO))
+            {
+                /* Not a command frame, resynchronise on the next bytes */
+                rx->count = 0;
+            }
+        }
+    }
+
+    return (rx->count > IFX_DAQ_HEADER_SIZE) && (rx->count == expected);
+}
+
+
+void Ifx_Daq_init(Ifx_Daq *daq, Ifx_Shell *shell)
+{
+    memset(daq, 0, sizeof(*daq));
+    daq->shell = shell;
+}
+
+
+boolean Ifx_Daq_protocolStart(void *protocol, IfxStdIf_DPipe *io)
+{
+    Ifx_Daq *daq = protocol;
+
+    daq->io        = io;
+    daq->connected = FALSE;
+    daq->rx.count  = 0;
+
+    return TRUE;
+}
+
+
+void Ifx_Daq_protocolExecute(void *protocol)
+{
+    Ifx_Daq *daq = protocol;
+
+    if (Ifx_Daq_receive(daq) != FALSE)
+    {
+        Ifx_Daq_Rx *rx = &daq->rx;
+
+        Ifx_Daq_handle(daq, &rx->frame[IFX_DAQ_HEADER_SIZE], (Ifx_SizeT)(rx->count - IFX_DAQ_HEADER_SIZE));
+        rx->count = 0;
+    }
+
+    Ifx_Daq_flush(daq);
+}
+
+
+void Ifx_Daq_event(Ifx_Daq *daq, uint16 event)
+{
+    uint16 listIndex;
+
+    for (listIndex = 0; listIndex < daq->listCount; listIndex++)
+    {
+        Ifx_Daq_List *list = &daq->lists[listIndex];
+
+        if (list->event != event)
+        {
+            continue;
+        }
+
+        /* Announce the sample before reading running, see Ifx_Daq_isSampling() */
+        list->sampling = TRUE;
+        __dsync();
+
+        if (list->running != FALSE)
+        {
+            list->prescalerCount++;
+
+            if (list->prescalerCount >= list->prescaler)
+            {
+                uint32 head = list->head;
+                uint16 odt;
+
+                list->prescalerCount = 0;
+
+                if ((IFX_CFG_DAQ_QUEUE_SIZE - (head - list->tail)) < list->odtCount)
+                {
+                    list->overruns++;
+                }
+                else
+                {
+                    for (odt = 0; odt < list->odtCount; odt++)
+                    {
+                        Ifx_Daq_sampleOdt(daq, (uint16)(list->firstOdt + odt), list->queue[(head + odt) & (IFX_CFG_DAQ_QUEUE_SIZE - 1)],
+                            (odt == 0) && ((list->mode & IFX_DAQ_MODE_TIMESTAMP) != 0));
+                    }
+
+                    /* The packets are complete before the sender sees them */
+                    __dsync();
+                    list->head = head + list->odtCount;
+                }
+            }
+        }
+
+        __dsync();
+        list->sampling = FALSE;
+    }
+}
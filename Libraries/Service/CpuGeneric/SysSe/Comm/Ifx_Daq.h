@@ -0,0 +1,240 @@
+/**
+ * \file Ifx_Daq.h
+ * \brief Measurement and calibration protocol (XCP subset) for the shell
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_comm_daq Measurement and calibration
+ * This module implements a subset of the XCP protocol as a shell protocol
+ * (\ref Ifx_Shell_Protocol): the host reads and writes memory and configures
+ * DAQ lists, which are sampled by the application without halting the cores.
+ *
+ * Frames use the XCP on SxI layout in both directions: a 16 bit length and a
+ * 16 bit counter, little endian, followed by the XCP packet. The transport is
+ * the IfxStdIf_DPipe the shell runs on, e.g. an ASCLIN, or a CAN or Ethernet
+ * channel behind a IfxStdIf_DPipe driver. tools/daq_client.py is a host
+ * client for Linux.
+ *
+ * Supported commands: CONNECT, DISCONNECT, GET_STATUS, SET_MTA, UPLOAD,
+ * SHORT_UPLOAD, DOWNLOAD, FREE_DAQ, ALLOC_DAQ, ALLOC_ODT, ALLOC_ODT_ENTRY,
+ * SET_DAQ_PTR, WRITE_DAQ, SET_DAQ_LIST_MODE, START_STOP_DAQ_LIST,
+ * START_STOP_SYNCH, GET_DAQ_CLOCK, GET_DAQ_PROCESSOR_INFO and
+ * GET_DAQ_RESOLUTION_INFO. DAQ packets carry the absolute ODT number as PID;
+ * the first ODT of a list with timestamps enabled carries the 32 bit STM0
+ * time after the PID.
+ *
+ * The application raises event channels with Ifx_Daq_event(), e.g. at the
+ * start of a periodic task. When a DAQ list is started, its entries are
+ * compiled into a copy list per ODT, in which adjacent entries are merged and
+ * aligned 1, 2 and 4 byte entries are copied with a single load, so that a
+ * sample does not interpret the configuration. The packets of a list go
+ * through a queue of its own, written by the core that raises the event and
+ * read by Ifx_Daq_protocolExecute(), which sends them. Each event channel must
+ * therefore only be raised on one core. A sample that finds no room for all
+ * its ODTs is dropped as a whole and counted in Ifx_Daq_List.overruns; a list
+ * with more ODTs than IFX_CFG_DAQ_QUEUE_SIZE is not started. Commands that
+ * would change a list that an event still samples are answered with
+ * ERR_CMD_BUSY, and the host repeats them.
+ *
+ * Example:
+ * \code
+ * Ifx_Shell g_shell;
+ * Ifx_Daq   g_daq;
+ *
+ *     Ifx_Shell_initConfig(&config);
+ *     config.protocol.object  = &g_daq;
+ *     config.protocol.start   = &Ifx_Daq_protocolStart;
+ *     config.protocol.execute = &Ifx_Daq_protocolExecute;
+ *     Ifx_Shell_init(&g_shell, &config);
+ *     Ifx_Daq_init(&g_daq, &g_shell);
+ *
+ * void Core1Task(void *arg)
+ * {
+ *     while (1)
+ *     {
+ *         (void)xTaskWaitForNextPeriod();
+ *         Ifx_Daq_event(&g_daq, 1);
+ *         ...
+ *     }
+ * }
+ * \endcode
+ * The host sends "protocol start" to the shell, after which the pipe carries
+ * XCP frames until DISCONNECT.
+ *
+ * \ingroup library_srvsw_sysse_comm
+ */
+
+#ifndef IFX_DAQ_H
+#define IFX_DAQ_H 1
+
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/Ifx_Types.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+#ifndef IFX_CFG_DAQ_MAX_LISTS
+#define IFX_CFG_DAQ_MAX_LISTS   (4)     /**< \brief DAQ lists */
+#endif
+
+#ifndef IFX_CFG_DAQ_MAX_ODTS
+#define IFX_CFG_DAQ_MAX_ODTS    (16)    /**< \brief ODTs, over all DAQ lists */
+#endif
+
+#ifndef IFX_CFG_DAQ_MAX_ENTRIES
+#define IFX_CFG_DAQ_MAX_ENTRIES (64)    /**< \brief ODT entries, over all ODTs */
+#endif
+
+#ifndef IFX_CFG_DAQ_MAX_EVENTS
+#define IFX_CFG_DAQ_MAX_EVENTS  (8)     /**< \brief Event channels */
+#endif
+
+#ifndef IFX_CFG_DAQ_MAX_DTO
+#define IFX_CFG_DAQ_MAX_DTO     (64)    /**< \brief Largest DAQ packet, PID included */
+#endif
+
+#ifndef IFX_CFG_DAQ_QUEUE_SIZE
+#define IFX_CFG_DAQ_QUEUE_SIZE  (16)    /**< \brief Packets queued per DAQ list, a power of two */
+#endif
+
+/** \brief Largest command and response packet */
+#define IFX_DAQ_MAX_CTO         (8)
+
+/** \brief One ODT entry as written by WRITE_DAQ */
+typedef struct
+{
+    uint32 address;
+    uint8  size;
+} Ifx_Daq_Entry;
+
+/** \brief Compiled copy operation of an ODT */
+typedef struct
+{
+    const void *source;
+    uint8       size;
+    uint8       width;       /**< \brief 1, 2 or 4 for a single load of an aligned entry, 0 for a byte copy */
+} Ifx_Daq_Copy;
+
+/** \brief ODT */
+typedef struct
+{
+    uint16 firstEntry;       /**< \brief Index of the first entry in Ifx_Daq.entries and of the first copy operation in Ifx_Daq.copies */
+    uint8  entryCount;
+    uint8  copyCount;        /**< \brief Copy operations, valid while the list runs */
+    uint8  length;           /**< \brief Packet length, PID and timestamp included */
+} Ifx_Daq_Odt;
+
+/** \brief DAQ list */
+typedef struct
+{
+    uint16           firstOdt;          /**< \brief Index of the first ODT in Ifx_Daq.odts, also the first PID */
+    uint8            odtCount;
+    uint8            mode;              /**< \brief SET_DAQ_LIST_MODE mode, only the timestamp bit is used */
+    uint16           event;             /**< \brief Event channel */
+    uint8            prescaler;
+    uint8            prescalerCount;
+    boolean          selected;          /**< \brief Selected for START_STOP_SYNCH */
+    volatile boolean running;
+    volatile boolean sampling;          /**< \brief Set while Ifx_Daq_event() may read the list, written by the sampling core */
+    volatile uint32  head;              /**< \brief Packets queued, written by the sampling core */
+    volatile uint32  tail;              /**< \brief Packets sent, written by Ifx_Daq_protocolExecute() */
+    uint32           overruns;          /**< \brief Samples dropped because the queue was full */
+    uint8            queue[IFX_CFG_DAQ_QUEUE_SIZE][IFX_CFG_DAQ_MAX_DTO];
+} Ifx_Daq_List;
+
+/** \brief Command receive state */
+typedef struct
+{
+    uint8     frame[4 + IFX_DAQ_MAX_CTO]; /**< \brief Header and packet */
+    Ifx_SizeT count;                      /**< \brief Bytes received of the frame */
+} Ifx_Daq_Rx;
+
+/** \brief Measurement and calibration protocol object */
+typedef struct
+{
+    IfxStdIf_DPipe *io;                                  /**< \brief Pipe of the protocol, set by Ifx_Daq_protocolStart() */
+    Ifx_Shell      *shell;                               /**< \brief Shell returned to on DISCONNECT, may be NULL_PTR */
+    boolean         connected;
+    uint16          counter;                             /**< \brief CTR of the next frame sent */
+    uint32          mta;                                 /**< \brief Memory transfer address */
+    uint16          listCount;
+    uint16          odtCount;
+    uint16          entryCount;
+    Ifx_Daq_List   *pointerList;                         /**< \brief SET_DAQ_PTR position */
+    uint16          pointerEntry;
+    uint16          pointerEnd;
+    Ifx_Daq_Rx      rx;
+    Ifx_Daq_List    lists[IFX_CFG_DAQ_MAX_LISTS];
+    Ifx_Daq_Odt     odts[IFX_CFG_DAQ_MAX_ODTS];
+    Ifx_Daq_Entry   entries[IFX_CFG_DAQ_MAX_ENTRIES];
+    Ifx_Daq_Copy    copies[IFX_CFG_DAQ_MAX_ENTRIES];
+} Ifx_Daq;
+
+/** \addtogroup library_srvsw_sysse_comm_daq
+ * \{ */
+
+/** \brief Initialise the protocol object, with no DAQ lists
+ * \param daq Pointer to the Ifx_Daq object
+ * \param shell Shell that runs the protocol, which returns to the command line
+ * on DISCONNECT; NULL_PTR to keep the protocol running
+ */
+IFX_EXTERN void Ifx_Daq_init(Ifx_Daq *daq, Ifx_Shell *shell);
+
+/** \brief Ifx_Shell_Protocol start function
+ * \param protocol Pointer to the Ifx_Daq object
+ * \param io Pipe of the protocol
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Daq_protocolStart(void *protocol, IfxStdIf_DPipe *io);
+
+/** \brief Ifx_Shell_Protocol execute function
+ *
+ * Handles at most one command and then sends queued DAQ packets as long as
+ * the pipe takes them without waiting.
+ *
+ * \param protocol Pointer to the Ifx_Daq object
+ */
+IFX_EXTERN void Ifx_Daq_protocolExecute(void *protocol);
+
+/** \brief Sample the running DAQ lists of an event channel
+ *
+ * Call on the core that owns the event channel, from a task or an interrupt.
+ *
+ * \param daq Pointer to the Ifx_Daq object
+ * \param event Event channel, below IFX_CFG_DAQ_MAX_EVENTS
+ */
+IFX_EXTERN void Ifx_Daq_event(Ifx_Daq *daq, uint16 event);
+/** \} */
+
+#endif /* IFX_DAQ_H */
@@ -284,6 +284,12 @@ boolean Ifx_Shell_protocolStart(pchar args, void *data, IfxStdIf_DPipe *io)
 }
 
 
+void Ifx_Shell_protocolStop(Ifx_Shell *shell)
+{
+    shell->protocol.started = FALSE;
+}
+
+
 boolean Ifx_Shell_bbProtocolStart(pchar args, void *data, IfxStdIf_DPipe *io)
 {
     boolean result = TRUE;
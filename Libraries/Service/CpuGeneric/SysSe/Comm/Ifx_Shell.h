@@ -456,6 +456,15 @@ IFX_EXTERN void Ifx_Shell_printSyntax(const Ifx_Shell_Syntax *syntaxList, IfxStd
  */
 IFX_EXTERN boolean Ifx_Shell_protocolStart(pchar args, void *data, IfxStdIf_DPipe *io);
 
+/**
+ * \brief Stop the protocol and return to the command line.
+ *
+ * To be called by the protocol itself, e.g. on a disconnect request, from its execute function.
+ *
+ * \param shell Pointer to the \ref Ifx_Shell object
+ */
+IFX_EXTERN void Ifx_Shell_protocolStop(Ifx_Shell *shell);
+
 /**
  * \brief Implementation of \ref Ifx_Shell_Call. Start the ShellBb protocol.
  * \param args The argument null-terminated string
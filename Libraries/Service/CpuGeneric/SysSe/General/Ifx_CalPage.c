@@ -0,0 +1,396 @@
+/**
+ * \file Ifx_CalPage.c
+ * \brief Calibration page switching through the CPU data overlay
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_CalPage.h"
+#include "Scu/Std/IfxScuWdt.h"
+#include <string.h>
+
+/** \brief Return the size in bytes of an overlay block */
+IFX_STATIC uint32 Ifx_CalPage_getBlockSize(IfxCpu_OverlayAddressMask mask)
+{
+    return ((~(uint32)mask & 0xFFFU) + 1U) << 5;
+}
+
+
+/** \brief Write SCU_OVCCON, which is protected by the safety ENDINIT */
+IFX_STATIC void Ifx_CalPage_writeOvccon(uint32 value)
+{
+    uint16 safetyWdtPw = IfxScuWdt_getSafetyWatchdogPassword();
+    IfxScuWdt_clearSafetyEndinit(safetyWdtPw);
+    MODULE_SCU.OVCCON.U = value;
+    IfxScuWdt_setSafetyEndinit(safetyWdtPw);
+}
+
+
+boolean Ifx_CalPage_init(Ifx_CalPage *calPage, const Ifx_CalPage_Config *config)
+{
+    uint32         regionIndex;
+    uint32         cpu;
+    uint32         blockMask = 0;
+    Ifx_SCU_OVCCON ovccon;
+
+    if ((config->regionCount == 0) || ((config->firstBlock + config->regionCount) > IFX_CFG_CALPAGE_OVERLAY_BLOCK_COUNT))
+    {
+        return FALSE;
+    }
+
+    for (regionIndex = 0; regionIndex < config->regionCount; regionIndex++)
+    {
+        const Ifx_CalPage_Region *region = &config->regions[regionIndex];
+        uint32                    size   = Ifx_CalPage_getBlockSize(region->mask);
+
+        if (((region->reference & (size - 1)) != 0) || ((region->working & (size - 1)) != 0))
+        {
+            return FALSE;
+        }
+
+        blockMask |= 1U << (config->firstBlock + regionIndex);
+    }
+
+    calPage->regions     = config->regions;
+    calPage->regionCount = config->regionCount;
+    calPage->firstBlock  = config->firstBlock;
+    calPage->cpuMask     = config->cpuMask & ((1U << IFXCPU_NUM_MODULES) - 1);
+
+    /* CSELx are the bits 0..5, in the order of the CPUs */
+    ovccon.U         = calPage->cpuMask;
+    ovccon.B.DCINVAL = config->invalidateDataCache != FALSE ? 1 : 0;
+    calPage->ovccon  = ovccon.U;
+
+    /* The flash is only visible while the overlay is stopped */
+    ovccon.B.OVSTP = 1;
+    Ifx_CalPage_writeOvccon(ovccon.U);
+    calPage->page  = Ifx_CalPage_Page_reference;
+    Ifx_CalPage_resetWorkingPage(calPage);
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        Ifx_CPU *cpuSfr;
+
+        if ((calPage->cpuMask & (1U << cpu)) == 0)
+        {
+            continue;
+        }
+
+        cpuSfr = IfxCpu_getAddress((IfxCpu_ResourceCpu)cpu);
+
+        for (regionIndex = 0; regionIndex < calPage->regionCount; regionIndex++)
+        {
+            const Ifx_CalPage_Region *region = &calPage->regions[regionIndex];
+            uint32                    block  = calPage->firstBlock + regionIndex;
+            Ifx_CPU_BLK_RABR          rabr;
+            Ifx_CPU_BLK_OTAR          otar;
+
+            /* OVEN stays cleared, it is loaded from OSEL by OVSTRT */
+            rabr.U       = 0;
+            rabr.B.OMEM  = region->memory;
+            rabr.B.OBASE = region->working >> 5;
+
+            otar.U       = 0;
+            otar.B.TBASE = region->reference >> 5;
+
+            cpuSfr->BLK[block].RABR.U  = rabr.U;
+            cpuSfr->BLK[block].OTAR.U  = otar.U;
+            cpuSfr->BLK[block].OMASK.U = ((uint32)region->mask << 5) & 0x0001FFE0;
+        }
+
+        cpuSfr->OSEL.U |= blockMask;
+    }
+
+    {
+        uint16 safetyWdtPw = IfxScuWdt_getSafetyWatchdogPassword();
+        IfxScuWdt_clearSafetyEndinit(safetyWdtPw);
+        MODULE_SCU.OVCENABLE.U |= calPage->cpuMask;
+        IfxScuWdt_setSafetyEndinit(safetyWdtPw);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_CalPage_deinit(Ifx_CalPage *calPage)
+{
+    uint32 regionIndex;
+    uint32 cpu;
+    uint32 blockMask = 0;
+
+    Ifx_CalPage_switchPage(calPage, Ifx_CalPage_Page_reference);
+
+    for (regionIndex = 0; regionIndex < calPage->regionCount; regionIndex++)
+    {
+        blockMask |= 1U << (calPage->firstBlock + regionIndex);
+    }
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        if ((calPage->cpuMask & (1U << cpu)) != 0)
+        {
+            Ifx_CPU *cpuSfr = IfxCpu_getAddress((IfxCpu_ResourceCpu)cpu);
+            cpuSfr->OSEL.U &= ~blockMask;
+
+            for (regionIndex = 0; regionIndex < calPage->regionCount; regionIndex++)
+            {
+                uint32 block = calPage->firstBlock + regionIndex;
+                cpuSfr->BLK[block].RABR.U  = 0;
+                cpuSfr->BLK[block].OTAR.U  = 0;
+                cpuSfr->BLK[block].OMASK.U = 0;
+            }
+        }
+    }
+
+    calPage->regionCount = 0;
+}
+
+
+void Ifx_CalPage_switchPage(Ifx_CalPage *calPage, Ifx_CalPage_Page page)
+{
+    Ifx_SCU_OVCCON ovccon;
+
+    ovccon.U = calPage->ovccon;
+
+    if (page == Ifx_CalPage_Page_working)
+    {
+        ovccon.B.OVSTRT = 1;
+    }
+    else
+    {
+        ovccon.B.OVSTP = 1;
+    }
+
+    /* All selected CPUs switch with this single write */
+    Ifx_CalPage_writeOvccon(ovccon.U);
+    calPage->page = page;
+}
+
+
+void *Ifx_CalPage_getWorkingAddress(const Ifx_CalPage *calPage, uint32 reference, Ifx_SizeT length)
+{
+    uint32 regionIndex;
+
+    for (regionIndex = 0; regionIndex < calPage->regionCount; regionIndex++)
+    {
+        const Ifx_CalPage_Region *region = &calPage->regions[regionIndex];
+        uint32                    size   = Ifx_CalPage_getBlockSize(region->mask);
+        uint32                    offset;
+
+        /* Segment 8 and segment A both address the reference page */
+        offset = (reference & 0x0FFFFFFFU) - (region->reference & 0x0FFFFFFFU);
+
+        if ((offset < size) && ((uint32)length <= (size - offset)))
+        {
+            return (void *)(region->working + offset);
+        }
+    }
+
+    return NULL_PTR;
+}
+
+
+boolean Ifx_CalPage_resetWorkingPage(Ifx_CalPage *calPage)
+{
+    uint32 regionIndex;
+
+    if (calPage->page != Ifx_CalPage_Page_reference)
+    {
+        return FALSE;
+    }
+
+    for (regionIndex = 0; regionIndex < calPage->regionCount; regionIndex++)
+    {
+        const Ifx_CalPage_Region *region = &calPage->regions[regionIndex];
+        memcpy((void *)region->working, (const void *)region->reference, Ifx_CalPage_getBlockSize(region->mask));
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_CalPage_write(Ifx_CalPage *calPage, uint32 reference, const void *data, Ifx_SizeT length)
+{
+    void *working = Ifx_CalPage_getWorkingAddress(calPage, reference, length);
+
+    if (working == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    memcpy(working, data, length);
+
+    return TRUE;
+}
+
+
+boolean Ifx_CalPage_shellPage(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_CalPage *calPage = data;
+
+    if (Ifx_Shell_matchToken(&args, "wp") != FALSE)
+    {
+        Ifx_CalPage_switchPage(calPage, Ifx_CalPage_Page_working);
+    }
+    else if (Ifx_Shell_matchToken(&args, "rp") != FALSE)
+    {
+        Ifx_CalPage_switchPage(calPage, Ifx_CalPage_Page_reference);
+    }
+    else if (*args != IFX_SHELL_NULL_CHAR)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error"ENDL);
+        return FALSE;
+    }
+
+    IfxStdIf_DPipe_print(io, "%s"ENDL, Ifx_CalPage_getPage(calPage) == Ifx_CalPage_Page_working ? "wp" : "rp");
+
+    return TRUE;
+}
+
+
+boolean Ifx_CalPage_shellRead(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_CalPage *calPage = data;
+    void        *address;
+    uint32       count   = 1;
+    uint32       index;
+    uint32      *working;
+
+    if (Ifx_Shell_parseAddress(&args, &address) == FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error"ENDL);
+        return FALSE;
+    }
+
+    if ((*args != IFX_SHELL_NULL_CHAR) && (Ifx_Shell_parseUInt32(&args, &count, FALSE) == FALSE))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error"ENDL);
+        return FALSE;
+    }
+
+    working = Ifx_CalPage_getWorkingAddress(calPage, (uint32)address, count * 4);
+
+    if ((working == NULL_PTR) || (((uint32)working & 3) != 0))
+    {
+        IfxStdIf_DPipe_print(io, "Invalid address"ENDL);
+        return FALSE;
+    }
+
+    for (index = 0; index < count; index++)
+    {
+        IfxStdIf_DPipe_print(io, "%08X: %08X"ENDL, (uint32)address + (index * 4), working[index]);
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_CalPage_shellWrite(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_CalPage *calPage = data;
+    void        *address;
+    uint32       value;
+    uint32       width   = 4;
+    boolean      result;
+
+    if ((Ifx_Shell_parseAddress(&args, &address) == FALSE) || (Ifx_Shell_parseUInt32(&args, &value, TRUE) == FALSE))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error"ENDL);
+        return FALSE;
+    }
+
+    if (Ifx_Shell_matchToken(&args, "b") != FALSE)
+    {
+        width = 1;
+    }
+    else if (Ifx_Shell_matchToken(&args, "h") != FALSE)
+    {
+        width = 2;
+    }
+    else
+    {
+        Ifx_Shell_matchToken(&args, "w");
+    }
+
+    if (((uint32)address & (width - 1)) != 0)
+    {
+        IfxStdIf_DPipe_print(io, "Invalid address"ENDL);
+        return FALSE;
+    }
+
+    switch (width)
+    {
+    case 1:
+    {
+        uint8 value8 = (uint8)value;
+        result = Ifx_CalPage_write(calPage, (uint32)address, &value8, 1);
+        break;
+    }
+    case 2:
+    {
+        uint16 value16 = (uint16)value;
+        result = Ifx_CalPage_write(calPage, (uint32)address, &value16, 2);
+        break;
+    }
+    default:
+        result = Ifx_CalPage_write(calPage, (uint32)address, &value, 4);
+        break;
+    }
+
+    if (result == FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Invalid address"ENDL);
+    }
+
+    return result;
+}
+
+
+boolean Ifx_CalPage_shellReset(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_CalPage *calPage = data;
+
+    (void)args;
+
+    if (Ifx_CalPage_resetWorkingPage(calPage) == FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Switch to the reference page first"ENDL);
+        return FALSE;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,237 @@
+/**
+ * \file Ifx_CalPage.h
+ * \brief Calibration page switching through the CPU data overlay
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_general_calpage Calibration pages
+ * This module maps calibration areas in program flash (reference page) to
+ * copies in RAM (working page) with the data overlay blocks of the CPUs.
+ *
+ * Each region uses the same overlay block on every selected CPU. The blocks
+ * are programmed once by Ifx_CalPage_init() and left disabled; their OSEL bits
+ * are set so that a single write to SCU_OVCCON with OVSTRT or OVSTP enables or
+ * disables all of them on all selected CPUs at the same time. Switching pages
+ * is therefore one register write and never copies data: the working page is
+ * filled from the reference page when the manager is initialised, and is then
+ * edited in place, e.g. with the shell commands below.
+ *
+ * The redirection applies to segment 8 and segment A accesses. Data read
+ * through segment 8 may be held in the data cache, therefore the page switch
+ * also requests DCINVAL for the selected CPUs when
+ * Ifx_CalPage_Config.invalidateDataCache is TRUE. The data cache must not hold
+ * dirty lines that have to survive the switch in this case. Online edits are
+ * seen at once by reads through segment A; reads through segment 8 may return
+ * a cached value until the line is evicted or the page is switched again.
+ *
+ * The manager owns the overlay of the selected CPUs: OVSTRT enables every
+ * block selected in OSEL, including blocks that were configured by others.
+ *
+ * Example of shell commands:
+ * \code
+ * Ifx_CalPage g_calPage;
+ *
+ * const Ifx_Shell_Command g_calPageShellCommands[] =
+ * {
+ *     IFX_CALPAGE_SHELL_COMMANDS(&g_calPage),
+ *     IFX_SHELL_COMMAND_LIST_END
+ * };
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_general
+ */
+
+#ifndef IFX_CALPAGE_H
+#define IFX_CALPAGE_H 1
+
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+#ifndef IFX_CFG_CALPAGE_OVERLAY_BLOCK_COUNT
+#define IFX_CFG_CALPAGE_OVERLAY_BLOCK_COUNT (32)    /**< \brief Number of overlay blocks per CPU */
+#endif
+
+/** \brief Calibration page */
+typedef enum
+{
+    Ifx_CalPage_Page_reference = 0,  /**< \brief Reads return the flash content */
+    Ifx_CalPage_Page_working   = 1   /**< \brief Reads are redirected to the RAM copy */
+} Ifx_CalPage_Page;
+
+/** \brief Calibration region, mapped by one overlay block per CPU
+ *
+ * The size of the region is given by the mask; both addresses must be aligned
+ * to that size.
+ */
+typedef struct
+{
+    uint32                     reference; /**< \brief Address of the region in program flash */
+    uint32                     working;   /**< \brief Address of the RAM copy, as seen by the CPU doing the edits */
+    IfxCpu_OverlayMemorySelect memory;    /**< \brief Memory holding the RAM copy */
+    IfxCpu_OverlayAddressMask  mask;      /**< \brief Size of the region */
+} Ifx_CalPage_Region;
+
+/** \brief Calibration page manager configuration */
+typedef struct
+{
+    const Ifx_CalPage_Region *regions;             /**< \brief Table of regions */
+    uint8                     regionCount;         /**< \brief Number of regions in the table */
+    uint8                     firstBlock;          /**< \brief Overlay block used by the first region, the next regions use the following blocks */
+    uint8                     cpuMask;             /**< \brief CPUs whose accesses are redirected, bit n selects CPUn */
+    boolean                   invalidateDataCache; /**< \brief Invalidate the data cache of the selected CPUs on each switch */
+} Ifx_CalPage_Config;
+
+/** \brief Calibration page manager object */
+typedef struct
+{
+    const Ifx_CalPage_Region *regions;     /**< \brief Table of regions */
+    uint8                     regionCount; /**< \brief Number of regions in the table */
+    uint8                     firstBlock;  /**< \brief Overlay block used by the first region */
+    uint8                     cpuMask;     /**< \brief CPUs whose accesses are redirected */
+    uint32                    ovccon;      /**< \brief Value written to SCU_OVCCON on a switch, without OVSTRT / OVSTP */
+    volatile Ifx_CalPage_Page page;        /**< \brief Active page */
+} Ifx_CalPage;
+
+/** \brief Shell command list entries for a calibration page manager
+ * \param calPage Pointer to the Ifx_CalPage object
+ */
+#define IFX_CALPAGE_SHELL_COMMANDS(calPage)                                         \
+    {"calpage", "  : show or switch the active calibration page"ENDL                \
+     "/s calpage [wp|rp]"ENDL                                                       \
+     "/p wp: switch to the working page (RAM)"ENDL                                  \
+     "/p rp: switch to the reference page (flash)"                                  \
+     , (calPage), &Ifx_CalPage_shellPage},                                          \
+    {"calrd", "    : read words of the working page"ENDL                            \
+     "/s calrd <address> [<count>]"ENDL                                             \
+     "/p <address>: reference address, hexadecimal"ENDL                             \
+     "/p <count>: number of 32 bit words, default 1"                                \
+     , (calPage), &Ifx_CalPage_shellRead},                                          \
+    {"calwr", "    : write the working page"ENDL                                    \
+     "/s calwr <address> <value> [b|h|w]"ENDL                                       \
+     "/p <address>: reference address, hexadecimal"ENDL                             \
+     "/p <value>: value, hexadecimal"ENDL                                           \
+     "/p [b|h|w]: access width 8, 16 or 32 bit, default w"                          \
+     , (calPage), &Ifx_CalPage_shellWrite},                                         \
+    {"calreset", " : copy the reference page to the working page"                   \
+     , (calPage), &Ifx_CalPage_shellReset}
+
+/** \addtogroup library_srvsw_sysse_general_calpage
+ * \{ */
+
+/** \brief Initialise the calibration page manager
+ *
+ * Copy each reference region to its working page and program the overlay
+ * blocks of the selected CPUs. The reference page is active on return.
+ *
+ * \param calPage Pointer to the Ifx_CalPage object
+ * \param config Pointer to the configuration
+ *
+ * \return TRUE in case of success, FALSE if a region is not aligned to its
+ * size or the regions do not fit in the overlay blocks
+ */
+IFX_EXTERN boolean Ifx_CalPage_init(Ifx_CalPage *calPage, const Ifx_CalPage_Config *config);
+
+/** \brief Disable the overlay blocks of the manager on all selected CPUs
+ * \param calPage Pointer to the Ifx_CalPage object
+ */
+IFX_EXTERN void Ifx_CalPage_deinit(Ifx_CalPage *calPage);
+
+/** \brief Switch all selected CPUs to the given page at the same time
+ *
+ * This is a single write to SCU_OVCCON, no data is copied.
+ *
+ * \param calPage Pointer to the Ifx_CalPage object
+ * \param page Page to activate
+ */
+IFX_EXTERN void Ifx_CalPage_switchPage(Ifx_CalPage *calPage, Ifx_CalPage_Page page);
+
+/** \brief Return the active page
+ * \param calPage Pointer to the Ifx_CalPage object
+ */
+IFX_INLINE Ifx_CalPage_Page Ifx_CalPage_getPage(const Ifx_CalPage *calPage)
+{
+    return calPage->page;
+}
+
+/** \brief Return the working page address corresponding to a reference address
+ *
+ * \param calPage Pointer to the Ifx_CalPage object
+ * \param reference Address in a reference region
+ * \param length Number of bytes that must be inside the region
+ *
+ * \return The working page address, NULL_PTR if the range is not inside a region
+ */
+IFX_EXTERN void *Ifx_CalPage_getWorkingAddress(const Ifx_CalPage *calPage, uint32 reference, Ifx_SizeT length);
+
+/** \brief Copy the reference regions to the working page
+ *
+ * The flash can only be read while the reference page is active.
+ *
+ * \param calPage Pointer to the Ifx_CalPage object
+ *
+ * \return FALSE if the working page is active
+ */
+IFX_EXTERN boolean Ifx_CalPage_resetWorkingPage(Ifx_CalPage *calPage);
+
+/** \brief Write data to the working page
+ *
+ * The write goes to RAM whichever page is active, and is seen by the CPUs
+ * immediately when the working page is active.
+ *
+ * \param calPage Pointer to the Ifx_CalPage object
+ * \param reference Reference address of the data
+ * \param data Data to write
+ * \param length Number of bytes to write
+ *
+ * \return FALSE if the range is not inside a region
+ */
+IFX_EXTERN boolean Ifx_CalPage_write(Ifx_CalPage *calPage, uint32 reference, const void *data, Ifx_SizeT length);
+
+/** \brief Shell command "calpage [wp|rp]" */
+IFX_EXTERN boolean Ifx_CalPage_shellPage(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Shell command "calrd <address> [<count>]" */
+IFX_EXTERN boolean Ifx_CalPage_shellRead(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Shell command "calwr <address> <value> [b|h|w]" */
+IFX_EXTERN boolean Ifx_CalPage_shellWrite(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Shell command "calreset" */
+IFX_EXTERN boolean Ifx_CalPage_shellReset(pchar args, void *data, IfxStdIf_DPipe *io);
+/** \} */
+
+#endif /* IFX_CALPAGE_H */
@@ -0,0 +1,915 @@
+/**
+ * \file Ifx_Format.c
+ * \brief Streaming printf formatter
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Ifx_Format.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** \brief Flags of a conversion specification */
+#define IFX_FORMAT_FLAG_LEFT  (0x01U)    /**< \brief '-' */
+#define IFX_FORMAT_FLAG_PLUS  (0x02U)    /**< \brief '+' */
+#define IFX_FORMAT_FLAG_SPACE (0x04U)    /**< \brief ' ' */
+#define IFX_FORMAT_FLAG_ALT   (0x08U)    /**< \brief '#' */
+#define IFX_FORMAT_FLAG_ZERO  (0x10U)    /**< \brief '0' */
+#define IFX_FORMAT_FLAG_UPPER (0x20U)    /**< \brief Upper case conversion */
+
+/** \brief Fraction digits computed by the floating point conversions */
+#define IFX_FORMAT_FRACTION_DIGITS (9)
+
+/** \brief Values from this one up are too large for the 64 bit integer part of %f */
+#define IFX_FORMAT_FIXED_LIMIT     (1.8e19)
+
+/** \brief Length modifiers */
+typedef enum
+{
+    Ifx_Format_Length_none,
+    Ifx_Format_Length_hh,
+    Ifx_Format_Length_h,
+    Ifx_Format_Length_l,
+    Ifx_Format_Length_ll,
+    Ifx_Format_Length_j,
+    Ifx_Format_Length_z,
+    Ifx_Format_Length_t,
+    Ifx_Format_Length_L
+} Ifx_Format_Length;
+
+/** \brief Conversion specification */
+typedef struct
+{
+    uint8  flags;        /**< \brief IFX_FORMAT_FLAG_xxx */
+    sint32 width;        /**< \brief Minimum field width */
+    sint32 precision;    /**< \brief Precision, negative if not given */
+} Ifx_Format_Spec;
+
+/** \brief Output state of one formatted string */
+typedef struct
+{
+    Ifx_Format_Output output;                            /**< \brief Output function */
+    void             *context;                           /**< \brief Argument of the output function */
+    sint32            length;                            /**< \brief Characters produced */
+    boolean           failed;                            /**< \brief The output function returned FALSE */
+    Ifx_SizeT         fill;                              /**< \brief Characters in the chunk */
+    char              chunk[IFX_CFG_FORMAT_CHUNK_SIZE];  /**< \brief Characters not yet output */
+} Ifx_Format_State;
+
+/** \brief Floating point number split into the parts of its text */
+typedef struct
+{
+    char    integer[20];                                 /**< \brief Digits before the point */
+    sint32  integerLength;
+    sint32  integerZeros;                                /**< \brief Zeros after the integer digits */
+    boolean point;                                       /**< \brief Decimal point present */
+    char    fraction[IFX_FORMAT_FRACTION_DIGITS + 4];    /**< \brief Digits after the point, up to 3 more for the leading zeros of %g */
+    sint32  fractionLength;
+    sint32  fractionZeros;                               /**< \brief Zeros after the fraction digits */
+    char    exponent[6];                                 /**< \brief Exponent, e.g. "e+05" */
+    sint32  exponentLength;
+} Ifx_Format_Float;
+
+/** \brief Output state of Ifx_Format_vsnprintf() */
+typedef struct
+{
+    char     *buffer;
+    Ifx_SizeT size;
+    Ifx_SizeT used;
+} Ifx_Format_Buffer;
+
+static const uint32 Ifx_Format_pow10[IFX_FORMAT_FRACTION_DIGITS + 1] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+static void Ifx_Format_flush(Ifx_Format_State *state)
+{
+    if (state->fill != 0)
+    {
+        if ((state->failed == FALSE) && (state->output(state->context, state->chunk, state->fill) == FALSE))
+        {
+            state->failed = TRUE;
+        }
+
+        state->fill = 0;
+    }
+}
+
+
+static void Ifx_Format_putString(Ifx_Format_State *state, const char *data, sint32 count)
+{
+    sint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (state->fill == IFX_CFG_FORMAT_CHUNK_SIZE)
+        {
+            Ifx_Format_flush(state);
+        }
+
+        state->chunk[state->fill] = data[i];
+        state->fill++;
+    }
+
+    state->length += count;
+}
+
+
+static void Ifx_Format_putRepeat(Ifx_Format_State *state, char c, sint32 count)
+{
+    sint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        Ifx_Format_putString(state, &c, 1);
+    }
+}
+
+
+/** \brief Write the part of a field before its content
+ *
+ * That is the blanks of a right aligned field, or the prefix followed by the
+ * zeros of the '0' flag.
+ *
+ * \return The number of blanks to write after the content
+ */
+static sint32 Ifx_Format_openField(Ifx_Format_State *state, const Ifx_Format_Spec *spec, const char *prefix, sint32 prefixLength, sint32 contentLength)
+{
+    sint32 padding = spec->width - prefixLength - contentLength;
+    sint32 trailing = 0;
+
+    padding = (padding > 0) ? padding : 0;
+
+    if ((spec->flags & IFX_FORMAT_FLAG_LEFT) != 0)
+    {
+        Ifx_Format_putString(state, prefix, prefixLength);
+        trailing = padding;
+    }
+    else if ((spec->flags & IFX_FORMAT_FLAG_ZERO) != 0)
+    {
+        Ifx_Format_putString(state, prefix, prefixLength);
+        Ifx_Format_putRepeat(state, '0', padding);
+    }
+    else
+    {
+        Ifx_Format_putRepeat(state, ' ', padding);
+        Ifx_Format_putString(state, prefix, prefixLength);
+    }
+
+    return trailing;
+}
+
+
+/** \brief Convert a value to digits, written backwards from end
+ * \return The number of digits, 0 for the value 0
+ */
+static sint32 Ifx_Format_toDigits(char *end, uint64 value, uint32 base, boolean upper)
+{
+    pchar  digits = (upper != FALSE) ? "0123456789ABCDEF" : "0123456789abcdef";
+    char  *p      = end;
+    uint32 value32;
+
+    /* 64 bit divisions are library calls, only use them while needed. */
+    while (value > 0xFFFFFFFFULL)
+    {
+        p--;
+        *p    = digits[value % base];
+        value = value / base;
+    }
+
+    value32 = (uint32)value;
+
+    while (value32 != 0)
+    {
+        p--;
+        *p      = digits[value32 % base];
+        value32 = value32 / base;
+    }
+
+    return (sint32)(end - p);
+}
+
+
+static void Ifx_Format_integer(Ifx_Format_State *state, Ifx_Format_Spec *spec, uint64 value, boolean negative, char conversion)
+{
+    char    digits[22];  /* 2^64 in octal */
+    char    prefix[2];
+    sint32  prefixLength = 0;
+    uint32  base         = 10;
+    boolean upper        = (conversion == 'X') ? TRUE : FALSE;
+    sint32  count;
+    sint32  zeros;
+    sint32  trailing;
+
+    if (conversion == 'o')
+    {
+        base = 8;
+    }
+    else if ((conversion == 'x') || (conversion == 'X') || (conversion == 'p'))
+    {
+        base = 16;
+    }
+
+    if (negative != FALSE)
+    {
+        prefix[prefixLength++] = '-';
+    }
+    else if ((conversion == 'd') || (conversion == 'i'))
+    {
+        if ((spec->flags & IFX_FORMAT_FLAG_PLUS) != 0)
+        {
+            prefix[prefixLength++] = '+';
+        }
+        else if ((spec->flags & IFX_FORMAT_FLAG_SPACE) != 0)
+        {
+            prefix[prefixLength++] = ' ';
+        }
+    }
+    else if ((base == 16) && (value != 0) && ((spec->flags & IFX_FORMAT_FLAG_ALT) != 0))
+    {
+        prefix[prefixLength++] = '0';
+        prefix[prefixLength++] = (conversion == 'X') ? 'X' : 'x';
+    }
+
+    count = Ifx_Format_toDigits(&digits[sizeof(digits)], value, base, upper);
+
+    /* The precision is the minimum number of digits, 1 if not given. */
+    if (spec->precision >= 0)
+    {
+        spec->flags &= (uint8)~IFX_FORMAT_FLAG_ZERO;
+        zeros        = spec->precision - count;
+    }
+    else
+    {
+        zeros = 1 - count;
+    }
+
+    zeros = (zeros > 0) ? zeros : 0;
+
+    if ((base == 8) && (zeros == 0) && ((spec->flags & IFX_FORMAT_FLAG_ALT) != 0))
+    {
+        zeros = 1;
+    }
+
+    trailing = Ifx_Format_openField(state, spec, prefix, prefixLength, zeros + count);
+    Ifx_Format_putRepeat(state, '0', zeros);
+    Ifx_Format_putString(state, &digits[sizeof(digits) - (uint32)count], count);
+    Ifx_Format_putRepeat(state, ' ', trailing);
+}
+
+
+/** \brief Returns TRUE if the sign bit of value is set, also for -0.0 and NaN */
+static boolean Ifx_Format_isNegative(float64 value)
+{
+    union
+    {
+        float64 value;
+        uint64  bits;
+    } number;
+
+    number.value = value;
+
+    return ((number.bits >> 63) != 0) ? TRUE : FALSE;
+}
+
+
+/** \brief Returns the rounding error of product = a * b
+ *
+ * Dekker's product: the operands are split into halves whose products are
+ * exact, so the result is exact as long as nothing overflows or underflows.
+ */
+static float64 Ifx_Format_productError(float64 a, float64 b, float64 product)
+{
+    const float64 split = 134217729.0;   /* 2^27 + 1 */
+    float64       t;
+    float64       aHigh;
+    float64       aLow;
+    float64       bHigh;
+    float64       bLow;
+
+    t     = a * split;
+    aHigh = t - (t - a);
+    aLow  = a - aHigh;
+    t     = b * split;
+    bHigh = t - (t - b);
+    bLow  = b - bHigh;
+
+    return (((aHigh * bHigh) - product) + (aHigh * bLow) + (aLow * bHigh)) + (aLow * bLow);
+}
+
+
+/** \brief Round value * scale half up to an integer, for 0 <= value * scale < 2^52
+ *
+ * A product that is a half after rounding to double is decided by the exact
+ * product, so that e.g. 0.95, which is slightly less, rounds to 0.9 at one
+ * fraction digit.
+ */
+static uint64 Ifx_Format_roundScaled(float64 value, uint32 scale)
+{
+    float64 product   = value * (float64)scale;
+    uint64  integer   = (uint64)product;
+    float64 remainder = product - (float64)integer;
+
+    if ((remainder > 0.5) || ((remainder == 0.5) && (Ifx_Format_productError(value, (float64)scale, product) >= 0.0)))
+    {
+        integer++;
+    }
+
+    return integer;
+}
+
+
+/** \brief Split value into a mantissa in [1, 10) and a decimal exponent, 0 stays 0 */
+static float64 Ifx_Format_normalise(float64 value, sint32 *exponent)
+{
+    sint32 e = 0;
+
+    if (value != 0.0)
+    {
+        while (value >= 1e16)
+        {
+            value = value / 1e16;
+            e    += 16;
+        }
+
+        while (value >= 10.0)
+        {
+            value = value / 10.0;
+            e++;
+        }
+
+        while (value < 1e-16)
+        {
+            value = value * 1e16;
+            e    -= 16;
+        }
+
+        while (value < 1.0)
+        {
+            value = value * 10.0;
+            e--;
+        }
+    }
+
+    *exponent = e;
+
+    return value;
+}
+
+
+/** \brief Write value as exactly count digits, with leading zeros */
+static void Ifx_Format_fixedDigits(char *digits, uint64 value, sint32 count)
+{
+    sint32 i;
+
+    for (i = count - 1; i >= 0; i--)
+    {
+        digits[i] = (char)('0' + (value % 10U));
+        value     = value / 10U;
+    }
+}
+
+
+/** \brief Build the text of %f for value >= 0 */
+static void Ifx_Format_fixed(Ifx_Format_Float *number, float64 value, sint32 precision, boolean alt)
+{
+    sint32 digits = (precision < IFX_FORMAT_FRACTION_DIGITS) ? precision : IFX_FORMAT_FRACTION_DIGITS;
+    uint64 integer;
+    uint32 fraction;
+    sint32 exponent;
+
+    if (value < IFX_FORMAT_FIXED_LIMIT)
+    {
+        integer  = (uint64)value;
+        fraction = (uint32)Ifx_Format_roundScaled(value - (float64)integer, Ifx_Format_pow10[digits]);
+
+        if (fraction >= Ifx_Format_pow10[digits])
+        {
+            fraction -= Ifx_Format_pow10[digits];
+            integer++;
+        }
+
+        number->integerLength = Ifx_Format_toDigits(&number->integer[sizeof(number->integer)], integer, 10, FALSE);
+        number->integerZeros  = 0;
+
+        if (number->integerLength == 0)
+        {
+            number->integer[sizeof(number->integer) - 1] = '0';
+            number->integerLength                        = 1;
+        }
+    }
+    else
+    {
+        /* Keep 19 significant digits, the rest of the integer part are zeros. */
+        value                 = Ifx_Format_normalise(value, &exponent);
+        integer               = (uint64)(value * 1e18);
+        number->integerLength = Ifx_Format_toDigits(&number->integer[sizeof(number->integer)], integer, 10, FALSE);
+        number->integerZeros  = exponent - 18;
+        fraction              = 0;
+    }
+
+    number->point          = ((precision > 0) || (alt != FALSE)) ? TRUE : FALSE;
+    number->fractionLength = digits;
+    number->fractionZeros  = precision - digits;
+    number->exponentLength = 0;
+    Ifx_Format_fixedDigits(number->fraction, fraction, digits);
+}
+
+
+/** \brief Build the text of %e for value >= 0 */
+static void Ifx_Format_exponential(Ifx_Format_Float *number, float64 value, sint32 precision, boolean alt, boolean upper)
+{
+    sint32 digits = (precision < IFX_FORMAT_FRACTION_DIGITS) ? precision : IFX_FORMAT_FRACTION_DIGITS;
+    uint64 mantissa;
+    sint32 exponent;
+    uint32 magnitude;
+
+    value    = Ifx_Format_normalise(value, &exponent);
+    mantissa = Ifx_Format_roundScaled(value, Ifx_Format_pow10[digits]);
+
+    if (mantissa >= ((uint64)Ifx_Format_pow10[digits] * 10U))
+    {
+        mantissa = mantissa / 10U;
+        exponent++;
+    }
+
+    number->integer[sizeof(number->integer) - 1] = (char)('0' + (mantissa / Ifx_Format_pow10[digits]));
+    number->integerLength                        = 1;
+    number->integerZeros                         = 0;
+    number->point                                = ((precision > 0) || (alt != FALSE)) ? TRUE : FALSE;
+    number->fractionLength                       = digits;
+    number->fractionZeros                        = precision - digits;
+    Ifx_Format_fixedDigits(number->fraction, mantissa % Ifx_Format_pow10[digits], digits);
+
+    magnitude                = (uint32)((exponent < 0) ? -exponent : exponent);
+    number->exponent[0]      = (upper != FALSE) ? 'E' : 'e';
+    number->exponent[1]      = (exponent < 0) ? '-' : '+';
+    number->exponentLength   = (magnitude >= 100U) ? 5 : 4;
+    Ifx_Format_fixedDigits(&number->exponent[2], magnitude, number->exponentLength - 2);
+}
+
+
+/** \brief Build the text of %g for value >= 0 */
+static void Ifx_Format_general(Ifx_Format_Float *number, float64 value, sint32 precision, boolean alt, boolean upper)
+{
+    sint32 significant = (precision == 0) ? 1 : precision;
+    sint32 digits      = ((significant - 1) < IFX_FORMAT_FRACTION_DIGITS) ? (significant - 1) : IFX_FORMAT_FRACTION_DIGITS;
+    sint32 exponent;
+    sint32 zeros;
+    sint32 i;
+    float64 mantissa;
+
+    /* The style depends on the exponent after rounding to the precision. */
+    mantissa = Ifx_Format_normalise(value, &exponent);
+
+    if (Ifx_Format_roundScaled(mantissa, Ifx_Format_pow10[digits]) >= ((uint64)Ifx_Format_pow10[digits] * 10U))
+    {
+        exponent++;
+    }
+
+    if ((exponent >= 0) && (exponent < significant))
+    {
+        Ifx_Format_fixed(number, value, significant - 1 - exponent, alt);
+    }
+    else if ((exponent >= -4) && (exponent < 0))
+    {
+        /* The zeros after the point are not significant, so %f would lose
+         * digits: take the digits of %e and move the point in front of them. */
+        Ifx_Format_exponential(number, value, significant - 1, alt, upper);
+        zeros = -exponent - 1;
+
+        for (i = number->fractionLength - 1; i >= 0; i--)
+        {
+            number->fraction[i + zeros + 1] = number->fraction[i];
+        }
+
+        for (i = 0; i < zeros; i++)
+        {
+            number->fraction[i] = '0';
+        }
+
+        number->fraction[zeros]                      = number->integer[sizeof(number->integer) - 1];
+        number->fractionLength                      += zeros + 1;
+        number->integer[sizeof(number->integer) - 1] = '0';
+        number->point                                = TRUE;
+        number->exponentLength                       = 0;
+    }
+    else
+    {
+        Ifx_Format_exponential(number, value, significant - 1, alt, upper);
+    }
+
+    if (alt == FALSE)
+    {
+        number->fractionZeros = 0;
+
+        while ((number->fractionLength > 0) && (number->fraction[number->fractionLength - 1] == '0'))
+        {
+            number->fractionLength--;
+        }
+
+        number->point = (number->fractionLength > 0) ? TRUE : FALSE;
+    }
+}
+
+
+static void Ifx_Format_float(Ifx_Format_State *state, Ifx_Format_Spec *spec, float64 value, char conversion)
+{
+    Ifx_Format_Float number;
+    char             sign          = '\0';
+    boolean          upper         = ((spec->flags & IFX_FORMAT_FLAG_UPPER) != 0) ? TRUE : FALSE;
+    boolean          alt           = ((spec->flags & IFX_FORMAT_FLAG_ALT) != 0) ? TRUE : FALSE;
+    sint32           precision     = (spec->precision >= 0) ? spec->precision : 6;
+    sint32           contentLength;
+    sint32           trailing;
+
+    if (Ifx_Format_isNegative(value) != FALSE)
+    {
+        sign  = '-';
+        value = -value;
+    }
+    else if ((spec->flags & IFX_FORMAT_FLAG_PLUS) != 0)
+    {
+        sign = '+';
+    }
+    else if ((spec->flags & IFX_FORMAT_FLAG_SPACE) != 0)
+    {
+        sign = ' ';
+    }
+
+    if ((value != value) || ((value - value) != 0.0))
+    {
+        /* NaN, or infinity */
+        pchar text = (value != value) ? ((upper != FALSE) ? "NAN" : "nan") : ((upper != FALSE) ? "INF" : "inf");
+
+        spec->flags &= (uint8)~IFX_FORMAT_FLAG_ZERO;
+        trailing     = Ifx_Format_openField(state, spec, &sign, (sign != '\0') ? 1 : 0, 3);
+        Ifx_Format_putString(state, text, 3);
+        Ifx_Format_putRepeat(state, ' ', trailing);
+    }
+    else
+    {
+        if ((conversion == 'f') || (conversion == 'F'))
+        {
+            Ifx_Format_fixed(&number, value, precision, alt);
+        }
+        else if ((conversion == 'e') || (conversion == 'E'))
+        {
+            Ifx_Format_exponential(&number, value, precision, alt, upper);
+        }
+        else
+        {
+            Ifx_Format_general(&number, value, precision, alt, upper);
+        }
+
+        contentLength = number.integerLength + number.integerZeros + ((number.point != FALSE) ? 1 : 0)
+                        + number.fractionLength + number.fractionZeros + number.exponentLength;
+
+        trailing = Ifx_Format_openField(state, spec, &sign, (sign != '\0') ? 1 : 0, contentLength);
+        Ifx_Format_putString(state, &number.integer[sizeof(number.integer) - (uint32)number.integerLength], number.integerLength);
+        Ifx_Format_putRepeat(state, '0', number.integerZeros);
+
+        if (number.point != FALSE)
+        {
+            Ifx_Format_putString(state, ".", 1);
+        }
+
+        Ifx_Format_putString(state, number.fraction, number.fractionLength);
+        Ifx_Format_putRepeat(state, '0', number.fractionZeros);
+        Ifx_Format_putString(state, number.exponent, number.exponentLength);
+        Ifx_Format_putRepeat(state, ' ', trailing);
+    }
+}
+
+
+static void Ifx_Format_text(Ifx_Format_State *state, Ifx_Format_Spec *spec, pchar text, sint32 length)
+{
+    sint32 trailing;
+
+    spec->flags &= (uint8)~IFX_FORMAT_FLAG_ZERO;
+    trailing     = Ifx_Format_openField(state, spec, NULL_PTR, 0, length);
+    Ifx_Format_putString(state, text, length);
+    Ifx_Format_putRepeat(state, ' ', trailing);
+}
+
+
+/** \brief Parse a decimal number, moving format past it */
+static sint32 Ifx_Format_parseNumber(pchar *format)
+{
+    sint32 value = 0;
+
+    while ((**format >= '0') && (**format <= '9'))
+    {
+        value = (value * 10) + (**format - '0');
+        (*format)++;
+    }
+
+    return value;
+}
+
+
+sint32 Ifx_Format_vformat(Ifx_Format_Output output, void *context, pchar format, va_list args)
+{
+    Ifx_Format_State  state;
+    Ifx_Format_Spec   spec;
+    Ifx_Format_Length length;
+    pchar             start;
+    char              conversion;
+    char              c;
+    uint64            value;
+    sint64            signedValue;
+    pchar             text;
+    sint32            textLength;
+
+    state.output  = output;
+    state.context = context;
+    state.length  = 0;
+    state.failed  = FALSE;
+    state.fill    = 0;
+
+    while (*format != '\0')
+    {
+        if (*format != '%')
+        {
+            start = format;
+
+            while ((*format != '\0') && (*format != '%'))
+            {
+                format++;
+            }
+
+            Ifx_Format_putString(&state, start, (sint32)(format - start));
+            continue;
+        }
+
+        start = format;
+        format++;
+
+        /* Flags */
+        spec.flags = 0;
+
+        for (c = *format; (c == '-') || (c == '+') || (c == ' ') || (c == '#') || (c == '0'); c = *format)
+        {
+            spec.flags |= (uint8)((c == '-') ? IFX_FORMAT_FLAG_LEFT : (c == '+') ? IFX_FORMAT_FLAG_PLUS
+                                  : (c == ' ') ? IFX_FORMAT_FLAG_SPACE : (c == '#') ? IFX_FORMAT_FLAG_ALT : IFX_FORMAT_FLAG_ZERO);
+            format++;
+        }
+
+        /* Width */
+        if (*format == '*')
+        {
+            spec.width = va_arg(args, int);
+            format++;
+
+            if (spec.width < 0)
+            {
+                spec.flags |= IFX_FORMAT_FLAG_LEFT;
+                spec.width  = -spec.width;
+            }
+        }
+        else
+        {
+            spec.width = Ifx_Format_parseNumber(&format);
+        }
+
+        /* Precision */
+        spec.precision = -1;
+
+        if (*format == '.')
+        {
+            format++;
+
+            if (*format == '*')
+            {
+                spec.precision = va_arg(args, int);
+                format++;
+            }
+            else
+            {
+                spec.precision = Ifx_Format_parseNumber(&format);
+            }
+        }
+
+        /* Length modifier */
+        length = Ifx_Format_Length_none;
+
+        if (*format == 'h')
+        {
+            format++;
+            length = Ifx_Format_Length_h;
+
+            if (*format == 'h')
+            {
+                format++;
+                length = Ifx_Format_Length_hh;
+            }
+        }
+        else if (*format == 'l')
+        {
+            format++;
+            length = Ifx_Format_Length_l;
+
+            if (*format == 'l')
+            {
+                format++;
+                length = Ifx_Format_Length_ll;
+            }
+        }
+        else if ((*format == 'j') || (*format == 'z') || (*format == 't') || (*format == 'L'))
+        {
+            length = (*format == 'j') ? Ifx_Format_Length_j : (*format == 'z') ? Ifx_Format_Length_z
+                     : (*format == 't') ? Ifx_Format_Length_t : Ifx_Format_Length_L;
+            format++;
+        }
+
+        conversion = *format;
+
+        if ((conversion >= 'A') && (conversion <= 'Z'))
+        {
+            spec.flags |= IFX_FORMAT_FLAG_UPPER;
+        }
+
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+
+            switch (length)
+            {
+            case Ifx_Format_Length_hh: signedValue = (signed char)va_arg(args, int); break;
+            case Ifx_Format_Length_h: signedValue  = (short)va_arg(args, int); break;
+            case Ifx_Format_Length_l: signedValue  = va_arg(args, long); break;
+            case Ifx_Format_Length_ll: signedValue = va_arg(args, long long); break;
+            case Ifx_Format_Length_j: signedValue  = va_arg(args, intmax_t); break;
+            case Ifx_Format_Length_z:
+            case Ifx_Format_Length_t: signedValue  = va_arg(args, ptrdiff_t); break;
+            default: signedValue                   = va_arg(args, int); break;
+            }
+
+            value = (signedValue < 0) ? ((uint64)0 - (uint64)signedValue) : (uint64)signedValue;
+            Ifx_Format_integer(&state, &spec, value, (signedValue < 0) ? TRUE : FALSE, conversion);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+
+            switch (length)
+            {
+            case Ifx_Format_Length_hh: value = (unsigned char)va_arg(args, unsigned int); break;
+            case Ifx_Format_Length_h: value  = (unsigned short)va_arg(args, unsigned int); break;
+            case Ifx_Format_Length_l: value  = va_arg(args, unsigned long); break;
+            case Ifx_Format_Length_ll: value = va_arg(args, unsigned long long); break;
+            case Ifx_Format_Length_j: value  = va_arg(args, uintmax_t); break;
+            case Ifx_Format_Length_z: value  = va_arg(args, size_t); break;
+            case Ifx_Format_Length_t: value  = (uint64)va_arg(args, ptrdiff_t); break;
+            default: value                   = va_arg(args, unsigned int); break;
+            }
+
+            Ifx_Format_integer(&state, &spec, value, FALSE, conversion);
+            break;
+        case 'p':
+            spec.flags    |= IFX_FORMAT_FLAG_ALT;
+            spec.precision = (sint32)(2 * sizeof(void *));
+            value          = (uint64)(uintptr_t)va_arg(args, void *);
+            Ifx_Format_integer(&state, &spec, value, FALSE, conversion);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+
+            if (length == Ifx_Format_Length_L)
+            {
+                Ifx_Format_float(&state, &spec, (float64)va_arg(args, long double), conversion);
+            }
+            else
+            {
+                Ifx_Format_float(&state, &spec, va_arg(args, double), conversion);
+            }
+
+            break;
+        case 'c':
+            c = (char)va_arg(args, int);
+            Ifx_Format_text(&state, &spec, &c, 1);
+            break;
+        case 's':
+            text = va_arg(args, pchar);
+            text = (text != NULL_PTR) ? text : "(null)";
+
+            textLength = 0;
+
+            while ((text[textLength] != '\0') && ((spec.precision < 0) || (textLength < spec.precision)))
+            {
+                textLength++;
+            }
+
+            Ifx_Format_text(&state, &spec, text, textLength);
+            break;
+        case 'n':
+            (void)va_arg(args, void *);
+            break;
+        case '%':
+            Ifx_Format_putString(&state, "%", 1);
+            break;
+        default:
+            /* Unknown conversion, or the format ended inside the specification:
+             * copy it as it is. */
+            Ifx_Format_putString(&state, start, (sint32)(format - start) + ((conversion != '\0') ? 1 : 0));
+            break;
+        }
+
+        if (*format != '\0')
+        {
+            format++;
+        }
+    }
+
+    Ifx_Format_flush(&state);
+
+    return (state.failed != FALSE) ? -1 : state.length;
+}
+
+
+static boolean Ifx_Format_toBuffer(void *context, const char *data, Ifx_SizeT count)
+{
+    Ifx_Format_Buffer *buffer = (Ifx_Format_Buffer *)context;
+    Ifx_SizeT          i;
+
+    /* Keep room for the terminating character; the rest is counted, not stored. */
+    for (i = 0; (i < count) && ((buffer->used + 1) < buffer->size); i++)
+    {
+        buffer->buffer[buffer->used] = data[i];
+        buffer->used++;
+    }
+
+    return TRUE;
+}
+
+
+sint32 Ifx_Format_vsnprintf(char *buffer, Ifx_SizeT size, pchar format, va_list args)
+{
+    Ifx_Format_Buffer output;
+    sint32            length;
+
+    output.buffer = buffer;
+    output.size   = size;
+    output.used   = 0;
+
+    length        = Ifx_Format_vformat(&Ifx_Format_toBuffer, &output, format, args);
+
+    if (size > 0)
+    {
+        buffer[output.used] = '\0';
+    }
+
+    return length;
+}
+
+
+sint32 Ifx_Format_snprintf(char *buffer, Ifx_SizeT size, pchar format, ...)
+{
+    sint32  length;
+    va_list args;
+
+    va_start(args, format);
+    length = Ifx_Format_vsnprintf(buffer, size, format, args);
+    va_end(args);
+
+    return length;
+}
@@ -0,0 +1,121 @@
+/**
+ * \file Ifx_Format.h
+ * \brief Streaming printf formatter
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_general_format Formatter
+ * This module formats printf style strings without the C library.
+ *
+ * The output is produced in chunks of IFX_CFG_FORMAT_CHUNK_SIZE characters
+ * held on the caller's stack and handed to an output function, so the stack
+ * use is bounded and does not depend on the length of the result; nothing is
+ * allocated and the formatter does not call itself.  IfxStdIf_DPipe_print()
+ * and the console format into a buffer with Ifx_Format_vsnprintf() instead,
+ * so that a line reaches the pipe in one write.
+ *
+ * Supported are the flags "-+ #0", the field width and precision (also as
+ * '*'), the length modifiers hh, h, l, ll, j, z, t and L, and the conversions
+ * d i u o x X c s p % f F e E g G.  Integers that fit 32 bit are converted
+ * with 32 bit divisions only.  Floating point values are converted through
+ * integers: %f computes at most 9 fraction digits, %e and %g at most 10
+ * significant digits, and a larger precision is padded with zeros, which %g
+ * then drops.  %f rounds the last digit from the exact double value, except
+ * that an exact half rounds up where the C library rounds it to even, e.g.
+ * %.2f of 0.125 gives "0.13".  %e, %g and %f of values from 2^64 up scale the
+ * value in double and may differ from the exact digits after about 15
+ * significant digits.  The sign of -0.0 and of a negative NaN is printed.
+ * %p prints all 8 hexadecimal digits of the address.
+ * %a and wide characters are not supported, %n consumes its argument and
+ * stores nothing.
+ *
+ * \ingroup library_srvsw_sysse_general
+ */
+
+#ifndef IFX_FORMAT_H
+#define IFX_FORMAT_H 1
+
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/Ifx_Types.h"
+#include <stdarg.h>
+
+#ifndef IFX_CFG_FORMAT_CHUNK_SIZE
+#define IFX_CFG_FORMAT_CHUNK_SIZE (32)    /**< \brief Characters collected before the output function is called */
+#endif
+
+/** \brief Output function of the formatter
+ * \param context Pointer given to Ifx_Format_vformat()
+ * \param data Characters to write, not terminated
+ * \param count Number of characters
+ * \return FALSE to stop the output of the string
+ */
+typedef boolean (*Ifx_Format_Output)(void *context, const char *data, Ifx_SizeT count);
+
+/** \addtogroup library_srvsw_sysse_general_format
+ * \{ */
+
+/** \brief Format a string into an output function
+ *
+ * \param output Output function, called with up to IFX_CFG_FORMAT_CHUNK_SIZE characters at a time
+ * \param context Passed to the output function
+ * \param format printf-compatible format string
+ * \param args Arguments of the format string
+ *
+ * \return The number of characters of the formatted string, -1 if the output
+ * function returned FALSE
+ */
+IFX_EXTERN sint32 Ifx_Format_vformat(Ifx_Format_Output output, void *context, pchar format, va_list args);
+
+/** \brief Format a string into a buffer, as the C library vsnprintf()
+ *
+ * \param buffer Buffer for the string, may be NULL_PTR if size is 0
+ * \param size Size of the buffer; the string is truncated to size - 1
+ * characters and always terminated if size is not 0
+ * \param format printf-compatible format string
+ * \param args Arguments of the format string
+ *
+ * \return The length of the complete formatted string, which is size or
+ * larger if the string was truncated
+ */
+IFX_EXTERN sint32 Ifx_Format_vsnprintf(char *buffer, Ifx_SizeT size, pchar format, va_list args);
+
+/** \brief Format a string into a buffer, as the C library snprintf()
+ * \see Ifx_Format_vsnprintf()
+ */
+IFX_EXTERN sint32 Ifx_Format_snprintf(char *buffer, Ifx_SizeT size, pchar format, ...);
+/** \} */
+
+#endif /* IFX_FORMAT_H */
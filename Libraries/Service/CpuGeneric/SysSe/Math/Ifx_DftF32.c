@@ -0,0 +1,266 @@
+/**
+ * \file Ifx_DftF32.c
+ * \brief Selected bins of the discrete Fourier transform: Goertzel and sliding DFT
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_DftF32.h"
+#include <math.h>
+
+/** \brief Twiddle factor e^(-j * 2 * pi * phase / IFX_FFTF32_MAX_LENGTH), the
+ * second half of the circle from the first half in Ifx_g_FftF32_twiddleTable */
+IFX_INLINE cfloat32 Ifx_DftF32_twiddle(uint32 phase)
+{
+    cfloat32 twiddle = Ifx_g_FftF32_twiddleTable[phase & ((IFX_FFTF32_MAX_LENGTH / 2) - 1)];
+
+    if (phase >= (IFX_FFTF32_MAX_LENGTH / 2))
+    {
+        twiddle.real = -twiddle.real;
+        twiddle.imag = -twiddle.imag;
+    }
+
+    return twiddle;
+}
+
+
+/** \brief One sample of the Goertzel recursion in the form of Reinsch:
+ * d[n] = lambda * s[n - 1] + d[n - 1] + x[n], s[n] = s[n - 1] + d[n] */
+IFX_INLINE void Ifx_DftF32_goertzelStep(float32 *s, float32 *d, float32 lambda, float32 x)
+{
+    *d = *d + (lambda * *s) + x;
+    *s = *s + *d;
+}
+
+
+/** \brief Bin of the states s[nX - 1] and d[nX - 1] */
+IFX_INLINE cfloat32 Ifx_DftF32_goertzelBin(const Ifx_DftF32_Bin *bin, float32 s, float32 d)
+{
+    cfloat32 result;
+
+    result.real = (bin->last.real * s) + (bin->difference.real * d);
+    result.imag = (bin->last.imag * s) + (bin->difference.imag * d);
+
+    return result;
+}
+
+
+void Ifx_DftF32_initBins(Ifx_DftF32_Bin *bins, const float32 *frequencies, uint32 count, uint32 nX)
+{
+    uint32 k;
+
+    for (k = 0; k < count; k++)
+    {
+        /* In double, the rounding of lambda shifting the frequency */
+        float64 w = 2.0 * IFX_PI * (float64)frequencies[k] / (float64)nX;
+
+        if (cos(w) < 0.0)
+        {
+            /* Near nX / 2: run at w - pi on the samples of odd index negated */
+            w                 = w - IFX_PI;
+            bins[k].alternate = -1.0f;
+        }
+        else
+        {
+            bins[k].alternate = 1.0f;
+        }
+
+        bins[k].lambda          = (float32)(-4.0 * sin(w / 2.0) * sin(w / 2.0));
+        bins[k].last.real       = (float32)(cos(w * (float64)(nX - 1)) - cos(w * (float64)nX));
+        bins[k].last.imag       = (float32)(-sin(w * (float64)(nX - 1)) + sin(w * (float64)nX));
+        bins[k].difference.real = (float32)cos(w * (float64)nX);
+        bins[k].difference.imag = (float32)-sin(w * (float64)nX);
+    }
+}
+
+
+cfloat32 *Ifx_DftF32_goertzel(cfloat32 *R, const float32 *X, uint32 nX, const Ifx_DftF32_Bin *bins, uint32 count)
+{
+    uint32 k;
+    uint32 n;
+
+    /* Two bins at a time, sharing the loads of the samples */
+    for (k = 0; (k + 1) < count; k += 2)
+    {
+        const Ifx_DftF32_Bin *bin0 = &bins[k];
+        const Ifx_DftF32_Bin *bin1 = &bins[k + 1];
+        float32               s0   = 0.0f, d0 = 0.0f;
+        float32               s1   = 0.0f, d1 = 0.0f;
+
+        for (n = 0; (n + 1) < nX; n += 2)
+        {
+            float32 even = X[n];
+            float32 odd  = X[n + 1];
+
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, even);
+            Ifx_DftF32_goertzelStep(&s1, &d1, bin1->lambda, even);
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, odd * bin0->alternate);
+            Ifx_DftF32_goertzelStep(&s1, &d1, bin1->lambda, odd * bin1->alternate);
+        }
+
+        if (n < nX)
+        {
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, X[n]);
+            Ifx_DftF32_goertzelStep(&s1, &d1, bin1->lambda, X[n]);
+        }
+
+        R[k]     = Ifx_DftF32_goertzelBin(bin0, s0, d0);
+        R[k + 1] = Ifx_DftF32_goertzelBin(bin1, s1, d1);
+    }
+
+    if (k < count)
+    {
+        const Ifx_DftF32_Bin *bin0 = &bins[k];
+        float32               s0   = 0.0f, d0 = 0.0f;
+
+        for (n = 0; (n + 1) < nX; n += 2)
+        {
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, X[n]);
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, X[n + 1] * bin0->alternate);
+        }
+
+        if (n < nX)
+        {
+            Ifx_DftF32_goertzelStep(&s0, &d0, bin0->lambda, X[n]);
+        }
+
+        R[k] = Ifx_DftF32_goertzelBin(bin0, s0, d0);
+    }
+
+    return R;
+}
+
+
+boolean Ifx_DftF32_initSliding(Ifx_DftF32_Sliding *sliding, float32 *buffer, uint32 length, const uint16 *bins, uint32 count)
+{
+    uint32 k;
+
+    if ((length < 2) || (length > IFX_FFTF32_MAX_LENGTH) || ((length & (length - 1)) != 0)
+        || (count > IFX_DFTF32_MAX_BINS))
+    {
+        return FALSE;
+    }
+
+    for (k = 0; k < count; k++)
+    {
+        if (bins[k] >= length)
+        {
+            return FALSE;
+        }
+
+        sliding->increment[k] = bins[k] * (IFX_FFTF32_MAX_LENGTH / length);
+        sliding->phase[k]     = 0;
+        IFX_Cf32_reset(&sliding->sum[k]);
+        IFX_Cf32_reset(&sliding->restart[k]);
+    }
+
+    for (k = 0; k < length; k++)
+    {
+        buffer[k] = 0.0f;
+    }
+
+    sliding->buffer = buffer;
+    sliding->length = length;
+    sliding->index  = 0;
+    sliding->count  = count;
+
+    return TRUE;
+}
+
+
+void Ifx_DftF32_slide(Ifx_DftF32_Sliding *sliding, const float32 *X, uint32 nX)
+{
+    uint32 count = sliding->count;
+    uint32 index = sliding->index;
+    uint32 n;
+    uint32 k;
+
+    for (n = 0; n < nX; n++)
+    {
+        float32 sample = X[n];
+        float32 delta  = sample - sliding->buffer[index];
+
+        sliding->buffer[index] = sample;
+
+        for (k = 0; k < count; k++)
+        {
+            cfloat32 twiddle = Ifx_DftF32_twiddle(sliding->phase[k]);
+
+            sliding->sum[k].real     += delta * twiddle.real;
+            sliding->sum[k].imag     += delta * twiddle.imag;
+            sliding->restart[k].real += sample * twiddle.real;
+            sliding->restart[k].imag += sample * twiddle.imag;
+            sliding->phase[k]         = (sliding->phase[k] + sliding->increment[k]) & (IFX_FFTF32_MAX_LENGTH - 1);
+        }
+
+        index++;
+
+        if (index == sliding->length)
+        {
+            /* Drift correction: the restarted sums cover the window exactly */
+            index = 0;
+
+            for (k = 0; k < count; k++)
+            {
+                sliding->sum[k] = sliding->restart[k];
+                IFX_Cf32_reset(&sliding->restart[k]);
+            }
+        }
+    }
+
+    sliding->index = index;
+}
+
+
+cfloat32 *Ifx_DftF32_getSliding(cfloat32 *R, const Ifx_DftF32_Sliding *sliding)
+{
+    uint32 k;
+
+    for (k = 0; k < sliding->count; k++)
+    {
+        /* The sums are relative to buffer position 0, rotate them to the
+         * oldest sample: multiply by the conjugate of the next twiddle */
+        cfloat32 twiddle = Ifx_DftF32_twiddle(sliding->phase[k]);
+        cfloat32 sum     = sliding->sum[k];
+
+        R[k].real = (sum.real * twiddle.real) + (sum.imag * twiddle.imag);
+        R[k].imag = (sum.imag * twiddle.real) - (sum.real * twiddle.imag);
+    }
+
+    return R;
+}
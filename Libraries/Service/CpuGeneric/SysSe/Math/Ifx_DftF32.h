@@ -0,0 +1,180 @@
+/**
+ * \file Ifx_DftF32.h
+ * \brief Selected bins of the discrete Fourier transform: Goertzel and sliding DFT
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_dft Selected DFT bins
+ * This module computes a few bins of the discrete Fourier transform of a
+ * real signal, for tracking known frequencies such as a resolver carrier or
+ * the harmonics of a pump, where Ifx_FftF32_radix2() would compute all nX
+ * bins to keep a handful. The bins are those of the FFT: bin k of a block
+ * of nX samples x[n] is the sum of x[n] * e^(-j * 2 * pi * k * n / nX), as
+ * a cfloat32.
+ *
+ * Ifx_DftF32_goertzel() computes count bins of a block with the Goertzel
+ * recursion, without table. A bin may lie between two FFT bins. The
+ * recursion is that of Reinsch, on the difference d[n] = s[n] - s[n - 1] of
+ * the Goertzel states, with the coefficient -4 * sin(w / 2)^2 rather than
+ * 2 * cos(w): in float32 the plain recursion loses the low bins, where the
+ * coefficient is close to 2, to rounding, by up to the magnitude of the
+ * bin itself at 4096 samples. A bin in the upper half of the band, where
+ * cos(w) < 0, is computed at w - pi on the samples of odd index negated.
+ * Per sample and bin this takes 1.5 multiplies and three additions. The
+ * bins are run two at a time, each sample being loaded once for both.
+ * Initialise the bins once for the block length with Ifx_DftF32_initBins().
+ *
+ * Ifx_DftF32_slide() updates count bins of the last length samples at every
+ * sample, the sliding DFT, for a result at any sample rather than once per
+ * block. It is the modulated form: the twiddle factors are read from
+ * Ifx_g_FftF32_twiddleTable, rather than the running sums being rotated at
+ * every sample, so that a twiddle rounded off the unit circle cannot make
+ * them grow or decay. The rounding of the additions and subtractions of
+ * the samples still accumulates; to correct this drift a second sum of each
+ * bin restarts at every window boundary, and replaces the running sum when
+ * the window is complete. This doubles the multiplies, four per sample and
+ * bin, but bounds the error to that of two windows. Ifx_DftF32_getSliding()
+ * rotates the sums to the bins of the current window.
+ *
+ * For count bins of a block, Goertzel takes about 1.5 * count * nX
+ * multiplies and the sliding DFT 4 * count * nX, where the radix-2 FFT takes 2 * nX * log2(nX)
+ * plus the bit reversal. tools/dft_check compares them and their accuracy
+ * on the host.
+ *
+ * Example, the 2nd, 4th and 6th harmonics of a pump running at 1.5 bins of
+ * a 1024 sample block, and the carrier of a resolver at bin 256 of a 4096
+ * sample window, updated at every sample:
+ * \code
+ * float32            frequencies[3] = {3.0f, 6.0f, 9.0f};
+ * Ifx_DftF32_Bin     bins[3];
+ * cfloat32           harmonics[3];
+ * float32            window[4096];
+ * uint16             carrier = 256;
+ * Ifx_DftF32_Sliding sliding;
+ * cfloat32           carrierBin;
+ *
+ *     Ifx_DftF32_initBins(bins, frequencies, 3, 1024);
+ *     Ifx_DftF32_initSliding(&sliding, window, 4096, &carrier, 1);
+ *     ...
+ *     Ifx_DftF32_goertzel(harmonics, pressure, 1024, bins, 3);
+ *     ...
+ *     Ifx_DftF32_slide(&sliding, &sample, 1);
+ *     Ifx_DftF32_getSliding(&carrierBin, &sliding);
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ */
+
+#ifndef IFX_DFTF32_H
+#define IFX_DFTF32_H 1
+
+#include "Ifx_FftF32.h"
+
+/** \brief Maximum number of bins of an Ifx_DftF32_Sliding */
+#define IFX_DFTF32_MAX_BINS (16)
+
+/** \brief A bin of Ifx_DftF32_goertzel(), of angular frequency w per sample */
+typedef struct
+{
+    float32  lambda;                          /**< \brief -4 * sin(w / 2)^2 */
+    float32  alternate;                       /**< \brief 1, or -1 if the recursion runs at w - pi on the samples of odd index negated */
+    cfloat32 last;                            /**< \brief e^(-j * w * (nX - 1)) - e^(-j * w * nX), applied to s[nX - 1] */
+    cfloat32 difference;                      /**< \brief e^(-j * w * nX), applied to d[nX - 1] */
+} Ifx_DftF32_Bin;
+
+/** \brief Sliding DFT of selected bins */
+typedef struct
+{
+    float32 *buffer;                          /**< \brief The last length samples, circular */
+    uint32   length;                          /**< \brief Window length, a power of 2 */
+    uint32   index;                           /**< \brief Position of the next sample in buffer */
+    uint32   count;                           /**< \brief Number of bins */
+    uint32   increment[IFX_DFTF32_MAX_BINS];  /**< \brief Twiddle step of a bin per sample, in Ifx_g_FftF32_twiddleTable entries */
+    uint32   phase[IFX_DFTF32_MAX_BINS];      /**< \brief Twiddle of a bin for the next sample, modulo IFX_FFTF32_MAX_LENGTH */
+    cfloat32 sum[IFX_DFTF32_MAX_BINS];        /**< \brief Sum of a bin over the window */
+    cfloat32 restart[IFX_DFTF32_MAX_BINS];    /**< \brief Sum of a bin since buffer position 0 */
+} Ifx_DftF32_Sliding;
+
+/** \addtogroup library_srvsw_sysse_math_f32_dft
+ * \{ */
+
+/** \brief Initialise the bins of Ifx_DftF32_goertzel() for blocks of nX samples
+ * \param bins Array of count bins
+ * \param frequencies Frequency of each bin, in cycles per block, i.e. the FFT bin; it may be fractional
+ * \param count Number of bins
+ * \param nX Block length
+ */
+IFX_EXTERN void Ifx_DftF32_initBins(Ifx_DftF32_Bin *bins, const float32 *frequencies, uint32 count, uint32 nX);
+
+/** \brief Compute count bins of a block of nX real samples
+ * \param R Result, count bins
+ * \param X Samples
+ * \param nX Number of samples, the length the bins were initialised for
+ * \param bins Bins, see Ifx_DftF32_initBins()
+ * \param count Number of bins
+ * \return R
+ */
+IFX_EXTERN cfloat32 *Ifx_DftF32_goertzel(cfloat32 *R, const float32 *X, uint32 nX, const Ifx_DftF32_Bin *bins, uint32 count);
+
+/** \brief Initialise a sliding DFT, with a window of zeros
+ * \param sliding Pointer to the Ifx_DftF32_Sliding object
+ * \param buffer Array of length samples, for the window
+ * \param length Window length, a power of 2 up to IFX_FFTF32_MAX_LENGTH
+ * \param bins FFT bins to compute, each below length
+ * \param count Number of bins, up to IFX_DFTF32_MAX_BINS
+ * \return FALSE if the length, a bin or the count is out of range
+ */
+IFX_EXTERN boolean Ifx_DftF32_initSliding(Ifx_DftF32_Sliding *sliding, float32 *buffer, uint32 length, const uint16 *bins, uint32 count);
+
+/** \brief Add nX samples to the window of a sliding DFT, the oldest leaving it
+ * \param sliding Pointer to the Ifx_DftF32_Sliding object
+ * \param X Samples
+ * \param nX Number of samples, any
+ */
+IFX_EXTERN void Ifx_DftF32_slide(Ifx_DftF32_Sliding *sliding, const float32 *X, uint32 nX);
+
+/** \brief Get the bins of the current window of a sliding DFT, the first
+ * sample of the window being the oldest
+ * \param R Result, count bins
+ * \param sliding Pointer to the Ifx_DftF32_Sliding object
+ * \return R
+ */
+IFX_EXTERN cfloat32 *Ifx_DftF32_getSliding(cfloat32 *R, const Ifx_DftF32_Sliding *sliding);
+
+/** \} */
+
+#endif /* IFX_DFTF32_H */
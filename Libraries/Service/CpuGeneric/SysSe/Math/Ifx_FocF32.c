@@ -0,0 +1,242 @@
+/**
+ * \file Ifx_FocF32.c
+ * \brief Fused field-oriented current control for several motors
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_FocF32.h"
+#include "SysSe/Math/Ifx_IntegralF32.h"
+#include "SysSe/Math/Ifx_LowPassPt1F32.h"
+#include "SysSe/Math/Ifx_LutSincosF32.h"
+#include <math.h>
+
+/** \brief sqrt(3) / 2 */
+#define IFX_FOCF32_SQRT_THREE_OVER_TWO (0.86602540378443864676372317075294f)
+
+/** \brief Ifx_LutSincosF32_sin(), inlined */
+IFX_INLINE float32 Ifx_FocF32_sin(Ifx_Lut_FxpAngle fxpAngle)
+{
+    float32 result;
+    fxpAngle = fxpAngle & (IFX_LUT_ANGLE_RESOLUTION - 1);
+
+    if (fxpAngle < (IFX_LUT_ANGLE_PI / 2))
+    {
+        result = Ifx_g_LutSincosF32_table[fxpAngle];
+    }
+    else if (fxpAngle < IFX_LUT_ANGLE_PI)
+    {
+        result = Ifx_g_LutSincosF32_table[IFX_LUT_ANGLE_PI - fxpAngle];
+    }
+    else if (fxpAngle < (IFX_LUT_ANGLE_PI / 2 * 3))
+    {
+        result = -Ifx_g_LutSincosF32_table[fxpAngle - IFX_LUT_ANGLE_PI];
+    }
+    else
+    {
+        result = -Ifx_g_LutSincosF32_table[IFX_LUT_ANGLE_RESOLUTION - fxpAngle];
+    }
+
+    return result;
+}
+
+
+/** \brief Returns the on-time of a phase voltage, relative to the zero
+ * sequence, within 0 .. period */
+IFX_INLINE Ifx_TimerValue Ifx_FocF32_onTime(float32 voltage, float32 invVdc, float32 period)
+{
+    float32 onTime = (0.5f + (voltage * invVdc)) * period;
+
+    onTime = (onTime < 0.0f) ? 0.0f : onTime;
+    onTime = (onTime > period) ? period : onTime;
+
+    return (Ifx_TimerValue)(onTime + 0.5f);
+}
+
+
+void Ifx_FocF32_initConfig(Ifx_FocF32_Config *config)
+{
+    config->kp              = 0.0f;
+    config->ki              = 0.0f;
+    config->cutOffFrequency = 0.0f;
+    config->samplingTime    = 1.0f / 20000.0f;
+    config->modulationLimit = 0.95f;
+    config->period          = 0;
+}
+
+
+void Ifx_FocF32_init(Ifx_FocF32 *foc, const Ifx_FocF32_Config *config)
+{
+    Ifx_IntegralF32 integral;
+
+    if (config->cutOffFrequency > 0.0f)
+    {
+        Ifx_LowPassPt1F32        filter;
+        Ifx_LowPassPt1F32_Config filterConfig;
+
+        filterConfig.cutOffFrequency = config->cutOffFrequency;
+        filterConfig.gain            = 1.0f;
+        filterConfig.samplingTime    = config->samplingTime;
+        Ifx_LowPassPt1F32_init(&filter, &filterConfig);
+        foc->filterA = filter.a;
+        foc->filterB = filter.b;
+    }
+    else
+    {
+        /* out + in - out: the current passes, to the rounding of the filter */
+        foc->filterA = 1.0f;
+        foc->filterB = 1.0f;
+    }
+
+    Ifx_IntegralF32_init(&integral, config->ki, config->samplingTime);
+    foc->integralDelta = integral.delta;
+    foc->kp            = config->kp;
+    foc->voltageLimit  = config->modulationLimit * IFX_ONE_OVER_SQRT_THREE;
+    foc->period        = (float32)config->period;
+    foc->idRef         = 0.0f;
+    foc->iqRef         = 0.0f;
+    Ifx_FocF32_reset(foc);
+}
+
+
+void Ifx_FocF32_reset(Ifx_FocF32 *foc)
+{
+    foc->id         = 0.0f;
+    foc->iq         = 0.0f;
+    foc->idIntegral = 0.0f;
+    foc->iqIntegral = 0.0f;
+    foc->idError    = 0.0f;
+    foc->iqError    = 0.0f;
+    foc->vd         = 0.0f;
+    foc->vq         = 0.0f;
+}
+
+
+void Ifx_FocF32_step(Ifx_FocF32 *foc, const Ifx_FocF32_Input *input, Ifx_FocF32_Output *output, uint32 count)
+{
+    uint32 motor;
+
+    for (motor = 0; motor < count; motor++)
+    {
+        Ifx_FocF32             *state   = &foc[motor];
+        const Ifx_FocF32_Input *in      = &input[motor];
+        Ifx_FocF32_Output      *out     = &output[motor];
+        float32                 sine    = Ifx_FocF32_sin(in->angle);
+        float32                 cosine  = Ifx_FocF32_sin((IFX_LUT_ANGLE_PI / 2) - in->angle);
+        float32                 vMax    = in->vdc * state->voltageLimit;
+        float32                 invVdc  = 1.0f / in->vdc;
+        boolean                 limited = FALSE;
+        float32                 alpha;
+        float32                 beta;
+        float32                 id;
+        float32                 iq;
+        float32                 errorD;
+        float32                 errorQ;
+        float32                 integralD;
+        float32                 integralQ;
+        float32                 pd;
+        float32                 pq;
+        float32                 vd;
+        float32                 vq;
+        float32                 va;
+        float32                 vb;
+        float32                 vc;
+        float32                 zero;
+
+        /* Clarke and Park */
+        alpha = in->ia;
+        beta  = (in->ia + in->ib + in->ib) * IFX_ONE_OVER_SQRT_THREE;
+        id    = (alpha * cosine) + (beta * sine);
+        iq    = (beta * cosine) - (alpha * sine);
+
+        /* Ifx_LowPassPt1F32_do() */
+        id = state->id + state->filterA * id - state->filterB * state->id;
+        iq = state->iq + state->filterA * iq - state->filterB * state->iq;
+
+        /* PI controllers, the integrators as Ifx_IntegralF32_step() */
+        errorD    = state->idRef - id;
+        errorQ    = state->iqRef - iq;
+        integralD = state->idIntegral + (errorD + state->idError) * state->integralDelta;
+        integralQ = state->iqIntegral + (errorQ + state->iqError) * state->integralDelta;
+        pd        = state->kp * errorD;
+        pq        = state->kp * errorQ;
+        vd        = pd + integralD;
+        vq        = pq + integralQ;
+
+        /* Voltage limit, the d axis first */
+        if ((vd > vMax) || (vd < -vMax))
+        {
+            vd        = (vd > 0.0f) ? vMax : -vMax;
+            integralD = vd - pd;
+            limited   = TRUE;
+        }
+
+        if (((vd * vd) + (vq * vq)) > (vMax * vMax))
+        {
+            float32 vqMax = sqrtf((vMax * vMax) - (vd * vd));
+
+            vq        = (vq > 0.0f) ? vqMax : -vqMax;
+            integralQ = vq - pq;
+            limited   = TRUE;
+        }
+
+        /* Inverse Park, inverse Clarke and the zero sequence */
+        alpha = (vd * cosine) - (vq * sine);
+        beta  = (vd * sine) + (vq * cosine);
+        va    = alpha;
+        vb    = (beta * IFX_FOCF32_SQRT_THREE_OVER_TWO) - (0.5f * alpha);
+        vc    = -(beta * IFX_FOCF32_SQRT_THREE_OVER_TWO) - (0.5f * alpha);
+        zero  = (va > vb) ? ((va > vc) ? va : vc) : ((vb > vc) ? vb : vc);
+        zero += (va < vb) ? ((va < vc) ? va : vc) : ((vb < vc) ? vb : vc);
+        zero  = 0.5f * zero;
+
+        out->tOn[0]  = Ifx_FocF32_onTime(va - zero, invVdc, state->period);
+        out->tOn[1]  = Ifx_FocF32_onTime(vb - zero, invVdc, state->period);
+        out->tOn[2]  = Ifx_FocF32_onTime(vc - zero, invVdc, state->period);
+        out->limited = limited;
+
+        state->id         = id;
+        state->iq         = iq;
+        state->idIntegral = integralD;
+        state->iqIntegral = integralQ;
+        state->idError    = errorD;
+        state->iqError    = errorQ;
+        state->vd         = vd;
+        state->vq         = vq;
+    }
+}
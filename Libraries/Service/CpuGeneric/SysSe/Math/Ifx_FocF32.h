@@ -0,0 +1,218 @@
+/**
+ * \file Ifx_FocF32.h
+ * \brief Fused field-oriented current control for several motors
+ *
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ * $Date: 2014-02-28 14:15:39 GMT$
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_foc Field-oriented current control
+ * This module runs the current loop of field-oriented control for several
+ * motors in one call. For each motor it does the Clarke and Park transforms
+ * of the phase currents, a PT1 filter and a PI controller per axis, the
+ * inverse Park transform, and space vector modulation to the on-times of the
+ * three phases.
+ *
+ * The operations are those of the library blocks, in the same order:
+ * Ifx_LutSincosF32_cossin() for the rotation, Ifx_LowPassPt1F32_do() for
+ * the filters and Ifx_IntegralF32_step() for the integrators. The results
+ * are therefore bit identical to the chained calls, as long as both are
+ * compiled with the same floating point contraction. tools/foc_ref checks
+ * this on the host. The difference is that the kernel makes no calls, and
+ * that the state of a motor is one Ifx_FocF32 of 64 bytes, read once and
+ * written back once per step.
+ *
+ * Modulation injects the zero sequence -(max + min) / 2 of the three phase
+ * voltages, which gives the duty cycles of symmetrical space vector PWM with
+ * centred zero vectors. The voltage vector is limited to the circle inscribed
+ * in the hexagon, (vdc / sqrt(3)) * modulationLimit, giving priority to the d
+ * axis. An integrator is set back when its axis is limited, so that it does
+ * not wind up.
+ *
+ * Ifx_FocF32_step() makes no OS calls and takes the reciprocal of vdc once
+ * per motor. A square root is only taken while the voltage is limited. It is
+ * meant to run in the interrupt of the ADC conversion that samples the
+ * currents. Keep the state, inputs and outputs in the DSPR of the core that
+ * takes that interrupt, e.g. in the ".bss.os_coreN" section that the linker
+ * file places there.
+ *
+ * Example, with four motors whose ADC interrupt runs on core 1:
+ * \code
+ * #define MOTORS 4
+ *
+ * Ifx_FocF32        g_foc[MOTORS]    __attribute__((section(".bss.os_core1")));
+ * Ifx_FocF32_Input  g_focIn[MOTORS]  __attribute__((section(".bss.os_core1")));
+ * Ifx_FocF32_Output g_focOut[MOTORS] __attribute__((section(".bss.os_core1")));
+ *
+ *     Ifx_FocF32_initConfig(&config);
+ *     config.kp     = 2.0f;
+ *     config.ki     = 4000.0f;
+ *     config.period = IfxGtm_Tom_Timer_getPeriod(&g_timer[m]);
+ *     Ifx_FocF32_init(&g_foc[m], &config);
+ *
+ * void AdcIsr(void)
+ * {
+ *     for (m = 0; m < MOTORS; m++)
+ *     {
+ *         g_focIn[m].ia    = (results[m][0] - offset) * gain;
+ *         g_focIn[m].ib    = (results[m][1] - offset) * gain;
+ *         g_focIn[m].angle = electricalAngle(m);
+ *         g_focIn[m].vdc   = results[m][2] * vdcGain;
+ *     }
+ *
+ *     Ifx_FocF32_step(g_foc, g_focIn, g_focOut, MOTORS);
+ *
+ *     for (m = 0; m < MOTORS; m++)
+ *     {
+ *         IfxGtm_Tom_Timer_disableUpdate(&g_timer[m]);
+ *         IfxGtm_Tom_PwmHl_setOnTime(&g_pwm[m], g_focOut[m].tOn);
+ *         IfxGtm_Tom_Timer_applyUpdate(&g_timer[m]);
+ *     }
+ * }
+ * \endcode
+ * Here the speed loop task calls Ifx_FocF32_setReference(). Reading
+ * IfxCpu_getClockCounter() before and after Ifx_FocF32_step() gives its
+ * cycles on the target.
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ */
+
+#ifndef IFX_FOCF32_H
+#define IFX_FOCF32_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "SysSe/Math/Ifx_Lut.h"
+
+/** \brief Phases of a motor, the on-times of Ifx_FocF32_Output */
+#define IFX_FOCF32_PHASES (3)
+
+/** \brief Current controller configuration */
+typedef struct
+{
+    float32        kp;              /**< \brief Proportional gain, in V/A */
+    float32        ki;              /**< \brief Integral gain, in V/(A*s) */
+    float32        cutOffFrequency; /**< \brief Cut off frequency of the PT1 filters of the measured d and q currents, 0 for none */
+    float32        samplingTime;    /**< \brief Period of Ifx_FocF32_step(), in s */
+    float32        modulationLimit; /**< \brief Part of vdc / sqrt(3) the voltage vector may use, up to 1 */
+    Ifx_TimerValue period;          /**< \brief PWM period in timer ticks, see IfxGtm_Tom_Timer_getPeriod() */
+} Ifx_FocF32_Config;
+
+/** \brief Measurements of a motor for one step */
+typedef struct
+{
+    float32          ia;            /**< \brief Phase A current, in A */
+    float32          ib;            /**< \brief Phase B current, in A, phase C being -(ia + ib) */
+    Ifx_Lut_FxpAngle angle;         /**< \brief Electrical angle of the rotor */
+    float32          vdc;           /**< \brief DC link voltage, in V, above 0 */
+} Ifx_FocF32_Input;
+
+/** \brief Result of a motor for one step */
+typedef struct
+{
+    Ifx_TimerValue tOn[IFX_FOCF32_PHASES]; /**< \brief On-times of phases A, B and C, see IfxGtm_Tom_PwmHl_setOnTime() */
+    boolean        limited;                /**< \brief TRUE if the voltage vector was limited */
+} Ifx_FocF32_Output;
+
+/** \brief Current controller of one motor, 64 bytes */
+typedef struct
+{
+    float32 idRef;                  /**< \brief d current reference, in A */
+    float32 iqRef;                  /**< \brief q current reference, in A */
+    float32 id;                     /**< \brief Filtered d current, Ifx_LowPassPt1F32.out */
+    float32 iq;                     /**< \brief Filtered q current */
+    float32 idIntegral;             /**< \brief d integrator, Ifx_IntegralF32.uk */
+    float32 iqIntegral;             /**< \brief q integrator */
+    float32 idError;                /**< \brief Last d error, Ifx_IntegralF32.ik */
+    float32 iqError;                /**< \brief Last q error */
+    float32 vd;                     /**< \brief Last d voltage, in V */
+    float32 vq;                     /**< \brief Last q voltage, in V */
+    float32 kp;
+    float32 integralDelta;          /**< \brief Ifx_IntegralF32.delta */
+    float32 filterA;                /**< \brief Ifx_LowPassPt1F32.a */
+    float32 filterB;                /**< \brief Ifx_LowPassPt1F32.b */
+    float32 voltageLimit;           /**< \brief Part of vdc the voltage vector may use */
+    float32 period;                 /**< \brief PWM period in timer ticks */
+} Ifx_FocF32;
+
+/** \addtogroup library_srvsw_sysse_math_f32_foc
+ * \{ */
+
+/** \brief Initialise a configuration: no gains, no filter, a 20 kHz step and
+ * a modulation limit of 0.95
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_FocF32_initConfig(Ifx_FocF32_Config *config);
+
+/** \brief Initialise the controller of a motor, with references of 0
+ * \param foc Pointer to the Ifx_FocF32 object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_FocF32_init(Ifx_FocF32 *foc, const Ifx_FocF32_Config *config);
+
+/** \brief Clear the filters and integrators of a motor
+ * \param foc Pointer to the Ifx_FocF32 object
+ */
+IFX_EXTERN void Ifx_FocF32_reset(Ifx_FocF32 *foc);
+
+/** \brief Run one step of the current loop of count motors
+ *
+ * Call from the interrupt of the conversion that sampled the currents.
+ *
+ * \param foc Array of count Ifx_FocF32 objects
+ * \param input Measurements, one per motor
+ * \param output On-times, one per motor
+ * \param count Number of motors
+ */
+IFX_EXTERN void Ifx_FocF32_step(Ifx_FocF32 *foc, const Ifx_FocF32_Input *input, Ifx_FocF32_Output *output, uint32 count);
+
+/** \brief Set the current references of a motor
+ *
+ * A step that interrupts this function may use the new d reference with the
+ * old q reference.
+ *
+ * \param foc Pointer to the Ifx_FocF32 object
+ * \param idRef d current reference, in A
+ * \param iqRef q current reference, in A
+ */
+IFX_INLINE void Ifx_FocF32_setReference(Ifx_FocF32 *foc, float32 idRef, float32 iqRef)
+{
+    foc->idRef = idRef;
+    foc->iqRef = iqRef;
+}
+
+
+/** \} */
+
+#endif /* IFX_FOCF32_H */
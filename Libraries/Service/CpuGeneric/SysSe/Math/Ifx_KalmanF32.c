@@ -0,0 +1,2803 @@
+/**
+ * \file Ifx_KalmanF32.c
+ * \brief Kalman filter of fixed size
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_KalmanF32.h"
+#include <math.h>
+
+
+void Ifx_KalmanF32_predict2(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[4];
+
+    t[0] = f[0] * p[0] + f[1] * p[2];
+    t[1] = f[0] * p[1] + f[1] * p[3];
+    t[2] = f[2] * p[0] + f[3] * p[2];
+    t[3] = f[2] * p[1] + f[3] * p[3];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + q[0];
+    p[1] = t[0] * f[2] + t[1] * f[3] + q[1];
+    p[3] = t[2] * f[2] + t[3] * f[3] + q[3];
+
+    p[2] = p[1];
+}
+
+
+void Ifx_KalmanF32_predict3(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[9];
+
+    t[0] = f[0] * p[0] + f[1] * p[3] + f[2] * p[6];
+    t[1] = f[0] * p[1] + f[1] * p[4] + f[2] * p[7];
+    t[2] = f[0] * p[2] + f[1] * p[5] + f[2] * p[8];
+    t[3] = f[3] * p[0] + f[4] * p[3] + f[5] * p[6];
+    t[4] = f[3] * p[1] + f[4] * p[4] + f[5] * p[7];
+    t[5] = f[3] * p[2] + f[4] * p[5] + f[5] * p[8];
+    t[6] = f[6] * p[0] + f[7] * p[3] + f[8] * p[6];
+    t[7] = f[6] * p[1] + f[7] * p[4] + f[8] * p[7];
+    t[8] = f[6] * p[2] + f[7] * p[5] + f[8] * p[8];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + q[0];
+    p[1] = t[0] * f[3] + t[1] * f[4] + t[2] * f[5] + q[1];
+    p[2] = t[0] * f[6] + t[1] * f[7] + t[2] * f[8] + q[2];
+    p[4] = t[3] * f[3] + t[4] * f[4] + t[5] * f[5] + q[4];
+    p[5] = t[3] * f[6] + t[4] * f[7] + t[5] * f[8] + q[5];
+    p[8] = t[6] * f[6] + t[7] * f[7] + t[8] * f[8] + q[8];
+
+    p[3] = p[1];
+    p[6] = p[2];
+    p[7] = p[5];
+}
+
+
+void Ifx_KalmanF32_predict4(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[16];
+
+    t[0] = f[0] * p[0] + f[1] * p[4] + f[2] * p[8] + f[3] * p[12];
+    t[1] = f[0] * p[1] + f[1] * p[5] + f[2] * p[9] + f[3] * p[13];
+    t[2] = f[0] * p[2] + f[1] * p[6] + f[2] * p[10] + f[3] * p[14];
+    t[3] = f[0] * p[3] + f[1] * p[7] + f[2] * p[11] + f[3] * p[15];
+    t[4] = f[4] * p[0] + f[5] * p[4] + f[6] * p[8] + f[7] * p[12];
+    t[5] = f[4] * p[1] + f[5] * p[5] + f[6] * p[9] + f[7] * p[13];
+    t[6] = f[4] * p[2] + f[5] * p[6] + f[6] * p[10] + f[7] * p[14];
+    t[7] = f[4] * p[3] + f[5] * p[7] + f[6] * p[11] + f[7] * p[15];
+    t[8] = f[8] * p[0] + f[9] * p[4] + f[10] * p[8] + f[11] * p[12];
+    t[9] = f[8] * p[1] + f[9] * p[5] + f[10] * p[9] + f[11] * p[13];
+    t[10] = f[8] * p[2] + f[9] * p[6] + f[10] * p[10] + f[11] * p[14];
+    t[11] = f[8] * p[3] + f[9] * p[7] + f[10] * p[11] + f[11] * p[15];
+    t[12] = f[12] * p[0] + f[13] * p[4] + f[14] * p[8] + f[15] * p[12];
+    t[13] = f[12] * p[1] + f[13] * p[5] + f[14] * p[9] + f[15] * p[13];
+    t[14] = f[12] * p[2] + f[13] * p[6] + f[14] * p[10] + f[15] * p[14];
+    t[15] = f[12] * p[3] + f[13] * p[7] + f[14] * p[11] + f[15] * p[15];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + t[3] * f[3] + q[0];
+    p[1] = t[0] * f[4] + t[1] * f[5] + t[2] * f[6] + t[3] * f[7] + q[1];
+    p[2] = t[0] * f[8] + t[1] * f[9] + t[2] * f[10] + t[3] * f[11] + q[2];
+    p[3] = t[0] * f[12] + t[1] * f[13] + t[2] * f[14] + t[3] * f[15] + q[3];
+    p[5] = t[4] * f[4] + t[5] * f[5] + t[6] * f[6] + t[7] * f[7] + q[5];
+    p[6] = t[4] * f[8] + t[5] * f[9] + t[6] * f[10] + t[7] * f[11] + q[6];
+    p[7] = t[4] * f[12] + t[5] * f[13] + t[6] * f[14] + t[7] * f[15] + q[7];
+    p[10] = t[8] * f[8] + t[9] * f[9] + t[10] * f[10] + t[11] * f[11] + q[10];
+    p[11] = t[8] * f[12] + t[9] * f[13] + t[10] * f[14] + t[11] * f[15] + q[11];
+    p[15] = t[12] * f[12] + t[13] * f[13] + t[14] * f[14] + t[15] * f[15] + q[15];
+
+    p[4] = p[1];
+    p[8] = p[2];
+    p[12] = p[3];
+    p[9] = p[6];
+    p[13] = p[7];
+    p[14] = p[11];
+}
+
+
+void Ifx_KalmanF32_predict6(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[36];
+
+    t[0] = f[0] * p[0] + f[1] * p[6] + f[2] * p[12] + f[3] * p[18] + f[4] * p[24] + f[5] * p[30];
+    t[1] = f[0] * p[1] + f[1] * p[7] + f[2] * p[13] + f[3] * p[19] + f[4] * p[25] + f[5] * p[31];
+    t[2] = f[0] * p[2] + f[1] * p[8] + f[2] * p[14] + f[3] * p[20] + f[4] * p[26] + f[5] * p[32];
+    t[3] = f[0] * p[3] + f[1] * p[9] + f[2] * p[15] + f[3] * p[21] + f[4] * p[27] + f[5] * p[33];
+    t[4] = f[0] * p[4] + f[1] * p[10] + f[2] * p[16] + f[3] * p[22] + f[4] * p[28] + f[5] * p[34];
+    t[5] = f[0] * p[5] + f[1] * p[11] + f[2] * p[17] + f[3] * p[23] + f[4] * p[29] + f[5] * p[35];
+    t[6] = f[6] * p[0] + f[7] * p[6] + f[8] * p[12] + f[9] * p[18] + f[10] * p[24] + f[11] * p[30];
+    t[7] = f[6] * p[1] + f[7] * p[7] + f[8] * p[13] + f[9] * p[19] + f[10] * p[25] + f[11] * p[31];
+    t[8] = f[6] * p[2] + f[7] * p[8] + f[8] * p[14] + f[9] * p[20] + f[10] * p[26] + f[11] * p[32];
+    t[9] = f[6] * p[3] + f[7] * p[9] + f[8] * p[15] + f[9] * p[21] + f[10] * p[27] + f[11] * p[33];
+    t[10] = f[6] * p[4] + f[7] * p[10] + f[8] * p[16] + f[9] * p[22] + f[10] * p[28] + f[11] * p[34];
+    t[11] = f[6] * p[5] + f[7] * p[11] + f[8] * p[17] + f[9] * p[23] + f[10] * p[29] + f[11] * p[35];
+    t[12] = f[12] * p[0] + f[13] * p[6] + f[14] * p[12] + f[15] * p[18] + f[16] * p[24] + f[17] * p[30];
+    t[13] = f[12] * p[1] + f[13] * p[7] + f[14] * p[13] + f[15] * p[19] + f[16] * p[25] + f[17] * p[31];
+    t[14] = f[12] * p[2] + f[13] * p[8] + f[14] * p[14] + f[15] * p[20] + f[16] * p[26] + f[17] * p[32];
+    t[15] = f[12] * p[3] + f[13] * p[9] + f[14] * p[15] + f[15] * p[21] + f[16] * p[27] + f[17] * p[33];
+    t[16] = f[12] * p[4] + f[13] * p[10] + f[14] * p[16] + f[15] * p[22] + f[16] * p[28] + f[17] * p[34];
+    t[17] = f[12] * p[5] + f[13] * p[11] + f[14] * p[17] + f[15] * p[23] + f[16] * p[29] + f[17] * p[35];
+    t[18] = f[18] * p[0] + f[19] * p[6] + f[20] * p[12] + f[21] * p[18] + f[22] * p[24] + f[23] * p[30];
+    t[19] = f[18] * p[1] + f[19] * p[7] + f[20] * p[13] + f[21] * p[19] + f[22] * p[25] + f[23] * p[31];
+    t[20] = f[18] * p[2] + f[19] * p[8] + f[20] * p[14] + f[21] * p[20] + f[22] * p[26] + f[23] * p[32];
+    t[21] = f[18] * p[3] + f[19] * p[9] + f[20] * p[15] + f[21] * p[21] + f[22] * p[27] + f[23] * p[33];
+    t[22] = f[18] * p[4] + f[19] * p[10] + f[20] * p[16] + f[21] * p[22] + f[22] * p[28] + f[23] * p[34];
+    t[23] = f[18] * p[5] + f[19] * p[11] + f[20] * p[17] + f[21] * p[23] + f[22] * p[29] + f[23] * p[35];
+    t[24] = f[24] * p[0] + f[25] * p[6] + f[26] * p[12] + f[27] * p[18] + f[28] * p[24] + f[29] * p[30];
+    t[25] = f[24] * p[1] + f[25] * p[7] + f[26] * p[13] + f[27] * p[19] + f[28] * p[25] + f[29] * p[31];
+    t[26] = f[24] * p[2] + f[25] * p[8] + f[26] * p[14] + f[27] * p[20] + f[28] * p[26] + f[29] * p[32];
+    t[27] = f[24] * p[3] + f[25] * p[9] + f[26] * p[15] + f[27] * p[21] + f[28] * p[27] + f[29] * p[33];
+    t[28] = f[24] * p[4] + f[25] * p[10] + f[26] * p[16] + f[27] * p[22] + f[28] * p[28] + f[29] * p[34];
+    t[29] = f[24] * p[5] + f[25] * p[11] + f[26] * p[17] + f[27] * p[23] + f[28] * p[29] + f[29] * p[35];
+    t[30] = f[30] * p[0] + f[31] * p[6] + f[32] * p[12] + f[33] * p[18] + f[34] * p[24] + f[35] * p[30];
+    t[31] = f[30] * p[1] + f[31] * p[7] + f[32] * p[13] + f[33] * p[19] + f[34] * p[25] + f[35] * p[31];
+    t[32] = f[30] * p[2] + f[31] * p[8] + f[32] * p[14] + f[33] * p[20] + f[34] * p[26] + f[35] * p[32];
+    t[33] = f[30] * p[3] + f[31] * p[9] + f[32] * p[15] + f[33] * p[21] + f[34] * p[27] + f[35] * p[33];
+    t[34] = f[30] * p[4] + f[31] * p[10] + f[32] * p[16] + f[33] * p[22] + f[34] * p[28] + f[35] * p[34];
+    t[35] = f[30] * p[5] + f[31] * p[11] + f[32] * p[17] + f[33] * p[23] + f[34] * p[29] + f[35] * p[35];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + t[3] * f[3] + t[4] * f[4] + t[5] * f[5] + q[0];
+    p[1] = t[0] * f[6] + t[1] * f[7] + t[2] * f[8] + t[3] * f[9] + t[4] * f[10] + t[5] * f[11] + q[1];
+    p[2] = t[0] * f[12] + t[1] * f[13] + t[2] * f[14] + t[3] * f[15] + t[4] * f[16] + t[5] * f[17] + q[2];
+    p[3] = t[0] * f[18] + t[1] * f[19] + t[2] * f[20] + t[3] * f[21] + t[4] * f[22] + t[5] * f[23] + q[3];
+    p[4] = t[0] * f[24] + t[1] * f[25] + t[2] * f[26] + t[3] * f[27] + t[4] * f[28] + t[5] * f[29] + q[4];
+    p[5] = t[0] * f[30] + t[1] * f[31] + t[2] * f[32] + t[3] * f[33] + t[4] * f[34] + t[5] * f[35] + q[5];
+    p[7] = t[6] * f[6] + t[7] * f[7] + t[8] * f[8] + t[9] * f[9] + t[10] * f[10] + t[11] * f[11] + q[7];
+    p[8] = t[6] * f[12] + t[7] * f[13] + t[8] * f[14] + t[9] * f[15] + t[10] * f[16] + t[11] * f[17] + q[8];
+    p[9] = t[6] * f[18] + t[7] * f[19] + t[8] * f[20] + t[9] * f[21] + t[10] * f[22] + t[11] * f[23] + q[9];
+    p[10] = t[6] * f[24] + t[7] * f[25] + t[8] * f[26] + t[9] * f[27] + t[10] * f[28] + t[11] * f[29] + q[10];
+    p[11] = t[6] * f[30] + t[7] * f[31] + t[8] * f[32] + t[9] * f[33] + t[10] * f[34] + t[11] * f[35] + q[11];
+    p[14] = t[12] * f[12] + t[13] * f[13] + t[14] * f[14] + t[15] * f[15] + t[16] * f[16] + t[17] * f[17]
+          + q[14];
+    p[15] = t[12] * f[18] + t[13] * f[19] + t[14] * f[20] + t[15] * f[21] + t[16] * f[22] + t[17] * f[23]
+          + q[15];
+    p[16] = t[12] * f[24] + t[13] * f[25] + t[14] * f[26] + t[15] * f[27] + t[16] * f[28] + t[17] * f[29]
+          + q[16];
+    p[17] = t[12] * f[30] + t[13] * f[31] + t[14] * f[32] + t[15] * f[33] + t[16] * f[34] + t[17] * f[35]
+          + q[17];
+    p[21] = t[18] * f[18] + t[19] * f[19] + t[20] * f[20] + t[21] * f[21] + t[22] * f[22] + t[23] * f[23]
+          + q[21];
+    p[22] = t[18] * f[24] + t[19] * f[25] + t[20] * f[26] + t[21] * f[27] + t[22] * f[28] + t[23] * f[29]
+          + q[22];
+    p[23] = t[18] * f[30] + t[19] * f[31] + t[20] * f[32] + t[21] * f[33] + t[22] * f[34] + t[23] * f[35]
+          + q[23];
+    p[28] = t[24] * f[24] + t[25] * f[25] + t[26] * f[26] + t[27] * f[27] + t[28] * f[28] + t[29] * f[29]
+          + q[28];
+    p[29] = t[24] * f[30] + t[25] * f[31] + t[26] * f[32] + t[27] * f[33] + t[28] * f[34] + t[29] * f[35]
+          + q[29];
+    p[35] = t[30] * f[30] + t[31] * f[31] + t[32] * f[32] + t[33] * f[33] + t[34] * f[34] + t[35] * f[35]
+          + q[35];
+
+    p[6] = p[1];
+    p[12] = p[2];
+    p[18] = p[3];
+    p[24] = p[4];
+    p[30] = p[5];
+    p[13] = p[8];
+    p[19] = p[9];
+    p[25] = p[10];
+    p[31] = p[11];
+    p[20] = p[15];
+    p[26] = p[16];
+    p[32] = p[17];
+    p[27] = p[22];
+    p[33] = p[23];
+    p[34] = p[29];
+}
+
+
+void Ifx_KalmanF32_predict8(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[64];
+
+    t[0] = f[0] * p[0] + f[1] * p[8] + f[2] * p[16] + f[3] * p[24] + f[4] * p[32] + f[5] * p[40]
+         + f[6] * p[48] + f[7] * p[56];
+    t[1] = f[0] * p[1] + f[1] * p[9] + f[2] * p[17] + f[3] * p[25] + f[4] * p[33] + f[5] * p[41]
+         + f[6] * p[49] + f[7] * p[57];
+    t[2] = f[0] * p[2] + f[1] * p[10] + f[2] * p[18] + f[3] * p[26] + f[4] * p[34] + f[5] * p[42]
+         + f[6] * p[50] + f[7] * p[58];
+    t[3] = f[0] * p[3] + f[1] * p[11] + f[2] * p[19] + f[3] * p[27] + f[4] * p[35] + f[5] * p[43]
+         + f[6] * p[51] + f[7] * p[59];
+    t[4] = f[0] * p[4] + f[1] * p[12] + f[2] * p[20] + f[3] * p[28] + f[4] * p[36] + f[5] * p[44]
+         + f[6] * p[52] + f[7] * p[60];
+    t[5] = f[0] * p[5] + f[1] * p[13] + f[2] * p[21] + f[3] * p[29] + f[4] * p[37] + f[5] * p[45]
+         + f[6] * p[53] + f[7] * p[61];
+    t[6] = f[0] * p[6] + f[1] * p[14] + f[2] * p[22] + f[3] * p[30] + f[4] * p[38] + f[5] * p[46]
+         + f[6] * p[54] + f[7] * p[62];
+    t[7] = f[0] * p[7] + f[1] * p[15] + f[2] * p[23] + f[3] * p[31] + f[4] * p[39] + f[5] * p[47]
+         + f[6] * p[55] + f[7] * p[63];
+    t[8] = f[8] * p[0] + f[9] * p[8] + f[10] * p[16] + f[11] * p[24] + f[12] * p[32] + f[13] * p[40]
+         + f[14] * p[48] + f[15] * p[56];
+    t[9] = f[8] * p[1] + f[9] * p[9] + f[10] * p[17] + f[11] * p[25] + f[12] * p[33] + f[13] * p[41]
+         + f[14] * p[49] + f[15] * p[57];
+    t[10] = f[8] * p[2] + f[9] * p[10] + f[10] * p[18] + f[11] * p[26] + f[12] * p[34] + f[13] * p[42]
+          + f[14] * p[50] + f[15] * p[58];
+    t[11] = f[8] * p[3] + f[9] * p[11] + f[10] * p[19] + f[11] * p[27] + f[12] * p[35] + f[13] * p[43]
+          + f[14] * p[51] + f[15] * p[59];
+    t[12] = f[8] * p[4] + f[9] * p[12] + f[10] * p[20] + f[11] * p[28] + f[12] * p[36] + f[13] * p[44]
+          + f[14] * p[52] + f[15] * p[60];
+    t[13] = f[8] * p[5] + f[9] * p[13] + f[10] * p[21] + f[11] * p[29] + f[12] * p[37] + f[13] * p[45]
+          + f[14] * p[53] + f[15] * p[61];
+    t[14] = f[8] * p[6] + f[9] * p[14] + f[10] * p[22] + f[11] * p[30] + f[12] * p[38] + f[13] * p[46]
+          + f[14] * p[54] + f[15] * p[62];
+    t[15] = f[8] * p[7] + f[9] * p[15] + f[10] * p[23] + f[11] * p[31] + f[12] * p[39] + f[13] * p[47]
+          + f[14] * p[55] + f[15] * p[63];
+    t[16] = f[16] * p[0] + f[17] * p[8] + f[18] * p[16] + f[19] * p[24] + f[20] * p[32] + f[21] * p[40]
+          + f[22] * p[48] + f[23] * p[56];
+    t[17] = f[16] * p[1] + f[17] * p[9] + f[18] * p[17] + f[19] * p[25] + f[20] * p[33] + f[21] * p[41]
+          + f[22] * p[49] + f[23] * p[57];
+    t[18] = f[16] * p[2] + f[17] * p[10] + f[18] * p[18] + f[19] * p[26] + f[20] * p[34] + f[21] * p[42]
+          + f[22] * p[50] + f[23] * p[58];
+    t[19] = f[16] * p[3] + f[17] * p[11] + f[18] * p[19] + f[19] * p[27] + f[20] * p[35] + f[21] * p[43]
+          + f[22] * p[51] + f[23] * p[59];
+    t[20] = f[16] * p[4] + f[17] * p[12] + f[18] * p[20] + f[19] * p[28] + f[20] * p[36] + f[21] * p[44]
+          + f[22] * p[52] + f[23] * p[60];
+    t[21] = f[16] * p[5] + f[17] * p[13] + f[18] * p[21] + f[19] * p[29] + f[20] * p[37] + f[21] * p[45]
+          + f[22] * p[53] + f[23] * p[61];
+    t[22] = f[16] * p[6] + f[17] * p[14] + f[18] * p[22] + f[19] * p[30] + f[20] * p[38] + f[21] * p[46]
+          + f[22] * p[54] + f[23] * p[62];
+    t[23] = f[16] * p[7] + f[17] * p[15] + f[18] * p[23] + f[19] * p[31] + f[20] * p[39] + f[21] * p[47]
+          + f[22] * p[55] + f[23] * p[63];
+    t[24] = f[24] * p[0] + f[25] * p[8] + f[26] * p[16] + f[27] * p[24] + f[28] * p[32] + f[29] * p[40]
+          + f[30] * p[48] + f[31] * p[56];
+    t[25] = f[24] * p[1] + f[25] * p[9] + f[26] * p[17] + f[27] * p[25] + f[28] * p[33] + f[29] * p[41]
+          + f[30] * p[49] + f[31] * p[57];
+    t[26] = f[24] * p[2] + f[25] * p[10] + f[26] * p[18] + f[27] * p[26] + f[28] * p[34] + f[29] * p[42]
+          + f[30] * p[50] + f[31] * p[58];
+    t[27] = f[24] * p[3] + f[25] * p[11] + f[26] * p[19] + f[27] * p[27] + f[28] * p[35] + f[29] * p[43]
+          + f[30] * p[51] + f[31] * p[59];
+    t[28] = f[24] * p[4] + f[25] * p[12] + f[26] * p[20] + f[27] * p[28] + f[28] * p[36] + f[29] * p[44]
+          + f[30] * p[52] + f[31] * p[60];
+    t[29] = f[24] * p[5] + f[25] * p[13] + f[26] * p[21] + f[27] * p[29] + f[28] * p[37] + f[29] * p[45]
+          + f[30] * p[53] + f[31] * p[61];
+    t[30] = f[24] * p[6] + f[25] * p[14] + f[26] * p[22] + f[27] * p[30] + f[28] * p[38] + f[29] * p[46]
+          + f[30] * p[54] + f[31] * p[62];
+    t[31] = f[24] * p[7] + f[25] * p[15] + f[26] * p[23] + f[27] * p[31] + f[28] * p[39] + f[29] * p[47]
+          + f[30] * p[55] + f[31] * p[63];
+    t[32] = f[32] * p[0] + f[33] * p[8] + f[34] * p[16] + f[35] * p[24] + f[36] * p[32] + f[37] * p[40]
+          + f[38] * p[48] + f[39] * p[56];
+    t[33] = f[32] * p[1] + f[33] * p[9] + f[34] * p[17] + f[35] * p[25] + f[36] * p[33] + f[37] * p[41]
+          + f[38] * p[49] + f[39] * p[57];
+    t[34] = f[32] * p[2] + f[33] * p[10] + f[34] * p[18] + f[35] * p[26] + f[36] * p[34] + f[37] * p[42]
+          + f[38] * p[50] + f[39] * p[58];
+    t[35] = f[32] * p[3] + f[33] * p[11] + f[34] * p[19] + f[35] * p[27] + f[36] * p[35] + f[37] * p[43]
+          + f[38] * p[51] + f[39] * p[59];
+    t[36] = f[32] * p[4] + f[33] * p[12] + f[34] * p[20] + f[35] * p[28] + f[36] * p[36] + f[37] * p[44]
+          + f[38] * p[52] + f[39] * p[60];
+    t[37] = f[32] * p[5] + f[33] * p[13] + f[34] * p[21] + f[35] * p[29] + f[36] * p[37] + f[37] * p[45]
+          + f[38] * p[53] + f[39] * p[61];
+    t[38] = f[32] * p[6] + f[33] * p[14] + f[34] * p[22] + f[35] * p[30] + f[36] * p[38] + f[37] * p[46]
+          + f[38] * p[54] + f[39] * p[62];
+    t[39] = f[32] * p[7] + f[33] * p[15] + f[34] * p[23] + f[35] * p[31] + f[36] * p[39] + f[37] * p[47]
+          + f[38] * p[55] + f[39] * p[63];
+    t[40] = f[40] * p[0] + f[41] * p[8] + f[42] * p[16] + f[43] * p[24] + f[44] * p[32] + f[45] * p[40]
+          + f[46] * p[48] + f[47] * p[56];
+    t[41] = f[40] * p[1] + f[41] * p[9] + f[42] * p[17] + f[43] * p[25] + f[44] * p[33] + f[45] * p[41]
+          + f[46] * p[49] + f[47] * p[57];
+    t[42] = f[40] * p[2] + f[41] * p[10] + f[42] * p[18] + f[43] * p[26] + f[44] * p[34] + f[45] * p[42]
+          + f[46] * p[50] + f[47] * p[58];
+    t[43] = f[40] * p[3] + f[41] * p[11] + f[42] * p[19] + f[43] * p[27] + f[44] * p[35] + f[45] * p[43]
+          + f[46] * p[51] + f[47] * p[59];
+    t[44] = f[40] * p[4] + f[41] * p[12] + f[42] * p[20] + f[43] * p[28] + f[44] * p[36] + f[45] * p[44]
+          + f[46] * p[52] + f[47] * p[60];
+    t[45] = f[40] * p[5] + f[41] * p[13] + f[42] * p[21] + f[43] * p[29] + f[44] * p[37] + f[45] * p[45]
+          + f[46] * p[53] + f[47] * p[61];
+    t[46] = f[40] * p[6] + f[41] * p[14] + f[42] * p[22] + f[43] * p[30] + f[44] * p[38] + f[45] * p[46]
+          + f[46] * p[54] + f[47] * p[62];
+    t[47] = f[40] * p[7] + f[41] * p[15] + f[42] * p[23] + f[43] * p[31] + f[44] * p[39] + f[45] * p[47]
+          + f[46] * p[55] + f[47] * p[63];
+    t[48] = f[48] * p[0] + f[49] * p[8] + f[50] * p[16] + f[51] * p[24] + f[52] * p[32] + f[53] * p[40]
+          + f[54] * p[48] + f[55] * p[56];
+    t[49] = f[48] * p[1] + f[49] * p[9] + f[50] * p[17] + f[51] * p[25] + f[52] * p[33] + f[53] * p[41]
+          + f[54] * p[49] + f[55] * p[57];
+    t[50] = f[48] * p[2] + f[49] * p[10] + f[50] * p[18] + f[51] * p[26] + f[52] * p[34] + f[53] * p[42]
+          + f[54] * p[50] + f[55] * p[58];
+    t[51] = f[48] * p[3] + f[49] * p[11] + f[50] * p[19] + f[51] * p[27] + f[52] * p[35] + f[53] * p[43]
+          + f[54] * p[51] + f[55] * p[59];
+    t[52] = f[48] * p[4] + f[49] * p[12] + f[50] * p[20] + f[51] * p[28] + f[52] * p[36] + f[53] * p[44]
+          + f[54] * p[52] + f[55] * p[60];
+    t[53] = f[48] * p[5] + f[49] * p[13] + f[50] * p[21] + f[51] * p[29] + f[52] * p[37] + f[53] * p[45]
+          + f[54] * p[53] + f[55] * p[61];
+    t[54] = f[48] * p[6] + f[49] * p[14] + f[50] * p[22] + f[51] * p[30] + f[52] * p[38] + f[53] * p[46]
+          + f[54] * p[54] + f[55] * p[62];
+    t[55] = f[48] * p[7] + f[49] * p[15] + f[50] * p[23] + f[51] * p[31] + f[52] * p[39] + f[53] * p[47]
+          + f[54] * p[55] + f[55] * p[63];
+    t[56] = f[56] * p[0] + f[57] * p[8] + f[58] * p[16] + f[59] * p[24] + f[60] * p[32] + f[61] * p[40]
+          + f[62] * p[48] + f[63] * p[56];
+    t[57] = f[56] * p[1] + f[57] * p[9] + f[58] * p[17] + f[59] * p[25] + f[60] * p[33] + f[61] * p[41]
+          + f[62] * p[49] + f[63] * p[57];
+    t[58] = f[56] * p[2] + f[57] * p[10] + f[58] * p[18] + f[59] * p[26] + f[60] * p[34] + f[61] * p[42]
+          + f[62] * p[50] + f[63] * p[58];
+    t[59] = f[56] * p[3] + f[57] * p[11] + f[58] * p[19] + f[59] * p[27] + f[60] * p[35] + f[61] * p[43]
+          + f[62] * p[51] + f[63] * p[59];
+    t[60] = f[56] * p[4] + f[57] * p[12] + f[58] * p[20] + f[59] * p[28] + f[60] * p[36] + f[61] * p[44]
+          + f[62] * p[52] + f[63] * p[60];
+    t[61] = f[56] * p[5] + f[57] * p[13] + f[58] * p[21] + f[59] * p[29] + f[60] * p[37] + f[61] * p[45]
+          + f[62] * p[53] + f[63] * p[61];
+    t[62] = f[56] * p[6] + f[57] * p[14] + f[58] * p[22] + f[59] * p[30] + f[60] * p[38] + f[61] * p[46]
+          + f[62] * p[54] + f[63] * p[62];
+    t[63] = f[56] * p[7] + f[57] * p[15] + f[58] * p[23] + f[59] * p[31] + f[60] * p[39] + f[61] * p[47]
+          + f[62] * p[55] + f[63] * p[63];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + t[3] * f[3] + t[4] * f[4] + t[5] * f[5] + t[6] * f[6]
+         + t[7] * f[7] + q[0];
+    p[1] = t[0] * f[8] + t[1] * f[9] + t[2] * f[10] + t[3] * f[11] + t[4] * f[12] + t[5] * f[13]
+         + t[6] * f[14] + t[7] * f[15] + q[1];
+    p[2] = t[0] * f[16] + t[1] * f[17] + t[2] * f[18] + t[3] * f[19] + t[4] * f[20] + t[5] * f[21]
+         + t[6] * f[22] + t[7] * f[23] + q[2];
+    p[3] = t[0] * f[24] + t[1] * f[25] + t[2] * f[26] + t[3] * f[27] + t[4] * f[28] + t[5] * f[29]
+         + t[6] * f[30] + t[7] * f[31] + q[3];
+    p[4] = t[0] * f[32] + t[1] * f[33] + t[2] * f[34] + t[3] * f[35] + t[4] * f[36] + t[5] * f[37]
+         + t[6] * f[38] + t[7] * f[39] + q[4];
+    p[5] = t[0] * f[40] + t[1] * f[41] + t[2] * f[42] + t[3] * f[43] + t[4] * f[44] + t[5] * f[45]
+         + t[6] * f[46] + t[7] * f[47] + q[5];
+    p[6] = t[0] * f[48] + t[1] * f[49] + t[2] * f[50] + t[3] * f[51] + t[4] * f[52] + t[5] * f[53]
+         + t[6] * f[54] + t[7] * f[55] + q[6];
+    p[7] = t[0] * f[56] + t[1] * f[57] + t[2] * f[58] + t[3] * f[59] + t[4] * f[60] + t[5] * f[61]
+         + t[6] * f[62] + t[7] * f[63] + q[7];
+    p[9] = t[8] * f[8] + t[9] * f[9] + t[10] * f[10] + t[11] * f[11] + t[12] * f[12] + t[13] * f[13]
+         + t[14] * f[14] + t[15] * f[15] + q[9];
+    p[10] = t[8] * f[16] + t[9] * f[17] + t[10] * f[18] + t[11] * f[19] + t[12] * f[20] + t[13] * f[21]
+          + t[14] * f[22] + t[15] * f[23] + q[10];
+    p[11] = t[8] * f[24] + t[9] * f[25] + t[10] * f[26] + t[11] * f[27] + t[12] * f[28] + t[13] * f[29]
+          + t[14] * f[30] + t[15] * f[31] + q[11];
+    p[12] = t[8] * f[32] + t[9] * f[33] + t[10] * f[34] + t[11] * f[35] + t[12] * f[36] + t[13] * f[37]
+          + t[14] * f[38] + t[15] * f[39] + q[12];
+    p[13] = t[8] * f[40] + t[9] * f[41] + t[10] * f[42] + t[11] * f[43] + t[12] * f[44] + t[13] * f[45]
+          + t[14] * f[46] + t[15] * f[47] + q[13];
+    p[14] = t[8] * f[48] + t[9] * f[49] + t[10] * f[50] + t[11] * f[51] + t[12] * f[52] + t[13] * f[53]
+          + t[14] * f[54] + t[15] * f[55] + q[14];
+    p[15] = t[8] * f[56] + t[9] * f[57] + t[10] * f[58] + t[11] * f[59] + t[12] * f[60] + t[13] * f[61]
+          + t[14] * f[62] + t[15] * f[63] + q[15];
+    p[18] = t[16] * f[16] + t[17] * f[17] + t[18] * f[18] + t[19] * f[19] + t[20] * f[20] + t[21] * f[21]
+          + t[22] * f[22] + t[23] * f[23] + q[18];
+    p[19] = t[16] * f[24] + t[17] * f[25] + t[18] * f[26] + t[19] * f[27] + t[20] * f[28] + t[21] * f[29]
+          + t[22] * f[30] + t[23] * f[31] + q[19];
+    p[20] = t[16] * f[32] + t[17] * f[33] + t[18] * f[34] + t[19] * f[35] + t[20] * f[36] + t[21] * f[37]
+          + t[22] * f[38] + t[23] * f[39] + q[20];
+    p[21] = t[16] * f[40] + t[17] * f[41] + t[18] * f[42] + t[19] * f[43] + t[20] * f[44] + t[21] * f[45]
+          + t[22] * f[46] + t[23] * f[47] + q[21];
+    p[22] = t[16] * f[48] + t[17] * f[49] + t[18] * f[50] + t[19] * f[51] + t[20] * f[52] + t[21] * f[53]
+          + t[22] * f[54] + t[23] * f[55] + q[22];
+    p[23] = t[16] * f[56] + t[17] * f[57] + t[18] * f[58] + t[19] * f[59] + t[20] * f[60] + t[21] * f[61]
+          + t[22] * f[62] + t[23] * f[63] + q[23];
+    p[27] = t[24] * f[24] + t[25] * f[25] + t[26] * f[26] + t[27] * f[27] + t[28] * f[28] + t[29] * f[29]
+          + t[30] * f[30] + t[31] * f[31] + q[27];
+    p[28] = t[24] * f[32] + t[25] * f[33] + t[26] * f[34] + t[27] * f[35] + t[28] * f[36] + t[29] * f[37]
+          + t[30] * f[38] + t[31] * f[39] + q[28];
+    p[29] = t[24] * f[40] + t[25] * f[41] + t[26] * f[42] + t[27] * f[43] + t[28] * f[44] + t[29] * f[45]
+          + t[30] * f[46] + t[31] * f[47] + q[29];
+    p[30] = t[24] * f[48] + t[25] * f[49] + t[26] * f[50] + t[27] * f[51] + t[28] * f[52] + t[29] * f[53]
+          + t[30] * f[54] + t[31] * f[55] + q[30];
+    p[31] = t[24] * f[56] + t[25] * f[57] + t[26] * f[58] + t[27] * f[59] + t[28] * f[60] + t[29] * f[61]
+          + t[30] * f[62] + t[31] * f[63] + q[31];
+    p[36] = t[32] * f[32] + t[33] * f[33] + t[34] * f[34] + t[35] * f[35] + t[36] * f[36] + t[37] * f[37]
+          + t[38] * f[38] + t[39] * f[39] + q[36];
+    p[37] = t[32] * f[40] + t[33] * f[41] + t[34] * f[42] + t[35] * f[43] + t[36] * f[44] + t[37] * f[45]
+          + t[38] * f[46] + t[39] * f[47] + q[37];
+    p[38] = t[32] * f[48] + t[33] * f[49] + t[34] * f[50] + t[35] * f[51] + t[36] * f[52] + t[37] * f[53]
+          + t[38] * f[54] + t[39] * f[55] + q[38];
+    p[39] = t[32] * f[56] + t[33] * f[57] + t[34] * f[58] + t[35] * f[59] + t[36] * f[60] + t[37] * f[61]
+          + t[38] * f[62] + t[39] * f[63] + q[39];
+    p[45] = t[40] * f[40] + t[41] * f[41] + t[42] * f[42] + t[43] * f[43] + t[44] * f[44] + t[45] * f[45]
+          + t[46] * f[46] + t[47] * f[47] + q[45];
+    p[46] = t[40] * f[48] + t[41] * f[49] + t[42] * f[50] + t[43] * f[51] + t[44] * f[52] + t[45] * f[53]
+          + t[46] * f[54] + t[47] * f[55] + q[46];
+    p[47] = t[40] * f[56] + t[41] * f[57] + t[42] * f[58] + t[43] * f[59] + t[44] * f[60] + t[45] * f[61]
+          + t[46] * f[62] + t[47] * f[63] + q[47];
+    p[54] = t[48] * f[48] + t[49] * f[49] + t[50] * f[50] + t[51] * f[51] + t[52] * f[52] + t[53] * f[53]
+          + t[54] * f[54] + t[55] * f[55] + q[54];
+    p[55] = t[48] * f[56] + t[49] * f[57] + t[50] * f[58] + t[51] * f[59] + t[52] * f[60] + t[53] * f[61]
+          + t[54] * f[62] + t[55] * f[63] + q[55];
+    p[63] = t[56] * f[56] + t[57] * f[57] + t[58] * f[58] + t[59] * f[59] + t[60] * f[60] + t[61] * f[61]
+          + t[62] * f[62] + t[63] * f[63] + q[63];
+
+    p[8] = p[1];
+    p[16] = p[2];
+    p[24] = p[3];
+    p[32] = p[4];
+    p[40] = p[5];
+    p[48] = p[6];
+    p[56] = p[7];
+    p[17] = p[10];
+    p[25] = p[11];
+    p[33] = p[12];
+    p[41] = p[13];
+    p[49] = p[14];
+    p[57] = p[15];
+    p[26] = p[19];
+    p[34] = p[20];
+    p[42] = p[21];
+    p[50] = p[22];
+    p[58] = p[23];
+    p[35] = p[28];
+    p[43] = p[29];
+    p[51] = p[30];
+    p[59] = p[31];
+    p[44] = p[37];
+    p[52] = p[38];
+    p[60] = p[39];
+    p[53] = p[46];
+    p[61] = p[47];
+    p[62] = p[55];
+}
+
+
+void Ifx_KalmanF32_predict9(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[81];
+
+    t[0] = f[0] * p[0] + f[1] * p[9] + f[2] * p[18] + f[3] * p[27] + f[4] * p[36] + f[5] * p[45]
+         + f[6] * p[54] + f[7] * p[63] + f[8] * p[72];
+    t[1] = f[0] * p[1] + f[1] * p[10] + f[2] * p[19] + f[3] * p[28] + f[4] * p[37] + f[5] * p[46]
+         + f[6] * p[55] + f[7] * p[64] + f[8] * p[73];
+    t[2] = f[0] * p[2] + f[1] * p[11] + f[2] * p[20] + f[3] * p[29] + f[4] * p[38] + f[5] * p[47]
+         + f[6] * p[56] + f[7] * p[65] + f[8] * p[74];
+    t[3] = f[0] * p[3] + f[1] * p[12] + f[2] * p[21] + f[3] * p[30] + f[4] * p[39] + f[5] * p[48]
+         + f[6] * p[57] + f[7] * p[66] + f[8] * p[75];
+    t[4] = f[0] * p[4] + f[1] * p[13] + f[2] * p[22] + f[3] * p[31] + f[4] * p[40] + f[5] * p[49]
+         + f[6] * p[58] + f[7] * p[67] + f[8] * p[76];
+    t[5] = f[0] * p[5] + f[1] * p[14] + f[2] * p[23] + f[3] * p[32] + f[4] * p[41] + f[5] * p[50]
+         + f[6] * p[59] + f[7] * p[68] + f[8] * p[77];
+    t[6] = f[0] * p[6] + f[1] * p[15] + f[2] * p[24] + f[3] * p[33] + f[4] * p[42] + f[5] * p[51]
+         + f[6] * p[60] + f[7] * p[69] + f[8] * p[78];
+    t[7] = f[0] * p[7] + f[1] * p[16] + f[2] * p[25] + f[3] * p[34] + f[4] * p[43] + f[5] * p[52]
+         + f[6] * p[61] + f[7] * p[70] + f[8] * p[79];
+    t[8] = f[0] * p[8] + f[1] * p[17] + f[2] * p[26] + f[3] * p[35] + f[4] * p[44] + f[5] * p[53]
+         + f[6] * p[62] + f[7] * p[71] + f[8] * p[80];
+    t[9] = f[9] * p[0] + f[10] * p[9] + f[11] * p[18] + f[12] * p[27] + f[13] * p[36] + f[14] * p[45]
+         + f[15] * p[54] + f[16] * p[63] + f[17] * p[72];
+    t[10] = f[9] * p[1] + f[10] * p[10] + f[11] * p[19] + f[12] * p[28] + f[13] * p[37] + f[14] * p[46]
+          + f[15] * p[55] + f[16] * p[64] + f[17] * p[73];
+    t[11] = f[9] * p[2] + f[10] * p[11] + f[11] * p[20] + f[12] * p[29] + f[13] * p[38] + f[14] * p[47]
+          + f[15] * p[56] + f[16] * p[65] + f[17] * p[74];
+    t[12] = f[9] * p[3] + f[10] * p[12] + f[11] * p[21] + f[12] * p[30] + f[13] * p[39] + f[14] * p[48]
+          + f[15] * p[57] + f[16] * p[66] + f[17] * p[75];
+    t[13] = f[9] * p[4] + f[10] * p[13] + f[11] * p[22] + f[12] * p[31] + f[13] * p[40] + f[14] * p[49]
+          + f[15] * p[58] + f[16] * p[67] + f[17] * p[76];
+    t[14] = f[9] * p[5] + f[10] * p[14] + f[11] * p[23] + f[12] * p[32] + f[13] * p[41] + f[14] * p[50]
+          + f[15] * p[59] + f[16] * p[68] + f[17] * p[77];
+    t[15] = f[9] * p[6] + f[10] * p[15] + f[11] * p[24] + f[12] * p[33] + f[13] * p[42] + f[14] * p[51]
+          + f[15] * p[60] + f[16] * p[69] + f[17] * p[78];
+    t[16] = f[9] * p[7] + f[10] * p[16] + f[11] * p[25] + f[12] * p[34] + f[13] * p[43] + f[14] * p[52]
+          + f[15] * p[61] + f[16] * p[70] + f[17] * p[79];
+    t[17] = f[9] * p[8] + f[10] * p[17] + f[11] * p[26] + f[12] * p[35] + f[13] * p[44] + f[14] * p[53]
+          + f[15] * p[62] + f[16] * p[71] + f[17] * p[80];
+    t[18] = f[18] * p[0] + f[19] * p[9] + f[20] * p[18] + f[21] * p[27] + f[22] * p[36] + f[23] * p[45]
+          + f[24] * p[54] + f[25] * p[63] + f[26] * p[72];
+    t[19] = f[18] * p[1] + f[19] * p[10] + f[20] * p[19] + f[21] * p[28] + f[22] * p[37] + f[23] * p[46]
+          + f[24] * p[55] + f[25] * p[64] + f[26] * p[73];
+    t[20] = f[18] * p[2] + f[19] * p[11] + f[20] * p[20] + f[21] * p[29] + f[22] * p[38] + f[23] * p[47]
+          + f[24] * p[56] + f[25] * p[65] + f[26] * p[74];
+    t[21] = f[18] * p[3] + f[19] * p[12] + f[20] * p[21] + f[21] * p[30] + f[22] * p[39] + f[23] * p[48]
+          + f[24] * p[57] + f[25] * p[66] + f[26] * p[75];
+    t[22] = f[18] * p[4] + f[19] * p[13] + f[20] * p[22] + f[21] * p[31] + f[22] * p[40] + f[23] * p[49]
+          + f[24] * p[58] + f[25] * p[67] + f[26] * p[76];
+    t[23] = f[18] * p[5] + f[19] * p[14] + f[20] * p[23] + f[21] * p[32] + f[22] * p[41] + f[23] * p[50]
+          + f[24] * p[59] + f[25] * p[68] + f[26] * p[77];
+    t[24] = f[18] * p[6] + f[19] * p[15] + f[20] * p[24] + f[21] * p[33] + f[22] * p[42] + f[23] * p[51]
+          + f[24] * p[60] + f[25] * p[69] + f[26] * p[78];
+    t[25] = f[18] * p[7] + f[19] * p[16] + f[20] * p[25] + f[21] * p[34] + f[22] * p[43] + f[23] * p[52]
+          + f[24] * p[61] + f[25] * p[70] + f[26] * p[79];
+    t[26] = f[18] * p[8] + f[19] * p[17] + f[20] * p[26] + f[21] * p[35] + f[22] * p[44] + f[23] * p[53]
+          + f[24] * p[62] + f[25] * p[71] + f[26] * p[80];
+    t[27] = f[27] * p[0] + f[28] * p[9] + f[29] * p[18] + f[30] * p[27] + f[31] * p[36] + f[32] * p[45]
+          + f[33] * p[54] + f[34] * p[63] + f[35] * p[72];
+    t[28] = f[27] * p[1] + f[28] * p[10] + f[29] * p[19] + f[30] * p[28] + f[31] * p[37] + f[32] * p[46]
+          + f[33] * p[55] + f[34] * p[64] + f[35] * p[73];
+    t[29] = f[27] * p[2] + f[28] * p[11] + f[29] * p[20] + f[30] * p[29] + f[31] * p[38] + f[32] * p[47]
+          + f[33] * p[56] + f[34] * p[65] + f[35] * p[74];
+    t[30] = f[27] * p[3] + f[28] * p[12] + f[29] * p[21] + f[30] * p[30] + f[31] * p[39] + f[32] * p[48]
+          + f[33] * p[57] + f[34] * p[66] + f[35] * p[75];
+    t[31] = f[27] * p[4] + f[28] * p[13] + f[29] * p[22] + f[30] * p[31] + f[31] * p[40] + f[32] * p[49]
+          + f[33] * p[58] + f[34] * p[67] + f[35] * p[76];
+    t[32] = f[27] * p[5] + f[28] * p[14] + f[29] * p[23] + f[30] * p[32] + f[31] * p[41] + f[32] * p[50]
+          + f[33] * p[59] + f[34] * p[68] + f[35] * p[77];
+    t[33] = f[27] * p[6] + f[28] * p[15] + f[29] * p[24] + f[30] * p[33] + f[31] * p[42] + f[32] * p[51]
+          + f[33] * p[60] + f[34] * p[69] + f[35] * p[78];
+    t[34] = f[27] * p[7] + f[28] * p[16] + f[29] * p[25] + f[30] * p[34] + f[31] * p[43] + f[32] * p[52]
+          + f[33] * p[61] + f[34] * p[70] + f[35] * p[79];
+    t[35] = f[27] * p[8] + f[28] * p[17] + f[29] * p[26] + f[30] * p[35] + f[31] * p[44] + f[32] * p[53]
+          + f[33] * p[62] + f[34] * p[71] + f[35] * p[80];
+    t[36] = f[36] * p[0] + f[37] * p[9] + f[38] * p[18] + f[39] * p[27] + f[40] * p[36] + f[41] * p[45]
+          + f[42] * p[54] + f[43] * p[63] + f[44] * p[72];
+    t[37] = f[36] * p[1] + f[37] * p[10] + f[38] * p[19] + f[39] * p[28] + f[40] * p[37] + f[41] * p[46]
+          + f[42] * p[55] + f[43] * p[64] + f[44] * p[73];
+    t[38] = f[36] * p[2] + f[37] * p[11] + f[38] * p[20] + f[39] * p[29] + f[40] * p[38] + f[41] * p[47]
+          + f[42] * p[56] + f[43] * p[65] + f[44] * p[74];
+    t[39] = f[36] * p[3] + f[37] * p[12] + f[38] * p[21] + f[39] * p[30] + f[40] * p[39] + f[41] * p[48]
+          + f[42] * p[57] + f[43] * p[66] + f[44] * p[75];
+    t[40] = f[36] * p[4] + f[37] * p[13] + f[38] * p[22] + f[39] * p[31] + f[40] * p[40] + f[41] * p[49]
+          + f[42] * p[58] + f[43] * p[67] + f[44] * p[76];
+    t[41] = f[36] * p[5] + f[37] * p[14] + f[38] * p[23] + f[39] * p[32] + f[40] * p[41] + f[41] * p[50]
+          + f[42] * p[59] + f[43] * p[68] + f[44] * p[77];
+    t[42] = f[36] * p[6] + f[37] * p[15] + f[38] * p[24] + f[39] * p[33] + f[40] * p[42] + f[41] * p[51]
+          + f[42] * p[60] + f[43] * p[69] + f[44] * p[78];
+    t[43] = f[36] * p[7] + f[37] * p[16] + f[38] * p[25] + f[39] * p[34] + f[40] * p[43] + f[41] * p[52]
+          + f[42] * p[61] + f[43] * p[70] + f[44] * p[79];
+    t[44] = f[36] * p[8] + f[37] * p[17] + f[38] * p[26] + f[39] * p[35] + f[40] * p[44] + f[41] * p[53]
+          + f[42] * p[62] + f[43] * p[71] + f[44] * p[80];
+    t[45] = f[45] * p[0] + f[46] * p[9] + f[47] * p[18] + f[48] * p[27] + f[49] * p[36] + f[50] * p[45]
+          + f[51] * p[54] + f[52] * p[63] + f[53] * p[72];
+    t[46] = f[45] * p[1] + f[46] * p[10] + f[47] * p[19] + f[48] * p[28] + f[49] * p[37] + f[50] * p[46]
+          + f[51] * p[55] + f[52] * p[64] + f[53] * p[73];
+    t[47] = f[45] * p[2] + f[46] * p[11] + f[47] * p[20] + f[48] * p[29] + f[49] * p[38] + f[50] * p[47]
+          + f[51] * p[56] + f[52] * p[65] + f[53] * p[74];
+    t[48] = f[45] * p[3] + f[46] * p[12] + f[47] * p[21] + f[48] * p[30] + f[49] * p[39] + f[50] * p[48]
+          + f[51] * p[57] + f[52] * p[66] + f[53] * p[75];
+    t[49] = f[45] * p[4] + f[46] * p[13] + f[47] * p[22] + f[48] * p[31] + f[49] * p[40] + f[50] * p[49]
+          + f[51] * p[58] + f[52] * p[67] + f[53] * p[76];
+    t[50] = f[45] * p[5] + f[46] * p[14] + f[47] * p[23] + f[48] * p[32] + f[49] * p[41] + f[50] * p[50]
+          + f[51] * p[59] + f[52] * p[68] + f[53] * p[77];
+    t[51] = f[45] * p[6] + f[46] * p[15] + f[47] * p[24] + f[48] * p[33] + f[49] * p[42] + f[50] * p[51]
+          + f[51] * p[60] + f[52] * p[69] + f[53] * p[78];
+    t[52] = f[45] * p[7] + f[46] * p[16] + f[47] * p[25] + f[48] * p[34] + f[49] * p[43] + f[50] * p[52]
+          + f[51] * p[61] + f[52] * p[70] + f[53] * p[79];
+    t[53] = f[45] * p[8] + f[46] * p[17] + f[47] * p[26] + f[48] * p[35] + f[49] * p[44] + f[50] * p[53]
+          + f[51] * p[62] + f[52] * p[71] + f[53] * p[80];
+    t[54] = f[54] * p[0] + f[55] * p[9] + f[56] * p[18] + f[57] * p[27] + f[58] * p[36] + f[59] * p[45]
+          + f[60] * p[54] + f[61] * p[63] + f[62] * p[72];
+    t[55] = f[54] * p[1] + f[55] * p[10] + f[56] * p[19] + f[57] * p[28] + f[58] * p[37] + f[59] * p[46]
+          + f[60] * p[55] + f[61] * p[64] + f[62] * p[73];
+    t[56] = f[54] * p[2] + f[55] * p[11] + f[56] * p[20] + f[57] * p[29] + f[58] * p[38] + f[59] * p[47]
+          + f[60] * p[56] + f[61] * p[65] + f[62] * p[74];
+    t[57] = f[54] * p[3] + f[55] * p[12] + f[56] * p[21] + f[57] * p[30] + f[58] * p[39] + f[59] * p[48]
+          + f[60] * p[57] + f[61] * p[66] + f[62] * p[75];
+    t[58] = f[54] * p[4] + f[55] * p[13] + f[56] * p[22] + f[57] * p[31] + f[58] * p[40] + f[59] * p[49]
+          + f[60] * p[58] + f[61] * p[67] + f[62] * p[76];
+    t[59] = f[54] * p[5] + f[55] * p[14] + f[56] * p[23] + f[57] * p[32] + f[58] * p[41] + f[59] * p[50]
+          + f[60] * p[59] + f[61] * p[68] + f[62] * p[77];
+    t[60] = f[54] * p[6] + f[55] * p[15] + f[56] * p[24] + f[57] * p[33] + f[58] * p[42] + f[59] * p[51]
+          + f[60] * p[60] + f[61] * p[69] + f[62] * p[78];
+    t[61] = f[54] * p[7] + f[55] * p[16] + f[56] * p[25] + f[57] * p[34] + f[58] * p[43] + f[59] * p[52]
+          + f[60] * p[61] + f[61] * p[70] + f[62] * p[79];
+    t[62] = f[54] * p[8] + f[55] * p[17] + f[56] * p[26] + f[57] * p[35] + f[58] * p[44] + f[59] * p[53]
+          + f[60] * p[62] + f[61] * p[71] + f[62] * p[80];
+    t[63] = f[63] * p[0] + f[64] * p[9] + f[65] * p[18] + f[66] * p[27] + f[67] * p[36] + f[68] * p[45]
+          + f[69] * p[54] + f[70] * p[63] + f[71] * p[72];
+    t[64] = f[63] * p[1] + f[64] * p[10] + f[65] * p[19] + f[66] * p[28] + f[67] * p[37] + f[68] * p[46]
+          + f[69] * p[55] + f[70] * p[64] + f[71] * p[73];
+    t[65] = f[63] * p[2] + f[64] * p[11] + f[65] * p[20] + f[66] * p[29] + f[67] * p[38] + f[68] * p[47]
+          + f[69] * p[56] + f[70] * p[65] + f[71] * p[74];
+    t[66] = f[63] * p[3] + f[64] * p[12] + f[65] * p[21] + f[66] * p[30] + f[67] * p[39] + f[68] * p[48]
+          + f[69] * p[57] + f[70] * p[66] + f[71] * p[75];
+    t[67] = f[63] * p[4] + f[64] * p[13] + f[65] * p[22] + f[66] * p[31] + f[67] * p[40] + f[68] * p[49]
+          + f[69] * p[58] + f[70] * p[67] + f[71] * p[76];
+    t[68] = f[63] * p[5] + f[64] * p[14] + f[65] * p[23] + f[66] * p[32] + f[67] * p[41] + f[68] * p[50]
+          + f[69] * p[59] + f[70] * p[68] + f[71] * p[77];
+    t[69] = f[63] * p[6] + f[64] * p[15] + f[65] * p[24] + f[66] * p[33] + f[67] * p[42] + f[68] * p[51]
+          + f[69] * p[60] + f[70] * p[69] + f[71] * p[78];
+    t[70] = f[63] * p[7] + f[64] * p[16] + f[65] * p[25] + f[66] * p[34] + f[67] * p[43] + f[68] * p[52]
+          + f[69] * p[61] + f[70] * p[70] + f[71] * p[79];
+    t[71] = f[63] * p[8] + f[64] * p[17] + f[65] * p[26] + f[66] * p[35] + f[67] * p[44] + f[68] * p[53]
+          + f[69] * p[62] + f[70] * p[71] + f[71] * p[80];
+    t[72] = f[72] * p[0] + f[73] * p[9] + f[74] * p[18] + f[75] * p[27] + f[76] * p[36] + f[77] * p[45]
+          + f[78] * p[54] + f[79] * p[63] + f[80] * p[72];
+    t[73] = f[72] * p[1] + f[73] * p[10] + f[74] * p[19] + f[75] * p[28] + f[76] * p[37] + f[77] * p[46]
+          + f[78] * p[55] + f[79] * p[64] + f[80] * p[73];
+    t[74] = f[72] * p[2] + f[73] * p[11] + f[74] * p[20] + f[75] * p[29] + f[76] * p[38] + f[77] * p[47]
+          + f[78] * p[56] + f[79] * p[65] + f[80] * p[74];
+    t[75] = f[72] * p[3] + f[73] * p[12] + f[74] * p[21] + f[75] * p[30] + f[76] * p[39] + f[77] * p[48]
+          + f[78] * p[57] + f[79] * p[66] + f[80] * p[75];
+    t[76] = f[72] * p[4] + f[73] * p[13] + f[74] * p[22] + f[75] * p[31] + f[76] * p[40] + f[77] * p[49]
+          + f[78] * p[58] + f[79] * p[67] + f[80] * p[76];
+    t[77] = f[72] * p[5] + f[73] * p[14] + f[74] * p[23] + f[75] * p[32] + f[76] * p[41] + f[77] * p[50]
+          + f[78] * p[59] + f[79] * p[68] + f[80] * p[77];
+    t[78] = f[72] * p[6] + f[73] * p[15] + f[74] * p[24] + f[75] * p[33] + f[76] * p[42] + f[77] * p[51]
+          + f[78] * p[60] + f[79] * p[69] + f[80] * p[78];
+    t[79] = f[72] * p[7] + f[73] * p[16] + f[74] * p[25] + f[75] * p[34] + f[76] * p[43] + f[77] * p[52]
+          + f[78] * p[61] + f[79] * p[70] + f[80] * p[79];
+    t[80] = f[72] * p[8] + f[73] * p[17] + f[74] * p[26] + f[75] * p[35] + f[76] * p[44] + f[77] * p[53]
+          + f[78] * p[62] + f[79] * p[71] + f[80] * p[80];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + t[3] * f[3] + t[4] * f[4] + t[5] * f[5] + t[6] * f[6]
+         + t[7] * f[7] + t[8] * f[8] + q[0];
+    p[1] = t[0] * f[9] + t[1] * f[10] + t[2] * f[11] + t[3] * f[12] + t[4] * f[13] + t[5] * f[14]
+         + t[6] * f[15] + t[7] * f[16] + t[8] * f[17] + q[1];
+    p[2] = t[0] * f[18] + t[1] * f[19] + t[2] * f[20] + t[3] * f[21] + t[4] * f[22] + t[5] * f[23]
+         + t[6] * f[24] + t[7] * f[25] + t[8] * f[26] + q[2];
+    p[3] = t[0] * f[27] + t[1] * f[28] + t[2] * f[29] + t[3] * f[30] + t[4] * f[31] + t[5] * f[32]
+         + t[6] * f[33] + t[7] * f[34] + t[8] * f[35] + q[3];
+    p[4] = t[0] * f[36] + t[1] * f[37] + t[2] * f[38] + t[3] * f[39] + t[4] * f[40] + t[5] * f[41]
+         + t[6] * f[42] + t[7] * f[43] + t[8] * f[44] + q[4];
+    p[5] = t[0] * f[45] + t[1] * f[46] + t[2] * f[47] + t[3] * f[48] + t[4] * f[49] + t[5] * f[50]
+         + t[6] * f[51] + t[7] * f[52] + t[8] * f[53] + q[5];
+    p[6] = t[0] * f[54] + t[1] * f[55] + t[2] * f[56] + t[3] * f[57] + t[4] * f[58] + t[5] * f[59]
+         + t[6] * f[60] + t[7] * f[61] + t[8] * f[62] + q[6];
+    p[7] = t[0] * f[63] + t[1] * f[64] + t[2] * f[65] + t[3] * f[66] + t[4] * f[67] + t[5] * f[68]
+         + t[6] * f[69] + t[7] * f[70] + t[8] * f[71] + q[7];
+    p[8] = t[0] * f[72] + t[1] * f[73] + t[2] * f[74] + t[3] * f[75] + t[4] * f[76] + t[5] * f[77]
+         + t[6] * f[78] + t[7] * f[79] + t[8] * f[80] + q[8];
+    p[10] = t[9] * f[9] + t[10] * f[10] + t[11] * f[11] + t[12] * f[12] + t[13] * f[13] + t[14] * f[14]
+          + t[15] * f[15] + t[16] * f[16] + t[17] * f[17] + q[10];
+    p[11] = t[9] * f[18] + t[10] * f[19] + t[11] * f[20] + t[12] * f[21] + t[13] * f[22] + t[14] * f[23]
+          + t[15] * f[24] + t[16] * f[25] + t[17] * f[26] + q[11];
+    p[12] = t[9] * f[27] + t[10] * f[28] + t[11] * f[29] + t[12] * f[30] + t[13] * f[31] + t[14] * f[32]
+          + t[15] * f[33] + t[16] * f[34] + t[17] * f[35] + q[12];
+    p[13] = t[9] * f[36] + t[10] * f[37] + t[11] * f[38] + t[12] * f[39] + t[13] * f[40] + t[14] * f[41]
+          + t[15] * f[42] + t[16] * f[43] + t[17] * f[44] + q[13];
+    p[14] = t[9] * f[45] + t[10] * f[46] + t[11] * f[47] + t[12] * f[48] + t[13] * f[49] + t[14] * f[50]
+          + t[15] * f[51] + t[16] * f[52] + t[17] * f[53] + q[14];
+    p[15] = t[9] * f[54] + t[10] * f[55] + t[11] * f[56] + t[12] * f[57] + t[13] * f[58] + t[14] * f[59]
+          + t[15] * f[60] + t[16] * f[61] + t[17] * f[62] + q[15];
+    p[16] = t[9] * f[63] + t[10] * f[64] + t[11] * f[65] + t[12] * f[66] + t[13] * f[67] + t[14] * f[68]
+          + t[15] * f[69] + t[16] * f[70] + t[17] * f[71] + q[16];
+    p[17] = t[9] * f[72] + t[10] * f[73] + t[11] * f[74] + t[12] * f[75] + t[13] * f[76] + t[14] * f[77]
+          + t[15] * f[78] + t[16] * f[79] + t[17] * f[80] + q[17];
+    p[20] = t[18] * f[18] + t[19] * f[19] + t[20] * f[20] + t[21] * f[21] + t[22] * f[22] + t[23] * f[23]
+          + t[24] * f[24] + t[25] * f[25] + t[26] * f[26] + q[20];
+    p[21] = t[18] * f[27] + t[19] * f[28] + t[20] * f[29] + t[21] * f[30] + t[22] * f[31] + t[23] * f[32]
+          + t[24] * f[33] + t[25] * f[34] + t[26] * f[35] + q[21];
+    p[22] = t[18] * f[36] + t[19] * f[37] + t[20] * f[38] + t[21] * f[39] + t[22] * f[40] + t[23] * f[41]
+          + t[24] * f[42] + t[25] * f[43] + t[26] * f[44] + q[22];
+    p[23] = t[18] * f[45] + t[19] * f[46] + t[20] * f[47] + t[21] * f[48] + t[22] * f[49] + t[23] * f[50]
+          + t[24] * f[51] + t[25] * f[52] + t[26] * f[53] + q[23];
+    p[24] = t[18] * f[54] + t[19] * f[55] + t[20] * f[56] + t[21] * f[57] + t[22] * f[58] + t[23] * f[59]
+          + t[24] * f[60] + t[25] * f[61] + t[26] * f[62] + q[24];
+    p[25] = t[18] * f[63] + t[19] * f[64] + t[20] * f[65] + t[21] * f[66] + t[22] * f[67] + t[23] * f[68]
+          + t[24] * f[69] + t[25] * f[70] + t[26] * f[71] + q[25];
+    p[26] = t[18] * f[72] + t[19] * f[73] + t[20] * f[74] + t[21] * f[75] + t[22] * f[76] + t[23] * f[77]
+          + t[24] * f[78] + t[25] * f[79] + t[26] * f[80] + q[26];
+    p[30] = t[27] * f[27] + t[28] * f[28] + t[29] * f[29] + t[30] * f[30] + t[31] * f[31] + t[32] * f[32]
+          + t[33] * f[33] + t[34] * f[34] + t[35] * f[35] + q[30];
+    p[31] = t[27] * f[36] + t[28] * f[37] + t[29] * f[38] + t[30] * f[39] + t[31] * f[40] + t[32] * f[41]
+          + t[33] * f[42] + t[34] * f[43] + t[35] * f[44] + q[31];
+    p[32] = t[27] * f[45] + t[28] * f[46] + t[29] * f[47] + t[30] * f[48] + t[31] * f[49] + t[32] * f[50]
+          + t[33] * f[51] + t[34] * f[52] + t[35] * f[53] + q[32];
+    p[33] = t[27] * f[54] + t[28] * f[55] + t[29] * f[56] + t[30] * f[57] + t[31] * f[58] + t[32] * f[59]
+          + t[33] * f[60] + t[34] * f[61] + t[35] * f[62] + q[33];
+    p[34] = t[27] * f[63] + t[28] * f[64] + t[29] * f[65] + t[30] * f[66] + t[31] * f[67] + t[32] * f[68]
+          + t[33] * f[69] + t[34] * f[70] + t[35] * f[71] + q[34];
+    p[35] = t[27] * f[72] + t[28] * f[73] + t[29] * f[74] + t[30] * f[75] + t[31] * f[76] + t[32] * f[77]
+          + t[33] * f[78] + t[34] * f[79] + t[35] * f[80] + q[35];
+    p[40] = t[36] * f[36] + t[37] * f[37] + t[38] * f[38] + t[39] * f[39] + t[40] * f[40] + t[41] * f[41]
+          + t[42] * f[42] + t[43] * f[43] + t[44] * f[44] + q[40];
+    p[41] = t[36] * f[45] + t[37] * f[46] + t[38] * f[47] + t[39] * f[48] + t[40] * f[49] + t[41] * f[50]
+          + t[42] * f[51] + t[43] * f[52] + t[44] * f[53] + q[41];
+    p[42] = t[36] * f[54] + t[37] * f[55] + t[38] * f[56] + t[39] * f[57] + t[40] * f[58] + t[41] * f[59]
+          + t[42] * f[60] + t[43] * f[61] + t[44] * f[62] + q[42];
+    p[43] = t[36] * f[63] + t[37] * f[64] + t[38] * f[65] + t[39] * f[66] + t[40] * f[67] + t[41] * f[68]
+          + t[42] * f[69] + t[43] * f[70] + t[44] * f[71] + q[43];
+    p[44] = t[36] * f[72] + t[37] * f[73] + t[38] * f[74] + t[39] * f[75] + t[40] * f[76] + t[41] * f[77]
+          + t[42] * f[78] + t[43] * f[79] + t[44] * f[80] + q[44];
+    p[50] = t[45] * f[45] + t[46] * f[46] + t[47] * f[47] + t[48] * f[48] + t[49] * f[49] + t[50] * f[50]
+          + t[51] * f[51] + t[52] * f[52] + t[53] * f[53] + q[50];
+    p[51] = t[45] * f[54] + t[46] * f[55] + t[47] * f[56] + t[48] * f[57] + t[49] * f[58] + t[50] * f[59]
+          + t[51] * f[60] + t[52] * f[61] + t[53] * f[62] + q[51];
+    p[52] = t[45] * f[63] + t[46] * f[64] + t[47] * f[65] + t[48] * f[66] + t[49] * f[67] + t[50] * f[68]
+          + t[51] * f[69] + t[52] * f[70] + t[53] * f[71] + q[52];
+    p[53] = t[45] * f[72] + t[46] * f[73] + t[47] * f[74] + t[48] * f[75] + t[49] * f[76] + t[50] * f[77]
+          + t[51] * f[78] + t[52] * f[79] + t[53] * f[80] + q[53];
+    p[60] = t[54] * f[54] + t[55] * f[55] + t[56] * f[56] + t[57] * f[57] + t[58] * f[58] + t[59] * f[59]
+          + t[60] * f[60] + t[61] * f[61] + t[62] * f[62] + q[60];
+    p[61] = t[54] * f[63] + t[55] * f[64] + t[56] * f[65] + t[57] * f[66] + t[58] * f[67] + t[59] * f[68]
+          + t[60] * f[69] + t[61] * f[70] + t[62] * f[71] + q[61];
+    p[62] = t[54] * f[72] + t[55] * f[73] + t[56] * f[74] + t[57] * f[75] + t[58] * f[76] + t[59] * f[77]
+          + t[60] * f[78] + t[61] * f[79] + t[62] * f[80] + q[62];
+    p[70] = t[63] * f[63] + t[64] * f[64] + t[65] * f[65] + t[66] * f[66] + t[67] * f[67] + t[68] * f[68]
+          + t[69] * f[69] + t[70] * f[70] + t[71] * f[71] + q[70];
+    p[71] = t[63] * f[72] + t[64] * f[73] + t[65] * f[74] + t[66] * f[75] + t[67] * f[76] + t[68] * f[77]
+          + t[69] * f[78] + t[70] * f[79] + t[71] * f[80] + q[71];
+    p[80] = t[72] * f[72] + t[73] * f[73] + t[74] * f[74] + t[75] * f[75] + t[76] * f[76] + t[77] * f[77]
+          + t[78] * f[78] + t[79] * f[79] + t[80] * f[80] + q[80];
+
+    p[9] = p[1];
+    p[18] = p[2];
+    p[27] = p[3];
+    p[36] = p[4];
+    p[45] = p[5];
+    p[54] = p[6];
+    p[63] = p[7];
+    p[72] = p[8];
+    p[19] = p[11];
+    p[28] = p[12];
+    p[37] = p[13];
+    p[46] = p[14];
+    p[55] = p[15];
+    p[64] = p[16];
+    p[73] = p[17];
+    p[29] = p[21];
+    p[38] = p[22];
+    p[47] = p[23];
+    p[56] = p[24];
+    p[65] = p[25];
+    p[74] = p[26];
+    p[39] = p[31];
+    p[48] = p[32];
+    p[57] = p[33];
+    p[66] = p[34];
+    p[75] = p[35];
+    p[49] = p[41];
+    p[58] = p[42];
+    p[67] = p[43];
+    p[76] = p[44];
+    p[59] = p[51];
+    p[68] = p[52];
+    p[77] = p[53];
+    p[69] = p[61];
+    p[78] = p[62];
+    p[79] = p[71];
+}
+
+
+void Ifx_KalmanF32_predict12(float32 *p, const float32 *f, const float32 *q)
+{
+    float32 t[144];
+
+    t[0] = f[0] * p[0] + f[1] * p[12] + f[2] * p[24] + f[3] * p[36] + f[4] * p[48] + f[5] * p[60]
+         + f[6] * p[72] + f[7] * p[84] + f[8] * p[96] + f[9] * p[108] + f[10] * p[120] + f[11] * p[132];
+    t[1] = f[0] * p[1] + f[1] * p[13] + f[2] * p[25] + f[3] * p[37] + f[4] * p[49] + f[5] * p[61]
+         + f[6] * p[73] + f[7] * p[85] + f[8] * p[97] + f[9] * p[109] + f[10] * p[121] + f[11] * p[133];
+    t[2] = f[0] * p[2] + f[1] * p[14] + f[2] * p[26] + f[3] * p[38] + f[4] * p[50] + f[5] * p[62]
+         + f[6] * p[74] + f[7] * p[86] + f[8] * p[98] + f[9] * p[110] + f[10] * p[122] + f[11] * p[134];
+    t[3] = f[0] * p[3] + f[1] * p[15] + f[2] * p[27] + f[3] * p[39] + f[4] * p[51] + f[5] * p[63]
+         + f[6] * p[75] + f[7] * p[87] + f[8] * p[99] + f[9] * p[111] + f[10] * p[123] + f[11] * p[135];
+    t[4] = f[0] * p[4] + f[1] * p[16] + f[2] * p[28] + f[3] * p[40] + f[4] * p[52] + f[5] * p[64]
+         + f[6] * p[76] + f[7] * p[88] + f[8] * p[100] + f[9] * p[112] + f[10] * p[124] + f[11] * p[136];
+    t[5] = f[0] * p[5] + f[1] * p[17] + f[2] * p[29] + f[3] * p[41] + f[4] * p[53] + f[5] * p[65]
+         + f[6] * p[77] + f[7] * p[89] + f[8] * p[101] + f[9] * p[113] + f[10] * p[125] + f[11] * p[137];
+    t[6] = f[0] * p[6] + f[1] * p[18] + f[2] * p[30] + f[3] * p[42] + f[4] * p[54] + f[5] * p[66]
+         + f[6] * p[78] + f[7] * p[90] + f[8] * p[102] + f[9] * p[114] + f[10] * p[126] + f[11] * p[138];
+    t[7] = f[0] * p[7] + f[1] * p[19] + f[2] * p[31] + f[3] * p[43] + f[4] * p[55] + f[5] * p[67]
+         + f[6] * p[79] + f[7] * p[91] + f[8] * p[103] + f[9] * p[115] + f[10] * p[127] + f[11] * p[139];
+    t[8] = f[0] * p[8] + f[1] * p[20] + f[2] * p[32] + f[3] * p[44] + f[4] * p[56] + f[5] * p[68]
+         + f[6] * p[80] + f[7] * p[92] + f[8] * p[104] + f[9] * p[116] + f[10] * p[128] + f[11] * p[140];
+    t[9] = f[0] * p[9] + f[1] * p[21] + f[2] * p[33] + f[3] * p[45] + f[4] * p[57] + f[5] * p[69]
+         + f[6] * p[81] + f[7] * p[93] + f[8] * p[105] + f[9] * p[117] + f[10] * p[129] + f[11] * p[141];
+    t[10] = f[0] * p[10] + f[1] * p[22] + f[2] * p[34] + f[3] * p[46] + f[4] * p[58] + f[5] * p[70]
+          + f[6] * p[82] + f[7] * p[94] + f[8] * p[106] + f[9] * p[118] + f[10] * p[130] + f[11] * p[142];
+    t[11] = f[0] * p[11] + f[1] * p[23] + f[2] * p[35] + f[3] * p[47] + f[4] * p[59] + f[5] * p[71]
+          + f[6] * p[83] + f[7] * p[95] + f[8] * p[107] + f[9] * p[119] + f[10] * p[131] + f[11] * p[143];
+    t[12] = f[12] * p[0] + f[13] * p[12] + f[14] * p[24] + f[15] * p[36] + f[16] * p[48] + f[17] * p[60]
+          + f[18] * p[72] + f[19] * p[84] + f[20] * p[96] + f[21] * p[108] + f[22] * p[120] + f[23] * p[132];
+    t[13] = f[12] * p[1] + f[13] * p[13] + f[14] * p[25] + f[15] * p[37] + f[16] * p[49] + f[17] * p[61]
+          + f[18] * p[73] + f[19] * p[85] + f[20] * p[97] + f[21] * p[109] + f[22] * p[121] + f[23] * p[133];
+    t[14] = f[12] * p[2] + f[13] * p[14] + f[14] * p[26] + f[15] * p[38] + f[16] * p[50] + f[17] * p[62]
+          + f[18] * p[74] + f[19] * p[86] + f[20] * p[98] + f[21] * p[110] + f[22] * p[122] + f[23] * p[134];
+    t[15] = f[12] * p[3] + f[13] * p[15] + f[14] * p[27] + f[15] * p[39] + f[16] * p[51] + f[17] * p[63]
+          + f[18] * p[75] + f[19] * p[87] + f[20] * p[99] + f[21] * p[111] + f[22] * p[123] + f[23] * p[135];
+    t[16] = f[12] * p[4] + f[13] * p[16] + f[14] * p[28] + f[15] * p[40] + f[16] * p[52] + f[17] * p[64]
+          + f[18] * p[76] + f[19] * p[88] + f[20] * p[100] + f[21] * p[112] + f[22] * p[124] + f[23] * p[136];
+    t[17] = f[12] * p[5] + f[13] * p[17] + f[14] * p[29] + f[15] * p[41] + f[16] * p[53] + f[17] * p[65]
+          + f[18] * p[77] + f[19] * p[89] + f[20] * p[101] + f[21] * p[113] + f[22] * p[125] + f[23] * p[137];
+    t[18] = f[12] * p[6] + f[13] * p[18] + f[14] * p[30] + f[15] * p[42] + f[16] * p[54] + f[17] * p[66]
+          + f[18] * p[78] + f[19] * p[90] + f[20] * p[102] + f[21] * p[114] + f[22] * p[126] + f[23] * p[138];
+    t[19] = f[12] * p[7] + f[13] * p[19] + f[14] * p[31] + f[15] * p[43] + f[16] * p[55] + f[17] * p[67]
+          + f[18] * p[79] + f[19] * p[91] + f[20] * p[103] + f[21] * p[115] + f[22] * p[127] + f[23] * p[139];
+    t[20] = f[12] * p[8] + f[13] * p[20] + f[14] * p[32] + f[15] * p[44] + f[16] * p[56] + f[17] * p[68]
+          + f[18] * p[80] + f[19] * p[92] + f[20] * p[104] + f[21] * p[116] + f[22] * p[128] + f[23] * p[140];
+    t[21] = f[12] * p[9] + f[13] * p[21] + f[14] * p[33] + f[15] * p[45] + f[16] * p[57] + f[17] * p[69]
+          + f[18] * p[81] + f[19] * p[93] + f[20] * p[105] + f[21] * p[117] + f[22] * p[129] + f[23] * p[141];
+    t[22] = f[12] * p[10] + f[13] * p[22] + f[14] * p[34] + f[15] * p[46] + f[16] * p[58] + f[17] * p[70]
+          + f[18] * p[82] + f[19] * p[94] + f[20] * p[106] + f[21] * p[118] + f[22] * p[130] + f[23] * p[142];
+    t[23] = f[12] * p[11] + f[13] * p[23] + f[14] * p[35] + f[15] * p[47] + f[16] * p[59] + f[17] * p[71]
+          + f[18] * p[83] + f[19] * p[95] + f[20] * p[107] + f[21] * p[119] + f[22] * p[131] + f[23] * p[143];
+    t[24] = f[24] * p[0] + f[25] * p[12] + f[26] * p[24] + f[27] * p[36] + f[28] * p[48] + f[29] * p[60]
+          + f[30] * p[72] + f[31] * p[84] + f[32] * p[96] + f[33] * p[108] + f[34] * p[120] + f[35] * p[132];
+    t[25] = f[24] * p[1] + f[25] * p[13] + f[26] * p[25] + f[27] * p[37] + f[28] * p[49] + f[29] * p[61]
+          + f[30] * p[73] + f[31] * p[85] + f[32] * p[97] + f[33] * p[109] + f[34] * p[121] + f[35] * p[133];
+    t[26] = f[24] * p[2] + f[25] * p[14] + f[26] * p[26] + f[27] * p[38] + f[28] * p[50] + f[29] * p[62]
+          + f[30] * p[74] + f[31] * p[86] + f[32] * p[98] + f[33] * p[110] + f[34] * p[122] + f[35] * p[134];
+    t[27] = f[24] * p[3] + f[25] * p[15] + f[26] * p[27] + f[27] * p[39] + f[28] * p[51] + f[29] * p[63]
+          + f[30] * p[75] + f[31] * p[87] + f[32] * p[99] + f[33] * p[111] + f[34] * p[123] + f[35] * p[135];
+    t[28] = f[24] * p[4] + f[25] * p[16] + f[26] * p[28] + f[27] * p[40] + f[28] * p[52] + f[29] * p[64]
+          + f[30] * p[76] + f[31] * p[88] + f[32] * p[100] + f[33] * p[112] + f[34] * p[124] + f[35] * p[136];
+    t[29] = f[24] * p[5] + f[25] * p[17] + f[26] * p[29] + f[27] * p[41] + f[28] * p[53] + f[29] * p[65]
+          + f[30] * p[77] + f[31] * p[89] + f[32] * p[101] + f[33] * p[113] + f[34] * p[125] + f[35] * p[137];
+    t[30] = f[24] * p[6] + f[25] * p[18] + f[26] * p[30] + f[27] * p[42] + f[28] * p[54] + f[29] * p[66]
+          + f[30] * p[78] + f[31] * p[90] + f[32] * p[102] + f[33] * p[114] + f[34] * p[126] + f[35] * p[138];
+    t[31] = f[24] * p[7] + f[25] * p[19] + f[26] * p[31] + f[27] * p[43] + f[28] * p[55] + f[29] * p[67]
+          + f[30] * p[79] + f[31] * p[91] + f[32] * p[103] + f[33] * p[115] + f[34] * p[127] + f[35] * p[139];
+    t[32] = f[24] * p[8] + f[25] * p[20] + f[26] * p[32] + f[27] * p[44] + f[28] * p[56] + f[29] * p[68]
+          + f[30] * p[80] + f[31] * p[92] + f[32] * p[104] + f[33] * p[116] + f[34] * p[128] + f[35] * p[140];
+    t[33] = f[24] * p[9] + f[25] * p[21] + f[26] * p[33] + f[27] * p[45] + f[28] * p[57] + f[29] * p[69]
+          + f[30] * p[81] + f[31] * p[93] + f[32] * p[105] + f[33] * p[117] + f[34] * p[129] + f[35] * p[141];
+    t[34] = f[24] * p[10] + f[25] * p[22] + f[26] * p[34] + f[27] * p[46] + f[28] * p[58] + f[29] * p[70]
+          + f[30] * p[82] + f[31] * p[94] + f[32] * p[106] + f[33] * p[118] + f[34] * p[130] + f[35] * p[142];
+    t[35] = f[24] * p[11] + f[25] * p[23] + f[26] * p[35] + f[27] * p[47] + f[28] * p[59] + f[29] * p[71]
+          + f[30] * p[83] + f[31] * p[95] + f[32] * p[107] + f[33] * p[119] + f[34] * p[131] + f[35] * p[143];
+    t[36] = f[36] * p[0] + f[37] * p[12] + f[38] * p[24] + f[39] * p[36] + f[40] * p[48] + f[41] * p[60]
+          + f[42] * p[72] + f[43] * p[84] + f[44] * p[96] + f[45] * p[108] + f[46] * p[120] + f[47] * p[132];
+    t[37] = f[36] * p[1] + f[37] * p[13] + f[38] * p[25] + f[39] * p[37] + f[40] * p[49] + f[41] * p[61]
+          + f[42] * p[73] + f[43] * p[85] + f[44] * p[97] + f[45] * p[109] + f[46] * p[121] + f[47] * p[133];
+    t[38] = f[36] * p[2] + f[37] * p[14] + f[38] * p[26] + f[39] * p[38] + f[40] * p[50] + f[41] * p[62]
+          + f[42] * p[74] + f[43] * p[86] + f[44] * p[98] + f[45] * p[110] + f[46] * p[122] + f[47] * p[134];
+    t[39] = f[36] * p[3] + f[37] * p[15] + f[38] * p[27] + f[39] * p[39] + f[40] * p[51] + f[41] * p[63]
+          + f[42] * p[75] + f[43] * p[87] + f[44] * p[99] + f[45] * p[111] + f[46] * p[123] + f[47] * p[135];
+    t[40] = f[36] * p[4] + f[37] * p[16] + f[38] * p[28] + f[39] * p[40] + f[40] * p[52] + f[41] * p[64]
+          + f[42] * p[76] + f[43] * p[88] + f[44] * p[100] + f[45] * p[112] + f[46] * p[124] + f[47] * p[136];
+    t[41] = f[36] * p[5] + f[37] * p[17] + f[38] * p[29] + f[39] * p[41] + f[40] * p[53] + f[41] * p[65]
+          + f[42] * p[77] + f[43] * p[89] + f[44] * p[101] + f[45] * p[113] + f[46] * p[125] + f[47] * p[137];
+    t[42] = f[36] * p[6] + f[37] * p[18] + f[38] * p[30] + f[39] * p[42] + f[40] * p[54] + f[41] * p[66]
+          + f[42] * p[78] + f[43] * p[90] + f[44] * p[102] + f[45] * p[114] + f[46] * p[126] + f[47] * p[138];
+    t[43] = f[36] * p[7] + f[37] * p[19] + f[38] * p[31] + f[39] * p[43] + f[40] * p[55] + f[41] * p[67]
+          + f[42] * p[79] + f[43] * p[91] + f[44] * p[103] + f[45] * p[115] + f[46] * p[127] + f[47] * p[139];
+    t[44] = f[36] * p[8] + f[37] * p[20] + f[38] * p[32] + f[39] * p[44] + f[40] * p[56] + f[41] * p[68]
+          + f[42] * p[80] + f[43] * p[92] + f[44] * p[104] + f[45] * p[116] + f[46] * p[128] + f[47] * p[140];
+    t[45] = f[36] * p[9] + f[37] * p[21] + f[38] * p[33] + f[39] * p[45] + f[40] * p[57] + f[41] * p[69]
+          + f[42] * p[81] + f[43] * p[93] + f[44] * p[105] + f[45] * p[117] + f[46] * p[129] + f[47] * p[141];
+    t[46] = f[36] * p[10] + f[37] * p[22] + f[38] * p[34] + f[39] * p[46] + f[40] * p[58] + f[41] * p[70]
+          + f[42] * p[82] + f[43] * p[94] + f[44] * p[106] + f[45] * p[118] + f[46] * p[130] + f[47] * p[142];
+    t[47] = f[36] * p[11] + f[37] * p[23] + f[38] * p[35] + f[39] * p[47] + f[40] * p[59] + f[41] * p[71]
+          + f[42] * p[83] + f[43] * p[95] + f[44] * p[107] + f[45] * p[119] + f[46] * p[131] + f[47] * p[143];
+    t[48] = f[48] * p[0] + f[49] * p[12] + f[50] * p[24] + f[51] * p[36] + f[52] * p[48] + f[53] * p[60]
+          + f[54] * p[72] + f[55] * p[84] + f[56] * p[96] + f[57] * p[108] + f[58] * p[120] + f[59] * p[132];
+    t[49] = f[48] * p[1] + f[49] * p[13] + f[50] * p[25] + f[51] * p[37] + f[52] * p[49] + f[53] * p[61]
+          + f[54] * p[73] + f[55] * p[85] + f[56] * p[97] + f[57] * p[109] + f[58] * p[121] + f[59] * p[133];
+    t[50] = f[48] * p[2] + f[49] * p[14] + f[50] * p[26] + f[51] * p[38] + f[52] * p[50] + f[53] * p[62]
+          + f[54] * p[74] + f[55] * p[86] + f[56] * p[98] + f[57] * p[110] + f[58] * p[122] + f[59] * p[134];
+    t[51] = f[48] * p[3] + f[49] * p[15] + f[50] * p[27] + f[51] * p[39] + f[52] * p[51] + f[53] * p[63]
+          + f[54] * p[75] + f[55] * p[87] + f[56] * p[99] + f[57] * p[111] + f[58] * p[123] + f[59] * p[135];
+    t[52] = f[48] * p[4] + f[49] * p[16] + f[50] * p[28] + f[51] * p[40] + f[52] * p[52] + f[53] * p[64]
+          + f[54] * p[76] + f[55] * p[88] + f[56] * p[100] + f[57] * p[112] + f[58] * p[124] + f[59] * p[136];
+    t[53] = f[48] * p[5] + f[49] * p[17] + f[50] * p[29] + f[51] * p[41] + f[52] * p[53] + f[53] * p[65]
+          + f[54] * p[77] + f[55] * p[89] + f[56] * p[101] + f[57] * p[113] + f[58] * p[125] + f[59] * p[137];
+    t[54] = f[48] * p[6] + f[49] * p[18] + f[50] * p[30] + f[51] * p[42] + f[52] * p[54] + f[53] * p[66]
+          + f[54] * p[78] + f[55] * p[90] + f[56] * p[102] + f[57] * p[114] + f[58] * p[126] + f[59] * p[138];
+    t[55] = f[48] * p[7] + f[49] * p[19] + f[50] * p[31] + f[51] * p[43] + f[52] * p[55] + f[53] * p[67]
+          + f[54] * p[79] + f[55] * p[91] + f[56] * p[103] + f[57] * p[115] + f[58] * p[127] + f[59] * p[139];
+    t[56] = f[48] * p[8] + f[49] * p[20] + f[50] * p[32] + f[51] * p[44] + f[52] * p[56] + f[53] * p[68]
+          + f[54] * p[80] + f[55] * p[92] + f[56] * p[104] + f[57] * p[116] + f[58] * p[128] + f[59] * p[140];
+    t[57] = f[48] * p[9] + f[49] * p[21] + f[50] * p[33] + f[51] * p[45] + f[52] * p[57] + f[53] * p[69]
+          + f[54] * p[81] + f[55] * p[93] + f[56] * p[105] + f[57] * p[117] + f[58] * p[129] + f[59] * p[141];
+    t[58] = f[48] * p[10] + f[49] * p[22] + f[50] * p[34] + f[51] * p[46] + f[52] * p[58] + f[53] * p[70]
+          + f[54] * p[82] + f[55] * p[94] + f[56] * p[106] + f[57] * p[118] + f[58] * p[130] + f[59] * p[142];
+    t[59] = f[48] * p[11] + f[49] * p[23] + f[50] * p[35] + f[51] * p[47] + f[52] * p[59] + f[53] * p[71]
+          + f[54] * p[83] + f[55] * p[95] + f[56] * p[107] + f[57] * p[119] + f[58] * p[131] + f[59] * p[143];
+    t[60] = f[60] * p[0] + f[61] * p[12] + f[62] * p[24] + f[63] * p[36] + f[64] * p[48] + f[65] * p[60]
+          + f[66] * p[72] + f[67] * p[84] + f[68] * p[96] + f[69] * p[108] + f[70] * p[120] + f[71] * p[132];
+    t[61] = f[60] * p[1] + f[61] * p[13] + f[62] * p[25] + f[63] * p[37] + f[64] * p[49] + f[65] * p[61]
+          + f[66] * p[73] + f[67] * p[85] + f[68] * p[97] + f[69] * p[109] + f[70] * p[121] + f[71] * p[133];
+    t[62] = f[60] * p[2] + f[61] * p[14] + f[62] * p[26] + f[63] * p[38] + f[64] * p[50] + f[65] * p[62]
+          + f[66] * p[74] + f[67] * p[86] + f[68] * p[98] + f[69] * p[110] + f[70] * p[122] + f[71] * p[134];
+    t[63] = f[60] * p[3] + f[61] * p[15] + f[62] * p[27] + f[63] * p[39] + f[64] * p[51] + f[65] * p[63]
+          + f[66] * p[75] + f[67] * p[87] + f[68] * p[99] + f[69] * p[111] + f[70] * p[123] + f[71] * p[135];
+    t[64] = f[60] * p[4] + f[61] * p[16] + f[62] * p[28] + f[63] * p[40] + f[64] * p[52] + f[65] * p[64]
+          + f[66] * p[76] + f[67] * p[88] + f[68] * p[100] + f[69] * p[112] + f[70] * p[124] + f[71] * p[136];
+    t[65] = f[60] * p[5] + f[61] * p[17] + f[62] * p[29] + f[63] * p[41] + f[64] * p[53] + f[65] * p[65]
+          + f[66] * p[77] + f[67] * p[89] + f[68] * p[101] + f[69] * p[113] + f[70] * p[125] + f[71] * p[137];
+    t[66] = f[60] * p[6] + f[61] * p[18] + f[62] * p[30] + f[63] * p[42] + f[64] * p[54] + f[65] * p[66]
+          + f[66] * p[78] + f[67] * p[90] + f[68] * p[102] + f[69] * p[114] + f[70] * p[126] + f[71] * p[138];
+    t[67] = f[60] * p[7] + f[61] * p[19] + f[62] * p[31] + f[63] * p[43] + f[64] * p[55] + f[65] * p[67]
+          + f[66] * p[79] + f[67] * p[91] + f[68] * p[103] + f[69] * p[115] + f[70] * p[127] + f[71] * p[139];
+    t[68] = f[60] * p[8] + f[61] * p[20] + f[62] * p[32] + f[63] * p[44] + f[64] * p[56] + f[65] * p[68]
+          + f[66] * p[80] + f[67] * p[92] + f[68] * p[104] + f[69] * p[116] + f[70] * p[128] + f[71] * p[140];
+    t[69] = f[60] * p[9] + f[61] * p[21] + f[62] * p[33] + f[63] * p[45] + f[64] * p[57] + f[65] * p[69]
+          + f[66] * p[81] + f[67] * p[93] + f[68] * p[105] + f[69] * p[117] + f[70] * p[129] + f[71] * p[141];
+    t[70] = f[60] * p[10] + f[61] * p[22] + f[62] * p[34] + f[63] * p[46] + f[64] * p[58] + f[65] * p[70]
+          + f[66] * p[82] + f[67] * p[94] + f[68] * p[106] + f[69] * p[118] + f[70] * p[130] + f[71] * p[142];
+    t[71] = f[60] * p[11] + f[61] * p[23] + f[62] * p[35] + f[63] * p[47] + f[64] * p[59] + f[65] * p[71]
+          + f[66] * p[83] + f[67] * p[95] + f[68] * p[107] + f[69] * p[119] + f[70] * p[131] + f[71] * p[143];
+    t[72] = f[72] * p[0] + f[73] * p[12] + f[74] * p[24] + f[75] * p[36] + f[76] * p[48] + f[77] * p[60]
+          + f[78] * p[72] + f[79] * p[84] + f[80] * p[96] + f[81] * p[108] + f[82] * p[120] + f[83] * p[132];
+    t[73] = f[72] * p[1] + f[73] * p[13] + f[74] * p[25] + f[75] * p[37] + f[76] * p[49] + f[77] * p[61]
+          + f[78] * p[73] + f[79] * p[85] + f[80] * p[97] + f[81] * p[109] + f[82] * p[121] + f[83] * p[133];
+    t[74] = f[72] * p[2] + f[73] * p[14] + f[74] * p[26] + f[75] * p[38] + f[76] * p[50] + f[77] * p[62]
+          + f[78] * p[74] + f[79] * p[86] + f[80] * p[98] + f[81] * p[110] + f[82] * p[122] + f[83] * p[134];
+    t[75] = f[72] * p[3] + f[73] * p[15] + f[74] * p[27] + f[75] * p[39] + f[76] * p[51] + f[77] * p[63]
+          + f[78] * p[75] + f[79] * p[87] + f[80] * p[99] + f[81] * p[111] + f[82] * p[123] + f[83] * p[135];
+    t[76] = f[72] * p[4] + f[73] * p[16] + f[74] * p[28] + f[75] * p[40] + f[76] * p[52] + f[77] * p[64]
+          + f[78] * p[76] + f[79] * p[88] + f[80] * p[100] + f[81] * p[112] + f[82] * p[124] + f[83] * p[136];
+    t[77] = f[72] * p[5] + f[73] * p[17] + f[74] * p[29] + f[75] * p[41] + f[76] * p[53] + f[77] * p[65]
+          + f[78] * p[77] + f[79] * p[89] + f[80] * p[101] + f[81] * p[113] + f[82] * p[125] + f[83] * p[137];
+    t[78] = f[72] * p[6] + f[73] * p[18] + f[74] * p[30] + f[75] * p[42] + f[76] * p[54] + f[77] * p[66]
+          + f[78] * p[78] + f[79] * p[90] + f[80] * p[102] + f[81] * p[114] + f[82] * p[126] + f[83] * p[138];
+    t[79] = f[72] * p[7] + f[73] * p[19] + f[74] * p[31] + f[75] * p[43] + f[76] * p[55] + f[77] * p[67]
+          + f[78] * p[79] + f[79] * p[91] + f[80] * p[103] + f[81] * p[115] + f[82] * p[127] + f[83] * p[139];
+    t[80] = f[72] * p[8] + f[73] * p[20] + f[74] * p[32] + f[75] * p[44] + f[76] * p[56] + f[77] * p[68]
+          + f[78] * p[80] + f[79] * p[92] + f[80] * p[104] + f[81] * p[116] + f[82] * p[128] + f[83] * p[140];
+    t[81] = f[72] * p[9] + f[73] * p[21] + f[74] * p[33] + f[75] * p[45] + f[76] * p[57] + f[77] * p[69]
+          + f[78] * p[81] + f[79] * p[93] + f[80] * p[105] + f[81] * p[117] + f[82] * p[129] + f[83] * p[141];
+    t[82] = f[72] * p[10] + f[73] * p[22] + f[74] * p[34] + f[75] * p[46] + f[76] * p[58] + f[77] * p[70]
+          + f[78] * p[82] + f[79] * p[94] + f[80] * p[106] + f[81] * p[118] + f[82] * p[130] + f[83] * p[142];
+    t[83] = f[72] * p[11] + f[73] * p[23] + f[74] * p[35] + f[75] * p[47] + f[76] * p[59] + f[77] * p[71]
+          + f[78] * p[83] + f[79] * p[95] + f[80] * p[107] + f[81] * p[119] + f[82] * p[131] + f[83] * p[143];
+    t[84] = f[84] * p[0] + f[85] * p[12] + f[86] * p[24] + f[87] * p[36] + f[88] * p[48] + f[89] * p[60]
+          + f[90] * p[72] + f[91] * p[84] + f[92] * p[96] + f[93] * p[108] + f[94] * p[120] + f[95] * p[132];
+    t[85] = f[84] * p[1] + f[85] * p[13] + f[86] * p[25] + f[87] * p[37] + f[88] * p[49] + f[89] * p[61]
+          + f[90] * p[73] + f[91] * p[85] + f[92] * p[97] + f[93] * p[109] + f[94] * p[121] + f[95] * p[133];
+    t[86] = f[84] * p[2] + f[85] * p[14] + f[86] * p[26] + f[87] * p[38] + f[88] * p[50] + f[89] * p[62]
+          + f[90] * p[74] + f[91] * p[86] + f[92] * p[98] + f[93] * p[110] + f[94] * p[122] + f[95] * p[134];
+    t[87] = f[84] * p[3] + f[85] * p[15] + f[86] * p[27] + f[87] * p[39] + f[88] * p[51] + f[89] * p[63]
+          + f[90] * p[75] + f[91] * p[87] + f[92] * p[99] + f[93] * p[111] + f[94] * p[123] + f[95] * p[135];
+    t[88] = f[84] * p[4] + f[85] * p[16] + f[86] * p[28] + f[87] * p[40] + f[88] * p[52] + f[89] * p[64]
+          + f[90] * p[76] + f[91] * p[88] + f[92] * p[100] + f[93] * p[112] + f[94] * p[124] + f[95] * p[136];
+    t[89] = f[84] * p[5] + f[85] * p[17] + f[86] * p[29] + f[87] * p[41] + f[88] * p[53] + f[89] * p[65]
+          + f[90] * p[77] + f[91] * p[89] + f[92] * p[101] + f[93] * p[113] + f[94] * p[125] + f[95] * p[137];
+    t[90] = f[84] * p[6] + f[85] * p[18] + f[86] * p[30] + f[87] * p[42] + f[88] * p[54] + f[89] * p[66]
+          + f[90] * p[78] + f[91] * p[90] + f[92] * p[102] + f[93] * p[114] + f[94] * p[126] + f[95] * p[138];
+    t[91] = f[84] * p[7] + f[85] * p[19] + f[86] * p[31] + f[87] * p[43] + f[88] * p[55] + f[89] * p[67]
+          + f[90] * p[79] + f[91] * p[91] + f[92] * p[103] + f[93] * p[115] + f[94] * p[127] + f[95] * p[139];
+    t[92] = f[84] * p[8] + f[85] * p[20] + f[86] * p[32] + f[87] * p[44] + f[88] * p[56] + f[89] * p[68]
+          + f[90] * p[80] + f[91] * p[92] + f[92] * p[104] + f[93] * p[116] + f[94] * p[128] + f[95] * p[140];
+    t[93] = f[84] * p[9] + f[85] * p[21] + f[86] * p[33] + f[87] * p[45] + f[88] * p[57] + f[89] * p[69]
+          + f[90] * p[81] + f[91] * p[93] + f[92] * p[105] + f[93] * p[117] + f[94] * p[129] + f[95] * p[141];
+    t[94] = f[84] * p[10] + f[85] * p[22] + f[86] * p[34] + f[87] * p[46] + f[88] * p[58] + f[89] * p[70]
+          + f[90] * p[82] + f[91] * p[94] + f[92] * p[106] + f[93] * p[118] + f[94] * p[130] + f[95] * p[142];
+    t[95] = f[84] * p[11] + f[85] * p[23] + f[86] * p[35] + f[87] * p[47] + f[88] * p[59] + f[89] * p[71]
+          + f[90] * p[83] + f[91] * p[95] + f[92] * p[107] + f[93] * p[119] + f[94] * p[131] + f[95] * p[143];
+    t[96] = f[96] * p[0] + f[97] * p[12] + f[98] * p[24] + f[99] * p[36] + f[100] * p[48] + f[101] * p[60]
+          + f[102] * p[72] + f[103] * p[84] + f[104] * p[96] + f[105] * p[108] + f[106] * p[120]
+          + f[107] * p[132];
+    t[97] = f[96] * p[1] + f[97] * p[13] + f[98] * p[25] + f[99] * p[37] + f[100] * p[49] + f[101] * p[61]
+          + f[102] * p[73] + f[103] * p[85] + f[104] * p[97] + f[105] * p[109] + f[106] * p[121]
+          + f[107] * p[133];
+    t[98] = f[96] * p[2] + f[97] * p[14] + f[98] * p[26] + f[99] * p[38] + f[100] * p[50] + f[101] * p[62]
+          + f[102] * p[74] + f[103] * p[86] + f[104] * p[98] + f[105] * p[110] + f[106] * p[122]
+          + f[107] * p[134];
+    t[99] = f[96] * p[3] + f[97] * p[15] + f[98] * p[27] + f[99] * p[39] + f[100] * p[51] + f[101] * p[63]
+          + f[102] * p[75] + f[103] * p[87] + f[104] * p[99] + f[105] * p[111] + f[106] * p[123]
+          + f[107] * p[135];
+    t[100] = f[96] * p[4] + f[97] * p[16] + f[98] * p[28] + f[99] * p[40] + f[100] * p[52] + f[101] * p[64]
+           + f[102] * p[76] + f[103] * p[88] + f[104] * p[100] + f[105] * p[112] + f[106] * p[124]
+           + f[107] * p[136];
+    t[101] = f[96] * p[5] + f[97] * p[17] + f[98] * p[29] + f[99] * p[41] + f[100] * p[53] + f[101] * p[65]
+           + f[102] * p[77] + f[103] * p[89] + f[104] * p[101] + f[105] * p[113] + f[106] * p[125]
+           + f[107] * p[137];
+    t[102] = f[96] * p[6] + f[97] * p[18] + f[98] * p[30] + f[99] * p[42] + f[100] * p[54] + f[101] * p[66]
+           + f[102] * p[78] + f[103] * p[90] + f[104] * p[102] + f[105] * p[114] + f[106] * p[126]
+           + f[107] * p[138];
+    t[103] = f[96] * p[7] + f[97] * p[19] + f[98] * p[31] + f[99] * p[43] + f[100] * p[55] + f[101] * p[67]
+           + f[102] * p[79] + f[103] * p[91] + f[104] * p[103] + f[105] * p[115] + f[106] * p[127]
+           + f[107] * p[139];
+    t[104] = f[96] * p[8] + f[97] * p[20] + f[98] * p[32] + f[99] * p[44] + f[100] * p[56] + f[101] * p[68]
+           + f[102] * p[80] + f[103] * p[92] + f[104] * p[104] + f[105] * p[116] + f[106] * p[128]
+           + f[107] * p[140];
+    t[105] = f[96] * p[9] + f[97] * p[21] + f[98] * p[33] + f[99] * p[45] + f[100] * p[57] + f[101] * p[69]
+           + f[102] * p[81] + f[103] * p[93] + f[104] * p[105] + f[105] * p[117] + f[106] * p[129]
+           + f[107] * p[141];
+    t[106] = f[96] * p[10] + f[97] * p[22] + f[98] * p[34] + f[99] * p[46] + f[100] * p[58] + f[101] * p[70]
+           + f[102] * p[82] + f[103] * p[94] + f[104] * p[106] + f[105] * p[118] + f[106] * p[130]
+           + f[107] * p[142];
+    t[107] = f[96] * p[11] + f[97] * p[23] + f[98] * p[35] + f[99] * p[47] + f[100] * p[59] + f[101] * p[71]
+           + f[102] * p[83] + f[103] * p[95] + f[104] * p[107] + f[105] * p[119] + f[106] * p[131]
+           + f[107] * p[143];
+    t[108] = f[108] * p[0] + f[109] * p[12] + f[110] * p[24] + f[111] * p[36] + f[112] * p[48]
+           + f[113] * p[60] + f[114] * p[72] + f[115] * p[84] + f[116] * p[96] + f[117] * p[108]
+           + f[118] * p[120] + f[119] * p[132];
+    t[109] = f[108] * p[1] + f[109] * p[13] + f[110] * p[25] + f[111] * p[37] + f[112] * p[49]
+           + f[113] * p[61] + f[114] * p[73] + f[115] * p[85] + f[116] * p[97] + f[117] * p[109]
+           + f[118] * p[121] + f[119] * p[133];
+    t[110] = f[108] * p[2] + f[109] * p[14] + f[110] * p[26] + f[111] * p[38] + f[112] * p[50]
+           + f[113] * p[62] + f[114] * p[74] + f[115] * p[86] + f[116] * p[98] + f[117] * p[110]
+           + f[118] * p[122] + f[119] * p[134];
+    t[111] = f[108] * p[3] + f[109] * p[15] + f[110] * p[27] + f[111] * p[39] + f[112] * p[51]
+           + f[113] * p[63] + f[114] * p[75] + f[115] * p[87] + f[116] * p[99] + f[117] * p[111]
+           + f[118] * p[123] + f[119] * p[135];
+    t[112] = f[108] * p[4] + f[109] * p[16] + f[110] * p[28] + f[111] * p[40] + f[112] * p[52]
+           + f[113] * p[64] + f[114] * p[76] + f[115] * p[88] + f[116] * p[100] + f[117] * p[112]
+           + f[118] * p[124] + f[119] * p[136];
+    t[113] = f[108] * p[5] + f[109] * p[17] + f[110] * p[29] + f[111] * p[41] + f[112] * p[53]
+           + f[113] * p[65] + f[114] * p[77] + f[115] * p[89] + f[116] * p[101] + f[117] * p[113]
+           + f[118] * p[125] + f[119] * p[137];
+    t[114] = f[108] * p[6] + f[109] * p[18] + f[110] * p[30] + f[111] * p[42] + f[112] * p[54]
+           + f[113] * p[66] + f[114] * p[78] + f[115] * p[90] + f[116] * p[102] + f[117] * p[114]
+           + f[118] * p[126] + f[119] * p[138];
+    t[115] = f[108] * p[7] + f[109] * p[19] + f[110] * p[31] + f[111] * p[43] + f[112] * p[55]
+           + f[113] * p[67] + f[114] * p[79] + f[115] * p[91] + f[116] * p[103] + f[117] * p[115]
+           + f[118] * p[127] + f[119] * p[139];
+    t[116] = f[108] * p[8] + f[109] * p[20] + f[110] * p[32] + f[111] * p[44] + f[112] * p[56]
+           + f[113] * p[68] + f[114] * p[80] + f[115] * p[92] + f[116] * p[104] + f[117] * p[116]
+           + f[118] * p[128] + f[119] * p[140];
+    t[117] = f[108] * p[9] + f[109] * p[21] + f[110] * p[33] + f[111] * p[45] + f[112] * p[57]
+           + f[113] * p[69] + f[114] * p[81] + f[115] * p[93] + f[116] * p[105] + f[117] * p[117]
+           + f[118] * p[129] + f[119] * p[141];
+    t[118] = f[108] * p[10] + f[109] * p[22] + f[110] * p[34] + f[111] * p[46] + f[112] * p[58]
+           + f[113] * p[70] + f[114] * p[82] + f[115] * p[94] + f[116] * p[106] + f[117] * p[118]
+           + f[118] * p[130] + f[119] * p[142];
+    t[119] = f[108] * p[11] + f[109] * p[23] + f[110] * p[35] + f[111] * p[47] + f[112] * p[59]
+           + f[113] * p[71] + f[114] * p[83] + f[115] * p[95] + f[116] * p[107] + f[117] * p[119]
+           + f[118] * p[131] + f[119] * p[143];
+    t[120] = f[120] * p[0] + f[121] * p[12] + f[122] * p[24] + f[123] * p[36] + f[124] * p[48]
+           + f[125] * p[60] + f[126] * p[72] + f[127] * p[84] + f[128] * p[96] + f[129] * p[108]
+           + f[130] * p[120] + f[131] * p[132];
+    t[121] = f[120] * p[1] + f[121] * p[13] + f[122] * p[25] + f[123] * p[37] + f[124] * p[49]
+           + f[125] * p[61] + f[126] * p[73] + f[127] * p[85] + f[128] * p[97] + f[129] * p[109]
+           + f[130] * p[121] + f[131] * p[133];
+    t[122] = f[120] * p[2] + f[121] * p[14] + f[122] * p[26] + f[123] * p[38] + f[124] * p[50]
+           + f[125] * p[62] + f[126] * p[74] + f[127] * p[86] + f[128] * p[98] + f[129] * p[110]
+           + f[130] * p[122] + f[131] * p[134];
+    t[123] = f[120] * p[3] + f[121] * p[15] + f[122] * p[27] + f[123] * p[39] + f[124] * p[51]
+           + f[125] * p[63] + f[126] * p[75] + f[127] * p[87] + f[128] * p[99] + f[129] * p[111]
+           + f[130] * p[123] + f[131] * p[135];
+    t[124] = f[120] * p[4] + f[121] * p[16] + f[122] * p[28] + f[123] * p[40] + f[124] * p[52]
+           + f[125] * p[64] + f[126] * p[76] + f[127] * p[88] + f[128] * p[100] + f[129] * p[112]
+           + f[130] * p[124] + f[131] * p[136];
+    t[125] = f[120] * p[5] + f[121] * p[17] + f[122] * p[29] + f[123] * p[41] + f[124] * p[53]
+           + f[125] * p[65] + f[126] * p[77] + f[127] * p[89] + f[128] * p[101] + f[129] * p[113]
+           + f[130] * p[125] + f[131] * p[137];
+    t[126] = f[120] * p[6] + f[121] * p[18] + f[122] * p[30] + f[123] * p[42] + f[124] * p[54]
+           + f[125] * p[66] + f[126] * p[78] + f[127] * p[90] + f[128] * p[102] + f[129] * p[114]
+           + f[130] * p[126] + f[131] * p[138];
+    t[127] = f[120] * p[7] + f[121] * p[19] + f[122] * p[31] + f[123] * p[43] + f[124] * p[55]
+           + f[125] * p[67] + f[126] * p[79] + f[127] * p[91] + f[128] * p[103] + f[129] * p[115]
+           + f[130] * p[127] + f[131] * p[139];
+    t[128] = f[120] * p[8] + f[121] * p[20] + f[122] * p[32] + f[123] * p[44] + f[124] * p[56]
+           + f[125] * p[68] + f[126] * p[80] + f[127] * p[92] + f[128] * p[104] + f[129] * p[116]
+           + f[130] * p[128] + f[131] * p[140];
+    t[129] = f[120] * p[9] + f[121] * p[21] + f[122] * p[33] + f[123] * p[45] + f[124] * p[57]
+           + f[125] * p[69] + f[126] * p[81] + f[127] * p[93] + f[128] * p[105] + f[129] * p[117]
+           + f[130] * p[129] + f[131] * p[141];
+    t[130] = f[120] * p[10] + f[121] * p[22] + f[122] * p[34] + f[123] * p[46] + f[124] * p[58]
+           + f[125] * p[70] + f[126] * p[82] + f[127] * p[94] + f[128] * p[106] + f[129] * p[118]
+           + f[130] * p[130] + f[131] * p[142];
+    t[131] = f[120] * p[11] + f[121] * p[23] + f[122] * p[35] + f[123] * p[47] + f[124] * p[59]
+           + f[125] * p[71] + f[126] * p[83] + f[127] * p[95] + f[128] * p[107] + f[129] * p[119]
+           + f[130] * p[131] + f[131] * p[143];
+    t[132] = f[132] * p[0] + f[133] * p[12] + f[134] * p[24] + f[135] * p[36] + f[136] * p[48]
+           + f[137] * p[60] + f[138] * p[72] + f[139] * p[84] + f[140] * p[96] + f[141] * p[108]
+           + f[142] * p[120] + f[143] * p[132];
+    t[133] = f[132] * p[1] + f[133] * p[13] + f[134] * p[25] + f[135] * p[37] + f[136] * p[49]
+           + f[137] * p[61] + f[138] * p[73] + f[139] * p[85] + f[140] * p[97] + f[141] * p[109]
+           + f[142] * p[121] + f[143] * p[133];
+    t[134] = f[132] * p[2] + f[133] * p[14] + f[134] * p[26] + f[135] * p[38] + f[136] * p[50]
+           + f[137] * p[62] + f[138] * p[74] + f[139] * p[86] + f[140] * p[98] + f[141] * p[110]
+           + f[142] * p[122] + f[143] * p[134];
+    t[135] = f[132] * p[3] + f[133] * p[15] + f[134] * p[27] + f[135] * p[39] + f[136] * p[51]
+           + f[137] * p[63] + f[138] * p[75] + f[139] * p[87] + f[140] * p[99] + f[141] * p[111]
+           + f[142] * p[123] + f[143] * p[135];
+    t[136] = f[132] * p[4] + f[133] * p[16] + f[134] * p[28] + f[135] * p[40] + f[136] * p[52]
+           + f[137] * p[64] + f[138] * p[76] + f[139] * p[88] + f[140] * p[100] + f[141] * p[112]
+           + f[142] * p[124] + f[143] * p[136];
+    t[137] = f[132] * p[5] + f[133] * p[17] + f[134] * p[29] + f[135] * p[41] + f[136] * p[53]
+           + f[137] * p[65] + f[138] * p[77] + f[139] * p[89] + f[140] * p[101] + f[141] * p[113]
+           + f[142] * p[125] + f[143] * p[137];
+    t[138] = f[132] * p[6] + f[133] * p[18] + f[134] * p[30] + f[135] * p[42] + f[136] * p[54]
+           + f[137] * p[66] + f[138] * p[78] + f[139] * p[90] + f[140] * p[102] + f[141] * p[114]
+           + f[142] * p[126] + f[143] * p[138];
+    t[139] = f[132] * p[7] + f[133] * p[19] + f[134] * p[31] + f[135] * p[43] + f[136] * p[55]
+           + f[137] * p[67] + f[138] * p[79] + f[139] * p[91] + f[140] * p[103] + f[141] * p[115]
+           + f[142] * p[127] + f[143] * p[139];
+    t[140] = f[132] * p[8] + f[133] * p[20] + f[134] * p[32] + f[135] * p[44] + f[136] * p[56]
+           + f[137] * p[68] + f[138] * p[80] + f[139] * p[92] + f[140] * p[104] + f[141] * p[116]
+           + f[142] * p[128] + f[143] * p[140];
+    t[141] = f[132] * p[9] + f[133] * p[21] + f[134] * p[33] + f[135] * p[45] + f[136] * p[57]
+           + f[137] * p[69] + f[138] * p[81] + f[139] * p[93] + f[140] * p[105] + f[141] * p[117]
+           + f[142] * p[129] + f[143] * p[141];
+    t[142] = f[132] * p[10] + f[133] * p[22] + f[134] * p[34] + f[135] * p[46] + f[136] * p[58]
+           + f[137] * p[70] + f[138] * p[82] + f[139] * p[94] + f[140] * p[106] + f[141] * p[118]
+           + f[142] * p[130] + f[143] * p[142];
+    t[143] = f[132] * p[11] + f[133] * p[23] + f[134] * p[35] + f[135] * p[47] + f[136] * p[59]
+           + f[137] * p[71] + f[138] * p[83] + f[139] * p[95] + f[140] * p[107] + f[141] * p[119]
+           + f[142] * p[131] + f[143] * p[143];
+
+    p[0] = t[0] * f[0] + t[1] * f[1] + t[2] * f[2] + t[3] * f[3] + t[4] * f[4] + t[5] * f[5] + t[6] * f[6]
+         + t[7] * f[7] + t[8] * f[8] + t[9] * f[9] + t[10] * f[10] + t[11] * f[11] + q[0];
+    p[1] = t[0] * f[12] + t[1] * f[13] + t[2] * f[14] + t[3] * f[15] + t[4] * f[16] + t[5] * f[17]
+         + t[6] * f[18] + t[7] * f[19] + t[8] * f[20] + t[9] * f[21] + t[10] * f[22] + t[11] * f[23] + q[1];
+    p[2] = t[0] * f[24] + t[1] * f[25] + t[2] * f[26] + t[3] * f[27] + t[4] * f[28] + t[5] * f[29]
+         + t[6] * f[30] + t[7] * f[31] + t[8] * f[32] + t[9] * f[33] + t[10] * f[34] + t[11] * f[35] + q[2];
+    p[3] = t[0] * f[36] + t[1] * f[37] + t[2] * f[38] + t[3] * f[39] + t[4] * f[40] + t[5] * f[41]
+         + t[6] * f[42] + t[7] * f[43] + t[8] * f[44] + t[9] * f[45] + t[10] * f[46] + t[11] * f[47] + q[3];
+    p[4] = t[0] * f[48] + t[1] * f[49] + t[2] * f[50] + t[3] * f[51] + t[4] * f[52] + t[5] * f[53]
+         + t[6] * f[54] + t[7] * f[55] + t[8] * f[56] + t[9] * f[57] + t[10] * f[58] + t[11] * f[59] + q[4];
+    p[5] = t[0] * f[60] + t[1] * f[61] + t[2] * f[62] + t[3] * f[63] + t[4] * f[64] + t[5] * f[65]
+         + t[6] * f[66] + t[7] * f[67] + t[8] * f[68] + t[9] * f[69] + t[10] * f[70] + t[11] * f[71] + q[5];
+    p[6] = t[0] * f[72] + t[1] * f[73] + t[2] * f[74] + t[3] * f[75] + t[4] * f[76] + t[5] * f[77]
+         + t[6] * f[78] + t[7] * f[79] + t[8] * f[80] + t[9] * f[81] + t[10] * f[82] + t[11] * f[83] + q[6];
+    p[7] = t[0] * f[84] + t[1] * f[85] + t[2] * f[86] + t[3] * f[87] + t[4] * f[88] + t[5] * f[89]
+         + t[6] * f[90] + t[7] * f[91] + t[8] * f[92] + t[9] * f[93] + t[10] * f[94] + t[11] * f[95] + q[7];
+    p[8] = t[0] * f[96] + t[1] * f[97] + t[2] * f[98] + t[3] * f[99] + t[4] * f[100] + t[5] * f[101]
+         + t[6] * f[102] + t[7] * f[103] + t[8] * f[104] + t[9] * f[105] + t[10] * f[106] + t[11] * f[107]
+         + q[8];
+    p[9] = t[0] * f[108] + t[1] * f[109] + t[2] * f[110] + t[3] * f[111] + t[4] * f[112] + t[5] * f[113]
+         + t[6] * f[114] + t[7] * f[115] + t[8] * f[116] + t[9] * f[117] + t[10] * f[118] + t[11] * f[119]
+         + q[9];
+    p[10] = t[0] * f[120] + t[1] * f[121] + t[2] * f[122] + t[3] * f[123] + t[4] * f[124] + t[5] * f[125]
+          + t[6] * f[126] + t[7] * f[127] + t[8] * f[128] + t[9] * f[129] + t[10] * f[130] + t[11] * f[131]
+          + q[10];
+    p[11] = t[0] * f[132] + t[1] * f[133] + t[2] * f[134] + t[3] * f[135] + t[4] * f[136] + t[5] * f[137]
+          + t[6] * f[138] + t[7] * f[139] + t[8] * f[140] + t[9] * f[141] + t[10] * f[142] + t[11] * f[143]
+          + q[11];
+    p[13] = t[12] * f[12] + t[13] * f[13] + t[14] * f[14] + t[15] * f[15] + t[16] * f[16] + t[17] * f[17]
+          + t[18] * f[18] + t[19] * f[19] + t[20] * f[20] + t[21] * f[21] + t[22] * f[22] + t[23] * f[23]
+          + q[13];
+    p[14] = t[12] * f[24] + t[13] * f[25] + t[14] * f[26] + t[15] * f[27] + t[16] * f[28] + t[17] * f[29]
+          + t[18] * f[30] + t[19] * f[31] + t[20] * f[32] + t[21] * f[33] + t[22] * f[34] + t[23] * f[35]
+          + q[14];
+    p[15] = t[12] * f[36] + t[13] * f[37] + t[14] * f[38] + t[15] * f[39] + t[16] * f[40] + t[17] * f[41]
+          + t[18] * f[42] + t[19] * f[43] + t[20] * f[44] + t[21] * f[45] + t[22] * f[46] + t[23] * f[47]
+          + q[15];
+    p[16] = t[12] * f[48] + t[13] * f[49] + t[14] * f[50] + t[15] * f[51] + t[16] * f[52] + t[17] * f[53]
+          + t[18] * f[54] + t[19] * f[55] + t[20] * f[56] + t[21] * f[57] + t[22] * f[58] + t[23] * f[59]
+          + q[16];
+    p[17] = t[12] * f[60] + t[13] * f[61] + t[14] * f[62] + t[15] * f[63] + t[16] * f[64] + t[17] * f[65]
+          + t[18] * f[66] + t[19] * f[67] + t[20] * f[68] + t[21] * f[69] + t[22] * f[70] + t[23] * f[71]
+          + q[17];
+    p[18] = t[12] * f[72] + t[13] * f[73] + t[14] * f[74] + t[15] * f[75] + t[16] * f[76] + t[17] * f[77]
+          + t[18] * f[78] + t[19] * f[79] + t[20] * f[80] + t[21] * f[81] + t[22] * f[82] + t[23] * f[83]
+          + q[18];
+    p[19] = t[12] * f[84] + t[13] * f[85] + t[14] * f[86] + t[15] * f[87] + t[16] * f[88] + t[17] * f[89]
+          + t[18] * f[90] + t[19] * f[91] + t[20] * f[92] + t[21] * f[93] + t[22] * f[94] + t[23] * f[95]
+          + q[19];
+    p[20] = t[12] * f[96] + t[13] * f[97] + t[14] * f[98] + t[15] * f[99] + t[16] * f[100] + t[17] * f[101]
+          + t[18] * f[102] + t[19] * f[103] + t[20] * f[104] + t[21] * f[105] + t[22] * f[106]
+          + t[23] * f[107] + q[20];
+    p[21] = t[12] * f[108] + t[13] * f[109] + t[14] * f[110] + t[15] * f[111] + t[16] * f[112]
+          + t[17] * f[113] + t[18] * f[114] + t[19] * f[115] + t[20] * f[116] + t[21] * f[117]
+          + t[22] * f[118] + t[23] * f[119] + q[21];
+    p[22] = t[12] * f[120] + t[13] * f[121] + t[14] * f[122] + t[15] * f[123] + t[16] * f[124]
+          + t[17] * f[125] + t[18] * f[126] + t[19] * f[127] + t[20] * f[128] + t[21] * f[129]
+          + t[22] * f[130] + t[23] * f[131] + q[22];
+    p[23] = t[12] * f[132] + t[13] * f[133] + t[14] * f[134] + t[15] * f[135] + t[16] * f[136]
+          + t[17] * f[137] + t[18] * f[138] + t[19] * f[139] + t[20] * f[140] + t[21] * f[141]
+          + t[22] * f[142] + t[23] * f[143] + q[23];
+    p[26] = t[24] * f[24] + t[25] * f[25] + t[26] * f[26] + t[27] * f[27] + t[28] * f[28] + t[29] * f[29]
+          + t[30] * f[30] + t[31] * f[31] + t[32] * f[32] + t[33] * f[33] + t[34] * f[34] + t[35] * f[35]
+          + q[26];
+    p[27] = t[24] * f[36] + t[25] * f[37] + t[26] * f[38] + t[27] * f[39] + t[28] * f[40] + t[29] * f[41]
+          + t[30] * f[42] + t[31] * f[43] + t[32] * f[44] + t[33] * f[45] + t[34] * f[46] + t[35] * f[47]
+          + q[27];
+    p[28] = t[24] * f[48] + t[25] * f[49] + t[26] * f[50] + t[27] * f[51] + t[28] * f[52] + t[29] * f[53]
+          + t[30] * f[54] + t[31] * f[55] + t[32] * f[56] + t[33] * f[57] + t[34] * f[58] + t[35] * f[59]
+          + q[28];
+    p[29] = t[24] * f[60] + t[25] * f[61] + t[26] * f[62] + t[27] * f[63] + t[28] * f[64] + t[29] * f[65]
+          + t[30] * f[66] + t[31] * f[67] + t[32] * f[68] + t[33] * f[69] + t[34] * f[70] + t[35] * f[71]
+          + q[29];
+    p[30] = t[24] * f[72] + t[25] * f[73] + t[26] * f[74] + t[27] * f[75] + t[28] * f[76] + t[29] * f[77]
+          + t[30] * f[78] + t[31] * f[79] + t[32] * f[80] + t[33] * f[81] + t[34] * f[82] + t[35] * f[83]
+          + q[30];
+    p[31] = t[24] * f[84] + t[25] * f[85] + t[26] * f[86] + t[27] * f[87] + t[28] * f[88] + t[29] * f[89]
+          + t[30] * f[90] + t[31] * f[91] + t[32] * f[92] + t[33] * f[93] + t[34] * f[94] + t[35] * f[95]
+          + q[31];
+    p[32] = t[24] * f[96] + t[25] * f[97] + t[26] * f[98] + t[27] * f[99] + t[28] * f[100] + t[29] * f[101]
+          + t[30] * f[102] + t[31] * f[103] + t[32] * f[104] + t[33] * f[105] + t[34] * f[106]
+          + t[35] * f[107] + q[32];
+    p[33] = t[24] * f[108] + t[25] * f[109] + t[26] * f[110] + t[27] * f[111] + t[28] * f[112]
+          + t[29] * f[113] + t[30] * f[114] + t[31] * f[115] + t[32] * f[116] + t[33] * f[117]
+          + t[34] * f[118] + t[35] * f[119] + q[33];
+    p[34] = t[24] * f[120] + t[25] * f[121] + t[26] * f[122] + t[27] * f[123] + t[28] * f[124]
+          + t[29] * f[125] + t[30] * f[126] + t[31] * f[127] + t[32] * f[128] + t[33] * f[129]
+          + t[34] * f[130] + t[35] * f[131] + q[34];
+    p[35] = t[24] * f[132] + t[25] * f[133] + t[26] * f[134] + t[27] * f[135] + t[28] * f[136]
+          + t[29] * f[137] + t[30] * f[138] + t[31] * f[139] + t[32] * f[140] + t[33] * f[141]
+          + t[34] * f[142] + t[35] * f[143] + q[35];
+    p[39] = t[36] * f[36] + t[37] * f[37] + t[38] * f[38] + t[39] * f[39] + t[40] * f[40] + t[41] * f[41]
+          + t[42] * f[42] + t[43] * f[43] + t[44] * f[44] + t[45] * f[45] + t[46] * f[46] + t[47] * f[47]
+          + q[39];
+    p[40] = t[36] * f[48] + t[37] * f[49] + t[38] * f[50] + t[39] * f[51] + t[40] * f[52] + t[41] * f[53]
+          + t[42] * f[54] + t[43] * f[55] + t[44] * f[56] + t[45] * f[57] + t[46] * f[58] + t[47] * f[59]
+          + q[40];
+    p[41] = t[36] * f[60] + t[37] * f[61] + t[38] * f[62] + t[39] * f[63] + t[40] * f[64] + t[41] * f[65]
+          + t[42] * f[66] + t[43] * f[67] + t[44] * f[68] + t[45] * f[69] + t[46] * f[70] + t[47] * f[71]
+          + q[41];
+    p[42] = t[36] * f[72] + t[37] * f[73] + t[38] * f[74] + t[39] * f[75] + t[40] * f[76] + t[41] * f[77]
+          + t[42] * f[78] + t[43] * f[79] + t[44] * f[80] + t[45] * f[81] + t[46] * f[82] + t[47] * f[83]
+          + q[42];
+    p[43] = t[36] * f[84] + t[37] * f[85] + t[38] * f[86] + t[39] * f[87] + t[40] * f[88] + t[41] * f[89]
+          + t[42] * f[90] + t[43] * f[91] + t[44] * f[92] + t[45] * f[93] + t[46] * f[94] + t[47] * f[95]
+          + q[43];
+    p[44] = t[36] * f[96] + t[37] * f[97] + t[38] * f[98] + t[39] * f[99] + t[40] * f[100] + t[41] * f[101]
+          + t[42] * f[102] + t[43] * f[103] + t[44] * f[104] + t[45] * f[105] + t[46] * f[106]
+          + t[47] * f[107] + q[44];
+    p[45] = t[36] * f[108] + t[37] * f[109] + t[38] * f[110] + t[39] * f[111] + t[40] * f[112]
+          + t[41] * f[113] + t[42] * f[114] + t[43] * f[115] + t[44] * f[116] + t[45] * f[117]
+          + t[46] * f[118] + t[47] * f[119] + q[45];
+    p[46] = t[36] * f[120] + t[37] * f[121] + t[38] * f[122] + t[39] * f[123] + t[40] * f[124]
+          + t[41] * f[125] + t[42] * f[126] + t[43] * f[127] + t[44] * f[128] + t[45] * f[129]
+          + t[46] * f[130] + t[47] * f[131] + q[46];
+    p[47] = t[36] * f[132] + t[37] * f[133] + t[38] * f[134] + t[39] * f[135] + t[40] * f[136]
+          + t[41] * f[137] + t[42] * f[138] + t[43] * f[139] + t[44] * f[140] + t[45] * f[141]
+          + t[46] * f[142] + t[47] * f[143] + q[47];
+    p[52] = t[48] * f[48] + t[49] * f[49] + t[50] * f[50] + t[51] * f[51] + t[52] * f[52] + t[53] * f[53]
+          + t[54] * f[54] + t[55] * f[55] + t[56] * f[56] + t[57] * f[57] + t[58] * f[58] + t[59] * f[59]
+          + q[52];
+    p[53] = t[48] * f[60] + t[49] * f[61] + t[50] * f[62] + t[51] * f[63] + t[52] * f[64] + t[53] * f[65]
+          + t[54] * f[66] + t[55] * f[67] + t[56] * f[68] + t[57] * f[69] + t[58] * f[70] + t[59] * f[71]
+          + q[53];
+    p[54] = t[48] * f[72] + t[49] * f[73] + t[50] * f[74] + t[51] * f[75] + t[52] * f[76] + t[53] * f[77]
+          + t[54] * f[78] + t[55] * f[79] + t[56] * f[80] + t[57] * f[81] + t[58] * f[82] + t[59] * f[83]
+          + q[54];
+    p[55] = t[48] * f[84] + t[49] * f[85] + t[50] * f[86] + t[51] * f[87] + t[52] * f[88] + t[53] * f[89]
+          + t[54] * f[90] + t[55] * f[91] + t[56] * f[92] + t[57] * f[93] + t[58] * f[94] + t[59] * f[95]
+          + q[55];
+    p[56] = t[48] * f[96] + t[49] * f[97] + t[50] * f[98] + t[51] * f[99] + t[52] * f[100] + t[53] * f[101]
+          + t[54] * f[102] + t[55] * f[103] + t[56] * f[104] + t[57] * f[105] + t[58] * f[106]
+          + t[59] * f[107] + q[56];
+    p[57] = t[48] * f[108] + t[49] * f[109] + t[50] * f[110] + t[51] * f[111] + t[52] * f[112]
+          + t[53] * f[113] + t[54] * f[114] + t[55] * f[115] + t[56] * f[116] + t[57] * f[117]
+          + t[58] * f[118] + t[59] * f[119] + q[57];
+    p[58] = t[48] * f[120] + t[49] * f[121] + t[50] * f[122] + t[51] * f[123] + t[52] * f[124]
+          + t[53] * f[125] + t[54] * f[126] + t[55] * f[127] + t[56] * f[128] + t[57] * f[129]
+          + t[58] * f[130] + t[59] * f[131] + q[58];
+    p[59] = t[48] * f[132] + t[49] * f[133] + t[50] * f[134] + t[51] * f[135] + t[52] * f[136]
+          + t[53] * f[137] + t[54] * f[138] + t[55] * f[139] + t[56] * f[140] + t[57] * f[141]
+          + t[58] * f[142] + t[59] * f[143] + q[59];
+    p[65] = t[60] * f[60] + t[61] * f[61] + t[62] * f[62] + t[63] * f[63] + t[64] * f[64] + t[65] * f[65]
+          + t[66] * f[66] + t[67] * f[67] + t[68] * f[68] + t[69] * f[69] + t[70] * f[70] + t[71] * f[71]
+          + q[65];
+    p[66] = t[60] * f[72] + t[61] * f[73] + t[62] * f[74] + t[63] * f[75] + t[64] * f[76] + t[65] * f[77]
+          + t[66] * f[78] + t[67] * f[79] + t[68] * f[80] + t[69] * f[81] + t[70] * f[82] + t[71] * f[83]
+          + q[66];
+    p[67] = t[60] * f[84] + t[61] * f[85] + t[62] * f[86] + t[63] * f[87] + t[64] * f[88] + t[65] * f[89]
+          + t[66] * f[90] + t[67] * f[91] + t[68] * f[92] + t[69] * f[93] + t[70] * f[94] + t[71] * f[95]
+          + q[67];
+    p[68] = t[60] * f[96] + t[61] * f[97] + t[62] * f[98] + t[63] * f[99] + t[64] * f[100] + t[65] * f[101]
+          + t[66] * f[102] + t[67] * f[103] + t[68] * f[104] + t[69] * f[105] + t[70] * f[106]
+          + t[71] * f[107] + q[68];
+    p[69] = t[60] * f[108] + t[61] * f[109] + t[62] * f[110] + t[63] * f[111] + t[64] * f[112]
+          + t[65] * f[113] + t[66] * f[114] + t[67] * f[115] + t[68] * f[116] + t[69] * f[117]
+          + t[70] * f[118] + t[71] * f[119] + q[69];
+    p[70] = t[60] * f[120] + t[61] * f[121] + t[62] * f[122] + t[63] * f[123] + t[64] * f[124]
+          + t[65] * f[125] + t[66] * f[126] + t[67] * f[127] + t[68] * f[128] + t[69] * f[129]
+          + t[70] * f[130] + t[71] * f[131] + q[70];
+    p[71] = t[60] * f[132] + t[61] * f[133] + t[62] * f[134] + t[63] * f[135] + t[64] * f[136]
+          + t[65] * f[137] + t[66] * f[138] + t[67] * f[139] + t[68] * f[140] + t[69] * f[141]
+          + t[70] * f[142] + t[71] * f[143] + q[71];
+    p[78] = t[72] * f[72] + t[73] * f[73] + t[74] * f[74] + t[75] * f[75] + t[76] * f[76] + t[77] * f[77]
+          + t[78] * f[78] + t[79] * f[79] + t[80] * f[80] + t[81] * f[81] + t[82] * f[82] + t[83] * f[83]
+          + q[78];
+    p[79] = t[72] * f[84] + t[73] * f[85] + t[74] * f[86] + t[75] * f[87] + t[76] * f[88] + t[77] * f[89]
+          + t[78] * f[90] + t[79] * f[91] + t[80] * f[92] + t[81] * f[93] + t[82] * f[94] + t[83] * f[95]
+          + q[79];
+    p[80] = t[72] * f[96] + t[73] * f[97] + t[74] * f[98] + t[75] * f[99] + t[76] * f[100] + t[77] * f[101]
+          + t[78] * f[102] + t[79] * f[103] + t[80] * f[104] + t[81] * f[105] + t[82] * f[106]
+          + t[83] * f[107] + q[80];
+    p[81] = t[72] * f[108] + t[73] * f[109] + t[74] * f[110] + t[75] * f[111] + t[76] * f[112]
+          + t[77] * f[113] + t[78] * f[114] + t[79] * f[115] + t[80] * f[116] + t[81] * f[117]
+          + t[82] * f[118] + t[83] * f[119] + q[81];
+    p[82] = t[72] * f[120] + t[73] * f[121] + t[74] * f[122] + t[75] * f[123] + t[76] * f[124]
+          + t[77] * f[125] + t[78] * f[126] + t[79] * f[127] + t[80] * f[128] + t[81] * f[129]
+          + t[82] * f[130] + t[83] * f[131] + q[82];
+    p[83] = t[72] * f[132] + t[73] * f[133] + t[74] * f[134] + t[75] * f[135] + t[76] * f[136]
+          + t[77] * f[137] + t[78] * f[138] + t[79] * f[139] + t[80] * f[140] + t[81] * f[141]
+          + t[82] * f[142] + t[83] * f[143] + q[83];
+    p[91] = t[84] * f[84] + t[85] * f[85] + t[86] * f[86] + t[87] * f[87] + t[88] * f[88] + t[89] * f[89]
+          + t[90] * f[90] + t[91] * f[91] + t[92] * f[92] + t[93] * f[93] + t[94] * f[94] + t[95] * f[95]
+          + q[91];
+    p[92] = t[84] * f[96] + t[85] * f[97] + t[86] * f[98] + t[87] * f[99] + t[88] * f[100] + t[89] * f[101]
+          + t[90] * f[102] + t[91] * f[103] + t[92] * f[104] + t[93] * f[105] + t[94] * f[106]
+          + t[95] * f[107] + q[92];
+    p[93] = t[84] * f[108] + t[85] * f[109] + t[86] * f[110] + t[87] * f[111] + t[88] * f[112]
+          + t[89] * f[113] + t[90] * f[114] + t[91] * f[115] + t[92] * f[116] + t[93] * f[117]
+          + t[94] * f[118] + t[95] * f[119] + q[93];
+    p[94] = t[84] * f[120] + t[85] * f[121] + t[86] * f[122] + t[87] * f[123] + t[88] * f[124]
+          + t[89] * f[125] + t[90] * f[126] + t[91] * f[127] + t[92] * f[128] + t[93] * f[129]
+          + t[94] * f[130] + t[95] * f[131] + q[94];
+    p[95] = t[84] * f[132] + t[85] * f[133] + t[86] * f[134] + t[87] * f[135] + t[88] * f[136]
+          + t[89] * f[137] + t[90] * f[138] + t[91] * f[139] + t[92] * f[140] + t[93] * f[141]
+          + t[94] * f[142] + t[95] * f[143] + q[95];
+    p[104] = t[96] * f[96] + t[97] * f[97] + t[98] * f[98] + t[99] * f[99] + t[100] * f[100] + t[101] * f[101]
+           + t[102] * f[102] + t[103] * f[103] + t[104] * f[104] + t[105] * f[105] + t[106] * f[106]
+           + t[107] * f[107] + q[104];
+    p[105] = t[96] * f[108] + t[97] * f[109] + t[98] * f[110] + t[99] * f[111] + t[100] * f[112]
+           + t[101] * f[113] + t[102] * f[114] + t[103] * f[115] + t[104] * f[116] + t[105] * f[117]
+           + t[106] * f[118] + t[107] * f[119] + q[105];
+    p[106] = t[96] * f[120] + t[97] * f[121] + t[98] * f[122] + t[99] * f[123] + t[100] * f[124]
+           + t[101] * f[125] + t[102] * f[126] + t[103] * f[127] + t[104] * f[128] + t[105] * f[129]
+           + t[106] * f[130] + t[107] * f[131] + q[106];
+    p[107] = t[96] * f[132] + t[97] * f[133] + t[98] * f[134] + t[99] * f[135] + t[100] * f[136]
+           + t[101] * f[137] + t[102] * f[138] + t[103] * f[139] + t[104] * f[140] + t[105] * f[141]
+           + t[106] * f[142] + t[107] * f[143] + q[107];
+    p[117] = t[108] * f[108] + t[109] * f[109] + t[110] * f[110] + t[111] * f[111] + t[112] * f[112]
+           + t[113] * f[113] + t[114] * f[114] + t[115] * f[115] + t[116] * f[116] + t[117] * f[117]
+           + t[118] * f[118] + t[119] * f[119] + q[117];
+    p[118] = t[108] * f[120] + t[109] * f[121] + t[110] * f[122] + t[111] * f[123] + t[112] * f[124]
+           + t[113] * f[125] + t[114] * f[126] + t[115] * f[127] + t[116] * f[128] + t[117] * f[129]
+           + t[118] * f[130] + t[119] * f[131] + q[118];
+    p[119] = t[108] * f[132] + t[109] * f[133] + t[110] * f[134] + t[111] * f[135] + t[112] * f[136]
+           + t[113] * f[137] + t[114] * f[138] + t[115] * f[139] + t[116] * f[140] + t[117] * f[141]
+           + t[118] * f[142] + t[119] * f[143] + q[119];
+    p[130] = t[120] * f[120] + t[121] * f[121] + t[122] * f[122] + t[123] * f[123] + t[124] * f[124]
+           + t[125] * f[125] + t[126] * f[126] + t[127] * f[127] + t[128] * f[128] + t[129] * f[129]
+           + t[130] * f[130] + t[131] * f[131] + q[130];
+    p[131] = t[120] * f[132] + t[121] * f[133] + t[122] * f[134] + t[123] * f[135] + t[124] * f[136]
+           + t[125] * f[137] + t[126] * f[138] + t[127] * f[139] + t[128] * f[140] + t[129] * f[141]
+           + t[130] * f[142] + t[131] * f[143] + q[131];
+    p[143] = t[132] * f[132] + t[133] * f[133] + t[134] * f[134] + t[135] * f[135] + t[136] * f[136]
+           + t[137] * f[137] + t[138] * f[138] + t[139] * f[139] + t[140] * f[140] + t[141] * f[141]
+           + t[142] * f[142] + t[143] * f[143] + q[143];
+
+    p[12] = p[1];
+    p[24] = p[2];
+    p[36] = p[3];
+    p[48] = p[4];
+    p[60] = p[5];
+    p[72] = p[6];
+    p[84] = p[7];
+    p[96] = p[8];
+    p[108] = p[9];
+    p[120] = p[10];
+    p[132] = p[11];
+    p[25] = p[14];
+    p[37] = p[15];
+    p[49] = p[16];
+    p[61] = p[17];
+    p[73] = p[18];
+    p[85] = p[19];
+    p[97] = p[20];
+    p[109] = p[21];
+    p[121] = p[22];
+    p[133] = p[23];
+    p[38] = p[27];
+    p[50] = p[28];
+    p[62] = p[29];
+    p[74] = p[30];
+    p[86] = p[31];
+    p[98] = p[32];
+    p[110] = p[33];
+    p[122] = p[34];
+    p[134] = p[35];
+    p[51] = p[40];
+    p[63] = p[41];
+    p[75] = p[42];
+    p[87] = p[43];
+    p[99] = p[44];
+    p[111] = p[45];
+    p[123] = p[46];
+    p[135] = p[47];
+    p[64] = p[53];
+    p[76] = p[54];
+    p[88] = p[55];
+    p[100] = p[56];
+    p[112] = p[57];
+    p[124] = p[58];
+    p[136] = p[59];
+    p[77] = p[66];
+    p[89] = p[67];
+    p[101] = p[68];
+    p[113] = p[69];
+    p[125] = p[70];
+    p[137] = p[71];
+    p[90] = p[79];
+    p[102] = p[80];
+    p[114] = p[81];
+    p[126] = p[82];
+    p[138] = p[83];
+    p[103] = p[92];
+    p[115] = p[93];
+    p[127] = p[94];
+    p[139] = p[95];
+    p[116] = p[105];
+    p[128] = p[106];
+    p[140] = p[107];
+    p[129] = p[118];
+    p[141] = p[119];
+    p[142] = p[131];
+}
+
+
+boolean Ifx_KalmanF32_update2x1(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[2];
+    float32 s[1];
+    float32 v[1];
+    float32 inv[1];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1];
+    u[1] = p[2] * h[0] + p[3] * h[1];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[1] + r[0];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = u[1] * inv[0];
+    v[0] = y[0] * inv[0];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0];
+        x[1] += u[1] * v[0];
+        p[0] -= u[0] * u[0];
+        p[1] -= u[0] * u[1];
+        p[3] -= u[1] * u[1];
+
+        p[2] = p[1];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update3x1(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[3];
+    float32 s[1];
+    float32 v[1];
+    float32 inv[1];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2];
+    u[1] = p[3] * h[0] + p[4] * h[1] + p[5] * h[2];
+    u[2] = p[6] * h[0] + p[7] * h[1] + p[8] * h[2];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[1] + h[2] * u[2] + r[0];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = u[1] * inv[0];
+    u[2] = u[2] * inv[0];
+    v[0] = y[0] * inv[0];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0];
+        x[1] += u[1] * v[0];
+        x[2] += u[2] * v[0];
+        p[0] -= u[0] * u[0];
+        p[1] -= u[0] * u[1];
+        p[2] -= u[0] * u[2];
+        p[4] -= u[1] * u[1];
+        p[5] -= u[1] * u[2];
+        p[8] -= u[2] * u[2];
+
+        p[3] = p[1];
+        p[6] = p[2];
+        p[7] = p[5];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update4x2(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[8];
+    float32 s[4];
+    float32 v[2];
+    float32 inv[2];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3];
+    u[1] = p[0] * h[4] + p[1] * h[5] + p[2] * h[6] + p[3] * h[7];
+    u[2] = p[4] * h[0] + p[5] * h[1] + p[6] * h[2] + p[7] * h[3];
+    u[3] = p[4] * h[4] + p[5] * h[5] + p[6] * h[6] + p[7] * h[7];
+    u[4] = p[8] * h[0] + p[9] * h[1] + p[10] * h[2] + p[11] * h[3];
+    u[5] = p[8] * h[4] + p[9] * h[5] + p[10] * h[6] + p[11] * h[7];
+    u[6] = p[12] * h[0] + p[13] * h[1] + p[14] * h[2] + p[15] * h[3];
+    u[7] = p[12] * h[4] + p[13] * h[5] + p[14] * h[6] + p[15] * h[7];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[2] + h[2] * u[4] + h[3] * u[6] + r[0];
+    s[2] = h[4] * u[0] + h[5] * u[2] + h[6] * u[4] + h[7] * u[6] + r[2];
+    s[3] = h[4] * u[1] + h[5] * u[3] + h[6] * u[5] + h[7] * u[7] + r[3];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[2] = s[2] * inv[0];
+    pivot = s[3] - (s[2] * s[2]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[3] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[3];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[2])) * inv[1];
+    u[2] = u[2] * inv[0];
+    u[3] = (u[3] - (u[2] * s[2])) * inv[1];
+    u[4] = u[4] * inv[0];
+    u[5] = (u[5] - (u[4] * s[2])) * inv[1];
+    u[6] = u[6] * inv[0];
+    u[7] = (u[7] - (u[6] * s[2])) * inv[1];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[2] * v[0])) * inv[1];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1];
+        x[1] += u[2] * v[0] + u[3] * v[1];
+        x[2] += u[4] * v[0] + u[5] * v[1];
+        x[3] += u[6] * v[0] + u[7] * v[1];
+        p[0] -= u[0] * u[0] + u[1] * u[1];
+        p[1] -= u[0] * u[2] + u[1] * u[3];
+        p[2] -= u[0] * u[4] + u[1] * u[5];
+        p[3] -= u[0] * u[6] + u[1] * u[7];
+        p[5] -= u[2] * u[2] + u[3] * u[3];
+        p[6] -= u[2] * u[4] + u[3] * u[5];
+        p[7] -= u[2] * u[6] + u[3] * u[7];
+        p[10] -= u[4] * u[4] + u[5] * u[5];
+        p[11] -= u[4] * u[6] + u[5] * u[7];
+        p[15] -= u[6] * u[6] + u[7] * u[7];
+
+        p[4] = p[1];
+        p[8] = p[2];
+        p[12] = p[3];
+        p[9] = p[6];
+        p[13] = p[7];
+        p[14] = p[11];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update6x2(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[12];
+    float32 s[4];
+    float32 v[2];
+    float32 inv[2];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3] + p[4] * h[4] + p[5] * h[5];
+    u[1] = p[0] * h[6] + p[1] * h[7] + p[2] * h[8] + p[3] * h[9] + p[4] * h[10] + p[5] * h[11];
+    u[2] = p[6] * h[0] + p[7] * h[1] + p[8] * h[2] + p[9] * h[3] + p[10] * h[4] + p[11] * h[5];
+    u[3] = p[6] * h[6] + p[7] * h[7] + p[8] * h[8] + p[9] * h[9] + p[10] * h[10] + p[11] * h[11];
+    u[4] = p[12] * h[0] + p[13] * h[1] + p[14] * h[2] + p[15] * h[3] + p[16] * h[4] + p[17] * h[5];
+    u[5] = p[12] * h[6] + p[13] * h[7] + p[14] * h[8] + p[15] * h[9] + p[16] * h[10] + p[17] * h[11];
+    u[6] = p[18] * h[0] + p[19] * h[1] + p[20] * h[2] + p[21] * h[3] + p[22] * h[4] + p[23] * h[5];
+    u[7] = p[18] * h[6] + p[19] * h[7] + p[20] * h[8] + p[21] * h[9] + p[22] * h[10] + p[23] * h[11];
+    u[8] = p[24] * h[0] + p[25] * h[1] + p[26] * h[2] + p[27] * h[3] + p[28] * h[4] + p[29] * h[5];
+    u[9] = p[24] * h[6] + p[25] * h[7] + p[26] * h[8] + p[27] * h[9] + p[28] * h[10] + p[29] * h[11];
+    u[10] = p[30] * h[0] + p[31] * h[1] + p[32] * h[2] + p[33] * h[3] + p[34] * h[4] + p[35] * h[5];
+    u[11] = p[30] * h[6] + p[31] * h[7] + p[32] * h[8] + p[33] * h[9] + p[34] * h[10] + p[35] * h[11];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[2] + h[2] * u[4] + h[3] * u[6] + h[4] * u[8] + h[5] * u[10] + r[0];
+    s[2] = h[6] * u[0] + h[7] * u[2] + h[8] * u[4] + h[9] * u[6] + h[10] * u[8] + h[11] * u[10] + r[2];
+    s[3] = h[6] * u[1] + h[7] * u[3] + h[8] * u[5] + h[9] * u[7] + h[10] * u[9] + h[11] * u[11] + r[3];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[2] = s[2] * inv[0];
+    pivot = s[3] - (s[2] * s[2]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[3] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[3];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[2])) * inv[1];
+    u[2] = u[2] * inv[0];
+    u[3] = (u[3] - (u[2] * s[2])) * inv[1];
+    u[4] = u[4] * inv[0];
+    u[5] = (u[5] - (u[4] * s[2])) * inv[1];
+    u[6] = u[6] * inv[0];
+    u[7] = (u[7] - (u[6] * s[2])) * inv[1];
+    u[8] = u[8] * inv[0];
+    u[9] = (u[9] - (u[8] * s[2])) * inv[1];
+    u[10] = u[10] * inv[0];
+    u[11] = (u[11] - (u[10] * s[2])) * inv[1];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[2] * v[0])) * inv[1];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1];
+        x[1] += u[2] * v[0] + u[3] * v[1];
+        x[2] += u[4] * v[0] + u[5] * v[1];
+        x[3] += u[6] * v[0] + u[7] * v[1];
+        x[4] += u[8] * v[0] + u[9] * v[1];
+        x[5] += u[10] * v[0] + u[11] * v[1];
+        p[0] -= u[0] * u[0] + u[1] * u[1];
+        p[1] -= u[0] * u[2] + u[1] * u[3];
+        p[2] -= u[0] * u[4] + u[1] * u[5];
+        p[3] -= u[0] * u[6] + u[1] * u[7];
+        p[4] -= u[0] * u[8] + u[1] * u[9];
+        p[5] -= u[0] * u[10] + u[1] * u[11];
+        p[7] -= u[2] * u[2] + u[3] * u[3];
+        p[8] -= u[2] * u[4] + u[3] * u[5];
+        p[9] -= u[2] * u[6] + u[3] * u[7];
+        p[10] -= u[2] * u[8] + u[3] * u[9];
+        p[11] -= u[2] * u[10] + u[3] * u[11];
+        p[14] -= u[4] * u[4] + u[5] * u[5];
+        p[15] -= u[4] * u[6] + u[5] * u[7];
+        p[16] -= u[4] * u[8] + u[5] * u[9];
+        p[17] -= u[4] * u[10] + u[5] * u[11];
+        p[21] -= u[6] * u[6] + u[7] * u[7];
+        p[22] -= u[6] * u[8] + u[7] * u[9];
+        p[23] -= u[6] * u[10] + u[7] * u[11];
+        p[28] -= u[8] * u[8] + u[9] * u[9];
+        p[29] -= u[8] * u[10] + u[9] * u[11];
+        p[35] -= u[10] * u[10] + u[11] * u[11];
+
+        p[6] = p[1];
+        p[12] = p[2];
+        p[18] = p[3];
+        p[24] = p[4];
+        p[30] = p[5];
+        p[13] = p[8];
+        p[19] = p[9];
+        p[25] = p[10];
+        p[31] = p[11];
+        p[20] = p[15];
+        p[26] = p[16];
+        p[32] = p[17];
+        p[27] = p[22];
+        p[33] = p[23];
+        p[34] = p[29];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update6x3(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[18];
+    float32 s[9];
+    float32 v[3];
+    float32 inv[3];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3] + p[4] * h[4] + p[5] * h[5];
+    u[1] = p[0] * h[6] + p[1] * h[7] + p[2] * h[8] + p[3] * h[9] + p[4] * h[10] + p[5] * h[11];
+    u[2] = p[0] * h[12] + p[1] * h[13] + p[2] * h[14] + p[3] * h[15] + p[4] * h[16] + p[5] * h[17];
+    u[3] = p[6] * h[0] + p[7] * h[1] + p[8] * h[2] + p[9] * h[3] + p[10] * h[4] + p[11] * h[5];
+    u[4] = p[6] * h[6] + p[7] * h[7] + p[8] * h[8] + p[9] * h[9] + p[10] * h[10] + p[11] * h[11];
+    u[5] = p[6] * h[12] + p[7] * h[13] + p[8] * h[14] + p[9] * h[15] + p[10] * h[16] + p[11] * h[17];
+    u[6] = p[12] * h[0] + p[13] * h[1] + p[14] * h[2] + p[15] * h[3] + p[16] * h[4] + p[17] * h[5];
+    u[7] = p[12] * h[6] + p[13] * h[7] + p[14] * h[8] + p[15] * h[9] + p[16] * h[10] + p[17] * h[11];
+    u[8] = p[12] * h[12] + p[13] * h[13] + p[14] * h[14] + p[15] * h[15] + p[16] * h[16] + p[17] * h[17];
+    u[9] = p[18] * h[0] + p[19] * h[1] + p[20] * h[2] + p[21] * h[3] + p[22] * h[4] + p[23] * h[5];
+    u[10] = p[18] * h[6] + p[19] * h[7] + p[20] * h[8] + p[21] * h[9] + p[22] * h[10] + p[23] * h[11];
+    u[11] = p[18] * h[12] + p[19] * h[13] + p[20] * h[14] + p[21] * h[15] + p[22] * h[16] + p[23] * h[17];
+    u[12] = p[24] * h[0] + p[25] * h[1] + p[26] * h[2] + p[27] * h[3] + p[28] * h[4] + p[29] * h[5];
+    u[13] = p[24] * h[6] + p[25] * h[7] + p[26] * h[8] + p[27] * h[9] + p[28] * h[10] + p[29] * h[11];
+    u[14] = p[24] * h[12] + p[25] * h[13] + p[26] * h[14] + p[27] * h[15] + p[28] * h[16] + p[29] * h[17];
+    u[15] = p[30] * h[0] + p[31] * h[1] + p[32] * h[2] + p[33] * h[3] + p[34] * h[4] + p[35] * h[5];
+    u[16] = p[30] * h[6] + p[31] * h[7] + p[32] * h[8] + p[33] * h[9] + p[34] * h[10] + p[35] * h[11];
+    u[17] = p[30] * h[12] + p[31] * h[13] + p[32] * h[14] + p[33] * h[15] + p[34] * h[16] + p[35] * h[17];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[3] + h[2] * u[6] + h[3] * u[9] + h[4] * u[12] + h[5] * u[15] + r[0];
+    s[3] = h[6] * u[0] + h[7] * u[3] + h[8] * u[6] + h[9] * u[9] + h[10] * u[12] + h[11] * u[15] + r[3];
+    s[4] = h[6] * u[1] + h[7] * u[4] + h[8] * u[7] + h[9] * u[10] + h[10] * u[13] + h[11] * u[16] + r[4];
+    s[6] = h[12] * u[0] + h[13] * u[3] + h[14] * u[6] + h[15] * u[9] + h[16] * u[12] + h[17] * u[15] + r[6];
+    s[7] = h[12] * u[1] + h[13] * u[4] + h[14] * u[7] + h[15] * u[10] + h[16] * u[13] + h[17] * u[16] + r[7];
+    s[8] = h[12] * u[2] + h[13] * u[5] + h[14] * u[8] + h[15] * u[11] + h[16] * u[14] + h[17] * u[17] + r[8];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[3] = s[3] * inv[0];
+    s[6] = s[6] * inv[0];
+    pivot = s[4] - (s[3] * s[3]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[4] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[4];
+    s[7] = (s[7] - (s[6] * s[3])) * inv[1];
+    pivot = s[8] - (s[6] * s[6] + s[7] * s[7]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[8] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / s[8];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[3])) * inv[1];
+    u[2] = (u[2] - (u[0] * s[6] + u[1] * s[7])) * inv[2];
+    u[3] = u[3] * inv[0];
+    u[4] = (u[4] - (u[3] * s[3])) * inv[1];
+    u[5] = (u[5] - (u[3] * s[6] + u[4] * s[7])) * inv[2];
+    u[6] = u[6] * inv[0];
+    u[7] = (u[7] - (u[6] * s[3])) * inv[1];
+    u[8] = (u[8] - (u[6] * s[6] + u[7] * s[7])) * inv[2];
+    u[9] = u[9] * inv[0];
+    u[10] = (u[10] - (u[9] * s[3])) * inv[1];
+    u[11] = (u[11] - (u[9] * s[6] + u[10] * s[7])) * inv[2];
+    u[12] = u[12] * inv[0];
+    u[13] = (u[13] - (u[12] * s[3])) * inv[1];
+    u[14] = (u[14] - (u[12] * s[6] + u[13] * s[7])) * inv[2];
+    u[15] = u[15] * inv[0];
+    u[16] = (u[16] - (u[15] * s[3])) * inv[1];
+    u[17] = (u[17] - (u[15] * s[6] + u[16] * s[7])) * inv[2];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[3] * v[0])) * inv[1];
+    v[2] = (y[2] - (s[6] * v[0] + s[7] * v[1])) * inv[2];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+        x[1] += u[3] * v[0] + u[4] * v[1] + u[5] * v[2];
+        x[2] += u[6] * v[0] + u[7] * v[1] + u[8] * v[2];
+        x[3] += u[9] * v[0] + u[10] * v[1] + u[11] * v[2];
+        x[4] += u[12] * v[0] + u[13] * v[1] + u[14] * v[2];
+        x[5] += u[15] * v[0] + u[16] * v[1] + u[17] * v[2];
+        p[0] -= u[0] * u[0] + u[1] * u[1] + u[2] * u[2];
+        p[1] -= u[0] * u[3] + u[1] * u[4] + u[2] * u[5];
+        p[2] -= u[0] * u[6] + u[1] * u[7] + u[2] * u[8];
+        p[3] -= u[0] * u[9] + u[1] * u[10] + u[2] * u[11];
+        p[4] -= u[0] * u[12] + u[1] * u[13] + u[2] * u[14];
+        p[5] -= u[0] * u[15] + u[1] * u[16] + u[2] * u[17];
+        p[7] -= u[3] * u[3] + u[4] * u[4] + u[5] * u[5];
+        p[8] -= u[3] * u[6] + u[4] * u[7] + u[5] * u[8];
+        p[9] -= u[3] * u[9] + u[4] * u[10] + u[5] * u[11];
+        p[10] -= u[3] * u[12] + u[4] * u[13] + u[5] * u[14];
+        p[11] -= u[3] * u[15] + u[4] * u[16] + u[5] * u[17];
+        p[14] -= u[6] * u[6] + u[7] * u[7] + u[8] * u[8];
+        p[15] -= u[6] * u[9] + u[7] * u[10] + u[8] * u[11];
+        p[16] -= u[6] * u[12] + u[7] * u[13] + u[8] * u[14];
+        p[17] -= u[6] * u[15] + u[7] * u[16] + u[8] * u[17];
+        p[21] -= u[9] * u[9] + u[10] * u[10] + u[11] * u[11];
+        p[22] -= u[9] * u[12] + u[10] * u[13] + u[11] * u[14];
+        p[23] -= u[9] * u[15] + u[10] * u[16] + u[11] * u[17];
+        p[28] -= u[12] * u[12] + u[13] * u[13] + u[14] * u[14];
+        p[29] -= u[12] * u[15] + u[13] * u[16] + u[14] * u[17];
+        p[35] -= u[15] * u[15] + u[16] * u[16] + u[17] * u[17];
+
+        p[6] = p[1];
+        p[12] = p[2];
+        p[18] = p[3];
+        p[24] = p[4];
+        p[30] = p[5];
+        p[13] = p[8];
+        p[19] = p[9];
+        p[25] = p[10];
+        p[31] = p[11];
+        p[20] = p[15];
+        p[26] = p[16];
+        p[32] = p[17];
+        p[27] = p[22];
+        p[33] = p[23];
+        p[34] = p[29];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update8x4(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[32];
+    float32 s[16];
+    float32 v[4];
+    float32 inv[4];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3] + p[4] * h[4] + p[5] * h[5] + p[6] * h[6]
+         + p[7] * h[7];
+    u[1] = p[0] * h[8] + p[1] * h[9] + p[2] * h[10] + p[3] * h[11] + p[4] * h[12] + p[5] * h[13]
+         + p[6] * h[14] + p[7] * h[15];
+    u[2] = p[0] * h[16] + p[1] * h[17] + p[2] * h[18] + p[3] * h[19] + p[4] * h[20] + p[5] * h[21]
+         + p[6] * h[22] + p[7] * h[23];
+    u[3] = p[0] * h[24] + p[1] * h[25] + p[2] * h[26] + p[3] * h[27] + p[4] * h[28] + p[5] * h[29]
+         + p[6] * h[30] + p[7] * h[31];
+    u[4] = p[8] * h[0] + p[9] * h[1] + p[10] * h[2] + p[11] * h[3] + p[12] * h[4] + p[13] * h[5]
+         + p[14] * h[6] + p[15] * h[7];
+    u[5] = p[8] * h[8] + p[9] * h[9] + p[10] * h[10] + p[11] * h[11] + p[12] * h[12] + p[13] * h[13]
+         + p[14] * h[14] + p[15] * h[15];
+    u[6] = p[8] * h[16] + p[9] * h[17] + p[10] * h[18] + p[11] * h[19] + p[12] * h[20] + p[13] * h[21]
+         + p[14] * h[22] + p[15] * h[23];
+    u[7] = p[8] * h[24] + p[9] * h[25] + p[10] * h[26] + p[11] * h[27] + p[12] * h[28] + p[13] * h[29]
+         + p[14] * h[30] + p[15] * h[31];
+    u[8] = p[16] * h[0] + p[17] * h[1] + p[18] * h[2] + p[19] * h[3] + p[20] * h[4] + p[21] * h[5]
+         + p[22] * h[6] + p[23] * h[7];
+    u[9] = p[16] * h[8] + p[17] * h[9] + p[18] * h[10] + p[19] * h[11] + p[20] * h[12] + p[21] * h[13]
+         + p[22] * h[14] + p[23] * h[15];
+    u[10] = p[16] * h[16] + p[17] * h[17] + p[18] * h[18] + p[19] * h[19] + p[20] * h[20] + p[21] * h[21]
+          + p[22] * h[22] + p[23] * h[23];
+    u[11] = p[16] * h[24] + p[17] * h[25] + p[18] * h[26] + p[19] * h[27] + p[20] * h[28] + p[21] * h[29]
+          + p[22] * h[30] + p[23] * h[31];
+    u[12] = p[24] * h[0] + p[25] * h[1] + p[26] * h[2] + p[27] * h[3] + p[28] * h[4] + p[29] * h[5]
+          + p[30] * h[6] + p[31] * h[7];
+    u[13] = p[24] * h[8] + p[25] * h[9] + p[26] * h[10] + p[27] * h[11] + p[28] * h[12] + p[29] * h[13]
+          + p[30] * h[14] + p[31] * h[15];
+    u[14] = p[24] * h[16] + p[25] * h[17] + p[26] * h[18] + p[27] * h[19] + p[28] * h[20] + p[29] * h[21]
+          + p[30] * h[22] + p[31] * h[23];
+    u[15] = p[24] * h[24] + p[25] * h[25] + p[26] * h[26] + p[27] * h[27] + p[28] * h[28] + p[29] * h[29]
+          + p[30] * h[30] + p[31] * h[31];
+    u[16] = p[32] * h[0] + p[33] * h[1] + p[34] * h[2] + p[35] * h[3] + p[36] * h[4] + p[37] * h[5]
+          + p[38] * h[6] + p[39] * h[7];
+    u[17] = p[32] * h[8] + p[33] * h[9] + p[34] * h[10] + p[35] * h[11] + p[36] * h[12] + p[37] * h[13]
+          + p[38] * h[14] + p[39] * h[15];
+    u[18] = p[32] * h[16] + p[33] * h[17] + p[34] * h[18] + p[35] * h[19] + p[36] * h[20] + p[37] * h[21]
+          + p[38] * h[22] + p[39] * h[23];
+    u[19] = p[32] * h[24] + p[33] * h[25] + p[34] * h[26] + p[35] * h[27] + p[36] * h[28] + p[37] * h[29]
+          + p[38] * h[30] + p[39] * h[31];
+    u[20] = p[40] * h[0] + p[41] * h[1] + p[42] * h[2] + p[43] * h[3] + p[44] * h[4] + p[45] * h[5]
+          + p[46] * h[6] + p[47] * h[7];
+    u[21] = p[40] * h[8] + p[41] * h[9] + p[42] * h[10] + p[43] * h[11] + p[44] * h[12] + p[45] * h[13]
+          + p[46] * h[14] + p[47] * h[15];
+    u[22] = p[40] * h[16] + p[41] * h[17] + p[42] * h[18] + p[43] * h[19] + p[44] * h[20] + p[45] * h[21]
+          + p[46] * h[22] + p[47] * h[23];
+    u[23] = p[40] * h[24] + p[41] * h[25] + p[42] * h[26] + p[43] * h[27] + p[44] * h[28] + p[45] * h[29]
+          + p[46] * h[30] + p[47] * h[31];
+    u[24] = p[48] * h[0] + p[49] * h[1] + p[50] * h[2] + p[51] * h[3] + p[52] * h[4] + p[53] * h[5]
+          + p[54] * h[6] + p[55] * h[7];
+    u[25] = p[48] * h[8] + p[49] * h[9] + p[50] * h[10] + p[51] * h[11] + p[52] * h[12] + p[53] * h[13]
+          + p[54] * h[14] + p[55] * h[15];
+    u[26] = p[48] * h[16] + p[49] * h[17] + p[50] * h[18] + p[51] * h[19] + p[52] * h[20] + p[53] * h[21]
+          + p[54] * h[22] + p[55] * h[23];
+    u[27] = p[48] * h[24] + p[49] * h[25] + p[50] * h[26] + p[51] * h[27] + p[52] * h[28] + p[53] * h[29]
+          + p[54] * h[30] + p[55] * h[31];
+    u[28] = p[56] * h[0] + p[57] * h[1] + p[58] * h[2] + p[59] * h[3] + p[60] * h[4] + p[61] * h[5]
+          + p[62] * h[6] + p[63] * h[7];
+    u[29] = p[56] * h[8] + p[57] * h[9] + p[58] * h[10] + p[59] * h[11] + p[60] * h[12] + p[61] * h[13]
+          + p[62] * h[14] + p[63] * h[15];
+    u[30] = p[56] * h[16] + p[57] * h[17] + p[58] * h[18] + p[59] * h[19] + p[60] * h[20] + p[61] * h[21]
+          + p[62] * h[22] + p[63] * h[23];
+    u[31] = p[56] * h[24] + p[57] * h[25] + p[58] * h[26] + p[59] * h[27] + p[60] * h[28] + p[61] * h[29]
+          + p[62] * h[30] + p[63] * h[31];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[4] + h[2] * u[8] + h[3] * u[12] + h[4] * u[16] + h[5] * u[20] + h[6] * u[24]
+         + h[7] * u[28] + r[0];
+    s[4] = h[8] * u[0] + h[9] * u[4] + h[10] * u[8] + h[11] * u[12] + h[12] * u[16] + h[13] * u[20]
+         + h[14] * u[24] + h[15] * u[28] + r[4];
+    s[5] = h[8] * u[1] + h[9] * u[5] + h[10] * u[9] + h[11] * u[13] + h[12] * u[17] + h[13] * u[21]
+         + h[14] * u[25] + h[15] * u[29] + r[5];
+    s[8] = h[16] * u[0] + h[17] * u[4] + h[18] * u[8] + h[19] * u[12] + h[20] * u[16] + h[21] * u[20]
+         + h[22] * u[24] + h[23] * u[28] + r[8];
+    s[9] = h[16] * u[1] + h[17] * u[5] + h[18] * u[9] + h[19] * u[13] + h[20] * u[17] + h[21] * u[21]
+         + h[22] * u[25] + h[23] * u[29] + r[9];
+    s[10] = h[16] * u[2] + h[17] * u[6] + h[18] * u[10] + h[19] * u[14] + h[20] * u[18] + h[21] * u[22]
+          + h[22] * u[26] + h[23] * u[30] + r[10];
+    s[12] = h[24] * u[0] + h[25] * u[4] + h[26] * u[8] + h[27] * u[12] + h[28] * u[16] + h[29] * u[20]
+          + h[30] * u[24] + h[31] * u[28] + r[12];
+    s[13] = h[24] * u[1] + h[25] * u[5] + h[26] * u[9] + h[27] * u[13] + h[28] * u[17] + h[29] * u[21]
+          + h[30] * u[25] + h[31] * u[29] + r[13];
+    s[14] = h[24] * u[2] + h[25] * u[6] + h[26] * u[10] + h[27] * u[14] + h[28] * u[18] + h[29] * u[22]
+          + h[30] * u[26] + h[31] * u[30] + r[14];
+    s[15] = h[24] * u[3] + h[25] * u[7] + h[26] * u[11] + h[27] * u[15] + h[28] * u[19] + h[29] * u[23]
+          + h[30] * u[27] + h[31] * u[31] + r[15];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[4] = s[4] * inv[0];
+    s[8] = s[8] * inv[0];
+    s[12] = s[12] * inv[0];
+    pivot = s[5] - (s[4] * s[4]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[5] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[5];
+    s[9] = (s[9] - (s[8] * s[4])) * inv[1];
+    s[13] = (s[13] - (s[12] * s[4])) * inv[1];
+    pivot = s[10] - (s[8] * s[8] + s[9] * s[9]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[10] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / s[10];
+    s[14] = (s[14] - (s[12] * s[8] + s[13] * s[9])) * inv[2];
+    pivot = s[15] - (s[12] * s[12] + s[13] * s[13] + s[14] * s[14]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[15] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / s[15];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[4])) * inv[1];
+    u[2] = (u[2] - (u[0] * s[8] + u[1] * s[9])) * inv[2];
+    u[3] = (u[3] - (u[0] * s[12] + u[1] * s[13] + u[2] * s[14])) * inv[3];
+    u[4] = u[4] * inv[0];
+    u[5] = (u[5] - (u[4] * s[4])) * inv[1];
+    u[6] = (u[6] - (u[4] * s[8] + u[5] * s[9])) * inv[2];
+    u[7] = (u[7] - (u[4] * s[12] + u[5] * s[13] + u[6] * s[14])) * inv[3];
+    u[8] = u[8] * inv[0];
+    u[9] = (u[9] - (u[8] * s[4])) * inv[1];
+    u[10] = (u[10] - (u[8] * s[8] + u[9] * s[9])) * inv[2];
+    u[11] = (u[11] - (u[8] * s[12] + u[9] * s[13] + u[10] * s[14])) * inv[3];
+    u[12] = u[12] * inv[0];
+    u[13] = (u[13] - (u[12] * s[4])) * inv[1];
+    u[14] = (u[14] - (u[12] * s[8] + u[13] * s[9])) * inv[2];
+    u[15] = (u[15] - (u[12] * s[12] + u[13] * s[13] + u[14] * s[14])) * inv[3];
+    u[16] = u[16] * inv[0];
+    u[17] = (u[17] - (u[16] * s[4])) * inv[1];
+    u[18] = (u[18] - (u[16] * s[8] + u[17] * s[9])) * inv[2];
+    u[19] = (u[19] - (u[16] * s[12] + u[17] * s[13] + u[18] * s[14])) * inv[3];
+    u[20] = u[20] * inv[0];
+    u[21] = (u[21] - (u[20] * s[4])) * inv[1];
+    u[22] = (u[22] - (u[20] * s[8] + u[21] * s[9])) * inv[2];
+    u[23] = (u[23] - (u[20] * s[12] + u[21] * s[13] + u[22] * s[14])) * inv[3];
+    u[24] = u[24] * inv[0];
+    u[25] = (u[25] - (u[24] * s[4])) * inv[1];
+    u[26] = (u[26] - (u[24] * s[8] + u[25] * s[9])) * inv[2];
+    u[27] = (u[27] - (u[24] * s[12] + u[25] * s[13] + u[26] * s[14])) * inv[3];
+    u[28] = u[28] * inv[0];
+    u[29] = (u[29] - (u[28] * s[4])) * inv[1];
+    u[30] = (u[30] - (u[28] * s[8] + u[29] * s[9])) * inv[2];
+    u[31] = (u[31] - (u[28] * s[12] + u[29] * s[13] + u[30] * s[14])) * inv[3];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[4] * v[0])) * inv[1];
+    v[2] = (y[2] - (s[8] * v[0] + s[9] * v[1])) * inv[2];
+    v[3] = (y[3] - (s[12] * v[0] + s[13] * v[1] + s[14] * v[2])) * inv[3];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1] + u[2] * v[2] + u[3] * v[3];
+        x[1] += u[4] * v[0] + u[5] * v[1] + u[6] * v[2] + u[7] * v[3];
+        x[2] += u[8] * v[0] + u[9] * v[1] + u[10] * v[2] + u[11] * v[3];
+        x[3] += u[12] * v[0] + u[13] * v[1] + u[14] * v[2] + u[15] * v[3];
+        x[4] += u[16] * v[0] + u[17] * v[1] + u[18] * v[2] + u[19] * v[3];
+        x[5] += u[20] * v[0] + u[21] * v[1] + u[22] * v[2] + u[23] * v[3];
+        x[6] += u[24] * v[0] + u[25] * v[1] + u[26] * v[2] + u[27] * v[3];
+        x[7] += u[28] * v[0] + u[29] * v[1] + u[30] * v[2] + u[31] * v[3];
+        p[0] -= u[0] * u[0] + u[1] * u[1] + u[2] * u[2] + u[3] * u[3];
+        p[1] -= u[0] * u[4] + u[1] * u[5] + u[2] * u[6] + u[3] * u[7];
+        p[2] -= u[0] * u[8] + u[1] * u[9] + u[2] * u[10] + u[3] * u[11];
+        p[3] -= u[0] * u[12] + u[1] * u[13] + u[2] * u[14] + u[3] * u[15];
+        p[4] -= u[0] * u[16] + u[1] * u[17] + u[2] * u[18] + u[3] * u[19];
+        p[5] -= u[0] * u[20] + u[1] * u[21] + u[2] * u[22] + u[3] * u[23];
+        p[6] -= u[0] * u[24] + u[1] * u[25] + u[2] * u[26] + u[3] * u[27];
+        p[7] -= u[0] * u[28] + u[1] * u[29] + u[2] * u[30] + u[3] * u[31];
+        p[9] -= u[4] * u[4] + u[5] * u[5] + u[6] * u[6] + u[7] * u[7];
+        p[10] -= u[4] * u[8] + u[5] * u[9] + u[6] * u[10] + u[7] * u[11];
+        p[11] -= u[4] * u[12] + u[5] * u[13] + u[6] * u[14] + u[7] * u[15];
+        p[12] -= u[4] * u[16] + u[5] * u[17] + u[6] * u[18] + u[7] * u[19];
+        p[13] -= u[4] * u[20] + u[5] * u[21] + u[6] * u[22] + u[7] * u[23];
+        p[14] -= u[4] * u[24] + u[5] * u[25] + u[6] * u[26] + u[7] * u[27];
+        p[15] -= u[4] * u[28] + u[5] * u[29] + u[6] * u[30] + u[7] * u[31];
+        p[18] -= u[8] * u[8] + u[9] * u[9] + u[10] * u[10] + u[11] * u[11];
+        p[19] -= u[8] * u[12] + u[9] * u[13] + u[10] * u[14] + u[11] * u[15];
+        p[20] -= u[8] * u[16] + u[9] * u[17] + u[10] * u[18] + u[11] * u[19];
+        p[21] -= u[8] * u[20] + u[9] * u[21] + u[10] * u[22] + u[11] * u[23];
+        p[22] -= u[8] * u[24] + u[9] * u[25] + u[10] * u[26] + u[11] * u[27];
+        p[23] -= u[8] * u[28] + u[9] * u[29] + u[10] * u[30] + u[11] * u[31];
+        p[27] -= u[12] * u[12] + u[13] * u[13] + u[14] * u[14] + u[15] * u[15];
+        p[28] -= u[12] * u[16] + u[13] * u[17] + u[14] * u[18] + u[15] * u[19];
+        p[29] -= u[12] * u[20] + u[13] * u[21] + u[14] * u[22] + u[15] * u[23];
+        p[30] -= u[12] * u[24] + u[13] * u[25] + u[14] * u[26] + u[15] * u[27];
+        p[31] -= u[12] * u[28] + u[13] * u[29] + u[14] * u[30] + u[15] * u[31];
+        p[36] -= u[16] * u[16] + u[17] * u[17] + u[18] * u[18] + u[19] * u[19];
+        p[37] -= u[16] * u[20] + u[17] * u[21] + u[18] * u[22] + u[19] * u[23];
+        p[38] -= u[16] * u[24] + u[17] * u[25] + u[18] * u[26] + u[19] * u[27];
+        p[39] -= u[16] * u[28] + u[17] * u[29] + u[18] * u[30] + u[19] * u[31];
+        p[45] -= u[20] * u[20] + u[21] * u[21] + u[22] * u[22] + u[23] * u[23];
+        p[46] -= u[20] * u[24] + u[21] * u[25] + u[22] * u[26] + u[23] * u[27];
+        p[47] -= u[20] * u[28] + u[21] * u[29] + u[22] * u[30] + u[23] * u[31];
+        p[54] -= u[24] * u[24] + u[25] * u[25] + u[26] * u[26] + u[27] * u[27];
+        p[55] -= u[24] * u[28] + u[25] * u[29] + u[26] * u[30] + u[27] * u[31];
+        p[63] -= u[28] * u[28] + u[29] * u[29] + u[30] * u[30] + u[31] * u[31];
+
+        p[8] = p[1];
+        p[16] = p[2];
+        p[24] = p[3];
+        p[32] = p[4];
+        p[40] = p[5];
+        p[48] = p[6];
+        p[56] = p[7];
+        p[17] = p[10];
+        p[25] = p[11];
+        p[33] = p[12];
+        p[41] = p[13];
+        p[49] = p[14];
+        p[57] = p[15];
+        p[26] = p[19];
+        p[34] = p[20];
+        p[42] = p[21];
+        p[50] = p[22];
+        p[58] = p[23];
+        p[35] = p[28];
+        p[43] = p[29];
+        p[51] = p[30];
+        p[59] = p[31];
+        p[44] = p[37];
+        p[52] = p[38];
+        p[60] = p[39];
+        p[53] = p[46];
+        p[61] = p[47];
+        p[62] = p[55];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update9x3(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[27];
+    float32 s[9];
+    float32 v[3];
+    float32 inv[3];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3] + p[4] * h[4] + p[5] * h[5] + p[6] * h[6]
+         + p[7] * h[7] + p[8] * h[8];
+    u[1] = p[0] * h[9] + p[1] * h[10] + p[2] * h[11] + p[3] * h[12] + p[4] * h[13] + p[5] * h[14]
+         + p[6] * h[15] + p[7] * h[16] + p[8] * h[17];
+    u[2] = p[0] * h[18] + p[1] * h[19] + p[2] * h[20] + p[3] * h[21] + p[4] * h[22] + p[5] * h[23]
+         + p[6] * h[24] + p[7] * h[25] + p[8] * h[26];
+    u[3] = p[9] * h[0] + p[10] * h[1] + p[11] * h[2] + p[12] * h[3] + p[13] * h[4] + p[14] * h[5]
+         + p[15] * h[6] + p[16] * h[7] + p[17] * h[8];
+    u[4] = p[9] * h[9] + p[10] * h[10] + p[11] * h[11] + p[12] * h[12] + p[13] * h[13] + p[14] * h[14]
+         + p[15] * h[15] + p[16] * h[16] + p[17] * h[17];
+    u[5] = p[9] * h[18] + p[10] * h[19] + p[11] * h[20] + p[12] * h[21] + p[13] * h[22] + p[14] * h[23]
+         + p[15] * h[24] + p[16] * h[25] + p[17] * h[26];
+    u[6] = p[18] * h[0] + p[19] * h[1] + p[20] * h[2] + p[21] * h[3] + p[22] * h[4] + p[23] * h[5]
+         + p[24] * h[6] + p[25] * h[7] + p[26] * h[8];
+    u[7] = p[18] * h[9] + p[19] * h[10] + p[20] * h[11] + p[21] * h[12] + p[22] * h[13] + p[23] * h[14]
+         + p[24] * h[15] + p[25] * h[16] + p[26] * h[17];
+    u[8] = p[18] * h[18] + p[19] * h[19] + p[20] * h[20] + p[21] * h[21] + p[22] * h[22] + p[23] * h[23]
+         + p[24] * h[24] + p[25] * h[25] + p[26] * h[26];
+    u[9] = p[27] * h[0] + p[28] * h[1] + p[29] * h[2] + p[30] * h[3] + p[31] * h[4] + p[32] * h[5]
+         + p[33] * h[6] + p[34] * h[7] + p[35] * h[8];
+    u[10] = p[27] * h[9] + p[28] * h[10] + p[29] * h[11] + p[30] * h[12] + p[31] * h[13] + p[32] * h[14]
+          + p[33] * h[15] + p[34] * h[16] + p[35] * h[17];
+    u[11] = p[27] * h[18] + p[28] * h[19] + p[29] * h[20] + p[30] * h[21] + p[31] * h[22] + p[32] * h[23]
+          + p[33] * h[24] + p[34] * h[25] + p[35] * h[26];
+    u[12] = p[36] * h[0] + p[37] * h[1] + p[38] * h[2] + p[39] * h[3] + p[40] * h[4] + p[41] * h[5]
+          + p[42] * h[6] + p[43] * h[7] + p[44] * h[8];
+    u[13] = p[36] * h[9] + p[37] * h[10] + p[38] * h[11] + p[39] * h[12] + p[40] * h[13] + p[41] * h[14]
+          + p[42] * h[15] + p[43] * h[16] + p[44] * h[17];
+    u[14] = p[36] * h[18] + p[37] * h[19] + p[38] * h[20] + p[39] * h[21] + p[40] * h[22] + p[41] * h[23]
+          + p[42] * h[24] + p[43] * h[25] + p[44] * h[26];
+    u[15] = p[45] * h[0] + p[46] * h[1] + p[47] * h[2] + p[48] * h[3] + p[49] * h[4] + p[50] * h[5]
+          + p[51] * h[6] + p[52] * h[7] + p[53] * h[8];
+    u[16] = p[45] * h[9] + p[46] * h[10] + p[47] * h[11] + p[48] * h[12] + p[49] * h[13] + p[50] * h[14]
+          + p[51] * h[15] + p[52] * h[16] + p[53] * h[17];
+    u[17] = p[45] * h[18] + p[46] * h[19] + p[47] * h[20] + p[48] * h[21] + p[49] * h[22] + p[50] * h[23]
+          + p[51] * h[24] + p[52] * h[25] + p[53] * h[26];
+    u[18] = p[54] * h[0] + p[55] * h[1] + p[56] * h[2] + p[57] * h[3] + p[58] * h[4] + p[59] * h[5]
+          + p[60] * h[6] + p[61] * h[7] + p[62] * h[8];
+    u[19] = p[54] * h[9] + p[55] * h[10] + p[56] * h[11] + p[57] * h[12] + p[58] * h[13] + p[59] * h[14]
+          + p[60] * h[15] + p[61] * h[16] + p[62] * h[17];
+    u[20] = p[54] * h[18] + p[55] * h[19] + p[56] * h[20] + p[57] * h[21] + p[58] * h[22] + p[59] * h[23]
+          + p[60] * h[24] + p[61] * h[25] + p[62] * h[26];
+    u[21] = p[63] * h[0] + p[64] * h[1] + p[65] * h[2] + p[66] * h[3] + p[67] * h[4] + p[68] * h[5]
+          + p[69] * h[6] + p[70] * h[7] + p[71] * h[8];
+    u[22] = p[63] * h[9] + p[64] * h[10] + p[65] * h[11] + p[66] * h[12] + p[67] * h[13] + p[68] * h[14]
+          + p[69] * h[15] + p[70] * h[16] + p[71] * h[17];
+    u[23] = p[63] * h[18] + p[64] * h[19] + p[65] * h[20] + p[66] * h[21] + p[67] * h[22] + p[68] * h[23]
+          + p[69] * h[24] + p[70] * h[25] + p[71] * h[26];
+    u[24] = p[72] * h[0] + p[73] * h[1] + p[74] * h[2] + p[75] * h[3] + p[76] * h[4] + p[77] * h[5]
+          + p[78] * h[6] + p[79] * h[7] + p[80] * h[8];
+    u[25] = p[72] * h[9] + p[73] * h[10] + p[74] * h[11] + p[75] * h[12] + p[76] * h[13] + p[77] * h[14]
+          + p[78] * h[15] + p[79] * h[16] + p[80] * h[17];
+    u[26] = p[72] * h[18] + p[73] * h[19] + p[74] * h[20] + p[75] * h[21] + p[76] * h[22] + p[77] * h[23]
+          + p[78] * h[24] + p[79] * h[25] + p[80] * h[26];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[3] + h[2] * u[6] + h[3] * u[9] + h[4] * u[12] + h[5] * u[15] + h[6] * u[18]
+         + h[7] * u[21] + h[8] * u[24] + r[0];
+    s[3] = h[9] * u[0] + h[10] * u[3] + h[11] * u[6] + h[12] * u[9] + h[13] * u[12] + h[14] * u[15]
+         + h[15] * u[18] + h[16] * u[21] + h[17] * u[24] + r[3];
+    s[4] = h[9] * u[1] + h[10] * u[4] + h[11] * u[7] + h[12] * u[10] + h[13] * u[13] + h[14] * u[16]
+         + h[15] * u[19] + h[16] * u[22] + h[17] * u[25] + r[4];
+    s[6] = h[18] * u[0] + h[19] * u[3] + h[20] * u[6] + h[21] * u[9] + h[22] * u[12] + h[23] * u[15]
+         + h[24] * u[18] + h[25] * u[21] + h[26] * u[24] + r[6];
+    s[7] = h[18] * u[1] + h[19] * u[4] + h[20] * u[7] + h[21] * u[10] + h[22] * u[13] + h[23] * u[16]
+         + h[24] * u[19] + h[25] * u[22] + h[26] * u[25] + r[7];
+    s[8] = h[18] * u[2] + h[19] * u[5] + h[20] * u[8] + h[21] * u[11] + h[22] * u[14] + h[23] * u[17]
+         + h[24] * u[20] + h[25] * u[23] + h[26] * u[26] + r[8];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[3] = s[3] * inv[0];
+    s[6] = s[6] * inv[0];
+    pivot = s[4] - (s[3] * s[3]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[4] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[4];
+    s[7] = (s[7] - (s[6] * s[3])) * inv[1];
+    pivot = s[8] - (s[6] * s[6] + s[7] * s[7]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[8] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / s[8];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[3])) * inv[1];
+    u[2] = (u[2] - (u[0] * s[6] + u[1] * s[7])) * inv[2];
+    u[3] = u[3] * inv[0];
+    u[4] = (u[4] - (u[3] * s[3])) * inv[1];
+    u[5] = (u[5] - (u[3] * s[6] + u[4] * s[7])) * inv[2];
+    u[6] = u[6] * inv[0];
+    u[7] = (u[7] - (u[6] * s[3])) * inv[1];
+    u[8] = (u[8] - (u[6] * s[6] + u[7] * s[7])) * inv[2];
+    u[9] = u[9] * inv[0];
+    u[10] = (u[10] - (u[9] * s[3])) * inv[1];
+    u[11] = (u[11] - (u[9] * s[6] + u[10] * s[7])) * inv[2];
+    u[12] = u[12] * inv[0];
+    u[13] = (u[13] - (u[12] * s[3])) * inv[1];
+    u[14] = (u[14] - (u[12] * s[6] + u[13] * s[7])) * inv[2];
+    u[15] = u[15] * inv[0];
+    u[16] = (u[16] - (u[15] * s[3])) * inv[1];
+    u[17] = (u[17] - (u[15] * s[6] + u[16] * s[7])) * inv[2];
+    u[18] = u[18] * inv[0];
+    u[19] = (u[19] - (u[18] * s[3])) * inv[1];
+    u[20] = (u[20] - (u[18] * s[6] + u[19] * s[7])) * inv[2];
+    u[21] = u[21] * inv[0];
+    u[22] = (u[22] - (u[21] * s[3])) * inv[1];
+    u[23] = (u[23] - (u[21] * s[6] + u[22] * s[7])) * inv[2];
+    u[24] = u[24] * inv[0];
+    u[25] = (u[25] - (u[24] * s[3])) * inv[1];
+    u[26] = (u[26] - (u[24] * s[6] + u[25] * s[7])) * inv[2];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[3] * v[0])) * inv[1];
+    v[2] = (y[2] - (s[6] * v[0] + s[7] * v[1])) * inv[2];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+        x[1] += u[3] * v[0] + u[4] * v[1] + u[5] * v[2];
+        x[2] += u[6] * v[0] + u[7] * v[1] + u[8] * v[2];
+        x[3] += u[9] * v[0] + u[10] * v[1] + u[11] * v[2];
+        x[4] += u[12] * v[0] + u[13] * v[1] + u[14] * v[2];
+        x[5] += u[15] * v[0] + u[16] * v[1] + u[17] * v[2];
+        x[6] += u[18] * v[0] + u[19] * v[1] + u[20] * v[2];
+        x[7] += u[21] * v[0] + u[22] * v[1] + u[23] * v[2];
+        x[8] += u[24] * v[0] + u[25] * v[1] + u[26] * v[2];
+        p[0] -= u[0] * u[0] + u[1] * u[1] + u[2] * u[2];
+        p[1] -= u[0] * u[3] + u[1] * u[4] + u[2] * u[5];
+        p[2] -= u[0] * u[6] + u[1] * u[7] + u[2] * u[8];
+        p[3] -= u[0] * u[9] + u[1] * u[10] + u[2] * u[11];
+        p[4] -= u[0] * u[12] + u[1] * u[13] + u[2] * u[14];
+        p[5] -= u[0] * u[15] + u[1] * u[16] + u[2] * u[17];
+        p[6] -= u[0] * u[18] + u[1] * u[19] + u[2] * u[20];
+        p[7] -= u[0] * u[21] + u[1] * u[22] + u[2] * u[23];
+        p[8] -= u[0] * u[24] + u[1] * u[25] + u[2] * u[26];
+        p[10] -= u[3] * u[3] + u[4] * u[4] + u[5] * u[5];
+        p[11] -= u[3] * u[6] + u[4] * u[7] + u[5] * u[8];
+        p[12] -= u[3] * u[9] + u[4] * u[10] + u[5] * u[11];
+        p[13] -= u[3] * u[12] + u[4] * u[13] + u[5] * u[14];
+        p[14] -= u[3] * u[15] + u[4] * u[16] + u[5] * u[17];
+        p[15] -= u[3] * u[18] + u[4] * u[19] + u[5] * u[20];
+        p[16] -= u[3] * u[21] + u[4] * u[22] + u[5] * u[23];
+        p[17] -= u[3] * u[24] + u[4] * u[25] + u[5] * u[26];
+        p[20] -= u[6] * u[6] + u[7] * u[7] + u[8] * u[8];
+        p[21] -= u[6] * u[9] + u[7] * u[10] + u[8] * u[11];
+        p[22] -= u[6] * u[12] + u[7] * u[13] + u[8] * u[14];
+        p[23] -= u[6] * u[15] + u[7] * u[16] + u[8] * u[17];
+        p[24] -= u[6] * u[18] + u[7] * u[19] + u[8] * u[20];
+        p[25] -= u[6] * u[21] + u[7] * u[22] + u[8] * u[23];
+        p[26] -= u[6] * u[24] + u[7] * u[25] + u[8] * u[26];
+        p[30] -= u[9] * u[9] + u[10] * u[10] + u[11] * u[11];
+        p[31] -= u[9] * u[12] + u[10] * u[13] + u[11] * u[14];
+        p[32] -= u[9] * u[15] + u[10] * u[16] + u[11] * u[17];
+        p[33] -= u[9] * u[18] + u[10] * u[19] + u[11] * u[20];
+        p[34] -= u[9] * u[21] + u[10] * u[22] + u[11] * u[23];
+        p[35] -= u[9] * u[24] + u[10] * u[25] + u[11] * u[26];
+        p[40] -= u[12] * u[12] + u[13] * u[13] + u[14] * u[14];
+        p[41] -= u[12] * u[15] + u[13] * u[16] + u[14] * u[17];
+        p[42] -= u[12] * u[18] + u[13] * u[19] + u[14] * u[20];
+        p[43] -= u[12] * u[21] + u[13] * u[22] + u[14] * u[23];
+        p[44] -= u[12] * u[24] + u[13] * u[25] + u[14] * u[26];
+        p[50] -= u[15] * u[15] + u[16] * u[16] + u[17] * u[17];
+        p[51] -= u[15] * u[18] + u[16] * u[19] + u[17] * u[20];
+        p[52] -= u[15] * u[21] + u[16] * u[22] + u[17] * u[23];
+        p[53] -= u[15] * u[24] + u[16] * u[25] + u[17] * u[26];
+        p[60] -= u[18] * u[18] + u[19] * u[19] + u[20] * u[20];
+        p[61] -= u[18] * u[21] + u[19] * u[22] + u[20] * u[23];
+        p[62] -= u[18] * u[24] + u[19] * u[25] + u[20] * u[26];
+        p[70] -= u[21] * u[21] + u[22] * u[22] + u[23] * u[23];
+        p[71] -= u[21] * u[24] + u[22] * u[25] + u[23] * u[26];
+        p[80] -= u[24] * u[24] + u[25] * u[25] + u[26] * u[26];
+
+        p[9] = p[1];
+        p[18] = p[2];
+        p[27] = p[3];
+        p[36] = p[4];
+        p[45] = p[5];
+        p[54] = p[6];
+        p[63] = p[7];
+        p[72] = p[8];
+        p[19] = p[11];
+        p[28] = p[12];
+        p[37] = p[13];
+        p[46] = p[14];
+        p[55] = p[15];
+        p[64] = p[16];
+        p[73] = p[17];
+        p[29] = p[21];
+        p[38] = p[22];
+        p[47] = p[23];
+        p[56] = p[24];
+        p[65] = p[25];
+        p[74] = p[26];
+        p[39] = p[31];
+        p[48] = p[32];
+        p[57] = p[33];
+        p[66] = p[34];
+        p[75] = p[35];
+        p[49] = p[41];
+        p[58] = p[42];
+        p[67] = p[43];
+        p[76] = p[44];
+        p[59] = p[51];
+        p[68] = p[52];
+        p[77] = p[53];
+        p[69] = p[61];
+        p[78] = p[62];
+        p[79] = p[71];
+    }
+
+    return ok;
+}
+
+
+boolean Ifx_KalmanF32_update12x6(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)
+{
+    float32 u[72];
+    float32 s[36];
+    float32 v[6];
+    float32 inv[6];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    /* u = p * h' */
+    u[0] = p[0] * h[0] + p[1] * h[1] + p[2] * h[2] + p[3] * h[3] + p[4] * h[4] + p[5] * h[5] + p[6] * h[6]
+         + p[7] * h[7] + p[8] * h[8] + p[9] * h[9] + p[10] * h[10] + p[11] * h[11];
+    u[1] = p[0] * h[12] + p[1] * h[13] + p[2] * h[14] + p[3] * h[15] + p[4] * h[16] + p[5] * h[17]
+         + p[6] * h[18] + p[7] * h[19] + p[8] * h[20] + p[9] * h[21] + p[10] * h[22] + p[11] * h[23];
+    u[2] = p[0] * h[24] + p[1] * h[25] + p[2] * h[26] + p[3] * h[27] + p[4] * h[28] + p[5] * h[29]
+         + p[6] * h[30] + p[7] * h[31] + p[8] * h[32] + p[9] * h[33] + p[10] * h[34] + p[11] * h[35];
+    u[3] = p[0] * h[36] + p[1] * h[37] + p[2] * h[38] + p[3] * h[39] + p[4] * h[40] + p[5] * h[41]
+         + p[6] * h[42] + p[7] * h[43] + p[8] * h[44] + p[9] * h[45] + p[10] * h[46] + p[11] * h[47];
+    u[4] = p[0] * h[48] + p[1] * h[49] + p[2] * h[50] + p[3] * h[51] + p[4] * h[52] + p[5] * h[53]
+         + p[6] * h[54] + p[7] * h[55] + p[8] * h[56] + p[9] * h[57] + p[10] * h[58] + p[11] * h[59];
+    u[5] = p[0] * h[60] + p[1] * h[61] + p[2] * h[62] + p[3] * h[63] + p[4] * h[64] + p[5] * h[65]
+         + p[6] * h[66] + p[7] * h[67] + p[8] * h[68] + p[9] * h[69] + p[10] * h[70] + p[11] * h[71];
+    u[6] = p[12] * h[0] + p[13] * h[1] + p[14] * h[2] + p[15] * h[3] + p[16] * h[4] + p[17] * h[5]
+         + p[18] * h[6] + p[19] * h[7] + p[20] * h[8] + p[21] * h[9] + p[22] * h[10] + p[23] * h[11];
+    u[7] = p[12] * h[12] + p[13] * h[13] + p[14] * h[14] + p[15] * h[15] + p[16] * h[16] + p[17] * h[17]
+         + p[18] * h[18] + p[19] * h[19] + p[20] * h[20] + p[21] * h[21] + p[22] * h[22] + p[23] * h[23];
+    u[8] = p[12] * h[24] + p[13] * h[25] + p[14] * h[26] + p[15] * h[27] + p[16] * h[28] + p[17] * h[29]
+         + p[18] * h[30] + p[19] * h[31] + p[20] * h[32] + p[21] * h[33] + p[22] * h[34] + p[23] * h[35];
+    u[9] = p[12] * h[36] + p[13] * h[37] + p[14] * h[38] + p[15] * h[39] + p[16] * h[40] + p[17] * h[41]
+         + p[18] * h[42] + p[19] * h[43] + p[20] * h[44] + p[21] * h[45] + p[22] * h[46] + p[23] * h[47];
+    u[10] = p[12] * h[48] + p[13] * h[49] + p[14] * h[50] + p[15] * h[51] + p[16] * h[52] + p[17] * h[53]
+          + p[18] * h[54] + p[19] * h[55] + p[20] * h[56] + p[21] * h[57] + p[22] * h[58] + p[23] * h[59];
+    u[11] = p[12] * h[60] + p[13] * h[61] + p[14] * h[62] + p[15] * h[63] + p[16] * h[64] + p[17] * h[65]
+          + p[18] * h[66] + p[19] * h[67] + p[20] * h[68] + p[21] * h[69] + p[22] * h[70] + p[23] * h[71];
+    u[12] = p[24] * h[0] + p[25] * h[1] + p[26] * h[2] + p[27] * h[3] + p[28] * h[4] + p[29] * h[5]
+          + p[30] * h[6] + p[31] * h[7] + p[32] * h[8] + p[33] * h[9] + p[34] * h[10] + p[35] * h[11];
+    u[13] = p[24] * h[12] + p[25] * h[13] + p[26] * h[14] + p[27] * h[15] + p[28] * h[16] + p[29] * h[17]
+          + p[30] * h[18] + p[31] * h[19] + p[32] * h[20] + p[33] * h[21] + p[34] * h[22] + p[35] * h[23];
+    u[14] = p[24] * h[24] + p[25] * h[25] + p[26] * h[26] + p[27] * h[27] + p[28] * h[28] + p[29] * h[29]
+          + p[30] * h[30] + p[31] * h[31] + p[32] * h[32] + p[33] * h[33] + p[34] * h[34] + p[35] * h[35];
+    u[15] = p[24] * h[36] + p[25] * h[37] + p[26] * h[38] + p[27] * h[39] + p[28] * h[40] + p[29] * h[41]
+          + p[30] * h[42] + p[31] * h[43] + p[32] * h[44] + p[33] * h[45] + p[34] * h[46] + p[35] * h[47];
+    u[16] = p[24] * h[48] + p[25] * h[49] + p[26] * h[50] + p[27] * h[51] + p[28] * h[52] + p[29] * h[53]
+          + p[30] * h[54] + p[31] * h[55] + p[32] * h[56] + p[33] * h[57] + p[34] * h[58] + p[35] * h[59];
+    u[17] = p[24] * h[60] + p[25] * h[61] + p[26] * h[62] + p[27] * h[63] + p[28] * h[64] + p[29] * h[65]
+          + p[30] * h[66] + p[31] * h[67] + p[32] * h[68] + p[33] * h[69] + p[34] * h[70] + p[35] * h[71];
+    u[18] = p[36] * h[0] + p[37] * h[1] + p[38] * h[2] + p[39] * h[3] + p[40] * h[4] + p[41] * h[5]
+          + p[42] * h[6] + p[43] * h[7] + p[44] * h[8] + p[45] * h[9] + p[46] * h[10] + p[47] * h[11];
+    u[19] = p[36] * h[12] + p[37] * h[13] + p[38] * h[14] + p[39] * h[15] + p[40] * h[16] + p[41] * h[17]
+          + p[42] * h[18] + p[43] * h[19] + p[44] * h[20] + p[45] * h[21] + p[46] * h[22] + p[47] * h[23];
+    u[20] = p[36] * h[24] + p[37] * h[25] + p[38] * h[26] + p[39] * h[27] + p[40] * h[28] + p[41] * h[29]
+          + p[42] * h[30] + p[43] * h[31] + p[44] * h[32] + p[45] * h[33] + p[46] * h[34] + p[47] * h[35];
+    u[21] = p[36] * h[36] + p[37] * h[37] + p[38] * h[38] + p[39] * h[39] + p[40] * h[40] + p[41] * h[41]
+          + p[42] * h[42] + p[43] * h[43] + p[44] * h[44] + p[45] * h[45] + p[46] * h[46] + p[47] * h[47];
+    u[22] = p[36] * h[48] + p[37] * h[49] + p[38] * h[50] + p[39] * h[51] + p[40] * h[52] + p[41] * h[53]
+          + p[42] * h[54] + p[43] * h[55] + p[44] * h[56] + p[45] * h[57] + p[46] * h[58] + p[47] * h[59];
+    u[23] = p[36] * h[60] + p[37] * h[61] + p[38] * h[62] + p[39] * h[63] + p[40] * h[64] + p[41] * h[65]
+          + p[42] * h[66] + p[43] * h[67] + p[44] * h[68] + p[45] * h[69] + p[46] * h[70] + p[47] * h[71];
+    u[24] = p[48] * h[0] + p[49] * h[1] + p[50] * h[2] + p[51] * h[3] + p[52] * h[4] + p[53] * h[5]
+          + p[54] * h[6] + p[55] * h[7] + p[56] * h[8] + p[57] * h[9] + p[58] * h[10] + p[59] * h[11];
+    u[25] = p[48] * h[12] + p[49] * h[13] + p[50] * h[14] + p[51] * h[15] + p[52] * h[16] + p[53] * h[17]
+          + p[54] * h[18] + p[55] * h[19] + p[56] * h[20] + p[57] * h[21] + p[58] * h[22] + p[59] * h[23];
+    u[26] = p[48] * h[24] + p[49] * h[25] + p[50] * h[26] + p[51] * h[27] + p[52] * h[28] + p[53] * h[29]
+          + p[54] * h[30] + p[55] * h[31] + p[56] * h[32] + p[57] * h[33] + p[58] * h[34] + p[59] * h[35];
+    u[27] = p[48] * h[36] + p[49] * h[37] + p[50] * h[38] + p[51] * h[39] + p[52] * h[40] + p[53] * h[41]
+          + p[54] * h[42] + p[55] * h[43] + p[56] * h[44] + p[57] * h[45] + p[58] * h[46] + p[59] * h[47];
+    u[28] = p[48] * h[48] + p[49] * h[49] + p[50] * h[50] + p[51] * h[51] + p[52] * h[52] + p[53] * h[53]
+          + p[54] * h[54] + p[55] * h[55] + p[56] * h[56] + p[57] * h[57] + p[58] * h[58] + p[59] * h[59];
+    u[29] = p[48] * h[60] + p[49] * h[61] + p[50] * h[62] + p[51] * h[63] + p[52] * h[64] + p[53] * h[65]
+          + p[54] * h[66] + p[55] * h[67] + p[56] * h[68] + p[57] * h[69] + p[58] * h[70] + p[59] * h[71];
+    u[30] = p[60] * h[0] + p[61] * h[1] + p[62] * h[2] + p[63] * h[3] + p[64] * h[4] + p[65] * h[5]
+          + p[66] * h[6] + p[67] * h[7] + p[68] * h[8] + p[69] * h[9] + p[70] * h[10] + p[71] * h[11];
+    u[31] = p[60] * h[12] + p[61] * h[13] + p[62] * h[14] + p[63] * h[15] + p[64] * h[16] + p[65] * h[17]
+          + p[66] * h[18] + p[67] * h[19] + p[68] * h[20] + p[69] * h[21] + p[70] * h[22] + p[71] * h[23];
+    u[32] = p[60] * h[24] + p[61] * h[25] + p[62] * h[26] + p[63] * h[27] + p[64] * h[28] + p[65] * h[29]
+          + p[66] * h[30] + p[67] * h[31] + p[68] * h[32] + p[69] * h[33] + p[70] * h[34] + p[71] * h[35];
+    u[33] = p[60] * h[36] + p[61] * h[37] + p[62] * h[38] + p[63] * h[39] + p[64] * h[40] + p[65] * h[41]
+          + p[66] * h[42] + p[67] * h[43] + p[68] * h[44] + p[69] * h[45] + p[70] * h[46] + p[71] * h[47];
+    u[34] = p[60] * h[48] + p[61] * h[49] + p[62] * h[50] + p[63] * h[51] + p[64] * h[52] + p[65] * h[53]
+          + p[66] * h[54] + p[67] * h[55] + p[68] * h[56] + p[69] * h[57] + p[70] * h[58] + p[71] * h[59];
+    u[35] = p[60] * h[60] + p[61] * h[61] + p[62] * h[62] + p[63] * h[63] + p[64] * h[64] + p[65] * h[65]
+          + p[66] * h[66] + p[67] * h[67] + p[68] * h[68] + p[69] * h[69] + p[70] * h[70] + p[71] * h[71];
+    u[36] = p[72] * h[0] + p[73] * h[1] + p[74] * h[2] + p[75] * h[3] + p[76] * h[4] + p[77] * h[5]
+          + p[78] * h[6] + p[79] * h[7] + p[80] * h[8] + p[81] * h[9] + p[82] * h[10] + p[83] * h[11];
+    u[37] = p[72] * h[12] + p[73] * h[13] + p[74] * h[14] + p[75] * h[15] + p[76] * h[16] + p[77] * h[17]
+          + p[78] * h[18] + p[79] * h[19] + p[80] * h[20] + p[81] * h[21] + p[82] * h[22] + p[83] * h[23];
+    u[38] = p[72] * h[24] + p[73] * h[25] + p[74] * h[26] + p[75] * h[27] + p[76] * h[28] + p[77] * h[29]
+          + p[78] * h[30] + p[79] * h[31] + p[80] * h[32] + p[81] * h[33] + p[82] * h[34] + p[83] * h[35];
+    u[39] = p[72] * h[36] + p[73] * h[37] + p[74] * h[38] + p[75] * h[39] + p[76] * h[40] + p[77] * h[41]
+          + p[78] * h[42] + p[79] * h[43] + p[80] * h[44] + p[81] * h[45] + p[82] * h[46] + p[83] * h[47];
+    u[40] = p[72] * h[48] + p[73] * h[49] + p[74] * h[50] + p[75] * h[51] + p[76] * h[52] + p[77] * h[53]
+          + p[78] * h[54] + p[79] * h[55] + p[80] * h[56] + p[81] * h[57] + p[82] * h[58] + p[83] * h[59];
+    u[41] = p[72] * h[60] + p[73] * h[61] + p[74] * h[62] + p[75] * h[63] + p[76] * h[64] + p[77] * h[65]
+          + p[78] * h[66] + p[79] * h[67] + p[80] * h[68] + p[81] * h[69] + p[82] * h[70] + p[83] * h[71];
+    u[42] = p[84] * h[0] + p[85] * h[1] + p[86] * h[2] + p[87] * h[3] + p[88] * h[4] + p[89] * h[5]
+          + p[90] * h[6] + p[91] * h[7] + p[92] * h[8] + p[93] * h[9] + p[94] * h[10] + p[95] * h[11];
+    u[43] = p[84] * h[12] + p[85] * h[13] + p[86] * h[14] + p[87] * h[15] + p[88] * h[16] + p[89] * h[17]
+          + p[90] * h[18] + p[91] * h[19] + p[92] * h[20] + p[93] * h[21] + p[94] * h[22] + p[95] * h[23];
+    u[44] = p[84] * h[24] + p[85] * h[25] + p[86] * h[26] + p[87] * h[27] + p[88] * h[28] + p[89] * h[29]
+          + p[90] * h[30] + p[91] * h[31] + p[92] * h[32] + p[93] * h[33] + p[94] * h[34] + p[95] * h[35];
+    u[45] = p[84] * h[36] + p[85] * h[37] + p[86] * h[38] + p[87] * h[39] + p[88] * h[40] + p[89] * h[41]
+          + p[90] * h[42] + p[91] * h[43] + p[92] * h[44] + p[93] * h[45] + p[94] * h[46] + p[95] * h[47];
+    u[46] = p[84] * h[48] + p[85] * h[49] + p[86] * h[50] + p[87] * h[51] + p[88] * h[52] + p[89] * h[53]
+          + p[90] * h[54] + p[91] * h[55] + p[92] * h[56] + p[93] * h[57] + p[94] * h[58] + p[95] * h[59];
+    u[47] = p[84] * h[60] + p[85] * h[61] + p[86] * h[62] + p[87] * h[63] + p[88] * h[64] + p[89] * h[65]
+          + p[90] * h[66] + p[91] * h[67] + p[92] * h[68] + p[93] * h[69] + p[94] * h[70] + p[95] * h[71];
+    u[48] = p[96] * h[0] + p[97] * h[1] + p[98] * h[2] + p[99] * h[3] + p[100] * h[4] + p[101] * h[5]
+          + p[102] * h[6] + p[103] * h[7] + p[104] * h[8] + p[105] * h[9] + p[106] * h[10] + p[107] * h[11];
+    u[49] = p[96] * h[12] + p[97] * h[13] + p[98] * h[14] + p[99] * h[15] + p[100] * h[16] + p[101] * h[17]
+          + p[102] * h[18] + p[103] * h[19] + p[104] * h[20] + p[105] * h[21] + p[106] * h[22]
+          + p[107] * h[23];
+    u[50] = p[96] * h[24] + p[97] * h[25] + p[98] * h[26] + p[99] * h[27] + p[100] * h[28] + p[101] * h[29]
+          + p[102] * h[30] + p[103] * h[31] + p[104] * h[32] + p[105] * h[33] + p[106] * h[34]
+          + p[107] * h[35];
+    u[51] = p[96] * h[36] + p[97] * h[37] + p[98] * h[38] + p[99] * h[39] + p[100] * h[40] + p[101] * h[41]
+          + p[102] * h[42] + p[103] * h[43] + p[104] * h[44] + p[105] * h[45] + p[106] * h[46]
+          + p[107] * h[47];
+    u[52] = p[96] * h[48] + p[97] * h[49] + p[98] * h[50] + p[99] * h[51] + p[100] * h[52] + p[101] * h[53]
+          + p[102] * h[54] + p[103] * h[55] + p[104] * h[56] + p[105] * h[57] + p[106] * h[58]
+          + p[107] * h[59];
+    u[53] = p[96] * h[60] + p[97] * h[61] + p[98] * h[62] + p[99] * h[63] + p[100] * h[64] + p[101] * h[65]
+          + p[102] * h[66] + p[103] * h[67] + p[104] * h[68] + p[105] * h[69] + p[106] * h[70]
+          + p[107] * h[71];
+    u[54] = p[108] * h[0] + p[109] * h[1] + p[110] * h[2] + p[111] * h[3] + p[112] * h[4] + p[113] * h[5]
+          + p[114] * h[6] + p[115] * h[7] + p[116] * h[8] + p[117] * h[9] + p[118] * h[10] + p[119] * h[11];
+    u[55] = p[108] * h[12] + p[109] * h[13] + p[110] * h[14] + p[111] * h[15] + p[112] * h[16]
+          + p[113] * h[17] + p[114] * h[18] + p[115] * h[19] + p[116] * h[20] + p[117] * h[21]
+          + p[118] * h[22] + p[119] * h[23];
+    u[56] = p[108] * h[24] + p[109] * h[25] + p[110] * h[26] + p[111] * h[27] + p[112] * h[28]
+          + p[113] * h[29] + p[114] * h[30] + p[115] * h[31] + p[116] * h[32] + p[117] * h[33]
+          + p[118] * h[34] + p[119] * h[35];
+    u[57] = p[108] * h[36] + p[109] * h[37] + p[110] * h[38] + p[111] * h[39] + p[112] * h[40]
+          + p[113] * h[41] + p[114] * h[42] + p[115] * h[43] + p[116] * h[44] + p[117] * h[45]
+          + p[118] * h[46] + p[119] * h[47];
+    u[58] = p[108] * h[48] + p[109] * h[49] + p[110] * h[50] + p[111] * h[51] + p[112] * h[52]
+          + p[113] * h[53] + p[114] * h[54] + p[115] * h[55] + p[116] * h[56] + p[117] * h[57]
+          + p[118] * h[58] + p[119] * h[59];
+    u[59] = p[108] * h[60] + p[109] * h[61] + p[110] * h[62] + p[111] * h[63] + p[112] * h[64]
+          + p[113] * h[65] + p[114] * h[66] + p[115] * h[67] + p[116] * h[68] + p[117] * h[69]
+          + p[118] * h[70] + p[119] * h[71];
+    u[60] = p[120] * h[0] + p[121] * h[1] + p[122] * h[2] + p[123] * h[3] + p[124] * h[4] + p[125] * h[5]
+          + p[126] * h[6] + p[127] * h[7] + p[128] * h[8] + p[129] * h[9] + p[130] * h[10] + p[131] * h[11];
+    u[61] = p[120] * h[12] + p[121] * h[13] + p[122] * h[14] + p[123] * h[15] + p[124] * h[16]
+          + p[125] * h[17] + p[126] * h[18] + p[127] * h[19] + p[128] * h[20] + p[129] * h[21]
+          + p[130] * h[22] + p[131] * h[23];
+    u[62] = p[120] * h[24] + p[121] * h[25] + p[122] * h[26] + p[123] * h[27] + p[124] * h[28]
+          + p[125] * h[29] + p[126] * h[30] + p[127] * h[31] + p[128] * h[32] + p[129] * h[33]
+          + p[130] * h[34] + p[131] * h[35];
+    u[63] = p[120] * h[36] + p[121] * h[37] + p[122] * h[38] + p[123] * h[39] + p[124] * h[40]
+          + p[125] * h[41] + p[126] * h[42] + p[127] * h[43] + p[128] * h[44] + p[129] * h[45]
+          + p[130] * h[46] + p[131] * h[47];
+    u[64] = p[120] * h[48] + p[121] * h[49] + p[122] * h[50] + p[123] * h[51] + p[124] * h[52]
+          + p[125] * h[53] + p[126] * h[54] + p[127] * h[55] + p[128] * h[56] + p[129] * h[57]
+          + p[130] * h[58] + p[131] * h[59];
+    u[65] = p[120] * h[60] + p[121] * h[61] + p[122] * h[62] + p[123] * h[63] + p[124] * h[64]
+          + p[125] * h[65] + p[126] * h[66] + p[127] * h[67] + p[128] * h[68] + p[129] * h[69]
+          + p[130] * h[70] + p[131] * h[71];
+    u[66] = p[132] * h[0] + p[133] * h[1] + p[134] * h[2] + p[135] * h[3] + p[136] * h[4] + p[137] * h[5]
+          + p[138] * h[6] + p[139] * h[7] + p[140] * h[8] + p[141] * h[9] + p[142] * h[10] + p[143] * h[11];
+    u[67] = p[132] * h[12] + p[133] * h[13] + p[134] * h[14] + p[135] * h[15] + p[136] * h[16]
+          + p[137] * h[17] + p[138] * h[18] + p[139] * h[19] + p[140] * h[20] + p[141] * h[21]
+          + p[142] * h[22] + p[143] * h[23];
+    u[68] = p[132] * h[24] + p[133] * h[25] + p[134] * h[26] + p[135] * h[27] + p[136] * h[28]
+          + p[137] * h[29] + p[138] * h[30] + p[139] * h[31] + p[140] * h[32] + p[141] * h[33]
+          + p[142] * h[34] + p[143] * h[35];
+    u[69] = p[132] * h[36] + p[133] * h[37] + p[134] * h[38] + p[135] * h[39] + p[136] * h[40]
+          + p[137] * h[41] + p[138] * h[42] + p[139] * h[43] + p[140] * h[44] + p[141] * h[45]
+          + p[142] * h[46] + p[143] * h[47];
+    u[70] = p[132] * h[48] + p[133] * h[49] + p[134] * h[50] + p[135] * h[51] + p[136] * h[52]
+          + p[137] * h[53] + p[138] * h[54] + p[139] * h[55] + p[140] * h[56] + p[141] * h[57]
+          + p[142] * h[58] + p[143] * h[59];
+    u[71] = p[132] * h[60] + p[133] * h[61] + p[134] * h[62] + p[135] * h[63] + p[136] * h[64]
+          + p[137] * h[65] + p[138] * h[66] + p[139] * h[67] + p[140] * h[68] + p[141] * h[69]
+          + p[142] * h[70] + p[143] * h[71];
+
+    /* s = h * u + r, lower triangle */
+    s[0] = h[0] * u[0] + h[1] * u[6] + h[2] * u[12] + h[3] * u[18] + h[4] * u[24] + h[5] * u[30]
+         + h[6] * u[36] + h[7] * u[42] + h[8] * u[48] + h[9] * u[54] + h[10] * u[60] + h[11] * u[66] + r[0];
+    s[6] = h[12] * u[0] + h[13] * u[6] + h[14] * u[12] + h[15] * u[18] + h[16] * u[24] + h[17] * u[30]
+         + h[18] * u[36] + h[19] * u[42] + h[20] * u[48] + h[21] * u[54] + h[22] * u[60] + h[23] * u[66]
+         + r[6];
+    s[7] = h[12] * u[1] + h[13] * u[7] + h[14] * u[13] + h[15] * u[19] + h[16] * u[25] + h[17] * u[31]
+         + h[18] * u[37] + h[19] * u[43] + h[20] * u[49] + h[21] * u[55] + h[22] * u[61] + h[23] * u[67]
+         + r[7];
+    s[12] = h[24] * u[0] + h[25] * u[6] + h[26] * u[12] + h[27] * u[18] + h[28] * u[24] + h[29] * u[30]
+          + h[30] * u[36] + h[31] * u[42] + h[32] * u[48] + h[33] * u[54] + h[34] * u[60] + h[35] * u[66]
+          + r[12];
+    s[13] = h[24] * u[1] + h[25] * u[7] + h[26] * u[13] + h[27] * u[19] + h[28] * u[25] + h[29] * u[31]
+          + h[30] * u[37] + h[31] * u[43] + h[32] * u[49] + h[33] * u[55] + h[34] * u[61] + h[35] * u[67]
+          + r[13];
+    s[14] = h[24] * u[2] + h[25] * u[8] + h[26] * u[14] + h[27] * u[20] + h[28] * u[26] + h[29] * u[32]
+          + h[30] * u[38] + h[31] * u[44] + h[32] * u[50] + h[33] * u[56] + h[34] * u[62] + h[35] * u[68]
+          + r[14];
+    s[18] = h[36] * u[0] + h[37] * u[6] + h[38] * u[12] + h[39] * u[18] + h[40] * u[24] + h[41] * u[30]
+          + h[42] * u[36] + h[43] * u[42] + h[44] * u[48] + h[45] * u[54] + h[46] * u[60] + h[47] * u[66]
+          + r[18];
+    s[19] = h[36] * u[1] + h[37] * u[7] + h[38] * u[13] + h[39] * u[19] + h[40] * u[25] + h[41] * u[31]
+          + h[42] * u[37] + h[43] * u[43] + h[44] * u[49] + h[45] * u[55] + h[46] * u[61] + h[47] * u[67]
+          + r[19];
+    s[20] = h[36] * u[2] + h[37] * u[8] + h[38] * u[14] + h[39] * u[20] + h[40] * u[26] + h[41] * u[32]
+          + h[42] * u[38] + h[43] * u[44] + h[44] * u[50] + h[45] * u[56] + h[46] * u[62] + h[47] * u[68]
+          + r[20];
+    s[21] = h[36] * u[3] + h[37] * u[9] + h[38] * u[15] + h[39] * u[21] + h[40] * u[27] + h[41] * u[33]
+          + h[42] * u[39] + h[43] * u[45] + h[44] * u[51] + h[45] * u[57] + h[46] * u[63] + h[47] * u[69]
+          + r[21];
+    s[24] = h[48] * u[0] + h[49] * u[6] + h[50] * u[12] + h[51] * u[18] + h[52] * u[24] + h[53] * u[30]
+          + h[54] * u[36] + h[55] * u[42] + h[56] * u[48] + h[57] * u[54] + h[58] * u[60] + h[59] * u[66]
+          + r[24];
+    s[25] = h[48] * u[1] + h[49] * u[7] + h[50] * u[13] + h[51] * u[19] + h[52] * u[25] + h[53] * u[31]
+          + h[54] * u[37] + h[55] * u[43] + h[56] * u[49] + h[57] * u[55] + h[58] * u[61] + h[59] * u[67]
+          + r[25];
+    s[26] = h[48] * u[2] + h[49] * u[8] + h[50] * u[14] + h[51] * u[20] + h[52] * u[26] + h[53] * u[32]
+          + h[54] * u[38] + h[55] * u[44] + h[56] * u[50] + h[57] * u[56] + h[58] * u[62] + h[59] * u[68]
+          + r[26];
+    s[27] = h[48] * u[3] + h[49] * u[9] + h[50] * u[15] + h[51] * u[21] + h[52] * u[27] + h[53] * u[33]
+          + h[54] * u[39] + h[55] * u[45] + h[56] * u[51] + h[57] * u[57] + h[58] * u[63] + h[59] * u[69]
+          + r[27];
+    s[28] = h[48] * u[4] + h[49] * u[10] + h[50] * u[16] + h[51] * u[22] + h[52] * u[28] + h[53] * u[34]
+          + h[54] * u[40] + h[55] * u[46] + h[56] * u[52] + h[57] * u[58] + h[58] * u[64] + h[59] * u[70]
+          + r[28];
+    s[30] = h[60] * u[0] + h[61] * u[6] + h[62] * u[12] + h[63] * u[18] + h[64] * u[24] + h[65] * u[30]
+          + h[66] * u[36] + h[67] * u[42] + h[68] * u[48] + h[69] * u[54] + h[70] * u[60] + h[71] * u[66]
+          + r[30];
+    s[31] = h[60] * u[1] + h[61] * u[7] + h[62] * u[13] + h[63] * u[19] + h[64] * u[25] + h[65] * u[31]
+          + h[66] * u[37] + h[67] * u[43] + h[68] * u[49] + h[69] * u[55] + h[70] * u[61] + h[71] * u[67]
+          + r[31];
+    s[32] = h[60] * u[2] + h[61] * u[8] + h[62] * u[14] + h[63] * u[20] + h[64] * u[26] + h[65] * u[32]
+          + h[66] * u[38] + h[67] * u[44] + h[68] * u[50] + h[69] * u[56] + h[70] * u[62] + h[71] * u[68]
+          + r[32];
+    s[33] = h[60] * u[3] + h[61] * u[9] + h[62] * u[15] + h[63] * u[21] + h[64] * u[27] + h[65] * u[33]
+          + h[66] * u[39] + h[67] * u[45] + h[68] * u[51] + h[69] * u[57] + h[70] * u[63] + h[71] * u[69]
+          + r[33];
+    s[34] = h[60] * u[4] + h[61] * u[10] + h[62] * u[16] + h[63] * u[22] + h[64] * u[28] + h[65] * u[34]
+          + h[66] * u[40] + h[67] * u[46] + h[68] * u[52] + h[69] * u[58] + h[70] * u[64] + h[71] * u[70]
+          + r[34];
+    s[35] = h[60] * u[5] + h[61] * u[11] + h[62] * u[17] + h[63] * u[23] + h[64] * u[29] + h[65] * u[35]
+          + h[66] * u[41] + h[67] * u[47] + h[68] * u[53] + h[69] * u[59] + h[70] * u[65] + h[71] * u[71]
+          + r[35];
+
+    /* s = L * L' */
+    pivot = s[0];
+    ok &= (boolean)(pivot > 0.0f);
+    s[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / s[0];
+    s[6] = s[6] * inv[0];
+    s[12] = s[12] * inv[0];
+    s[18] = s[18] * inv[0];
+    s[24] = s[24] * inv[0];
+    s[30] = s[30] * inv[0];
+    pivot = s[7] - (s[6] * s[6]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[7] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / s[7];
+    s[13] = (s[13] - (s[12] * s[6])) * inv[1];
+    s[19] = (s[19] - (s[18] * s[6])) * inv[1];
+    s[25] = (s[25] - (s[24] * s[6])) * inv[1];
+    s[31] = (s[31] - (s[30] * s[6])) * inv[1];
+    pivot = s[14] - (s[12] * s[12] + s[13] * s[13]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[14] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / s[14];
+    s[20] = (s[20] - (s[18] * s[12] + s[19] * s[13])) * inv[2];
+    s[26] = (s[26] - (s[24] * s[12] + s[25] * s[13])) * inv[2];
+    s[32] = (s[32] - (s[30] * s[12] + s[31] * s[13])) * inv[2];
+    pivot = s[21] - (s[18] * s[18] + s[19] * s[19] + s[20] * s[20]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[21] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / s[21];
+    s[27] = (s[27] - (s[24] * s[18] + s[25] * s[19] + s[26] * s[20])) * inv[3];
+    s[33] = (s[33] - (s[30] * s[18] + s[31] * s[19] + s[32] * s[20])) * inv[3];
+    pivot = s[28] - (s[24] * s[24] + s[25] * s[25] + s[26] * s[26] + s[27] * s[27]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[28] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / s[28];
+    s[34] = (s[34] - (s[30] * s[24] + s[31] * s[25] + s[32] * s[26] + s[33] * s[27])) * inv[4];
+    pivot = s[35] - (s[30] * s[30] + s[31] * s[31] + s[32] * s[32] + s[33] * s[33] + s[34] * s[34]);
+    ok &= (boolean)(pivot > 0.0f);
+    s[35] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / s[35];
+
+    /* u = u * L^-T, v = L^-1 * y */
+    u[0] = u[0] * inv[0];
+    u[1] = (u[1] - (u[0] * s[6])) * inv[1];
+    u[2] = (u[2] - (u[0] * s[12] + u[1] * s[13])) * inv[2];
+    u[3] = (u[3] - (u[0] * s[18] + u[1] * s[19] + u[2] * s[20])) * inv[3];
+    u[4] = (u[4] - (u[0] * s[24] + u[1] * s[25] + u[2] * s[26] + u[3] * s[27])) * inv[4];
+    u[5] = (u[5] - (u[0] * s[30] + u[1] * s[31] + u[2] * s[32] + u[3] * s[33] + u[4] * s[34])) * inv[5];
+    u[6] = u[6] * inv[0];
+    u[7] = (u[7] - (u[6] * s[6])) * inv[1];
+    u[8] = (u[8] - (u[6] * s[12] + u[7] * s[13])) * inv[2];
+    u[9] = (u[9] - (u[6] * s[18] + u[7] * s[19] + u[8] * s[20])) * inv[3];
+    u[10] = (u[10] - (u[6] * s[24] + u[7] * s[25] + u[8] * s[26] + u[9] * s[27])) * inv[4];
+    u[11] = (u[11] - (u[6] * s[30] + u[7] * s[31] + u[8] * s[32] + u[9] * s[33] + u[10] * s[34])) * inv[5];
+    u[12] = u[12] * inv[0];
+    u[13] = (u[13] - (u[12] * s[6])) * inv[1];
+    u[14] = (u[14] - (u[12] * s[12] + u[13] * s[13])) * inv[2];
+    u[15] = (u[15] - (u[12] * s[18] + u[13] * s[19] + u[14] * s[20])) * inv[3];
+    u[16] = (u[16] - (u[12] * s[24] + u[13] * s[25] + u[14] * s[26] + u[15] * s[27])) * inv[4];
+    u[17] = (u[17] - (u[12] * s[30] + u[13] * s[31] + u[14] * s[32] + u[15] * s[33] + u[16] * s[34])) * inv[5];
+    u[18] = u[18] * inv[0];
+    u[19] = (u[19] - (u[18] * s[6])) * inv[1];
+    u[20] = (u[20] - (u[18] * s[12] + u[19] * s[13])) * inv[2];
+    u[21] = (u[21] - (u[18] * s[18] + u[19] * s[19] + u[20] * s[20])) * inv[3];
+    u[22] = (u[22] - (u[18] * s[24] + u[19] * s[25] + u[20] * s[26] + u[21] * s[27])) * inv[4];
+    u[23] = (u[23] - (u[18] * s[30] + u[19] * s[31] + u[20] * s[32] + u[21] * s[33] + u[22] * s[34])) * inv[5];
+    u[24] = u[24] * inv[0];
+    u[25] = (u[25] - (u[24] * s[6])) * inv[1];
+    u[26] = (u[26] - (u[24] * s[12] + u[25] * s[13])) * inv[2];
+    u[27] = (u[27] - (u[24] * s[18] + u[25] * s[19] + u[26] * s[20])) * inv[3];
+    u[28] = (u[28] - (u[24] * s[24] + u[25] * s[25] + u[26] * s[26] + u[27] * s[27])) * inv[4];
+    u[29] = (u[29] - (u[24] * s[30] + u[25] * s[31] + u[26] * s[32] + u[27] * s[33] + u[28] * s[34])) * inv[5];
+    u[30] = u[30] * inv[0];
+    u[31] = (u[31] - (u[30] * s[6])) * inv[1];
+    u[32] = (u[32] - (u[30] * s[12] + u[31] * s[13])) * inv[2];
+    u[33] = (u[33] - (u[30] * s[18] + u[31] * s[19] + u[32] * s[20])) * inv[3];
+    u[34] = (u[34] - (u[30] * s[24] + u[31] * s[25] + u[32] * s[26] + u[33] * s[27])) * inv[4];
+    u[35] = (u[35] - (u[30] * s[30] + u[31] * s[31] + u[32] * s[32] + u[33] * s[33] + u[34] * s[34])) * inv[5];
+    u[36] = u[36] * inv[0];
+    u[37] = (u[37] - (u[36] * s[6])) * inv[1];
+    u[38] = (u[38] - (u[36] * s[12] + u[37] * s[13])) * inv[2];
+    u[39] = (u[39] - (u[36] * s[18] + u[37] * s[19] + u[38] * s[20])) * inv[3];
+    u[40] = (u[40] - (u[36] * s[24] + u[37] * s[25] + u[38] * s[26] + u[39] * s[27])) * inv[4];
+    u[41] = (u[41] - (u[36] * s[30] + u[37] * s[31] + u[38] * s[32] + u[39] * s[33] + u[40] * s[34])) * inv[5];
+    u[42] = u[42] * inv[0];
+    u[43] = (u[43] - (u[42] * s[6])) * inv[1];
+    u[44] = (u[44] - (u[42] * s[12] + u[43] * s[13])) * inv[2];
+    u[45] = (u[45] - (u[42] * s[18] + u[43] * s[19] + u[44] * s[20])) * inv[3];
+    u[46] = (u[46] - (u[42] * s[24] + u[43] * s[25] + u[44] * s[26] + u[45] * s[27])) * inv[4];
+    u[47] = (u[47] - (u[42] * s[30] + u[43] * s[31] + u[44] * s[32] + u[45] * s[33] + u[46] * s[34])) * inv[5];
+    u[48] = u[48] * inv[0];
+    u[49] = (u[49] - (u[48] * s[6])) * inv[1];
+    u[50] = (u[50] - (u[48] * s[12] + u[49] * s[13])) * inv[2];
+    u[51] = (u[51] - (u[48] * s[18] + u[49] * s[19] + u[50] * s[20])) * inv[3];
+    u[52] = (u[52] - (u[48] * s[24] + u[49] * s[25] + u[50] * s[26] + u[51] * s[27])) * inv[4];
+    u[53] = (u[53] - (u[48] * s[30] + u[49] * s[31] + u[50] * s[32] + u[51] * s[33] + u[52] * s[34])) * inv[5];
+    u[54] = u[54] * inv[0];
+    u[55] = (u[55] - (u[54] * s[6])) * inv[1];
+    u[56] = (u[56] - (u[54] * s[12] + u[55] * s[13])) * inv[2];
+    u[57] = (u[57] - (u[54] * s[18] + u[55] * s[19] + u[56] * s[20])) * inv[3];
+    u[58] = (u[58] - (u[54] * s[24] + u[55] * s[25] + u[56] * s[26] + u[57] * s[27])) * inv[4];
+    u[59] = (u[59] - (u[54] * s[30] + u[55] * s[31] + u[56] * s[32] + u[57] * s[33] + u[58] * s[34])) * inv[5];
+    u[60] = u[60] * inv[0];
+    u[61] = (u[61] - (u[60] * s[6])) * inv[1];
+    u[62] = (u[62] - (u[60] * s[12] + u[61] * s[13])) * inv[2];
+    u[63] = (u[63] - (u[60] * s[18] + u[61] * s[19] + u[62] * s[20])) * inv[3];
+    u[64] = (u[64] - (u[60] * s[24] + u[61] * s[25] + u[62] * s[26] + u[63] * s[27])) * inv[4];
+    u[65] = (u[65] - (u[60] * s[30] + u[61] * s[31] + u[62] * s[32] + u[63] * s[33] + u[64] * s[34])) * inv[5];
+    u[66] = u[66] * inv[0];
+    u[67] = (u[67] - (u[66] * s[6])) * inv[1];
+    u[68] = (u[68] - (u[66] * s[12] + u[67] * s[13])) * inv[2];
+    u[69] = (u[69] - (u[66] * s[18] + u[67] * s[19] + u[68] * s[20])) * inv[3];
+    u[70] = (u[70] - (u[66] * s[24] + u[67] * s[25] + u[68] * s[26] + u[69] * s[27])) * inv[4];
+    u[71] = (u[71] - (u[66] * s[30] + u[67] * s[31] + u[68] * s[32] + u[69] * s[33] + u[70] * s[34])) * inv[5];
+    v[0] = y[0] * inv[0];
+    v[1] = (y[1] - (s[6] * v[0])) * inv[1];
+    v[2] = (y[2] - (s[12] * v[0] + s[13] * v[1])) * inv[2];
+    v[3] = (y[3] - (s[18] * v[0] + s[19] * v[1] + s[20] * v[2])) * inv[3];
+    v[4] = (y[4] - (s[24] * v[0] + s[25] * v[1] + s[26] * v[2] + s[27] * v[3])) * inv[4];
+    v[5] = (y[5] - (s[30] * v[0] + s[31] * v[1] + s[32] * v[2] + s[33] * v[3] + s[34] * v[4])) * inv[5];
+
+    if (ok != FALSE)
+    {
+        /* x = x + u * v, p = p - u * u', upper triangle */
+        x[0] += u[0] * v[0] + u[1] * v[1] + u[2] * v[2] + u[3] * v[3] + u[4] * v[4] + u[5] * v[5];
+        x[1] += u[6] * v[0] + u[7] * v[1] + u[8] * v[2] + u[9] * v[3] + u[10] * v[4] + u[11] * v[5];
+        x[2] += u[12] * v[0] + u[13] * v[1] + u[14] * v[2] + u[15] * v[3] + u[16] * v[4] + u[17] * v[5];
+        x[3] += u[18] * v[0] + u[19] * v[1] + u[20] * v[2] + u[21] * v[3] + u[22] * v[4] + u[23] * v[5];
+        x[4] += u[24] * v[0] + u[25] * v[1] + u[26] * v[2] + u[27] * v[3] + u[28] * v[4] + u[29] * v[5];
+        x[5] += u[30] * v[0] + u[31] * v[1] + u[32] * v[2] + u[33] * v[3] + u[34] * v[4] + u[35] * v[5];
+        x[6] += u[36] * v[0] + u[37] * v[1] + u[38] * v[2] + u[39] * v[3] + u[40] * v[4] + u[41] * v[5];
+        x[7] += u[42] * v[0] + u[43] * v[1] + u[44] * v[2] + u[45] * v[3] + u[46] * v[4] + u[47] * v[5];
+        x[8] += u[48] * v[0] + u[49] * v[1] + u[50] * v[2] + u[51] * v[3] + u[52] * v[4] + u[53] * v[5];
+        x[9] += u[54] * v[0] + u[55] * v[1] + u[56] * v[2] + u[57] * v[3] + u[58] * v[4] + u[59] * v[5];
+        x[10] += u[60] * v[0] + u[61] * v[1] + u[62] * v[2] + u[63] * v[3] + u[64] * v[4] + u[65] * v[5];
+        x[11] += u[66] * v[0] + u[67] * v[1] + u[68] * v[2] + u[69] * v[3] + u[70] * v[4] + u[71] * v[5];
+        p[0] -= u[0] * u[0] + u[1] * u[1] + u[2] * u[2] + u[3] * u[3] + u[4] * u[4] + u[5] * u[5];
+        p[1] -= u[0] * u[6] + u[1] * u[7] + u[2] * u[8] + u[3] * u[9] + u[4] * u[10] + u[5] * u[11];
+        p[2] -= u[0] * u[12] + u[1] * u[13] + u[2] * u[14] + u[3] * u[15] + u[4] * u[16] + u[5] * u[17];
+        p[3] -= u[0] * u[18] + u[1] * u[19] + u[2] * u[20] + u[3] * u[21] + u[4] * u[22] + u[5] * u[23];
+        p[4] -= u[0] * u[24] + u[1] * u[25] + u[2] * u[26] + u[3] * u[27] + u[4] * u[28] + u[5] * u[29];
+        p[5] -= u[0] * u[30] + u[1] * u[31] + u[2] * u[32] + u[3] * u[33] + u[4] * u[34] + u[5] * u[35];
+        p[6] -= u[0] * u[36] + u[1] * u[37] + u[2] * u[38] + u[3] * u[39] + u[4] * u[40] + u[5] * u[41];
+        p[7] -= u[0] * u[42] + u[1] * u[43] + u[2] * u[44] + u[3] * u[45] + u[4] * u[46] + u[5] * u[47];
+        p[8] -= u[0] * u[48] + u[1] * u[49] + u[2] * u[50] + u[3] * u[51] + u[4] * u[52] + u[5] * u[53];
+        p[9] -= u[0] * u[54] + u[1] * u[55] + u[2] * u[56] + u[3] * u[57] + u[4] * u[58] + u[5] * u[59];
+        p[10] -= u[0] * u[60] + u[1] * u[61] + u[2] * u[62] + u[3] * u[63] + u[4] * u[64] + u[5] * u[65];
+        p[11] -= u[0] * u[66] + u[1] * u[67] + u[2] * u[68] + u[3] * u[69] + u[4] * u[70] + u[5] * u[71];
+        p[13] -= u[6] * u[6] + u[7] * u[7] + u[8] * u[8] + u[9] * u[9] + u[10] * u[10] + u[11] * u[11];
+        p[14] -= u[6] * u[12] + u[7] * u[13] + u[8] * u[14] + u[9] * u[15] + u[10] * u[16] + u[11] * u[17];
+        p[15] -= u[6] * u[18] + u[7] * u[19] + u[8] * u[20] + u[9] * u[21] + u[10] * u[22] + u[11] * u[23];
+        p[16] -= u[6] * u[24] + u[7] * u[25] + u[8] * u[26] + u[9] * u[27] + u[10] * u[28] + u[11] * u[29];
+        p[17] -= u[6] * u[30] + u[7] * u[31] + u[8] * u[32] + u[9] * u[33] + u[10] * u[34] + u[11] * u[35];
+        p[18] -= u[6] * u[36] + u[7] * u[37] + u[8] * u[38] + u[9] * u[39] + u[10] * u[40] + u[11] * u[41];
+        p[19] -= u[6] * u[42] + u[7] * u[43] + u[8] * u[44] + u[9] * u[45] + u[10] * u[46] + u[11] * u[47];
+        p[20] -= u[6] * u[48] + u[7] * u[49] + u[8] * u[50] + u[9] * u[51] + u[10] * u[52] + u[11] * u[53];
+        p[21] -= u[6] * u[54] + u[7] * u[55] + u[8] * u[56] + u[9] * u[57] + u[10] * u[58] + u[11] * u[59];
+        p[22] -= u[6] * u[60] + u[7] * u[61] + u[8] * u[62] + u[9] * u[63] + u[10] * u[64] + u[11] * u[65];
+        p[23] -= u[6] * u[66] + u[7] * u[67] + u[8] * u[68] + u[9] * u[69] + u[10] * u[70] + u[11] * u[71];
+        p[26] -= u[12] * u[12] + u[13] * u[13] + u[14] * u[14] + u[15] * u[15] + u[16] * u[16] + u[17] * u[17];
+        p[27] -= u[12] * u[18] + u[13] * u[19] + u[14] * u[20] + u[15] * u[21] + u[16] * u[22] + u[17] * u[23];
+        p[28] -= u[12] * u[24] + u[13] * u[25] + u[14] * u[26] + u[15] * u[27] + u[16] * u[28] + u[17] * u[29];
+        p[29] -= u[12] * u[30] + u[13] * u[31] + u[14] * u[32] + u[15] * u[33] + u[16] * u[34] + u[17] * u[35];
+        p[30] -= u[12] * u[36] + u[13] * u[37] + u[14] * u[38] + u[15] * u[39] + u[16] * u[40] + u[17] * u[41];
+        p[31] -= u[12] * u[42] + u[13] * u[43] + u[14] * u[44] + u[15] * u[45] + u[16] * u[46] + u[17] * u[47];
+        p[32] -= u[12] * u[48] + u[13] * u[49] + u[14] * u[50] + u[15] * u[51] + u[16] * u[52] + u[17] * u[53];
+        p[33] -= u[12] * u[54] + u[13] * u[55] + u[14] * u[56] + u[15] * u[57] + u[16] * u[58] + u[17] * u[59];
+        p[34] -= u[12] * u[60] + u[13] * u[61] + u[14] * u[62] + u[15] * u[63] + u[16] * u[64] + u[17] * u[65];
+        p[35] -= u[12] * u[66] + u[13] * u[67] + u[14] * u[68] + u[15] * u[69] + u[16] * u[70] + u[17] * u[71];
+        p[39] -= u[18] * u[18] + u[19] * u[19] + u[20] * u[20] + u[21] * u[21] + u[22] * u[22] + u[23] * u[23];
+        p[40] -= u[18] * u[24] + u[19] * u[25] + u[20] * u[26] + u[21] * u[27] + u[22] * u[28] + u[23] * u[29];
+        p[41] -= u[18] * u[30] + u[19] * u[31] + u[20] * u[32] + u[21] * u[33] + u[22] * u[34] + u[23] * u[35];
+        p[42] -= u[18] * u[36] + u[19] * u[37] + u[20] * u[38] + u[21] * u[39] + u[22] * u[40] + u[23] * u[41];
+        p[43] -= u[18] * u[42] + u[19] * u[43] + u[20] * u[44] + u[21] * u[45] + u[22] * u[46] + u[23] * u[47];
+        p[44] -= u[18] * u[48] + u[19] * u[49] + u[20] * u[50] + u[21] * u[51] + u[22] * u[52] + u[23] * u[53];
+        p[45] -= u[18] * u[54] + u[19] * u[55] + u[20] * u[56] + u[21] * u[57] + u[22] * u[58] + u[23] * u[59];
+        p[46] -= u[18] * u[60] + u[19] * u[61] + u[20] * u[62] + u[21] * u[63] + u[22] * u[64] + u[23] * u[65];
+        p[47] -= u[18] * u[66] + u[19] * u[67] + u[20] * u[68] + u[21] * u[69] + u[22] * u[70] + u[23] * u[71];
+        p[52] -= u[24] * u[24] + u[25] * u[25] + u[26] * u[26] + u[27] * u[27] + u[28] * u[28] + u[29] * u[29];
+        p[53] -= u[24] * u[30] + u[25] * u[31] + u[26] * u[32] + u[27] * u[33] + u[28] * u[34] + u[29] * u[35];
+        p[54] -= u[24] * u[36] + u[25] * u[37] + u[26] * u[38] + u[27] * u[39] + u[28] * u[40] + u[29] * u[41];
+        p[55] -= u[24] * u[42] + u[25] * u[43] + u[26] * u[44] + u[27] * u[45] + u[28] * u[46] + u[29] * u[47];
+        p[56] -= u[24] * u[48] + u[25] * u[49] + u[26] * u[50] + u[27] * u[51] + u[28] * u[52] + u[29] * u[53];
+        p[57] -= u[24] * u[54] + u[25] * u[55] + u[26] * u[56] + u[27] * u[57] + u[28] * u[58] + u[29] * u[59];
+        p[58] -= u[24] * u[60] + u[25] * u[61] + u[26] * u[62] + u[27] * u[63] + u[28] * u[64] + u[29] * u[65];
+        p[59] -= u[24] * u[66] + u[25] * u[67] + u[26] * u[68] + u[27] * u[69] + u[28] * u[70] + u[29] * u[71];
+        p[65] -= u[30] * u[30] + u[31] * u[31] + u[32] * u[32] + u[33] * u[33] + u[34] * u[34] + u[35] * u[35];
+        p[66] -= u[30] * u[36] + u[31] * u[37] + u[32] * u[38] + u[33] * u[39] + u[34] * u[40] + u[35] * u[41];
+        p[67] -= u[30] * u[42] + u[31] * u[43] + u[32] * u[44] + u[33] * u[45] + u[34] * u[46] + u[35] * u[47];
+        p[68] -= u[30] * u[48] + u[31] * u[49] + u[32] * u[50] + u[33] * u[51] + u[34] * u[52] + u[35] * u[53];
+        p[69] -= u[30] * u[54] + u[31] * u[55] + u[32] * u[56] + u[33] * u[57] + u[34] * u[58] + u[35] * u[59];
+        p[70] -= u[30] * u[60] + u[31] * u[61] + u[32] * u[62] + u[33] * u[63] + u[34] * u[64] + u[35] * u[65];
+        p[71] -= u[30] * u[66] + u[31] * u[67] + u[32] * u[68] + u[33] * u[69] + u[34] * u[70] + u[35] * u[71];
+        p[78] -= u[36] * u[36] + u[37] * u[37] + u[38] * u[38] + u[39] * u[39] + u[40] * u[40] + u[41] * u[41];
+        p[79] -= u[36] * u[42] + u[37] * u[43] + u[38] * u[44] + u[39] * u[45] + u[40] * u[46] + u[41] * u[47];
+        p[80] -= u[36] * u[48] + u[37] * u[49] + u[38] * u[50] + u[39] * u[51] + u[40] * u[52] + u[41] * u[53];
+        p[81] -= u[36] * u[54] + u[37] * u[55] + u[38] * u[56] + u[39] * u[57] + u[40] * u[58] + u[41] * u[59];
+        p[82] -= u[36] * u[60] + u[37] * u[61] + u[38] * u[62] + u[39] * u[63] + u[40] * u[64] + u[41] * u[65];
+        p[83] -= u[36] * u[66] + u[37] * u[67] + u[38] * u[68] + u[39] * u[69] + u[40] * u[70] + u[41] * u[71];
+        p[91] -= u[42] * u[42] + u[43] * u[43] + u[44] * u[44] + u[45] * u[45] + u[46] * u[46] + u[47] * u[47];
+        p[92] -= u[42] * u[48] + u[43] * u[49] + u[44] * u[50] + u[45] * u[51] + u[46] * u[52] + u[47] * u[53];
+        p[93] -= u[42] * u[54] + u[43] * u[55] + u[44] * u[56] + u[45] * u[57] + u[46] * u[58] + u[47] * u[59];
+        p[94] -= u[42] * u[60] + u[43] * u[61] + u[44] * u[62] + u[45] * u[63] + u[46] * u[64] + u[47] * u[65];
+        p[95] -= u[42] * u[66] + u[43] * u[67] + u[44] * u[68] + u[45] * u[69] + u[46] * u[70] + u[47] * u[71];
+        p[104] -= u[48] * u[48] + u[49] * u[49] + u[50] * u[50] + u[51] * u[51] + u[52] * u[52]
+                + u[53] * u[53];
+        p[105] -= u[48] * u[54] + u[49] * u[55] + u[50] * u[56] + u[51] * u[57] + u[52] * u[58]
+                + u[53] * u[59];
+        p[106] -= u[48] * u[60] + u[49] * u[61] + u[50] * u[62] + u[51] * u[63] + u[52] * u[64]
+                + u[53] * u[65];
+        p[107] -= u[48] * u[66] + u[49] * u[67] + u[50] * u[68] + u[51] * u[69] + u[52] * u[70]
+                + u[53] * u[71];
+        p[117] -= u[54] * u[54] + u[55] * u[55] + u[56] * u[56] + u[57] * u[57] + u[58] * u[58]
+                + u[59] * u[59];
+        p[118] -= u[54] * u[60] + u[55] * u[61] + u[56] * u[62] + u[57] * u[63] + u[58] * u[64]
+                + u[59] * u[65];
+        p[119] -= u[54] * u[66] + u[55] * u[67] + u[56] * u[68] + u[57] * u[69] + u[58] * u[70]
+                + u[59] * u[71];
+        p[130] -= u[60] * u[60] + u[61] * u[61] + u[62] * u[62] + u[63] * u[63] + u[64] * u[64]
+                + u[65] * u[65];
+        p[131] -= u[60] * u[66] + u[61] * u[67] + u[62] * u[68] + u[63] * u[69] + u[64] * u[70]
+                + u[65] * u[71];
+        p[143] -= u[66] * u[66] + u[67] * u[67] + u[68] * u[68] + u[69] * u[69] + u[70] * u[70]
+                + u[71] * u[71];
+
+        p[12] = p[1];
+        p[24] = p[2];
+        p[36] = p[3];
+        p[48] = p[4];
+        p[60] = p[5];
+        p[72] = p[6];
+        p[84] = p[7];
+        p[96] = p[8];
+        p[108] = p[9];
+        p[120] = p[10];
+        p[132] = p[11];
+        p[25] = p[14];
+        p[37] = p[15];
+        p[49] = p[16];
+        p[61] = p[17];
+        p[73] = p[18];
+        p[85] = p[19];
+        p[97] = p[20];
+        p[109] = p[21];
+        p[121] = p[22];
+        p[133] = p[23];
+        p[38] = p[27];
+        p[50] = p[28];
+        p[62] = p[29];
+        p[74] = p[30];
+        p[86] = p[31];
+        p[98] = p[32];
+        p[110] = p[33];
+        p[122] = p[34];
+        p[134] = p[35];
+        p[51] = p[40];
+        p[63] = p[41];
+        p[75] = p[42];
+        p[87] = p[43];
+        p[99] = p[44];
+        p[111] = p[45];
+        p[123] = p[46];
+        p[135] = p[47];
+        p[64] = p[53];
+        p[76] = p[54];
+        p[88] = p[55];
+        p[100] = p[56];
+        p[112] = p[57];
+        p[124] = p[58];
+        p[136] = p[59];
+        p[77] = p[66];
+        p[89] = p[67];
+        p[101] = p[68];
+        p[113] = p[69];
+        p[125] = p[70];
+        p[137] = p[71];
+        p[90] = p[79];
+        p[102] = p[80];
+        p[114] = p[81];
+        p[126] = p[82];
+        p[138] = p[83];
+        p[103] = p[92];
+        p[115] = p[93];
+        p[127] = p[94];
+        p[139] = p[95];
+        p[116] = p[105];
+        p[128] = p[106];
+        p[140] = p[107];
+        p[129] = p[118];
+        p[141] = p[119];
+        p[142] = p[131];
+    }
+
+    return ok;
+}
@@ -0,0 +1,111 @@
+/**
+ * \file Ifx_KalmanF32.h
+ * \brief Kalman filter of fixed size
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_kalman Kalman filter
+ * This module holds the covariance prediction and the measurement update of
+ * linear and extended Kalman filters, for n states and m measurements:
+ * Ifx_KalmanF32_predictN() for n = 2, 3, 4, 6, 8, 9, 12, and
+ * Ifx_KalmanF32_updateNxM() for n x m = 2x1, 3x1, 4x2, 6x2, 6x3, 8x4, 9x3, 12x6.
+ * Like \ref library_srvsw_sysse_math_f32_mat they are written out for
+ * their size; tools/mat_gen.py generates other sizes.
+ *
+ * The state x is a vector of n float32, the covariance p a symmetric n x n
+ * matrix in row-major order, both halves valid. The noise covariances q and
+ * r must be symmetric too.
+ *
+ * Ifx_KalmanF32_predictN() sets p = f * p * f' + q for the transition f
+ * (the Jacobian of the state function of an extended filter) and the
+ * process noise q. The caller propagates the state, e.g. with
+ * Ifx_MatF32_mulVecN() or its own state function.
+ *
+ * Ifx_KalmanF32_updateNxM() takes the m x n measurement matrix h (the
+ * Jacobian of an extended filter), the m x m measurement noise r and the
+ * innovation y = z - h(x). It factors s = h * p * h' + r = L * L' with
+ * Cholesky, so that with u = p * h' * L^-T the gain applied is
+ * u * L^-1 and p becomes p - u * u'. Only one triangle of p, s and of
+ * p * f' is computed and the other is copied, so that p stays exactly
+ * symmetric. It returns FALSE, and leaves x and p unchanged, if s is not
+ * positive definite.
+ *
+ * Example, an extended filter with 6 states and 3 measurements:
+ * \code
+ * float32 x[6], p[6 * 6], f[6 * 6], q[6 * 6], h[3 * 6], r[3 * 3], y[3];
+ *
+ *     stateFunction(x, u, dt);     // x = f(x, u), and its Jacobian into f
+ *     Ifx_KalmanF32_predict6(p, f, q);
+ *     ...
+ *     measurementFunction(y, h, x); // y = h(x), and its Jacobian into h
+ *     y[0] = z[0] - y[0]; y[1] = z[1] - y[1]; y[2] = z[2] - y[2];
+ *     if (Ifx_KalmanF32_update6x3(x, p, h, r, y) == FALSE) { ... }
+ * \endcode
+ * Reading IfxCpu_getClockCounter() before and after the calls gives their
+ * cycles on the target; tools/mat_check runs this filter on the host.
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ */
+
+#ifndef IFX_KALMANF32_H
+#define IFX_KALMANF32_H 1
+
+#include "SysSe/Math/Ifx_MatF32.h"
+
+/** \addtogroup library_srvsw_sysse_math_f32_kalman
+ * \{ */
+
+IFX_EXTERN void    Ifx_KalmanF32_predict2(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict3(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict4(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict6(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict8(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict9(float32 *p, const float32 *f, const float32 *q);
+IFX_EXTERN void    Ifx_KalmanF32_predict12(float32 *p, const float32 *f, const float32 *q);
+
+IFX_EXTERN boolean Ifx_KalmanF32_update2x1(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update3x1(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update4x2(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update6x2(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update6x3(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update8x4(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update9x3(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+IFX_EXTERN boolean Ifx_KalmanF32_update12x6(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+
+/** \} */
+
+#endif /* IFX_KALMANF32_H */
@@ -0,0 +1,5900 @@
+/**
+ * \file Ifx_MatF32.c
+ * \brief Fixed-size float32 matrices
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_MatF32.h"
+#include <math.h>
+
+
+void Ifx_MatF32_add2(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+}
+
+
+void Ifx_MatF32_transpose2(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[2];
+    c[2] = a[1];
+    c[3] = a[3];
+}
+
+
+void Ifx_MatF32_mul2(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[2];
+    c[1] = a[0] * b[1] + a[1] * b[3];
+    c[2] = a[2] * b[0] + a[3] * b[2];
+    c[3] = a[2] * b[1] + a[3] * b[3];
+}
+
+
+void Ifx_MatF32_mulVec2(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1];
+    y[1] = a[2] * x[0] + a[3] * x[1];
+}
+
+
+boolean Ifx_MatF32_cholesky2(float32 *l, const float32 *a)
+{
+    float32 inv[2];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[2] = a[2] * inv[0];
+    pivot = a[3] - (l[2] * l[2]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[3] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[3];
+    l[1] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve2(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[2] * x[0])) / l[3];
+    x[1] = x[1] / l[3];
+    x[0] = (x[0] - (l[2] * x[1])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl2(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[2];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[2] = a[2] * inv;
+    l[0] = 1.0f;
+    v[0] = l[2] * d[0];
+    d[1] = a[3] - (l[2] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[3] = 1.0f;
+    l[1] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve2(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[2] * x[0]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[0] = x[0] - (l[2] * x[1]);
+}
+
+
+void Ifx_MatF32_add3(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+}
+
+
+void Ifx_MatF32_transpose3(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[3];
+    c[2] = a[6];
+    c[3] = a[1];
+    c[4] = a[4];
+    c[5] = a[7];
+    c[6] = a[2];
+    c[7] = a[5];
+    c[8] = a[8];
+}
+
+
+void Ifx_MatF32_mul3(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[3] + a[2] * b[6];
+    c[1] = a[0] * b[1] + a[1] * b[4] + a[2] * b[7];
+    c[2] = a[0] * b[2] + a[1] * b[5] + a[2] * b[8];
+    c[3] = a[3] * b[0] + a[4] * b[3] + a[5] * b[6];
+    c[4] = a[3] * b[1] + a[4] * b[4] + a[5] * b[7];
+    c[5] = a[3] * b[2] + a[4] * b[5] + a[5] * b[8];
+    c[6] = a[6] * b[0] + a[7] * b[3] + a[8] * b[6];
+    c[7] = a[6] * b[1] + a[7] * b[4] + a[8] * b[7];
+    c[8] = a[6] * b[2] + a[7] * b[5] + a[8] * b[8];
+}
+
+
+void Ifx_MatF32_mulVec3(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2];
+    y[1] = a[3] * x[0] + a[4] * x[1] + a[5] * x[2];
+    y[2] = a[6] * x[0] + a[7] * x[1] + a[8] * x[2];
+}
+
+
+boolean Ifx_MatF32_cholesky3(float32 *l, const float32 *a)
+{
+    float32 inv[3];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[3] = a[3] * inv[0];
+    l[6] = a[6] * inv[0];
+    pivot = a[4] - (l[3] * l[3]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[4] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[4];
+    l[7] = (a[7] - (l[6] * l[3])) * inv[1];
+    pivot = a[8] - (l[6] * l[6] + l[7] * l[7]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[8] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[8];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[5] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve3(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[3] * x[0])) / l[4];
+    x[2] = (b[2] - (l[6] * x[0] + l[7] * x[1])) / l[8];
+    x[2] = x[2] / l[8];
+    x[1] = (x[1] - (l[7] * x[2])) / l[4];
+    x[0] = (x[0] - (l[3] * x[1] + l[6] * x[2])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl3(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[3];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[3] = a[3] * inv;
+    l[6] = a[6] * inv;
+    l[0] = 1.0f;
+    v[0] = l[3] * d[0];
+    d[1] = a[4] - (l[3] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[7] = (a[7] - (l[6] * v[0])) * inv;
+    l[4] = 1.0f;
+    v[0] = l[6] * d[0];
+    v[1] = l[7] * d[1];
+    d[2] = a[8] - (l[6] * v[0] + l[7] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[8] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[5] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve3(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[3] * x[0]);
+    x[2] = b[2] - (l[6] * x[0] + l[7] * x[1]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[1] = x[1] - (l[7] * x[2]);
+    x[0] = x[0] - (l[3] * x[1] + l[6] * x[2]);
+}
+
+
+void Ifx_MatF32_add4(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+}
+
+
+void Ifx_MatF32_transpose4(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[4];
+    c[2] = a[8];
+    c[3] = a[12];
+    c[4] = a[1];
+    c[5] = a[5];
+    c[6] = a[9];
+    c[7] = a[13];
+    c[8] = a[2];
+    c[9] = a[6];
+    c[10] = a[10];
+    c[11] = a[14];
+    c[12] = a[3];
+    c[13] = a[7];
+    c[14] = a[11];
+    c[15] = a[15];
+}
+
+
+void Ifx_MatF32_mul4(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[4] + a[2] * b[8] + a[3] * b[12];
+    c[1] = a[0] * b[1] + a[1] * b[5] + a[2] * b[9] + a[3] * b[13];
+    c[2] = a[0] * b[2] + a[1] * b[6] + a[2] * b[10] + a[3] * b[14];
+    c[3] = a[0] * b[3] + a[1] * b[7] + a[2] * b[11] + a[3] * b[15];
+    c[4] = a[4] * b[0] + a[5] * b[4] + a[6] * b[8] + a[7] * b[12];
+    c[5] = a[4] * b[1] + a[5] * b[5] + a[6] * b[9] + a[7] * b[13];
+    c[6] = a[4] * b[2] + a[5] * b[6] + a[6] * b[10] + a[7] * b[14];
+    c[7] = a[4] * b[3] + a[5] * b[7] + a[6] * b[11] + a[7] * b[15];
+    c[8] = a[8] * b[0] + a[9] * b[4] + a[10] * b[8] + a[11] * b[12];
+    c[9] = a[8] * b[1] + a[9] * b[5] + a[10] * b[9] + a[11] * b[13];
+    c[10] = a[8] * b[2] + a[9] * b[6] + a[10] * b[10] + a[11] * b[14];
+    c[11] = a[8] * b[3] + a[9] * b[7] + a[10] * b[11] + a[11] * b[15];
+    c[12] = a[12] * b[0] + a[13] * b[4] + a[14] * b[8] + a[15] * b[12];
+    c[13] = a[12] * b[1] + a[13] * b[5] + a[14] * b[9] + a[15] * b[13];
+    c[14] = a[12] * b[2] + a[13] * b[6] + a[14] * b[10] + a[15] * b[14];
+    c[15] = a[12] * b[3] + a[13] * b[7] + a[14] * b[11] + a[15] * b[15];
+}
+
+
+void Ifx_MatF32_mulVec4(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3];
+    y[1] = a[4] * x[0] + a[5] * x[1] + a[6] * x[2] + a[7] * x[3];
+    y[2] = a[8] * x[0] + a[9] * x[1] + a[10] * x[2] + a[11] * x[3];
+    y[3] = a[12] * x[0] + a[13] * x[1] + a[14] * x[2] + a[15] * x[3];
+}
+
+
+boolean Ifx_MatF32_cholesky4(float32 *l, const float32 *a)
+{
+    float32 inv[4];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[4] = a[4] * inv[0];
+    l[8] = a[8] * inv[0];
+    l[12] = a[12] * inv[0];
+    pivot = a[5] - (l[4] * l[4]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[5] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[5];
+    l[9] = (a[9] - (l[8] * l[4])) * inv[1];
+    l[13] = (a[13] - (l[12] * l[4])) * inv[1];
+    pivot = a[10] - (l[8] * l[8] + l[9] * l[9]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[10] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[10];
+    l[14] = (a[14] - (l[12] * l[8] + l[13] * l[9])) * inv[2];
+    pivot = a[15] - (l[12] * l[12] + l[13] * l[13] + l[14] * l[14]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[15] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[15];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[11] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve4(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[4] * x[0])) / l[5];
+    x[2] = (b[2] - (l[8] * x[0] + l[9] * x[1])) / l[10];
+    x[3] = (b[3] - (l[12] * x[0] + l[13] * x[1] + l[14] * x[2])) / l[15];
+    x[3] = x[3] / l[15];
+    x[2] = (x[2] - (l[14] * x[3])) / l[10];
+    x[1] = (x[1] - (l[9] * x[2] + l[13] * x[3])) / l[5];
+    x[0] = (x[0] - (l[4] * x[1] + l[8] * x[2] + l[12] * x[3])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl4(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[4];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[4] = a[4] * inv;
+    l[8] = a[8] * inv;
+    l[12] = a[12] * inv;
+    l[0] = 1.0f;
+    v[0] = l[4] * d[0];
+    d[1] = a[5] - (l[4] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[9] = (a[9] - (l[8] * v[0])) * inv;
+    l[13] = (a[13] - (l[12] * v[0])) * inv;
+    l[5] = 1.0f;
+    v[0] = l[8] * d[0];
+    v[1] = l[9] * d[1];
+    d[2] = a[10] - (l[8] * v[0] + l[9] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[14] = (a[14] - (l[12] * v[0] + l[13] * v[1])) * inv;
+    l[10] = 1.0f;
+    v[0] = l[12] * d[0];
+    v[1] = l[13] * d[1];
+    v[2] = l[14] * d[2];
+    d[3] = a[15] - (l[12] * v[0] + l[13] * v[1] + l[14] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[15] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[11] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve4(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[4] * x[0]);
+    x[2] = b[2] - (l[8] * x[0] + l[9] * x[1]);
+    x[3] = b[3] - (l[12] * x[0] + l[13] * x[1] + l[14] * x[2]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[2] = x[2] - (l[14] * x[3]);
+    x[1] = x[1] - (l[9] * x[2] + l[13] * x[3]);
+    x[0] = x[0] - (l[4] * x[1] + l[8] * x[2] + l[12] * x[3]);
+}
+
+
+void Ifx_MatF32_add5(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+}
+
+
+void Ifx_MatF32_transpose5(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[5];
+    c[2] = a[10];
+    c[3] = a[15];
+    c[4] = a[20];
+    c[5] = a[1];
+    c[6] = a[6];
+    c[7] = a[11];
+    c[8] = a[16];
+    c[9] = a[21];
+    c[10] = a[2];
+    c[11] = a[7];
+    c[12] = a[12];
+    c[13] = a[17];
+    c[14] = a[22];
+    c[15] = a[3];
+    c[16] = a[8];
+    c[17] = a[13];
+    c[18] = a[18];
+    c[19] = a[23];
+    c[20] = a[4];
+    c[21] = a[9];
+    c[22] = a[14];
+    c[23] = a[19];
+    c[24] = a[24];
+}
+
+
+void Ifx_MatF32_mul5(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[5] + a[2] * b[10] + a[3] * b[15] + a[4] * b[20];
+    c[1] = a[0] * b[1] + a[1] * b[6] + a[2] * b[11] + a[3] * b[16] + a[4] * b[21];
+    c[2] = a[0] * b[2] + a[1] * b[7] + a[2] * b[12] + a[3] * b[17] + a[4] * b[22];
+    c[3] = a[0] * b[3] + a[1] * b[8] + a[2] * b[13] + a[3] * b[18] + a[4] * b[23];
+    c[4] = a[0] * b[4] + a[1] * b[9] + a[2] * b[14] + a[3] * b[19] + a[4] * b[24];
+    c[5] = a[5] * b[0] + a[6] * b[5] + a[7] * b[10] + a[8] * b[15] + a[9] * b[20];
+    c[6] = a[5] * b[1] + a[6] * b[6] + a[7] * b[11] + a[8] * b[16] + a[9] * b[21];
+    c[7] = a[5] * b[2] + a[6] * b[7] + a[7] * b[12] + a[8] * b[17] + a[9] * b[22];
+    c[8] = a[5] * b[3] + a[6] * b[8] + a[7] * b[13] + a[8] * b[18] + a[9] * b[23];
+    c[9] = a[5] * b[4] + a[6] * b[9] + a[7] * b[14] + a[8] * b[19] + a[9] * b[24];
+    c[10] = a[10] * b[0] + a[11] * b[5] + a[12] * b[10] + a[13] * b[15] + a[14] * b[20];
+    c[11] = a[10] * b[1] + a[11] * b[6] + a[12] * b[11] + a[13] * b[16] + a[14] * b[21];
+    c[12] = a[10] * b[2] + a[11] * b[7] + a[12] * b[12] + a[13] * b[17] + a[14] * b[22];
+    c[13] = a[10] * b[3] + a[11] * b[8] + a[12] * b[13] + a[13] * b[18] + a[14] * b[23];
+    c[14] = a[10] * b[4] + a[11] * b[9] + a[12] * b[14] + a[13] * b[19] + a[14] * b[24];
+    c[15] = a[15] * b[0] + a[16] * b[5] + a[17] * b[10] + a[18] * b[15] + a[19] * b[20];
+    c[16] = a[15] * b[1] + a[16] * b[6] + a[17] * b[11] + a[18] * b[16] + a[19] * b[21];
+    c[17] = a[15] * b[2] + a[16] * b[7] + a[17] * b[12] + a[18] * b[17] + a[19] * b[22];
+    c[18] = a[15] * b[3] + a[16] * b[8] + a[17] * b[13] + a[18] * b[18] + a[19] * b[23];
+    c[19] = a[15] * b[4] + a[16] * b[9] + a[17] * b[14] + a[18] * b[19] + a[19] * b[24];
+    c[20] = a[20] * b[0] + a[21] * b[5] + a[22] * b[10] + a[23] * b[15] + a[24] * b[20];
+    c[21] = a[20] * b[1] + a[21] * b[6] + a[22] * b[11] + a[23] * b[16] + a[24] * b[21];
+    c[22] = a[20] * b[2] + a[21] * b[7] + a[22] * b[12] + a[23] * b[17] + a[24] * b[22];
+    c[23] = a[20] * b[3] + a[21] * b[8] + a[22] * b[13] + a[23] * b[18] + a[24] * b[23];
+    c[24] = a[20] * b[4] + a[21] * b[9] + a[22] * b[14] + a[23] * b[19] + a[24] * b[24];
+}
+
+
+void Ifx_MatF32_mulVec5(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4];
+    y[1] = a[5] * x[0] + a[6] * x[1] + a[7] * x[2] + a[8] * x[3] + a[9] * x[4];
+    y[2] = a[10] * x[0] + a[11] * x[1] + a[12] * x[2] + a[13] * x[3] + a[14] * x[4];
+    y[3] = a[15] * x[0] + a[16] * x[1] + a[17] * x[2] + a[18] * x[3] + a[19] * x[4];
+    y[4] = a[20] * x[0] + a[21] * x[1] + a[22] * x[2] + a[23] * x[3] + a[24] * x[4];
+}
+
+
+boolean Ifx_MatF32_cholesky5(float32 *l, const float32 *a)
+{
+    float32 inv[5];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[5] = a[5] * inv[0];
+    l[10] = a[10] * inv[0];
+    l[15] = a[15] * inv[0];
+    l[20] = a[20] * inv[0];
+    pivot = a[6] - (l[5] * l[5]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[6] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[6];
+    l[11] = (a[11] - (l[10] * l[5])) * inv[1];
+    l[16] = (a[16] - (l[15] * l[5])) * inv[1];
+    l[21] = (a[21] - (l[20] * l[5])) * inv[1];
+    pivot = a[12] - (l[10] * l[10] + l[11] * l[11]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[12] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[12];
+    l[17] = (a[17] - (l[15] * l[10] + l[16] * l[11])) * inv[2];
+    l[22] = (a[22] - (l[20] * l[10] + l[21] * l[11])) * inv[2];
+    pivot = a[18] - (l[15] * l[15] + l[16] * l[16] + l[17] * l[17]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[18] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[18];
+    l[23] = (a[23] - (l[20] * l[15] + l[21] * l[16] + l[22] * l[17])) * inv[3];
+    pivot = a[24] - (l[20] * l[20] + l[21] * l[21] + l[22] * l[22] + l[23] * l[23]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[24] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[24];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[19] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve5(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[5] * x[0])) / l[6];
+    x[2] = (b[2] - (l[10] * x[0] + l[11] * x[1])) / l[12];
+    x[3] = (b[3] - (l[15] * x[0] + l[16] * x[1] + l[17] * x[2])) / l[18];
+    x[4] = (b[4] - (l[20] * x[0] + l[21] * x[1] + l[22] * x[2] + l[23] * x[3])) / l[24];
+    x[4] = x[4] / l[24];
+    x[3] = (x[3] - (l[23] * x[4])) / l[18];
+    x[2] = (x[2] - (l[17] * x[3] + l[22] * x[4])) / l[12];
+    x[1] = (x[1] - (l[11] * x[2] + l[16] * x[3] + l[21] * x[4])) / l[6];
+    x[0] = (x[0] - (l[5] * x[1] + l[10] * x[2] + l[15] * x[3] + l[20] * x[4])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl5(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[5];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[5] = a[5] * inv;
+    l[10] = a[10] * inv;
+    l[15] = a[15] * inv;
+    l[20] = a[20] * inv;
+    l[0] = 1.0f;
+    v[0] = l[5] * d[0];
+    d[1] = a[6] - (l[5] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[11] = (a[11] - (l[10] * v[0])) * inv;
+    l[16] = (a[16] - (l[15] * v[0])) * inv;
+    l[21] = (a[21] - (l[20] * v[0])) * inv;
+    l[6] = 1.0f;
+    v[0] = l[10] * d[0];
+    v[1] = l[11] * d[1];
+    d[2] = a[12] - (l[10] * v[0] + l[11] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[17] = (a[17] - (l[15] * v[0] + l[16] * v[1])) * inv;
+    l[22] = (a[22] - (l[20] * v[0] + l[21] * v[1])) * inv;
+    l[12] = 1.0f;
+    v[0] = l[15] * d[0];
+    v[1] = l[16] * d[1];
+    v[2] = l[17] * d[2];
+    d[3] = a[18] - (l[15] * v[0] + l[16] * v[1] + l[17] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[23] = (a[23] - (l[20] * v[0] + l[21] * v[1] + l[22] * v[2])) * inv;
+    l[18] = 1.0f;
+    v[0] = l[20] * d[0];
+    v[1] = l[21] * d[1];
+    v[2] = l[22] * d[2];
+    v[3] = l[23] * d[3];
+    d[4] = a[24] - (l[20] * v[0] + l[21] * v[1] + l[22] * v[2] + l[23] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[24] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[19] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve5(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[5] * x[0]);
+    x[2] = b[2] - (l[10] * x[0] + l[11] * x[1]);
+    x[3] = b[3] - (l[15] * x[0] + l[16] * x[1] + l[17] * x[2]);
+    x[4] = b[4] - (l[20] * x[0] + l[21] * x[1] + l[22] * x[2] + l[23] * x[3]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[3] = x[3] - (l[23] * x[4]);
+    x[2] = x[2] - (l[17] * x[3] + l[22] * x[4]);
+    x[1] = x[1] - (l[11] * x[2] + l[16] * x[3] + l[21] * x[4]);
+    x[0] = x[0] - (l[5] * x[1] + l[10] * x[2] + l[15] * x[3] + l[20] * x[4]);
+}
+
+
+void Ifx_MatF32_add6(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+}
+
+
+void Ifx_MatF32_transpose6(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[6];
+    c[2] = a[12];
+    c[3] = a[18];
+    c[4] = a[24];
+    c[5] = a[30];
+    c[6] = a[1];
+    c[7] = a[7];
+    c[8] = a[13];
+    c[9] = a[19];
+    c[10] = a[25];
+    c[11] = a[31];
+    c[12] = a[2];
+    c[13] = a[8];
+    c[14] = a[14];
+    c[15] = a[20];
+    c[16] = a[26];
+    c[17] = a[32];
+    c[18] = a[3];
+    c[19] = a[9];
+    c[20] = a[15];
+    c[21] = a[21];
+    c[22] = a[27];
+    c[23] = a[33];
+    c[24] = a[4];
+    c[25] = a[10];
+    c[26] = a[16];
+    c[27] = a[22];
+    c[28] = a[28];
+    c[29] = a[34];
+    c[30] = a[5];
+    c[31] = a[11];
+    c[32] = a[17];
+    c[33] = a[23];
+    c[34] = a[29];
+    c[35] = a[35];
+}
+
+
+void Ifx_MatF32_mul6(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[6] + a[2] * b[12] + a[3] * b[18] + a[4] * b[24] + a[5] * b[30];
+    c[1] = a[0] * b[1] + a[1] * b[7] + a[2] * b[13] + a[3] * b[19] + a[4] * b[25] + a[5] * b[31];
+    c[2] = a[0] * b[2] + a[1] * b[8] + a[2] * b[14] + a[3] * b[20] + a[4] * b[26] + a[5] * b[32];
+    c[3] = a[0] * b[3] + a[1] * b[9] + a[2] * b[15] + a[3] * b[21] + a[4] * b[27] + a[5] * b[33];
+    c[4] = a[0] * b[4] + a[1] * b[10] + a[2] * b[16] + a[3] * b[22] + a[4] * b[28] + a[5] * b[34];
+    c[5] = a[0] * b[5] + a[1] * b[11] + a[2] * b[17] + a[3] * b[23] + a[4] * b[29] + a[5] * b[35];
+    c[6] = a[6] * b[0] + a[7] * b[6] + a[8] * b[12] + a[9] * b[18] + a[10] * b[24] + a[11] * b[30];
+    c[7] = a[6] * b[1] + a[7] * b[7] + a[8] * b[13] + a[9] * b[19] + a[10] * b[25] + a[11] * b[31];
+    c[8] = a[6] * b[2] + a[7] * b[8] + a[8] * b[14] + a[9] * b[20] + a[10] * b[26] + a[11] * b[32];
+    c[9] = a[6] * b[3] + a[7] * b[9] + a[8] * b[15] + a[9] * b[21] + a[10] * b[27] + a[11] * b[33];
+    c[10] = a[6] * b[4] + a[7] * b[10] + a[8] * b[16] + a[9] * b[22] + a[10] * b[28] + a[11] * b[34];
+    c[11] = a[6] * b[5] + a[7] * b[11] + a[8] * b[17] + a[9] * b[23] + a[10] * b[29] + a[11] * b[35];
+    c[12] = a[12] * b[0] + a[13] * b[6] + a[14] * b[12] + a[15] * b[18] + a[16] * b[24] + a[17] * b[30];
+    c[13] = a[12] * b[1] + a[13] * b[7] + a[14] * b[13] + a[15] * b[19] + a[16] * b[25] + a[17] * b[31];
+    c[14] = a[12] * b[2] + a[13] * b[8] + a[14] * b[14] + a[15] * b[20] + a[16] * b[26] + a[17] * b[32];
+    c[15] = a[12] * b[3] + a[13] * b[9] + a[14] * b[15] + a[15] * b[21] + a[16] * b[27] + a[17] * b[33];
+    c[16] = a[12] * b[4] + a[13] * b[10] + a[14] * b[16] + a[15] * b[22] + a[16] * b[28] + a[17] * b[34];
+    c[17] = a[12] * b[5] + a[13] * b[11] + a[14] * b[17] + a[15] * b[23] + a[16] * b[29] + a[17] * b[35];
+    c[18] = a[18] * b[0] + a[19] * b[6] + a[20] * b[12] + a[21] * b[18] + a[22] * b[24] + a[23] * b[30];
+    c[19] = a[18] * b[1] + a[19] * b[7] + a[20] * b[13] + a[21] * b[19] + a[22] * b[25] + a[23] * b[31];
+    c[20] = a[18] * b[2] + a[19] * b[8] + a[20] * b[14] + a[21] * b[20] + a[22] * b[26] + a[23] * b[32];
+    c[21] = a[18] * b[3] + a[19] * b[9] + a[20] * b[15] + a[21] * b[21] + a[22] * b[27] + a[23] * b[33];
+    c[22] = a[18] * b[4] + a[19] * b[10] + a[20] * b[16] + a[21] * b[22] + a[22] * b[28] + a[23] * b[34];
+    c[23] = a[18] * b[5] + a[19] * b[11] + a[20] * b[17] + a[21] * b[23] + a[22] * b[29] + a[23] * b[35];
+    c[24] = a[24] * b[0] + a[25] * b[6] + a[26] * b[12] + a[27] * b[18] + a[28] * b[24] + a[29] * b[30];
+    c[25] = a[24] * b[1] + a[25] * b[7] + a[26] * b[13] + a[27] * b[19] + a[28] * b[25] + a[29] * b[31];
+    c[26] = a[24] * b[2] + a[25] * b[8] + a[26] * b[14] + a[27] * b[20] + a[28] * b[26] + a[29] * b[32];
+    c[27] = a[24] * b[3] + a[25] * b[9] + a[26] * b[15] + a[27] * b[21] + a[28] * b[27] + a[29] * b[33];
+    c[28] = a[24] * b[4] + a[25] * b[10] + a[26] * b[16] + a[27] * b[22] + a[28] * b[28] + a[29] * b[34];
+    c[29] = a[24] * b[5] + a[25] * b[11] + a[26] * b[17] + a[27] * b[23] + a[28] * b[29] + a[29] * b[35];
+    c[30] = a[30] * b[0] + a[31] * b[6] + a[32] * b[12] + a[33] * b[18] + a[34] * b[24] + a[35] * b[30];
+    c[31] = a[30] * b[1] + a[31] * b[7] + a[32] * b[13] + a[33] * b[19] + a[34] * b[25] + a[35] * b[31];
+    c[32] = a[30] * b[2] + a[31] * b[8] + a[32] * b[14] + a[33] * b[20] + a[34] * b[26] + a[35] * b[32];
+    c[33] = a[30] * b[3] + a[31] * b[9] + a[32] * b[15] + a[33] * b[21] + a[34] * b[27] + a[35] * b[33];
+    c[34] = a[30] * b[4] + a[31] * b[10] + a[32] * b[16] + a[33] * b[22] + a[34] * b[28] + a[35] * b[34];
+    c[35] = a[30] * b[5] + a[31] * b[11] + a[32] * b[17] + a[33] * b[23] + a[34] * b[29] + a[35] * b[35];
+}
+
+
+void Ifx_MatF32_mulVec6(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5];
+    y[1] = a[6] * x[0] + a[7] * x[1] + a[8] * x[2] + a[9] * x[3] + a[10] * x[4] + a[11] * x[5];
+    y[2] = a[12] * x[0] + a[13] * x[1] + a[14] * x[2] + a[15] * x[3] + a[16] * x[4] + a[17] * x[5];
+    y[3] = a[18] * x[0] + a[19] * x[1] + a[20] * x[2] + a[21] * x[3] + a[22] * x[4] + a[23] * x[5];
+    y[4] = a[24] * x[0] + a[25] * x[1] + a[26] * x[2] + a[27] * x[3] + a[28] * x[4] + a[29] * x[5];
+    y[5] = a[30] * x[0] + a[31] * x[1] + a[32] * x[2] + a[33] * x[3] + a[34] * x[4] + a[35] * x[5];
+}
+
+
+boolean Ifx_MatF32_cholesky6(float32 *l, const float32 *a)
+{
+    float32 inv[6];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[6] = a[6] * inv[0];
+    l[12] = a[12] * inv[0];
+    l[18] = a[18] * inv[0];
+    l[24] = a[24] * inv[0];
+    l[30] = a[30] * inv[0];
+    pivot = a[7] - (l[6] * l[6]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[7] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[7];
+    l[13] = (a[13] - (l[12] * l[6])) * inv[1];
+    l[19] = (a[19] - (l[18] * l[6])) * inv[1];
+    l[25] = (a[25] - (l[24] * l[6])) * inv[1];
+    l[31] = (a[31] - (l[30] * l[6])) * inv[1];
+    pivot = a[14] - (l[12] * l[12] + l[13] * l[13]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[14] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[14];
+    l[20] = (a[20] - (l[18] * l[12] + l[19] * l[13])) * inv[2];
+    l[26] = (a[26] - (l[24] * l[12] + l[25] * l[13])) * inv[2];
+    l[32] = (a[32] - (l[30] * l[12] + l[31] * l[13])) * inv[2];
+    pivot = a[21] - (l[18] * l[18] + l[19] * l[19] + l[20] * l[20]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[21] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[21];
+    l[27] = (a[27] - (l[24] * l[18] + l[25] * l[19] + l[26] * l[20])) * inv[3];
+    l[33] = (a[33] - (l[30] * l[18] + l[31] * l[19] + l[32] * l[20])) * inv[3];
+    pivot = a[28] - (l[24] * l[24] + l[25] * l[25] + l[26] * l[26] + l[27] * l[27]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[28] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[28];
+    l[34] = (a[34] - (l[30] * l[24] + l[31] * l[25] + l[32] * l[26] + l[33] * l[27])) * inv[4];
+    pivot = a[35] - (l[30] * l[30] + l[31] * l[31] + l[32] * l[32] + l[33] * l[33] + l[34] * l[34]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[35] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[35];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[29] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve6(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[6] * x[0])) / l[7];
+    x[2] = (b[2] - (l[12] * x[0] + l[13] * x[1])) / l[14];
+    x[3] = (b[3] - (l[18] * x[0] + l[19] * x[1] + l[20] * x[2])) / l[21];
+    x[4] = (b[4] - (l[24] * x[0] + l[25] * x[1] + l[26] * x[2] + l[27] * x[3])) / l[28];
+    x[5] = (b[5] - (l[30] * x[0] + l[31] * x[1] + l[32] * x[2] + l[33] * x[3] + l[34] * x[4])) / l[35];
+    x[5] = x[5] / l[35];
+    x[4] = (x[4] - (l[34] * x[5])) / l[28];
+    x[3] = (x[3] - (l[27] * x[4] + l[33] * x[5])) / l[21];
+    x[2] = (x[2] - (l[20] * x[3] + l[26] * x[4] + l[32] * x[5])) / l[14];
+    x[1] = (x[1] - (l[13] * x[2] + l[19] * x[3] + l[25] * x[4] + l[31] * x[5])) / l[7];
+    x[0] = (x[0] - (l[6] * x[1] + l[12] * x[2] + l[18] * x[3] + l[24] * x[4] + l[30] * x[5])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl6(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[6];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[6] = a[6] * inv;
+    l[12] = a[12] * inv;
+    l[18] = a[18] * inv;
+    l[24] = a[24] * inv;
+    l[30] = a[30] * inv;
+    l[0] = 1.0f;
+    v[0] = l[6] * d[0];
+    d[1] = a[7] - (l[6] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[13] = (a[13] - (l[12] * v[0])) * inv;
+    l[19] = (a[19] - (l[18] * v[0])) * inv;
+    l[25] = (a[25] - (l[24] * v[0])) * inv;
+    l[31] = (a[31] - (l[30] * v[0])) * inv;
+    l[7] = 1.0f;
+    v[0] = l[12] * d[0];
+    v[1] = l[13] * d[1];
+    d[2] = a[14] - (l[12] * v[0] + l[13] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[20] = (a[20] - (l[18] * v[0] + l[19] * v[1])) * inv;
+    l[26] = (a[26] - (l[24] * v[0] + l[25] * v[1])) * inv;
+    l[32] = (a[32] - (l[30] * v[0] + l[31] * v[1])) * inv;
+    l[14] = 1.0f;
+    v[0] = l[18] * d[0];
+    v[1] = l[19] * d[1];
+    v[2] = l[20] * d[2];
+    d[3] = a[21] - (l[18] * v[0] + l[19] * v[1] + l[20] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[27] = (a[27] - (l[24] * v[0] + l[25] * v[1] + l[26] * v[2])) * inv;
+    l[33] = (a[33] - (l[30] * v[0] + l[31] * v[1] + l[32] * v[2])) * inv;
+    l[21] = 1.0f;
+    v[0] = l[24] * d[0];
+    v[1] = l[25] * d[1];
+    v[2] = l[26] * d[2];
+    v[3] = l[27] * d[3];
+    d[4] = a[28] - (l[24] * v[0] + l[25] * v[1] + l[26] * v[2] + l[27] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[34] = (a[34] - (l[30] * v[0] + l[31] * v[1] + l[32] * v[2] + l[33] * v[3])) * inv;
+    l[28] = 1.0f;
+    v[0] = l[30] * d[0];
+    v[1] = l[31] * d[1];
+    v[2] = l[32] * d[2];
+    v[3] = l[33] * d[3];
+    v[4] = l[34] * d[4];
+    d[5] = a[35] - (l[30] * v[0] + l[31] * v[1] + l[32] * v[2] + l[33] * v[3] + l[34] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[35] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[29] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve6(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[6] * x[0]);
+    x[2] = b[2] - (l[12] * x[0] + l[13] * x[1]);
+    x[3] = b[3] - (l[18] * x[0] + l[19] * x[1] + l[20] * x[2]);
+    x[4] = b[4] - (l[24] * x[0] + l[25] * x[1] + l[26] * x[2] + l[27] * x[3]);
+    x[5] = b[5] - (l[30] * x[0] + l[31] * x[1] + l[32] * x[2] + l[33] * x[3] + l[34] * x[4]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[4] = x[4] - (l[34] * x[5]);
+    x[3] = x[3] - (l[27] * x[4] + l[33] * x[5]);
+    x[2] = x[2] - (l[20] * x[3] + l[26] * x[4] + l[32] * x[5]);
+    x[1] = x[1] - (l[13] * x[2] + l[19] * x[3] + l[25] * x[4] + l[31] * x[5]);
+    x[0] = x[0] - (l[6] * x[1] + l[12] * x[2] + l[18] * x[3] + l[24] * x[4] + l[30] * x[5]);
+}
+
+
+void Ifx_MatF32_add7(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+}
+
+
+void Ifx_MatF32_transpose7(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[7];
+    c[2] = a[14];
+    c[3] = a[21];
+    c[4] = a[28];
+    c[5] = a[35];
+    c[6] = a[42];
+    c[7] = a[1];
+    c[8] = a[8];
+    c[9] = a[15];
+    c[10] = a[22];
+    c[11] = a[29];
+    c[12] = a[36];
+    c[13] = a[43];
+    c[14] = a[2];
+    c[15] = a[9];
+    c[16] = a[16];
+    c[17] = a[23];
+    c[18] = a[30];
+    c[19] = a[37];
+    c[20] = a[44];
+    c[21] = a[3];
+    c[22] = a[10];
+    c[23] = a[17];
+    c[24] = a[24];
+    c[25] = a[31];
+    c[26] = a[38];
+    c[27] = a[45];
+    c[28] = a[4];
+    c[29] = a[11];
+    c[30] = a[18];
+    c[31] = a[25];
+    c[32] = a[32];
+    c[33] = a[39];
+    c[34] = a[46];
+    c[35] = a[5];
+    c[36] = a[12];
+    c[37] = a[19];
+    c[38] = a[26];
+    c[39] = a[33];
+    c[40] = a[40];
+    c[41] = a[47];
+    c[42] = a[6];
+    c[43] = a[13];
+    c[44] = a[20];
+    c[45] = a[27];
+    c[46] = a[34];
+    c[47] = a[41];
+    c[48] = a[48];
+}
+
+
+void Ifx_MatF32_mul7(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[7] + a[2] * b[14] + a[3] * b[21] + a[4] * b[28] + a[5] * b[35]
+         + a[6] * b[42];
+    c[1] = a[0] * b[1] + a[1] * b[8] + a[2] * b[15] + a[3] * b[22] + a[4] * b[29] + a[5] * b[36]
+         + a[6] * b[43];
+    c[2] = a[0] * b[2] + a[1] * b[9] + a[2] * b[16] + a[3] * b[23] + a[4] * b[30] + a[5] * b[37]
+         + a[6] * b[44];
+    c[3] = a[0] * b[3] + a[1] * b[10] + a[2] * b[17] + a[3] * b[24] + a[4] * b[31] + a[5] * b[38]
+         + a[6] * b[45];
+    c[4] = a[0] * b[4] + a[1] * b[11] + a[2] * b[18] + a[3] * b[25] + a[4] * b[32] + a[5] * b[39]
+         + a[6] * b[46];
+    c[5] = a[0] * b[5] + a[1] * b[12] + a[2] * b[19] + a[3] * b[26] + a[4] * b[33] + a[5] * b[40]
+         + a[6] * b[47];
+    c[6] = a[0] * b[6] + a[1] * b[13] + a[2] * b[20] + a[3] * b[27] + a[4] * b[34] + a[5] * b[41]
+         + a[6] * b[48];
+    c[7] = a[7] * b[0] + a[8] * b[7] + a[9] * b[14] + a[10] * b[21] + a[11] * b[28] + a[12] * b[35]
+         + a[13] * b[42];
+    c[8] = a[7] * b[1] + a[8] * b[8] + a[9] * b[15] + a[10] * b[22] + a[11] * b[29] + a[12] * b[36]
+         + a[13] * b[43];
+    c[9] = a[7] * b[2] + a[8] * b[9] + a[9] * b[16] + a[10] * b[23] + a[11] * b[30] + a[12] * b[37]
+         + a[13] * b[44];
+    c[10] = a[7] * b[3] + a[8] * b[10] + a[9] * b[17] + a[10] * b[24] + a[11] * b[31] + a[12] * b[38]
+          + a[13] * b[45];
+    c[11] = a[7] * b[4] + a[8] * b[11] + a[9] * b[18] + a[10] * b[25] + a[11] * b[32] + a[12] * b[39]
+          + a[13] * b[46];
+    c[12] = a[7] * b[5] + a[8] * b[12] + a[9] * b[19] + a[10] * b[26] + a[11] * b[33] + a[12] * b[40]
+          + a[13] * b[47];
+    c[13] = a[7] * b[6] + a[8] * b[13] + a[9] * b[20] + a[10] * b[27] + a[11] * b[34] + a[12] * b[41]
+          + a[13] * b[48];
+    c[14] = a[14] * b[0] + a[15] * b[7] + a[16] * b[14] + a[17] * b[21] + a[18] * b[28] + a[19] * b[35]
+          + a[20] * b[42];
+    c[15] = a[14] * b[1] + a[15] * b[8] + a[16] * b[15] + a[17] * b[22] + a[18] * b[29] + a[19] * b[36]
+          + a[20] * b[43];
+    c[16] = a[14] * b[2] + a[15] * b[9] + a[16] * b[16] + a[17] * b[23] + a[18] * b[30] + a[19] * b[37]
+          + a[20] * b[44];
+    c[17] = a[14] * b[3] + a[15] * b[10] + a[16] * b[17] + a[17] * b[24] + a[18] * b[31] + a[19] * b[38]
+          + a[20] * b[45];
+    c[18] = a[14] * b[4] + a[15] * b[11] + a[16] * b[18] + a[17] * b[25] + a[18] * b[32] + a[19] * b[39]
+          + a[20] * b[46];
+    c[19] = a[14] * b[5] + a[15] * b[12] + a[16] * b[19] + a[17] * b[26] + a[18] * b[33] + a[19] * b[40]
+          + a[20] * b[47];
+    c[20] = a[14] * b[6] + a[15] * b[13] + a[16] * b[20] + a[17] * b[27] + a[18] * b[34] + a[19] * b[41]
+          + a[20] * b[48];
+    c[21] = a[21] * b[0] + a[22] * b[7] + a[23] * b[14] + a[24] * b[21] + a[25] * b[28] + a[26] * b[35]
+          + a[27] * b[42];
+    c[22] = a[21] * b[1] + a[22] * b[8] + a[23] * b[15] + a[24] * b[22] + a[25] * b[29] + a[26] * b[36]
+          + a[27] * b[43];
+    c[23] = a[21] * b[2] + a[22] * b[9] + a[23] * b[16] + a[24] * b[23] + a[25] * b[30] + a[26] * b[37]
+          + a[27] * b[44];
+    c[24] = a[21] * b[3] + a[22] * b[10] + a[23] * b[17] + a[24] * b[24] + a[25] * b[31] + a[26] * b[38]
+          + a[27] * b[45];
+    c[25] = a[21] * b[4] + a[22] * b[11] + a[23] * b[18] + a[24] * b[25] + a[25] * b[32] + a[26] * b[39]
+          + a[27] * b[46];
+    c[26] = a[21] * b[5] + a[22] * b[12] + a[23] * b[19] + a[24] * b[26] + a[25] * b[33] + a[26] * b[40]
+          + a[27] * b[47];
+    c[27] = a[21] * b[6] + a[22] * b[13] + a[23] * b[20] + a[24] * b[27] + a[25] * b[34] + a[26] * b[41]
+          + a[27] * b[48];
+    c[28] = a[28] * b[0] + a[29] * b[7] + a[30] * b[14] + a[31] * b[21] + a[32] * b[28] + a[33] * b[35]
+          + a[34] * b[42];
+    c[29] = a[28] * b[1] + a[29] * b[8] + a[30] * b[15] + a[31] * b[22] + a[32] * b[29] + a[33] * b[36]
+          + a[34] * b[43];
+    c[30] = a[28] * b[2] + a[29] * b[9] + a[30] * b[16] + a[31] * b[23] + a[32] * b[30] + a[33] * b[37]
+          + a[34] * b[44];
+    c[31] = a[28] * b[3] + a[29] * b[10] + a[30] * b[17] + a[31] * b[24] + a[32] * b[31] + a[33] * b[38]
+          + a[34] * b[45];
+    c[32] = a[28] * b[4] + a[29] * b[11] + a[30] * b[18] + a[31] * b[25] + a[32] * b[32] + a[33] * b[39]
+          + a[34] * b[46];
+    c[33] = a[28] * b[5] + a[29] * b[12] + a[30] * b[19] + a[31] * b[26] + a[32] * b[33] + a[33] * b[40]
+          + a[34] * b[47];
+    c[34] = a[28] * b[6] + a[29] * b[13] + a[30] * b[20] + a[31] * b[27] + a[32] * b[34] + a[33] * b[41]
+          + a[34] * b[48];
+    c[35] = a[35] * b[0] + a[36] * b[7] + a[37] * b[14] + a[38] * b[21] + a[39] * b[28] + a[40] * b[35]
+          + a[41] * b[42];
+    c[36] = a[35] * b[1] + a[36] * b[8] + a[37] * b[15] + a[38] * b[22] + a[39] * b[29] + a[40] * b[36]
+          + a[41] * b[43];
+    c[37] = a[35] * b[2] + a[36] * b[9] + a[37] * b[16] + a[38] * b[23] + a[39] * b[30] + a[40] * b[37]
+          + a[41] * b[44];
+    c[38] = a[35] * b[3] + a[36] * b[10] + a[37] * b[17] + a[38] * b[24] + a[39] * b[31] + a[40] * b[38]
+          + a[41] * b[45];
+    c[39] = a[35] * b[4] + a[36] * b[11] + a[37] * b[18] + a[38] * b[25] + a[39] * b[32] + a[40] * b[39]
+          + a[41] * b[46];
+    c[40] = a[35] * b[5] + a[36] * b[12] + a[37] * b[19] + a[38] * b[26] + a[39] * b[33] + a[40] * b[40]
+          + a[41] * b[47];
+    c[41] = a[35] * b[6] + a[36] * b[13] + a[37] * b[20] + a[38] * b[27] + a[39] * b[34] + a[40] * b[41]
+          + a[41] * b[48];
+    c[42] = a[42] * b[0] + a[43] * b[7] + a[44] * b[14] + a[45] * b[21] + a[46] * b[28] + a[47] * b[35]
+          + a[48] * b[42];
+    c[43] = a[42] * b[1] + a[43] * b[8] + a[44] * b[15] + a[45] * b[22] + a[46] * b[29] + a[47] * b[36]
+          + a[48] * b[43];
+    c[44] = a[42] * b[2] + a[43] * b[9] + a[44] * b[16] + a[45] * b[23] + a[46] * b[30] + a[47] * b[37]
+          + a[48] * b[44];
+    c[45] = a[42] * b[3] + a[43] * b[10] + a[44] * b[17] + a[45] * b[24] + a[46] * b[31] + a[47] * b[38]
+          + a[48] * b[45];
+    c[46] = a[42] * b[4] + a[43] * b[11] + a[44] * b[18] + a[45] * b[25] + a[46] * b[32] + a[47] * b[39]
+          + a[48] * b[46];
+    c[47] = a[42] * b[5] + a[43] * b[12] + a[44] * b[19] + a[45] * b[26] + a[46] * b[33] + a[47] * b[40]
+          + a[48] * b[47];
+    c[48] = a[42] * b[6] + a[43] * b[13] + a[44] * b[20] + a[45] * b[27] + a[46] * b[34] + a[47] * b[41]
+          + a[48] * b[48];
+}
+
+
+void Ifx_MatF32_mulVec7(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6];
+    y[1] = a[7] * x[0] + a[8] * x[1] + a[9] * x[2] + a[10] * x[3] + a[11] * x[4] + a[12] * x[5] + a[13] * x[6];
+    y[2] = a[14] * x[0] + a[15] * x[1] + a[16] * x[2] + a[17] * x[3] + a[18] * x[4] + a[19] * x[5]
+         + a[20] * x[6];
+    y[3] = a[21] * x[0] + a[22] * x[1] + a[23] * x[2] + a[24] * x[3] + a[25] * x[4] + a[26] * x[5]
+         + a[27] * x[6];
+    y[4] = a[28] * x[0] + a[29] * x[1] + a[30] * x[2] + a[31] * x[3] + a[32] * x[4] + a[33] * x[5]
+         + a[34] * x[6];
+    y[5] = a[35] * x[0] + a[36] * x[1] + a[37] * x[2] + a[38] * x[3] + a[39] * x[4] + a[40] * x[5]
+         + a[41] * x[6];
+    y[6] = a[42] * x[0] + a[43] * x[1] + a[44] * x[2] + a[45] * x[3] + a[46] * x[4] + a[47] * x[5]
+         + a[48] * x[6];
+}
+
+
+boolean Ifx_MatF32_cholesky7(float32 *l, const float32 *a)
+{
+    float32 inv[7];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[7] = a[7] * inv[0];
+    l[14] = a[14] * inv[0];
+    l[21] = a[21] * inv[0];
+    l[28] = a[28] * inv[0];
+    l[35] = a[35] * inv[0];
+    l[42] = a[42] * inv[0];
+    pivot = a[8] - (l[7] * l[7]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[8] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[8];
+    l[15] = (a[15] - (l[14] * l[7])) * inv[1];
+    l[22] = (a[22] - (l[21] * l[7])) * inv[1];
+    l[29] = (a[29] - (l[28] * l[7])) * inv[1];
+    l[36] = (a[36] - (l[35] * l[7])) * inv[1];
+    l[43] = (a[43] - (l[42] * l[7])) * inv[1];
+    pivot = a[16] - (l[14] * l[14] + l[15] * l[15]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[16] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[16];
+    l[23] = (a[23] - (l[21] * l[14] + l[22] * l[15])) * inv[2];
+    l[30] = (a[30] - (l[28] * l[14] + l[29] * l[15])) * inv[2];
+    l[37] = (a[37] - (l[35] * l[14] + l[36] * l[15])) * inv[2];
+    l[44] = (a[44] - (l[42] * l[14] + l[43] * l[15])) * inv[2];
+    pivot = a[24] - (l[21] * l[21] + l[22] * l[22] + l[23] * l[23]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[24] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[24];
+    l[31] = (a[31] - (l[28] * l[21] + l[29] * l[22] + l[30] * l[23])) * inv[3];
+    l[38] = (a[38] - (l[35] * l[21] + l[36] * l[22] + l[37] * l[23])) * inv[3];
+    l[45] = (a[45] - (l[42] * l[21] + l[43] * l[22] + l[44] * l[23])) * inv[3];
+    pivot = a[32] - (l[28] * l[28] + l[29] * l[29] + l[30] * l[30] + l[31] * l[31]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[32] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[32];
+    l[39] = (a[39] - (l[35] * l[28] + l[36] * l[29] + l[37] * l[30] + l[38] * l[31])) * inv[4];
+    l[46] = (a[46] - (l[42] * l[28] + l[43] * l[29] + l[44] * l[30] + l[45] * l[31])) * inv[4];
+    pivot = a[40] - (l[35] * l[35] + l[36] * l[36] + l[37] * l[37] + l[38] * l[38] + l[39] * l[39]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[40] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[40];
+    l[47] = (a[47] - (l[42] * l[35] + l[43] * l[36] + l[44] * l[37] + l[45] * l[38] + l[46] * l[39])) * inv[5];
+    pivot = a[48] - (l[42] * l[42] + l[43] * l[43] + l[44] * l[44] + l[45] * l[45] + l[46] * l[46]
+                   + l[47] * l[47]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[48] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[48];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[41] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve7(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[7] * x[0])) / l[8];
+    x[2] = (b[2] - (l[14] * x[0] + l[15] * x[1])) / l[16];
+    x[3] = (b[3] - (l[21] * x[0] + l[22] * x[1] + l[23] * x[2])) / l[24];
+    x[4] = (b[4] - (l[28] * x[0] + l[29] * x[1] + l[30] * x[2] + l[31] * x[3])) / l[32];
+    x[5] = (b[5] - (l[35] * x[0] + l[36] * x[1] + l[37] * x[2] + l[38] * x[3] + l[39] * x[4])) / l[40];
+    x[6] = (b[6] - (l[42] * x[0] + l[43] * x[1] + l[44] * x[2] + l[45] * x[3] + l[46] * x[4] + l[47] * x[5])) / l[48];
+    x[6] = x[6] / l[48];
+    x[5] = (x[5] - (l[47] * x[6])) / l[40];
+    x[4] = (x[4] - (l[39] * x[5] + l[46] * x[6])) / l[32];
+    x[3] = (x[3] - (l[31] * x[4] + l[38] * x[5] + l[45] * x[6])) / l[24];
+    x[2] = (x[2] - (l[23] * x[3] + l[30] * x[4] + l[37] * x[5] + l[44] * x[6])) / l[16];
+    x[1] = (x[1] - (l[15] * x[2] + l[22] * x[3] + l[29] * x[4] + l[36] * x[5] + l[43] * x[6])) / l[8];
+    x[0] = (x[0] - (l[7] * x[1] + l[14] * x[2] + l[21] * x[3] + l[28] * x[4] + l[35] * x[5] + l[42] * x[6])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl7(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[7];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[7] = a[7] * inv;
+    l[14] = a[14] * inv;
+    l[21] = a[21] * inv;
+    l[28] = a[28] * inv;
+    l[35] = a[35] * inv;
+    l[42] = a[42] * inv;
+    l[0] = 1.0f;
+    v[0] = l[7] * d[0];
+    d[1] = a[8] - (l[7] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[15] = (a[15] - (l[14] * v[0])) * inv;
+    l[22] = (a[22] - (l[21] * v[0])) * inv;
+    l[29] = (a[29] - (l[28] * v[0])) * inv;
+    l[36] = (a[36] - (l[35] * v[0])) * inv;
+    l[43] = (a[43] - (l[42] * v[0])) * inv;
+    l[8] = 1.0f;
+    v[0] = l[14] * d[0];
+    v[1] = l[15] * d[1];
+    d[2] = a[16] - (l[14] * v[0] + l[15] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[23] = (a[23] - (l[21] * v[0] + l[22] * v[1])) * inv;
+    l[30] = (a[30] - (l[28] * v[0] + l[29] * v[1])) * inv;
+    l[37] = (a[37] - (l[35] * v[0] + l[36] * v[1])) * inv;
+    l[44] = (a[44] - (l[42] * v[0] + l[43] * v[1])) * inv;
+    l[16] = 1.0f;
+    v[0] = l[21] * d[0];
+    v[1] = l[22] * d[1];
+    v[2] = l[23] * d[2];
+    d[3] = a[24] - (l[21] * v[0] + l[22] * v[1] + l[23] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[31] = (a[31] - (l[28] * v[0] + l[29] * v[1] + l[30] * v[2])) * inv;
+    l[38] = (a[38] - (l[35] * v[0] + l[36] * v[1] + l[37] * v[2])) * inv;
+    l[45] = (a[45] - (l[42] * v[0] + l[43] * v[1] + l[44] * v[2])) * inv;
+    l[24] = 1.0f;
+    v[0] = l[28] * d[0];
+    v[1] = l[29] * d[1];
+    v[2] = l[30] * d[2];
+    v[3] = l[31] * d[3];
+    d[4] = a[32] - (l[28] * v[0] + l[29] * v[1] + l[30] * v[2] + l[31] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[39] = (a[39] - (l[35] * v[0] + l[36] * v[1] + l[37] * v[2] + l[38] * v[3])) * inv;
+    l[46] = (a[46] - (l[42] * v[0] + l[43] * v[1] + l[44] * v[2] + l[45] * v[3])) * inv;
+    l[32] = 1.0f;
+    v[0] = l[35] * d[0];
+    v[1] = l[36] * d[1];
+    v[2] = l[37] * d[2];
+    v[3] = l[38] * d[3];
+    v[4] = l[39] * d[4];
+    d[5] = a[40] - (l[35] * v[0] + l[36] * v[1] + l[37] * v[2] + l[38] * v[3] + l[39] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[47] = (a[47] - (l[42] * v[0] + l[43] * v[1] + l[44] * v[2] + l[45] * v[3] + l[46] * v[4])) * inv;
+    l[40] = 1.0f;
+    v[0] = l[42] * d[0];
+    v[1] = l[43] * d[1];
+    v[2] = l[44] * d[2];
+    v[3] = l[45] * d[3];
+    v[4] = l[46] * d[4];
+    v[5] = l[47] * d[5];
+    d[6] = a[48] - (l[42] * v[0] + l[43] * v[1] + l[44] * v[2] + l[45] * v[3] + l[46] * v[4] + l[47] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[48] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[41] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve7(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[7] * x[0]);
+    x[2] = b[2] - (l[14] * x[0] + l[15] * x[1]);
+    x[3] = b[3] - (l[21] * x[0] + l[22] * x[1] + l[23] * x[2]);
+    x[4] = b[4] - (l[28] * x[0] + l[29] * x[1] + l[30] * x[2] + l[31] * x[3]);
+    x[5] = b[5] - (l[35] * x[0] + l[36] * x[1] + l[37] * x[2] + l[38] * x[3] + l[39] * x[4]);
+    x[6] = b[6] - (l[42] * x[0] + l[43] * x[1] + l[44] * x[2] + l[45] * x[3] + l[46] * x[4] + l[47] * x[5]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[5] = x[5] - (l[47] * x[6]);
+    x[4] = x[4] - (l[39] * x[5] + l[46] * x[6]);
+    x[3] = x[3] - (l[31] * x[4] + l[38] * x[5] + l[45] * x[6]);
+    x[2] = x[2] - (l[23] * x[3] + l[30] * x[4] + l[37] * x[5] + l[44] * x[6]);
+    x[1] = x[1] - (l[15] * x[2] + l[22] * x[3] + l[29] * x[4] + l[36] * x[5] + l[43] * x[6]);
+    x[0] = x[0] - (l[7] * x[1] + l[14] * x[2] + l[21] * x[3] + l[28] * x[4] + l[35] * x[5] + l[42] * x[6]);
+}
+
+
+void Ifx_MatF32_add8(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+    c[49] = a[49] + b[49];
+    c[50] = a[50] + b[50];
+    c[51] = a[51] + b[51];
+    c[52] = a[52] + b[52];
+    c[53] = a[53] + b[53];
+    c[54] = a[54] + b[54];
+    c[55] = a[55] + b[55];
+    c[56] = a[56] + b[56];
+    c[57] = a[57] + b[57];
+    c[58] = a[58] + b[58];
+    c[59] = a[59] + b[59];
+    c[60] = a[60] + b[60];
+    c[61] = a[61] + b[61];
+    c[62] = a[62] + b[62];
+    c[63] = a[63] + b[63];
+}
+
+
+void Ifx_MatF32_transpose8(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[8];
+    c[2] = a[16];
+    c[3] = a[24];
+    c[4] = a[32];
+    c[5] = a[40];
+    c[6] = a[48];
+    c[7] = a[56];
+    c[8] = a[1];
+    c[9] = a[9];
+    c[10] = a[17];
+    c[11] = a[25];
+    c[12] = a[33];
+    c[13] = a[41];
+    c[14] = a[49];
+    c[15] = a[57];
+    c[16] = a[2];
+    c[17] = a[10];
+    c[18] = a[18];
+    c[19] = a[26];
+    c[20] = a[34];
+    c[21] = a[42];
+    c[22] = a[50];
+    c[23] = a[58];
+    c[24] = a[3];
+    c[25] = a[11];
+    c[26] = a[19];
+    c[27] = a[27];
+    c[28] = a[35];
+    c[29] = a[43];
+    c[30] = a[51];
+    c[31] = a[59];
+    c[32] = a[4];
+    c[33] = a[12];
+    c[34] = a[20];
+    c[35] = a[28];
+    c[36] = a[36];
+    c[37] = a[44];
+    c[38] = a[52];
+    c[39] = a[60];
+    c[40] = a[5];
+    c[41] = a[13];
+    c[42] = a[21];
+    c[43] = a[29];
+    c[44] = a[37];
+    c[45] = a[45];
+    c[46] = a[53];
+    c[47] = a[61];
+    c[48] = a[6];
+    c[49] = a[14];
+    c[50] = a[22];
+    c[51] = a[30];
+    c[52] = a[38];
+    c[53] = a[46];
+    c[54] = a[54];
+    c[55] = a[62];
+    c[56] = a[7];
+    c[57] = a[15];
+    c[58] = a[23];
+    c[59] = a[31];
+    c[60] = a[39];
+    c[61] = a[47];
+    c[62] = a[55];
+    c[63] = a[63];
+}
+
+
+void Ifx_MatF32_mul8(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[8] + a[2] * b[16] + a[3] * b[24] + a[4] * b[32] + a[5] * b[40]
+         + a[6] * b[48] + a[7] * b[56];
+    c[1] = a[0] * b[1] + a[1] * b[9] + a[2] * b[17] + a[3] * b[25] + a[4] * b[33] + a[5] * b[41]
+         + a[6] * b[49] + a[7] * b[57];
+    c[2] = a[0] * b[2] + a[1] * b[10] + a[2] * b[18] + a[3] * b[26] + a[4] * b[34] + a[5] * b[42]
+         + a[6] * b[50] + a[7] * b[58];
+    c[3] = a[0] * b[3] + a[1] * b[11] + a[2] * b[19] + a[3] * b[27] + a[4] * b[35] + a[5] * b[43]
+         + a[6] * b[51] + a[7] * b[59];
+    c[4] = a[0] * b[4] + a[1] * b[12] + a[2] * b[20] + a[3] * b[28] + a[4] * b[36] + a[5] * b[44]
+         + a[6] * b[52] + a[7] * b[60];
+    c[5] = a[0] * b[5] + a[1] * b[13] + a[2] * b[21] + a[3] * b[29] + a[4] * b[37] + a[5] * b[45]
+         + a[6] * b[53] + a[7] * b[61];
+    c[6] = a[0] * b[6] + a[1] * b[14] + a[2] * b[22] + a[3] * b[30] + a[4] * b[38] + a[5] * b[46]
+         + a[6] * b[54] + a[7] * b[62];
+    c[7] = a[0] * b[7] + a[1] * b[15] + a[2] * b[23] + a[3] * b[31] + a[4] * b[39] + a[5] * b[47]
+         + a[6] * b[55] + a[7] * b[63];
+    c[8] = a[8] * b[0] + a[9] * b[8] + a[10] * b[16] + a[11] * b[24] + a[12] * b[32] + a[13] * b[40]
+         + a[14] * b[48] + a[15] * b[56];
+    c[9] = a[8] * b[1] + a[9] * b[9] + a[10] * b[17] + a[11] * b[25] + a[12] * b[33] + a[13] * b[41]
+         + a[14] * b[49] + a[15] * b[57];
+    c[10] = a[8] * b[2] + a[9] * b[10] + a[10] * b[18] + a[11] * b[26] + a[12] * b[34] + a[13] * b[42]
+          + a[14] * b[50] + a[15] * b[58];
+    c[11] = a[8] * b[3] + a[9] * b[11] + a[10] * b[19] + a[11] * b[27] + a[12] * b[35] + a[13] * b[43]
+          + a[14] * b[51] + a[15] * b[59];
+    c[12] = a[8] * b[4] + a[9] * b[12] + a[10] * b[20] + a[11] * b[28] + a[12] * b[36] + a[13] * b[44]
+          + a[14] * b[52] + a[15] * b[60];
+    c[13] = a[8] * b[5] + a[9] * b[13] + a[10] * b[21] + a[11] * b[29] + a[12] * b[37] + a[13] * b[45]
+          + a[14] * b[53] + a[15] * b[61];
+    c[14] = a[8] * b[6] + a[9] * b[14] + a[10] * b[22] + a[11] * b[30] + a[12] * b[38] + a[13] * b[46]
+          + a[14] * b[54] + a[15] * b[62];
+    c[15] = a[8] * b[7] + a[9] * b[15] + a[10] * b[23] + a[11] * b[31] + a[12] * b[39] + a[13] * b[47]
+          + a[14] * b[55] + a[15] * b[63];
+    c[16] = a[16] * b[0] + a[17] * b[8] + a[18] * b[16] + a[19] * b[24] + a[20] * b[32] + a[21] * b[40]
+          + a[22] * b[48] + a[23] * b[56];
+    c[17] = a[16] * b[1] + a[17] * b[9] + a[18] * b[17] + a[19] * b[25] + a[20] * b[33] + a[21] * b[41]
+          + a[22] * b[49] + a[23] * b[57];
+    c[18] = a[16] * b[2] + a[17] * b[10] + a[18] * b[18] + a[19] * b[26] + a[20] * b[34] + a[21] * b[42]
+          + a[22] * b[50] + a[23] * b[58];
+    c[19] = a[16] * b[3] + a[17] * b[11] + a[18] * b[19] + a[19] * b[27] + a[20] * b[35] + a[21] * b[43]
+          + a[22] * b[51] + a[23] * b[59];
+    c[20] = a[16] * b[4] + a[17] * b[12] + a[18] * b[20] + a[19] * b[28] + a[20] * b[36] + a[21] * b[44]
+          + a[22] * b[52] + a[23] * b[60];
+    c[21] = a[16] * b[5] + a[17] * b[13] + a[18] * b[21] + a[19] * b[29] + a[20] * b[37] + a[21] * b[45]
+          + a[22] * b[53] + a[23] * b[61];
+    c[22] = a[16] * b[6] + a[17] * b[14] + a[18] * b[22] + a[19] * b[30] + a[20] * b[38] + a[21] * b[46]
+          + a[22] * b[54] + a[23] * b[62];
+    c[23] = a[16] * b[7] + a[17] * b[15] + a[18] * b[23] + a[19] * b[31] + a[20] * b[39] + a[21] * b[47]
+          + a[22] * b[55] + a[23] * b[63];
+    c[24] = a[24] * b[0] + a[25] * b[8] + a[26] * b[16] + a[27] * b[24] + a[28] * b[32] + a[29] * b[40]
+          + a[30] * b[48] + a[31] * b[56];
+    c[25] = a[24] * b[1] + a[25] * b[9] + a[26] * b[17] + a[27] * b[25] + a[28] * b[33] + a[29] * b[41]
+          + a[30] * b[49] + a[31] * b[57];
+    c[26] = a[24] * b[2] + a[25] * b[10] + a[26] * b[18] + a[27] * b[26] + a[28] * b[34] + a[29] * b[42]
+          + a[30] * b[50] + a[31] * b[58];
+    c[27] = a[24] * b[3] + a[25] * b[11] + a[26] * b[19] + a[27] * b[27] + a[28] * b[35] + a[29] * b[43]
+          + a[30] * b[51] + a[31] * b[59];
+    c[28] = a[24] * b[4] + a[25] * b[12] + a[26] * b[20] + a[27] * b[28] + a[28] * b[36] + a[29] * b[44]
+          + a[30] * b[52] + a[31] * b[60];
+    c[29] = a[24] * b[5] + a[25] * b[13] + a[26] * b[21] + a[27] * b[29] + a[28] * b[37] + a[29] * b[45]
+          + a[30] * b[53] + a[31] * b[61];
+    c[30] = a[24] * b[6] + a[25] * b[14] + a[26] * b[22] + a[27] * b[30] + a[28] * b[38] + a[29] * b[46]
+          + a[30] * b[54] + a[31] * b[62];
+    c[31] = a[24] * b[7] + a[25] * b[15] + a[26] * b[23] + a[27] * b[31] + a[28] * b[39] + a[29] * b[47]
+          + a[30] * b[55] + a[31] * b[63];
+    c[32] = a[32] * b[0] + a[33] * b[8] + a[34] * b[16] + a[35] * b[24] + a[36] * b[32] + a[37] * b[40]
+          + a[38] * b[48] + a[39] * b[56];
+    c[33] = a[32] * b[1] + a[33] * b[9] + a[34] * b[17] + a[35] * b[25] + a[36] * b[33] + a[37] * b[41]
+          + a[38] * b[49] + a[39] * b[57];
+    c[34] = a[32] * b[2] + a[33] * b[10] + a[34] * b[18] + a[35] * b[26] + a[36] * b[34] + a[37] * b[42]
+          + a[38] * b[50] + a[39] * b[58];
+    c[35] = a[32] * b[3] + a[33] * b[11] + a[34] * b[19] + a[35] * b[27] + a[36] * b[35] + a[37] * b[43]
+          + a[38] * b[51] + a[39] * b[59];
+    c[36] = a[32] * b[4] + a[33] * b[12] + a[34] * b[20] + a[35] * b[28] + a[36] * b[36] + a[37] * b[44]
+          + a[38] * b[52] + a[39] * b[60];
+    c[37] = a[32] * b[5] + a[33] * b[13] + a[34] * b[21] + a[35] * b[29] + a[36] * b[37] + a[37] * b[45]
+          + a[38] * b[53] + a[39] * b[61];
+    c[38] = a[32] * b[6] + a[33] * b[14] + a[34] * b[22] + a[35] * b[30] + a[36] * b[38] + a[37] * b[46]
+          + a[38] * b[54] + a[39] * b[62];
+    c[39] = a[32] * b[7] + a[33] * b[15] + a[34] * b[23] + a[35] * b[31] + a[36] * b[39] + a[37] * b[47]
+          + a[38] * b[55] + a[39] * b[63];
+    c[40] = a[40] * b[0] + a[41] * b[8] + a[42] * b[16] + a[43] * b[24] + a[44] * b[32] + a[45] * b[40]
+          + a[46] * b[48] + a[47] * b[56];
+    c[41] = a[40] * b[1] + a[41] * b[9] + a[42] * b[17] + a[43] * b[25] + a[44] * b[33] + a[45] * b[41]
+          + a[46] * b[49] + a[47] * b[57];
+    c[42] = a[40] * b[2] + a[41] * b[10] + a[42] * b[18] + a[43] * b[26] + a[44] * b[34] + a[45] * b[42]
+          + a[46] * b[50] + a[47] * b[58];
+    c[43] = a[40] * b[3] + a[41] * b[11] + a[42] * b[19] + a[43] * b[27] + a[44] * b[35] + a[45] * b[43]
+          + a[46] * b[51] + a[47] * b[59];
+    c[44] = a[40] * b[4] + a[41] * b[12] + a[42] * b[20] + a[43] * b[28] + a[44] * b[36] + a[45] * b[44]
+          + a[46] * b[52] + a[47] * b[60];
+    c[45] = a[40] * b[5] + a[41] * b[13] + a[42] * b[21] + a[43] * b[29] + a[44] * b[37] + a[45] * b[45]
+          + a[46] * b[53] + a[47] * b[61];
+    c[46] = a[40] * b[6] + a[41] * b[14] + a[42] * b[22] + a[43] * b[30] + a[44] * b[38] + a[45] * b[46]
+          + a[46] * b[54] + a[47] * b[62];
+    c[47] = a[40] * b[7] + a[41] * b[15] + a[42] * b[23] + a[43] * b[31] + a[44] * b[39] + a[45] * b[47]
+          + a[46] * b[55] + a[47] * b[63];
+    c[48] = a[48] * b[0] + a[49] * b[8] + a[50] * b[16] + a[51] * b[24] + a[52] * b[32] + a[53] * b[40]
+          + a[54] * b[48] + a[55] * b[56];
+    c[49] = a[48] * b[1] + a[49] * b[9] + a[50] * b[17] + a[51] * b[25] + a[52] * b[33] + a[53] * b[41]
+          + a[54] * b[49] + a[55] * b[57];
+    c[50] = a[48] * b[2] + a[49] * b[10] + a[50] * b[18] + a[51] * b[26] + a[52] * b[34] + a[53] * b[42]
+          + a[54] * b[50] + a[55] * b[58];
+    c[51] = a[48] * b[3] + a[49] * b[11] + a[50] * b[19] + a[51] * b[27] + a[52] * b[35] + a[53] * b[43]
+          + a[54] * b[51] + a[55] * b[59];
+    c[52] = a[48] * b[4] + a[49] * b[12] + a[50] * b[20] + a[51] * b[28] + a[52] * b[36] + a[53] * b[44]
+          + a[54] * b[52] + a[55] * b[60];
+    c[53] = a[48] * b[5] + a[49] * b[13] + a[50] * b[21] + a[51] * b[29] + a[52] * b[37] + a[53] * b[45]
+          + a[54] * b[53] + a[55] * b[61];
+    c[54] = a[48] * b[6] + a[49] * b[14] + a[50] * b[22] + a[51] * b[30] + a[52] * b[38] + a[53] * b[46]
+          + a[54] * b[54] + a[55] * b[62];
+    c[55] = a[48] * b[7] + a[49] * b[15] + a[50] * b[23] + a[51] * b[31] + a[52] * b[39] + a[53] * b[47]
+          + a[54] * b[55] + a[55] * b[63];
+    c[56] = a[56] * b[0] + a[57] * b[8] + a[58] * b[16] + a[59] * b[24] + a[60] * b[32] + a[61] * b[40]
+          + a[62] * b[48] + a[63] * b[56];
+    c[57] = a[56] * b[1] + a[57] * b[9] + a[58] * b[17] + a[59] * b[25] + a[60] * b[33] + a[61] * b[41]
+          + a[62] * b[49] + a[63] * b[57];
+    c[58] = a[56] * b[2] + a[57] * b[10] + a[58] * b[18] + a[59] * b[26] + a[60] * b[34] + a[61] * b[42]
+          + a[62] * b[50] + a[63] * b[58];
+    c[59] = a[56] * b[3] + a[57] * b[11] + a[58] * b[19] + a[59] * b[27] + a[60] * b[35] + a[61] * b[43]
+          + a[62] * b[51] + a[63] * b[59];
+    c[60] = a[56] * b[4] + a[57] * b[12] + a[58] * b[20] + a[59] * b[28] + a[60] * b[36] + a[61] * b[44]
+          + a[62] * b[52] + a[63] * b[60];
+    c[61] = a[56] * b[5] + a[57] * b[13] + a[58] * b[21] + a[59] * b[29] + a[60] * b[37] + a[61] * b[45]
+          + a[62] * b[53] + a[63] * b[61];
+    c[62] = a[56] * b[6] + a[57] * b[14] + a[58] * b[22] + a[59] * b[30] + a[60] * b[38] + a[61] * b[46]
+          + a[62] * b[54] + a[63] * b[62];
+    c[63] = a[56] * b[7] + a[57] * b[15] + a[58] * b[23] + a[59] * b[31] + a[60] * b[39] + a[61] * b[47]
+          + a[62] * b[55] + a[63] * b[63];
+}
+
+
+void Ifx_MatF32_mulVec8(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6]
+         + a[7] * x[7];
+    y[1] = a[8] * x[0] + a[9] * x[1] + a[10] * x[2] + a[11] * x[3] + a[12] * x[4] + a[13] * x[5]
+         + a[14] * x[6] + a[15] * x[7];
+    y[2] = a[16] * x[0] + a[17] * x[1] + a[18] * x[2] + a[19] * x[3] + a[20] * x[4] + a[21] * x[5]
+         + a[22] * x[6] + a[23] * x[7];
+    y[3] = a[24] * x[0] + a[25] * x[1] + a[26] * x[2] + a[27] * x[3] + a[28] * x[4] + a[29] * x[5]
+         + a[30] * x[6] + a[31] * x[7];
+    y[4] = a[32] * x[0] + a[33] * x[1] + a[34] * x[2] + a[35] * x[3] + a[36] * x[4] + a[37] * x[5]
+         + a[38] * x[6] + a[39] * x[7];
+    y[5] = a[40] * x[0] + a[41] * x[1] + a[42] * x[2] + a[43] * x[3] + a[44] * x[4] + a[45] * x[5]
+         + a[46] * x[6] + a[47] * x[7];
+    y[6] = a[48] * x[0] + a[49] * x[1] + a[50] * x[2] + a[51] * x[3] + a[52] * x[4] + a[53] * x[5]
+         + a[54] * x[6] + a[55] * x[7];
+    y[7] = a[56] * x[0] + a[57] * x[1] + a[58] * x[2] + a[59] * x[3] + a[60] * x[4] + a[61] * x[5]
+         + a[62] * x[6] + a[63] * x[7];
+}
+
+
+boolean Ifx_MatF32_cholesky8(float32 *l, const float32 *a)
+{
+    float32 inv[8];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[8] = a[8] * inv[0];
+    l[16] = a[16] * inv[0];
+    l[24] = a[24] * inv[0];
+    l[32] = a[32] * inv[0];
+    l[40] = a[40] * inv[0];
+    l[48] = a[48] * inv[0];
+    l[56] = a[56] * inv[0];
+    pivot = a[9] - (l[8] * l[8]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[9] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[9];
+    l[17] = (a[17] - (l[16] * l[8])) * inv[1];
+    l[25] = (a[25] - (l[24] * l[8])) * inv[1];
+    l[33] = (a[33] - (l[32] * l[8])) * inv[1];
+    l[41] = (a[41] - (l[40] * l[8])) * inv[1];
+    l[49] = (a[49] - (l[48] * l[8])) * inv[1];
+    l[57] = (a[57] - (l[56] * l[8])) * inv[1];
+    pivot = a[18] - (l[16] * l[16] + l[17] * l[17]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[18] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[18];
+    l[26] = (a[26] - (l[24] * l[16] + l[25] * l[17])) * inv[2];
+    l[34] = (a[34] - (l[32] * l[16] + l[33] * l[17])) * inv[2];
+    l[42] = (a[42] - (l[40] * l[16] + l[41] * l[17])) * inv[2];
+    l[50] = (a[50] - (l[48] * l[16] + l[49] * l[17])) * inv[2];
+    l[58] = (a[58] - (l[56] * l[16] + l[57] * l[17])) * inv[2];
+    pivot = a[27] - (l[24] * l[24] + l[25] * l[25] + l[26] * l[26]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[27] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[27];
+    l[35] = (a[35] - (l[32] * l[24] + l[33] * l[25] + l[34] * l[26])) * inv[3];
+    l[43] = (a[43] - (l[40] * l[24] + l[41] * l[25] + l[42] * l[26])) * inv[3];
+    l[51] = (a[51] - (l[48] * l[24] + l[49] * l[25] + l[50] * l[26])) * inv[3];
+    l[59] = (a[59] - (l[56] * l[24] + l[57] * l[25] + l[58] * l[26])) * inv[3];
+    pivot = a[36] - (l[32] * l[32] + l[33] * l[33] + l[34] * l[34] + l[35] * l[35]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[36] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[36];
+    l[44] = (a[44] - (l[40] * l[32] + l[41] * l[33] + l[42] * l[34] + l[43] * l[35])) * inv[4];
+    l[52] = (a[52] - (l[48] * l[32] + l[49] * l[33] + l[50] * l[34] + l[51] * l[35])) * inv[4];
+    l[60] = (a[60] - (l[56] * l[32] + l[57] * l[33] + l[58] * l[34] + l[59] * l[35])) * inv[4];
+    pivot = a[45] - (l[40] * l[40] + l[41] * l[41] + l[42] * l[42] + l[43] * l[43] + l[44] * l[44]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[45] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[45];
+    l[53] = (a[53] - (l[48] * l[40] + l[49] * l[41] + l[50] * l[42] + l[51] * l[43] + l[52] * l[44])) * inv[5];
+    l[61] = (a[61] - (l[56] * l[40] + l[57] * l[41] + l[58] * l[42] + l[59] * l[43] + l[60] * l[44])) * inv[5];
+    pivot = a[54] - (l[48] * l[48] + l[49] * l[49] + l[50] * l[50] + l[51] * l[51] + l[52] * l[52]
+                   + l[53] * l[53]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[54] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[54];
+    l[62] = (a[62] - (l[56] * l[48] + l[57] * l[49] + l[58] * l[50] + l[59] * l[51] + l[60] * l[52]
+                    + l[61] * l[53])) * inv[6];
+    pivot = a[63] - (l[56] * l[56] + l[57] * l[57] + l[58] * l[58] + l[59] * l[59] + l[60] * l[60]
+                   + l[61] * l[61] + l[62] * l[62]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[63] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[7] = 1.0f / l[63];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[55] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve8(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[8] * x[0])) / l[9];
+    x[2] = (b[2] - (l[16] * x[0] + l[17] * x[1])) / l[18];
+    x[3] = (b[3] - (l[24] * x[0] + l[25] * x[1] + l[26] * x[2])) / l[27];
+    x[4] = (b[4] - (l[32] * x[0] + l[33] * x[1] + l[34] * x[2] + l[35] * x[3])) / l[36];
+    x[5] = (b[5] - (l[40] * x[0] + l[41] * x[1] + l[42] * x[2] + l[43] * x[3] + l[44] * x[4])) / l[45];
+    x[6] = (b[6] - (l[48] * x[0] + l[49] * x[1] + l[50] * x[2] + l[51] * x[3] + l[52] * x[4] + l[53] * x[5])) / l[54];
+    x[7] = (b[7] - (l[56] * x[0] + l[57] * x[1] + l[58] * x[2] + l[59] * x[3] + l[60] * x[4] + l[61] * x[5]
+                  + l[62] * x[6])) / l[63];
+    x[7] = x[7] / l[63];
+    x[6] = (x[6] - (l[62] * x[7])) / l[54];
+    x[5] = (x[5] - (l[53] * x[6] + l[61] * x[7])) / l[45];
+    x[4] = (x[4] - (l[44] * x[5] + l[52] * x[6] + l[60] * x[7])) / l[36];
+    x[3] = (x[3] - (l[35] * x[4] + l[43] * x[5] + l[51] * x[6] + l[59] * x[7])) / l[27];
+    x[2] = (x[2] - (l[26] * x[3] + l[34] * x[4] + l[42] * x[5] + l[50] * x[6] + l[58] * x[7])) / l[18];
+    x[1] = (x[1] - (l[17] * x[2] + l[25] * x[3] + l[33] * x[4] + l[41] * x[5] + l[49] * x[6] + l[57] * x[7])) / l[9];
+    x[0] = (x[0] - (l[8] * x[1] + l[16] * x[2] + l[24] * x[3] + l[32] * x[4] + l[40] * x[5] + l[48] * x[6]
+                  + l[56] * x[7])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl8(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[8];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[8] = a[8] * inv;
+    l[16] = a[16] * inv;
+    l[24] = a[24] * inv;
+    l[32] = a[32] * inv;
+    l[40] = a[40] * inv;
+    l[48] = a[48] * inv;
+    l[56] = a[56] * inv;
+    l[0] = 1.0f;
+    v[0] = l[8] * d[0];
+    d[1] = a[9] - (l[8] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[17] = (a[17] - (l[16] * v[0])) * inv;
+    l[25] = (a[25] - (l[24] * v[0])) * inv;
+    l[33] = (a[33] - (l[32] * v[0])) * inv;
+    l[41] = (a[41] - (l[40] * v[0])) * inv;
+    l[49] = (a[49] - (l[48] * v[0])) * inv;
+    l[57] = (a[57] - (l[56] * v[0])) * inv;
+    l[9] = 1.0f;
+    v[0] = l[16] * d[0];
+    v[1] = l[17] * d[1];
+    d[2] = a[18] - (l[16] * v[0] + l[17] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[26] = (a[26] - (l[24] * v[0] + l[25] * v[1])) * inv;
+    l[34] = (a[34] - (l[32] * v[0] + l[33] * v[1])) * inv;
+    l[42] = (a[42] - (l[40] * v[0] + l[41] * v[1])) * inv;
+    l[50] = (a[50] - (l[48] * v[0] + l[49] * v[1])) * inv;
+    l[58] = (a[58] - (l[56] * v[0] + l[57] * v[1])) * inv;
+    l[18] = 1.0f;
+    v[0] = l[24] * d[0];
+    v[1] = l[25] * d[1];
+    v[2] = l[26] * d[2];
+    d[3] = a[27] - (l[24] * v[0] + l[25] * v[1] + l[26] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[35] = (a[35] - (l[32] * v[0] + l[33] * v[1] + l[34] * v[2])) * inv;
+    l[43] = (a[43] - (l[40] * v[0] + l[41] * v[1] + l[42] * v[2])) * inv;
+    l[51] = (a[51] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2])) * inv;
+    l[59] = (a[59] - (l[56] * v[0] + l[57] * v[1] + l[58] * v[2])) * inv;
+    l[27] = 1.0f;
+    v[0] = l[32] * d[0];
+    v[1] = l[33] * d[1];
+    v[2] = l[34] * d[2];
+    v[3] = l[35] * d[3];
+    d[4] = a[36] - (l[32] * v[0] + l[33] * v[1] + l[34] * v[2] + l[35] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[44] = (a[44] - (l[40] * v[0] + l[41] * v[1] + l[42] * v[2] + l[43] * v[3])) * inv;
+    l[52] = (a[52] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2] + l[51] * v[3])) * inv;
+    l[60] = (a[60] - (l[56] * v[0] + l[57] * v[1] + l[58] * v[2] + l[59] * v[3])) * inv;
+    l[36] = 1.0f;
+    v[0] = l[40] * d[0];
+    v[1] = l[41] * d[1];
+    v[2] = l[42] * d[2];
+    v[3] = l[43] * d[3];
+    v[4] = l[44] * d[4];
+    d[5] = a[45] - (l[40] * v[0] + l[41] * v[1] + l[42] * v[2] + l[43] * v[3] + l[44] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[53] = (a[53] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2] + l[51] * v[3] + l[52] * v[4])) * inv;
+    l[61] = (a[61] - (l[56] * v[0] + l[57] * v[1] + l[58] * v[2] + l[59] * v[3] + l[60] * v[4])) * inv;
+    l[45] = 1.0f;
+    v[0] = l[48] * d[0];
+    v[1] = l[49] * d[1];
+    v[2] = l[50] * d[2];
+    v[3] = l[51] * d[3];
+    v[4] = l[52] * d[4];
+    v[5] = l[53] * d[5];
+    d[6] = a[54] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2] + l[51] * v[3] + l[52] * v[4] + l[53] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[62] = (a[62] - (l[56] * v[0] + l[57] * v[1] + l[58] * v[2] + l[59] * v[3] + l[60] * v[4] + l[61] * v[5])) * inv;
+    l[54] = 1.0f;
+    v[0] = l[56] * d[0];
+    v[1] = l[57] * d[1];
+    v[2] = l[58] * d[2];
+    v[3] = l[59] * d[3];
+    v[4] = l[60] * d[4];
+    v[5] = l[61] * d[5];
+    v[6] = l[62] * d[6];
+    d[7] = a[63] - (l[56] * v[0] + l[57] * v[1] + l[58] * v[2] + l[59] * v[3] + l[60] * v[4] + l[61] * v[5]
+                  + l[62] * v[6]);
+    ok  &= (boolean)(d[7] != 0.0f);
+    inv  = 1.0f / ((d[7] != 0.0f) ? d[7] : 1.0f);
+    l[63] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[55] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve8(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[8] * x[0]);
+    x[2] = b[2] - (l[16] * x[0] + l[17] * x[1]);
+    x[3] = b[3] - (l[24] * x[0] + l[25] * x[1] + l[26] * x[2]);
+    x[4] = b[4] - (l[32] * x[0] + l[33] * x[1] + l[34] * x[2] + l[35] * x[3]);
+    x[5] = b[5] - (l[40] * x[0] + l[41] * x[1] + l[42] * x[2] + l[43] * x[3] + l[44] * x[4]);
+    x[6] = b[6] - (l[48] * x[0] + l[49] * x[1] + l[50] * x[2] + l[51] * x[3] + l[52] * x[4] + l[53] * x[5]);
+    x[7] = b[7] - (l[56] * x[0] + l[57] * x[1] + l[58] * x[2] + l[59] * x[3] + l[60] * x[4] + l[61] * x[5]
+                 + l[62] * x[6]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[7] = x[7] / d[7];
+    x[6] = x[6] - (l[62] * x[7]);
+    x[5] = x[5] - (l[53] * x[6] + l[61] * x[7]);
+    x[4] = x[4] - (l[44] * x[5] + l[52] * x[6] + l[60] * x[7]);
+    x[3] = x[3] - (l[35] * x[4] + l[43] * x[5] + l[51] * x[6] + l[59] * x[7]);
+    x[2] = x[2] - (l[26] * x[3] + l[34] * x[4] + l[42] * x[5] + l[50] * x[6] + l[58] * x[7]);
+    x[1] = x[1] - (l[17] * x[2] + l[25] * x[3] + l[33] * x[4] + l[41] * x[5] + l[49] * x[6] + l[57] * x[7]);
+    x[0] = x[0] - (l[8] * x[1] + l[16] * x[2] + l[24] * x[3] + l[32] * x[4] + l[40] * x[5] + l[48] * x[6]
+                 + l[56] * x[7]);
+}
+
+
+void Ifx_MatF32_add9(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+    c[49] = a[49] + b[49];
+    c[50] = a[50] + b[50];
+    c[51] = a[51] + b[51];
+    c[52] = a[52] + b[52];
+    c[53] = a[53] + b[53];
+    c[54] = a[54] + b[54];
+    c[55] = a[55] + b[55];
+    c[56] = a[56] + b[56];
+    c[57] = a[57] + b[57];
+    c[58] = a[58] + b[58];
+    c[59] = a[59] + b[59];
+    c[60] = a[60] + b[60];
+    c[61] = a[61] + b[61];
+    c[62] = a[62] + b[62];
+    c[63] = a[63] + b[63];
+    c[64] = a[64] + b[64];
+    c[65] = a[65] + b[65];
+    c[66] = a[66] + b[66];
+    c[67] = a[67] + b[67];
+    c[68] = a[68] + b[68];
+    c[69] = a[69] + b[69];
+    c[70] = a[70] + b[70];
+    c[71] = a[71] + b[71];
+    c[72] = a[72] + b[72];
+    c[73] = a[73] + b[73];
+    c[74] = a[74] + b[74];
+    c[75] = a[75] + b[75];
+    c[76] = a[76] + b[76];
+    c[77] = a[77] + b[77];
+    c[78] = a[78] + b[78];
+    c[79] = a[79] + b[79];
+    c[80] = a[80] + b[80];
+}
+
+
+void Ifx_MatF32_transpose9(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[9];
+    c[2] = a[18];
+    c[3] = a[27];
+    c[4] = a[36];
+    c[5] = a[45];
+    c[6] = a[54];
+    c[7] = a[63];
+    c[8] = a[72];
+    c[9] = a[1];
+    c[10] = a[10];
+    c[11] = a[19];
+    c[12] = a[28];
+    c[13] = a[37];
+    c[14] = a[46];
+    c[15] = a[55];
+    c[16] = a[64];
+    c[17] = a[73];
+    c[18] = a[2];
+    c[19] = a[11];
+    c[20] = a[20];
+    c[21] = a[29];
+    c[22] = a[38];
+    c[23] = a[47];
+    c[24] = a[56];
+    c[25] = a[65];
+    c[26] = a[74];
+    c[27] = a[3];
+    c[28] = a[12];
+    c[29] = a[21];
+    c[30] = a[30];
+    c[31] = a[39];
+    c[32] = a[48];
+    c[33] = a[57];
+    c[34] = a[66];
+    c[35] = a[75];
+    c[36] = a[4];
+    c[37] = a[13];
+    c[38] = a[22];
+    c[39] = a[31];
+    c[40] = a[40];
+    c[41] = a[49];
+    c[42] = a[58];
+    c[43] = a[67];
+    c[44] = a[76];
+    c[45] = a[5];
+    c[46] = a[14];
+    c[47] = a[23];
+    c[48] = a[32];
+    c[49] = a[41];
+    c[50] = a[50];
+    c[51] = a[59];
+    c[52] = a[68];
+    c[53] = a[77];
+    c[54] = a[6];
+    c[55] = a[15];
+    c[56] = a[24];
+    c[57] = a[33];
+    c[58] = a[42];
+    c[59] = a[51];
+    c[60] = a[60];
+    c[61] = a[69];
+    c[62] = a[78];
+    c[63] = a[7];
+    c[64] = a[16];
+    c[65] = a[25];
+    c[66] = a[34];
+    c[67] = a[43];
+    c[68] = a[52];
+    c[69] = a[61];
+    c[70] = a[70];
+    c[71] = a[79];
+    c[72] = a[8];
+    c[73] = a[17];
+    c[74] = a[26];
+    c[75] = a[35];
+    c[76] = a[44];
+    c[77] = a[53];
+    c[78] = a[62];
+    c[79] = a[71];
+    c[80] = a[80];
+}
+
+
+void Ifx_MatF32_mul9(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[9] + a[2] * b[18] + a[3] * b[27] + a[4] * b[36] + a[5] * b[45]
+         + a[6] * b[54] + a[7] * b[63] + a[8] * b[72];
+    c[1] = a[0] * b[1] + a[1] * b[10] + a[2] * b[19] + a[3] * b[28] + a[4] * b[37] + a[5] * b[46]
+         + a[6] * b[55] + a[7] * b[64] + a[8] * b[73];
+    c[2] = a[0] * b[2] + a[1] * b[11] + a[2] * b[20] + a[3] * b[29] + a[4] * b[38] + a[5] * b[47]
+         + a[6] * b[56] + a[7] * b[65] + a[8] * b[74];
+    c[3] = a[0] * b[3] + a[1] * b[12] + a[2] * b[21] + a[3] * b[30] + a[4] * b[39] + a[5] * b[48]
+         + a[6] * b[57] + a[7] * b[66] + a[8] * b[75];
+    c[4] = a[0] * b[4] + a[1] * b[13] + a[2] * b[22] + a[3] * b[31] + a[4] * b[40] + a[5] * b[49]
+         + a[6] * b[58] + a[7] * b[67] + a[8] * b[76];
+    c[5] = a[0] * b[5] + a[1] * b[14] + a[2] * b[23] + a[3] * b[32] + a[4] * b[41] + a[5] * b[50]
+         + a[6] * b[59] + a[7] * b[68] + a[8] * b[77];
+    c[6] = a[0] * b[6] + a[1] * b[15] + a[2] * b[24] + a[3] * b[33] + a[4] * b[42] + a[5] * b[51]
+         + a[6] * b[60] + a[7] * b[69] + a[8] * b[78];
+    c[7] = a[0] * b[7] + a[1] * b[16] + a[2] * b[25] + a[3] * b[34] + a[4] * b[43] + a[5] * b[52]
+         + a[6] * b[61] + a[7] * b[70] + a[8] * b[79];
+    c[8] = a[0] * b[8] + a[1] * b[17] + a[2] * b[26] + a[3] * b[35] + a[4] * b[44] + a[5] * b[53]
+         + a[6] * b[62] + a[7] * b[71] + a[8] * b[80];
+    c[9] = a[9] * b[0] + a[10] * b[9] + a[11] * b[18] + a[12] * b[27] + a[13] * b[36] + a[14] * b[45]
+         + a[15] * b[54] + a[16] * b[63] + a[17] * b[72];
+    c[10] = a[9] * b[1] + a[10] * b[10] + a[11] * b[19] + a[12] * b[28] + a[13] * b[37] + a[14] * b[46]
+          + a[15] * b[55] + a[16] * b[64] + a[17] * b[73];
+    c[11] = a[9] * b[2] + a[10] * b[11] + a[11] * b[20] + a[12] * b[29] + a[13] * b[38] + a[14] * b[47]
+          + a[15] * b[56] + a[16] * b[65] + a[17] * b[74];
+    c[12] = a[9] * b[3] + a[10] * b[12] + a[11] * b[21] + a[12] * b[30] + a[13] * b[39] + a[14] * b[48]
+          + a[15] * b[57] + a[16] * b[66] + a[17] * b[75];
+    c[13] = a[9] * b[4] + a[10] * b[13] + a[11] * b[22] + a[12] * b[31] + a[13] * b[40] + a[14] * b[49]
+          + a[15] * b[58] + a[16] * b[67] + a[17] * b[76];
+    c[14] = a[9] * b[5] + a[10] * b[14] + a[11] * b[23] + a[12] * b[32] + a[13] * b[41] + a[14] * b[50]
+          + a[15] * b[59] + a[16] * b[68] + a[17] * b[77];
+    c[15] = a[9] * b[6] + a[10] * b[15] + a[11] * b[24] + a[12] * b[33] + a[13] * b[42] + a[14] * b[51]
+          + a[15] * b[60] + a[16] * b[69] + a[17] * b[78];
+    c[16] = a[9] * b[7] + a[10] * b[16] + a[11] * b[25] + a[12] * b[34] + a[13] * b[43] + a[14] * b[52]
+          + a[15] * b[61] + a[16] * b[70] + a[17] * b[79];
+    c[17] = a[9] * b[8] + a[10] * b[17] + a[11] * b[26] + a[12] * b[35] + a[13] * b[44] + a[14] * b[53]
+          + a[15] * b[62] + a[16] * b[71] + a[17] * b[80];
+    c[18] = a[18] * b[0] + a[19] * b[9] + a[20] * b[18] + a[21] * b[27] + a[22] * b[36] + a[23] * b[45]
+          + a[24] * b[54] + a[25] * b[63] + a[26] * b[72];
+    c[19] = a[18] * b[1] + a[19] * b[10] + a[20] * b[19] + a[21] * b[28] + a[22] * b[37] + a[23] * b[46]
+          + a[24] * b[55] + a[25] * b[64] + a[26] * b[73];
+    c[20] = a[18] * b[2] + a[19] * b[11] + a[20] * b[20] + a[21] * b[29] + a[22] * b[38] + a[23] * b[47]
+          + a[24] * b[56] + a[25] * b[65] + a[26] * b[74];
+    c[21] = a[18] * b[3] + a[19] * b[12] + a[20] * b[21] + a[21] * b[30] + a[22] * b[39] + a[23] * b[48]
+          + a[24] * b[57] + a[25] * b[66] + a[26] * b[75];
+    c[22] = a[18] * b[4] + a[19] * b[13] + a[20] * b[22] + a[21] * b[31] + a[22] * b[40] + a[23] * b[49]
+          + a[24] * b[58] + a[25] * b[67] + a[26] * b[76];
+    c[23] = a[18] * b[5] + a[19] * b[14] + a[20] * b[23] + a[21] * b[32] + a[22] * b[41] + a[23] * b[50]
+          + a[24] * b[59] + a[25] * b[68] + a[26] * b[77];
+    c[24] = a[18] * b[6] + a[19] * b[15] + a[20] * b[24] + a[21] * b[33] + a[22] * b[42] + a[23] * b[51]
+          + a[24] * b[60] + a[25] * b[69] + a[26] * b[78];
+    c[25] = a[18] * b[7] + a[19] * b[16] + a[20] * b[25] + a[21] * b[34] + a[22] * b[43] + a[23] * b[52]
+          + a[24] * b[61] + a[25] * b[70] + a[26] * b[79];
+    c[26] = a[18] * b[8] + a[19] * b[17] + a[20] * b[26] + a[21] * b[35] + a[22] * b[44] + a[23] * b[53]
+          + a[24] * b[62] + a[25] * b[71] + a[26] * b[80];
+    c[27] = a[27] * b[0] + a[28] * b[9] + a[29] * b[18] + a[30] * b[27] + a[31] * b[36] + a[32] * b[45]
+          + a[33] * b[54] + a[34] * b[63] + a[35] * b[72];
+    c[28] = a[27] * b[1] + a[28] * b[10] + a[29] * b[19] + a[30] * b[28] + a[31] * b[37] + a[32] * b[46]
+          + a[33] * b[55] + a[34] * b[64] + a[35] * b[73];
+    c[29] = a[27] * b[2] + a[28] * b[11] + a[29] * b[20] + a[30] * b[29] + a[31] * b[38] + a[32] * b[47]
+          + a[33] * b[56] + a[34] * b[65] + a[35] * b[74];
+    c[30] = a[27] * b[3] + a[28] * b[12] + a[29] * b[21] + a[30] * b[30] + a[31] * b[39] + a[32] * b[48]
+          + a[33] * b[57] + a[34] * b[66] + a[35] * b[75];
+    c[31] = a[27] * b[4] + a[28] * b[13] + a[29] * b[22] + a[30] * b[31] + a[31] * b[40] + a[32] * b[49]
+          + a[33] * b[58] + a[34] * b[67] + a[35] * b[76];
+    c[32] = a[27] * b[5] + a[28] * b[14] + a[29] * b[23] + a[30] * b[32] + a[31] * b[41] + a[32] * b[50]
+          + a[33] * b[59] + a[34] * b[68] + a[35] * b[77];
+    c[33] = a[27] * b[6] + a[28] * b[15] + a[29] * b[24] + a[30] * b[33] + a[31] * b[42] + a[32] * b[51]
+          + a[33] * b[60] + a[34] * b[69] + a[35] * b[78];
+    c[34] = a[27] * b[7] + a[28] * b[16] + a[29] * b[25] + a[30] * b[34] + a[31] * b[43] + a[32] * b[52]
+          + a[33] * b[61] + a[34] * b[70] + a[35] * b[79];
+    c[35] = a[27] * b[8] + a[28] * b[17] + a[29] * b[26] + a[30] * b[35] + a[31] * b[44] + a[32] * b[53]
+          + a[33] * b[62] + a[34] * b[71] + a[35] * b[80];
+    c[36] = a[36] * b[0] + a[37] * b[9] + a[38] * b[18] + a[39] * b[27] + a[40] * b[36] + a[41] * b[45]
+          + a[42] * b[54] + a[43] * b[63] + a[44] * b[72];
+    c[37] = a[36] * b[1] + a[37] * b[10] + a[38] * b[19] + a[39] * b[28] + a[40] * b[37] + a[41] * b[46]
+          + a[42] * b[55] + a[43] * b[64] + a[44] * b[73];
+    c[38] = a[36] * b[2] + a[37] * b[11] + a[38] * b[20] + a[39] * b[29] + a[40] * b[38] + a[41] * b[47]
+          + a[42] * b[56] + a[43] * b[65] + a[44] * b[74];
+    c[39] = a[36] * b[3] + a[37] * b[12] + a[38] * b[21] + a[39] * b[30] + a[40] * b[39] + a[41] * b[48]
+          + a[42] * b[57] + a[43] * b[66] + a[44] * b[75];
+    c[40] = a[36] * b[4] + a[37] * b[13] + a[38] * b[22] + a[39] * b[31] + a[40] * b[40] + a[41] * b[49]
+          + a[42] * b[58] + a[43] * b[67] + a[44] * b[76];
+    c[41] = a[36] * b[5] + a[37] * b[14] + a[38] * b[23] + a[39] * b[32] + a[40] * b[41] + a[41] * b[50]
+          + a[42] * b[59] + a[43] * b[68] + a[44] * b[77];
+    c[42] = a[36] * b[6] + a[37] * b[15] + a[38] * b[24] + a[39] * b[33] + a[40] * b[42] + a[41] * b[51]
+          + a[42] * b[60] + a[43] * b[69] + a[44] * b[78];
+    c[43] = a[36] * b[7] + a[37] * b[16] + a[38] * b[25] + a[39] * b[34] + a[40] * b[43] + a[41] * b[52]
+          + a[42] * b[61] + a[43] * b[70] + a[44] * b[79];
+    c[44] = a[36] * b[8] + a[37] * b[17] + a[38] * b[26] + a[39] * b[35] + a[40] * b[44] + a[41] * b[53]
+          + a[42] * b[62] + a[43] * b[71] + a[44] * b[80];
+    c[45] = a[45] * b[0] + a[46] * b[9] + a[47] * b[18] + a[48] * b[27] + a[49] * b[36] + a[50] * b[45]
+          + a[51] * b[54] + a[52] * b[63] + a[53] * b[72];
+    c[46] = a[45] * b[1] + a[46] * b[10] + a[47] * b[19] + a[48] * b[28] + a[49] * b[37] + a[50] * b[46]
+          + a[51] * b[55] + a[52] * b[64] + a[53] * b[73];
+    c[47] = a[45] * b[2] + a[46] * b[11] + a[47] * b[20] + a[48] * b[29] + a[49] * b[38] + a[50] * b[47]
+          + a[51] * b[56] + a[52] * b[65] + a[53] * b[74];
+    c[48] = a[45] * b[3] + a[46] * b[12] + a[47] * b[21] + a[48] * b[30] + a[49] * b[39] + a[50] * b[48]
+          + a[51] * b[57] + a[52] * b[66] + a[53] * b[75];
+    c[49] = a[45] * b[4] + a[46] * b[13] + a[47] * b[22] + a[48] * b[31] + a[49] * b[40] + a[50] * b[49]
+          + a[51] * b[58] + a[52] * b[67] + a[53] * b[76];
+    c[50] = a[45] * b[5] + a[46] * b[14] + a[47] * b[23] + a[48] * b[32] + a[49] * b[41] + a[50] * b[50]
+          + a[51] * b[59] + a[52] * b[68] + a[53] * b[77];
+    c[51] = a[45] * b[6] + a[46] * b[15] + a[47] * b[24] + a[48] * b[33] + a[49] * b[42] + a[50] * b[51]
+          + a[51] * b[60] + a[52] * b[69] + a[53] * b[78];
+    c[52] = a[45] * b[7] + a[46] * b[16] + a[47] * b[25] + a[48] * b[34] + a[49] * b[43] + a[50] * b[52]
+          + a[51] * b[61] + a[52] * b[70] + a[53] * b[79];
+    c[53] = a[45] * b[8] + a[46] * b[17] + a[47] * b[26] + a[48] * b[35] + a[49] * b[44] + a[50] * b[53]
+          + a[51] * b[62] + a[52] * b[71] + a[53] * b[80];
+    c[54] = a[54] * b[0] + a[55] * b[9] + a[56] * b[18] + a[57] * b[27] + a[58] * b[36] + a[59] * b[45]
+          + a[60] * b[54] + a[61] * b[63] + a[62] * b[72];
+    c[55] = a[54] * b[1] + a[55] * b[10] + a[56] * b[19] + a[57] * b[28] + a[58] * b[37] + a[59] * b[46]
+          + a[60] * b[55] + a[61] * b[64] + a[62] * b[73];
+    c[56] = a[54] * b[2] + a[55] * b[11] + a[56] * b[20] + a[57] * b[29] + a[58] * b[38] + a[59] * b[47]
+          + a[60] * b[56] + a[61] * b[65] + a[62] * b[74];
+    c[57] = a[54] * b[3] + a[55] * b[12] + a[56] * b[21] + a[57] * b[30] + a[58] * b[39] + a[59] * b[48]
+          + a[60] * b[57] + a[61] * b[66] + a[62] * b[75];
+    c[58] = a[54] * b[4] + a[55] * b[13] + a[56] * b[22] + a[57] * b[31] + a[58] * b[40] + a[59] * b[49]
+          + a[60] * b[58] + a[61] * b[67] + a[62] * b[76];
+    c[59] = a[54] * b[5] + a[55] * b[14] + a[56] * b[23] + a[57] * b[32] + a[58] * b[41] + a[59] * b[50]
+          + a[60] * b[59] + a[61] * b[68] + a[62] * b[77];
+    c[60] = a[54] * b[6] + a[55] * b[15] + a[56] * b[24] + a[57] * b[33] + a[58] * b[42] + a[59] * b[51]
+          + a[60] * b[60] + a[61] * b[69] + a[62] * b[78];
+    c[61] = a[54] * b[7] + a[55] * b[16] + a[56] * b[25] + a[57] * b[34] + a[58] * b[43] + a[59] * b[52]
+          + a[60] * b[61] + a[61] * b[70] + a[62] * b[79];
+    c[62] = a[54] * b[8] + a[55] * b[17] + a[56] * b[26] + a[57] * b[35] + a[58] * b[44] + a[59] * b[53]
+          + a[60] * b[62] + a[61] * b[71] + a[62] * b[80];
+    c[63] = a[63] * b[0] + a[64] * b[9] + a[65] * b[18] + a[66] * b[27] + a[67] * b[36] + a[68] * b[45]
+          + a[69] * b[54] + a[70] * b[63] + a[71] * b[72];
+    c[64] = a[63] * b[1] + a[64] * b[10] + a[65] * b[19] + a[66] * b[28] + a[67] * b[37] + a[68] * b[46]
+          + a[69] * b[55] + a[70] * b[64] + a[71] * b[73];
+    c[65] = a[63] * b[2] + a[64] * b[11] + a[65] * b[20] + a[66] * b[29] + a[67] * b[38] + a[68] * b[47]
+          + a[69] * b[56] + a[70] * b[65] + a[71] * b[74];
+    c[66] = a[63] * b[3] + a[64] * b[12] + a[65] * b[21] + a[66] * b[30] + a[67] * b[39] + a[68] * b[48]
+          + a[69] * b[57] + a[70] * b[66] + a[71] * b[75];
+    c[67] = a[63] * b[4] + a[64] * b[13] + a[65] * b[22] + a[66] * b[31] + a[67] * b[40] + a[68] * b[49]
+          + a[69] * b[58] + a[70] * b[67] + a[71] * b[76];
+    c[68] = a[63] * b[5] + a[64] * b[14] + a[65] * b[23] + a[66] * b[32] + a[67] * b[41] + a[68] * b[50]
+          + a[69] * b[59] + a[70] * b[68] + a[71] * b[77];
+    c[69] = a[63] * b[6] + a[64] * b[15] + a[65] * b[24] + a[66] * b[33] + a[67] * b[42] + a[68] * b[51]
+          + a[69] * b[60] + a[70] * b[69] + a[71] * b[78];
+    c[70] = a[63] * b[7] + a[64] * b[16] + a[65] * b[25] + a[66] * b[34] + a[67] * b[43] + a[68] * b[52]
+          + a[69] * b[61] + a[70] * b[70] + a[71] * b[79];
+    c[71] = a[63] * b[8] + a[64] * b[17] + a[65] * b[26] + a[66] * b[35] + a[67] * b[44] + a[68] * b[53]
+          + a[69] * b[62] + a[70] * b[71] + a[71] * b[80];
+    c[72] = a[72] * b[0] + a[73] * b[9] + a[74] * b[18] + a[75] * b[27] + a[76] * b[36] + a[77] * b[45]
+          + a[78] * b[54] + a[79] * b[63] + a[80] * b[72];
+    c[73] = a[72] * b[1] + a[73] * b[10] + a[74] * b[19] + a[75] * b[28] + a[76] * b[37] + a[77] * b[46]
+          + a[78] * b[55] + a[79] * b[64] + a[80] * b[73];
+    c[74] = a[72] * b[2] + a[73] * b[11] + a[74] * b[20] + a[75] * b[29] + a[76] * b[38] + a[77] * b[47]
+          + a[78] * b[56] + a[79] * b[65] + a[80] * b[74];
+    c[75] = a[72] * b[3] + a[73] * b[12] + a[74] * b[21] + a[75] * b[30] + a[76] * b[39] + a[77] * b[48]
+          + a[78] * b[57] + a[79] * b[66] + a[80] * b[75];
+    c[76] = a[72] * b[4] + a[73] * b[13] + a[74] * b[22] + a[75] * b[31] + a[76] * b[40] + a[77] * b[49]
+          + a[78] * b[58] + a[79] * b[67] + a[80] * b[76];
+    c[77] = a[72] * b[5] + a[73] * b[14] + a[74] * b[23] + a[75] * b[32] + a[76] * b[41] + a[77] * b[50]
+          + a[78] * b[59] + a[79] * b[68] + a[80] * b[77];
+    c[78] = a[72] * b[6] + a[73] * b[15] + a[74] * b[24] + a[75] * b[33] + a[76] * b[42] + a[77] * b[51]
+          + a[78] * b[60] + a[79] * b[69] + a[80] * b[78];
+    c[79] = a[72] * b[7] + a[73] * b[16] + a[74] * b[25] + a[75] * b[34] + a[76] * b[43] + a[77] * b[52]
+          + a[78] * b[61] + a[79] * b[70] + a[80] * b[79];
+    c[80] = a[72] * b[8] + a[73] * b[17] + a[74] * b[26] + a[75] * b[35] + a[76] * b[44] + a[77] * b[53]
+          + a[78] * b[62] + a[79] * b[71] + a[80] * b[80];
+}
+
+
+void Ifx_MatF32_mulVec9(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6]
+         + a[7] * x[7] + a[8] * x[8];
+    y[1] = a[9] * x[0] + a[10] * x[1] + a[11] * x[2] + a[12] * x[3] + a[13] * x[4] + a[14] * x[5]
+         + a[15] * x[6] + a[16] * x[7] + a[17] * x[8];
+    y[2] = a[18] * x[0] + a[19] * x[1] + a[20] * x[2] + a[21] * x[3] + a[22] * x[4] + a[23] * x[5]
+         + a[24] * x[6] + a[25] * x[7] + a[26] * x[8];
+    y[3] = a[27] * x[0] + a[28] * x[1] + a[29] * x[2] + a[30] * x[3] + a[31] * x[4] + a[32] * x[5]
+         + a[33] * x[6] + a[34] * x[7] + a[35] * x[8];
+    y[4] = a[36] * x[0] + a[37] * x[1] + a[38] * x[2] + a[39] * x[3] + a[40] * x[4] + a[41] * x[5]
+         + a[42] * x[6] + a[43] * x[7] + a[44] * x[8];
+    y[5] = a[45] * x[0] + a[46] * x[1] + a[47] * x[2] + a[48] * x[3] + a[49] * x[4] + a[50] * x[5]
+         + a[51] * x[6] + a[52] * x[7] + a[53] * x[8];
+    y[6] = a[54] * x[0] + a[55] * x[1] + a[56] * x[2] + a[57] * x[3] + a[58] * x[4] + a[59] * x[5]
+         + a[60] * x[6] + a[61] * x[7] + a[62] * x[8];
+    y[7] = a[63] * x[0] + a[64] * x[1] + a[65] * x[2] + a[66] * x[3] + a[67] * x[4] + a[68] * x[5]
+         + a[69] * x[6] + a[70] * x[7] + a[71] * x[8];
+    y[8] = a[72] * x[0] + a[73] * x[1] + a[74] * x[2] + a[75] * x[3] + a[76] * x[4] + a[77] * x[5]
+         + a[78] * x[6] + a[79] * x[7] + a[80] * x[8];
+}
+
+
+boolean Ifx_MatF32_cholesky9(float32 *l, const float32 *a)
+{
+    float32 inv[9];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[9] = a[9] * inv[0];
+    l[18] = a[18] * inv[0];
+    l[27] = a[27] * inv[0];
+    l[36] = a[36] * inv[0];
+    l[45] = a[45] * inv[0];
+    l[54] = a[54] * inv[0];
+    l[63] = a[63] * inv[0];
+    l[72] = a[72] * inv[0];
+    pivot = a[10] - (l[9] * l[9]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[10] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[10];
+    l[19] = (a[19] - (l[18] * l[9])) * inv[1];
+    l[28] = (a[28] - (l[27] * l[9])) * inv[1];
+    l[37] = (a[37] - (l[36] * l[9])) * inv[1];
+    l[46] = (a[46] - (l[45] * l[9])) * inv[1];
+    l[55] = (a[55] - (l[54] * l[9])) * inv[1];
+    l[64] = (a[64] - (l[63] * l[9])) * inv[1];
+    l[73] = (a[73] - (l[72] * l[9])) * inv[1];
+    pivot = a[20] - (l[18] * l[18] + l[19] * l[19]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[20] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[20];
+    l[29] = (a[29] - (l[27] * l[18] + l[28] * l[19])) * inv[2];
+    l[38] = (a[38] - (l[36] * l[18] + l[37] * l[19])) * inv[2];
+    l[47] = (a[47] - (l[45] * l[18] + l[46] * l[19])) * inv[2];
+    l[56] = (a[56] - (l[54] * l[18] + l[55] * l[19])) * inv[2];
+    l[65] = (a[65] - (l[63] * l[18] + l[64] * l[19])) * inv[2];
+    l[74] = (a[74] - (l[72] * l[18] + l[73] * l[19])) * inv[2];
+    pivot = a[30] - (l[27] * l[27] + l[28] * l[28] + l[29] * l[29]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[30] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[30];
+    l[39] = (a[39] - (l[36] * l[27] + l[37] * l[28] + l[38] * l[29])) * inv[3];
+    l[48] = (a[48] - (l[45] * l[27] + l[46] * l[28] + l[47] * l[29])) * inv[3];
+    l[57] = (a[57] - (l[54] * l[27] + l[55] * l[28] + l[56] * l[29])) * inv[3];
+    l[66] = (a[66] - (l[63] * l[27] + l[64] * l[28] + l[65] * l[29])) * inv[3];
+    l[75] = (a[75] - (l[72] * l[27] + l[73] * l[28] + l[74] * l[29])) * inv[3];
+    pivot = a[40] - (l[36] * l[36] + l[37] * l[37] + l[38] * l[38] + l[39] * l[39]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[40] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[40];
+    l[49] = (a[49] - (l[45] * l[36] + l[46] * l[37] + l[47] * l[38] + l[48] * l[39])) * inv[4];
+    l[58] = (a[58] - (l[54] * l[36] + l[55] * l[37] + l[56] * l[38] + l[57] * l[39])) * inv[4];
+    l[67] = (a[67] - (l[63] * l[36] + l[64] * l[37] + l[65] * l[38] + l[66] * l[39])) * inv[4];
+    l[76] = (a[76] - (l[72] * l[36] + l[73] * l[37] + l[74] * l[38] + l[75] * l[39])) * inv[4];
+    pivot = a[50] - (l[45] * l[45] + l[46] * l[46] + l[47] * l[47] + l[48] * l[48] + l[49] * l[49]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[50] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[50];
+    l[59] = (a[59] - (l[54] * l[45] + l[55] * l[46] + l[56] * l[47] + l[57] * l[48] + l[58] * l[49])) * inv[5];
+    l[68] = (a[68] - (l[63] * l[45] + l[64] * l[46] + l[65] * l[47] + l[66] * l[48] + l[67] * l[49])) * inv[5];
+    l[77] = (a[77] - (l[72] * l[45] + l[73] * l[46] + l[74] * l[47] + l[75] * l[48] + l[76] * l[49])) * inv[5];
+    pivot = a[60] - (l[54] * l[54] + l[55] * l[55] + l[56] * l[56] + l[57] * l[57] + l[58] * l[58]
+                   + l[59] * l[59]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[60] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[60];
+    l[69] = (a[69] - (l[63] * l[54] + l[64] * l[55] + l[65] * l[56] + l[66] * l[57] + l[67] * l[58]
+                    + l[68] * l[59])) * inv[6];
+    l[78] = (a[78] - (l[72] * l[54] + l[73] * l[55] + l[74] * l[56] + l[75] * l[57] + l[76] * l[58]
+                    + l[77] * l[59])) * inv[6];
+    pivot = a[70] - (l[63] * l[63] + l[64] * l[64] + l[65] * l[65] + l[66] * l[66] + l[67] * l[67]
+                   + l[68] * l[68] + l[69] * l[69]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[70] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[7] = 1.0f / l[70];
+    l[79] = (a[79] - (l[72] * l[63] + l[73] * l[64] + l[74] * l[65] + l[75] * l[66] + l[76] * l[67]
+                    + l[77] * l[68] + l[78] * l[69])) * inv[7];
+    pivot = a[80] - (l[72] * l[72] + l[73] * l[73] + l[74] * l[74] + l[75] * l[75] + l[76] * l[76]
+                   + l[77] * l[77] + l[78] * l[78] + l[79] * l[79]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[80] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[8] = 1.0f / l[80];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[24] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[44] = 0.0f;
+    l[51] = 0.0f;
+    l[52] = 0.0f;
+    l[53] = 0.0f;
+    l[61] = 0.0f;
+    l[62] = 0.0f;
+    l[71] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve9(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[9] * x[0])) / l[10];
+    x[2] = (b[2] - (l[18] * x[0] + l[19] * x[1])) / l[20];
+    x[3] = (b[3] - (l[27] * x[0] + l[28] * x[1] + l[29] * x[2])) / l[30];
+    x[4] = (b[4] - (l[36] * x[0] + l[37] * x[1] + l[38] * x[2] + l[39] * x[3])) / l[40];
+    x[5] = (b[5] - (l[45] * x[0] + l[46] * x[1] + l[47] * x[2] + l[48] * x[3] + l[49] * x[4])) / l[50];
+    x[6] = (b[6] - (l[54] * x[0] + l[55] * x[1] + l[56] * x[2] + l[57] * x[3] + l[58] * x[4] + l[59] * x[5])) / l[60];
+    x[7] = (b[7] - (l[63] * x[0] + l[64] * x[1] + l[65] * x[2] + l[66] * x[3] + l[67] * x[4] + l[68] * x[5]
+                  + l[69] * x[6])) / l[70];
+    x[8] = (b[8] - (l[72] * x[0] + l[73] * x[1] + l[74] * x[2] + l[75] * x[3] + l[76] * x[4] + l[77] * x[5]
+                  + l[78] * x[6] + l[79] * x[7])) / l[80];
+    x[8] = x[8] / l[80];
+    x[7] = (x[7] - (l[79] * x[8])) / l[70];
+    x[6] = (x[6] - (l[69] * x[7] + l[78] * x[8])) / l[60];
+    x[5] = (x[5] - (l[59] * x[6] + l[68] * x[7] + l[77] * x[8])) / l[50];
+    x[4] = (x[4] - (l[49] * x[5] + l[58] * x[6] + l[67] * x[7] + l[76] * x[8])) / l[40];
+    x[3] = (x[3] - (l[39] * x[4] + l[48] * x[5] + l[57] * x[6] + l[66] * x[7] + l[75] * x[8])) / l[30];
+    x[2] = (x[2] - (l[29] * x[3] + l[38] * x[4] + l[47] * x[5] + l[56] * x[6] + l[65] * x[7] + l[74] * x[8])) / l[20];
+    x[1] = (x[1] - (l[19] * x[2] + l[28] * x[3] + l[37] * x[4] + l[46] * x[5] + l[55] * x[6] + l[64] * x[7]
+                  + l[73] * x[8])) / l[10];
+    x[0] = (x[0] - (l[9] * x[1] + l[18] * x[2] + l[27] * x[3] + l[36] * x[4] + l[45] * x[5] + l[54] * x[6]
+                  + l[63] * x[7] + l[72] * x[8])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl9(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[9];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[9] = a[9] * inv;
+    l[18] = a[18] * inv;
+    l[27] = a[27] * inv;
+    l[36] = a[36] * inv;
+    l[45] = a[45] * inv;
+    l[54] = a[54] * inv;
+    l[63] = a[63] * inv;
+    l[72] = a[72] * inv;
+    l[0] = 1.0f;
+    v[0] = l[9] * d[0];
+    d[1] = a[10] - (l[9] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[19] = (a[19] - (l[18] * v[0])) * inv;
+    l[28] = (a[28] - (l[27] * v[0])) * inv;
+    l[37] = (a[37] - (l[36] * v[0])) * inv;
+    l[46] = (a[46] - (l[45] * v[0])) * inv;
+    l[55] = (a[55] - (l[54] * v[0])) * inv;
+    l[64] = (a[64] - (l[63] * v[0])) * inv;
+    l[73] = (a[73] - (l[72] * v[0])) * inv;
+    l[10] = 1.0f;
+    v[0] = l[18] * d[0];
+    v[1] = l[19] * d[1];
+    d[2] = a[20] - (l[18] * v[0] + l[19] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[29] = (a[29] - (l[27] * v[0] + l[28] * v[1])) * inv;
+    l[38] = (a[38] - (l[36] * v[0] + l[37] * v[1])) * inv;
+    l[47] = (a[47] - (l[45] * v[0] + l[46] * v[1])) * inv;
+    l[56] = (a[56] - (l[54] * v[0] + l[55] * v[1])) * inv;
+    l[65] = (a[65] - (l[63] * v[0] + l[64] * v[1])) * inv;
+    l[74] = (a[74] - (l[72] * v[0] + l[73] * v[1])) * inv;
+    l[20] = 1.0f;
+    v[0] = l[27] * d[0];
+    v[1] = l[28] * d[1];
+    v[2] = l[29] * d[2];
+    d[3] = a[30] - (l[27] * v[0] + l[28] * v[1] + l[29] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[39] = (a[39] - (l[36] * v[0] + l[37] * v[1] + l[38] * v[2])) * inv;
+    l[48] = (a[48] - (l[45] * v[0] + l[46] * v[1] + l[47] * v[2])) * inv;
+    l[57] = (a[57] - (l[54] * v[0] + l[55] * v[1] + l[56] * v[2])) * inv;
+    l[66] = (a[66] - (l[63] * v[0] + l[64] * v[1] + l[65] * v[2])) * inv;
+    l[75] = (a[75] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2])) * inv;
+    l[30] = 1.0f;
+    v[0] = l[36] * d[0];
+    v[1] = l[37] * d[1];
+    v[2] = l[38] * d[2];
+    v[3] = l[39] * d[3];
+    d[4] = a[40] - (l[36] * v[0] + l[37] * v[1] + l[38] * v[2] + l[39] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[49] = (a[49] - (l[45] * v[0] + l[46] * v[1] + l[47] * v[2] + l[48] * v[3])) * inv;
+    l[58] = (a[58] - (l[54] * v[0] + l[55] * v[1] + l[56] * v[2] + l[57] * v[3])) * inv;
+    l[67] = (a[67] - (l[63] * v[0] + l[64] * v[1] + l[65] * v[2] + l[66] * v[3])) * inv;
+    l[76] = (a[76] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3])) * inv;
+    l[40] = 1.0f;
+    v[0] = l[45] * d[0];
+    v[1] = l[46] * d[1];
+    v[2] = l[47] * d[2];
+    v[3] = l[48] * d[3];
+    v[4] = l[49] * d[4];
+    d[5] = a[50] - (l[45] * v[0] + l[46] * v[1] + l[47] * v[2] + l[48] * v[3] + l[49] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[59] = (a[59] - (l[54] * v[0] + l[55] * v[1] + l[56] * v[2] + l[57] * v[3] + l[58] * v[4])) * inv;
+    l[68] = (a[68] - (l[63] * v[0] + l[64] * v[1] + l[65] * v[2] + l[66] * v[3] + l[67] * v[4])) * inv;
+    l[77] = (a[77] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4])) * inv;
+    l[50] = 1.0f;
+    v[0] = l[54] * d[0];
+    v[1] = l[55] * d[1];
+    v[2] = l[56] * d[2];
+    v[3] = l[57] * d[3];
+    v[4] = l[58] * d[4];
+    v[5] = l[59] * d[5];
+    d[6] = a[60] - (l[54] * v[0] + l[55] * v[1] + l[56] * v[2] + l[57] * v[3] + l[58] * v[4] + l[59] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[69] = (a[69] - (l[63] * v[0] + l[64] * v[1] + l[65] * v[2] + l[66] * v[3] + l[67] * v[4] + l[68] * v[5])) * inv;
+    l[78] = (a[78] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4] + l[77] * v[5])) * inv;
+    l[60] = 1.0f;
+    v[0] = l[63] * d[0];
+    v[1] = l[64] * d[1];
+    v[2] = l[65] * d[2];
+    v[3] = l[66] * d[3];
+    v[4] = l[67] * d[4];
+    v[5] = l[68] * d[5];
+    v[6] = l[69] * d[6];
+    d[7] = a[70] - (l[63] * v[0] + l[64] * v[1] + l[65] * v[2] + l[66] * v[3] + l[67] * v[4] + l[68] * v[5]
+                  + l[69] * v[6]);
+    ok  &= (boolean)(d[7] != 0.0f);
+    inv  = 1.0f / ((d[7] != 0.0f) ? d[7] : 1.0f);
+    l[79] = (a[79] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4] + l[77] * v[5]
+                    + l[78] * v[6])) * inv;
+    l[70] = 1.0f;
+    v[0] = l[72] * d[0];
+    v[1] = l[73] * d[1];
+    v[2] = l[74] * d[2];
+    v[3] = l[75] * d[3];
+    v[4] = l[76] * d[4];
+    v[5] = l[77] * d[5];
+    v[6] = l[78] * d[6];
+    v[7] = l[79] * d[7];
+    d[8] = a[80] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4] + l[77] * v[5]
+                  + l[78] * v[6] + l[79] * v[7]);
+    ok  &= (boolean)(d[8] != 0.0f);
+    inv  = 1.0f / ((d[8] != 0.0f) ? d[8] : 1.0f);
+    l[80] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[11] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[24] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[44] = 0.0f;
+    l[51] = 0.0f;
+    l[52] = 0.0f;
+    l[53] = 0.0f;
+    l[61] = 0.0f;
+    l[62] = 0.0f;
+    l[71] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve9(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[9] * x[0]);
+    x[2] = b[2] - (l[18] * x[0] + l[19] * x[1]);
+    x[3] = b[3] - (l[27] * x[0] + l[28] * x[1] + l[29] * x[2]);
+    x[4] = b[4] - (l[36] * x[0] + l[37] * x[1] + l[38] * x[2] + l[39] * x[3]);
+    x[5] = b[5] - (l[45] * x[0] + l[46] * x[1] + l[47] * x[2] + l[48] * x[3] + l[49] * x[4]);
+    x[6] = b[6] - (l[54] * x[0] + l[55] * x[1] + l[56] * x[2] + l[57] * x[3] + l[58] * x[4] + l[59] * x[5]);
+    x[7] = b[7] - (l[63] * x[0] + l[64] * x[1] + l[65] * x[2] + l[66] * x[3] + l[67] * x[4] + l[68] * x[5]
+                 + l[69] * x[6]);
+    x[8] = b[8] - (l[72] * x[0] + l[73] * x[1] + l[74] * x[2] + l[75] * x[3] + l[76] * x[4] + l[77] * x[5]
+                 + l[78] * x[6] + l[79] * x[7]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[7] = x[7] / d[7];
+    x[8] = x[8] / d[8];
+    x[7] = x[7] - (l[79] * x[8]);
+    x[6] = x[6] - (l[69] * x[7] + l[78] * x[8]);
+    x[5] = x[5] - (l[59] * x[6] + l[68] * x[7] + l[77] * x[8]);
+    x[4] = x[4] - (l[49] * x[5] + l[58] * x[6] + l[67] * x[7] + l[76] * x[8]);
+    x[3] = x[3] - (l[39] * x[4] + l[48] * x[5] + l[57] * x[6] + l[66] * x[7] + l[75] * x[8]);
+    x[2] = x[2] - (l[29] * x[3] + l[38] * x[4] + l[47] * x[5] + l[56] * x[6] + l[65] * x[7] + l[74] * x[8]);
+    x[1] = x[1] - (l[19] * x[2] + l[28] * x[3] + l[37] * x[4] + l[46] * x[5] + l[55] * x[6] + l[64] * x[7]
+                 + l[73] * x[8]);
+    x[0] = x[0] - (l[9] * x[1] + l[18] * x[2] + l[27] * x[3] + l[36] * x[4] + l[45] * x[5] + l[54] * x[6]
+                 + l[63] * x[7] + l[72] * x[8]);
+}
+
+
+void Ifx_MatF32_add10(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+    c[49] = a[49] + b[49];
+    c[50] = a[50] + b[50];
+    c[51] = a[51] + b[51];
+    c[52] = a[52] + b[52];
+    c[53] = a[53] + b[53];
+    c[54] = a[54] + b[54];
+    c[55] = a[55] + b[55];
+    c[56] = a[56] + b[56];
+    c[57] = a[57] + b[57];
+    c[58] = a[58] + b[58];
+    c[59] = a[59] + b[59];
+    c[60] = a[60] + b[60];
+    c[61] = a[61] + b[61];
+    c[62] = a[62] + b[62];
+    c[63] = a[63] + b[63];
+    c[64] = a[64] + b[64];
+    c[65] = a[65] + b[65];
+    c[66] = a[66] + b[66];
+    c[67] = a[67] + b[67];
+    c[68] = a[68] + b[68];
+    c[69] = a[69] + b[69];
+    c[70] = a[70] + b[70];
+    c[71] = a[71] + b[71];
+    c[72] = a[72] + b[72];
+    c[73] = a[73] + b[73];
+    c[74] = a[74] + b[74];
+    c[75] = a[75] + b[75];
+    c[76] = a[76] + b[76];
+    c[77] = a[77] + b[77];
+    c[78] = a[78] + b[78];
+    c[79] = a[79] + b[79];
+    c[80] = a[80] + b[80];
+    c[81] = a[81] + b[81];
+    c[82] = a[82] + b[82];
+    c[83] = a[83] + b[83];
+    c[84] = a[84] + b[84];
+    c[85] = a[85] + b[85];
+    c[86] = a[86] + b[86];
+    c[87] = a[87] + b[87];
+    c[88] = a[88] + b[88];
+    c[89] = a[89] + b[89];
+    c[90] = a[90] + b[90];
+    c[91] = a[91] + b[91];
+    c[92] = a[92] + b[92];
+    c[93] = a[93] + b[93];
+    c[94] = a[94] + b[94];
+    c[95] = a[95] + b[95];
+    c[96] = a[96] + b[96];
+    c[97] = a[97] + b[97];
+    c[98] = a[98] + b[98];
+    c[99] = a[99] + b[99];
+}
+
+
+void Ifx_MatF32_transpose10(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[10];
+    c[2] = a[20];
+    c[3] = a[30];
+    c[4] = a[40];
+    c[5] = a[50];
+    c[6] = a[60];
+    c[7] = a[70];
+    c[8] = a[80];
+    c[9] = a[90];
+    c[10] = a[1];
+    c[11] = a[11];
+    c[12] = a[21];
+    c[13] = a[31];
+    c[14] = a[41];
+    c[15] = a[51];
+    c[16] = a[61];
+    c[17] = a[71];
+    c[18] = a[81];
+    c[19] = a[91];
+    c[20] = a[2];
+    c[21] = a[12];
+    c[22] = a[22];
+    c[23] = a[32];
+    c[24] = a[42];
+    c[25] = a[52];
+    c[26] = a[62];
+    c[27] = a[72];
+    c[28] = a[82];
+    c[29] = a[92];
+    c[30] = a[3];
+    c[31] = a[13];
+    c[32] = a[23];
+    c[33] = a[33];
+    c[34] = a[43];
+    c[35] = a[53];
+    c[36] = a[63];
+    c[37] = a[73];
+    c[38] = a[83];
+    c[39] = a[93];
+    c[40] = a[4];
+    c[41] = a[14];
+    c[42] = a[24];
+    c[43] = a[34];
+    c[44] = a[44];
+    c[45] = a[54];
+    c[46] = a[64];
+    c[47] = a[74];
+    c[48] = a[84];
+    c[49] = a[94];
+    c[50] = a[5];
+    c[51] = a[15];
+    c[52] = a[25];
+    c[53] = a[35];
+    c[54] = a[45];
+    c[55] = a[55];
+    c[56] = a[65];
+    c[57] = a[75];
+    c[58] = a[85];
+    c[59] = a[95];
+    c[60] = a[6];
+    c[61] = a[16];
+    c[62] = a[26];
+    c[63] = a[36];
+    c[64] = a[46];
+    c[65] = a[56];
+    c[66] = a[66];
+    c[67] = a[76];
+    c[68] = a[86];
+    c[69] = a[96];
+    c[70] = a[7];
+    c[71] = a[17];
+    c[72] = a[27];
+    c[73] = a[37];
+    c[74] = a[47];
+    c[75] = a[57];
+    c[76] = a[67];
+    c[77] = a[77];
+    c[78] = a[87];
+    c[79] = a[97];
+    c[80] = a[8];
+    c[81] = a[18];
+    c[82] = a[28];
+    c[83] = a[38];
+    c[84] = a[48];
+    c[85] = a[58];
+    c[86] = a[68];
+    c[87] = a[78];
+    c[88] = a[88];
+    c[89] = a[98];
+    c[90] = a[9];
+    c[91] = a[19];
+    c[92] = a[29];
+    c[93] = a[39];
+    c[94] = a[49];
+    c[95] = a[59];
+    c[96] = a[69];
+    c[97] = a[79];
+    c[98] = a[89];
+    c[99] = a[99];
+}
+
+
+void Ifx_MatF32_mul10(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[10] + a[2] * b[20] + a[3] * b[30] + a[4] * b[40] + a[5] * b[50]
+         + a[6] * b[60] + a[7] * b[70] + a[8] * b[80] + a[9] * b[90];
+    c[1] = a[0] * b[1] + a[1] * b[11] + a[2] * b[21] + a[3] * b[31] + a[4] * b[41] + a[5] * b[51]
+         + a[6] * b[61] + a[7] * b[71] + a[8] * b[81] + a[9] * b[91];
+    c[2] = a[0] * b[2] + a[1] * b[12] + a[2] * b[22] + a[3] * b[32] + a[4] * b[42] + a[5] * b[52]
+         + a[6] * b[62] + a[7] * b[72] + a[8] * b[82] + a[9] * b[92];
+    c[3] = a[0] * b[3] + a[1] * b[13] + a[2] * b[23] + a[3] * b[33] + a[4] * b[43] + a[5] * b[53]
+         + a[6] * b[63] + a[7] * b[73] + a[8] * b[83] + a[9] * b[93];
+    c[4] = a[0] * b[4] + a[1] * b[14] + a[2] * b[24] + a[3] * b[34] + a[4] * b[44] + a[5] * b[54]
+         + a[6] * b[64] + a[7] * b[74] + a[8] * b[84] + a[9] * b[94];
+    c[5] = a[0] * b[5] + a[1] * b[15] + a[2] * b[25] + a[3] * b[35] + a[4] * b[45] + a[5] * b[55]
+         + a[6] * b[65] + a[7] * b[75] + a[8] * b[85] + a[9] * b[95];
+    c[6] = a[0] * b[6] + a[1] * b[16] + a[2] * b[26] + a[3] * b[36] + a[4] * b[46] + a[5] * b[56]
+         + a[6] * b[66] + a[7] * b[76] + a[8] * b[86] + a[9] * b[96];
+    c[7] = a[0] * b[7] + a[1] * b[17] + a[2] * b[27] + a[3] * b[37] + a[4] * b[47] + a[5] * b[57]
+         + a[6] * b[67] + a[7] * b[77] + a[8] * b[87] + a[9] * b[97];
+    c[8] = a[0] * b[8] + a[1] * b[18] + a[2] * b[28] + a[3] * b[38] + a[4] * b[48] + a[5] * b[58]
+         + a[6] * b[68] + a[7] * b[78] + a[8] * b[88] + a[9] * b[98];
+    c[9] = a[0] * b[9] + a[1] * b[19] + a[2] * b[29] + a[3] * b[39] + a[4] * b[49] + a[5] * b[59]
+         + a[6] * b[69] + a[7] * b[79] + a[8] * b[89] + a[9] * b[99];
+    c[10] = a[10] * b[0] + a[11] * b[10] + a[12] * b[20] + a[13] * b[30] + a[14] * b[40] + a[15] * b[50]
+          + a[16] * b[60] + a[17] * b[70] + a[18] * b[80] + a[19] * b[90];
+    c[11] = a[10] * b[1] + a[11] * b[11] + a[12] * b[21] + a[13] * b[31] + a[14] * b[41] + a[15] * b[51]
+          + a[16] * b[61] + a[17] * b[71] + a[18] * b[81] + a[19] * b[91];
+    c[12] = a[10] * b[2] + a[11] * b[12] + a[12] * b[22] + a[13] * b[32] + a[14] * b[42] + a[15] * b[52]
+          + a[16] * b[62] + a[17] * b[72] + a[18] * b[82] + a[19] * b[92];
+    c[13] = a[10] * b[3] + a[11] * b[13] + a[12] * b[23] + a[13] * b[33] + a[14] * b[43] + a[15] * b[53]
+          + a[16] * b[63] + a[17] * b[73] + a[18] * b[83] + a[19] * b[93];
+    c[14] = a[10] * b[4] + a[11] * b[14] + a[12] * b[24] + a[13] * b[34] + a[14] * b[44] + a[15] * b[54]
+          + a[16] * b[64] + a[17] * b[74] + a[18] * b[84] + a[19] * b[94];
+    c[15] = a[10] * b[5] + a[11] * b[15] + a[12] * b[25] + a[13] * b[35] + a[14] * b[45] + a[15] * b[55]
+          + a[16] * b[65] + a[17] * b[75] + a[18] * b[85] + a[19] * b[95];
+    c[16] = a[10] * b[6] + a[11] * b[16] + a[12] * b[26] + a[13] * b[36] + a[14] * b[46] + a[15] * b[56]
+          + a[16] * b[66] + a[17] * b[76] + a[18] * b[86] + a[19] * b[96];
+    c[17] = a[10] * b[7] + a[11] * b[17] + a[12] * b[27] + a[13] * b[37] + a[14] * b[47] + a[15] * b[57]
+          + a[16] * b[67] + a[17] * b[77] + a[18] * b[87] + a[19] * b[97];
+    c[18] = a[10] * b[8] + a[11] * b[18] + a[12] * b[28] + a[13] * b[38] + a[14] * b[48] + a[15] * b[58]
+          + a[16] * b[68] + a[17] * b[78] + a[18] * b[88] + a[19] * b[98];
+    c[19] = a[10] * b[9] + a[11] * b[19] + a[12] * b[29] + a[13] * b[39] + a[14] * b[49] + a[15] * b[59]
+          + a[16] * b[69] + a[17] * b[79] + a[18] * b[89] + a[19] * b[99];
+    c[20] = a[20] * b[0] + a[21] * b[10] + a[22] * b[20] + a[23] * b[30] + a[24] * b[40] + a[25] * b[50]
+          + a[26] * b[60] + a[27] * b[70] + a[28] * b[80] + a[29] * b[90];
+    c[21] = a[20] * b[1] + a[21] * b[11] + a[22] * b[21] + a[23] * b[31] + a[24] * b[41] + a[25] * b[51]
+          + a[26] * b[61] + a[27] * b[71] + a[28] * b[81] + a[29] * b[91];
+    c[22] = a[20] * b[2] + a[21] * b[12] + a[22] * b[22] + a[23] * b[32] + a[24] * b[42] + a[25] * b[52]
+          + a[26] * b[62] + a[27] * b[72] + a[28] * b[82] + a[29] * b[92];
+    c[23] = a[20] * b[3] + a[21] * b[13] + a[22] * b[23] + a[23] * b[33] + a[24] * b[43] + a[25] * b[53]
+          + a[26] * b[63] + a[27] * b[73] + a[28] * b[83] + a[29] * b[93];
+    c[24] = a[20] * b[4] + a[21] * b[14] + a[22] * b[24] + a[23] * b[34] + a[24] * b[44] + a[25] * b[54]
+          + a[26] * b[64] + a[27] * b[74] + a[28] * b[84] + a[29] * b[94];
+    c[25] = a[20] * b[5] + a[21] * b[15] + a[22] * b[25] + a[23] * b[35] + a[24] * b[45] + a[25] * b[55]
+          + a[26] * b[65] + a[27] * b[75] + a[28] * b[85] + a[29] * b[95];
+    c[26] = a[20] * b[6] + a[21] * b[16] + a[22] * b[26] + a[23] * b[36] + a[24] * b[46] + a[25] * b[56]
+          + a[26] * b[66] + a[27] * b[76] + a[28] * b[86] + a[29] * b[96];
+    c[27] = a[20] * b[7] + a[21] * b[17] + a[22] * b[27] + a[23] * b[37] + a[24] * b[47] + a[25] * b[57]
+          + a[26] * b[67] + a[27] * b[77] + a[28] * b[87] + a[29] * b[97];
+    c[28] = a[20] * b[8] + a[21] * b[18] + a[22] * b[28] + a[23] * b[38] + a[24] * b[48] + a[25] * b[58]
+          + a[26] * b[68] + a[27] * b[78] + a[28] * b[88] + a[29] * b[98];
+    c[29] = a[20] * b[9] + a[21] * b[19] + a[22] * b[29] + a[23] * b[39] + a[24] * b[49] + a[25] * b[59]
+          + a[26] * b[69] + a[27] * b[79] + a[28] * b[89] + a[29] * b[99];
+    c[30] = a[30] * b[0] + a[31] * b[10] + a[32] * b[20] + a[33] * b[30] + a[34] * b[40] + a[35] * b[50]
+          + a[36] * b[60] + a[37] * b[70] + a[38] * b[80] + a[39] * b[90];
+    c[31] = a[30] * b[1] + a[31] * b[11] + a[32] * b[21] + a[33] * b[31] + a[34] * b[41] + a[35] * b[51]
+          + a[36] * b[61] + a[37] * b[71] + a[38] * b[81] + a[39] * b[91];
+    c[32] = a[30] * b[2] + a[31] * b[12] + a[32] * b[22] + a[33] * b[32] + a[34] * b[42] + a[35] * b[52]
+          + a[36] * b[62] + a[37] * b[72] + a[38] * b[82] + a[39] * b[92];
+    c[33] = a[30] * b[3] + a[31] * b[13] + a[32] * b[23] + a[33] * b[33] + a[34] * b[43] + a[35] * b[53]
+          + a[36] * b[63] + a[37] * b[73] + a[38] * b[83] + a[39] * b[93];
+    c[34] = a[30] * b[4] + a[31] * b[14] + a[32] * b[24] + a[33] * b[34] + a[34] * b[44] + a[35] * b[54]
+          + a[36] * b[64] + a[37] * b[74] + a[38] * b[84] + a[39] * b[94];
+    c[35] = a[30] * b[5] + a[31] * b[15] + a[32] * b[25] + a[33] * b[35] + a[34] * b[45] + a[35] * b[55]
+          + a[36] * b[65] + a[37] * b[75] + a[38] * b[85] + a[39] * b[95];
+    c[36] = a[30] * b[6] + a[31] * b[16] + a[32] * b[26] + a[33] * b[36] + a[34] * b[46] + a[35] * b[56]
+          + a[36] * b[66] + a[37] * b[76] + a[38] * b[86] + a[39] * b[96];
+    c[37] = a[30] * b[7] + a[31] * b[17] + a[32] * b[27] + a[33] * b[37] + a[34] * b[47] + a[35] * b[57]
+          + a[36] * b[67] + a[37] * b[77] + a[38] * b[87] + a[39] * b[97];
+    c[38] = a[30] * b[8] + a[31] * b[18] + a[32] * b[28] + a[33] * b[38] + a[34] * b[48] + a[35] * b[58]
+          + a[36] * b[68] + a[37] * b[78] + a[38] * b[88] + a[39] * b[98];
+    c[39] = a[30] * b[9] + a[31] * b[19] + a[32] * b[29] + a[33] * b[39] + a[34] * b[49] + a[35] * b[59]
+          + a[36] * b[69] + a[37] * b[79] + a[38] * b[89] + a[39] * b[99];
+    c[40] = a[40] * b[0] + a[41] * b[10] + a[42] * b[20] + a[43] * b[30] + a[44] * b[40] + a[45] * b[50]
+          + a[46] * b[60] + a[47] * b[70] + a[48] * b[80] + a[49] * b[90];
+    c[41] = a[40] * b[1] + a[41] * b[11] + a[42] * b[21] + a[43] * b[31] + a[44] * b[41] + a[45] * b[51]
+          + a[46] * b[61] + a[47] * b[71] + a[48] * b[81] + a[49] * b[91];
+    c[42] = a[40] * b[2] + a[41] * b[12] + a[42] * b[22] + a[43] * b[32] + a[44] * b[42] + a[45] * b[52]
+          + a[46] * b[62] + a[47] * b[72] + a[48] * b[82] + a[49] * b[92];
+    c[43] = a[40] * b[3] + a[41] * b[13] + a[42] * b[23] + a[43] * b[33] + a[44] * b[43] + a[45] * b[53]
+          + a[46] * b[63] + a[47] * b[73] + a[48] * b[83] + a[49] * b[93];
+    c[44] = a[40] * b[4] + a[41] * b[14] + a[42] * b[24] + a[43] * b[34] + a[44] * b[44] + a[45] * b[54]
+          + a[46] * b[64] + a[47] * b[74] + a[48] * b[84] + a[49] * b[94];
+    c[45] = a[40] * b[5] + a[41] * b[15] + a[42] * b[25] + a[43] * b[35] + a[44] * b[45] + a[45] * b[55]
+          + a[46] * b[65] + a[47] * b[75] + a[48] * b[85] + a[49] * b[95];
+    c[46] = a[40] * b[6] + a[41] * b[16] + a[42] * b[26] + a[43] * b[36] + a[44] * b[46] + a[45] * b[56]
+          + a[46] * b[66] + a[47] * b[76] + a[48] * b[86] + a[49] * b[96];
+    c[47] = a[40] * b[7] + a[41] * b[17] + a[42] * b[27] + a[43] * b[37] + a[44] * b[47] + a[45] * b[57]
+          + a[46] * b[67] + a[47] * b[77] + a[48] * b[87] + a[49] * b[97];
+    c[48] = a[40] * b[8] + a[41] * b[18] + a[42] * b[28] + a[43] * b[38] + a[44] * b[48] + a[45] * b[58]
+          + a[46] * b[68] + a[47] * b[78] + a[48] * b[88] + a[49] * b[98];
+    c[49] = a[40] * b[9] + a[41] * b[19] + a[42] * b[29] + a[43] * b[39] + a[44] * b[49] + a[45] * b[59]
+          + a[46] * b[69] + a[47] * b[79] + a[48] * b[89] + a[49] * b[99];
+    c[50] = a[50] * b[0] + a[51] * b[10] + a[52] * b[20] + a[53] * b[30] + a[54] * b[40] + a[55] * b[50]
+          + a[56] * b[60] + a[57] * b[70] + a[58] * b[80] + a[59] * b[90];
+    c[51] = a[50] * b[1] + a[51] * b[11] + a[52] * b[21] + a[53] * b[31] + a[54] * b[41] + a[55] * b[51]
+          + a[56] * b[61] + a[57] * b[71] + a[58] * b[81] + a[59] * b[91];
+    c[52] = a[50] * b[2] + a[51] * b[12] + a[52] * b[22] + a[53] * b[32] + a[54] * b[42] + a[55] * b[52]
+          + a[56] * b[62] + a[57] * b[72] + a[58] * b[82] + a[59] * b[92];
+    c[53] = a[50] * b[3] + a[51] * b[13] + a[52] * b[23] + a[53] * b[33] + a[54] * b[43] + a[55] * b[53]
+          + a[56] * b[63] + a[57] * b[73] + a[58] * b[83] + a[59] * b[93];
+    c[54] = a[50] * b[4] + a[51] * b[14] + a[52] * b[24] + a[53] * b[34] + a[54] * b[44] + a[55] * b[54]
+          + a[56] * b[64] + a[57] * b[74] + a[58] * b[84] + a[59] * b[94];
+    c[55] = a[50] * b[5] + a[51] * b[15] + a[52] * b[25] + a[53] * b[35] + a[54] * b[45] + a[55] * b[55]
+          + a[56] * b[65] + a[57] * b[75] + a[58] * b[85] + a[59] * b[95];
+    c[56] = a[50] * b[6] + a[51] * b[16] + a[52] * b[26] + a[53] * b[36] + a[54] * b[46] + a[55] * b[56]
+          + a[56] * b[66] + a[57] * b[76] + a[58] * b[86] + a[59] * b[96];
+    c[57] = a[50] * b[7] + a[51] * b[17] + a[52] * b[27] + a[53] * b[37] + a[54] * b[47] + a[55] * b[57]
+          + a[56] * b[67] + a[57] * b[77] + a[58] * b[87] + a[59] * b[97];
+    c[58] = a[50] * b[8] + a[51] * b[18] + a[52] * b[28] + a[53] * b[38] + a[54] * b[48] + a[55] * b[58]
+          + a[56] * b[68] + a[57] * b[78] + a[58] * b[88] + a[59] * b[98];
+    c[59] = a[50] * b[9] + a[51] * b[19] + a[52] * b[29] + a[53] * b[39] + a[54] * b[49] + a[55] * b[59]
+          + a[56] * b[69] + a[57] * b[79] + a[58] * b[89] + a[59] * b[99];
+    c[60] = a[60] * b[0] + a[61] * b[10] + a[62] * b[20] + a[63] * b[30] + a[64] * b[40] + a[65] * b[50]
+          + a[66] * b[60] + a[67] * b[70] + a[68] * b[80] + a[69] * b[90];
+    c[61] = a[60] * b[1] + a[61] * b[11] + a[62] * b[21] + a[63] * b[31] + a[64] * b[41] + a[65] * b[51]
+          + a[66] * b[61] + a[67] * b[71] + a[68] * b[81] + a[69] * b[91];
+    c[62] = a[60] * b[2] + a[61] * b[12] + a[62] * b[22] + a[63] * b[32] + a[64] * b[42] + a[65] * b[52]
+          + a[66] * b[62] + a[67] * b[72] + a[68] * b[82] + a[69] * b[92];
+    c[63] = a[60] * b[3] + a[61] * b[13] + a[62] * b[23] + a[63] * b[33] + a[64] * b[43] + a[65] * b[53]
+          + a[66] * b[63] + a[67] * b[73] + a[68] * b[83] + a[69] * b[93];
+    c[64] = a[60] * b[4] + a[61] * b[14] + a[62] * b[24] + a[63] * b[34] + a[64] * b[44] + a[65] * b[54]
+          + a[66] * b[64] + a[67] * b[74] + a[68] * b[84] + a[69] * b[94];
+    c[65] = a[60] * b[5] + a[61] * b[15] + a[62] * b[25] + a[63] * b[35] + a[64] * b[45] + a[65] * b[55]
+          + a[66] * b[65] + a[67] * b[75] + a[68] * b[85] + a[69] * b[95];
+    c[66] = a[60] * b[6] + a[61] * b[16] + a[62] * b[26] + a[63] * b[36] + a[64] * b[46] + a[65] * b[56]
+          + a[66] * b[66] + a[67] * b[76] + a[68] * b[86] + a[69] * b[96];
+    c[67] = a[60] * b[7] + a[61] * b[17] + a[62] * b[27] + a[63] * b[37] + a[64] * b[47] + a[65] * b[57]
+          + a[66] * b[67] + a[67] * b[77] + a[68] * b[87] + a[69] * b[97];
+    c[68] = a[60] * b[8] + a[61] * b[18] + a[62] * b[28] + a[63] * b[38] + a[64] * b[48] + a[65] * b[58]
+          + a[66] * b[68] + a[67] * b[78] + a[68] * b[88] + a[69] * b[98];
+    c[69] = a[60] * b[9] + a[61] * b[19] + a[62] * b[29] + a[63] * b[39] + a[64] * b[49] + a[65] * b[59]
+          + a[66] * b[69] + a[67] * b[79] + a[68] * b[89] + a[69] * b[99];
+    c[70] = a[70] * b[0] + a[71] * b[10] + a[72] * b[20] + a[73] * b[30] + a[74] * b[40] + a[75] * b[50]
+          + a[76] * b[60] + a[77] * b[70] + a[78] * b[80] + a[79] * b[90];
+    c[71] = a[70] * b[1] + a[71] * b[11] + a[72] * b[21] + a[73] * b[31] + a[74] * b[41] + a[75] * b[51]
+          + a[76] * b[61] + a[77] * b[71] + a[78] * b[81] + a[79] * b[91];
+    c[72] = a[70] * b[2] + a[71] * b[12] + a[72] * b[22] + a[73] * b[32] + a[74] * b[42] + a[75] * b[52]
+          + a[76] * b[62] + a[77] * b[72] + a[78] * b[82] + a[79] * b[92];
+    c[73] = a[70] * b[3] + a[71] * b[13] + a[72] * b[23] + a[73] * b[33] + a[74] * b[43] + a[75] * b[53]
+          + a[76] * b[63] + a[77] * b[73] + a[78] * b[83] + a[79] * b[93];
+    c[74] = a[70] * b[4] + a[71] * b[14] + a[72] * b[24] + a[73] * b[34] + a[74] * b[44] + a[75] * b[54]
+          + a[76] * b[64] + a[77] * b[74] + a[78] * b[84] + a[79] * b[94];
+    c[75] = a[70] * b[5] + a[71] * b[15] + a[72] * b[25] + a[73] * b[35] + a[74] * b[45] + a[75] * b[55]
+          + a[76] * b[65] + a[77] * b[75] + a[78] * b[85] + a[79] * b[95];
+    c[76] = a[70] * b[6] + a[71] * b[16] + a[72] * b[26] + a[73] * b[36] + a[74] * b[46] + a[75] * b[56]
+          + a[76] * b[66] + a[77] * b[76] + a[78] * b[86] + a[79] * b[96];
+    c[77] = a[70] * b[7] + a[71] * b[17] + a[72] * b[27] + a[73] * b[37] + a[74] * b[47] + a[75] * b[57]
+          + a[76] * b[67] + a[77] * b[77] + a[78] * b[87] + a[79] * b[97];
+    c[78] = a[70] * b[8] + a[71] * b[18] + a[72] * b[28] + a[73] * b[38] + a[74] * b[48] + a[75] * b[58]
+          + a[76] * b[68] + a[77] * b[78] + a[78] * b[88] + a[79] * b[98];
+    c[79] = a[70] * b[9] + a[71] * b[19] + a[72] * b[29] + a[73] * b[39] + a[74] * b[49] + a[75] * b[59]
+          + a[76] * b[69] + a[77] * b[79] + a[78] * b[89] + a[79] * b[99];
+    c[80] = a[80] * b[0] + a[81] * b[10] + a[82] * b[20] + a[83] * b[30] + a[84] * b[40] + a[85] * b[50]
+          + a[86] * b[60] + a[87] * b[70] + a[88] * b[80] + a[89] * b[90];
+    c[81] = a[80] * b[1] + a[81] * b[11] + a[82] * b[21] + a[83] * b[31] + a[84] * b[41] + a[85] * b[51]
+          + a[86] * b[61] + a[87] * b[71] + a[88] * b[81] + a[89] * b[91];
+    c[82] = a[80] * b[2] + a[81] * b[12] + a[82] * b[22] + a[83] * b[32] + a[84] * b[42] + a[85] * b[52]
+          + a[86] * b[62] + a[87] * b[72] + a[88] * b[82] + a[89] * b[92];
+    c[83] = a[80] * b[3] + a[81] * b[13] + a[82] * b[23] + a[83] * b[33] + a[84] * b[43] + a[85] * b[53]
+          + a[86] * b[63] + a[87] * b[73] + a[88] * b[83] + a[89] * b[93];
+    c[84] = a[80] * b[4] + a[81] * b[14] + a[82] * b[24] + a[83] * b[34] + a[84] * b[44] + a[85] * b[54]
+          + a[86] * b[64] + a[87] * b[74] + a[88] * b[84] + a[89] * b[94];
+    c[85] = a[80] * b[5] + a[81] * b[15] + a[82] * b[25] + a[83] * b[35] + a[84] * b[45] + a[85] * b[55]
+          + a[86] * b[65] + a[87] * b[75] + a[88] * b[85] + a[89] * b[95];
+    c[86] = a[80] * b[6] + a[81] * b[16] + a[82] * b[26] + a[83] * b[36] + a[84] * b[46] + a[85] * b[56]
+          + a[86] * b[66] + a[87] * b[76] + a[88] * b[86] + a[89] * b[96];
+    c[87] = a[80] * b[7] + a[81] * b[17] + a[82] * b[27] + a[83] * b[37] + a[84] * b[47] + a[85] * b[57]
+          + a[86] * b[67] + a[87] * b[77] + a[88] * b[87] + a[89] * b[97];
+    c[88] = a[80] * b[8] + a[81] * b[18] + a[82] * b[28] + a[83] * b[38] + a[84] * b[48] + a[85] * b[58]
+          + a[86] * b[68] + a[87] * b[78] + a[88] * b[88] + a[89] * b[98];
+    c[89] = a[80] * b[9] + a[81] * b[19] + a[82] * b[29] + a[83] * b[39] + a[84] * b[49] + a[85] * b[59]
+          + a[86] * b[69] + a[87] * b[79] + a[88] * b[89] + a[89] * b[99];
+    c[90] = a[90] * b[0] + a[91] * b[10] + a[92] * b[20] + a[93] * b[30] + a[94] * b[40] + a[95] * b[50]
+          + a[96] * b[60] + a[97] * b[70] + a[98] * b[80] + a[99] * b[90];
+    c[91] = a[90] * b[1] + a[91] * b[11] + a[92] * b[21] + a[93] * b[31] + a[94] * b[41] + a[95] * b[51]
+          + a[96] * b[61] + a[97] * b[71] + a[98] * b[81] + a[99] * b[91];
+    c[92] = a[90] * b[2] + a[91] * b[12] + a[92] * b[22] + a[93] * b[32] + a[94] * b[42] + a[95] * b[52]
+          + a[96] * b[62] + a[97] * b[72] + a[98] * b[82] + a[99] * b[92];
+    c[93] = a[90] * b[3] + a[91] * b[13] + a[92] * b[23] + a[93] * b[33] + a[94] * b[43] + a[95] * b[53]
+          + a[96] * b[63] + a[97] * b[73] + a[98] * b[83] + a[99] * b[93];
+    c[94] = a[90] * b[4] + a[91] * b[14] + a[92] * b[24] + a[93] * b[34] + a[94] * b[44] + a[95] * b[54]
+          + a[96] * b[64] + a[97] * b[74] + a[98] * b[84] + a[99] * b[94];
+    c[95] = a[90] * b[5] + a[91] * b[15] + a[92] * b[25] + a[93] * b[35] + a[94] * b[45] + a[95] * b[55]
+          + a[96] * b[65] + a[97] * b[75] + a[98] * b[85] + a[99] * b[95];
+    c[96] = a[90] * b[6] + a[91] * b[16] + a[92] * b[26] + a[93] * b[36] + a[94] * b[46] + a[95] * b[56]
+          + a[96] * b[66] + a[97] * b[76] + a[98] * b[86] + a[99] * b[96];
+    c[97] = a[90] * b[7] + a[91] * b[17] + a[92] * b[27] + a[93] * b[37] + a[94] * b[47] + a[95] * b[57]
+          + a[96] * b[67] + a[97] * b[77] + a[98] * b[87] + a[99] * b[97];
+    c[98] = a[90] * b[8] + a[91] * b[18] + a[92] * b[28] + a[93] * b[38] + a[94] * b[48] + a[95] * b[58]
+          + a[96] * b[68] + a[97] * b[78] + a[98] * b[88] + a[99] * b[98];
+    c[99] = a[90] * b[9] + a[91] * b[19] + a[92] * b[29] + a[93] * b[39] + a[94] * b[49] + a[95] * b[59]
+          + a[96] * b[69] + a[97] * b[79] + a[98] * b[89] + a[99] * b[99];
+}
+
+
+void Ifx_MatF32_mulVec10(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6]
+         + a[7] * x[7] + a[8] * x[8] + a[9] * x[9];
+    y[1] = a[10] * x[0] + a[11] * x[1] + a[12] * x[2] + a[13] * x[3] + a[14] * x[4] + a[15] * x[5]
+         + a[16] * x[6] + a[17] * x[7] + a[18] * x[8] + a[19] * x[9];
+    y[2] = a[20] * x[0] + a[21] * x[1] + a[22] * x[2] + a[23] * x[3] + a[24] * x[4] + a[25] * x[5]
+         + a[26] * x[6] + a[27] * x[7] + a[28] * x[8] + a[29] * x[9];
+    y[3] = a[30] * x[0] + a[31] * x[1] + a[32] * x[2] + a[33] * x[3] + a[34] * x[4] + a[35] * x[5]
+         + a[36] * x[6] + a[37] * x[7] + a[38] * x[8] + a[39] * x[9];
+    y[4] = a[40] * x[0] + a[41] * x[1] + a[42] * x[2] + a[43] * x[3] + a[44] * x[4] + a[45] * x[5]
+         + a[46] * x[6] + a[47] * x[7] + a[48] * x[8] + a[49] * x[9];
+    y[5] = a[50] * x[0] + a[51] * x[1] + a[52] * x[2] + a[53] * x[3] + a[54] * x[4] + a[55] * x[5]
+         + a[56] * x[6] + a[57] * x[7] + a[58] * x[8] + a[59] * x[9];
+    y[6] = a[60] * x[0] + a[61] * x[1] + a[62] * x[2] + a[63] * x[3] + a[64] * x[4] + a[65] * x[5]
+         + a[66] * x[6] + a[67] * x[7] + a[68] * x[8] + a[69] * x[9];
+    y[7] = a[70] * x[0] + a[71] * x[1] + a[72] * x[2] + a[73] * x[3] + a[74] * x[4] + a[75] * x[5]
+         + a[76] * x[6] + a[77] * x[7] + a[78] * x[8] + a[79] * x[9];
+    y[8] = a[80] * x[0] + a[81] * x[1] + a[82] * x[2] + a[83] * x[3] + a[84] * x[4] + a[85] * x[5]
+         + a[86] * x[6] + a[87] * x[7] + a[88] * x[8] + a[89] * x[9];
+    y[9] = a[90] * x[0] + a[91] * x[1] + a[92] * x[2] + a[93] * x[3] + a[94] * x[4] + a[95] * x[5]
+         + a[96] * x[6] + a[97] * x[7] + a[98] * x[8] + a[99] * x[9];
+}
+
+
+boolean Ifx_MatF32_cholesky10(float32 *l, const float32 *a)
+{
+    float32 inv[10];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[10] = a[10] * inv[0];
+    l[20] = a[20] * inv[0];
+    l[30] = a[30] * inv[0];
+    l[40] = a[40] * inv[0];
+    l[50] = a[50] * inv[0];
+    l[60] = a[60] * inv[0];
+    l[70] = a[70] * inv[0];
+    l[80] = a[80] * inv[0];
+    l[90] = a[90] * inv[0];
+    pivot = a[11] - (l[10] * l[10]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[11] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[11];
+    l[21] = (a[21] - (l[20] * l[10])) * inv[1];
+    l[31] = (a[31] - (l[30] * l[10])) * inv[1];
+    l[41] = (a[41] - (l[40] * l[10])) * inv[1];
+    l[51] = (a[51] - (l[50] * l[10])) * inv[1];
+    l[61] = (a[61] - (l[60] * l[10])) * inv[1];
+    l[71] = (a[71] - (l[70] * l[10])) * inv[1];
+    l[81] = (a[81] - (l[80] * l[10])) * inv[1];
+    l[91] = (a[91] - (l[90] * l[10])) * inv[1];
+    pivot = a[22] - (l[20] * l[20] + l[21] * l[21]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[22] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[22];
+    l[32] = (a[32] - (l[30] * l[20] + l[31] * l[21])) * inv[2];
+    l[42] = (a[42] - (l[40] * l[20] + l[41] * l[21])) * inv[2];
+    l[52] = (a[52] - (l[50] * l[20] + l[51] * l[21])) * inv[2];
+    l[62] = (a[62] - (l[60] * l[20] + l[61] * l[21])) * inv[2];
+    l[72] = (a[72] - (l[70] * l[20] + l[71] * l[21])) * inv[2];
+    l[82] = (a[82] - (l[80] * l[20] + l[81] * l[21])) * inv[2];
+    l[92] = (a[92] - (l[90] * l[20] + l[91] * l[21])) * inv[2];
+    pivot = a[33] - (l[30] * l[30] + l[31] * l[31] + l[32] * l[32]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[33] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[33];
+    l[43] = (a[43] - (l[40] * l[30] + l[41] * l[31] + l[42] * l[32])) * inv[3];
+    l[53] = (a[53] - (l[50] * l[30] + l[51] * l[31] + l[52] * l[32])) * inv[3];
+    l[63] = (a[63] - (l[60] * l[30] + l[61] * l[31] + l[62] * l[32])) * inv[3];
+    l[73] = (a[73] - (l[70] * l[30] + l[71] * l[31] + l[72] * l[32])) * inv[3];
+    l[83] = (a[83] - (l[80] * l[30] + l[81] * l[31] + l[82] * l[32])) * inv[3];
+    l[93] = (a[93] - (l[90] * l[30] + l[91] * l[31] + l[92] * l[32])) * inv[3];
+    pivot = a[44] - (l[40] * l[40] + l[41] * l[41] + l[42] * l[42] + l[43] * l[43]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[44] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[44];
+    l[54] = (a[54] - (l[50] * l[40] + l[51] * l[41] + l[52] * l[42] + l[53] * l[43])) * inv[4];
+    l[64] = (a[64] - (l[60] * l[40] + l[61] * l[41] + l[62] * l[42] + l[63] * l[43])) * inv[4];
+    l[74] = (a[74] - (l[70] * l[40] + l[71] * l[41] + l[72] * l[42] + l[73] * l[43])) * inv[4];
+    l[84] = (a[84] - (l[80] * l[40] + l[81] * l[41] + l[82] * l[42] + l[83] * l[43])) * inv[4];
+    l[94] = (a[94] - (l[90] * l[40] + l[91] * l[41] + l[92] * l[42] + l[93] * l[43])) * inv[4];
+    pivot = a[55] - (l[50] * l[50] + l[51] * l[51] + l[52] * l[52] + l[53] * l[53] + l[54] * l[54]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[55] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[55];
+    l[65] = (a[65] - (l[60] * l[50] + l[61] * l[51] + l[62] * l[52] + l[63] * l[53] + l[64] * l[54])) * inv[5];
+    l[75] = (a[75] - (l[70] * l[50] + l[71] * l[51] + l[72] * l[52] + l[73] * l[53] + l[74] * l[54])) * inv[5];
+    l[85] = (a[85] - (l[80] * l[50] + l[81] * l[51] + l[82] * l[52] + l[83] * l[53] + l[84] * l[54])) * inv[5];
+    l[95] = (a[95] - (l[90] * l[50] + l[91] * l[51] + l[92] * l[52] + l[93] * l[53] + l[94] * l[54])) * inv[5];
+    pivot = a[66] - (l[60] * l[60] + l[61] * l[61] + l[62] * l[62] + l[63] * l[63] + l[64] * l[64]
+                   + l[65] * l[65]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[66] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[66];
+    l[76] = (a[76] - (l[70] * l[60] + l[71] * l[61] + l[72] * l[62] + l[73] * l[63] + l[74] * l[64]
+                    + l[75] * l[65])) * inv[6];
+    l[86] = (a[86] - (l[80] * l[60] + l[81] * l[61] + l[82] * l[62] + l[83] * l[63] + l[84] * l[64]
+                    + l[85] * l[65])) * inv[6];
+    l[96] = (a[96] - (l[90] * l[60] + l[91] * l[61] + l[92] * l[62] + l[93] * l[63] + l[94] * l[64]
+                    + l[95] * l[65])) * inv[6];
+    pivot = a[77] - (l[70] * l[70] + l[71] * l[71] + l[72] * l[72] + l[73] * l[73] + l[74] * l[74]
+                   + l[75] * l[75] + l[76] * l[76]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[77] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[7] = 1.0f / l[77];
+    l[87] = (a[87] - (l[80] * l[70] + l[81] * l[71] + l[82] * l[72] + l[83] * l[73] + l[84] * l[74]
+                    + l[85] * l[75] + l[86] * l[76])) * inv[7];
+    l[97] = (a[97] - (l[90] * l[70] + l[91] * l[71] + l[92] * l[72] + l[93] * l[73] + l[94] * l[74]
+                    + l[95] * l[75] + l[96] * l[76])) * inv[7];
+    pivot = a[88] - (l[80] * l[80] + l[81] * l[81] + l[82] * l[82] + l[83] * l[83] + l[84] * l[84]
+                   + l[85] * l[85] + l[86] * l[86] + l[87] * l[87]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[88] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[8] = 1.0f / l[88];
+    l[98] = (a[98] - (l[90] * l[80] + l[91] * l[81] + l[92] * l[82] + l[93] * l[83] + l[94] * l[84]
+                    + l[95] * l[85] + l[96] * l[86] + l[97] * l[87])) * inv[8];
+    pivot = a[99] - (l[90] * l[90] + l[91] * l[91] + l[92] * l[92] + l[93] * l[93] + l[94] * l[94]
+                   + l[95] * l[95] + l[96] * l[96] + l[97] * l[97] + l[98] * l[98]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[99] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[9] = 1.0f / l[99];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[23] = 0.0f;
+    l[24] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[36] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[45] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[48] = 0.0f;
+    l[49] = 0.0f;
+    l[56] = 0.0f;
+    l[57] = 0.0f;
+    l[58] = 0.0f;
+    l[59] = 0.0f;
+    l[67] = 0.0f;
+    l[68] = 0.0f;
+    l[69] = 0.0f;
+    l[78] = 0.0f;
+    l[79] = 0.0f;
+    l[89] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve10(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[10] * x[0])) / l[11];
+    x[2] = (b[2] - (l[20] * x[0] + l[21] * x[1])) / l[22];
+    x[3] = (b[3] - (l[30] * x[0] + l[31] * x[1] + l[32] * x[2])) / l[33];
+    x[4] = (b[4] - (l[40] * x[0] + l[41] * x[1] + l[42] * x[2] + l[43] * x[3])) / l[44];
+    x[5] = (b[5] - (l[50] * x[0] + l[51] * x[1] + l[52] * x[2] + l[53] * x[3] + l[54] * x[4])) / l[55];
+    x[6] = (b[6] - (l[60] * x[0] + l[61] * x[1] + l[62] * x[2] + l[63] * x[3] + l[64] * x[4] + l[65] * x[5])) / l[66];
+    x[7] = (b[7] - (l[70] * x[0] + l[71] * x[1] + l[72] * x[2] + l[73] * x[3] + l[74] * x[4] + l[75] * x[5]
+                  + l[76] * x[6])) / l[77];
+    x[8] = (b[8] - (l[80] * x[0] + l[81] * x[1] + l[82] * x[2] + l[83] * x[3] + l[84] * x[4] + l[85] * x[5]
+                  + l[86] * x[6] + l[87] * x[7])) / l[88];
+    x[9] = (b[9] - (l[90] * x[0] + l[91] * x[1] + l[92] * x[2] + l[93] * x[3] + l[94] * x[4] + l[95] * x[5]
+                  + l[96] * x[6] + l[97] * x[7] + l[98] * x[8])) / l[99];
+    x[9] = x[9] / l[99];
+    x[8] = (x[8] - (l[98] * x[9])) / l[88];
+    x[7] = (x[7] - (l[87] * x[8] + l[97] * x[9])) / l[77];
+    x[6] = (x[6] - (l[76] * x[7] + l[86] * x[8] + l[96] * x[9])) / l[66];
+    x[5] = (x[5] - (l[65] * x[6] + l[75] * x[7] + l[85] * x[8] + l[95] * x[9])) / l[55];
+    x[4] = (x[4] - (l[54] * x[5] + l[64] * x[6] + l[74] * x[7] + l[84] * x[8] + l[94] * x[9])) / l[44];
+    x[3] = (x[3] - (l[43] * x[4] + l[53] * x[5] + l[63] * x[6] + l[73] * x[7] + l[83] * x[8] + l[93] * x[9])) / l[33];
+    x[2] = (x[2] - (l[32] * x[3] + l[42] * x[4] + l[52] * x[5] + l[62] * x[6] + l[72] * x[7] + l[82] * x[8]
+                  + l[92] * x[9])) / l[22];
+    x[1] = (x[1] - (l[21] * x[2] + l[31] * x[3] + l[41] * x[4] + l[51] * x[5] + l[61] * x[6] + l[71] * x[7]
+                  + l[81] * x[8] + l[91] * x[9])) / l[11];
+    x[0] = (x[0] - (l[10] * x[1] + l[20] * x[2] + l[30] * x[3] + l[40] * x[4] + l[50] * x[5] + l[60] * x[6]
+                  + l[70] * x[7] + l[80] * x[8] + l[90] * x[9])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl10(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[10];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[10] = a[10] * inv;
+    l[20] = a[20] * inv;
+    l[30] = a[30] * inv;
+    l[40] = a[40] * inv;
+    l[50] = a[50] * inv;
+    l[60] = a[60] * inv;
+    l[70] = a[70] * inv;
+    l[80] = a[80] * inv;
+    l[90] = a[90] * inv;
+    l[0] = 1.0f;
+    v[0] = l[10] * d[0];
+    d[1] = a[11] - (l[10] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[21] = (a[21] - (l[20] * v[0])) * inv;
+    l[31] = (a[31] - (l[30] * v[0])) * inv;
+    l[41] = (a[41] - (l[40] * v[0])) * inv;
+    l[51] = (a[51] - (l[50] * v[0])) * inv;
+    l[61] = (a[61] - (l[60] * v[0])) * inv;
+    l[71] = (a[71] - (l[70] * v[0])) * inv;
+    l[81] = (a[81] - (l[80] * v[0])) * inv;
+    l[91] = (a[91] - (l[90] * v[0])) * inv;
+    l[11] = 1.0f;
+    v[0] = l[20] * d[0];
+    v[1] = l[21] * d[1];
+    d[2] = a[22] - (l[20] * v[0] + l[21] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[32] = (a[32] - (l[30] * v[0] + l[31] * v[1])) * inv;
+    l[42] = (a[42] - (l[40] * v[0] + l[41] * v[1])) * inv;
+    l[52] = (a[52] - (l[50] * v[0] + l[51] * v[1])) * inv;
+    l[62] = (a[62] - (l[60] * v[0] + l[61] * v[1])) * inv;
+    l[72] = (a[72] - (l[70] * v[0] + l[71] * v[1])) * inv;
+    l[82] = (a[82] - (l[80] * v[0] + l[81] * v[1])) * inv;
+    l[92] = (a[92] - (l[90] * v[0] + l[91] * v[1])) * inv;
+    l[22] = 1.0f;
+    v[0] = l[30] * d[0];
+    v[1] = l[31] * d[1];
+    v[2] = l[32] * d[2];
+    d[3] = a[33] - (l[30] * v[0] + l[31] * v[1] + l[32] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[43] = (a[43] - (l[40] * v[0] + l[41] * v[1] + l[42] * v[2])) * inv;
+    l[53] = (a[53] - (l[50] * v[0] + l[51] * v[1] + l[52] * v[2])) * inv;
+    l[63] = (a[63] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2])) * inv;
+    l[73] = (a[73] - (l[70] * v[0] + l[71] * v[1] + l[72] * v[2])) * inv;
+    l[83] = (a[83] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2])) * inv;
+    l[93] = (a[93] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2])) * inv;
+    l[33] = 1.0f;
+    v[0] = l[40] * d[0];
+    v[1] = l[41] * d[1];
+    v[2] = l[42] * d[2];
+    v[3] = l[43] * d[3];
+    d[4] = a[44] - (l[40] * v[0] + l[41] * v[1] + l[42] * v[2] + l[43] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[54] = (a[54] - (l[50] * v[0] + l[51] * v[1] + l[52] * v[2] + l[53] * v[3])) * inv;
+    l[64] = (a[64] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2] + l[63] * v[3])) * inv;
+    l[74] = (a[74] - (l[70] * v[0] + l[71] * v[1] + l[72] * v[2] + l[73] * v[3])) * inv;
+    l[84] = (a[84] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2] + l[83] * v[3])) * inv;
+    l[94] = (a[94] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3])) * inv;
+    l[44] = 1.0f;
+    v[0] = l[50] * d[0];
+    v[1] = l[51] * d[1];
+    v[2] = l[52] * d[2];
+    v[3] = l[53] * d[3];
+    v[4] = l[54] * d[4];
+    d[5] = a[55] - (l[50] * v[0] + l[51] * v[1] + l[52] * v[2] + l[53] * v[3] + l[54] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[65] = (a[65] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2] + l[63] * v[3] + l[64] * v[4])) * inv;
+    l[75] = (a[75] - (l[70] * v[0] + l[71] * v[1] + l[72] * v[2] + l[73] * v[3] + l[74] * v[4])) * inv;
+    l[85] = (a[85] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2] + l[83] * v[3] + l[84] * v[4])) * inv;
+    l[95] = (a[95] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3] + l[94] * v[4])) * inv;
+    l[55] = 1.0f;
+    v[0] = l[60] * d[0];
+    v[1] = l[61] * d[1];
+    v[2] = l[62] * d[2];
+    v[3] = l[63] * d[3];
+    v[4] = l[64] * d[4];
+    v[5] = l[65] * d[5];
+    d[6] = a[66] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2] + l[63] * v[3] + l[64] * v[4] + l[65] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[76] = (a[76] - (l[70] * v[0] + l[71] * v[1] + l[72] * v[2] + l[73] * v[3] + l[74] * v[4] + l[75] * v[5])) * inv;
+    l[86] = (a[86] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2] + l[83] * v[3] + l[84] * v[4] + l[85] * v[5])) * inv;
+    l[96] = (a[96] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3] + l[94] * v[4] + l[95] * v[5])) * inv;
+    l[66] = 1.0f;
+    v[0] = l[70] * d[0];
+    v[1] = l[71] * d[1];
+    v[2] = l[72] * d[2];
+    v[3] = l[73] * d[3];
+    v[4] = l[74] * d[4];
+    v[5] = l[75] * d[5];
+    v[6] = l[76] * d[6];
+    d[7] = a[77] - (l[70] * v[0] + l[71] * v[1] + l[72] * v[2] + l[73] * v[3] + l[74] * v[4] + l[75] * v[5]
+                  + l[76] * v[6]);
+    ok  &= (boolean)(d[7] != 0.0f);
+    inv  = 1.0f / ((d[7] != 0.0f) ? d[7] : 1.0f);
+    l[87] = (a[87] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2] + l[83] * v[3] + l[84] * v[4] + l[85] * v[5]
+                    + l[86] * v[6])) * inv;
+    l[97] = (a[97] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3] + l[94] * v[4] + l[95] * v[5]
+                    + l[96] * v[6])) * inv;
+    l[77] = 1.0f;
+    v[0] = l[80] * d[0];
+    v[1] = l[81] * d[1];
+    v[2] = l[82] * d[2];
+    v[3] = l[83] * d[3];
+    v[4] = l[84] * d[4];
+    v[5] = l[85] * d[5];
+    v[6] = l[86] * d[6];
+    v[7] = l[87] * d[7];
+    d[8] = a[88] - (l[80] * v[0] + l[81] * v[1] + l[82] * v[2] + l[83] * v[3] + l[84] * v[4] + l[85] * v[5]
+                  + l[86] * v[6] + l[87] * v[7]);
+    ok  &= (boolean)(d[8] != 0.0f);
+    inv  = 1.0f / ((d[8] != 0.0f) ? d[8] : 1.0f);
+    l[98] = (a[98] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3] + l[94] * v[4] + l[95] * v[5]
+                    + l[96] * v[6] + l[97] * v[7])) * inv;
+    l[88] = 1.0f;
+    v[0] = l[90] * d[0];
+    v[1] = l[91] * d[1];
+    v[2] = l[92] * d[2];
+    v[3] = l[93] * d[3];
+    v[4] = l[94] * d[4];
+    v[5] = l[95] * d[5];
+    v[6] = l[96] * d[6];
+    v[7] = l[97] * d[7];
+    v[8] = l[98] * d[8];
+    d[9] = a[99] - (l[90] * v[0] + l[91] * v[1] + l[92] * v[2] + l[93] * v[3] + l[94] * v[4] + l[95] * v[5]
+                  + l[96] * v[6] + l[97] * v[7] + l[98] * v[8]);
+    ok  &= (boolean)(d[9] != 0.0f);
+    inv  = 1.0f / ((d[9] != 0.0f) ? d[9] : 1.0f);
+    l[99] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[12] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[23] = 0.0f;
+    l[24] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[36] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[45] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[48] = 0.0f;
+    l[49] = 0.0f;
+    l[56] = 0.0f;
+    l[57] = 0.0f;
+    l[58] = 0.0f;
+    l[59] = 0.0f;
+    l[67] = 0.0f;
+    l[68] = 0.0f;
+    l[69] = 0.0f;
+    l[78] = 0.0f;
+    l[79] = 0.0f;
+    l[89] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve10(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[10] * x[0]);
+    x[2] = b[2] - (l[20] * x[0] + l[21] * x[1]);
+    x[3] = b[3] - (l[30] * x[0] + l[31] * x[1] + l[32] * x[2]);
+    x[4] = b[4] - (l[40] * x[0] + l[41] * x[1] + l[42] * x[2] + l[43] * x[3]);
+    x[5] = b[5] - (l[50] * x[0] + l[51] * x[1] + l[52] * x[2] + l[53] * x[3] + l[54] * x[4]);
+    x[6] = b[6] - (l[60] * x[0] + l[61] * x[1] + l[62] * x[2] + l[63] * x[3] + l[64] * x[4] + l[65] * x[5]);
+    x[7] = b[7] - (l[70] * x[0] + l[71] * x[1] + l[72] * x[2] + l[73] * x[3] + l[74] * x[4] + l[75] * x[5]
+                 + l[76] * x[6]);
+    x[8] = b[8] - (l[80] * x[0] + l[81] * x[1] + l[82] * x[2] + l[83] * x[3] + l[84] * x[4] + l[85] * x[5]
+                 + l[86] * x[6] + l[87] * x[7]);
+    x[9] = b[9] - (l[90] * x[0] + l[91] * x[1] + l[92] * x[2] + l[93] * x[3] + l[94] * x[4] + l[95] * x[5]
+                 + l[96] * x[6] + l[97] * x[7] + l[98] * x[8]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[7] = x[7] / d[7];
+    x[8] = x[8] / d[8];
+    x[9] = x[9] / d[9];
+    x[8] = x[8] - (l[98] * x[9]);
+    x[7] = x[7] - (l[87] * x[8] + l[97] * x[9]);
+    x[6] = x[6] - (l[76] * x[7] + l[86] * x[8] + l[96] * x[9]);
+    x[5] = x[5] - (l[65] * x[6] + l[75] * x[7] + l[85] * x[8] + l[95] * x[9]);
+    x[4] = x[4] - (l[54] * x[5] + l[64] * x[6] + l[74] * x[7] + l[84] * x[8] + l[94] * x[9]);
+    x[3] = x[3] - (l[43] * x[4] + l[53] * x[5] + l[63] * x[6] + l[73] * x[7] + l[83] * x[8] + l[93] * x[9]);
+    x[2] = x[2] - (l[32] * x[3] + l[42] * x[4] + l[52] * x[5] + l[62] * x[6] + l[72] * x[7] + l[82] * x[8]
+                 + l[92] * x[9]);
+    x[1] = x[1] - (l[21] * x[2] + l[31] * x[3] + l[41] * x[4] + l[51] * x[5] + l[61] * x[6] + l[71] * x[7]
+                 + l[81] * x[8] + l[91] * x[9]);
+    x[0] = x[0] - (l[10] * x[1] + l[20] * x[2] + l[30] * x[3] + l[40] * x[4] + l[50] * x[5] + l[60] * x[6]
+                 + l[70] * x[7] + l[80] * x[8] + l[90] * x[9]);
+}
+
+
+void Ifx_MatF32_add11(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+    c[49] = a[49] + b[49];
+    c[50] = a[50] + b[50];
+    c[51] = a[51] + b[51];
+    c[52] = a[52] + b[52];
+    c[53] = a[53] + b[53];
+    c[54] = a[54] + b[54];
+    c[55] = a[55] + b[55];
+    c[56] = a[56] + b[56];
+    c[57] = a[57] + b[57];
+    c[58] = a[58] + b[58];
+    c[59] = a[59] + b[59];
+    c[60] = a[60] + b[60];
+    c[61] = a[61] + b[61];
+    c[62] = a[62] + b[62];
+    c[63] = a[63] + b[63];
+    c[64] = a[64] + b[64];
+    c[65] = a[65] + b[65];
+    c[66] = a[66] + b[66];
+    c[67] = a[67] + b[67];
+    c[68] = a[68] + b[68];
+    c[69] = a[69] + b[69];
+    c[70] = a[70] + b[70];
+    c[71] = a[71] + b[71];
+    c[72] = a[72] + b[72];
+    c[73] = a[73] + b[73];
+    c[74] = a[74] + b[74];
+    c[75] = a[75] + b[75];
+    c[76] = a[76] + b[76];
+    c[77] = a[77] + b[77];
+    c[78] = a[78] + b[78];
+    c[79] = a[79] + b[79];
+    c[80] = a[80] + b[80];
+    c[81] = a[81] + b[81];
+    c[82] = a[82] + b[82];
+    c[83] = a[83] + b[83];
+    c[84] = a[84] + b[84];
+    c[85] = a[85] + b[85];
+    c[86] = a[86] + b[86];
+    c[87] = a[87] + b[87];
+    c[88] = a[88] + b[88];
+    c[89] = a[89] + b[89];
+    c[90] = a[90] + b[90];
+    c[91] = a[91] + b[91];
+    c[92] = a[92] + b[92];
+    c[93] = a[93] + b[93];
+    c[94] = a[94] + b[94];
+    c[95] = a[95] + b[95];
+    c[96] = a[96] + b[96];
+    c[97] = a[97] + b[97];
+    c[98] = a[98] + b[98];
+    c[99] = a[99] + b[99];
+    c[100] = a[100] + b[100];
+    c[101] = a[101] + b[101];
+    c[102] = a[102] + b[102];
+    c[103] = a[103] + b[103];
+    c[104] = a[104] + b[104];
+    c[105] = a[105] + b[105];
+    c[106] = a[106] + b[106];
+    c[107] = a[107] + b[107];
+    c[108] = a[108] + b[108];
+    c[109] = a[109] + b[109];
+    c[110] = a[110] + b[110];
+    c[111] = a[111] + b[111];
+    c[112] = a[112] + b[112];
+    c[113] = a[113] + b[113];
+    c[114] = a[114] + b[114];
+    c[115] = a[115] + b[115];
+    c[116] = a[116] + b[116];
+    c[117] = a[117] + b[117];
+    c[118] = a[118] + b[118];
+    c[119] = a[119] + b[119];
+    c[120] = a[120] + b[120];
+}
+
+
+void Ifx_MatF32_transpose11(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[11];
+    c[2] = a[22];
+    c[3] = a[33];
+    c[4] = a[44];
+    c[5] = a[55];
+    c[6] = a[66];
+    c[7] = a[77];
+    c[8] = a[88];
+    c[9] = a[99];
+    c[10] = a[110];
+    c[11] = a[1];
+    c[12] = a[12];
+    c[13] = a[23];
+    c[14] = a[34];
+    c[15] = a[45];
+    c[16] = a[56];
+    c[17] = a[67];
+    c[18] = a[78];
+    c[19] = a[89];
+    c[20] = a[100];
+    c[21] = a[111];
+    c[22] = a[2];
+    c[23] = a[13];
+    c[24] = a[24];
+    c[25] = a[35];
+    c[26] = a[46];
+    c[27] = a[57];
+    c[28] = a[68];
+    c[29] = a[79];
+    c[30] = a[90];
+    c[31] = a[101];
+    c[32] = a[112];
+    c[33] = a[3];
+    c[34] = a[14];
+    c[35] = a[25];
+    c[36] = a[36];
+    c[37] = a[47];
+    c[38] = a[58];
+    c[39] = a[69];
+    c[40] = a[80];
+    c[41] = a[91];
+    c[42] = a[102];
+    c[43] = a[113];
+    c[44] = a[4];
+    c[45] = a[15];
+    c[46] = a[26];
+    c[47] = a[37];
+    c[48] = a[48];
+    c[49] = a[59];
+    c[50] = a[70];
+    c[51] = a[81];
+    c[52] = a[92];
+    c[53] = a[103];
+    c[54] = a[114];
+    c[55] = a[5];
+    c[56] = a[16];
+    c[57] = a[27];
+    c[58] = a[38];
+    c[59] = a[49];
+    c[60] = a[60];
+    c[61] = a[71];
+    c[62] = a[82];
+    c[63] = a[93];
+    c[64] = a[104];
+    c[65] = a[115];
+    c[66] = a[6];
+    c[67] = a[17];
+    c[68] = a[28];
+    c[69] = a[39];
+    c[70] = a[50];
+    c[71] = a[61];
+    c[72] = a[72];
+    c[73] = a[83];
+    c[74] = a[94];
+    c[75] = a[105];
+    c[76] = a[116];
+    c[77] = a[7];
+    c[78] = a[18];
+    c[79] = a[29];
+    c[80] = a[40];
+    c[81] = a[51];
+    c[82] = a[62];
+    c[83] = a[73];
+    c[84] = a[84];
+    c[85] = a[95];
+    c[86] = a[106];
+    c[87] = a[117];
+    c[88] = a[8];
+    c[89] = a[19];
+    c[90] = a[30];
+    c[91] = a[41];
+    c[92] = a[52];
+    c[93] = a[63];
+    c[94] = a[74];
+    c[95] = a[85];
+    c[96] = a[96];
+    c[97] = a[107];
+    c[98] = a[118];
+    c[99] = a[9];
+    c[100] = a[20];
+    c[101] = a[31];
+    c[102] = a[42];
+    c[103] = a[53];
+    c[104] = a[64];
+    c[105] = a[75];
+    c[106] = a[86];
+    c[107] = a[97];
+    c[108] = a[108];
+    c[109] = a[119];
+    c[110] = a[10];
+    c[111] = a[21];
+    c[112] = a[32];
+    c[113] = a[43];
+    c[114] = a[54];
+    c[115] = a[65];
+    c[116] = a[76];
+    c[117] = a[87];
+    c[118] = a[98];
+    c[119] = a[109];
+    c[120] = a[120];
+}
+
+
+void Ifx_MatF32_mul11(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[11] + a[2] * b[22] + a[3] * b[33] + a[4] * b[44] + a[5] * b[55]
+         + a[6] * b[66] + a[7] * b[77] + a[8] * b[88] + a[9] * b[99] + a[10] * b[110];
+    c[1] = a[0] * b[1] + a[1] * b[12] + a[2] * b[23] + a[3] * b[34] + a[4] * b[45] + a[5] * b[56]
+         + a[6] * b[67] + a[7] * b[78] + a[8] * b[89] + a[9] * b[100] + a[10] * b[111];
+    c[2] = a[0] * b[2] + a[1] * b[13] + a[2] * b[24] + a[3] * b[35] + a[4] * b[46] + a[5] * b[57]
+         + a[6] * b[68] + a[7] * b[79] + a[8] * b[90] + a[9] * b[101] + a[10] * b[112];
+    c[3] = a[0] * b[3] + a[1] * b[14] + a[2] * b[25] + a[3] * b[36] + a[4] * b[47] + a[5] * b[58]
+         + a[6] * b[69] + a[7] * b[80] + a[8] * b[91] + a[9] * b[102] + a[10] * b[113];
+    c[4] = a[0] * b[4] + a[1] * b[15] + a[2] * b[26] + a[3] * b[37] + a[4] * b[48] + a[5] * b[59]
+         + a[6] * b[70] + a[7] * b[81] + a[8] * b[92] + a[9] * b[103] + a[10] * b[114];
+    c[5] = a[0] * b[5] + a[1] * b[16] + a[2] * b[27] + a[3] * b[38] + a[4] * b[49] + a[5] * b[60]
+         + a[6] * b[71] + a[7] * b[82] + a[8] * b[93] + a[9] * b[104] + a[10] * b[115];
+    c[6] = a[0] * b[6] + a[1] * b[17] + a[2] * b[28] + a[3] * b[39] + a[4] * b[50] + a[5] * b[61]
+         + a[6] * b[72] + a[7] * b[83] + a[8] * b[94] + a[9] * b[105] + a[10] * b[116];
+    c[7] = a[0] * b[7] + a[1] * b[18] + a[2] * b[29] + a[3] * b[40] + a[4] * b[51] + a[5] * b[62]
+         + a[6] * b[73] + a[7] * b[84] + a[8] * b[95] + a[9] * b[106] + a[10] * b[117];
+    c[8] = a[0] * b[8] + a[1] * b[19] + a[2] * b[30] + a[3] * b[41] + a[4] * b[52] + a[5] * b[63]
+         + a[6] * b[74] + a[7] * b[85] + a[8] * b[96] + a[9] * b[107] + a[10] * b[118];
+    c[9] = a[0] * b[9] + a[1] * b[20] + a[2] * b[31] + a[3] * b[42] + a[4] * b[53] + a[5] * b[64]
+         + a[6] * b[75] + a[7] * b[86] + a[8] * b[97] + a[9] * b[108] + a[10] * b[119];
+    c[10] = a[0] * b[10] + a[1] * b[21] + a[2] * b[32] + a[3] * b[43] + a[4] * b[54] + a[5] * b[65]
+          + a[6] * b[76] + a[7] * b[87] + a[8] * b[98] + a[9] * b[109] + a[10] * b[120];
+    c[11] = a[11] * b[0] + a[12] * b[11] + a[13] * b[22] + a[14] * b[33] + a[15] * b[44] + a[16] * b[55]
+          + a[17] * b[66] + a[18] * b[77] + a[19] * b[88] + a[20] * b[99] + a[21] * b[110];
+    c[12] = a[11] * b[1] + a[12] * b[12] + a[13] * b[23] + a[14] * b[34] + a[15] * b[45] + a[16] * b[56]
+          + a[17] * b[67] + a[18] * b[78] + a[19] * b[89] + a[20] * b[100] + a[21] * b[111];
+    c[13] = a[11] * b[2] + a[12] * b[13] + a[13] * b[24] + a[14] * b[35] + a[15] * b[46] + a[16] * b[57]
+          + a[17] * b[68] + a[18] * b[79] + a[19] * b[90] + a[20] * b[101] + a[21] * b[112];
+    c[14] = a[11] * b[3] + a[12] * b[14] + a[13] * b[25] + a[14] * b[36] + a[15] * b[47] + a[16] * b[58]
+          + a[17] * b[69] + a[18] * b[80] + a[19] * b[91] + a[20] * b[102] + a[21] * b[113];
+    c[15] = a[11] * b[4] + a[12] * b[15] + a[13] * b[26] + a[14] * b[37] + a[15] * b[48] + a[16] * b[59]
+          + a[17] * b[70] + a[18] * b[81] + a[19] * b[92] + a[20] * b[103] + a[21] * b[114];
+    c[16] = a[11] * b[5] + a[12] * b[16] + a[13] * b[27] + a[14] * b[38] + a[15] * b[49] + a[16] * b[60]
+          + a[17] * b[71] + a[18] * b[82] + a[19] * b[93] + a[20] * b[104] + a[21] * b[115];
+    c[17] = a[11] * b[6] + a[12] * b[17] + a[13] * b[28] + a[14] * b[39] + a[15] * b[50] + a[16] * b[61]
+          + a[17] * b[72] + a[18] * b[83] + a[19] * b[94] + a[20] * b[105] + a[21] * b[116];
+    c[18] = a[11] * b[7] + a[12] * b[18] + a[13] * b[29] + a[14] * b[40] + a[15] * b[51] + a[16] * b[62]
+          + a[17] * b[73] + a[18] * b[84] + a[19] * b[95] + a[20] * b[106] + a[21] * b[117];
+    c[19] = a[11] * b[8] + a[12] * b[19] + a[13] * b[30] + a[14] * b[41] + a[15] * b[52] + a[16] * b[63]
+          + a[17] * b[74] + a[18] * b[85] + a[19] * b[96] + a[20] * b[107] + a[21] * b[118];
+    c[20] = a[11] * b[9] + a[12] * b[20] + a[13] * b[31] + a[14] * b[42] + a[15] * b[53] + a[16] * b[64]
+          + a[17] * b[75] + a[18] * b[86] + a[19] * b[97] + a[20] * b[108] + a[21] * b[119];
+    c[21] = a[11] * b[10] + a[12] * b[21] + a[13] * b[32] + a[14] * b[43] + a[15] * b[54] + a[16] * b[65]
+          + a[17] * b[76] + a[18] * b[87] + a[19] * b[98] + a[20] * b[109] + a[21] * b[120];
+    c[22] = a[22] * b[0] + a[23] * b[11] + a[24] * b[22] + a[25] * b[33] + a[26] * b[44] + a[27] * b[55]
+          + a[28] * b[66] + a[29] * b[77] + a[30] * b[88] + a[31] * b[99] + a[32] * b[110];
+    c[23] = a[22] * b[1] + a[23] * b[12] + a[24] * b[23] + a[25] * b[34] + a[26] * b[45] + a[27] * b[56]
+          + a[28] * b[67] + a[29] * b[78] + a[30] * b[89] + a[31] * b[100] + a[32] * b[111];
+    c[24] = a[22] * b[2] + a[23] * b[13] + a[24] * b[24] + a[25] * b[35] + a[26] * b[46] + a[27] * b[57]
+          + a[28] * b[68] + a[29] * b[79] + a[30] * b[90] + a[31] * b[101] + a[32] * b[112];
+    c[25] = a[22] * b[3] + a[23] * b[14] + a[24] * b[25] + a[25] * b[36] + a[26] * b[47] + a[27] * b[58]
+          + a[28] * b[69] + a[29] * b[80] + a[30] * b[91] + a[31] * b[102] + a[32] * b[113];
+    c[26] = a[22] * b[4] + a[23] * b[15] + a[24] * b[26] + a[25] * b[37] + a[26] * b[48] + a[27] * b[59]
+          + a[28] * b[70] + a[29] * b[81] + a[30] * b[92] + a[31] * b[103] + a[32] * b[114];
+    c[27] = a[22] * b[5] + a[23] * b[16] + a[24] * b[27] + a[25] * b[38] + a[26] * b[49] + a[27] * b[60]
+          + a[28] * b[71] + a[29] * b[82] + a[30] * b[93] + a[31] * b[104] + a[32] * b[115];
+    c[28] = a[22] * b[6] + a[23] * b[17] + a[24] * b[28] + a[25] * b[39] + a[26] * b[50] + a[27] * b[61]
+          + a[28] * b[72] + a[29] * b[83] + a[30] * b[94] + a[31] * b[105] + a[32] * b[116];
+    c[29] = a[22] * b[7] + a[23] * b[18] + a[24] * b[29] + a[25] * b[40] + a[26] * b[51] + a[27] * b[62]
+          + a[28] * b[73] + a[29] * b[84] + a[30] * b[95] + a[31] * b[106] + a[32] * b[117];
+    c[30] = a[22] * b[8] + a[23] * b[19] + a[24] * b[30] + a[25] * b[41] + a[26] * b[52] + a[27] * b[63]
+          + a[28] * b[74] + a[29] * b[85] + a[30] * b[96] + a[31] * b[107] + a[32] * b[118];
+    c[31] = a[22] * b[9] + a[23] * b[20] + a[24] * b[31] + a[25] * b[42] + a[26] * b[53] + a[27] * b[64]
+          + a[28] * b[75] + a[29] * b[86] + a[30] * b[97] + a[31] * b[108] + a[32] * b[119];
+    c[32] = a[22] * b[10] + a[23] * b[21] + a[24] * b[32] + a[25] * b[43] + a[26] * b[54] + a[27] * b[65]
+          + a[28] * b[76] + a[29] * b[87] + a[30] * b[98] + a[31] * b[109] + a[32] * b[120];
+    c[33] = a[33] * b[0] + a[34] * b[11] + a[35] * b[22] + a[36] * b[33] + a[37] * b[44] + a[38] * b[55]
+          + a[39] * b[66] + a[40] * b[77] + a[41] * b[88] + a[42] * b[99] + a[43] * b[110];
+    c[34] = a[33] * b[1] + a[34] * b[12] + a[35] * b[23] + a[36] * b[34] + a[37] * b[45] + a[38] * b[56]
+          + a[39] * b[67] + a[40] * b[78] + a[41] * b[89] + a[42] * b[100] + a[43] * b[111];
+    c[35] = a[33] * b[2] + a[34] * b[13] + a[35] * b[24] + a[36] * b[35] + a[37] * b[46] + a[38] * b[57]
+          + a[39] * b[68] + a[40] * b[79] + a[41] * b[90] + a[42] * b[101] + a[43] * b[112];
+    c[36] = a[33] * b[3] + a[34] * b[14] + a[35] * b[25] + a[36] * b[36] + a[37] * b[47] + a[38] * b[58]
+          + a[39] * b[69] + a[40] * b[80] + a[41] * b[91] + a[42] * b[102] + a[43] * b[113];
+    c[37] = a[33] * b[4] + a[34] * b[15] + a[35] * b[26] + a[36] * b[37] + a[37] * b[48] + a[38] * b[59]
+          + a[39] * b[70] + a[40] * b[81] + a[41] * b[92] + a[42] * b[103] + a[43] * b[114];
+    c[38] = a[33] * b[5] + a[34] * b[16] + a[35] * b[27] + a[36] * b[38] + a[37] * b[49] + a[38] * b[60]
+          + a[39] * b[71] + a[40] * b[82] + a[41] * b[93] + a[42] * b[104] + a[43] * b[115];
+    c[39] = a[33] * b[6] + a[34] * b[17] + a[35] * b[28] + a[36] * b[39] + a[37] * b[50] + a[38] * b[61]
+          + a[39] * b[72] + a[40] * b[83] + a[41] * b[94] + a[42] * b[105] + a[43] * b[116];
+    c[40] = a[33] * b[7] + a[34] * b[18] + a[35] * b[29] + a[36] * b[40] + a[37] * b[51] + a[38] * b[62]
+          + a[39] * b[73] + a[40] * b[84] + a[41] * b[95] + a[42] * b[106] + a[43] * b[117];
+    c[41] = a[33] * b[8] + a[34] * b[19] + a[35] * b[30] + a[36] * b[41] + a[37] * b[52] + a[38] * b[63]
+          + a[39] * b[74] + a[40] * b[85] + a[41] * b[96] + a[42] * b[107] + a[43] * b[118];
+    c[42] = a[33] * b[9] + a[34] * b[20] + a[35] * b[31] + a[36] * b[42] + a[37] * b[53] + a[38] * b[64]
+          + a[39] * b[75] + a[40] * b[86] + a[41] * b[97] + a[42] * b[108] + a[43] * b[119];
+    c[43] = a[33] * b[10] + a[34] * b[21] + a[35] * b[32] + a[36] * b[43] + a[37] * b[54] + a[38] * b[65]
+          + a[39] * b[76] + a[40] * b[87] + a[41] * b[98] + a[42] * b[109] + a[43] * b[120];
+    c[44] = a[44] * b[0] + a[45] * b[11] + a[46] * b[22] + a[47] * b[33] + a[48] * b[44] + a[49] * b[55]
+          + a[50] * b[66] + a[51] * b[77] + a[52] * b[88] + a[53] * b[99] + a[54] * b[110];
+    c[45] = a[44] * b[1] + a[45] * b[12] + a[46] * b[23] + a[47] * b[34] + a[48] * b[45] + a[49] * b[56]
+          + a[50] * b[67] + a[51] * b[78] + a[52] * b[89] + a[53] * b[100] + a[54] * b[111];
+    c[46] = a[44] * b[2] + a[45] * b[13] + a[46] * b[24] + a[47] * b[35] + a[48] * b[46] + a[49] * b[57]
+          + a[50] * b[68] + a[51] * b[79] + a[52] * b[90] + a[53] * b[101] + a[54] * b[112];
+    c[47] = a[44] * b[3] + a[45] * b[14] + a[46] * b[25] + a[47] * b[36] + a[48] * b[47] + a[49] * b[58]
+          + a[50] * b[69] + a[51] * b[80] + a[52] * b[91] + a[53] * b[102] + a[54] * b[113];
+    c[48] = a[44] * b[4] + a[45] * b[15] + a[46] * b[26] + a[47] * b[37] + a[48] * b[48] + a[49] * b[59]
+          + a[50] * b[70] + a[51] * b[81] + a[52] * b[92] + a[53] * b[103] + a[54] * b[114];
+    c[49] = a[44] * b[5] + a[45] * b[16] + a[46] * b[27] + a[47] * b[38] + a[48] * b[49] + a[49] * b[60]
+          + a[50] * b[71] + a[51] * b[82] + a[52] * b[93] + a[53] * b[104] + a[54] * b[115];
+    c[50] = a[44] * b[6] + a[45] * b[17] + a[46] * b[28] + a[47] * b[39] + a[48] * b[50] + a[49] * b[61]
+          + a[50] * b[72] + a[51] * b[83] + a[52] * b[94] + a[53] * b[105] + a[54] * b[116];
+    c[51] = a[44] * b[7] + a[45] * b[18] + a[46] * b[29] + a[47] * b[40] + a[48] * b[51] + a[49] * b[62]
+          + a[50] * b[73] + a[51] * b[84] + a[52] * b[95] + a[53] * b[106] + a[54] * b[117];
+    c[52] = a[44] * b[8] + a[45] * b[19] + a[46] * b[30] + a[47] * b[41] + a[48] * b[52] + a[49] * b[63]
+          + a[50] * b[74] + a[51] * b[85] + a[52] * b[96] + a[53] * b[107] + a[54] * b[118];
+    c[53] = a[44] * b[9] + a[45] * b[20] + a[46] * b[31] + a[47] * b[42] + a[48] * b[53] + a[49] * b[64]
+          + a[50] * b[75] + a[51] * b[86] + a[52] * b[97] + a[53] * b[108] + a[54] * b[119];
+    c[54] = a[44] * b[10] + a[45] * b[21] + a[46] * b[32] + a[47] * b[43] + a[48] * b[54] + a[49] * b[65]
+          + a[50] * b[76] + a[51] * b[87] + a[52] * b[98] + a[53] * b[109] + a[54] * b[120];
+    c[55] = a[55] * b[0] + a[56] * b[11] + a[57] * b[22] + a[58] * b[33] + a[59] * b[44] + a[60] * b[55]
+          + a[61] * b[66] + a[62] * b[77] + a[63] * b[88] + a[64] * b[99] + a[65] * b[110];
+    c[56] = a[55] * b[1] + a[56] * b[12] + a[57] * b[23] + a[58] * b[34] + a[59] * b[45] + a[60] * b[56]
+          + a[61] * b[67] + a[62] * b[78] + a[63] * b[89] + a[64] * b[100] + a[65] * b[111];
+    c[57] = a[55] * b[2] + a[56] * b[13] + a[57] * b[24] + a[58] * b[35] + a[59] * b[46] + a[60] * b[57]
+          + a[61] * b[68] + a[62] * b[79] + a[63] * b[90] + a[64] * b[101] + a[65] * b[112];
+    c[58] = a[55] * b[3] + a[56] * b[14] + a[57] * b[25] + a[58] * b[36] + a[59] * b[47] + a[60] * b[58]
+          + a[61] * b[69] + a[62] * b[80] + a[63] * b[91] + a[64] * b[102] + a[65] * b[113];
+    c[59] = a[55] * b[4] + a[56] * b[15] + a[57] * b[26] + a[58] * b[37] + a[59] * b[48] + a[60] * b[59]
+          + a[61] * b[70] + a[62] * b[81] + a[63] * b[92] + a[64] * b[103] + a[65] * b[114];
+    c[60] = a[55] * b[5] + a[56] * b[16] + a[57] * b[27] + a[58] * b[38] + a[59] * b[49] + a[60] * b[60]
+          + a[61] * b[71] + a[62] * b[82] + a[63] * b[93] + a[64] * b[104] + a[65] * b[115];
+    c[61] = a[55] * b[6] + a[56] * b[17] + a[57] * b[28] + a[58] * b[39] + a[59] * b[50] + a[60] * b[61]
+          + a[61] * b[72] + a[62] * b[83] + a[63] * b[94] + a[64] * b[105] + a[65] * b[116];
+    c[62] = a[55] * b[7] + a[56] * b[18] + a[57] * b[29] + a[58] * b[40] + a[59] * b[51] + a[60] * b[62]
+          + a[61] * b[73] + a[62] * b[84] + a[63] * b[95] + a[64] * b[106] + a[65] * b[117];
+    c[63] = a[55] * b[8] + a[56] * b[19] + a[57] * b[30] + a[58] * b[41] + a[59] * b[52] + a[60] * b[63]
+          + a[61] * b[74] + a[62] * b[85] + a[63] * b[96] + a[64] * b[107] + a[65] * b[118];
+    c[64] = a[55] * b[9] + a[56] * b[20] + a[57] * b[31] + a[58] * b[42] + a[59] * b[53] + a[60] * b[64]
+          + a[61] * b[75] + a[62] * b[86] + a[63] * b[97] + a[64] * b[108] + a[65] * b[119];
+    c[65] = a[55] * b[10] + a[56] * b[21] + a[57] * b[32] + a[58] * b[43] + a[59] * b[54] + a[60] * b[65]
+          + a[61] * b[76] + a[62] * b[87] + a[63] * b[98] + a[64] * b[109] + a[65] * b[120];
+    c[66] = a[66] * b[0] + a[67] * b[11] + a[68] * b[22] + a[69] * b[33] + a[70] * b[44] + a[71] * b[55]
+          + a[72] * b[66] + a[73] * b[77] + a[74] * b[88] + a[75] * b[99] + a[76] * b[110];
+    c[67] = a[66] * b[1] + a[67] * b[12] + a[68] * b[23] + a[69] * b[34] + a[70] * b[45] + a[71] * b[56]
+          + a[72] * b[67] + a[73] * b[78] + a[74] * b[89] + a[75] * b[100] + a[76] * b[111];
+    c[68] = a[66] * b[2] + a[67] * b[13] + a[68] * b[24] + a[69] * b[35] + a[70] * b[46] + a[71] * b[57]
+          + a[72] * b[68] + a[73] * b[79] + a[74] * b[90] + a[75] * b[101] + a[76] * b[112];
+    c[69] = a[66] * b[3] + a[67] * b[14] + a[68] * b[25] + a[69] * b[36] + a[70] * b[47] + a[71] * b[58]
+          + a[72] * b[69] + a[73] * b[80] + a[74] * b[91] + a[75] * b[102] + a[76] * b[113];
+    c[70] = a[66] * b[4] + a[67] * b[15] + a[68] * b[26] + a[69] * b[37] + a[70] * b[48] + a[71] * b[59]
+          + a[72] * b[70] + a[73] * b[81] + a[74] * b[92] + a[75] * b[103] + a[76] * b[114];
+    c[71] = a[66] * b[5] + a[67] * b[16] + a[68] * b[27] + a[69] * b[38] + a[70] * b[49] + a[71] * b[60]
+          + a[72] * b[71] + a[73] * b[82] + a[74] * b[93] + a[75] * b[104] + a[76] * b[115];
+    c[72] = a[66] * b[6] + a[67] * b[17] + a[68] * b[28] + a[69] * b[39] + a[70] * b[50] + a[71] * b[61]
+          + a[72] * b[72] + a[73] * b[83] + a[74] * b[94] + a[75] * b[105] + a[76] * b[116];
+    c[73] = a[66] * b[7] + a[67] * b[18] + a[68] * b[29] + a[69] * b[40] + a[70] * b[51] + a[71] * b[62]
+          + a[72] * b[73] + a[73] * b[84] + a[74] * b[95] + a[75] * b[106] + a[76] * b[117];
+    c[74] = a[66] * b[8] + a[67] * b[19] + a[68] * b[30] + a[69] * b[41] + a[70] * b[52] + a[71] * b[63]
+          + a[72] * b[74] + a[73] * b[85] + a[74] * b[96] + a[75] * b[107] + a[76] * b[118];
+    c[75] = a[66] * b[9] + a[67] * b[20] + a[68] * b[31] + a[69] * b[42] + a[70] * b[53] + a[71] * b[64]
+          + a[72] * b[75] + a[73] * b[86] + a[74] * b[97] + a[75] * b[108] + a[76] * b[119];
+    c[76] = a[66] * b[10] + a[67] * b[21] + a[68] * b[32] + a[69] * b[43] + a[70] * b[54] + a[71] * b[65]
+          + a[72] * b[76] + a[73] * b[87] + a[74] * b[98] + a[75] * b[109] + a[76] * b[120];
+    c[77] = a[77] * b[0] + a[78] * b[11] + a[79] * b[22] + a[80] * b[33] + a[81] * b[44] + a[82] * b[55]
+          + a[83] * b[66] + a[84] * b[77] + a[85] * b[88] + a[86] * b[99] + a[87] * b[110];
+    c[78] = a[77] * b[1] + a[78] * b[12] + a[79] * b[23] + a[80] * b[34] + a[81] * b[45] + a[82] * b[56]
+          + a[83] * b[67] + a[84] * b[78] + a[85] * b[89] + a[86] * b[100] + a[87] * b[111];
+    c[79] = a[77] * b[2] + a[78] * b[13] + a[79] * b[24] + a[80] * b[35] + a[81] * b[46] + a[82] * b[57]
+          + a[83] * b[68] + a[84] * b[79] + a[85] * b[90] + a[86] * b[101] + a[87] * b[112];
+    c[80] = a[77] * b[3] + a[78] * b[14] + a[79] * b[25] + a[80] * b[36] + a[81] * b[47] + a[82] * b[58]
+          + a[83] * b[69] + a[84] * b[80] + a[85] * b[91] + a[86] * b[102] + a[87] * b[113];
+    c[81] = a[77] * b[4] + a[78] * b[15] + a[79] * b[26] + a[80] * b[37] + a[81] * b[48] + a[82] * b[59]
+          + a[83] * b[70] + a[84] * b[81] + a[85] * b[92] + a[86] * b[103] + a[87] * b[114];
+    c[82] = a[77] * b[5] + a[78] * b[16] + a[79] * b[27] + a[80] * b[38] + a[81] * b[49] + a[82] * b[60]
+          + a[83] * b[71] + a[84] * b[82] + a[85] * b[93] + a[86] * b[104] + a[87] * b[115];
+    c[83] = a[77] * b[6] + a[78] * b[17] + a[79] * b[28] + a[80] * b[39] + a[81] * b[50] + a[82] * b[61]
+          + a[83] * b[72] + a[84] * b[83] + a[85] * b[94] + a[86] * b[105] + a[87] * b[116];
+    c[84] = a[77] * b[7] + a[78] * b[18] + a[79] * b[29] + a[80] * b[40] + a[81] * b[51] + a[82] * b[62]
+          + a[83] * b[73] + a[84] * b[84] + a[85] * b[95] + a[86] * b[106] + a[87] * b[117];
+    c[85] = a[77] * b[8] + a[78] * b[19] + a[79] * b[30] + a[80] * b[41] + a[81] * b[52] + a[82] * b[63]
+          + a[83] * b[74] + a[84] * b[85] + a[85] * b[96] + a[86] * b[107] + a[87] * b[118];
+    c[86] = a[77] * b[9] + a[78] * b[20] + a[79] * b[31] + a[80] * b[42] + a[81] * b[53] + a[82] * b[64]
+          + a[83] * b[75] + a[84] * b[86] + a[85] * b[97] + a[86] * b[108] + a[87] * b[119];
+    c[87] = a[77] * b[10] + a[78] * b[21] + a[79] * b[32] + a[80] * b[43] + a[81] * b[54] + a[82] * b[65]
+          + a[83] * b[76] + a[84] * b[87] + a[85] * b[98] + a[86] * b[109] + a[87] * b[120];
+    c[88] = a[88] * b[0] + a[89] * b[11] + a[90] * b[22] + a[91] * b[33] + a[92] * b[44] + a[93] * b[55]
+          + a[94] * b[66] + a[95] * b[77] + a[96] * b[88] + a[97] * b[99] + a[98] * b[110];
+    c[89] = a[88] * b[1] + a[89] * b[12] + a[90] * b[23] + a[91] * b[34] + a[92] * b[45] + a[93] * b[56]
+          + a[94] * b[67] + a[95] * b[78] + a[96] * b[89] + a[97] * b[100] + a[98] * b[111];
+    c[90] = a[88] * b[2] + a[89] * b[13] + a[90] * b[24] + a[91] * b[35] + a[92] * b[46] + a[93] * b[57]
+          + a[94] * b[68] + a[95] * b[79] + a[96] * b[90] + a[97] * b[101] + a[98] * b[112];
+    c[91] = a[88] * b[3] + a[89] * b[14] + a[90] * b[25] + a[91] * b[36] + a[92] * b[47] + a[93] * b[58]
+          + a[94] * b[69] + a[95] * b[80] + a[96] * b[91] + a[97] * b[102] + a[98] * b[113];
+    c[92] = a[88] * b[4] + a[89] * b[15] + a[90] * b[26] + a[91] * b[37] + a[92] * b[48] + a[93] * b[59]
+          + a[94] * b[70] + a[95] * b[81] + a[96] * b[92] + a[97] * b[103] + a[98] * b[114];
+    c[93] = a[88] * b[5] + a[89] * b[16] + a[90] * b[27] + a[91] * b[38] + a[92] * b[49] + a[93] * b[60]
+          + a[94] * b[71] + a[95] * b[82] + a[96] * b[93] + a[97] * b[104] + a[98] * b[115];
+    c[94] = a[88] * b[6] + a[89] * b[17] + a[90] * b[28] + a[91] * b[39] + a[92] * b[50] + a[93] * b[61]
+          + a[94] * b[72] + a[95] * b[83] + a[96] * b[94] + a[97] * b[105] + a[98] * b[116];
+    c[95] = a[88] * b[7] + a[89] * b[18] + a[90] * b[29] + a[91] * b[40] + a[92] * b[51] + a[93] * b[62]
+          + a[94] * b[73] + a[95] * b[84] + a[96] * b[95] + a[97] * b[106] + a[98] * b[117];
+    c[96] = a[88] * b[8] + a[89] * b[19] + a[90] * b[30] + a[91] * b[41] + a[92] * b[52] + a[93] * b[63]
+          + a[94] * b[74] + a[95] * b[85] + a[96] * b[96] + a[97] * b[107] + a[98] * b[118];
+    c[97] = a[88] * b[9] + a[89] * b[20] + a[90] * b[31] + a[91] * b[42] + a[92] * b[53] + a[93] * b[64]
+          + a[94] * b[75] + a[95] * b[86] + a[96] * b[97] + a[97] * b[108] + a[98] * b[119];
+    c[98] = a[88] * b[10] + a[89] * b[21] + a[90] * b[32] + a[91] * b[43] + a[92] * b[54] + a[93] * b[65]
+          + a[94] * b[76] + a[95] * b[87] + a[96] * b[98] + a[97] * b[109] + a[98] * b[120];
+    c[99] = a[99] * b[0] + a[100] * b[11] + a[101] * b[22] + a[102] * b[33] + a[103] * b[44] + a[104] * b[55]
+          + a[105] * b[66] + a[106] * b[77] + a[107] * b[88] + a[108] * b[99] + a[109] * b[110];
+    c[100] = a[99] * b[1] + a[100] * b[12] + a[101] * b[23] + a[102] * b[34] + a[103] * b[45] + a[104] * b[56]
+           + a[105] * b[67] + a[106] * b[78] + a[107] * b[89] + a[108] * b[100] + a[109] * b[111];
+    c[101] = a[99] * b[2] + a[100] * b[13] + a[101] * b[24] + a[102] * b[35] + a[103] * b[46] + a[104] * b[57]
+           + a[105] * b[68] + a[106] * b[79] + a[107] * b[90] + a[108] * b[101] + a[109] * b[112];
+    c[102] = a[99] * b[3] + a[100] * b[14] + a[101] * b[25] + a[102] * b[36] + a[103] * b[47] + a[104] * b[58]
+           + a[105] * b[69] + a[106] * b[80] + a[107] * b[91] + a[108] * b[102] + a[109] * b[113];
+    c[103] = a[99] * b[4] + a[100] * b[15] + a[101] * b[26] + a[102] * b[37] + a[103] * b[48] + a[104] * b[59]
+           + a[105] * b[70] + a[106] * b[81] + a[107] * b[92] + a[108] * b[103] + a[109] * b[114];
+    c[104] = a[99] * b[5] + a[100] * b[16] + a[101] * b[27] + a[102] * b[38] + a[103] * b[49] + a[104] * b[60]
+           + a[105] * b[71] + a[106] * b[82] + a[107] * b[93] + a[108] * b[104] + a[109] * b[115];
+    c[105] = a[99] * b[6] + a[100] * b[17] + a[101] * b[28] + a[102] * b[39] + a[103] * b[50] + a[104] * b[61]
+           + a[105] * b[72] + a[106] * b[83] + a[107] * b[94] + a[108] * b[105] + a[109] * b[116];
+    c[106] = a[99] * b[7] + a[100] * b[18] + a[101] * b[29] + a[102] * b[40] + a[103] * b[51] + a[104] * b[62]
+           + a[105] * b[73] + a[106] * b[84] + a[107] * b[95] + a[108] * b[106] + a[109] * b[117];
+    c[107] = a[99] * b[8] + a[100] * b[19] + a[101] * b[30] + a[102] * b[41] + a[103] * b[52] + a[104] * b[63]
+           + a[105] * b[74] + a[106] * b[85] + a[107] * b[96] + a[108] * b[107] + a[109] * b[118];
+    c[108] = a[99] * b[9] + a[100] * b[20] + a[101] * b[31] + a[102] * b[42] + a[103] * b[53] + a[104] * b[64]
+           + a[105] * b[75] + a[106] * b[86] + a[107] * b[97] + a[108] * b[108] + a[109] * b[119];
+    c[109] = a[99] * b[10] + a[100] * b[21] + a[101] * b[32] + a[102] * b[43] + a[103] * b[54]
+           + a[104] * b[65] + a[105] * b[76] + a[106] * b[87] + a[107] * b[98] + a[108] * b[109]
+           + a[109] * b[120];
+    c[110] = a[110] * b[0] + a[111] * b[11] + a[112] * b[22] + a[113] * b[33] + a[114] * b[44]
+           + a[115] * b[55] + a[116] * b[66] + a[117] * b[77] + a[118] * b[88] + a[119] * b[99]
+           + a[120] * b[110];
+    c[111] = a[110] * b[1] + a[111] * b[12] + a[112] * b[23] + a[113] * b[34] + a[114] * b[45]
+           + a[115] * b[56] + a[116] * b[67] + a[117] * b[78] + a[118] * b[89] + a[119] * b[100]
+           + a[120] * b[111];
+    c[112] = a[110] * b[2] + a[111] * b[13] + a[112] * b[24] + a[113] * b[35] + a[114] * b[46]
+           + a[115] * b[57] + a[116] * b[68] + a[117] * b[79] + a[118] * b[90] + a[119] * b[101]
+           + a[120] * b[112];
+    c[113] = a[110] * b[3] + a[111] * b[14] + a[112] * b[25] + a[113] * b[36] + a[114] * b[47]
+           + a[115] * b[58] + a[116] * b[69] + a[117] * b[80] + a[118] * b[91] + a[119] * b[102]
+           + a[120] * b[113];
+    c[114] = a[110] * b[4] + a[111] * b[15] + a[112] * b[26] + a[113] * b[37] + a[114] * b[48]
+           + a[115] * b[59] + a[116] * b[70] + a[117] * b[81] + a[118] * b[92] + a[119] * b[103]
+           + a[120] * b[114];
+    c[115] = a[110] * b[5] + a[111] * b[16] + a[112] * b[27] + a[113] * b[38] + a[114] * b[49]
+           + a[115] * b[60] + a[116] * b[71] + a[117] * b[82] + a[118] * b[93] + a[119] * b[104]
+           + a[120] * b[115];
+    c[116] = a[110] * b[6] + a[111] * b[17] + a[112] * b[28] + a[113] * b[39] + a[114] * b[50]
+           + a[115] * b[61] + a[116] * b[72] + a[117] * b[83] + a[118] * b[94] + a[119] * b[105]
+           + a[120] * b[116];
+    c[117] = a[110] * b[7] + a[111] * b[18] + a[112] * b[29] + a[113] * b[40] + a[114] * b[51]
+           + a[115] * b[62] + a[116] * b[73] + a[117] * b[84] + a[118] * b[95] + a[119] * b[106]
+           + a[120] * b[117];
+    c[118] = a[110] * b[8] + a[111] * b[19] + a[112] * b[30] + a[113] * b[41] + a[114] * b[52]
+           + a[115] * b[63] + a[116] * b[74] + a[117] * b[85] + a[118] * b[96] + a[119] * b[107]
+           + a[120] * b[118];
+    c[119] = a[110] * b[9] + a[111] * b[20] + a[112] * b[31] + a[113] * b[42] + a[114] * b[53]
+           + a[115] * b[64] + a[116] * b[75] + a[117] * b[86] + a[118] * b[97] + a[119] * b[108]
+           + a[120] * b[119];
+    c[120] = a[110] * b[10] + a[111] * b[21] + a[112] * b[32] + a[113] * b[43] + a[114] * b[54]
+           + a[115] * b[65] + a[116] * b[76] + a[117] * b[87] + a[118] * b[98] + a[119] * b[109]
+           + a[120] * b[120];
+}
+
+
+void Ifx_MatF32_mulVec11(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6]
+         + a[7] * x[7] + a[8] * x[8] + a[9] * x[9] + a[10] * x[10];
+    y[1] = a[11] * x[0] + a[12] * x[1] + a[13] * x[2] + a[14] * x[3] + a[15] * x[4] + a[16] * x[5]
+         + a[17] * x[6] + a[18] * x[7] + a[19] * x[8] + a[20] * x[9] + a[21] * x[10];
+    y[2] = a[22] * x[0] + a[23] * x[1] + a[24] * x[2] + a[25] * x[3] + a[26] * x[4] + a[27] * x[5]
+         + a[28] * x[6] + a[29] * x[7] + a[30] * x[8] + a[31] * x[9] + a[32] * x[10];
+    y[3] = a[33] * x[0] + a[34] * x[1] + a[35] * x[2] + a[36] * x[3] + a[37] * x[4] + a[38] * x[5]
+         + a[39] * x[6] + a[40] * x[7] + a[41] * x[8] + a[42] * x[9] + a[43] * x[10];
+    y[4] = a[44] * x[0] + a[45] * x[1] + a[46] * x[2] + a[47] * x[3] + a[48] * x[4] + a[49] * x[5]
+         + a[50] * x[6] + a[51] * x[7] + a[52] * x[8] + a[53] * x[9] + a[54] * x[10];
+    y[5] = a[55] * x[0] + a[56] * x[1] + a[57] * x[2] + a[58] * x[3] + a[59] * x[4] + a[60] * x[5]
+         + a[61] * x[6] + a[62] * x[7] + a[63] * x[8] + a[64] * x[9] + a[65] * x[10];
+    y[6] = a[66] * x[0] + a[67] * x[1] + a[68] * x[2] + a[69] * x[3] + a[70] * x[4] + a[71] * x[5]
+         + a[72] * x[6] + a[73] * x[7] + a[74] * x[8] + a[75] * x[9] + a[76] * x[10];
+    y[7] = a[77] * x[0] + a[78] * x[1] + a[79] * x[2] + a[80] * x[3] + a[81] * x[4] + a[82] * x[5]
+         + a[83] * x[6] + a[84] * x[7] + a[85] * x[8] + a[86] * x[9] + a[87] * x[10];
+    y[8] = a[88] * x[0] + a[89] * x[1] + a[90] * x[2] + a[91] * x[3] + a[92] * x[4] + a[93] * x[5]
+         + a[94] * x[6] + a[95] * x[7] + a[96] * x[8] + a[97] * x[9] + a[98] * x[10];
+    y[9] = a[99] * x[0] + a[100] * x[1] + a[101] * x[2] + a[102] * x[3] + a[103] * x[4] + a[104] * x[5]
+         + a[105] * x[6] + a[106] * x[7] + a[107] * x[8] + a[108] * x[9] + a[109] * x[10];
+    y[10] = a[110] * x[0] + a[111] * x[1] + a[112] * x[2] + a[113] * x[3] + a[114] * x[4] + a[115] * x[5]
+          + a[116] * x[6] + a[117] * x[7] + a[118] * x[8] + a[119] * x[9] + a[120] * x[10];
+}
+
+
+boolean Ifx_MatF32_cholesky11(float32 *l, const float32 *a)
+{
+    float32 inv[11];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[11] = a[11] * inv[0];
+    l[22] = a[22] * inv[0];
+    l[33] = a[33] * inv[0];
+    l[44] = a[44] * inv[0];
+    l[55] = a[55] * inv[0];
+    l[66] = a[66] * inv[0];
+    l[77] = a[77] * inv[0];
+    l[88] = a[88] * inv[0];
+    l[99] = a[99] * inv[0];
+    l[110] = a[110] * inv[0];
+    pivot = a[12] - (l[11] * l[11]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[12] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[12];
+    l[23] = (a[23] - (l[22] * l[11])) * inv[1];
+    l[34] = (a[34] - (l[33] * l[11])) * inv[1];
+    l[45] = (a[45] - (l[44] * l[11])) * inv[1];
+    l[56] = (a[56] - (l[55] * l[11])) * inv[1];
+    l[67] = (a[67] - (l[66] * l[11])) * inv[1];
+    l[78] = (a[78] - (l[77] * l[11])) * inv[1];
+    l[89] = (a[89] - (l[88] * l[11])) * inv[1];
+    l[100] = (a[100] - (l[99] * l[11])) * inv[1];
+    l[111] = (a[111] - (l[110] * l[11])) * inv[1];
+    pivot = a[24] - (l[22] * l[22] + l[23] * l[23]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[24] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[24];
+    l[35] = (a[35] - (l[33] * l[22] + l[34] * l[23])) * inv[2];
+    l[46] = (a[46] - (l[44] * l[22] + l[45] * l[23])) * inv[2];
+    l[57] = (a[57] - (l[55] * l[22] + l[56] * l[23])) * inv[2];
+    l[68] = (a[68] - (l[66] * l[22] + l[67] * l[23])) * inv[2];
+    l[79] = (a[79] - (l[77] * l[22] + l[78] * l[23])) * inv[2];
+    l[90] = (a[90] - (l[88] * l[22] + l[89] * l[23])) * inv[2];
+    l[101] = (a[101] - (l[99] * l[22] + l[100] * l[23])) * inv[2];
+    l[112] = (a[112] - (l[110] * l[22] + l[111] * l[23])) * inv[2];
+    pivot = a[36] - (l[33] * l[33] + l[34] * l[34] + l[35] * l[35]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[36] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[36];
+    l[47] = (a[47] - (l[44] * l[33] + l[45] * l[34] + l[46] * l[35])) * inv[3];
+    l[58] = (a[58] - (l[55] * l[33] + l[56] * l[34] + l[57] * l[35])) * inv[3];
+    l[69] = (a[69] - (l[66] * l[33] + l[67] * l[34] + l[68] * l[35])) * inv[3];
+    l[80] = (a[80] - (l[77] * l[33] + l[78] * l[34] + l[79] * l[35])) * inv[3];
+    l[91] = (a[91] - (l[88] * l[33] + l[89] * l[34] + l[90] * l[35])) * inv[3];
+    l[102] = (a[102] - (l[99] * l[33] + l[100] * l[34] + l[101] * l[35])) * inv[3];
+    l[113] = (a[113] - (l[110] * l[33] + l[111] * l[34] + l[112] * l[35])) * inv[3];
+    pivot = a[48] - (l[44] * l[44] + l[45] * l[45] + l[46] * l[46] + l[47] * l[47]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[48] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[48];
+    l[59] = (a[59] - (l[55] * l[44] + l[56] * l[45] + l[57] * l[46] + l[58] * l[47])) * inv[4];
+    l[70] = (a[70] - (l[66] * l[44] + l[67] * l[45] + l[68] * l[46] + l[69] * l[47])) * inv[4];
+    l[81] = (a[81] - (l[77] * l[44] + l[78] * l[45] + l[79] * l[46] + l[80] * l[47])) * inv[4];
+    l[92] = (a[92] - (l[88] * l[44] + l[89] * l[45] + l[90] * l[46] + l[91] * l[47])) * inv[4];
+    l[103] = (a[103] - (l[99] * l[44] + l[100] * l[45] + l[101] * l[46] + l[102] * l[47])) * inv[4];
+    l[114] = (a[114] - (l[110] * l[44] + l[111] * l[45] + l[112] * l[46] + l[113] * l[47])) * inv[4];
+    pivot = a[60] - (l[55] * l[55] + l[56] * l[56] + l[57] * l[57] + l[58] * l[58] + l[59] * l[59]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[60] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[60];
+    l[71] = (a[71] - (l[66] * l[55] + l[67] * l[56] + l[68] * l[57] + l[69] * l[58] + l[70] * l[59])) * inv[5];
+    l[82] = (a[82] - (l[77] * l[55] + l[78] * l[56] + l[79] * l[57] + l[80] * l[58] + l[81] * l[59])) * inv[5];
+    l[93] = (a[93] - (l[88] * l[55] + l[89] * l[56] + l[90] * l[57] + l[91] * l[58] + l[92] * l[59])) * inv[5];
+    l[104] = (a[104] - (l[99] * l[55] + l[100] * l[56] + l[101] * l[57] + l[102] * l[58] + l[103] * l[59])) * inv[5];
+    l[115] = (a[115] - (l[110] * l[55] + l[111] * l[56] + l[112] * l[57] + l[113] * l[58] + l[114] * l[59])) * inv[5];
+    pivot = a[72] - (l[66] * l[66] + l[67] * l[67] + l[68] * l[68] + l[69] * l[69] + l[70] * l[70]
+                   + l[71] * l[71]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[72] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[72];
+    l[83] = (a[83] - (l[77] * l[66] + l[78] * l[67] + l[79] * l[68] + l[80] * l[69] + l[81] * l[70]
+                    + l[82] * l[71])) * inv[6];
+    l[94] = (a[94] - (l[88] * l[66] + l[89] * l[67] + l[90] * l[68] + l[91] * l[69] + l[92] * l[70]
+                    + l[93] * l[71])) * inv[6];
+    l[105] = (a[105] - (l[99] * l[66] + l[100] * l[67] + l[101] * l[68] + l[102] * l[69] + l[103] * l[70]
+                      + l[104] * l[71])) * inv[6];
+    l[116] = (a[116] - (l[110] * l[66] + l[111] * l[67] + l[112] * l[68] + l[113] * l[69] + l[114] * l[70]
+                      + l[115] * l[71])) * inv[6];
+    pivot = a[84] - (l[77] * l[77] + l[78] * l[78] + l[79] * l[79] + l[80] * l[80] + l[81] * l[81]
+                   + l[82] * l[82] + l[83] * l[83]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[84] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[7] = 1.0f / l[84];
+    l[95] = (a[95] - (l[88] * l[77] + l[89] * l[78] + l[90] * l[79] + l[91] * l[80] + l[92] * l[81]
+                    + l[93] * l[82] + l[94] * l[83])) * inv[7];
+    l[106] = (a[106] - (l[99] * l[77] + l[100] * l[78] + l[101] * l[79] + l[102] * l[80] + l[103] * l[81]
+                      + l[104] * l[82] + l[105] * l[83])) * inv[7];
+    l[117] = (a[117] - (l[110] * l[77] + l[111] * l[78] + l[112] * l[79] + l[113] * l[80] + l[114] * l[81]
+                      + l[115] * l[82] + l[116] * l[83])) * inv[7];
+    pivot = a[96] - (l[88] * l[88] + l[89] * l[89] + l[90] * l[90] + l[91] * l[91] + l[92] * l[92]
+                   + l[93] * l[93] + l[94] * l[94] + l[95] * l[95]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[96] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[8] = 1.0f / l[96];
+    l[107] = (a[107] - (l[99] * l[88] + l[100] * l[89] + l[101] * l[90] + l[102] * l[91] + l[103] * l[92]
+                      + l[104] * l[93] + l[105] * l[94] + l[106] * l[95])) * inv[8];
+    l[118] = (a[118] - (l[110] * l[88] + l[111] * l[89] + l[112] * l[90] + l[113] * l[91] + l[114] * l[92]
+                      + l[115] * l[93] + l[116] * l[94] + l[117] * l[95])) * inv[8];
+    pivot = a[108] - (l[99] * l[99] + l[100] * l[100] + l[101] * l[101] + l[102] * l[102] + l[103] * l[103]
+                    + l[104] * l[104] + l[105] * l[105] + l[106] * l[106] + l[107] * l[107]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[108] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[9] = 1.0f / l[108];
+    l[119] = (a[119] - (l[110] * l[99] + l[111] * l[100] + l[112] * l[101] + l[113] * l[102] + l[114] * l[103]
+                      + l[115] * l[104] + l[116] * l[105] + l[117] * l[106] + l[118] * l[107])) * inv[9];
+    pivot = a[120] - (l[110] * l[110] + l[111] * l[111] + l[112] * l[112] + l[113] * l[113] + l[114] * l[114]
+                    + l[115] * l[115] + l[116] * l[116] + l[117] * l[117] + l[118] * l[118] + l[119] * l[119]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[120] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[10] = 1.0f / l[120];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[40] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[49] = 0.0f;
+    l[50] = 0.0f;
+    l[51] = 0.0f;
+    l[52] = 0.0f;
+    l[53] = 0.0f;
+    l[54] = 0.0f;
+    l[61] = 0.0f;
+    l[62] = 0.0f;
+    l[63] = 0.0f;
+    l[64] = 0.0f;
+    l[65] = 0.0f;
+    l[73] = 0.0f;
+    l[74] = 0.0f;
+    l[75] = 0.0f;
+    l[76] = 0.0f;
+    l[85] = 0.0f;
+    l[86] = 0.0f;
+    l[87] = 0.0f;
+    l[97] = 0.0f;
+    l[98] = 0.0f;
+    l[109] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve11(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[11] * x[0])) / l[12];
+    x[2] = (b[2] - (l[22] * x[0] + l[23] * x[1])) / l[24];
+    x[3] = (b[3] - (l[33] * x[0] + l[34] * x[1] + l[35] * x[2])) / l[36];
+    x[4] = (b[4] - (l[44] * x[0] + l[45] * x[1] + l[46] * x[2] + l[47] * x[3])) / l[48];
+    x[5] = (b[5] - (l[55] * x[0] + l[56] * x[1] + l[57] * x[2] + l[58] * x[3] + l[59] * x[4])) / l[60];
+    x[6] = (b[6] - (l[66] * x[0] + l[67] * x[1] + l[68] * x[2] + l[69] * x[3] + l[70] * x[4] + l[71] * x[5])) / l[72];
+    x[7] = (b[7] - (l[77] * x[0] + l[78] * x[1] + l[79] * x[2] + l[80] * x[3] + l[81] * x[4] + l[82] * x[5]
+                  + l[83] * x[6])) / l[84];
+    x[8] = (b[8] - (l[88] * x[0] + l[89] * x[1] + l[90] * x[2] + l[91] * x[3] + l[92] * x[4] + l[93] * x[5]
+                  + l[94] * x[6] + l[95] * x[7])) / l[96];
+    x[9] = (b[9] - (l[99] * x[0] + l[100] * x[1] + l[101] * x[2] + l[102] * x[3] + l[103] * x[4]
+                  + l[104] * x[5] + l[105] * x[6] + l[106] * x[7] + l[107] * x[8])) / l[108];
+    x[10] = (b[10] - (l[110] * x[0] + l[111] * x[1] + l[112] * x[2] + l[113] * x[3] + l[114] * x[4]
+                    + l[115] * x[5] + l[116] * x[6] + l[117] * x[7] + l[118] * x[8] + l[119] * x[9])) / l[120];
+    x[10] = x[10] / l[120];
+    x[9] = (x[9] - (l[119] * x[10])) / l[108];
+    x[8] = (x[8] - (l[107] * x[9] + l[118] * x[10])) / l[96];
+    x[7] = (x[7] - (l[95] * x[8] + l[106] * x[9] + l[117] * x[10])) / l[84];
+    x[6] = (x[6] - (l[83] * x[7] + l[94] * x[8] + l[105] * x[9] + l[116] * x[10])) / l[72];
+    x[5] = (x[5] - (l[71] * x[6] + l[82] * x[7] + l[93] * x[8] + l[104] * x[9] + l[115] * x[10])) / l[60];
+    x[4] = (x[4] - (l[59] * x[5] + l[70] * x[6] + l[81] * x[7] + l[92] * x[8] + l[103] * x[9] + l[114] * x[10])) / l[48];
+    x[3] = (x[3] - (l[47] * x[4] + l[58] * x[5] + l[69] * x[6] + l[80] * x[7] + l[91] * x[8] + l[102] * x[9]
+                  + l[113] * x[10])) / l[36];
+    x[2] = (x[2] - (l[35] * x[3] + l[46] * x[4] + l[57] * x[5] + l[68] * x[6] + l[79] * x[7] + l[90] * x[8]
+                  + l[101] * x[9] + l[112] * x[10])) / l[24];
+    x[1] = (x[1] - (l[23] * x[2] + l[34] * x[3] + l[45] * x[4] + l[56] * x[5] + l[67] * x[6] + l[78] * x[7]
+                  + l[89] * x[8] + l[100] * x[9] + l[111] * x[10])) / l[12];
+    x[0] = (x[0] - (l[11] * x[1] + l[22] * x[2] + l[33] * x[3] + l[44] * x[4] + l[55] * x[5] + l[66] * x[6]
+                  + l[77] * x[7] + l[88] * x[8] + l[99] * x[9] + l[110] * x[10])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl11(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[11];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[11] = a[11] * inv;
+    l[22] = a[22] * inv;
+    l[33] = a[33] * inv;
+    l[44] = a[44] * inv;
+    l[55] = a[55] * inv;
+    l[66] = a[66] * inv;
+    l[77] = a[77] * inv;
+    l[88] = a[88] * inv;
+    l[99] = a[99] * inv;
+    l[110] = a[110] * inv;
+    l[0] = 1.0f;
+    v[0] = l[11] * d[0];
+    d[1] = a[12] - (l[11] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[23] = (a[23] - (l[22] * v[0])) * inv;
+    l[34] = (a[34] - (l[33] * v[0])) * inv;
+    l[45] = (a[45] - (l[44] * v[0])) * inv;
+    l[56] = (a[56] - (l[55] * v[0])) * inv;
+    l[67] = (a[67] - (l[66] * v[0])) * inv;
+    l[78] = (a[78] - (l[77] * v[0])) * inv;
+    l[89] = (a[89] - (l[88] * v[0])) * inv;
+    l[100] = (a[100] - (l[99] * v[0])) * inv;
+    l[111] = (a[111] - (l[110] * v[0])) * inv;
+    l[12] = 1.0f;
+    v[0] = l[22] * d[0];
+    v[1] = l[23] * d[1];
+    d[2] = a[24] - (l[22] * v[0] + l[23] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[35] = (a[35] - (l[33] * v[0] + l[34] * v[1])) * inv;
+    l[46] = (a[46] - (l[44] * v[0] + l[45] * v[1])) * inv;
+    l[57] = (a[57] - (l[55] * v[0] + l[56] * v[1])) * inv;
+    l[68] = (a[68] - (l[66] * v[0] + l[67] * v[1])) * inv;
+    l[79] = (a[79] - (l[77] * v[0] + l[78] * v[1])) * inv;
+    l[90] = (a[90] - (l[88] * v[0] + l[89] * v[1])) * inv;
+    l[101] = (a[101] - (l[99] * v[0] + l[100] * v[1])) * inv;
+    l[112] = (a[112] - (l[110] * v[0] + l[111] * v[1])) * inv;
+    l[24] = 1.0f;
+    v[0] = l[33] * d[0];
+    v[1] = l[34] * d[1];
+    v[2] = l[35] * d[2];
+    d[3] = a[36] - (l[33] * v[0] + l[34] * v[1] + l[35] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[47] = (a[47] - (l[44] * v[0] + l[45] * v[1] + l[46] * v[2])) * inv;
+    l[58] = (a[58] - (l[55] * v[0] + l[56] * v[1] + l[57] * v[2])) * inv;
+    l[69] = (a[69] - (l[66] * v[0] + l[67] * v[1] + l[68] * v[2])) * inv;
+    l[80] = (a[80] - (l[77] * v[0] + l[78] * v[1] + l[79] * v[2])) * inv;
+    l[91] = (a[91] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2])) * inv;
+    l[102] = (a[102] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2])) * inv;
+    l[113] = (a[113] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2])) * inv;
+    l[36] = 1.0f;
+    v[0] = l[44] * d[0];
+    v[1] = l[45] * d[1];
+    v[2] = l[46] * d[2];
+    v[3] = l[47] * d[3];
+    d[4] = a[48] - (l[44] * v[0] + l[45] * v[1] + l[46] * v[2] + l[47] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[59] = (a[59] - (l[55] * v[0] + l[56] * v[1] + l[57] * v[2] + l[58] * v[3])) * inv;
+    l[70] = (a[70] - (l[66] * v[0] + l[67] * v[1] + l[68] * v[2] + l[69] * v[3])) * inv;
+    l[81] = (a[81] - (l[77] * v[0] + l[78] * v[1] + l[79] * v[2] + l[80] * v[3])) * inv;
+    l[92] = (a[92] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2] + l[91] * v[3])) * inv;
+    l[103] = (a[103] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3])) * inv;
+    l[114] = (a[114] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3])) * inv;
+    l[48] = 1.0f;
+    v[0] = l[55] * d[0];
+    v[1] = l[56] * d[1];
+    v[2] = l[57] * d[2];
+    v[3] = l[58] * d[3];
+    v[4] = l[59] * d[4];
+    d[5] = a[60] - (l[55] * v[0] + l[56] * v[1] + l[57] * v[2] + l[58] * v[3] + l[59] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[71] = (a[71] - (l[66] * v[0] + l[67] * v[1] + l[68] * v[2] + l[69] * v[3] + l[70] * v[4])) * inv;
+    l[82] = (a[82] - (l[77] * v[0] + l[78] * v[1] + l[79] * v[2] + l[80] * v[3] + l[81] * v[4])) * inv;
+    l[93] = (a[93] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2] + l[91] * v[3] + l[92] * v[4])) * inv;
+    l[104] = (a[104] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3] + l[103] * v[4])) * inv;
+    l[115] = (a[115] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4])) * inv;
+    l[60] = 1.0f;
+    v[0] = l[66] * d[0];
+    v[1] = l[67] * d[1];
+    v[2] = l[68] * d[2];
+    v[3] = l[69] * d[3];
+    v[4] = l[70] * d[4];
+    v[5] = l[71] * d[5];
+    d[6] = a[72] - (l[66] * v[0] + l[67] * v[1] + l[68] * v[2] + l[69] * v[3] + l[70] * v[4] + l[71] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[83] = (a[83] - (l[77] * v[0] + l[78] * v[1] + l[79] * v[2] + l[80] * v[3] + l[81] * v[4] + l[82] * v[5])) * inv;
+    l[94] = (a[94] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2] + l[91] * v[3] + l[92] * v[4] + l[93] * v[5])) * inv;
+    l[105] = (a[105] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3] + l[103] * v[4]
+                      + l[104] * v[5])) * inv;
+    l[116] = (a[116] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4]
+                      + l[115] * v[5])) * inv;
+    l[72] = 1.0f;
+    v[0] = l[77] * d[0];
+    v[1] = l[78] * d[1];
+    v[2] = l[79] * d[2];
+    v[3] = l[80] * d[3];
+    v[4] = l[81] * d[4];
+    v[5] = l[82] * d[5];
+    v[6] = l[83] * d[6];
+    d[7] = a[84] - (l[77] * v[0] + l[78] * v[1] + l[79] * v[2] + l[80] * v[3] + l[81] * v[4] + l[82] * v[5]
+                  + l[83] * v[6]);
+    ok  &= (boolean)(d[7] != 0.0f);
+    inv  = 1.0f / ((d[7] != 0.0f) ? d[7] : 1.0f);
+    l[95] = (a[95] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2] + l[91] * v[3] + l[92] * v[4] + l[93] * v[5]
+                    + l[94] * v[6])) * inv;
+    l[106] = (a[106] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3] + l[103] * v[4]
+                      + l[104] * v[5] + l[105] * v[6])) * inv;
+    l[117] = (a[117] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4]
+                      + l[115] * v[5] + l[116] * v[6])) * inv;
+    l[84] = 1.0f;
+    v[0] = l[88] * d[0];
+    v[1] = l[89] * d[1];
+    v[2] = l[90] * d[2];
+    v[3] = l[91] * d[3];
+    v[4] = l[92] * d[4];
+    v[5] = l[93] * d[5];
+    v[6] = l[94] * d[6];
+    v[7] = l[95] * d[7];
+    d[8] = a[96] - (l[88] * v[0] + l[89] * v[1] + l[90] * v[2] + l[91] * v[3] + l[92] * v[4] + l[93] * v[5]
+                  + l[94] * v[6] + l[95] * v[7]);
+    ok  &= (boolean)(d[8] != 0.0f);
+    inv  = 1.0f / ((d[8] != 0.0f) ? d[8] : 1.0f);
+    l[107] = (a[107] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3] + l[103] * v[4]
+                      + l[104] * v[5] + l[105] * v[6] + l[106] * v[7])) * inv;
+    l[118] = (a[118] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4]
+                      + l[115] * v[5] + l[116] * v[6] + l[117] * v[7])) * inv;
+    l[96] = 1.0f;
+    v[0] = l[99] * d[0];
+    v[1] = l[100] * d[1];
+    v[2] = l[101] * d[2];
+    v[3] = l[102] * d[3];
+    v[4] = l[103] * d[4];
+    v[5] = l[104] * d[5];
+    v[6] = l[105] * d[6];
+    v[7] = l[106] * d[7];
+    v[8] = l[107] * d[8];
+    d[9] = a[108] - (l[99] * v[0] + l[100] * v[1] + l[101] * v[2] + l[102] * v[3] + l[103] * v[4]
+                   + l[104] * v[5] + l[105] * v[6] + l[106] * v[7] + l[107] * v[8]);
+    ok  &= (boolean)(d[9] != 0.0f);
+    inv  = 1.0f / ((d[9] != 0.0f) ? d[9] : 1.0f);
+    l[119] = (a[119] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4]
+                      + l[115] * v[5] + l[116] * v[6] + l[117] * v[7] + l[118] * v[8])) * inv;
+    l[108] = 1.0f;
+    v[0] = l[110] * d[0];
+    v[1] = l[111] * d[1];
+    v[2] = l[112] * d[2];
+    v[3] = l[113] * d[3];
+    v[4] = l[114] * d[4];
+    v[5] = l[115] * d[5];
+    v[6] = l[116] * d[6];
+    v[7] = l[117] * d[7];
+    v[8] = l[118] * d[8];
+    v[9] = l[119] * d[9];
+    d[10] = a[120] - (l[110] * v[0] + l[111] * v[1] + l[112] * v[2] + l[113] * v[3] + l[114] * v[4]
+                    + l[115] * v[5] + l[116] * v[6] + l[117] * v[7] + l[118] * v[8] + l[119] * v[9]);
+    ok  &= (boolean)(d[10] != 0.0f);
+    inv  = 1.0f / ((d[10] != 0.0f) ? d[10] : 1.0f);
+    l[120] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[13] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[25] = 0.0f;
+    l[26] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[37] = 0.0f;
+    l[38] = 0.0f;
+    l[39] = 0.0f;
+    l[40] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[49] = 0.0f;
+    l[50] = 0.0f;
+    l[51] = 0.0f;
+    l[52] = 0.0f;
+    l[53] = 0.0f;
+    l[54] = 0.0f;
+    l[61] = 0.0f;
+    l[62] = 0.0f;
+    l[63] = 0.0f;
+    l[64] = 0.0f;
+    l[65] = 0.0f;
+    l[73] = 0.0f;
+    l[74] = 0.0f;
+    l[75] = 0.0f;
+    l[76] = 0.0f;
+    l[85] = 0.0f;
+    l[86] = 0.0f;
+    l[87] = 0.0f;
+    l[97] = 0.0f;
+    l[98] = 0.0f;
+    l[109] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve11(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[11] * x[0]);
+    x[2] = b[2] - (l[22] * x[0] + l[23] * x[1]);
+    x[3] = b[3] - (l[33] * x[0] + l[34] * x[1] + l[35] * x[2]);
+    x[4] = b[4] - (l[44] * x[0] + l[45] * x[1] + l[46] * x[2] + l[47] * x[3]);
+    x[5] = b[5] - (l[55] * x[0] + l[56] * x[1] + l[57] * x[2] + l[58] * x[3] + l[59] * x[4]);
+    x[6] = b[6] - (l[66] * x[0] + l[67] * x[1] + l[68] * x[2] + l[69] * x[3] + l[70] * x[4] + l[71] * x[5]);
+    x[7] = b[7] - (l[77] * x[0] + l[78] * x[1] + l[79] * x[2] + l[80] * x[3] + l[81] * x[4] + l[82] * x[5]
+                 + l[83] * x[6]);
+    x[8] = b[8] - (l[88] * x[0] + l[89] * x[1] + l[90] * x[2] + l[91] * x[3] + l[92] * x[4] + l[93] * x[5]
+                 + l[94] * x[6] + l[95] * x[7]);
+    x[9] = b[9] - (l[99] * x[0] + l[100] * x[1] + l[101] * x[2] + l[102] * x[3] + l[103] * x[4]
+                 + l[104] * x[5] + l[105] * x[6] + l[106] * x[7] + l[107] * x[8]);
+    x[10] = b[10] - (l[110] * x[0] + l[111] * x[1] + l[112] * x[2] + l[113] * x[3] + l[114] * x[4]
+                   + l[115] * x[5] + l[116] * x[6] + l[117] * x[7] + l[118] * x[8] + l[119] * x[9]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[7] = x[7] / d[7];
+    x[8] = x[8] / d[8];
+    x[9] = x[9] / d[9];
+    x[10] = x[10] / d[10];
+    x[9] = x[9] - (l[119] * x[10]);
+    x[8] = x[8] - (l[107] * x[9] + l[118] * x[10]);
+    x[7] = x[7] - (l[95] * x[8] + l[106] * x[9] + l[117] * x[10]);
+    x[6] = x[6] - (l[83] * x[7] + l[94] * x[8] + l[105] * x[9] + l[116] * x[10]);
+    x[5] = x[5] - (l[71] * x[6] + l[82] * x[7] + l[93] * x[8] + l[104] * x[9] + l[115] * x[10]);
+    x[4] = x[4] - (l[59] * x[5] + l[70] * x[6] + l[81] * x[7] + l[92] * x[8] + l[103] * x[9] + l[114] * x[10]);
+    x[3] = x[3] - (l[47] * x[4] + l[58] * x[5] + l[69] * x[6] + l[80] * x[7] + l[91] * x[8] + l[102] * x[9]
+                 + l[113] * x[10]);
+    x[2] = x[2] - (l[35] * x[3] + l[46] * x[4] + l[57] * x[5] + l[68] * x[6] + l[79] * x[7] + l[90] * x[8]
+                 + l[101] * x[9] + l[112] * x[10]);
+    x[1] = x[1] - (l[23] * x[2] + l[34] * x[3] + l[45] * x[4] + l[56] * x[5] + l[67] * x[6] + l[78] * x[7]
+                 + l[89] * x[8] + l[100] * x[9] + l[111] * x[10]);
+    x[0] = x[0] - (l[11] * x[1] + l[22] * x[2] + l[33] * x[3] + l[44] * x[4] + l[55] * x[5] + l[66] * x[6]
+                 + l[77] * x[7] + l[88] * x[8] + l[99] * x[9] + l[110] * x[10]);
+}
+
+
+void Ifx_MatF32_add12(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] + b[0];
+    c[1] = a[1] + b[1];
+    c[2] = a[2] + b[2];
+    c[3] = a[3] + b[3];
+    c[4] = a[4] + b[4];
+    c[5] = a[5] + b[5];
+    c[6] = a[6] + b[6];
+    c[7] = a[7] + b[7];
+    c[8] = a[8] + b[8];
+    c[9] = a[9] + b[9];
+    c[10] = a[10] + b[10];
+    c[11] = a[11] + b[11];
+    c[12] = a[12] + b[12];
+    c[13] = a[13] + b[13];
+    c[14] = a[14] + b[14];
+    c[15] = a[15] + b[15];
+    c[16] = a[16] + b[16];
+    c[17] = a[17] + b[17];
+    c[18] = a[18] + b[18];
+    c[19] = a[19] + b[19];
+    c[20] = a[20] + b[20];
+    c[21] = a[21] + b[21];
+    c[22] = a[22] + b[22];
+    c[23] = a[23] + b[23];
+    c[24] = a[24] + b[24];
+    c[25] = a[25] + b[25];
+    c[26] = a[26] + b[26];
+    c[27] = a[27] + b[27];
+    c[28] = a[28] + b[28];
+    c[29] = a[29] + b[29];
+    c[30] = a[30] + b[30];
+    c[31] = a[31] + b[31];
+    c[32] = a[32] + b[32];
+    c[33] = a[33] + b[33];
+    c[34] = a[34] + b[34];
+    c[35] = a[35] + b[35];
+    c[36] = a[36] + b[36];
+    c[37] = a[37] + b[37];
+    c[38] = a[38] + b[38];
+    c[39] = a[39] + b[39];
+    c[40] = a[40] + b[40];
+    c[41] = a[41] + b[41];
+    c[42] = a[42] + b[42];
+    c[43] = a[43] + b[43];
+    c[44] = a[44] + b[44];
+    c[45] = a[45] + b[45];
+    c[46] = a[46] + b[46];
+    c[47] = a[47] + b[47];
+    c[48] = a[48] + b[48];
+    c[49] = a[49] + b[49];
+    c[50] = a[50] + b[50];
+    c[51] = a[51] + b[51];
+    c[52] = a[52] + b[52];
+    c[53] = a[53] + b[53];
+    c[54] = a[54] + b[54];
+    c[55] = a[55] + b[55];
+    c[56] = a[56] + b[56];
+    c[57] = a[57] + b[57];
+    c[58] = a[58] + b[58];
+    c[59] = a[59] + b[59];
+    c[60] = a[60] + b[60];
+    c[61] = a[61] + b[61];
+    c[62] = a[62] + b[62];
+    c[63] = a[63] + b[63];
+    c[64] = a[64] + b[64];
+    c[65] = a[65] + b[65];
+    c[66] = a[66] + b[66];
+    c[67] = a[67] + b[67];
+    c[68] = a[68] + b[68];
+    c[69] = a[69] + b[69];
+    c[70] = a[70] + b[70];
+    c[71] = a[71] + b[71];
+    c[72] = a[72] + b[72];
+    c[73] = a[73] + b[73];
+    c[74] = a[74] + b[74];
+    c[75] = a[75] + b[75];
+    c[76] = a[76] + b[76];
+    c[77] = a[77] + b[77];
+    c[78] = a[78] + b[78];
+    c[79] = a[79] + b[79];
+    c[80] = a[80] + b[80];
+    c[81] = a[81] + b[81];
+    c[82] = a[82] + b[82];
+    c[83] = a[83] + b[83];
+    c[84] = a[84] + b[84];
+    c[85] = a[85] + b[85];
+    c[86] = a[86] + b[86];
+    c[87] = a[87] + b[87];
+    c[88] = a[88] + b[88];
+    c[89] = a[89] + b[89];
+    c[90] = a[90] + b[90];
+    c[91] = a[91] + b[91];
+    c[92] = a[92] + b[92];
+    c[93] = a[93] + b[93];
+    c[94] = a[94] + b[94];
+    c[95] = a[95] + b[95];
+    c[96] = a[96] + b[96];
+    c[97] = a[97] + b[97];
+    c[98] = a[98] + b[98];
+    c[99] = a[99] + b[99];
+    c[100] = a[100] + b[100];
+    c[101] = a[101] + b[101];
+    c[102] = a[102] + b[102];
+    c[103] = a[103] + b[103];
+    c[104] = a[104] + b[104];
+    c[105] = a[105] + b[105];
+    c[106] = a[106] + b[106];
+    c[107] = a[107] + b[107];
+    c[108] = a[108] + b[108];
+    c[109] = a[109] + b[109];
+    c[110] = a[110] + b[110];
+    c[111] = a[111] + b[111];
+    c[112] = a[112] + b[112];
+    c[113] = a[113] + b[113];
+    c[114] = a[114] + b[114];
+    c[115] = a[115] + b[115];
+    c[116] = a[116] + b[116];
+    c[117] = a[117] + b[117];
+    c[118] = a[118] + b[118];
+    c[119] = a[119] + b[119];
+    c[120] = a[120] + b[120];
+    c[121] = a[121] + b[121];
+    c[122] = a[122] + b[122];
+    c[123] = a[123] + b[123];
+    c[124] = a[124] + b[124];
+    c[125] = a[125] + b[125];
+    c[126] = a[126] + b[126];
+    c[127] = a[127] + b[127];
+    c[128] = a[128] + b[128];
+    c[129] = a[129] + b[129];
+    c[130] = a[130] + b[130];
+    c[131] = a[131] + b[131];
+    c[132] = a[132] + b[132];
+    c[133] = a[133] + b[133];
+    c[134] = a[134] + b[134];
+    c[135] = a[135] + b[135];
+    c[136] = a[136] + b[136];
+    c[137] = a[137] + b[137];
+    c[138] = a[138] + b[138];
+    c[139] = a[139] + b[139];
+    c[140] = a[140] + b[140];
+    c[141] = a[141] + b[141];
+    c[142] = a[142] + b[142];
+    c[143] = a[143] + b[143];
+}
+
+
+void Ifx_MatF32_transpose12(float32 *c, const float32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[12];
+    c[2] = a[24];
+    c[3] = a[36];
+    c[4] = a[48];
+    c[5] = a[60];
+    c[6] = a[72];
+    c[7] = a[84];
+    c[8] = a[96];
+    c[9] = a[108];
+    c[10] = a[120];
+    c[11] = a[132];
+    c[12] = a[1];
+    c[13] = a[13];
+    c[14] = a[25];
+    c[15] = a[37];
+    c[16] = a[49];
+    c[17] = a[61];
+    c[18] = a[73];
+    c[19] = a[85];
+    c[20] = a[97];
+    c[21] = a[109];
+    c[22] = a[121];
+    c[23] = a[133];
+    c[24] = a[2];
+    c[25] = a[14];
+    c[26] = a[26];
+    c[27] = a[38];
+    c[28] = a[50];
+    c[29] = a[62];
+    c[30] = a[74];
+    c[31] = a[86];
+    c[32] = a[98];
+    c[33] = a[110];
+    c[34] = a[122];
+    c[35] = a[134];
+    c[36] = a[3];
+    c[37] = a[15];
+    c[38] = a[27];
+    c[39] = a[39];
+    c[40] = a[51];
+    c[41] = a[63];
+    c[42] = a[75];
+    c[43] = a[87];
+    c[44] = a[99];
+    c[45] = a[111];
+    c[46] = a[123];
+    c[47] = a[135];
+    c[48] = a[4];
+    c[49] = a[16];
+    c[50] = a[28];
+    c[51] = a[40];
+    c[52] = a[52];
+    c[53] = a[64];
+    c[54] = a[76];
+    c[55] = a[88];
+    c[56] = a[100];
+    c[57] = a[112];
+    c[58] = a[124];
+    c[59] = a[136];
+    c[60] = a[5];
+    c[61] = a[17];
+    c[62] = a[29];
+    c[63] = a[41];
+    c[64] = a[53];
+    c[65] = a[65];
+    c[66] = a[77];
+    c[67] = a[89];
+    c[68] = a[101];
+    c[69] = a[113];
+    c[70] = a[125];
+    c[71] = a[137];
+    c[72] = a[6];
+    c[73] = a[18];
+    c[74] = a[30];
+    c[75] = a[42];
+    c[76] = a[54];
+    c[77] = a[66];
+    c[78] = a[78];
+    c[79] = a[90];
+    c[80] = a[102];
+    c[81] = a[114];
+    c[82] = a[126];
+    c[83] = a[138];
+    c[84] = a[7];
+    c[85] = a[19];
+    c[86] = a[31];
+    c[87] = a[43];
+    c[88] = a[55];
+    c[89] = a[67];
+    c[90] = a[79];
+    c[91] = a[91];
+    c[92] = a[103];
+    c[93] = a[115];
+    c[94] = a[127];
+    c[95] = a[139];
+    c[96] = a[8];
+    c[97] = a[20];
+    c[98] = a[32];
+    c[99] = a[44];
+    c[100] = a[56];
+    c[101] = a[68];
+    c[102] = a[80];
+    c[103] = a[92];
+    c[104] = a[104];
+    c[105] = a[116];
+    c[106] = a[128];
+    c[107] = a[140];
+    c[108] = a[9];
+    c[109] = a[21];
+    c[110] = a[33];
+    c[111] = a[45];
+    c[112] = a[57];
+    c[113] = a[69];
+    c[114] = a[81];
+    c[115] = a[93];
+    c[116] = a[105];
+    c[117] = a[117];
+    c[118] = a[129];
+    c[119] = a[141];
+    c[120] = a[10];
+    c[121] = a[22];
+    c[122] = a[34];
+    c[123] = a[46];
+    c[124] = a[58];
+    c[125] = a[70];
+    c[126] = a[82];
+    c[127] = a[94];
+    c[128] = a[106];
+    c[129] = a[118];
+    c[130] = a[130];
+    c[131] = a[142];
+    c[132] = a[11];
+    c[133] = a[23];
+    c[134] = a[35];
+    c[135] = a[47];
+    c[136] = a[59];
+    c[137] = a[71];
+    c[138] = a[83];
+    c[139] = a[95];
+    c[140] = a[107];
+    c[141] = a[119];
+    c[142] = a[131];
+    c[143] = a[143];
+}
+
+
+void Ifx_MatF32_mul12(float32 *c, const float32 *a, const float32 *b)
+{
+    c[0] = a[0] * b[0] + a[1] * b[12] + a[2] * b[24] + a[3] * b[36] + a[4] * b[48] + a[5] * b[60]
+         + a[6] * b[72] + a[7] * b[84] + a[8] * b[96] + a[9] * b[108] + a[10] * b[120] + a[11] * b[132];
+    c[1] = a[0] * b[1] + a[1] * b[13] + a[2] * b[25] + a[3] * b[37] + a[4] * b[49] + a[5] * b[61]
+         + a[6] * b[73] + a[7] * b[85] + a[8] * b[97] + a[9] * b[109] + a[10] * b[121] + a[11] * b[133];
+    c[2] = a[0] * b[2] + a[1] * b[14] + a[2] * b[26] + a[3] * b[38] + a[4] * b[50] + a[5] * b[62]
+         + a[6] * b[74] + a[7] * b[86] + a[8] * b[98] + a[9] * b[110] + a[10] * b[122] + a[11] * b[134];
+    c[3] = a[0] * b[3] + a[1] * b[15] + a[2] * b[27] + a[3] * b[39] + a[4] * b[51] + a[5] * b[63]
+         + a[6] * b[75] + a[7] * b[87] + a[8] * b[99] + a[9] * b[111] + a[10] * b[123] + a[11] * b[135];
+    c[4] = a[0] * b[4] + a[1] * b[16] + a[2] * b[28] + a[3] * b[40] + a[4] * b[52] + a[5] * b[64]
+         + a[6] * b[76] + a[7] * b[88] + a[8] * b[100] + a[9] * b[112] + a[10] * b[124] + a[11] * b[136];
+    c[5] = a[0] * b[5] + a[1] * b[17] + a[2] * b[29] + a[3] * b[41] + a[4] * b[53] + a[5] * b[65]
+         + a[6] * b[77] + a[7] * b[89] + a[8] * b[101] + a[9] * b[113] + a[10] * b[125] + a[11] * b[137];
+    c[6] = a[0] * b[6] + a[1] * b[18] + a[2] * b[30] + a[3] * b[42] + a[4] * b[54] + a[5] * b[66]
+         + a[6] * b[78] + a[7] * b[90] + a[8] * b[102] + a[9] * b[114] + a[10] * b[126] + a[11] * b[138];
+    c[7] = a[0] * b[7] + a[1] * b[19] + a[2] * b[31] + a[3] * b[43] + a[4] * b[55] + a[5] * b[67]
+         + a[6] * b[79] + a[7] * b[91] + a[8] * b[103] + a[9] * b[115] + a[10] * b[127] + a[11] * b[139];
+    c[8] = a[0] * b[8] + a[1] * b[20] + a[2] * b[32] + a[3] * b[44] + a[4] * b[56] + a[5] * b[68]
+         + a[6] * b[80] + a[7] * b[92] + a[8] * b[104] + a[9] * b[116] + a[10] * b[128] + a[11] * b[140];
+    c[9] = a[0] * b[9] + a[1] * b[21] + a[2] * b[33] + a[3] * b[45] + a[4] * b[57] + a[5] * b[69]
+         + a[6] * b[81] + a[7] * b[93] + a[8] * b[105] + a[9] * b[117] + a[10] * b[129] + a[11] * b[141];
+    c[10] = a[0] * b[10] + a[1] * b[22] + a[2] * b[34] + a[3] * b[46] + a[4] * b[58] + a[5] * b[70]
+          + a[6] * b[82] + a[7] * b[94] + a[8] * b[106] + a[9] * b[118] + a[10] * b[130] + a[11] * b[142];
+    c[11] = a[0] * b[11] + a[1] * b[23] + a[2] * b[35] + a[3] * b[47] + a[4] * b[59] + a[5] * b[71]
+          + a[6] * b[83] + a[7] * b[95] + a[8] * b[107] + a[9] * b[119] + a[10] * b[131] + a[11] * b[143];
+    c[12] = a[12] * b[0] + a[13] * b[12] + a[14] * b[24] + a[15] * b[36] + a[16] * b[48] + a[17] * b[60]
+          + a[18] * b[72] + a[19] * b[84] + a[20] * b[96] + a[21] * b[108] + a[22] * b[120] + a[23] * b[132];
+    c[13] = a[12] * b[1] + a[13] * b[13] + a[14] * b[25] + a[15] * b[37] + a[16] * b[49] + a[17] * b[61]
+          + a[18] * b[73] + a[19] * b[85] + a[20] * b[97] + a[21] * b[109] + a[22] * b[121] + a[23] * b[133];
+    c[14] = a[12] * b[2] + a[13] * b[14] + a[14] * b[26] + a[15] * b[38] + a[16] * b[50] + a[17] * b[62]
+          + a[18] * b[74] + a[19] * b[86] + a[20] * b[98] + a[21] * b[110] + a[22] * b[122] + a[23] * b[134];
+    c[15] = a[12] * b[3] + a[13] * b[15] + a[14] * b[27] + a[15] * b[39] + a[16] * b[51] + a[17] * b[63]
+          + a[18] * b[75] + a[19] * b[87] + a[20] * b[99] + a[21] * b[111] + a[22] * b[123] + a[23] * b[135];
+    c[16] = a[12] * b[4] + a[13] * b[16] + a[14] * b[28] + a[15] * b[40] + a[16] * b[52] + a[17] * b[64]
+          + a[18] * b[76] + a[19] * b[88] + a[20] * b[100] + a[21] * b[112] + a[22] * b[124] + a[23] * b[136];
+    c[17] = a[12] * b[5] + a[13] * b[17] + a[14] * b[29] + a[15] * b[41] + a[16] * b[53] + a[17] * b[65]
+          + a[18] * b[77] + a[19] * b[89] + a[20] * b[101] + a[21] * b[113] + a[22] * b[125] + a[23] * b[137];
+    c[18] = a[12] * b[6] + a[13] * b[18] + a[14] * b[30] + a[15] * b[42] + a[16] * b[54] + a[17] * b[66]
+          + a[18] * b[78] + a[19] * b[90] + a[20] * b[102] + a[21] * b[114] + a[22] * b[126] + a[23] * b[138];
+    c[19] = a[12] * b[7] + a[13] * b[19] + a[14] * b[31] + a[15] * b[43] + a[16] * b[55] + a[17] * b[67]
+          + a[18] * b[79] + a[19] * b[91] + a[20] * b[103] + a[21] * b[115] + a[22] * b[127] + a[23] * b[139];
+    c[20] = a[12] * b[8] + a[13] * b[20] + a[14] * b[32] + a[15] * b[44] + a[16] * b[56] + a[17] * b[68]
+          + a[18] * b[80] + a[19] * b[92] + a[20] * b[104] + a[21] * b[116] + a[22] * b[128] + a[23] * b[140];
+    c[21] = a[12] * b[9] + a[13] * b[21] + a[14] * b[33] + a[15] * b[45] + a[16] * b[57] + a[17] * b[69]
+          + a[18] * b[81] + a[19] * b[93] + a[20] * b[105] + a[21] * b[117] + a[22] * b[129] + a[23] * b[141];
+    c[22] = a[12] * b[10] + a[13] * b[22] + a[14] * b[34] + a[15] * b[46] + a[16] * b[58] + a[17] * b[70]
+          + a[18] * b[82] + a[19] * b[94] + a[20] * b[106] + a[21] * b[118] + a[22] * b[130] + a[23] * b[142];
+    c[23] = a[12] * b[11] + a[13] * b[23] + a[14] * b[35] + a[15] * b[47] + a[16] * b[59] + a[17] * b[71]
+          + a[18] * b[83] + a[19] * b[95] + a[20] * b[107] + a[21] * b[119] + a[22] * b[131] + a[23] * b[143];
+    c[24] = a[24] * b[0] + a[25] * b[12] + a[26] * b[24] + a[27] * b[36] + a[28] * b[48] + a[29] * b[60]
+          + a[30] * b[72] + a[31] * b[84] + a[32] * b[96] + a[33] * b[108] + a[34] * b[120] + a[35] * b[132];
+    c[25] = a[24] * b[1] + a[25] * b[13] + a[26] * b[25] + a[27] * b[37] + a[28] * b[49] + a[29] * b[61]
+          + a[30] * b[73] + a[31] * b[85] + a[32] * b[97] + a[33] * b[109] + a[34] * b[121] + a[35] * b[133];
+    c[26] = a[24] * b[2] + a[25] * b[14] + a[26] * b[26] + a[27] * b[38] + a[28] * b[50] + a[29] * b[62]
+          + a[30] * b[74] + a[31] * b[86] + a[32] * b[98] + a[33] * b[110] + a[34] * b[122] + a[35] * b[134];
+    c[27] = a[24] * b[3] + a[25] * b[15] + a[26] * b[27] + a[27] * b[39] + a[28] * b[51] + a[29] * b[63]
+          + a[30] * b[75] + a[31] * b[87] + a[32] * b[99] + a[33] * b[111] + a[34] * b[123] + a[35] * b[135];
+    c[28] = a[24] * b[4] + a[25] * b[16] + a[26] * b[28] + a[27] * b[40] + a[28] * b[52] + a[29] * b[64]
+          + a[30] * b[76] + a[31] * b[88] + a[32] * b[100] + a[33] * b[112] + a[34] * b[124] + a[35] * b[136];
+    c[29] = a[24] * b[5] + a[25] * b[17] + a[26] * b[29] + a[27] * b[41] + a[28] * b[53] + a[29] * b[65]
+          + a[30] * b[77] + a[31] * b[89] + a[32] * b[101] + a[33] * b[113] + a[34] * b[125] + a[35] * b[137];
+    c[30] = a[24] * b[6] + a[25] * b[18] + a[26] * b[30] + a[27] * b[42] + a[28] * b[54] + a[29] * b[66]
+          + a[30] * b[78] + a[31] * b[90] + a[32] * b[102] + a[33] * b[114] + a[34] * b[126] + a[35] * b[138];
+    c[31] = a[24] * b[7] + a[25] * b[19] + a[26] * b[31] + a[27] * b[43] + a[28] * b[55] + a[29] * b[67]
+          + a[30] * b[79] + a[31] * b[91] + a[32] * b[103] + a[33] * b[115] + a[34] * b[127] + a[35] * b[139];
+    c[32] = a[24] * b[8] + a[25] * b[20] + a[26] * b[32] + a[27] * b[44] + a[28] * b[56] + a[29] * b[68]
+          + a[30] * b[80] + a[31] * b[92] + a[32] * b[104] + a[33] * b[116] + a[34] * b[128] + a[35] * b[140];
+    c[33] = a[24] * b[9] + a[25] * b[21] + a[26] * b[33] + a[27] * b[45] + a[28] * b[57] + a[29] * b[69]
+          + a[30] * b[81] + a[31] * b[93] + a[32] * b[105] + a[33] * b[117] + a[34] * b[129] + a[35] * b[141];
+    c[34] = a[24] * b[10] + a[25] * b[22] + a[26] * b[34] + a[27] * b[46] + a[28] * b[58] + a[29] * b[70]
+          + a[30] * b[82] + a[31] * b[94] + a[32] * b[106] + a[33] * b[118] + a[34] * b[130] + a[35] * b[142];
+    c[35] = a[24] * b[11] + a[25] * b[23] + a[26] * b[35] + a[27] * b[47] + a[28] * b[59] + a[29] * b[71]
+          + a[30] * b[83] + a[31] * b[95] + a[32] * b[107] + a[33] * b[119] + a[34] * b[131] + a[35] * b[143];
+    c[36] = a[36] * b[0] + a[37] * b[12] + a[38] * b[24] + a[39] * b[36] + a[40] * b[48] + a[41] * b[60]
+          + a[42] * b[72] + a[43] * b[84] + a[44] * b[96] + a[45] * b[108] + a[46] * b[120] + a[47] * b[132];
+    c[37] = a[36] * b[1] + a[37] * b[13] + a[38] * b[25] + a[39] * b[37] + a[40] * b[49] + a[41] * b[61]
+          + a[42] * b[73] + a[43] * b[85] + a[44] * b[97] + a[45] * b[109] + a[46] * b[121] + a[47] * b[133];
+    c[38] = a[36] * b[2] + a[37] * b[14] + a[38] * b[26] + a[39] * b[38] + a[40] * b[50] + a[41] * b[62]
+          + a[42] * b[74] + a[43] * b[86] + a[44] * b[98] + a[45] * b[110] + a[46] * b[122] + a[47] * b[134];
+    c[39] = a[36] * b[3] + a[37] * b[15] + a[38] * b[27] + a[39] * b[39] + a[40] * b[51] + a[41] * b[63]
+          + a[42] * b[75] + a[43] * b[87] + a[44] * b[99] + a[45] * b[111] + a[46] * b[123] + a[47] * b[135];
+    c[40] = a[36] * b[4] + a[37] * b[16] + a[38] * b[28] + a[39] * b[40] + a[40] * b[52] + a[41] * b[64]
+          + a[42] * b[76] + a[43] * b[88] + a[44] * b[100] + a[45] * b[112] + a[46] * b[124] + a[47] * b[136];
+    c[41] = a[36] * b[5] + a[37] * b[17] + a[38] * b[29] + a[39] * b[41] + a[40] * b[53] + a[41] * b[65]
+          + a[42] * b[77] + a[43] * b[89] + a[44] * b[101] + a[45] * b[113] + a[46] * b[125] + a[47] * b[137];
+    c[42] = a[36] * b[6] + a[37] * b[18] + a[38] * b[30] + a[39] * b[42] + a[40] * b[54] + a[41] * b[66]
+          + a[42] * b[78] + a[43] * b[90] + a[44] * b[102] + a[45] * b[114] + a[46] * b[126] + a[47] * b[138];
+    c[43] = a[36] * b[7] + a[37] * b[19] + a[38] * b[31] + a[39] * b[43] + a[40] * b[55] + a[41] * b[67]
+          + a[42] * b[79] + a[43] * b[91] + a[44] * b[103] + a[45] * b[115] + a[46] * b[127] + a[47] * b[139];
+    c[44] = a[36] * b[8] + a[37] * b[20] + a[38] * b[32] + a[39] * b[44] + a[40] * b[56] + a[41] * b[68]
+          + a[42] * b[80] + a[43] * b[92] + a[44] * b[104] + a[45] * b[116] + a[46] * b[128] + a[47] * b[140];
+    c[45] = a[36] * b[9] + a[37] * b[21] + a[38] * b[33] + a[39] * b[45] + a[40] * b[57] + a[41] * b[69]
+          + a[42] * b[81] + a[43] * b[93] + a[44] * b[105] + a[45] * b[117] + a[46] * b[129] + a[47] * b[141];
+    c[46] = a[36] * b[10] + a[37] * b[22] + a[38] * b[34] + a[39] * b[46] + a[40] * b[58] + a[41] * b[70]
+          + a[42] * b[82] + a[43] * b[94] + a[44] * b[106] + a[45] * b[118] + a[46] * b[130] + a[47] * b[142];
+    c[47] = a[36] * b[11] + a[37] * b[23] + a[38] * b[35] + a[39] * b[47] + a[40] * b[59] + a[41] * b[71]
+          + a[42] * b[83] + a[43] * b[95] + a[44] * b[107] + a[45] * b[119] + a[46] * b[131] + a[47] * b[143];
+    c[48] = a[48] * b[0] + a[49] * b[12] + a[50] * b[24] + a[51] * b[36] + a[52] * b[48] + a[53] * b[60]
+          + a[54] * b[72] + a[55] * b[84] + a[56] * b[96] + a[57] * b[108] + a[58] * b[120] + a[59] * b[132];
+    c[49] = a[48] * b[1] + a[49] * b[13] + a[50] * b[25] + a[51] * b[37] + a[52] * b[49] + a[53] * b[61]
+          + a[54] * b[73] + a[55] * b[85] + a[56] * b[97] + a[57] * b[109] + a[58] * b[121] + a[59] * b[133];
+    c[50] = a[48] * b[2] + a[49] * b[14] + a[50] * b[26] + a[51] * b[38] + a[52] * b[50] + a[53] * b[62]
+          + a[54] * b[74] + a[55] * b[86] + a[56] * b[98] + a[57] * b[110] + a[58] * b[122] + a[59] * b[134];
+    c[51] = a[48] * b[3] + a[49] * b[15] + a[50] * b[27] + a[51] * b[39] + a[52] * b[51] + a[53] * b[63]
+          + a[54] * b[75] + a[55] * b[87] + a[56] * b[99] + a[57] * b[111] + a[58] * b[123] + a[59] * b[135];
+    c[52] = a[48] * b[4] + a[49] * b[16] + a[50] * b[28] + a[51] * b[40] + a[52] * b[52] + a[53] * b[64]
+          + a[54] * b[76] + a[55] * b[88] + a[56] * b[100] + a[57] * b[112] + a[58] * b[124] + a[59] * b[136];
+    c[53] = a[48] * b[5] + a[49] * b[17] + a[50] * b[29] + a[51] * b[41] + a[52] * b[53] + a[53] * b[65]
+          + a[54] * b[77] + a[55] * b[89] + a[56] * b[101] + a[57] * b[113] + a[58] * b[125] + a[59] * b[137];
+    c[54] = a[48] * b[6] + a[49] * b[18] + a[50] * b[30] + a[51] * b[42] + a[52] * b[54] + a[53] * b[66]
+          + a[54] * b[78] + a[55] * b[90] + a[56] * b[102] + a[57] * b[114] + a[58] * b[126] + a[59] * b[138];
+    c[55] = a[48] * b[7] + a[49] * b[19] + a[50] * b[31] + a[51] * b[43] + a[52] * b[55] + a[53] * b[67]
+          + a[54] * b[79] + a[55] * b[91] + a[56] * b[103] + a[57] * b[115] + a[58] * b[127] + a[59] * b[139];
+    c[56] = a[48] * b[8] + a[49] * b[20] + a[50] * b[32] + a[51] * b[44] + a[52] * b[56] + a[53] * b[68]
+          + a[54] * b[80] + a[55] * b[92] + a[56] * b[104] + a[57] * b[116] + a[58] * b[128] + a[59] * b[140];
+    c[57] = a[48] * b[9] + a[49] * b[21] + a[50] * b[33] + a[51] * b[45] + a[52] * b[57] + a[53] * b[69]
+          + a[54] * b[81] + a[55] * b[93] + a[56] * b[105] + a[57] * b[117] + a[58] * b[129] + a[59] * b[141];
+    c[58] = a[48] * b[10] + a[49] * b[22] + a[50] * b[34] + a[51] * b[46] + a[52] * b[58] + a[53] * b[70]
+          + a[54] * b[82] + a[55] * b[94] + a[56] * b[106] + a[57] * b[118] + a[58] * b[130] + a[59] * b[142];
+    c[59] = a[48] * b[11] + a[49] * b[23] + a[50] * b[35] + a[51] * b[47] + a[52] * b[59] + a[53] * b[71]
+          + a[54] * b[83] + a[55] * b[95] + a[56] * b[107] + a[57] * b[119] + a[58] * b[131] + a[59] * b[143];
+    c[60] = a[60] * b[0] + a[61] * b[12] + a[62] * b[24] + a[63] * b[36] + a[64] * b[48] + a[65] * b[60]
+          + a[66] * b[72] + a[67] * b[84] + a[68] * b[96] + a[69] * b[108] + a[70] * b[120] + a[71] * b[132];
+    c[61] = a[60] * b[1] + a[61] * b[13] + a[62] * b[25] + a[63] * b[37] + a[64] * b[49] + a[65] * b[61]
+          + a[66] * b[73] + a[67] * b[85] + a[68] * b[97] + a[69] * b[109] + a[70] * b[121] + a[71] * b[133];
+    c[62] = a[60] * b[2] + a[61] * b[14] + a[62] * b[26] + a[63] * b[38] + a[64] * b[50] + a[65] * b[62]
+          + a[66] * b[74] + a[67] * b[86] + a[68] * b[98] + a[69] * b[110] + a[70] * b[122] + a[71] * b[134];
+    c[63] = a[60] * b[3] + a[61] * b[15] + a[62] * b[27] + a[63] * b[39] + a[64] * b[51] + a[65] * b[63]
+          + a[66] * b[75] + a[67] * b[87] + a[68] * b[99] + a[69] * b[111] + a[70] * b[123] + a[71] * b[135];
+    c[64] = a[60] * b[4] + a[61] * b[16] + a[62] * b[28] + a[63] * b[40] + a[64] * b[52] + a[65] * b[64]
+          + a[66] * b[76] + a[67] * b[88] + a[68] * b[100] + a[69] * b[112] + a[70] * b[124] + a[71] * b[136];
+    c[65] = a[60] * b[5] + a[61] * b[17] + a[62] * b[29] + a[63] * b[41] + a[64] * b[53] + a[65] * b[65]
+          + a[66] * b[77] + a[67] * b[89] + a[68] * b[101] + a[69] * b[113] + a[70] * b[125] + a[71] * b[137];
+    c[66] = a[60] * b[6] + a[61] * b[18] + a[62] * b[30] + a[63] * b[42] + a[64] * b[54] + a[65] * b[66]
+          + a[66] * b[78] + a[67] * b[90] + a[68] * b[102] + a[69] * b[114] + a[70] * b[126] + a[71] * b[138];
+    c[67] = a[60] * b[7] + a[61] * b[19] + a[62] * b[31] + a[63] * b[43] + a[64] * b[55] + a[65] * b[67]
+          + a[66] * b[79] + a[67] * b[91] + a[68] * b[103] + a[69] * b[115] + a[70] * b[127] + a[71] * b[139];
+    c[68] = a[60] * b[8] + a[61] * b[20] + a[62] * b[32] + a[63] * b[44] + a[64] * b[56] + a[65] * b[68]
+          + a[66] * b[80] + a[67] * b[92] + a[68] * b[104] + a[69] * b[116] + a[70] * b[128] + a[71] * b[140];
+    c[69] = a[60] * b[9] + a[61] * b[21] + a[62] * b[33] + a[63] * b[45] + a[64] * b[57] + a[65] * b[69]
+          + a[66] * b[81] + a[67] * b[93] + a[68] * b[105] + a[69] * b[117] + a[70] * b[129] + a[71] * b[141];
+    c[70] = a[60] * b[10] + a[61] * b[22] + a[62] * b[34] + a[63] * b[46] + a[64] * b[58] + a[65] * b[70]
+          + a[66] * b[82] + a[67] * b[94] + a[68] * b[106] + a[69] * b[118] + a[70] * b[130] + a[71] * b[142];
+    c[71] = a[60] * b[11] + a[61] * b[23] + a[62] * b[35] + a[63] * b[47] + a[64] * b[59] + a[65] * b[71]
+          + a[66] * b[83] + a[67] * b[95] + a[68] * b[107] + a[69] * b[119] + a[70] * b[131] + a[71] * b[143];
+    c[72] = a[72] * b[0] + a[73] * b[12] + a[74] * b[24] + a[75] * b[36] + a[76] * b[48] + a[77] * b[60]
+          + a[78] * b[72] + a[79] * b[84] + a[80] * b[96] + a[81] * b[108] + a[82] * b[120] + a[83] * b[132];
+    c[73] = a[72] * b[1] + a[73] * b[13] + a[74] * b[25] + a[75] * b[37] + a[76] * b[49] + a[77] * b[61]
+          + a[78] * b[73] + a[79] * b[85] + a[80] * b[97] + a[81] * b[109] + a[82] * b[121] + a[83] * b[133];
+    c[74] = a[72] * b[2] + a[73] * b[14] + a[74] * b[26] + a[75] * b[38] + a[76] * b[50] + a[77] * b[62]
+          + a[78] * b[74] + a[79] * b[86] + a[80] * b[98] + a[81] * b[110] + a[82] * b[122] + a[83] * b[134];
+    c[75] = a[72] * b[3] + a[73] * b[15] + a[74] * b[27] + a[75] * b[39] + a[76] * b[51] + a[77] * b[63]
+          + a[78] * b[75] + a[79] * b[87] + a[80] * b[99] + a[81] * b[111] + a[82] * b[123] + a[83] * b[135];
+    c[76] = a[72] * b[4] + a[73] * b[16] + a[74] * b[28] + a[75] * b[40] + a[76] * b[52] + a[77] * b[64]
+          + a[78] * b[76] + a[79] * b[88] + a[80] * b[100] + a[81] * b[112] + a[82] * b[124] + a[83] * b[136];
+    c[77] = a[72] * b[5] + a[73] * b[17] + a[74] * b[29] + a[75] * b[41] + a[76] * b[53] + a[77] * b[65]
+          + a[78] * b[77] + a[79] * b[89] + a[80] * b[101] + a[81] * b[113] + a[82] * b[125] + a[83] * b[137];
+    c[78] = a[72] * b[6] + a[73] * b[18] + a[74] * b[30] + a[75] * b[42] + a[76] * b[54] + a[77] * b[66]
+          + a[78] * b[78] + a[79] * b[90] + a[80] * b[102] + a[81] * b[114] + a[82] * b[126] + a[83] * b[138];
+    c[79] = a[72] * b[7] + a[73] * b[19] + a[74] * b[31] + a[75] * b[43] + a[76] * b[55] + a[77] * b[67]
+          + a[78] * b[79] + a[79] * b[91] + a[80] * b[103] + a[81] * b[115] + a[82] * b[127] + a[83] * b[139];
+    c[80] = a[72] * b[8] + a[73] * b[20] + a[74] * b[32] + a[75] * b[44] + a[76] * b[56] + a[77] * b[68]
+          + a[78] * b[80] + a[79] * b[92] + a[80] * b[104] + a[81] * b[116] + a[82] * b[128] + a[83] * b[140];
+    c[81] = a[72] * b[9] + a[73] * b[21] + a[74] * b[33] + a[75] * b[45] + a[76] * b[57] + a[77] * b[69]
+          + a[78] * b[81] + a[79] * b[93] + a[80] * b[105] + a[81] * b[117] + a[82] * b[129] + a[83] * b[141];
+    c[82] = a[72] * b[10] + a[73] * b[22] + a[74] * b[34] + a[75] * b[46] + a[76] * b[58] + a[77] * b[70]
+          + a[78] * b[82] + a[79] * b[94] + a[80] * b[106] + a[81] * b[118] + a[82] * b[130] + a[83] * b[142];
+    c[83] = a[72] * b[11] + a[73] * b[23] + a[74] * b[35] + a[75] * b[47] + a[76] * b[59] + a[77] * b[71]
+          + a[78] * b[83] + a[79] * b[95] + a[80] * b[107] + a[81] * b[119] + a[82] * b[131] + a[83] * b[143];
+    c[84] = a[84] * b[0] + a[85] * b[12] + a[86] * b[24] + a[87] * b[36] + a[88] * b[48] + a[89] * b[60]
+          + a[90] * b[72] + a[91] * b[84] + a[92] * b[96] + a[93] * b[108] + a[94] * b[120] + a[95] * b[132];
+    c[85] = a[84] * b[1] + a[85] * b[13] + a[86] * b[25] + a[87] * b[37] + a[88] * b[49] + a[89] * b[61]
+          + a[90] * b[73] + a[91] * b[85] + a[92] * b[97] + a[93] * b[109] + a[94] * b[121] + a[95] * b[133];
+    c[86] = a[84] * b[2] + a[85] * b[14] + a[86] * b[26] + a[87] * b[38] + a[88] * b[50] + a[89] * b[62]
+          + a[90] * b[74] + a[91] * b[86] + a[92] * b[98] + a[93] * b[110] + a[94] * b[122] + a[95] * b[134];
+    c[87] = a[84] * b[3] + a[85] * b[15] + a[86] * b[27] + a[87] * b[39] + a[88] * b[51] + a[89] * b[63]
+          + a[90] * b[75] + a[91] * b[87] + a[92] * b[99] + a[93] * b[111] + a[94] * b[123] + a[95] * b[135];
+    c[88] = a[84] * b[4] + a[85] * b[16] + a[86] * b[28] + a[87] * b[40] + a[88] * b[52] + a[89] * b[64]
+          + a[90] * b[76] + a[91] * b[88] + a[92] * b[100] + a[93] * b[112] + a[94] * b[124] + a[95] * b[136];
+    c[89] = a[84] * b[5] + a[85] * b[17] + a[86] * b[29] + a[87] * b[41] + a[88] * b[53] + a[89] * b[65]
+          + a[90] * b[77] + a[91] * b[89] + a[92] * b[101] + a[93] * b[113] + a[94] * b[125] + a[95] * b[137];
+    c[90] = a[84] * b[6] + a[85] * b[18] + a[86] * b[30] + a[87] * b[42] + a[88] * b[54] + a[89] * b[66]
+          + a[90] * b[78] + a[91] * b[90] + a[92] * b[102] + a[93] * b[114] + a[94] * b[126] + a[95] * b[138];
+    c[91] = a[84] * b[7] + a[85] * b[19] + a[86] * b[31] + a[87] * b[43] + a[88] * b[55] + a[89] * b[67]
+          + a[90] * b[79] + a[91] * b[91] + a[92] * b[103] + a[93] * b[115] + a[94] * b[127] + a[95] * b[139];
+    c[92] = a[84] * b[8] + a[85] * b[20] + a[86] * b[32] + a[87] * b[44] + a[88] * b[56] + a[89] * b[68]
+          + a[90] * b[80] + a[91] * b[92] + a[92] * b[104] + a[93] * b[116] + a[94] * b[128] + a[95] * b[140];
+    c[93] = a[84] * b[9] + a[85] * b[21] + a[86] * b[33] + a[87] * b[45] + a[88] * b[57] + a[89] * b[69]
+          + a[90] * b[81] + a[91] * b[93] + a[92] * b[105] + a[93] * b[117] + a[94] * b[129] + a[95] * b[141];
+    c[94] = a[84] * b[10] + a[85] * b[22] + a[86] * b[34] + a[87] * b[46] + a[88] * b[58] + a[89] * b[70]
+          + a[90] * b[82] + a[91] * b[94] + a[92] * b[106] + a[93] * b[118] + a[94] * b[130] + a[95] * b[142];
+    c[95] = a[84] * b[11] + a[85] * b[23] + a[86] * b[35] + a[87] * b[47] + a[88] * b[59] + a[89] * b[71]
+          + a[90] * b[83] + a[91] * b[95] + a[92] * b[107] + a[93] * b[119] + a[94] * b[131] + a[95] * b[143];
+    c[96] = a[96] * b[0] + a[97] * b[12] + a[98] * b[24] + a[99] * b[36] + a[100] * b[48] + a[101] * b[60]
+          + a[102] * b[72] + a[103] * b[84] + a[104] * b[96] + a[105] * b[108] + a[106] * b[120]
+          + a[107] * b[132];
+    c[97] = a[96] * b[1] + a[97] * b[13] + a[98] * b[25] + a[99] * b[37] + a[100] * b[49] + a[101] * b[61]
+          + a[102] * b[73] + a[103] * b[85] + a[104] * b[97] + a[105] * b[109] + a[106] * b[121]
+          + a[107] * b[133];
+    c[98] = a[96] * b[2] + a[97] * b[14] + a[98] * b[26] + a[99] * b[38] + a[100] * b[50] + a[101] * b[62]
+          + a[102] * b[74] + a[103] * b[86] + a[104] * b[98] + a[105] * b[110] + a[106] * b[122]
+          + a[107] * b[134];
+    c[99] = a[96] * b[3] + a[97] * b[15] + a[98] * b[27] + a[99] * b[39] + a[100] * b[51] + a[101] * b[63]
+          + a[102] * b[75] + a[103] * b[87] + a[104] * b[99] + a[105] * b[111] + a[106] * b[123]
+          + a[107] * b[135];
+    c[100] = a[96] * b[4] + a[97] * b[16] + a[98] * b[28] + a[99] * b[40] + a[100] * b[52] + a[101] * b[64]
+           + a[102] * b[76] + a[103] * b[88] + a[104] * b[100] + a[105] * b[112] + a[106] * b[124]
+           + a[107] * b[136];
+    c[101] = a[96] * b[5] + a[97] * b[17] + a[98] * b[29] + a[99] * b[41] + a[100] * b[53] + a[101] * b[65]
+           + a[102] * b[77] + a[103] * b[89] + a[104] * b[101] + a[105] * b[113] + a[106] * b[125]
+           + a[107] * b[137];
+    c[102] = a[96] * b[6] + a[97] * b[18] + a[98] * b[30] + a[99] * b[42] + a[100] * b[54] + a[101] * b[66]
+           + a[102] * b[78] + a[103] * b[90] + a[104] * b[102] + a[105] * b[114] + a[106] * b[126]
+           + a[107] * b[138];
+    c[103] = a[96] * b[7] + a[97] * b[19] + a[98] * b[31] + a[99] * b[43] + a[100] * b[55] + a[101] * b[67]
+           + a[102] * b[79] + a[103] * b[91] + a[104] * b[103] + a[105] * b[115] + a[106] * b[127]
+           + a[107] * b[139];
+    c[104] = a[96] * b[8] + a[97] * b[20] + a[98] * b[32] + a[99] * b[44] + a[100] * b[56] + a[101] * b[68]
+           + a[102] * b[80] + a[103] * b[92] + a[104] * b[104] + a[105] * b[116] + a[106] * b[128]
+           + a[107] * b[140];
+    c[105] = a[96] * b[9] + a[97] * b[21] + a[98] * b[33] + a[99] * b[45] + a[100] * b[57] + a[101] * b[69]
+           + a[102] * b[81] + a[103] * b[93] + a[104] * b[105] + a[105] * b[117] + a[106] * b[129]
+           + a[107] * b[141];
+    c[106] = a[96] * b[10] + a[97] * b[22] + a[98] * b[34] + a[99] * b[46] + a[100] * b[58] + a[101] * b[70]
+           + a[102] * b[82] + a[103] * b[94] + a[104] * b[106] + a[105] * b[118] + a[106] * b[130]
+           + a[107] * b[142];
+    c[107] = a[96] * b[11] + a[97] * b[23] + a[98] * b[35] + a[99] * b[47] + a[100] * b[59] + a[101] * b[71]
+           + a[102] * b[83] + a[103] * b[95] + a[104] * b[107] + a[105] * b[119] + a[106] * b[131]
+           + a[107] * b[143];
+    c[108] = a[108] * b[0] + a[109] * b[12] + a[110] * b[24] + a[111] * b[36] + a[112] * b[48]
+           + a[113] * b[60] + a[114] * b[72] + a[115] * b[84] + a[116] * b[96] + a[117] * b[108]
+           + a[118] * b[120] + a[119] * b[132];
+    c[109] = a[108] * b[1] + a[109] * b[13] + a[110] * b[25] + a[111] * b[37] + a[112] * b[49]
+           + a[113] * b[61] + a[114] * b[73] + a[115] * b[85] + a[116] * b[97] + a[117] * b[109]
+           + a[118] * b[121] + a[119] * b[133];
+    c[110] = a[108] * b[2] + a[109] * b[14] + a[110] * b[26] + a[111] * b[38] + a[112] * b[50]
+           + a[113] * b[62] + a[114] * b[74] + a[115] * b[86] + a[116] * b[98] + a[117] * b[110]
+           + a[118] * b[122] + a[119] * b[134];
+    c[111] = a[108] * b[3] + a[109] * b[15] + a[110] * b[27] + a[111] * b[39] + a[112] * b[51]
+           + a[113] * b[63] + a[114] * b[75] + a[115] * b[87] + a[116] * b[99] + a[117] * b[111]
+           + a[118] * b[123] + a[119] * b[135];
+    c[112] = a[108] * b[4] + a[109] * b[16] + a[110] * b[28] + a[111] * b[40] + a[112] * b[52]
+           + a[113] * b[64] + a[114] * b[76] + a[115] * b[88] + a[116] * b[100] + a[117] * b[112]
+           + a[118] * b[124] + a[119] * b[136];
+    c[113] = a[108] * b[5] + a[109] * b[17] + a[110] * b[29] + a[111] * b[41] + a[112] * b[53]
+           + a[113] * b[65] + a[114] * b[77] + a[115] * b[89] + a[116] * b[101] + a[117] * b[113]
+           + a[118] * b[125] + a[119] * b[137];
+    c[114] = a[108] * b[6] + a[109] * b[18] + a[110] * b[30] + a[111] * b[42] + a[112] * b[54]
+           + a[113] * b[66] + a[114] * b[78] + a[115] * b[90] + a[116] * b[102] + a[117] * b[114]
+           + a[118] * b[126] + a[119] * b[138];
+    c[115] = a[108] * b[7] + a[109] * b[19] + a[110] * b[31] + a[111] * b[43] + a[112] * b[55]
+           + a[113] * b[67] + a[114] * b[79] + a[115] * b[91] + a[116] * b[103] + a[117] * b[115]
+           + a[118] * b[127] + a[119] * b[139];
+    c[116] = a[108] * b[8] + a[109] * b[20] + a[110] * b[32] + a[111] * b[44] + a[112] * b[56]
+           + a[113] * b[68] + a[114] * b[80] + a[115] * b[92] + a[116] * b[104] + a[117] * b[116]
+           + a[118] * b[128] + a[119] * b[140];
+    c[117] = a[108] * b[9] + a[109] * b[21] + a[110] * b[33] + a[111] * b[45] + a[112] * b[57]
+           + a[113] * b[69] + a[114] * b[81] + a[115] * b[93] + a[116] * b[105] + a[117] * b[117]
+           + a[118] * b[129] + a[119] * b[141];
+    c[118] = a[108] * b[10] + a[109] * b[22] + a[110] * b[34] + a[111] * b[46] + a[112] * b[58]
+           + a[113] * b[70] + a[114] * b[82] + a[115] * b[94] + a[116] * b[106] + a[117] * b[118]
+           + a[118] * b[130] + a[119] * b[142];
+    c[119] = a[108] * b[11] + a[109] * b[23] + a[110] * b[35] + a[111] * b[47] + a[112] * b[59]
+           + a[113] * b[71] + a[114] * b[83] + a[115] * b[95] + a[116] * b[107] + a[117] * b[119]
+           + a[118] * b[131] + a[119] * b[143];
+    c[120] = a[120] * b[0] + a[121] * b[12] + a[122] * b[24] + a[123] * b[36] + a[124] * b[48]
+           + a[125] * b[60] + a[126] * b[72] + a[127] * b[84] + a[128] * b[96] + a[129] * b[108]
+           + a[130] * b[120] + a[131] * b[132];
+    c[121] = a[120] * b[1] + a[121] * b[13] + a[122] * b[25] + a[123] * b[37] + a[124] * b[49]
+           + a[125] * b[61] + a[126] * b[73] + a[127] * b[85] + a[128] * b[97] + a[129] * b[109]
+           + a[130] * b[121] + a[131] * b[133];
+    c[122] = a[120] * b[2] + a[121] * b[14] + a[122] * b[26] + a[123] * b[38] + a[124] * b[50]
+           + a[125] * b[62] + a[126] * b[74] + a[127] * b[86] + a[128] * b[98] + a[129] * b[110]
+           + a[130] * b[122] + a[131] * b[134];
+    c[123] = a[120] * b[3] + a[121] * b[15] + a[122] * b[27] + a[123] * b[39] + a[124] * b[51]
+           + a[125] * b[63] + a[126] * b[75] + a[127] * b[87] + a[128] * b[99] + a[129] * b[111]
+           + a[130] * b[123] + a[131] * b[135];
+    c[124] = a[120] * b[4] + a[121] * b[16] + a[122] * b[28] + a[123] * b[40] + a[124] * b[52]
+           + a[125] * b[64] + a[126] * b[76] + a[127] * b[88] + a[128] * b[100] + a[129] * b[112]
+           + a[130] * b[124] + a[131] * b[136];
+    c[125] = a[120] * b[5] + a[121] * b[17] + a[122] * b[29] + a[123] * b[41] + a[124] * b[53]
+           + a[125] * b[65] + a[126] * b[77] + a[127] * b[89] + a[128] * b[101] + a[129] * b[113]
+           + a[130] * b[125] + a[131] * b[137];
+    c[126] = a[120] * b[6] + a[121] * b[18] + a[122] * b[30] + a[123] * b[42] + a[124] * b[54]
+           + a[125] * b[66] + a[126] * b[78] + a[127] * b[90] + a[128] * b[102] + a[129] * b[114]
+           + a[130] * b[126] + a[131] * b[138];
+    c[127] = a[120] * b[7] + a[121] * b[19] + a[122] * b[31] + a[123] * b[43] + a[124] * b[55]
+           + a[125] * b[67] + a[126] * b[79] + a[127] * b[91] + a[128] * b[103] + a[129] * b[115]
+           + a[130] * b[127] + a[131] * b[139];
+    c[128] = a[120] * b[8] + a[121] * b[20] + a[122] * b[32] + a[123] * b[44] + a[124] * b[56]
+           + a[125] * b[68] + a[126] * b[80] + a[127] * b[92] + a[128] * b[104] + a[129] * b[116]
+           + a[130] * b[128] + a[131] * b[140];
+    c[129] = a[120] * b[9] + a[121] * b[21] + a[122] * b[33] + a[123] * b[45] + a[124] * b[57]
+           + a[125] * b[69] + a[126] * b[81] + a[127] * b[93] + a[128] * b[105] + a[129] * b[117]
+           + a[130] * b[129] + a[131] * b[141];
+    c[130] = a[120] * b[10] + a[121] * b[22] + a[122] * b[34] + a[123] * b[46] + a[124] * b[58]
+           + a[125] * b[70] + a[126] * b[82] + a[127] * b[94] + a[128] * b[106] + a[129] * b[118]
+           + a[130] * b[130] + a[131] * b[142];
+    c[131] = a[120] * b[11] + a[121] * b[23] + a[122] * b[35] + a[123] * b[47] + a[124] * b[59]
+           + a[125] * b[71] + a[126] * b[83] + a[127] * b[95] + a[128] * b[107] + a[129] * b[119]
+           + a[130] * b[131] + a[131] * b[143];
+    c[132] = a[132] * b[0] + a[133] * b[12] + a[134] * b[24] + a[135] * b[36] + a[136] * b[48]
+           + a[137] * b[60] + a[138] * b[72] + a[139] * b[84] + a[140] * b[96] + a[141] * b[108]
+           + a[142] * b[120] + a[143] * b[132];
+    c[133] = a[132] * b[1] + a[133] * b[13] + a[134] * b[25] + a[135] * b[37] + a[136] * b[49]
+           + a[137] * b[61] + a[138] * b[73] + a[139] * b[85] + a[140] * b[97] + a[141] * b[109]
+           + a[142] * b[121] + a[143] * b[133];
+    c[134] = a[132] * b[2] + a[133] * b[14] + a[134] * b[26] + a[135] * b[38] + a[136] * b[50]
+           + a[137] * b[62] + a[138] * b[74] + a[139] * b[86] + a[140] * b[98] + a[141] * b[110]
+           + a[142] * b[122] + a[143] * b[134];
+    c[135] = a[132] * b[3] + a[133] * b[15] + a[134] * b[27] + a[135] * b[39] + a[136] * b[51]
+           + a[137] * b[63] + a[138] * b[75] + a[139] * b[87] + a[140] * b[99] + a[141] * b[111]
+           + a[142] * b[123] + a[143] * b[135];
+    c[136] = a[132] * b[4] + a[133] * b[16] + a[134] * b[28] + a[135] * b[40] + a[136] * b[52]
+           + a[137] * b[64] + a[138] * b[76] + a[139] * b[88] + a[140] * b[100] + a[141] * b[112]
+           + a[142] * b[124] + a[143] * b[136];
+    c[137] = a[132] * b[5] + a[133] * b[17] + a[134] * b[29] + a[135] * b[41] + a[136] * b[53]
+           + a[137] * b[65] + a[138] * b[77] + a[139] * b[89] + a[140] * b[101] + a[141] * b[113]
+           + a[142] * b[125] + a[143] * b[137];
+    c[138] = a[132] * b[6] + a[133] * b[18] + a[134] * b[30] + a[135] * b[42] + a[136] * b[54]
+           + a[137] * b[66] + a[138] * b[78] + a[139] * b[90] + a[140] * b[102] + a[141] * b[114]
+           + a[142] * b[126] + a[143] * b[138];
+    c[139] = a[132] * b[7] + a[133] * b[19] + a[134] * b[31] + a[135] * b[43] + a[136] * b[55]
+           + a[137] * b[67] + a[138] * b[79] + a[139] * b[91] + a[140] * b[103] + a[141] * b[115]
+           + a[142] * b[127] + a[143] * b[139];
+    c[140] = a[132] * b[8] + a[133] * b[20] + a[134] * b[32] + a[135] * b[44] + a[136] * b[56]
+           + a[137] * b[68] + a[138] * b[80] + a[139] * b[92] + a[140] * b[104] + a[141] * b[116]
+           + a[142] * b[128] + a[143] * b[140];
+    c[141] = a[132] * b[9] + a[133] * b[21] + a[134] * b[33] + a[135] * b[45] + a[136] * b[57]
+           + a[137] * b[69] + a[138] * b[81] + a[139] * b[93] + a[140] * b[105] + a[141] * b[117]
+           + a[142] * b[129] + a[143] * b[141];
+    c[142] = a[132] * b[10] + a[133] * b[22] + a[134] * b[34] + a[135] * b[46] + a[136] * b[58]
+           + a[137] * b[70] + a[138] * b[82] + a[139] * b[94] + a[140] * b[106] + a[141] * b[118]
+           + a[142] * b[130] + a[143] * b[142];
+    c[143] = a[132] * b[11] + a[133] * b[23] + a[134] * b[35] + a[135] * b[47] + a[136] * b[59]
+           + a[137] * b[71] + a[138] * b[83] + a[139] * b[95] + a[140] * b[107] + a[141] * b[119]
+           + a[142] * b[131] + a[143] * b[143];
+}
+
+
+void Ifx_MatF32_mulVec12(float32 *y, const float32 *a, const float32 *x)
+{
+    y[0] = a[0] * x[0] + a[1] * x[1] + a[2] * x[2] + a[3] * x[3] + a[4] * x[4] + a[5] * x[5] + a[6] * x[6]
+         + a[7] * x[7] + a[8] * x[8] + a[9] * x[9] + a[10] * x[10] + a[11] * x[11];
+    y[1] = a[12] * x[0] + a[13] * x[1] + a[14] * x[2] + a[15] * x[3] + a[16] * x[4] + a[17] * x[5]
+         + a[18] * x[6] + a[19] * x[7] + a[20] * x[8] + a[21] * x[9] + a[22] * x[10] + a[23] * x[11];
+    y[2] = a[24] * x[0] + a[25] * x[1] + a[26] * x[2] + a[27] * x[3] + a[28] * x[4] + a[29] * x[5]
+         + a[30] * x[6] + a[31] * x[7] + a[32] * x[8] + a[33] * x[9] + a[34] * x[10] + a[35] * x[11];
+    y[3] = a[36] * x[0] + a[37] * x[1] + a[38] * x[2] + a[39] * x[3] + a[40] * x[4] + a[41] * x[5]
+         + a[42] * x[6] + a[43] * x[7] + a[44] * x[8] + a[45] * x[9] + a[46] * x[10] + a[47] * x[11];
+    y[4] = a[48] * x[0] + a[49] * x[1] + a[50] * x[2] + a[51] * x[3] + a[52] * x[4] + a[53] * x[5]
+         + a[54] * x[6] + a[55] * x[7] + a[56] * x[8] + a[57] * x[9] + a[58] * x[10] + a[59] * x[11];
+    y[5] = a[60] * x[0] + a[61] * x[1] + a[62] * x[2] + a[63] * x[3] + a[64] * x[4] + a[65] * x[5]
+         + a[66] * x[6] + a[67] * x[7] + a[68] * x[8] + a[69] * x[9] + a[70] * x[10] + a[71] * x[11];
+    y[6] = a[72] * x[0] + a[73] * x[1] + a[74] * x[2] + a[75] * x[3] + a[76] * x[4] + a[77] * x[5]
+         + a[78] * x[6] + a[79] * x[7] + a[80] * x[8] + a[81] * x[9] + a[82] * x[10] + a[83] * x[11];
+    y[7] = a[84] * x[0] + a[85] * x[1] + a[86] * x[2] + a[87] * x[3] + a[88] * x[4] + a[89] * x[5]
+         + a[90] * x[6] + a[91] * x[7] + a[92] * x[8] + a[93] * x[9] + a[94] * x[10] + a[95] * x[11];
+    y[8] = a[96] * x[0] + a[97] * x[1] + a[98] * x[2] + a[99] * x[3] + a[100] * x[4] + a[101] * x[5]
+         + a[102] * x[6] + a[103] * x[7] + a[104] * x[8] + a[105] * x[9] + a[106] * x[10] + a[107] * x[11];
+    y[9] = a[108] * x[0] + a[109] * x[1] + a[110] * x[2] + a[111] * x[3] + a[112] * x[4] + a[113] * x[5]
+         + a[114] * x[6] + a[115] * x[7] + a[116] * x[8] + a[117] * x[9] + a[118] * x[10] + a[119] * x[11];
+    y[10] = a[120] * x[0] + a[121] * x[1] + a[122] * x[2] + a[123] * x[3] + a[124] * x[4] + a[125] * x[5]
+          + a[126] * x[6] + a[127] * x[7] + a[128] * x[8] + a[129] * x[9] + a[130] * x[10] + a[131] * x[11];
+    y[11] = a[132] * x[0] + a[133] * x[1] + a[134] * x[2] + a[135] * x[3] + a[136] * x[4] + a[137] * x[5]
+          + a[138] * x[6] + a[139] * x[7] + a[140] * x[8] + a[141] * x[9] + a[142] * x[10] + a[143] * x[11];
+}
+
+
+boolean Ifx_MatF32_cholesky12(float32 *l, const float32 *a)
+{
+    float32 inv[12];
+    float32 pivot;
+    boolean ok = TRUE;
+
+    pivot = a[0];
+    ok &= (boolean)(pivot > 0.0f);
+    l[0] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[0] = 1.0f / l[0];
+    l[12] = a[12] * inv[0];
+    l[24] = a[24] * inv[0];
+    l[36] = a[36] * inv[0];
+    l[48] = a[48] * inv[0];
+    l[60] = a[60] * inv[0];
+    l[72] = a[72] * inv[0];
+    l[84] = a[84] * inv[0];
+    l[96] = a[96] * inv[0];
+    l[108] = a[108] * inv[0];
+    l[120] = a[120] * inv[0];
+    l[132] = a[132] * inv[0];
+    pivot = a[13] - (l[12] * l[12]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[13] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[1] = 1.0f / l[13];
+    l[25] = (a[25] - (l[24] * l[12])) * inv[1];
+    l[37] = (a[37] - (l[36] * l[12])) * inv[1];
+    l[49] = (a[49] - (l[48] * l[12])) * inv[1];
+    l[61] = (a[61] - (l[60] * l[12])) * inv[1];
+    l[73] = (a[73] - (l[72] * l[12])) * inv[1];
+    l[85] = (a[85] - (l[84] * l[12])) * inv[1];
+    l[97] = (a[97] - (l[96] * l[12])) * inv[1];
+    l[109] = (a[109] - (l[108] * l[12])) * inv[1];
+    l[121] = (a[121] - (l[120] * l[12])) * inv[1];
+    l[133] = (a[133] - (l[132] * l[12])) * inv[1];
+    pivot = a[26] - (l[24] * l[24] + l[25] * l[25]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[26] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[2] = 1.0f / l[26];
+    l[38] = (a[38] - (l[36] * l[24] + l[37] * l[25])) * inv[2];
+    l[50] = (a[50] - (l[48] * l[24] + l[49] * l[25])) * inv[2];
+    l[62] = (a[62] - (l[60] * l[24] + l[61] * l[25])) * inv[2];
+    l[74] = (a[74] - (l[72] * l[24] + l[73] * l[25])) * inv[2];
+    l[86] = (a[86] - (l[84] * l[24] + l[85] * l[25])) * inv[2];
+    l[98] = (a[98] - (l[96] * l[24] + l[97] * l[25])) * inv[2];
+    l[110] = (a[110] - (l[108] * l[24] + l[109] * l[25])) * inv[2];
+    l[122] = (a[122] - (l[120] * l[24] + l[121] * l[25])) * inv[2];
+    l[134] = (a[134] - (l[132] * l[24] + l[133] * l[25])) * inv[2];
+    pivot = a[39] - (l[36] * l[36] + l[37] * l[37] + l[38] * l[38]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[39] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[3] = 1.0f / l[39];
+    l[51] = (a[51] - (l[48] * l[36] + l[49] * l[37] + l[50] * l[38])) * inv[3];
+    l[63] = (a[63] - (l[60] * l[36] + l[61] * l[37] + l[62] * l[38])) * inv[3];
+    l[75] = (a[75] - (l[72] * l[36] + l[73] * l[37] + l[74] * l[38])) * inv[3];
+    l[87] = (a[87] - (l[84] * l[36] + l[85] * l[37] + l[86] * l[38])) * inv[3];
+    l[99] = (a[99] - (l[96] * l[36] + l[97] * l[37] + l[98] * l[38])) * inv[3];
+    l[111] = (a[111] - (l[108] * l[36] + l[109] * l[37] + l[110] * l[38])) * inv[3];
+    l[123] = (a[123] - (l[120] * l[36] + l[121] * l[37] + l[122] * l[38])) * inv[3];
+    l[135] = (a[135] - (l[132] * l[36] + l[133] * l[37] + l[134] * l[38])) * inv[3];
+    pivot = a[52] - (l[48] * l[48] + l[49] * l[49] + l[50] * l[50] + l[51] * l[51]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[52] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[4] = 1.0f / l[52];
+    l[64] = (a[64] - (l[60] * l[48] + l[61] * l[49] + l[62] * l[50] + l[63] * l[51])) * inv[4];
+    l[76] = (a[76] - (l[72] * l[48] + l[73] * l[49] + l[74] * l[50] + l[75] * l[51])) * inv[4];
+    l[88] = (a[88] - (l[84] * l[48] + l[85] * l[49] + l[86] * l[50] + l[87] * l[51])) * inv[4];
+    l[100] = (a[100] - (l[96] * l[48] + l[97] * l[49] + l[98] * l[50] + l[99] * l[51])) * inv[4];
+    l[112] = (a[112] - (l[108] * l[48] + l[109] * l[49] + l[110] * l[50] + l[111] * l[51])) * inv[4];
+    l[124] = (a[124] - (l[120] * l[48] + l[121] * l[49] + l[122] * l[50] + l[123] * l[51])) * inv[4];
+    l[136] = (a[136] - (l[132] * l[48] + l[133] * l[49] + l[134] * l[50] + l[135] * l[51])) * inv[4];
+    pivot = a[65] - (l[60] * l[60] + l[61] * l[61] + l[62] * l[62] + l[63] * l[63] + l[64] * l[64]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[65] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[5] = 1.0f / l[65];
+    l[77] = (a[77] - (l[72] * l[60] + l[73] * l[61] + l[74] * l[62] + l[75] * l[63] + l[76] * l[64])) * inv[5];
+    l[89] = (a[89] - (l[84] * l[60] + l[85] * l[61] + l[86] * l[62] + l[87] * l[63] + l[88] * l[64])) * inv[5];
+    l[101] = (a[101] - (l[96] * l[60] + l[97] * l[61] + l[98] * l[62] + l[99] * l[63] + l[100] * l[64])) * inv[5];
+    l[113] = (a[113] - (l[108] * l[60] + l[109] * l[61] + l[110] * l[62] + l[111] * l[63] + l[112] * l[64])) * inv[5];
+    l[125] = (a[125] - (l[120] * l[60] + l[121] * l[61] + l[122] * l[62] + l[123] * l[63] + l[124] * l[64])) * inv[5];
+    l[137] = (a[137] - (l[132] * l[60] + l[133] * l[61] + l[134] * l[62] + l[135] * l[63] + l[136] * l[64])) * inv[5];
+    pivot = a[78] - (l[72] * l[72] + l[73] * l[73] + l[74] * l[74] + l[75] * l[75] + l[76] * l[76]
+                   + l[77] * l[77]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[78] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[6] = 1.0f / l[78];
+    l[90] = (a[90] - (l[84] * l[72] + l[85] * l[73] + l[86] * l[74] + l[87] * l[75] + l[88] * l[76]
+                    + l[89] * l[77])) * inv[6];
+    l[102] = (a[102] - (l[96] * l[72] + l[97] * l[73] + l[98] * l[74] + l[99] * l[75] + l[100] * l[76]
+                      + l[101] * l[77])) * inv[6];
+    l[114] = (a[114] - (l[108] * l[72] + l[109] * l[73] + l[110] * l[74] + l[111] * l[75] + l[112] * l[76]
+                      + l[113] * l[77])) * inv[6];
+    l[126] = (a[126] - (l[120] * l[72] + l[121] * l[73] + l[122] * l[74] + l[123] * l[75] + l[124] * l[76]
+                      + l[125] * l[77])) * inv[6];
+    l[138] = (a[138] - (l[132] * l[72] + l[133] * l[73] + l[134] * l[74] + l[135] * l[75] + l[136] * l[76]
+                      + l[137] * l[77])) * inv[6];
+    pivot = a[91] - (l[84] * l[84] + l[85] * l[85] + l[86] * l[86] + l[87] * l[87] + l[88] * l[88]
+                   + l[89] * l[89] + l[90] * l[90]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[91] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[7] = 1.0f / l[91];
+    l[103] = (a[103] - (l[96] * l[84] + l[97] * l[85] + l[98] * l[86] + l[99] * l[87] + l[100] * l[88]
+                      + l[101] * l[89] + l[102] * l[90])) * inv[7];
+    l[115] = (a[115] - (l[108] * l[84] + l[109] * l[85] + l[110] * l[86] + l[111] * l[87] + l[112] * l[88]
+                      + l[113] * l[89] + l[114] * l[90])) * inv[7];
+    l[127] = (a[127] - (l[120] * l[84] + l[121] * l[85] + l[122] * l[86] + l[123] * l[87] + l[124] * l[88]
+                      + l[125] * l[89] + l[126] * l[90])) * inv[7];
+    l[139] = (a[139] - (l[132] * l[84] + l[133] * l[85] + l[134] * l[86] + l[135] * l[87] + l[136] * l[88]
+                      + l[137] * l[89] + l[138] * l[90])) * inv[7];
+    pivot = a[104] - (l[96] * l[96] + l[97] * l[97] + l[98] * l[98] + l[99] * l[99] + l[100] * l[100]
+                    + l[101] * l[101] + l[102] * l[102] + l[103] * l[103]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[104] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[8] = 1.0f / l[104];
+    l[116] = (a[116] - (l[108] * l[96] + l[109] * l[97] + l[110] * l[98] + l[111] * l[99] + l[112] * l[100]
+                      + l[113] * l[101] + l[114] * l[102] + l[115] * l[103])) * inv[8];
+    l[128] = (a[128] - (l[120] * l[96] + l[121] * l[97] + l[122] * l[98] + l[123] * l[99] + l[124] * l[100]
+                      + l[125] * l[101] + l[126] * l[102] + l[127] * l[103])) * inv[8];
+    l[140] = (a[140] - (l[132] * l[96] + l[133] * l[97] + l[134] * l[98] + l[135] * l[99] + l[136] * l[100]
+                      + l[137] * l[101] + l[138] * l[102] + l[139] * l[103])) * inv[8];
+    pivot = a[117] - (l[108] * l[108] + l[109] * l[109] + l[110] * l[110] + l[111] * l[111] + l[112] * l[112]
+                    + l[113] * l[113] + l[114] * l[114] + l[115] * l[115] + l[116] * l[116]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[117] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[9] = 1.0f / l[117];
+    l[129] = (a[129] - (l[120] * l[108] + l[121] * l[109] + l[122] * l[110] + l[123] * l[111]
+                      + l[124] * l[112] + l[125] * l[113] + l[126] * l[114] + l[127] * l[115]
+                      + l[128] * l[116])) * inv[9];
+    l[141] = (a[141] - (l[132] * l[108] + l[133] * l[109] + l[134] * l[110] + l[135] * l[111]
+                      + l[136] * l[112] + l[137] * l[113] + l[138] * l[114] + l[139] * l[115]
+                      + l[140] * l[116])) * inv[9];
+    pivot = a[130] - (l[120] * l[120] + l[121] * l[121] + l[122] * l[122] + l[123] * l[123] + l[124] * l[124]
+                    + l[125] * l[125] + l[126] * l[126] + l[127] * l[127] + l[128] * l[128] + l[129] * l[129]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[130] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[10] = 1.0f / l[130];
+    l[142] = (a[142] - (l[132] * l[120] + l[133] * l[121] + l[134] * l[122] + l[135] * l[123]
+                      + l[136] * l[124] + l[137] * l[125] + l[138] * l[126] + l[139] * l[127]
+                      + l[140] * l[128] + l[141] * l[129])) * inv[10];
+    pivot = a[143] - (l[132] * l[132] + l[133] * l[133] + l[134] * l[134] + l[135] * l[135] + l[136] * l[136]
+                    + l[137] * l[137] + l[138] * l[138] + l[139] * l[139] + l[140] * l[140] + l[141] * l[141]
+                    + l[142] * l[142]);
+    ok &= (boolean)(pivot > 0.0f);
+    l[143] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);
+    inv[11] = 1.0f / l[143];
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[40] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[44] = 0.0f;
+    l[45] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[53] = 0.0f;
+    l[54] = 0.0f;
+    l[55] = 0.0f;
+    l[56] = 0.0f;
+    l[57] = 0.0f;
+    l[58] = 0.0f;
+    l[59] = 0.0f;
+    l[66] = 0.0f;
+    l[67] = 0.0f;
+    l[68] = 0.0f;
+    l[69] = 0.0f;
+    l[70] = 0.0f;
+    l[71] = 0.0f;
+    l[79] = 0.0f;
+    l[80] = 0.0f;
+    l[81] = 0.0f;
+    l[82] = 0.0f;
+    l[83] = 0.0f;
+    l[92] = 0.0f;
+    l[93] = 0.0f;
+    l[94] = 0.0f;
+    l[95] = 0.0f;
+    l[105] = 0.0f;
+    l[106] = 0.0f;
+    l[107] = 0.0f;
+    l[118] = 0.0f;
+    l[119] = 0.0f;
+    l[131] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_choleskySolve12(float32 *x, const float32 *l, const float32 *b)
+{
+    x[0] = b[0] / l[0];
+    x[1] = (b[1] - (l[12] * x[0])) / l[13];
+    x[2] = (b[2] - (l[24] * x[0] + l[25] * x[1])) / l[26];
+    x[3] = (b[3] - (l[36] * x[0] + l[37] * x[1] + l[38] * x[2])) / l[39];
+    x[4] = (b[4] - (l[48] * x[0] + l[49] * x[1] + l[50] * x[2] + l[51] * x[3])) / l[52];
+    x[5] = (b[5] - (l[60] * x[0] + l[61] * x[1] + l[62] * x[2] + l[63] * x[3] + l[64] * x[4])) / l[65];
+    x[6] = (b[6] - (l[72] * x[0] + l[73] * x[1] + l[74] * x[2] + l[75] * x[3] + l[76] * x[4] + l[77] * x[5])) / l[78];
+    x[7] = (b[7] - (l[84] * x[0] + l[85] * x[1] + l[86] * x[2] + l[87] * x[3] + l[88] * x[4] + l[89] * x[5]
+                  + l[90] * x[6])) / l[91];
+    x[8] = (b[8] - (l[96] * x[0] + l[97] * x[1] + l[98] * x[2] + l[99] * x[3] + l[100] * x[4] + l[101] * x[5]
+                  + l[102] * x[6] + l[103] * x[7])) / l[104];
+    x[9] = (b[9] - (l[108] * x[0] + l[109] * x[1] + l[110] * x[2] + l[111] * x[3] + l[112] * x[4]
+                  + l[113] * x[5] + l[114] * x[6] + l[115] * x[7] + l[116] * x[8])) / l[117];
+    x[10] = (b[10] - (l[120] * x[0] + l[121] * x[1] + l[122] * x[2] + l[123] * x[3] + l[124] * x[4]
+                    + l[125] * x[5] + l[126] * x[6] + l[127] * x[7] + l[128] * x[8] + l[129] * x[9])) / l[130];
+    x[11] = (b[11] - (l[132] * x[0] + l[133] * x[1] + l[134] * x[2] + l[135] * x[3] + l[136] * x[4]
+                    + l[137] * x[5] + l[138] * x[6] + l[139] * x[7] + l[140] * x[8] + l[141] * x[9]
+                    + l[142] * x[10])) / l[143];
+    x[11] = x[11] / l[143];
+    x[10] = (x[10] - (l[142] * x[11])) / l[130];
+    x[9] = (x[9] - (l[129] * x[10] + l[141] * x[11])) / l[117];
+    x[8] = (x[8] - (l[116] * x[9] + l[128] * x[10] + l[140] * x[11])) / l[104];
+    x[7] = (x[7] - (l[103] * x[8] + l[115] * x[9] + l[127] * x[10] + l[139] * x[11])) / l[91];
+    x[6] = (x[6] - (l[90] * x[7] + l[102] * x[8] + l[114] * x[9] + l[126] * x[10] + l[138] * x[11])) / l[78];
+    x[5] = (x[5] - (l[77] * x[6] + l[89] * x[7] + l[101] * x[8] + l[113] * x[9] + l[125] * x[10]
+                  + l[137] * x[11])) / l[65];
+    x[4] = (x[4] - (l[64] * x[5] + l[76] * x[6] + l[88] * x[7] + l[100] * x[8] + l[112] * x[9]
+                  + l[124] * x[10] + l[136] * x[11])) / l[52];
+    x[3] = (x[3] - (l[51] * x[4] + l[63] * x[5] + l[75] * x[6] + l[87] * x[7] + l[99] * x[8] + l[111] * x[9]
+                  + l[123] * x[10] + l[135] * x[11])) / l[39];
+    x[2] = (x[2] - (l[38] * x[3] + l[50] * x[4] + l[62] * x[5] + l[74] * x[6] + l[86] * x[7] + l[98] * x[8]
+                  + l[110] * x[9] + l[122] * x[10] + l[134] * x[11])) / l[26];
+    x[1] = (x[1] - (l[25] * x[2] + l[37] * x[3] + l[49] * x[4] + l[61] * x[5] + l[73] * x[6] + l[85] * x[7]
+                  + l[97] * x[8] + l[109] * x[9] + l[121] * x[10] + l[133] * x[11])) / l[13];
+    x[0] = (x[0] - (l[12] * x[1] + l[24] * x[2] + l[36] * x[3] + l[48] * x[4] + l[60] * x[5] + l[72] * x[6]
+                  + l[84] * x[7] + l[96] * x[8] + l[108] * x[9] + l[120] * x[10] + l[132] * x[11])) / l[0];
+}
+
+
+boolean Ifx_MatF32_ldl12(float32 *l, float32 *d, const float32 *a)
+{
+    float32 v[12];
+    float32 inv;
+    boolean ok = TRUE;
+
+    d[0] = a[0];
+    ok  &= (boolean)(d[0] != 0.0f);
+    inv  = 1.0f / ((d[0] != 0.0f) ? d[0] : 1.0f);
+    l[12] = a[12] * inv;
+    l[24] = a[24] * inv;
+    l[36] = a[36] * inv;
+    l[48] = a[48] * inv;
+    l[60] = a[60] * inv;
+    l[72] = a[72] * inv;
+    l[84] = a[84] * inv;
+    l[96] = a[96] * inv;
+    l[108] = a[108] * inv;
+    l[120] = a[120] * inv;
+    l[132] = a[132] * inv;
+    l[0] = 1.0f;
+    v[0] = l[12] * d[0];
+    d[1] = a[13] - (l[12] * v[0]);
+    ok  &= (boolean)(d[1] != 0.0f);
+    inv  = 1.0f / ((d[1] != 0.0f) ? d[1] : 1.0f);
+    l[25] = (a[25] - (l[24] * v[0])) * inv;
+    l[37] = (a[37] - (l[36] * v[0])) * inv;
+    l[49] = (a[49] - (l[48] * v[0])) * inv;
+    l[61] = (a[61] - (l[60] * v[0])) * inv;
+    l[73] = (a[73] - (l[72] * v[0])) * inv;
+    l[85] = (a[85] - (l[84] * v[0])) * inv;
+    l[97] = (a[97] - (l[96] * v[0])) * inv;
+    l[109] = (a[109] - (l[108] * v[0])) * inv;
+    l[121] = (a[121] - (l[120] * v[0])) * inv;
+    l[133] = (a[133] - (l[132] * v[0])) * inv;
+    l[13] = 1.0f;
+    v[0] = l[24] * d[0];
+    v[1] = l[25] * d[1];
+    d[2] = a[26] - (l[24] * v[0] + l[25] * v[1]);
+    ok  &= (boolean)(d[2] != 0.0f);
+    inv  = 1.0f / ((d[2] != 0.0f) ? d[2] : 1.0f);
+    l[38] = (a[38] - (l[36] * v[0] + l[37] * v[1])) * inv;
+    l[50] = (a[50] - (l[48] * v[0] + l[49] * v[1])) * inv;
+    l[62] = (a[62] - (l[60] * v[0] + l[61] * v[1])) * inv;
+    l[74] = (a[74] - (l[72] * v[0] + l[73] * v[1])) * inv;
+    l[86] = (a[86] - (l[84] * v[0] + l[85] * v[1])) * inv;
+    l[98] = (a[98] - (l[96] * v[0] + l[97] * v[1])) * inv;
+    l[110] = (a[110] - (l[108] * v[0] + l[109] * v[1])) * inv;
+    l[122] = (a[122] - (l[120] * v[0] + l[121] * v[1])) * inv;
+    l[134] = (a[134] - (l[132] * v[0] + l[133] * v[1])) * inv;
+    l[26] = 1.0f;
+    v[0] = l[36] * d[0];
+    v[1] = l[37] * d[1];
+    v[2] = l[38] * d[2];
+    d[3] = a[39] - (l[36] * v[0] + l[37] * v[1] + l[38] * v[2]);
+    ok  &= (boolean)(d[3] != 0.0f);
+    inv  = 1.0f / ((d[3] != 0.0f) ? d[3] : 1.0f);
+    l[51] = (a[51] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2])) * inv;
+    l[63] = (a[63] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2])) * inv;
+    l[75] = (a[75] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2])) * inv;
+    l[87] = (a[87] - (l[84] * v[0] + l[85] * v[1] + l[86] * v[2])) * inv;
+    l[99] = (a[99] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2])) * inv;
+    l[111] = (a[111] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2])) * inv;
+    l[123] = (a[123] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2])) * inv;
+    l[135] = (a[135] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2])) * inv;
+    l[39] = 1.0f;
+    v[0] = l[48] * d[0];
+    v[1] = l[49] * d[1];
+    v[2] = l[50] * d[2];
+    v[3] = l[51] * d[3];
+    d[4] = a[52] - (l[48] * v[0] + l[49] * v[1] + l[50] * v[2] + l[51] * v[3]);
+    ok  &= (boolean)(d[4] != 0.0f);
+    inv  = 1.0f / ((d[4] != 0.0f) ? d[4] : 1.0f);
+    l[64] = (a[64] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2] + l[63] * v[3])) * inv;
+    l[76] = (a[76] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3])) * inv;
+    l[88] = (a[88] - (l[84] * v[0] + l[85] * v[1] + l[86] * v[2] + l[87] * v[3])) * inv;
+    l[100] = (a[100] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2] + l[99] * v[3])) * inv;
+    l[112] = (a[112] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3])) * inv;
+    l[124] = (a[124] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3])) * inv;
+    l[136] = (a[136] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3])) * inv;
+    l[52] = 1.0f;
+    v[0] = l[60] * d[0];
+    v[1] = l[61] * d[1];
+    v[2] = l[62] * d[2];
+    v[3] = l[63] * d[3];
+    v[4] = l[64] * d[4];
+    d[5] = a[65] - (l[60] * v[0] + l[61] * v[1] + l[62] * v[2] + l[63] * v[3] + l[64] * v[4]);
+    ok  &= (boolean)(d[5] != 0.0f);
+    inv  = 1.0f / ((d[5] != 0.0f) ? d[5] : 1.0f);
+    l[77] = (a[77] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4])) * inv;
+    l[89] = (a[89] - (l[84] * v[0] + l[85] * v[1] + l[86] * v[2] + l[87] * v[3] + l[88] * v[4])) * inv;
+    l[101] = (a[101] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2] + l[99] * v[3] + l[100] * v[4])) * inv;
+    l[113] = (a[113] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3] + l[112] * v[4])) * inv;
+    l[125] = (a[125] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4])) * inv;
+    l[137] = (a[137] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4])) * inv;
+    l[65] = 1.0f;
+    v[0] = l[72] * d[0];
+    v[1] = l[73] * d[1];
+    v[2] = l[74] * d[2];
+    v[3] = l[75] * d[3];
+    v[4] = l[76] * d[4];
+    v[5] = l[77] * d[5];
+    d[6] = a[78] - (l[72] * v[0] + l[73] * v[1] + l[74] * v[2] + l[75] * v[3] + l[76] * v[4] + l[77] * v[5]);
+    ok  &= (boolean)(d[6] != 0.0f);
+    inv  = 1.0f / ((d[6] != 0.0f) ? d[6] : 1.0f);
+    l[90] = (a[90] - (l[84] * v[0] + l[85] * v[1] + l[86] * v[2] + l[87] * v[3] + l[88] * v[4] + l[89] * v[5])) * inv;
+    l[102] = (a[102] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2] + l[99] * v[3] + l[100] * v[4]
+                      + l[101] * v[5])) * inv;
+    l[114] = (a[114] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3] + l[112] * v[4]
+                      + l[113] * v[5])) * inv;
+    l[126] = (a[126] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4]
+                      + l[125] * v[5])) * inv;
+    l[138] = (a[138] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                      + l[137] * v[5])) * inv;
+    l[78] = 1.0f;
+    v[0] = l[84] * d[0];
+    v[1] = l[85] * d[1];
+    v[2] = l[86] * d[2];
+    v[3] = l[87] * d[3];
+    v[4] = l[88] * d[4];
+    v[5] = l[89] * d[5];
+    v[6] = l[90] * d[6];
+    d[7] = a[91] - (l[84] * v[0] + l[85] * v[1] + l[86] * v[2] + l[87] * v[3] + l[88] * v[4] + l[89] * v[5]
+                  + l[90] * v[6]);
+    ok  &= (boolean)(d[7] != 0.0f);
+    inv  = 1.0f / ((d[7] != 0.0f) ? d[7] : 1.0f);
+    l[103] = (a[103] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2] + l[99] * v[3] + l[100] * v[4]
+                      + l[101] * v[5] + l[102] * v[6])) * inv;
+    l[115] = (a[115] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3] + l[112] * v[4]
+                      + l[113] * v[5] + l[114] * v[6])) * inv;
+    l[127] = (a[127] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4]
+                      + l[125] * v[5] + l[126] * v[6])) * inv;
+    l[139] = (a[139] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                      + l[137] * v[5] + l[138] * v[6])) * inv;
+    l[91] = 1.0f;
+    v[0] = l[96] * d[0];
+    v[1] = l[97] * d[1];
+    v[2] = l[98] * d[2];
+    v[3] = l[99] * d[3];
+    v[4] = l[100] * d[4];
+    v[5] = l[101] * d[5];
+    v[6] = l[102] * d[6];
+    v[7] = l[103] * d[7];
+    d[8] = a[104] - (l[96] * v[0] + l[97] * v[1] + l[98] * v[2] + l[99] * v[3] + l[100] * v[4] + l[101] * v[5]
+                   + l[102] * v[6] + l[103] * v[7]);
+    ok  &= (boolean)(d[8] != 0.0f);
+    inv  = 1.0f / ((d[8] != 0.0f) ? d[8] : 1.0f);
+    l[116] = (a[116] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3] + l[112] * v[4]
+                      + l[113] * v[5] + l[114] * v[6] + l[115] * v[7])) * inv;
+    l[128] = (a[128] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4]
+                      + l[125] * v[5] + l[126] * v[6] + l[127] * v[7])) * inv;
+    l[140] = (a[140] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                      + l[137] * v[5] + l[138] * v[6] + l[139] * v[7])) * inv;
+    l[104] = 1.0f;
+    v[0] = l[108] * d[0];
+    v[1] = l[109] * d[1];
+    v[2] = l[110] * d[2];
+    v[3] = l[111] * d[3];
+    v[4] = l[112] * d[4];
+    v[5] = l[113] * d[5];
+    v[6] = l[114] * d[6];
+    v[7] = l[115] * d[7];
+    v[8] = l[116] * d[8];
+    d[9] = a[117] - (l[108] * v[0] + l[109] * v[1] + l[110] * v[2] + l[111] * v[3] + l[112] * v[4]
+                   + l[113] * v[5] + l[114] * v[6] + l[115] * v[7] + l[116] * v[8]);
+    ok  &= (boolean)(d[9] != 0.0f);
+    inv  = 1.0f / ((d[9] != 0.0f) ? d[9] : 1.0f);
+    l[129] = (a[129] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4]
+                      + l[125] * v[5] + l[126] * v[6] + l[127] * v[7] + l[128] * v[8])) * inv;
+    l[141] = (a[141] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                      + l[137] * v[5] + l[138] * v[6] + l[139] * v[7] + l[140] * v[8])) * inv;
+    l[117] = 1.0f;
+    v[0] = l[120] * d[0];
+    v[1] = l[121] * d[1];
+    v[2] = l[122] * d[2];
+    v[3] = l[123] * d[3];
+    v[4] = l[124] * d[4];
+    v[5] = l[125] * d[5];
+    v[6] = l[126] * d[6];
+    v[7] = l[127] * d[7];
+    v[8] = l[128] * d[8];
+    v[9] = l[129] * d[9];
+    d[10] = a[130] - (l[120] * v[0] + l[121] * v[1] + l[122] * v[2] + l[123] * v[3] + l[124] * v[4]
+                    + l[125] * v[5] + l[126] * v[6] + l[127] * v[7] + l[128] * v[8] + l[129] * v[9]);
+    ok  &= (boolean)(d[10] != 0.0f);
+    inv  = 1.0f / ((d[10] != 0.0f) ? d[10] : 1.0f);
+    l[142] = (a[142] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                      + l[137] * v[5] + l[138] * v[6] + l[139] * v[7] + l[140] * v[8] + l[141] * v[9])) * inv;
+    l[130] = 1.0f;
+    v[0] = l[132] * d[0];
+    v[1] = l[133] * d[1];
+    v[2] = l[134] * d[2];
+    v[3] = l[135] * d[3];
+    v[4] = l[136] * d[4];
+    v[5] = l[137] * d[5];
+    v[6] = l[138] * d[6];
+    v[7] = l[139] * d[7];
+    v[8] = l[140] * d[8];
+    v[9] = l[141] * d[9];
+    v[10] = l[142] * d[10];
+    d[11] = a[143] - (l[132] * v[0] + l[133] * v[1] + l[134] * v[2] + l[135] * v[3] + l[136] * v[4]
+                    + l[137] * v[5] + l[138] * v[6] + l[139] * v[7] + l[140] * v[8] + l[141] * v[9]
+                    + l[142] * v[10]);
+    ok  &= (boolean)(d[11] != 0.0f);
+    inv  = 1.0f / ((d[11] != 0.0f) ? d[11] : 1.0f);
+    l[143] = 1.0f;
+    l[1] = 0.0f;
+    l[2] = 0.0f;
+    l[3] = 0.0f;
+    l[4] = 0.0f;
+    l[5] = 0.0f;
+    l[6] = 0.0f;
+    l[7] = 0.0f;
+    l[8] = 0.0f;
+    l[9] = 0.0f;
+    l[10] = 0.0f;
+    l[11] = 0.0f;
+    l[14] = 0.0f;
+    l[15] = 0.0f;
+    l[16] = 0.0f;
+    l[17] = 0.0f;
+    l[18] = 0.0f;
+    l[19] = 0.0f;
+    l[20] = 0.0f;
+    l[21] = 0.0f;
+    l[22] = 0.0f;
+    l[23] = 0.0f;
+    l[27] = 0.0f;
+    l[28] = 0.0f;
+    l[29] = 0.0f;
+    l[30] = 0.0f;
+    l[31] = 0.0f;
+    l[32] = 0.0f;
+    l[33] = 0.0f;
+    l[34] = 0.0f;
+    l[35] = 0.0f;
+    l[40] = 0.0f;
+    l[41] = 0.0f;
+    l[42] = 0.0f;
+    l[43] = 0.0f;
+    l[44] = 0.0f;
+    l[45] = 0.0f;
+    l[46] = 0.0f;
+    l[47] = 0.0f;
+    l[53] = 0.0f;
+    l[54] = 0.0f;
+    l[55] = 0.0f;
+    l[56] = 0.0f;
+    l[57] = 0.0f;
+    l[58] = 0.0f;
+    l[59] = 0.0f;
+    l[66] = 0.0f;
+    l[67] = 0.0f;
+    l[68] = 0.0f;
+    l[69] = 0.0f;
+    l[70] = 0.0f;
+    l[71] = 0.0f;
+    l[79] = 0.0f;
+    l[80] = 0.0f;
+    l[81] = 0.0f;
+    l[82] = 0.0f;
+    l[83] = 0.0f;
+    l[92] = 0.0f;
+    l[93] = 0.0f;
+    l[94] = 0.0f;
+    l[95] = 0.0f;
+    l[105] = 0.0f;
+    l[106] = 0.0f;
+    l[107] = 0.0f;
+    l[118] = 0.0f;
+    l[119] = 0.0f;
+    l[131] = 0.0f;
+
+    return ok;
+}
+
+
+void Ifx_MatF32_ldlSolve12(float32 *x, const float32 *l, const float32 *d, const float32 *b)
+{
+    x[0] = b[0];
+    x[1] = b[1] - (l[12] * x[0]);
+    x[2] = b[2] - (l[24] * x[0] + l[25] * x[1]);
+    x[3] = b[3] - (l[36] * x[0] + l[37] * x[1] + l[38] * x[2]);
+    x[4] = b[4] - (l[48] * x[0] + l[49] * x[1] + l[50] * x[2] + l[51] * x[3]);
+    x[5] = b[5] - (l[60] * x[0] + l[61] * x[1] + l[62] * x[2] + l[63] * x[3] + l[64] * x[4]);
+    x[6] = b[6] - (l[72] * x[0] + l[73] * x[1] + l[74] * x[2] + l[75] * x[3] + l[76] * x[4] + l[77] * x[5]);
+    x[7] = b[7] - (l[84] * x[0] + l[85] * x[1] + l[86] * x[2] + l[87] * x[3] + l[88] * x[4] + l[89] * x[5]
+                 + l[90] * x[6]);
+    x[8] = b[8] - (l[96] * x[0] + l[97] * x[1] + l[98] * x[2] + l[99] * x[3] + l[100] * x[4] + l[101] * x[5]
+                 + l[102] * x[6] + l[103] * x[7]);
+    x[9] = b[9] - (l[108] * x[0] + l[109] * x[1] + l[110] * x[2] + l[111] * x[3] + l[112] * x[4]
+                 + l[113] * x[5] + l[114] * x[6] + l[115] * x[7] + l[116] * x[8]);
+    x[10] = b[10] - (l[120] * x[0] + l[121] * x[1] + l[122] * x[2] + l[123] * x[3] + l[124] * x[4]
+                   + l[125] * x[5] + l[126] * x[6] + l[127] * x[7] + l[128] * x[8] + l[129] * x[9]);
+    x[11] = b[11] - (l[132] * x[0] + l[133] * x[1] + l[134] * x[2] + l[135] * x[3] + l[136] * x[4]
+                   + l[137] * x[5] + l[138] * x[6] + l[139] * x[7] + l[140] * x[8] + l[141] * x[9]
+                   + l[142] * x[10]);
+    x[0] = x[0] / d[0];
+    x[1] = x[1] / d[1];
+    x[2] = x[2] / d[2];
+    x[3] = x[3] / d[3];
+    x[4] = x[4] / d[4];
+    x[5] = x[5] / d[5];
+    x[6] = x[6] / d[6];
+    x[7] = x[7] / d[7];
+    x[8] = x[8] / d[8];
+    x[9] = x[9] / d[9];
+    x[10] = x[10] / d[10];
+    x[11] = x[11] / d[11];
+    x[10] = x[10] - (l[142] * x[11]);
+    x[9] = x[9] - (l[129] * x[10] + l[141] * x[11]);
+    x[8] = x[8] - (l[116] * x[9] + l[128] * x[10] + l[140] * x[11]);
+    x[7] = x[7] - (l[103] * x[8] + l[115] * x[9] + l[127] * x[10] + l[139] * x[11]);
+    x[6] = x[6] - (l[90] * x[7] + l[102] * x[8] + l[114] * x[9] + l[126] * x[10] + l[138] * x[11]);
+    x[5] = x[5] - (l[77] * x[6] + l[89] * x[7] + l[101] * x[8] + l[113] * x[9] + l[125] * x[10]
+                 + l[137] * x[11]);
+    x[4] = x[4] - (l[64] * x[5] + l[76] * x[6] + l[88] * x[7] + l[100] * x[8] + l[112] * x[9] + l[124] * x[10]
+                 + l[136] * x[11]);
+    x[3] = x[3] - (l[51] * x[4] + l[63] * x[5] + l[75] * x[6] + l[87] * x[7] + l[99] * x[8] + l[111] * x[9]
+                 + l[123] * x[10] + l[135] * x[11]);
+    x[2] = x[2] - (l[38] * x[3] + l[50] * x[4] + l[62] * x[5] + l[74] * x[6] + l[86] * x[7] + l[98] * x[8]
+                 + l[110] * x[9] + l[122] * x[10] + l[134] * x[11]);
+    x[1] = x[1] - (l[25] * x[2] + l[37] * x[3] + l[49] * x[4] + l[61] * x[5] + l[73] * x[6] + l[85] * x[7]
+                 + l[97] * x[8] + l[109] * x[9] + l[121] * x[10] + l[133] * x[11]);
+    x[0] = x[0] - (l[12] * x[1] + l[24] * x[2] + l[36] * x[3] + l[48] * x[4] + l[60] * x[5] + l[72] * x[6]
+                 + l[84] * x[7] + l[96] * x[8] + l[108] * x[9] + l[120] * x[10] + l[132] * x[11]);
+}
@@ -0,0 +1,212 @@
+/**
+ * \file Ifx_MatF32.h
+ * \brief Fixed-size float32 matrices
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_mat Fixed-size matrices
+ * This module holds the operations on n x n float32 matrices for n = 2 to 12,
+ * one function per operation and size, named after the size, e.g.
+ * Ifx_MatF32_mul6(). Every function is written out with constant indices,
+ * without loops.
+ *
+ * A matrix is an array of n * n float32 in row-major order, element (i, j)
+ * at index i * n + j; a vector is an array of n float32. The result must
+ * not overlap an operand, except where stated.
+ *
+ * - Ifx_MatF32_addN(): c = a + b, c may be a or b
+ * - Ifx_MatF32_transposeN(): c = a'
+ * - Ifx_MatF32_mulN(): c = a * b
+ * - Ifx_MatF32_mulVecN(): y = a * x
+ * - Ifx_MatF32_choleskyN(): lower l with l * l' = a, of a symmetric positive
+ *   definite a of which only the lower triangle is read; l may be a. Returns
+ *   FALSE if a is not positive definite, l is then not valid.
+ * - Ifx_MatF32_choleskySolveN(): x with l * l' * x = b; x may be b.
+ * - Ifx_MatF32_ldlN(): unit lower l and diagonal d with l * diag(d) * l' = a,
+ *   of a symmetric a of which only the lower triangle is read, without square
+ *   roots; l may be a. Returns FALSE on a zero pivot.
+ * - Ifx_MatF32_ldlSolveN(): x with l * diag(d) * l' * x = b; x may be b.
+ *
+ * See Ifx_KalmanF32.h for the filters built on them, and tools/mat_check for
+ * the host checks against a reference implementation.
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ */
+
+#ifndef IFX_MATF32_H
+#define IFX_MATF32_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+
+/** \addtogroup library_srvsw_sysse_math_f32_mat
+ * \{ */
+
+/** \name 2 x 2
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add2(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose2(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul2(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec2(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky2(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve2(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl2(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve2(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 3 x 3
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add3(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose3(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul3(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec3(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky3(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve3(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl3(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve3(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 4 x 4
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add4(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose4(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul4(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec4(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky4(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve4(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl4(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve4(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 5 x 5
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add5(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose5(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul5(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec5(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky5(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve5(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl5(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve5(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 6 x 6
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add6(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose6(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul6(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec6(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky6(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve6(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl6(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve6(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 7 x 7
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add7(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose7(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul7(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec7(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky7(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve7(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl7(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve7(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 8 x 8
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add8(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose8(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul8(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec8(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky8(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve8(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl8(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve8(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 9 x 9
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add9(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose9(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul9(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec9(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky9(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve9(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl9(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve9(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 10 x 10
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add10(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose10(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul10(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec10(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky10(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve10(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl10(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve10(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 11 x 11
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add11(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose11(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul11(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec11(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky11(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve11(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl11(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve11(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \name 12 x 12
+ * \{ */
+IFX_EXTERN void    Ifx_MatF32_add12(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_transpose12(float32 *c, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_mul12(float32 *c, const float32 *a, const float32 *b);
+IFX_EXTERN void    Ifx_MatF32_mulVec12(float32 *y, const float32 *a, const float32 *x);
+IFX_EXTERN boolean Ifx_MatF32_cholesky12(float32 *l, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_choleskySolve12(float32 *x, const float32 *l, const float32 *b);
+IFX_EXTERN boolean Ifx_MatF32_ldl12(float32 *l, float32 *d, const float32 *a);
+IFX_EXTERN void    Ifx_MatF32_ldlSolve12(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+/** \} */
+
+/** \} */
+
+#endif /* IFX_MATF32_H */
@@ -0,0 +1,4779 @@
+/**
+ * \file Ifx_MatQ31.c
+ * \brief Fixed-size Q31 matrices
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "Ifx_MatQ31.h"
+
+
+void Ifx_MatQ31_add2(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+}
+
+
+void Ifx_MatQ31_transpose2(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[2];
+    c[2] = a[1];
+    c[3] = a[3];
+}
+
+
+void Ifx_MatQ31_mul2(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[2]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[3]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[2], b[0]) + IFX_MATQ31_Q58(a[3], b[2]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[2], b[1]) + IFX_MATQ31_Q58(a[3], b[3]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec2(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[2], x[0]) + IFX_MATQ31_Q58(a[3], x[1]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add3(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+}
+
+
+void Ifx_MatQ31_transpose3(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[3];
+    c[2] = a[6];
+    c[3] = a[1];
+    c[4] = a[4];
+    c[5] = a[7];
+    c[6] = a[2];
+    c[7] = a[5];
+    c[8] = a[8];
+}
+
+
+void Ifx_MatQ31_mul3(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[3]) + IFX_MATQ31_Q58(a[2], b[6]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[4]) + IFX_MATQ31_Q58(a[2], b[7]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[5]) + IFX_MATQ31_Q58(a[2], b[8]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[3], b[0]) + IFX_MATQ31_Q58(a[4], b[3]) + IFX_MATQ31_Q58(a[5], b[6]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[3], b[1]) + IFX_MATQ31_Q58(a[4], b[4]) + IFX_MATQ31_Q58(a[5], b[7]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[3], b[2]) + IFX_MATQ31_Q58(a[4], b[5]) + IFX_MATQ31_Q58(a[5], b[8]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[0]) + IFX_MATQ31_Q58(a[7], b[3]) + IFX_MATQ31_Q58(a[8], b[6]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[1]) + IFX_MATQ31_Q58(a[7], b[4]) + IFX_MATQ31_Q58(a[8], b[7]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[2]) + IFX_MATQ31_Q58(a[7], b[5]) + IFX_MATQ31_Q58(a[8], b[8]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec3(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[3], x[0]) + IFX_MATQ31_Q58(a[4], x[1]) + IFX_MATQ31_Q58(a[5], x[2]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], x[0]) + IFX_MATQ31_Q58(a[7], x[1]) + IFX_MATQ31_Q58(a[8], x[2]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add4(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+}
+
+
+void Ifx_MatQ31_transpose4(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[4];
+    c[2] = a[8];
+    c[3] = a[12];
+    c[4] = a[1];
+    c[5] = a[5];
+    c[6] = a[9];
+    c[7] = a[13];
+    c[8] = a[2];
+    c[9] = a[6];
+    c[10] = a[10];
+    c[11] = a[14];
+    c[12] = a[3];
+    c[13] = a[7];
+    c[14] = a[11];
+    c[15] = a[15];
+}
+
+
+void Ifx_MatQ31_mul4(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[4]) + IFX_MATQ31_Q58(a[2], b[8])
+        + IFX_MATQ31_Q58(a[3], b[12]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[5]) + IFX_MATQ31_Q58(a[2], b[9])
+        + IFX_MATQ31_Q58(a[3], b[13]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[6]) + IFX_MATQ31_Q58(a[2], b[10])
+        + IFX_MATQ31_Q58(a[3], b[14]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[7]) + IFX_MATQ31_Q58(a[2], b[11])
+        + IFX_MATQ31_Q58(a[3], b[15]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[4], b[0]) + IFX_MATQ31_Q58(a[5], b[4]) + IFX_MATQ31_Q58(a[6], b[8])
+        + IFX_MATQ31_Q58(a[7], b[12]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[4], b[1]) + IFX_MATQ31_Q58(a[5], b[5]) + IFX_MATQ31_Q58(a[6], b[9])
+        + IFX_MATQ31_Q58(a[7], b[13]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[4], b[2]) + IFX_MATQ31_Q58(a[5], b[6]) + IFX_MATQ31_Q58(a[6], b[10])
+        + IFX_MATQ31_Q58(a[7], b[14]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[4], b[3]) + IFX_MATQ31_Q58(a[5], b[7]) + IFX_MATQ31_Q58(a[6], b[11])
+        + IFX_MATQ31_Q58(a[7], b[15]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[0]) + IFX_MATQ31_Q58(a[9], b[4]) + IFX_MATQ31_Q58(a[10], b[8])
+        + IFX_MATQ31_Q58(a[11], b[12]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[1]) + IFX_MATQ31_Q58(a[9], b[5]) + IFX_MATQ31_Q58(a[10], b[9])
+        + IFX_MATQ31_Q58(a[11], b[13]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[2]) + IFX_MATQ31_Q58(a[9], b[6]) + IFX_MATQ31_Q58(a[10], b[10])
+        + IFX_MATQ31_Q58(a[11], b[14]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[3]) + IFX_MATQ31_Q58(a[9], b[7]) + IFX_MATQ31_Q58(a[10], b[11])
+        + IFX_MATQ31_Q58(a[11], b[15]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[0]) + IFX_MATQ31_Q58(a[13], b[4]) + IFX_MATQ31_Q58(a[14], b[8])
+        + IFX_MATQ31_Q58(a[15], b[12]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[1]) + IFX_MATQ31_Q58(a[13], b[5]) + IFX_MATQ31_Q58(a[14], b[9])
+        + IFX_MATQ31_Q58(a[15], b[13]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[2]) + IFX_MATQ31_Q58(a[13], b[6]) + IFX_MATQ31_Q58(a[14], b[10])
+        + IFX_MATQ31_Q58(a[15], b[14]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[3]) + IFX_MATQ31_Q58(a[13], b[7]) + IFX_MATQ31_Q58(a[14], b[11])
+        + IFX_MATQ31_Q58(a[15], b[15]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec4(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[4], x[0]) + IFX_MATQ31_Q58(a[5], x[1]) + IFX_MATQ31_Q58(a[6], x[2])
+        + IFX_MATQ31_Q58(a[7], x[3]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], x[0]) + IFX_MATQ31_Q58(a[9], x[1]) + IFX_MATQ31_Q58(a[10], x[2])
+        + IFX_MATQ31_Q58(a[11], x[3]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], x[0]) + IFX_MATQ31_Q58(a[13], x[1]) + IFX_MATQ31_Q58(a[14], x[2])
+        + IFX_MATQ31_Q58(a[15], x[3]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add5(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+}
+
+
+void Ifx_MatQ31_transpose5(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[5];
+    c[2] = a[10];
+    c[3] = a[15];
+    c[4] = a[20];
+    c[5] = a[1];
+    c[6] = a[6];
+    c[7] = a[11];
+    c[8] = a[16];
+    c[9] = a[21];
+    c[10] = a[2];
+    c[11] = a[7];
+    c[12] = a[12];
+    c[13] = a[17];
+    c[14] = a[22];
+    c[15] = a[3];
+    c[16] = a[8];
+    c[17] = a[13];
+    c[18] = a[18];
+    c[19] = a[23];
+    c[20] = a[4];
+    c[21] = a[9];
+    c[22] = a[14];
+    c[23] = a[19];
+    c[24] = a[24];
+}
+
+
+void Ifx_MatQ31_mul5(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[5]) + IFX_MATQ31_Q58(a[2], b[10])
+        + IFX_MATQ31_Q58(a[3], b[15]) + IFX_MATQ31_Q58(a[4], b[20]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[6]) + IFX_MATQ31_Q58(a[2], b[11])
+        + IFX_MATQ31_Q58(a[3], b[16]) + IFX_MATQ31_Q58(a[4], b[21]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[7]) + IFX_MATQ31_Q58(a[2], b[12])
+        + IFX_MATQ31_Q58(a[3], b[17]) + IFX_MATQ31_Q58(a[4], b[22]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[8]) + IFX_MATQ31_Q58(a[2], b[13])
+        + IFX_MATQ31_Q58(a[3], b[18]) + IFX_MATQ31_Q58(a[4], b[23]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[9]) + IFX_MATQ31_Q58(a[2], b[14])
+        + IFX_MATQ31_Q58(a[3], b[19]) + IFX_MATQ31_Q58(a[4], b[24]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], b[0]) + IFX_MATQ31_Q58(a[6], b[5]) + IFX_MATQ31_Q58(a[7], b[10])
+        + IFX_MATQ31_Q58(a[8], b[15]) + IFX_MATQ31_Q58(a[9], b[20]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], b[1]) + IFX_MATQ31_Q58(a[6], b[6]) + IFX_MATQ31_Q58(a[7], b[11])
+        + IFX_MATQ31_Q58(a[8], b[16]) + IFX_MATQ31_Q58(a[9], b[21]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], b[2]) + IFX_MATQ31_Q58(a[6], b[7]) + IFX_MATQ31_Q58(a[7], b[12])
+        + IFX_MATQ31_Q58(a[8], b[17]) + IFX_MATQ31_Q58(a[9], b[22]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], b[3]) + IFX_MATQ31_Q58(a[6], b[8]) + IFX_MATQ31_Q58(a[7], b[13])
+        + IFX_MATQ31_Q58(a[8], b[18]) + IFX_MATQ31_Q58(a[9], b[23]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], b[4]) + IFX_MATQ31_Q58(a[6], b[9]) + IFX_MATQ31_Q58(a[7], b[14])
+        + IFX_MATQ31_Q58(a[8], b[19]) + IFX_MATQ31_Q58(a[9], b[24]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[0]) + IFX_MATQ31_Q58(a[11], b[5]) + IFX_MATQ31_Q58(a[12], b[10])
+        + IFX_MATQ31_Q58(a[13], b[15]) + IFX_MATQ31_Q58(a[14], b[20]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[1]) + IFX_MATQ31_Q58(a[11], b[6]) + IFX_MATQ31_Q58(a[12], b[11])
+        + IFX_MATQ31_Q58(a[13], b[16]) + IFX_MATQ31_Q58(a[14], b[21]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[2]) + IFX_MATQ31_Q58(a[11], b[7]) + IFX_MATQ31_Q58(a[12], b[12])
+        + IFX_MATQ31_Q58(a[13], b[17]) + IFX_MATQ31_Q58(a[14], b[22]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[3]) + IFX_MATQ31_Q58(a[11], b[8]) + IFX_MATQ31_Q58(a[12], b[13])
+        + IFX_MATQ31_Q58(a[13], b[18]) + IFX_MATQ31_Q58(a[14], b[23]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[4]) + IFX_MATQ31_Q58(a[11], b[9]) + IFX_MATQ31_Q58(a[12], b[14])
+        + IFX_MATQ31_Q58(a[13], b[19]) + IFX_MATQ31_Q58(a[14], b[24]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], b[0]) + IFX_MATQ31_Q58(a[16], b[5]) + IFX_MATQ31_Q58(a[17], b[10])
+        + IFX_MATQ31_Q58(a[18], b[15]) + IFX_MATQ31_Q58(a[19], b[20]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], b[1]) + IFX_MATQ31_Q58(a[16], b[6]) + IFX_MATQ31_Q58(a[17], b[11])
+        + IFX_MATQ31_Q58(a[18], b[16]) + IFX_MATQ31_Q58(a[19], b[21]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], b[2]) + IFX_MATQ31_Q58(a[16], b[7]) + IFX_MATQ31_Q58(a[17], b[12])
+        + IFX_MATQ31_Q58(a[18], b[17]) + IFX_MATQ31_Q58(a[19], b[22]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], b[3]) + IFX_MATQ31_Q58(a[16], b[8]) + IFX_MATQ31_Q58(a[17], b[13])
+        + IFX_MATQ31_Q58(a[18], b[18]) + IFX_MATQ31_Q58(a[19], b[23]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], b[4]) + IFX_MATQ31_Q58(a[16], b[9]) + IFX_MATQ31_Q58(a[17], b[14])
+        + IFX_MATQ31_Q58(a[18], b[19]) + IFX_MATQ31_Q58(a[19], b[24]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[0]) + IFX_MATQ31_Q58(a[21], b[5]) + IFX_MATQ31_Q58(a[22], b[10])
+        + IFX_MATQ31_Q58(a[23], b[15]) + IFX_MATQ31_Q58(a[24], b[20]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[1]) + IFX_MATQ31_Q58(a[21], b[6]) + IFX_MATQ31_Q58(a[22], b[11])
+        + IFX_MATQ31_Q58(a[23], b[16]) + IFX_MATQ31_Q58(a[24], b[21]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[2]) + IFX_MATQ31_Q58(a[21], b[7]) + IFX_MATQ31_Q58(a[22], b[12])
+        + IFX_MATQ31_Q58(a[23], b[17]) + IFX_MATQ31_Q58(a[24], b[22]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[3]) + IFX_MATQ31_Q58(a[21], b[8]) + IFX_MATQ31_Q58(a[22], b[13])
+        + IFX_MATQ31_Q58(a[23], b[18]) + IFX_MATQ31_Q58(a[24], b[23]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[4]) + IFX_MATQ31_Q58(a[21], b[9]) + IFX_MATQ31_Q58(a[22], b[14])
+        + IFX_MATQ31_Q58(a[23], b[19]) + IFX_MATQ31_Q58(a[24], b[24]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec5(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[5], x[0]) + IFX_MATQ31_Q58(a[6], x[1]) + IFX_MATQ31_Q58(a[7], x[2])
+        + IFX_MATQ31_Q58(a[8], x[3]) + IFX_MATQ31_Q58(a[9], x[4]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], x[0]) + IFX_MATQ31_Q58(a[11], x[1]) + IFX_MATQ31_Q58(a[12], x[2])
+        + IFX_MATQ31_Q58(a[13], x[3]) + IFX_MATQ31_Q58(a[14], x[4]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[15], x[0]) + IFX_MATQ31_Q58(a[16], x[1]) + IFX_MATQ31_Q58(a[17], x[2])
+        + IFX_MATQ31_Q58(a[18], x[3]) + IFX_MATQ31_Q58(a[19], x[4]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], x[0]) + IFX_MATQ31_Q58(a[21], x[1]) + IFX_MATQ31_Q58(a[22], x[2])
+        + IFX_MATQ31_Q58(a[23], x[3]) + IFX_MATQ31_Q58(a[24], x[4]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add6(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+}
+
+
+void Ifx_MatQ31_transpose6(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[6];
+    c[2] = a[12];
+    c[3] = a[18];
+    c[4] = a[24];
+    c[5] = a[30];
+    c[6] = a[1];
+    c[7] = a[7];
+    c[8] = a[13];
+    c[9] = a[19];
+    c[10] = a[25];
+    c[11] = a[31];
+    c[12] = a[2];
+    c[13] = a[8];
+    c[14] = a[14];
+    c[15] = a[20];
+    c[16] = a[26];
+    c[17] = a[32];
+    c[18] = a[3];
+    c[19] = a[9];
+    c[20] = a[15];
+    c[21] = a[21];
+    c[22] = a[27];
+    c[23] = a[33];
+    c[24] = a[4];
+    c[25] = a[10];
+    c[26] = a[16];
+    c[27] = a[22];
+    c[28] = a[28];
+    c[29] = a[34];
+    c[30] = a[5];
+    c[31] = a[11];
+    c[32] = a[17];
+    c[33] = a[23];
+    c[34] = a[29];
+    c[35] = a[35];
+}
+
+
+void Ifx_MatQ31_mul6(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[6]) + IFX_MATQ31_Q58(a[2], b[12])
+        + IFX_MATQ31_Q58(a[3], b[18]) + IFX_MATQ31_Q58(a[4], b[24]) + IFX_MATQ31_Q58(a[5], b[30]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[7]) + IFX_MATQ31_Q58(a[2], b[13])
+        + IFX_MATQ31_Q58(a[3], b[19]) + IFX_MATQ31_Q58(a[4], b[25]) + IFX_MATQ31_Q58(a[5], b[31]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[8]) + IFX_MATQ31_Q58(a[2], b[14])
+        + IFX_MATQ31_Q58(a[3], b[20]) + IFX_MATQ31_Q58(a[4], b[26]) + IFX_MATQ31_Q58(a[5], b[32]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[9]) + IFX_MATQ31_Q58(a[2], b[15])
+        + IFX_MATQ31_Q58(a[3], b[21]) + IFX_MATQ31_Q58(a[4], b[27]) + IFX_MATQ31_Q58(a[5], b[33]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[10]) + IFX_MATQ31_Q58(a[2], b[16])
+        + IFX_MATQ31_Q58(a[3], b[22]) + IFX_MATQ31_Q58(a[4], b[28]) + IFX_MATQ31_Q58(a[5], b[34]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[17])
+        + IFX_MATQ31_Q58(a[3], b[23]) + IFX_MATQ31_Q58(a[4], b[29]) + IFX_MATQ31_Q58(a[5], b[35]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[0]) + IFX_MATQ31_Q58(a[7], b[6]) + IFX_MATQ31_Q58(a[8], b[12])
+        + IFX_MATQ31_Q58(a[9], b[18]) + IFX_MATQ31_Q58(a[10], b[24]) + IFX_MATQ31_Q58(a[11], b[30]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[1]) + IFX_MATQ31_Q58(a[7], b[7]) + IFX_MATQ31_Q58(a[8], b[13])
+        + IFX_MATQ31_Q58(a[9], b[19]) + IFX_MATQ31_Q58(a[10], b[25]) + IFX_MATQ31_Q58(a[11], b[31]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[2]) + IFX_MATQ31_Q58(a[7], b[8]) + IFX_MATQ31_Q58(a[8], b[14])
+        + IFX_MATQ31_Q58(a[9], b[20]) + IFX_MATQ31_Q58(a[10], b[26]) + IFX_MATQ31_Q58(a[11], b[32]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[3]) + IFX_MATQ31_Q58(a[7], b[9]) + IFX_MATQ31_Q58(a[8], b[15])
+        + IFX_MATQ31_Q58(a[9], b[21]) + IFX_MATQ31_Q58(a[10], b[27]) + IFX_MATQ31_Q58(a[11], b[33]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[4]) + IFX_MATQ31_Q58(a[7], b[10]) + IFX_MATQ31_Q58(a[8], b[16])
+        + IFX_MATQ31_Q58(a[9], b[22]) + IFX_MATQ31_Q58(a[10], b[28]) + IFX_MATQ31_Q58(a[11], b[34]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], b[5]) + IFX_MATQ31_Q58(a[7], b[11]) + IFX_MATQ31_Q58(a[8], b[17])
+        + IFX_MATQ31_Q58(a[9], b[23]) + IFX_MATQ31_Q58(a[10], b[29]) + IFX_MATQ31_Q58(a[11], b[35]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[0]) + IFX_MATQ31_Q58(a[13], b[6]) + IFX_MATQ31_Q58(a[14], b[12])
+        + IFX_MATQ31_Q58(a[15], b[18]) + IFX_MATQ31_Q58(a[16], b[24]) + IFX_MATQ31_Q58(a[17], b[30]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[1]) + IFX_MATQ31_Q58(a[13], b[7]) + IFX_MATQ31_Q58(a[14], b[13])
+        + IFX_MATQ31_Q58(a[15], b[19]) + IFX_MATQ31_Q58(a[16], b[25]) + IFX_MATQ31_Q58(a[17], b[31]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[2]) + IFX_MATQ31_Q58(a[13], b[8]) + IFX_MATQ31_Q58(a[14], b[14])
+        + IFX_MATQ31_Q58(a[15], b[20]) + IFX_MATQ31_Q58(a[16], b[26]) + IFX_MATQ31_Q58(a[17], b[32]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[3]) + IFX_MATQ31_Q58(a[13], b[9]) + IFX_MATQ31_Q58(a[14], b[15])
+        + IFX_MATQ31_Q58(a[15], b[21]) + IFX_MATQ31_Q58(a[16], b[27]) + IFX_MATQ31_Q58(a[17], b[33]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[4]) + IFX_MATQ31_Q58(a[13], b[10]) + IFX_MATQ31_Q58(a[14], b[16])
+        + IFX_MATQ31_Q58(a[15], b[22]) + IFX_MATQ31_Q58(a[16], b[28]) + IFX_MATQ31_Q58(a[17], b[34]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[5]) + IFX_MATQ31_Q58(a[13], b[11]) + IFX_MATQ31_Q58(a[14], b[17])
+        + IFX_MATQ31_Q58(a[15], b[23]) + IFX_MATQ31_Q58(a[16], b[29]) + IFX_MATQ31_Q58(a[17], b[35]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[0]) + IFX_MATQ31_Q58(a[19], b[6]) + IFX_MATQ31_Q58(a[20], b[12])
+        + IFX_MATQ31_Q58(a[21], b[18]) + IFX_MATQ31_Q58(a[22], b[24]) + IFX_MATQ31_Q58(a[23], b[30]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[1]) + IFX_MATQ31_Q58(a[19], b[7]) + IFX_MATQ31_Q58(a[20], b[13])
+        + IFX_MATQ31_Q58(a[21], b[19]) + IFX_MATQ31_Q58(a[22], b[25]) + IFX_MATQ31_Q58(a[23], b[31]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[2]) + IFX_MATQ31_Q58(a[19], b[8]) + IFX_MATQ31_Q58(a[20], b[14])
+        + IFX_MATQ31_Q58(a[21], b[20]) + IFX_MATQ31_Q58(a[22], b[26]) + IFX_MATQ31_Q58(a[23], b[32]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[3]) + IFX_MATQ31_Q58(a[19], b[9]) + IFX_MATQ31_Q58(a[20], b[15])
+        + IFX_MATQ31_Q58(a[21], b[21]) + IFX_MATQ31_Q58(a[22], b[27]) + IFX_MATQ31_Q58(a[23], b[33]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[4]) + IFX_MATQ31_Q58(a[19], b[10]) + IFX_MATQ31_Q58(a[20], b[16])
+        + IFX_MATQ31_Q58(a[21], b[22]) + IFX_MATQ31_Q58(a[22], b[28]) + IFX_MATQ31_Q58(a[23], b[34]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[5]) + IFX_MATQ31_Q58(a[19], b[11]) + IFX_MATQ31_Q58(a[20], b[17])
+        + IFX_MATQ31_Q58(a[21], b[23]) + IFX_MATQ31_Q58(a[22], b[29]) + IFX_MATQ31_Q58(a[23], b[35]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[0]) + IFX_MATQ31_Q58(a[25], b[6]) + IFX_MATQ31_Q58(a[26], b[12])
+        + IFX_MATQ31_Q58(a[27], b[18]) + IFX_MATQ31_Q58(a[28], b[24]) + IFX_MATQ31_Q58(a[29], b[30]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[1]) + IFX_MATQ31_Q58(a[25], b[7]) + IFX_MATQ31_Q58(a[26], b[13])
+        + IFX_MATQ31_Q58(a[27], b[19]) + IFX_MATQ31_Q58(a[28], b[25]) + IFX_MATQ31_Q58(a[29], b[31]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[2]) + IFX_MATQ31_Q58(a[25], b[8]) + IFX_MATQ31_Q58(a[26], b[14])
+        + IFX_MATQ31_Q58(a[27], b[20]) + IFX_MATQ31_Q58(a[28], b[26]) + IFX_MATQ31_Q58(a[29], b[32]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[3]) + IFX_MATQ31_Q58(a[25], b[9]) + IFX_MATQ31_Q58(a[26], b[15])
+        + IFX_MATQ31_Q58(a[27], b[21]) + IFX_MATQ31_Q58(a[28], b[27]) + IFX_MATQ31_Q58(a[29], b[33]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[4]) + IFX_MATQ31_Q58(a[25], b[10]) + IFX_MATQ31_Q58(a[26], b[16])
+        + IFX_MATQ31_Q58(a[27], b[22]) + IFX_MATQ31_Q58(a[28], b[28]) + IFX_MATQ31_Q58(a[29], b[34]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[5]) + IFX_MATQ31_Q58(a[25], b[11]) + IFX_MATQ31_Q58(a[26], b[17])
+        + IFX_MATQ31_Q58(a[27], b[23]) + IFX_MATQ31_Q58(a[28], b[29]) + IFX_MATQ31_Q58(a[29], b[35]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[0]) + IFX_MATQ31_Q58(a[31], b[6]) + IFX_MATQ31_Q58(a[32], b[12])
+        + IFX_MATQ31_Q58(a[33], b[18]) + IFX_MATQ31_Q58(a[34], b[24]) + IFX_MATQ31_Q58(a[35], b[30]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[1]) + IFX_MATQ31_Q58(a[31], b[7]) + IFX_MATQ31_Q58(a[32], b[13])
+        + IFX_MATQ31_Q58(a[33], b[19]) + IFX_MATQ31_Q58(a[34], b[25]) + IFX_MATQ31_Q58(a[35], b[31]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[2]) + IFX_MATQ31_Q58(a[31], b[8]) + IFX_MATQ31_Q58(a[32], b[14])
+        + IFX_MATQ31_Q58(a[33], b[20]) + IFX_MATQ31_Q58(a[34], b[26]) + IFX_MATQ31_Q58(a[35], b[32]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[3]) + IFX_MATQ31_Q58(a[31], b[9]) + IFX_MATQ31_Q58(a[32], b[15])
+        + IFX_MATQ31_Q58(a[33], b[21]) + IFX_MATQ31_Q58(a[34], b[27]) + IFX_MATQ31_Q58(a[35], b[33]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[4]) + IFX_MATQ31_Q58(a[31], b[10]) + IFX_MATQ31_Q58(a[32], b[16])
+        + IFX_MATQ31_Q58(a[33], b[22]) + IFX_MATQ31_Q58(a[34], b[28]) + IFX_MATQ31_Q58(a[35], b[34]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[5]) + IFX_MATQ31_Q58(a[31], b[11]) + IFX_MATQ31_Q58(a[32], b[17])
+        + IFX_MATQ31_Q58(a[33], b[23]) + IFX_MATQ31_Q58(a[34], b[29]) + IFX_MATQ31_Q58(a[35], b[35]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec6(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[6], x[0]) + IFX_MATQ31_Q58(a[7], x[1]) + IFX_MATQ31_Q58(a[8], x[2])
+        + IFX_MATQ31_Q58(a[9], x[3]) + IFX_MATQ31_Q58(a[10], x[4]) + IFX_MATQ31_Q58(a[11], x[5]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], x[0]) + IFX_MATQ31_Q58(a[13], x[1]) + IFX_MATQ31_Q58(a[14], x[2])
+        + IFX_MATQ31_Q58(a[15], x[3]) + IFX_MATQ31_Q58(a[16], x[4]) + IFX_MATQ31_Q58(a[17], x[5]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], x[0]) + IFX_MATQ31_Q58(a[19], x[1]) + IFX_MATQ31_Q58(a[20], x[2])
+        + IFX_MATQ31_Q58(a[21], x[3]) + IFX_MATQ31_Q58(a[22], x[4]) + IFX_MATQ31_Q58(a[23], x[5]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], x[0]) + IFX_MATQ31_Q58(a[25], x[1]) + IFX_MATQ31_Q58(a[26], x[2])
+        + IFX_MATQ31_Q58(a[27], x[3]) + IFX_MATQ31_Q58(a[28], x[4]) + IFX_MATQ31_Q58(a[29], x[5]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], x[0]) + IFX_MATQ31_Q58(a[31], x[1]) + IFX_MATQ31_Q58(a[32], x[2])
+        + IFX_MATQ31_Q58(a[33], x[3]) + IFX_MATQ31_Q58(a[34], x[4]) + IFX_MATQ31_Q58(a[35], x[5]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add7(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+}
+
+
+void Ifx_MatQ31_transpose7(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[7];
+    c[2] = a[14];
+    c[3] = a[21];
+    c[4] = a[28];
+    c[5] = a[35];
+    c[6] = a[42];
+    c[7] = a[1];
+    c[8] = a[8];
+    c[9] = a[15];
+    c[10] = a[22];
+    c[11] = a[29];
+    c[12] = a[36];
+    c[13] = a[43];
+    c[14] = a[2];
+    c[15] = a[9];
+    c[16] = a[16];
+    c[17] = a[23];
+    c[18] = a[30];
+    c[19] = a[37];
+    c[20] = a[44];
+    c[21] = a[3];
+    c[22] = a[10];
+    c[23] = a[17];
+    c[24] = a[24];
+    c[25] = a[31];
+    c[26] = a[38];
+    c[27] = a[45];
+    c[28] = a[4];
+    c[29] = a[11];
+    c[30] = a[18];
+    c[31] = a[25];
+    c[32] = a[32];
+    c[33] = a[39];
+    c[34] = a[46];
+    c[35] = a[5];
+    c[36] = a[12];
+    c[37] = a[19];
+    c[38] = a[26];
+    c[39] = a[33];
+    c[40] = a[40];
+    c[41] = a[47];
+    c[42] = a[6];
+    c[43] = a[13];
+    c[44] = a[20];
+    c[45] = a[27];
+    c[46] = a[34];
+    c[47] = a[41];
+    c[48] = a[48];
+}
+
+
+void Ifx_MatQ31_mul7(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[7]) + IFX_MATQ31_Q58(a[2], b[14])
+        + IFX_MATQ31_Q58(a[3], b[21]) + IFX_MATQ31_Q58(a[4], b[28]) + IFX_MATQ31_Q58(a[5], b[35])
+        + IFX_MATQ31_Q58(a[6], b[42]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[8]) + IFX_MATQ31_Q58(a[2], b[15])
+        + IFX_MATQ31_Q58(a[3], b[22]) + IFX_MATQ31_Q58(a[4], b[29]) + IFX_MATQ31_Q58(a[5], b[36])
+        + IFX_MATQ31_Q58(a[6], b[43]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[9]) + IFX_MATQ31_Q58(a[2], b[16])
+        + IFX_MATQ31_Q58(a[3], b[23]) + IFX_MATQ31_Q58(a[4], b[30]) + IFX_MATQ31_Q58(a[5], b[37])
+        + IFX_MATQ31_Q58(a[6], b[44]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[10]) + IFX_MATQ31_Q58(a[2], b[17])
+        + IFX_MATQ31_Q58(a[3], b[24]) + IFX_MATQ31_Q58(a[4], b[31]) + IFX_MATQ31_Q58(a[5], b[38])
+        + IFX_MATQ31_Q58(a[6], b[45]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[18])
+        + IFX_MATQ31_Q58(a[3], b[25]) + IFX_MATQ31_Q58(a[4], b[32]) + IFX_MATQ31_Q58(a[5], b[39])
+        + IFX_MATQ31_Q58(a[6], b[46]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[19])
+        + IFX_MATQ31_Q58(a[3], b[26]) + IFX_MATQ31_Q58(a[4], b[33]) + IFX_MATQ31_Q58(a[5], b[40])
+        + IFX_MATQ31_Q58(a[6], b[47]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[20])
+        + IFX_MATQ31_Q58(a[3], b[27]) + IFX_MATQ31_Q58(a[4], b[34]) + IFX_MATQ31_Q58(a[5], b[41])
+        + IFX_MATQ31_Q58(a[6], b[48]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[0]) + IFX_MATQ31_Q58(a[8], b[7]) + IFX_MATQ31_Q58(a[9], b[14])
+        + IFX_MATQ31_Q58(a[10], b[21]) + IFX_MATQ31_Q58(a[11], b[28]) + IFX_MATQ31_Q58(a[12], b[35])
+        + IFX_MATQ31_Q58(a[13], b[42]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[1]) + IFX_MATQ31_Q58(a[8], b[8]) + IFX_MATQ31_Q58(a[9], b[15])
+        + IFX_MATQ31_Q58(a[10], b[22]) + IFX_MATQ31_Q58(a[11], b[29]) + IFX_MATQ31_Q58(a[12], b[36])
+        + IFX_MATQ31_Q58(a[13], b[43]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[2]) + IFX_MATQ31_Q58(a[8], b[9]) + IFX_MATQ31_Q58(a[9], b[16])
+        + IFX_MATQ31_Q58(a[10], b[23]) + IFX_MATQ31_Q58(a[11], b[30]) + IFX_MATQ31_Q58(a[12], b[37])
+        + IFX_MATQ31_Q58(a[13], b[44]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[3]) + IFX_MATQ31_Q58(a[8], b[10]) + IFX_MATQ31_Q58(a[9], b[17])
+        + IFX_MATQ31_Q58(a[10], b[24]) + IFX_MATQ31_Q58(a[11], b[31]) + IFX_MATQ31_Q58(a[12], b[38])
+        + IFX_MATQ31_Q58(a[13], b[45]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[4]) + IFX_MATQ31_Q58(a[8], b[11]) + IFX_MATQ31_Q58(a[9], b[18])
+        + IFX_MATQ31_Q58(a[10], b[25]) + IFX_MATQ31_Q58(a[11], b[32]) + IFX_MATQ31_Q58(a[12], b[39])
+        + IFX_MATQ31_Q58(a[13], b[46]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[5]) + IFX_MATQ31_Q58(a[8], b[12]) + IFX_MATQ31_Q58(a[9], b[19])
+        + IFX_MATQ31_Q58(a[10], b[26]) + IFX_MATQ31_Q58(a[11], b[33]) + IFX_MATQ31_Q58(a[12], b[40])
+        + IFX_MATQ31_Q58(a[13], b[47]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], b[6]) + IFX_MATQ31_Q58(a[8], b[13]) + IFX_MATQ31_Q58(a[9], b[20])
+        + IFX_MATQ31_Q58(a[10], b[27]) + IFX_MATQ31_Q58(a[11], b[34]) + IFX_MATQ31_Q58(a[12], b[41])
+        + IFX_MATQ31_Q58(a[13], b[48]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[0]) + IFX_MATQ31_Q58(a[15], b[7]) + IFX_MATQ31_Q58(a[16], b[14])
+        + IFX_MATQ31_Q58(a[17], b[21]) + IFX_MATQ31_Q58(a[18], b[28]) + IFX_MATQ31_Q58(a[19], b[35])
+        + IFX_MATQ31_Q58(a[20], b[42]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[1]) + IFX_MATQ31_Q58(a[15], b[8]) + IFX_MATQ31_Q58(a[16], b[15])
+        + IFX_MATQ31_Q58(a[17], b[22]) + IFX_MATQ31_Q58(a[18], b[29]) + IFX_MATQ31_Q58(a[19], b[36])
+        + IFX_MATQ31_Q58(a[20], b[43]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[2]) + IFX_MATQ31_Q58(a[15], b[9]) + IFX_MATQ31_Q58(a[16], b[16])
+        + IFX_MATQ31_Q58(a[17], b[23]) + IFX_MATQ31_Q58(a[18], b[30]) + IFX_MATQ31_Q58(a[19], b[37])
+        + IFX_MATQ31_Q58(a[20], b[44]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[3]) + IFX_MATQ31_Q58(a[15], b[10]) + IFX_MATQ31_Q58(a[16], b[17])
+        + IFX_MATQ31_Q58(a[17], b[24]) + IFX_MATQ31_Q58(a[18], b[31]) + IFX_MATQ31_Q58(a[19], b[38])
+        + IFX_MATQ31_Q58(a[20], b[45]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[4]) + IFX_MATQ31_Q58(a[15], b[11]) + IFX_MATQ31_Q58(a[16], b[18])
+        + IFX_MATQ31_Q58(a[17], b[25]) + IFX_MATQ31_Q58(a[18], b[32]) + IFX_MATQ31_Q58(a[19], b[39])
+        + IFX_MATQ31_Q58(a[20], b[46]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[5]) + IFX_MATQ31_Q58(a[15], b[12]) + IFX_MATQ31_Q58(a[16], b[19])
+        + IFX_MATQ31_Q58(a[17], b[26]) + IFX_MATQ31_Q58(a[18], b[33]) + IFX_MATQ31_Q58(a[19], b[40])
+        + IFX_MATQ31_Q58(a[20], b[47]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], b[6]) + IFX_MATQ31_Q58(a[15], b[13]) + IFX_MATQ31_Q58(a[16], b[20])
+        + IFX_MATQ31_Q58(a[17], b[27]) + IFX_MATQ31_Q58(a[18], b[34]) + IFX_MATQ31_Q58(a[19], b[41])
+        + IFX_MATQ31_Q58(a[20], b[48]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[0]) + IFX_MATQ31_Q58(a[22], b[7]) + IFX_MATQ31_Q58(a[23], b[14])
+        + IFX_MATQ31_Q58(a[24], b[21]) + IFX_MATQ31_Q58(a[25], b[28]) + IFX_MATQ31_Q58(a[26], b[35])
+        + IFX_MATQ31_Q58(a[27], b[42]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[1]) + IFX_MATQ31_Q58(a[22], b[8]) + IFX_MATQ31_Q58(a[23], b[15])
+        + IFX_MATQ31_Q58(a[24], b[22]) + IFX_MATQ31_Q58(a[25], b[29]) + IFX_MATQ31_Q58(a[26], b[36])
+        + IFX_MATQ31_Q58(a[27], b[43]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[2]) + IFX_MATQ31_Q58(a[22], b[9]) + IFX_MATQ31_Q58(a[23], b[16])
+        + IFX_MATQ31_Q58(a[24], b[23]) + IFX_MATQ31_Q58(a[25], b[30]) + IFX_MATQ31_Q58(a[26], b[37])
+        + IFX_MATQ31_Q58(a[27], b[44]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[3]) + IFX_MATQ31_Q58(a[22], b[10]) + IFX_MATQ31_Q58(a[23], b[17])
+        + IFX_MATQ31_Q58(a[24], b[24]) + IFX_MATQ31_Q58(a[25], b[31]) + IFX_MATQ31_Q58(a[26], b[38])
+        + IFX_MATQ31_Q58(a[27], b[45]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[4]) + IFX_MATQ31_Q58(a[22], b[11]) + IFX_MATQ31_Q58(a[23], b[18])
+        + IFX_MATQ31_Q58(a[24], b[25]) + IFX_MATQ31_Q58(a[25], b[32]) + IFX_MATQ31_Q58(a[26], b[39])
+        + IFX_MATQ31_Q58(a[27], b[46]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[5]) + IFX_MATQ31_Q58(a[22], b[12]) + IFX_MATQ31_Q58(a[23], b[19])
+        + IFX_MATQ31_Q58(a[24], b[26]) + IFX_MATQ31_Q58(a[25], b[33]) + IFX_MATQ31_Q58(a[26], b[40])
+        + IFX_MATQ31_Q58(a[27], b[47]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], b[6]) + IFX_MATQ31_Q58(a[22], b[13]) + IFX_MATQ31_Q58(a[23], b[20])
+        + IFX_MATQ31_Q58(a[24], b[27]) + IFX_MATQ31_Q58(a[25], b[34]) + IFX_MATQ31_Q58(a[26], b[41])
+        + IFX_MATQ31_Q58(a[27], b[48]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[0]) + IFX_MATQ31_Q58(a[29], b[7]) + IFX_MATQ31_Q58(a[30], b[14])
+        + IFX_MATQ31_Q58(a[31], b[21]) + IFX_MATQ31_Q58(a[32], b[28]) + IFX_MATQ31_Q58(a[33], b[35])
+        + IFX_MATQ31_Q58(a[34], b[42]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[1]) + IFX_MATQ31_Q58(a[29], b[8]) + IFX_MATQ31_Q58(a[30], b[15])
+        + IFX_MATQ31_Q58(a[31], b[22]) + IFX_MATQ31_Q58(a[32], b[29]) + IFX_MATQ31_Q58(a[33], b[36])
+        + IFX_MATQ31_Q58(a[34], b[43]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[2]) + IFX_MATQ31_Q58(a[29], b[9]) + IFX_MATQ31_Q58(a[30], b[16])
+        + IFX_MATQ31_Q58(a[31], b[23]) + IFX_MATQ31_Q58(a[32], b[30]) + IFX_MATQ31_Q58(a[33], b[37])
+        + IFX_MATQ31_Q58(a[34], b[44]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[3]) + IFX_MATQ31_Q58(a[29], b[10]) + IFX_MATQ31_Q58(a[30], b[17])
+        + IFX_MATQ31_Q58(a[31], b[24]) + IFX_MATQ31_Q58(a[32], b[31]) + IFX_MATQ31_Q58(a[33], b[38])
+        + IFX_MATQ31_Q58(a[34], b[45]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[4]) + IFX_MATQ31_Q58(a[29], b[11]) + IFX_MATQ31_Q58(a[30], b[18])
+        + IFX_MATQ31_Q58(a[31], b[25]) + IFX_MATQ31_Q58(a[32], b[32]) + IFX_MATQ31_Q58(a[33], b[39])
+        + IFX_MATQ31_Q58(a[34], b[46]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[5]) + IFX_MATQ31_Q58(a[29], b[12]) + IFX_MATQ31_Q58(a[30], b[19])
+        + IFX_MATQ31_Q58(a[31], b[26]) + IFX_MATQ31_Q58(a[32], b[33]) + IFX_MATQ31_Q58(a[33], b[40])
+        + IFX_MATQ31_Q58(a[34], b[47]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], b[6]) + IFX_MATQ31_Q58(a[29], b[13]) + IFX_MATQ31_Q58(a[30], b[20])
+        + IFX_MATQ31_Q58(a[31], b[27]) + IFX_MATQ31_Q58(a[32], b[34]) + IFX_MATQ31_Q58(a[33], b[41])
+        + IFX_MATQ31_Q58(a[34], b[48]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[0]) + IFX_MATQ31_Q58(a[36], b[7]) + IFX_MATQ31_Q58(a[37], b[14])
+        + IFX_MATQ31_Q58(a[38], b[21]) + IFX_MATQ31_Q58(a[39], b[28]) + IFX_MATQ31_Q58(a[40], b[35])
+        + IFX_MATQ31_Q58(a[41], b[42]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[1]) + IFX_MATQ31_Q58(a[36], b[8]) + IFX_MATQ31_Q58(a[37], b[15])
+        + IFX_MATQ31_Q58(a[38], b[22]) + IFX_MATQ31_Q58(a[39], b[29]) + IFX_MATQ31_Q58(a[40], b[36])
+        + IFX_MATQ31_Q58(a[41], b[43]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[2]) + IFX_MATQ31_Q58(a[36], b[9]) + IFX_MATQ31_Q58(a[37], b[16])
+        + IFX_MATQ31_Q58(a[38], b[23]) + IFX_MATQ31_Q58(a[39], b[30]) + IFX_MATQ31_Q58(a[40], b[37])
+        + IFX_MATQ31_Q58(a[41], b[44]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[3]) + IFX_MATQ31_Q58(a[36], b[10]) + IFX_MATQ31_Q58(a[37], b[17])
+        + IFX_MATQ31_Q58(a[38], b[24]) + IFX_MATQ31_Q58(a[39], b[31]) + IFX_MATQ31_Q58(a[40], b[38])
+        + IFX_MATQ31_Q58(a[41], b[45]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[4]) + IFX_MATQ31_Q58(a[36], b[11]) + IFX_MATQ31_Q58(a[37], b[18])
+        + IFX_MATQ31_Q58(a[38], b[25]) + IFX_MATQ31_Q58(a[39], b[32]) + IFX_MATQ31_Q58(a[40], b[39])
+        + IFX_MATQ31_Q58(a[41], b[46]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[5]) + IFX_MATQ31_Q58(a[36], b[12]) + IFX_MATQ31_Q58(a[37], b[19])
+        + IFX_MATQ31_Q58(a[38], b[26]) + IFX_MATQ31_Q58(a[39], b[33]) + IFX_MATQ31_Q58(a[40], b[40])
+        + IFX_MATQ31_Q58(a[41], b[47]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], b[6]) + IFX_MATQ31_Q58(a[36], b[13]) + IFX_MATQ31_Q58(a[37], b[20])
+        + IFX_MATQ31_Q58(a[38], b[27]) + IFX_MATQ31_Q58(a[39], b[34]) + IFX_MATQ31_Q58(a[40], b[41])
+        + IFX_MATQ31_Q58(a[41], b[48]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[0]) + IFX_MATQ31_Q58(a[43], b[7]) + IFX_MATQ31_Q58(a[44], b[14])
+        + IFX_MATQ31_Q58(a[45], b[21]) + IFX_MATQ31_Q58(a[46], b[28]) + IFX_MATQ31_Q58(a[47], b[35])
+        + IFX_MATQ31_Q58(a[48], b[42]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[1]) + IFX_MATQ31_Q58(a[43], b[8]) + IFX_MATQ31_Q58(a[44], b[15])
+        + IFX_MATQ31_Q58(a[45], b[22]) + IFX_MATQ31_Q58(a[46], b[29]) + IFX_MATQ31_Q58(a[47], b[36])
+        + IFX_MATQ31_Q58(a[48], b[43]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[2]) + IFX_MATQ31_Q58(a[43], b[9]) + IFX_MATQ31_Q58(a[44], b[16])
+        + IFX_MATQ31_Q58(a[45], b[23]) + IFX_MATQ31_Q58(a[46], b[30]) + IFX_MATQ31_Q58(a[47], b[37])
+        + IFX_MATQ31_Q58(a[48], b[44]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[3]) + IFX_MATQ31_Q58(a[43], b[10]) + IFX_MATQ31_Q58(a[44], b[17])
+        + IFX_MATQ31_Q58(a[45], b[24]) + IFX_MATQ31_Q58(a[46], b[31]) + IFX_MATQ31_Q58(a[47], b[38])
+        + IFX_MATQ31_Q58(a[48], b[45]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[4]) + IFX_MATQ31_Q58(a[43], b[11]) + IFX_MATQ31_Q58(a[44], b[18])
+        + IFX_MATQ31_Q58(a[45], b[25]) + IFX_MATQ31_Q58(a[46], b[32]) + IFX_MATQ31_Q58(a[47], b[39])
+        + IFX_MATQ31_Q58(a[48], b[46]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[5]) + IFX_MATQ31_Q58(a[43], b[12]) + IFX_MATQ31_Q58(a[44], b[19])
+        + IFX_MATQ31_Q58(a[45], b[26]) + IFX_MATQ31_Q58(a[46], b[33]) + IFX_MATQ31_Q58(a[47], b[40])
+        + IFX_MATQ31_Q58(a[48], b[47]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], b[6]) + IFX_MATQ31_Q58(a[43], b[13]) + IFX_MATQ31_Q58(a[44], b[20])
+        + IFX_MATQ31_Q58(a[45], b[27]) + IFX_MATQ31_Q58(a[46], b[34]) + IFX_MATQ31_Q58(a[47], b[41])
+        + IFX_MATQ31_Q58(a[48], b[48]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec7(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[7], x[0]) + IFX_MATQ31_Q58(a[8], x[1]) + IFX_MATQ31_Q58(a[9], x[2])
+        + IFX_MATQ31_Q58(a[10], x[3]) + IFX_MATQ31_Q58(a[11], x[4]) + IFX_MATQ31_Q58(a[12], x[5])
+        + IFX_MATQ31_Q58(a[13], x[6]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[14], x[0]) + IFX_MATQ31_Q58(a[15], x[1]) + IFX_MATQ31_Q58(a[16], x[2])
+        + IFX_MATQ31_Q58(a[17], x[3]) + IFX_MATQ31_Q58(a[18], x[4]) + IFX_MATQ31_Q58(a[19], x[5])
+        + IFX_MATQ31_Q58(a[20], x[6]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[21], x[0]) + IFX_MATQ31_Q58(a[22], x[1]) + IFX_MATQ31_Q58(a[23], x[2])
+        + IFX_MATQ31_Q58(a[24], x[3]) + IFX_MATQ31_Q58(a[25], x[4]) + IFX_MATQ31_Q58(a[26], x[5])
+        + IFX_MATQ31_Q58(a[27], x[6]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[28], x[0]) + IFX_MATQ31_Q58(a[29], x[1]) + IFX_MATQ31_Q58(a[30], x[2])
+        + IFX_MATQ31_Q58(a[31], x[3]) + IFX_MATQ31_Q58(a[32], x[4]) + IFX_MATQ31_Q58(a[33], x[5])
+        + IFX_MATQ31_Q58(a[34], x[6]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[35], x[0]) + IFX_MATQ31_Q58(a[36], x[1]) + IFX_MATQ31_Q58(a[37], x[2])
+        + IFX_MATQ31_Q58(a[38], x[3]) + IFX_MATQ31_Q58(a[39], x[4]) + IFX_MATQ31_Q58(a[40], x[5])
+        + IFX_MATQ31_Q58(a[41], x[6]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[42], x[0]) + IFX_MATQ31_Q58(a[43], x[1]) + IFX_MATQ31_Q58(a[44], x[2])
+        + IFX_MATQ31_Q58(a[45], x[3]) + IFX_MATQ31_Q58(a[46], x[4]) + IFX_MATQ31_Q58(a[47], x[5])
+        + IFX_MATQ31_Q58(a[48], x[6]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add8(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+    c[49] = Ifx_MatQ31_saturate((sint64)a[49] + b[49]);
+    c[50] = Ifx_MatQ31_saturate((sint64)a[50] + b[50]);
+    c[51] = Ifx_MatQ31_saturate((sint64)a[51] + b[51]);
+    c[52] = Ifx_MatQ31_saturate((sint64)a[52] + b[52]);
+    c[53] = Ifx_MatQ31_saturate((sint64)a[53] + b[53]);
+    c[54] = Ifx_MatQ31_saturate((sint64)a[54] + b[54]);
+    c[55] = Ifx_MatQ31_saturate((sint64)a[55] + b[55]);
+    c[56] = Ifx_MatQ31_saturate((sint64)a[56] + b[56]);
+    c[57] = Ifx_MatQ31_saturate((sint64)a[57] + b[57]);
+    c[58] = Ifx_MatQ31_saturate((sint64)a[58] + b[58]);
+    c[59] = Ifx_MatQ31_saturate((sint64)a[59] + b[59]);
+    c[60] = Ifx_MatQ31_saturate((sint64)a[60] + b[60]);
+    c[61] = Ifx_MatQ31_saturate((sint64)a[61] + b[61]);
+    c[62] = Ifx_MatQ31_saturate((sint64)a[62] + b[62]);
+    c[63] = Ifx_MatQ31_saturate((sint64)a[63] + b[63]);
+}
+
+
+void Ifx_MatQ31_transpose8(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[8];
+    c[2] = a[16];
+    c[3] = a[24];
+    c[4] = a[32];
+    c[5] = a[40];
+    c[6] = a[48];
+    c[7] = a[56];
+    c[8] = a[1];
+    c[9] = a[9];
+    c[10] = a[17];
+    c[11] = a[25];
+    c[12] = a[33];
+    c[13] = a[41];
+    c[14] = a[49];
+    c[15] = a[57];
+    c[16] = a[2];
+    c[17] = a[10];
+    c[18] = a[18];
+    c[19] = a[26];
+    c[20] = a[34];
+    c[21] = a[42];
+    c[22] = a[50];
+    c[23] = a[58];
+    c[24] = a[3];
+    c[25] = a[11];
+    c[26] = a[19];
+    c[27] = a[27];
+    c[28] = a[35];
+    c[29] = a[43];
+    c[30] = a[51];
+    c[31] = a[59];
+    c[32] = a[4];
+    c[33] = a[12];
+    c[34] = a[20];
+    c[35] = a[28];
+    c[36] = a[36];
+    c[37] = a[44];
+    c[38] = a[52];
+    c[39] = a[60];
+    c[40] = a[5];
+    c[41] = a[13];
+    c[42] = a[21];
+    c[43] = a[29];
+    c[44] = a[37];
+    c[45] = a[45];
+    c[46] = a[53];
+    c[47] = a[61];
+    c[48] = a[6];
+    c[49] = a[14];
+    c[50] = a[22];
+    c[51] = a[30];
+    c[52] = a[38];
+    c[53] = a[46];
+    c[54] = a[54];
+    c[55] = a[62];
+    c[56] = a[7];
+    c[57] = a[15];
+    c[58] = a[23];
+    c[59] = a[31];
+    c[60] = a[39];
+    c[61] = a[47];
+    c[62] = a[55];
+    c[63] = a[63];
+}
+
+
+void Ifx_MatQ31_mul8(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[8]) + IFX_MATQ31_Q58(a[2], b[16])
+        + IFX_MATQ31_Q58(a[3], b[24]) + IFX_MATQ31_Q58(a[4], b[32]) + IFX_MATQ31_Q58(a[5], b[40])
+        + IFX_MATQ31_Q58(a[6], b[48]) + IFX_MATQ31_Q58(a[7], b[56]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[9]) + IFX_MATQ31_Q58(a[2], b[17])
+        + IFX_MATQ31_Q58(a[3], b[25]) + IFX_MATQ31_Q58(a[4], b[33]) + IFX_MATQ31_Q58(a[5], b[41])
+        + IFX_MATQ31_Q58(a[6], b[49]) + IFX_MATQ31_Q58(a[7], b[57]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[10]) + IFX_MATQ31_Q58(a[2], b[18])
+        + IFX_MATQ31_Q58(a[3], b[26]) + IFX_MATQ31_Q58(a[4], b[34]) + IFX_MATQ31_Q58(a[5], b[42])
+        + IFX_MATQ31_Q58(a[6], b[50]) + IFX_MATQ31_Q58(a[7], b[58]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[19])
+        + IFX_MATQ31_Q58(a[3], b[27]) + IFX_MATQ31_Q58(a[4], b[35]) + IFX_MATQ31_Q58(a[5], b[43])
+        + IFX_MATQ31_Q58(a[6], b[51]) + IFX_MATQ31_Q58(a[7], b[59]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[20])
+        + IFX_MATQ31_Q58(a[3], b[28]) + IFX_MATQ31_Q58(a[4], b[36]) + IFX_MATQ31_Q58(a[5], b[44])
+        + IFX_MATQ31_Q58(a[6], b[52]) + IFX_MATQ31_Q58(a[7], b[60]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[21])
+        + IFX_MATQ31_Q58(a[3], b[29]) + IFX_MATQ31_Q58(a[4], b[37]) + IFX_MATQ31_Q58(a[5], b[45])
+        + IFX_MATQ31_Q58(a[6], b[53]) + IFX_MATQ31_Q58(a[7], b[61]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[14]) + IFX_MATQ31_Q58(a[2], b[22])
+        + IFX_MATQ31_Q58(a[3], b[30]) + IFX_MATQ31_Q58(a[4], b[38]) + IFX_MATQ31_Q58(a[5], b[46])
+        + IFX_MATQ31_Q58(a[6], b[54]) + IFX_MATQ31_Q58(a[7], b[62]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[7]) + IFX_MATQ31_Q58(a[1], b[15]) + IFX_MATQ31_Q58(a[2], b[23])
+        + IFX_MATQ31_Q58(a[3], b[31]) + IFX_MATQ31_Q58(a[4], b[39]) + IFX_MATQ31_Q58(a[5], b[47])
+        + IFX_MATQ31_Q58(a[6], b[55]) + IFX_MATQ31_Q58(a[7], b[63]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[0]) + IFX_MATQ31_Q58(a[9], b[8]) + IFX_MATQ31_Q58(a[10], b[16])
+        + IFX_MATQ31_Q58(a[11], b[24]) + IFX_MATQ31_Q58(a[12], b[32]) + IFX_MATQ31_Q58(a[13], b[40])
+        + IFX_MATQ31_Q58(a[14], b[48]) + IFX_MATQ31_Q58(a[15], b[56]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[1]) + IFX_MATQ31_Q58(a[9], b[9]) + IFX_MATQ31_Q58(a[10], b[17])
+        + IFX_MATQ31_Q58(a[11], b[25]) + IFX_MATQ31_Q58(a[12], b[33]) + IFX_MATQ31_Q58(a[13], b[41])
+        + IFX_MATQ31_Q58(a[14], b[49]) + IFX_MATQ31_Q58(a[15], b[57]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[2]) + IFX_MATQ31_Q58(a[9], b[10]) + IFX_MATQ31_Q58(a[10], b[18])
+        + IFX_MATQ31_Q58(a[11], b[26]) + IFX_MATQ31_Q58(a[12], b[34]) + IFX_MATQ31_Q58(a[13], b[42])
+        + IFX_MATQ31_Q58(a[14], b[50]) + IFX_MATQ31_Q58(a[15], b[58]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[3]) + IFX_MATQ31_Q58(a[9], b[11]) + IFX_MATQ31_Q58(a[10], b[19])
+        + IFX_MATQ31_Q58(a[11], b[27]) + IFX_MATQ31_Q58(a[12], b[35]) + IFX_MATQ31_Q58(a[13], b[43])
+        + IFX_MATQ31_Q58(a[14], b[51]) + IFX_MATQ31_Q58(a[15], b[59]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[4]) + IFX_MATQ31_Q58(a[9], b[12]) + IFX_MATQ31_Q58(a[10], b[20])
+        + IFX_MATQ31_Q58(a[11], b[28]) + IFX_MATQ31_Q58(a[12], b[36]) + IFX_MATQ31_Q58(a[13], b[44])
+        + IFX_MATQ31_Q58(a[14], b[52]) + IFX_MATQ31_Q58(a[15], b[60]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[5]) + IFX_MATQ31_Q58(a[9], b[13]) + IFX_MATQ31_Q58(a[10], b[21])
+        + IFX_MATQ31_Q58(a[11], b[29]) + IFX_MATQ31_Q58(a[12], b[37]) + IFX_MATQ31_Q58(a[13], b[45])
+        + IFX_MATQ31_Q58(a[14], b[53]) + IFX_MATQ31_Q58(a[15], b[61]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[6]) + IFX_MATQ31_Q58(a[9], b[14]) + IFX_MATQ31_Q58(a[10], b[22])
+        + IFX_MATQ31_Q58(a[11], b[30]) + IFX_MATQ31_Q58(a[12], b[38]) + IFX_MATQ31_Q58(a[13], b[46])
+        + IFX_MATQ31_Q58(a[14], b[54]) + IFX_MATQ31_Q58(a[15], b[62]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], b[7]) + IFX_MATQ31_Q58(a[9], b[15]) + IFX_MATQ31_Q58(a[10], b[23])
+        + IFX_MATQ31_Q58(a[11], b[31]) + IFX_MATQ31_Q58(a[12], b[39]) + IFX_MATQ31_Q58(a[13], b[47])
+        + IFX_MATQ31_Q58(a[14], b[55]) + IFX_MATQ31_Q58(a[15], b[63]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[0]) + IFX_MATQ31_Q58(a[17], b[8]) + IFX_MATQ31_Q58(a[18], b[16])
+        + IFX_MATQ31_Q58(a[19], b[24]) + IFX_MATQ31_Q58(a[20], b[32]) + IFX_MATQ31_Q58(a[21], b[40])
+        + IFX_MATQ31_Q58(a[22], b[48]) + IFX_MATQ31_Q58(a[23], b[56]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[1]) + IFX_MATQ31_Q58(a[17], b[9]) + IFX_MATQ31_Q58(a[18], b[17])
+        + IFX_MATQ31_Q58(a[19], b[25]) + IFX_MATQ31_Q58(a[20], b[33]) + IFX_MATQ31_Q58(a[21], b[41])
+        + IFX_MATQ31_Q58(a[22], b[49]) + IFX_MATQ31_Q58(a[23], b[57]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[2]) + IFX_MATQ31_Q58(a[17], b[10]) + IFX_MATQ31_Q58(a[18], b[18])
+        + IFX_MATQ31_Q58(a[19], b[26]) + IFX_MATQ31_Q58(a[20], b[34]) + IFX_MATQ31_Q58(a[21], b[42])
+        + IFX_MATQ31_Q58(a[22], b[50]) + IFX_MATQ31_Q58(a[23], b[58]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[3]) + IFX_MATQ31_Q58(a[17], b[11]) + IFX_MATQ31_Q58(a[18], b[19])
+        + IFX_MATQ31_Q58(a[19], b[27]) + IFX_MATQ31_Q58(a[20], b[35]) + IFX_MATQ31_Q58(a[21], b[43])
+        + IFX_MATQ31_Q58(a[22], b[51]) + IFX_MATQ31_Q58(a[23], b[59]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[4]) + IFX_MATQ31_Q58(a[17], b[12]) + IFX_MATQ31_Q58(a[18], b[20])
+        + IFX_MATQ31_Q58(a[19], b[28]) + IFX_MATQ31_Q58(a[20], b[36]) + IFX_MATQ31_Q58(a[21], b[44])
+        + IFX_MATQ31_Q58(a[22], b[52]) + IFX_MATQ31_Q58(a[23], b[60]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[5]) + IFX_MATQ31_Q58(a[17], b[13]) + IFX_MATQ31_Q58(a[18], b[21])
+        + IFX_MATQ31_Q58(a[19], b[29]) + IFX_MATQ31_Q58(a[20], b[37]) + IFX_MATQ31_Q58(a[21], b[45])
+        + IFX_MATQ31_Q58(a[22], b[53]) + IFX_MATQ31_Q58(a[23], b[61]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[6]) + IFX_MATQ31_Q58(a[17], b[14]) + IFX_MATQ31_Q58(a[18], b[22])
+        + IFX_MATQ31_Q58(a[19], b[30]) + IFX_MATQ31_Q58(a[20], b[38]) + IFX_MATQ31_Q58(a[21], b[46])
+        + IFX_MATQ31_Q58(a[22], b[54]) + IFX_MATQ31_Q58(a[23], b[62]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], b[7]) + IFX_MATQ31_Q58(a[17], b[15]) + IFX_MATQ31_Q58(a[18], b[23])
+        + IFX_MATQ31_Q58(a[19], b[31]) + IFX_MATQ31_Q58(a[20], b[39]) + IFX_MATQ31_Q58(a[21], b[47])
+        + IFX_MATQ31_Q58(a[22], b[55]) + IFX_MATQ31_Q58(a[23], b[63]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[0]) + IFX_MATQ31_Q58(a[25], b[8]) + IFX_MATQ31_Q58(a[26], b[16])
+        + IFX_MATQ31_Q58(a[27], b[24]) + IFX_MATQ31_Q58(a[28], b[32]) + IFX_MATQ31_Q58(a[29], b[40])
+        + IFX_MATQ31_Q58(a[30], b[48]) + IFX_MATQ31_Q58(a[31], b[56]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[1]) + IFX_MATQ31_Q58(a[25], b[9]) + IFX_MATQ31_Q58(a[26], b[17])
+        + IFX_MATQ31_Q58(a[27], b[25]) + IFX_MATQ31_Q58(a[28], b[33]) + IFX_MATQ31_Q58(a[29], b[41])
+        + IFX_MATQ31_Q58(a[30], b[49]) + IFX_MATQ31_Q58(a[31], b[57]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[2]) + IFX_MATQ31_Q58(a[25], b[10]) + IFX_MATQ31_Q58(a[26], b[18])
+        + IFX_MATQ31_Q58(a[27], b[26]) + IFX_MATQ31_Q58(a[28], b[34]) + IFX_MATQ31_Q58(a[29], b[42])
+        + IFX_MATQ31_Q58(a[30], b[50]) + IFX_MATQ31_Q58(a[31], b[58]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[3]) + IFX_MATQ31_Q58(a[25], b[11]) + IFX_MATQ31_Q58(a[26], b[19])
+        + IFX_MATQ31_Q58(a[27], b[27]) + IFX_MATQ31_Q58(a[28], b[35]) + IFX_MATQ31_Q58(a[29], b[43])
+        + IFX_MATQ31_Q58(a[30], b[51]) + IFX_MATQ31_Q58(a[31], b[59]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[4]) + IFX_MATQ31_Q58(a[25], b[12]) + IFX_MATQ31_Q58(a[26], b[20])
+        + IFX_MATQ31_Q58(a[27], b[28]) + IFX_MATQ31_Q58(a[28], b[36]) + IFX_MATQ31_Q58(a[29], b[44])
+        + IFX_MATQ31_Q58(a[30], b[52]) + IFX_MATQ31_Q58(a[31], b[60]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[5]) + IFX_MATQ31_Q58(a[25], b[13]) + IFX_MATQ31_Q58(a[26], b[21])
+        + IFX_MATQ31_Q58(a[27], b[29]) + IFX_MATQ31_Q58(a[28], b[37]) + IFX_MATQ31_Q58(a[29], b[45])
+        + IFX_MATQ31_Q58(a[30], b[53]) + IFX_MATQ31_Q58(a[31], b[61]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[6]) + IFX_MATQ31_Q58(a[25], b[14]) + IFX_MATQ31_Q58(a[26], b[22])
+        + IFX_MATQ31_Q58(a[27], b[30]) + IFX_MATQ31_Q58(a[28], b[38]) + IFX_MATQ31_Q58(a[29], b[46])
+        + IFX_MATQ31_Q58(a[30], b[54]) + IFX_MATQ31_Q58(a[31], b[62]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[7]) + IFX_MATQ31_Q58(a[25], b[15]) + IFX_MATQ31_Q58(a[26], b[23])
+        + IFX_MATQ31_Q58(a[27], b[31]) + IFX_MATQ31_Q58(a[28], b[39]) + IFX_MATQ31_Q58(a[29], b[47])
+        + IFX_MATQ31_Q58(a[30], b[55]) + IFX_MATQ31_Q58(a[31], b[63]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[0]) + IFX_MATQ31_Q58(a[33], b[8]) + IFX_MATQ31_Q58(a[34], b[16])
+        + IFX_MATQ31_Q58(a[35], b[24]) + IFX_MATQ31_Q58(a[36], b[32]) + IFX_MATQ31_Q58(a[37], b[40])
+        + IFX_MATQ31_Q58(a[38], b[48]) + IFX_MATQ31_Q58(a[39], b[56]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[1]) + IFX_MATQ31_Q58(a[33], b[9]) + IFX_MATQ31_Q58(a[34], b[17])
+        + IFX_MATQ31_Q58(a[35], b[25]) + IFX_MATQ31_Q58(a[36], b[33]) + IFX_MATQ31_Q58(a[37], b[41])
+        + IFX_MATQ31_Q58(a[38], b[49]) + IFX_MATQ31_Q58(a[39], b[57]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[2]) + IFX_MATQ31_Q58(a[33], b[10]) + IFX_MATQ31_Q58(a[34], b[18])
+        + IFX_MATQ31_Q58(a[35], b[26]) + IFX_MATQ31_Q58(a[36], b[34]) + IFX_MATQ31_Q58(a[37], b[42])
+        + IFX_MATQ31_Q58(a[38], b[50]) + IFX_MATQ31_Q58(a[39], b[58]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[3]) + IFX_MATQ31_Q58(a[33], b[11]) + IFX_MATQ31_Q58(a[34], b[19])
+        + IFX_MATQ31_Q58(a[35], b[27]) + IFX_MATQ31_Q58(a[36], b[35]) + IFX_MATQ31_Q58(a[37], b[43])
+        + IFX_MATQ31_Q58(a[38], b[51]) + IFX_MATQ31_Q58(a[39], b[59]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[4]) + IFX_MATQ31_Q58(a[33], b[12]) + IFX_MATQ31_Q58(a[34], b[20])
+        + IFX_MATQ31_Q58(a[35], b[28]) + IFX_MATQ31_Q58(a[36], b[36]) + IFX_MATQ31_Q58(a[37], b[44])
+        + IFX_MATQ31_Q58(a[38], b[52]) + IFX_MATQ31_Q58(a[39], b[60]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[5]) + IFX_MATQ31_Q58(a[33], b[13]) + IFX_MATQ31_Q58(a[34], b[21])
+        + IFX_MATQ31_Q58(a[35], b[29]) + IFX_MATQ31_Q58(a[36], b[37]) + IFX_MATQ31_Q58(a[37], b[45])
+        + IFX_MATQ31_Q58(a[38], b[53]) + IFX_MATQ31_Q58(a[39], b[61]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[6]) + IFX_MATQ31_Q58(a[33], b[14]) + IFX_MATQ31_Q58(a[34], b[22])
+        + IFX_MATQ31_Q58(a[35], b[30]) + IFX_MATQ31_Q58(a[36], b[38]) + IFX_MATQ31_Q58(a[37], b[46])
+        + IFX_MATQ31_Q58(a[38], b[54]) + IFX_MATQ31_Q58(a[39], b[62]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], b[7]) + IFX_MATQ31_Q58(a[33], b[15]) + IFX_MATQ31_Q58(a[34], b[23])
+        + IFX_MATQ31_Q58(a[35], b[31]) + IFX_MATQ31_Q58(a[36], b[39]) + IFX_MATQ31_Q58(a[37], b[47])
+        + IFX_MATQ31_Q58(a[38], b[55]) + IFX_MATQ31_Q58(a[39], b[63]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[0]) + IFX_MATQ31_Q58(a[41], b[8]) + IFX_MATQ31_Q58(a[42], b[16])
+        + IFX_MATQ31_Q58(a[43], b[24]) + IFX_MATQ31_Q58(a[44], b[32]) + IFX_MATQ31_Q58(a[45], b[40])
+        + IFX_MATQ31_Q58(a[46], b[48]) + IFX_MATQ31_Q58(a[47], b[56]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[1]) + IFX_MATQ31_Q58(a[41], b[9]) + IFX_MATQ31_Q58(a[42], b[17])
+        + IFX_MATQ31_Q58(a[43], b[25]) + IFX_MATQ31_Q58(a[44], b[33]) + IFX_MATQ31_Q58(a[45], b[41])
+        + IFX_MATQ31_Q58(a[46], b[49]) + IFX_MATQ31_Q58(a[47], b[57]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[2]) + IFX_MATQ31_Q58(a[41], b[10]) + IFX_MATQ31_Q58(a[42], b[18])
+        + IFX_MATQ31_Q58(a[43], b[26]) + IFX_MATQ31_Q58(a[44], b[34]) + IFX_MATQ31_Q58(a[45], b[42])
+        + IFX_MATQ31_Q58(a[46], b[50]) + IFX_MATQ31_Q58(a[47], b[58]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[3]) + IFX_MATQ31_Q58(a[41], b[11]) + IFX_MATQ31_Q58(a[42], b[19])
+        + IFX_MATQ31_Q58(a[43], b[27]) + IFX_MATQ31_Q58(a[44], b[35]) + IFX_MATQ31_Q58(a[45], b[43])
+        + IFX_MATQ31_Q58(a[46], b[51]) + IFX_MATQ31_Q58(a[47], b[59]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[4]) + IFX_MATQ31_Q58(a[41], b[12]) + IFX_MATQ31_Q58(a[42], b[20])
+        + IFX_MATQ31_Q58(a[43], b[28]) + IFX_MATQ31_Q58(a[44], b[36]) + IFX_MATQ31_Q58(a[45], b[44])
+        + IFX_MATQ31_Q58(a[46], b[52]) + IFX_MATQ31_Q58(a[47], b[60]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[5]) + IFX_MATQ31_Q58(a[41], b[13]) + IFX_MATQ31_Q58(a[42], b[21])
+        + IFX_MATQ31_Q58(a[43], b[29]) + IFX_MATQ31_Q58(a[44], b[37]) + IFX_MATQ31_Q58(a[45], b[45])
+        + IFX_MATQ31_Q58(a[46], b[53]) + IFX_MATQ31_Q58(a[47], b[61]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[6]) + IFX_MATQ31_Q58(a[41], b[14]) + IFX_MATQ31_Q58(a[42], b[22])
+        + IFX_MATQ31_Q58(a[43], b[30]) + IFX_MATQ31_Q58(a[44], b[38]) + IFX_MATQ31_Q58(a[45], b[46])
+        + IFX_MATQ31_Q58(a[46], b[54]) + IFX_MATQ31_Q58(a[47], b[62]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[7]) + IFX_MATQ31_Q58(a[41], b[15]) + IFX_MATQ31_Q58(a[42], b[23])
+        + IFX_MATQ31_Q58(a[43], b[31]) + IFX_MATQ31_Q58(a[44], b[39]) + IFX_MATQ31_Q58(a[45], b[47])
+        + IFX_MATQ31_Q58(a[46], b[55]) + IFX_MATQ31_Q58(a[47], b[63]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[0]) + IFX_MATQ31_Q58(a[49], b[8]) + IFX_MATQ31_Q58(a[50], b[16])
+        + IFX_MATQ31_Q58(a[51], b[24]) + IFX_MATQ31_Q58(a[52], b[32]) + IFX_MATQ31_Q58(a[53], b[40])
+        + IFX_MATQ31_Q58(a[54], b[48]) + IFX_MATQ31_Q58(a[55], b[56]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[1]) + IFX_MATQ31_Q58(a[49], b[9]) + IFX_MATQ31_Q58(a[50], b[17])
+        + IFX_MATQ31_Q58(a[51], b[25]) + IFX_MATQ31_Q58(a[52], b[33]) + IFX_MATQ31_Q58(a[53], b[41])
+        + IFX_MATQ31_Q58(a[54], b[49]) + IFX_MATQ31_Q58(a[55], b[57]);
+    c[49] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[2]) + IFX_MATQ31_Q58(a[49], b[10]) + IFX_MATQ31_Q58(a[50], b[18])
+        + IFX_MATQ31_Q58(a[51], b[26]) + IFX_MATQ31_Q58(a[52], b[34]) + IFX_MATQ31_Q58(a[53], b[42])
+        + IFX_MATQ31_Q58(a[54], b[50]) + IFX_MATQ31_Q58(a[55], b[58]);
+    c[50] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[3]) + IFX_MATQ31_Q58(a[49], b[11]) + IFX_MATQ31_Q58(a[50], b[19])
+        + IFX_MATQ31_Q58(a[51], b[27]) + IFX_MATQ31_Q58(a[52], b[35]) + IFX_MATQ31_Q58(a[53], b[43])
+        + IFX_MATQ31_Q58(a[54], b[51]) + IFX_MATQ31_Q58(a[55], b[59]);
+    c[51] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[4]) + IFX_MATQ31_Q58(a[49], b[12]) + IFX_MATQ31_Q58(a[50], b[20])
+        + IFX_MATQ31_Q58(a[51], b[28]) + IFX_MATQ31_Q58(a[52], b[36]) + IFX_MATQ31_Q58(a[53], b[44])
+        + IFX_MATQ31_Q58(a[54], b[52]) + IFX_MATQ31_Q58(a[55], b[60]);
+    c[52] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[5]) + IFX_MATQ31_Q58(a[49], b[13]) + IFX_MATQ31_Q58(a[50], b[21])
+        + IFX_MATQ31_Q58(a[51], b[29]) + IFX_MATQ31_Q58(a[52], b[37]) + IFX_MATQ31_Q58(a[53], b[45])
+        + IFX_MATQ31_Q58(a[54], b[53]) + IFX_MATQ31_Q58(a[55], b[61]);
+    c[53] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[6]) + IFX_MATQ31_Q58(a[49], b[14]) + IFX_MATQ31_Q58(a[50], b[22])
+        + IFX_MATQ31_Q58(a[51], b[30]) + IFX_MATQ31_Q58(a[52], b[38]) + IFX_MATQ31_Q58(a[53], b[46])
+        + IFX_MATQ31_Q58(a[54], b[54]) + IFX_MATQ31_Q58(a[55], b[62]);
+    c[54] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[7]) + IFX_MATQ31_Q58(a[49], b[15]) + IFX_MATQ31_Q58(a[50], b[23])
+        + IFX_MATQ31_Q58(a[51], b[31]) + IFX_MATQ31_Q58(a[52], b[39]) + IFX_MATQ31_Q58(a[53], b[47])
+        + IFX_MATQ31_Q58(a[54], b[55]) + IFX_MATQ31_Q58(a[55], b[63]);
+    c[55] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[0]) + IFX_MATQ31_Q58(a[57], b[8]) + IFX_MATQ31_Q58(a[58], b[16])
+        + IFX_MATQ31_Q58(a[59], b[24]) + IFX_MATQ31_Q58(a[60], b[32]) + IFX_MATQ31_Q58(a[61], b[40])
+        + IFX_MATQ31_Q58(a[62], b[48]) + IFX_MATQ31_Q58(a[63], b[56]);
+    c[56] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[1]) + IFX_MATQ31_Q58(a[57], b[9]) + IFX_MATQ31_Q58(a[58], b[17])
+        + IFX_MATQ31_Q58(a[59], b[25]) + IFX_MATQ31_Q58(a[60], b[33]) + IFX_MATQ31_Q58(a[61], b[41])
+        + IFX_MATQ31_Q58(a[62], b[49]) + IFX_MATQ31_Q58(a[63], b[57]);
+    c[57] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[2]) + IFX_MATQ31_Q58(a[57], b[10]) + IFX_MATQ31_Q58(a[58], b[18])
+        + IFX_MATQ31_Q58(a[59], b[26]) + IFX_MATQ31_Q58(a[60], b[34]) + IFX_MATQ31_Q58(a[61], b[42])
+        + IFX_MATQ31_Q58(a[62], b[50]) + IFX_MATQ31_Q58(a[63], b[58]);
+    c[58] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[3]) + IFX_MATQ31_Q58(a[57], b[11]) + IFX_MATQ31_Q58(a[58], b[19])
+        + IFX_MATQ31_Q58(a[59], b[27]) + IFX_MATQ31_Q58(a[60], b[35]) + IFX_MATQ31_Q58(a[61], b[43])
+        + IFX_MATQ31_Q58(a[62], b[51]) + IFX_MATQ31_Q58(a[63], b[59]);
+    c[59] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[4]) + IFX_MATQ31_Q58(a[57], b[12]) + IFX_MATQ31_Q58(a[58], b[20])
+        + IFX_MATQ31_Q58(a[59], b[28]) + IFX_MATQ31_Q58(a[60], b[36]) + IFX_MATQ31_Q58(a[61], b[44])
+        + IFX_MATQ31_Q58(a[62], b[52]) + IFX_MATQ31_Q58(a[63], b[60]);
+    c[60] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[5]) + IFX_MATQ31_Q58(a[57], b[13]) + IFX_MATQ31_Q58(a[58], b[21])
+        + IFX_MATQ31_Q58(a[59], b[29]) + IFX_MATQ31_Q58(a[60], b[37]) + IFX_MATQ31_Q58(a[61], b[45])
+        + IFX_MATQ31_Q58(a[62], b[53]) + IFX_MATQ31_Q58(a[63], b[61]);
+    c[61] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[6]) + IFX_MATQ31_Q58(a[57], b[14]) + IFX_MATQ31_Q58(a[58], b[22])
+        + IFX_MATQ31_Q58(a[59], b[30]) + IFX_MATQ31_Q58(a[60], b[38]) + IFX_MATQ31_Q58(a[61], b[46])
+        + IFX_MATQ31_Q58(a[62], b[54]) + IFX_MATQ31_Q58(a[63], b[62]);
+    c[62] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], b[7]) + IFX_MATQ31_Q58(a[57], b[15]) + IFX_MATQ31_Q58(a[58], b[23])
+        + IFX_MATQ31_Q58(a[59], b[31]) + IFX_MATQ31_Q58(a[60], b[39]) + IFX_MATQ31_Q58(a[61], b[47])
+        + IFX_MATQ31_Q58(a[62], b[55]) + IFX_MATQ31_Q58(a[63], b[63]);
+    c[63] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec8(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]) + IFX_MATQ31_Q58(a[7], x[7]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[8], x[0]) + IFX_MATQ31_Q58(a[9], x[1]) + IFX_MATQ31_Q58(a[10], x[2])
+        + IFX_MATQ31_Q58(a[11], x[3]) + IFX_MATQ31_Q58(a[12], x[4]) + IFX_MATQ31_Q58(a[13], x[5])
+        + IFX_MATQ31_Q58(a[14], x[6]) + IFX_MATQ31_Q58(a[15], x[7]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[16], x[0]) + IFX_MATQ31_Q58(a[17], x[1]) + IFX_MATQ31_Q58(a[18], x[2])
+        + IFX_MATQ31_Q58(a[19], x[3]) + IFX_MATQ31_Q58(a[20], x[4]) + IFX_MATQ31_Q58(a[21], x[5])
+        + IFX_MATQ31_Q58(a[22], x[6]) + IFX_MATQ31_Q58(a[23], x[7]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], x[0]) + IFX_MATQ31_Q58(a[25], x[1]) + IFX_MATQ31_Q58(a[26], x[2])
+        + IFX_MATQ31_Q58(a[27], x[3]) + IFX_MATQ31_Q58(a[28], x[4]) + IFX_MATQ31_Q58(a[29], x[5])
+        + IFX_MATQ31_Q58(a[30], x[6]) + IFX_MATQ31_Q58(a[31], x[7]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[32], x[0]) + IFX_MATQ31_Q58(a[33], x[1]) + IFX_MATQ31_Q58(a[34], x[2])
+        + IFX_MATQ31_Q58(a[35], x[3]) + IFX_MATQ31_Q58(a[36], x[4]) + IFX_MATQ31_Q58(a[37], x[5])
+        + IFX_MATQ31_Q58(a[38], x[6]) + IFX_MATQ31_Q58(a[39], x[7]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], x[0]) + IFX_MATQ31_Q58(a[41], x[1]) + IFX_MATQ31_Q58(a[42], x[2])
+        + IFX_MATQ31_Q58(a[43], x[3]) + IFX_MATQ31_Q58(a[44], x[4]) + IFX_MATQ31_Q58(a[45], x[5])
+        + IFX_MATQ31_Q58(a[46], x[6]) + IFX_MATQ31_Q58(a[47], x[7]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], x[0]) + IFX_MATQ31_Q58(a[49], x[1]) + IFX_MATQ31_Q58(a[50], x[2])
+        + IFX_MATQ31_Q58(a[51], x[3]) + IFX_MATQ31_Q58(a[52], x[4]) + IFX_MATQ31_Q58(a[53], x[5])
+        + IFX_MATQ31_Q58(a[54], x[6]) + IFX_MATQ31_Q58(a[55], x[7]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[56], x[0]) + IFX_MATQ31_Q58(a[57], x[1]) + IFX_MATQ31_Q58(a[58], x[2])
+        + IFX_MATQ31_Q58(a[59], x[3]) + IFX_MATQ31_Q58(a[60], x[4]) + IFX_MATQ31_Q58(a[61], x[5])
+        + IFX_MATQ31_Q58(a[62], x[6]) + IFX_MATQ31_Q58(a[63], x[7]);
+    y[7] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add9(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+    c[49] = Ifx_MatQ31_saturate((sint64)a[49] + b[49]);
+    c[50] = Ifx_MatQ31_saturate((sint64)a[50] + b[50]);
+    c[51] = Ifx_MatQ31_saturate((sint64)a[51] + b[51]);
+    c[52] = Ifx_MatQ31_saturate((sint64)a[52] + b[52]);
+    c[53] = Ifx_MatQ31_saturate((sint64)a[53] + b[53]);
+    c[54] = Ifx_MatQ31_saturate((sint64)a[54] + b[54]);
+    c[55] = Ifx_MatQ31_saturate((sint64)a[55] + b[55]);
+    c[56] = Ifx_MatQ31_saturate((sint64)a[56] + b[56]);
+    c[57] = Ifx_MatQ31_saturate((sint64)a[57] + b[57]);
+    c[58] = Ifx_MatQ31_saturate((sint64)a[58] + b[58]);
+    c[59] = Ifx_MatQ31_saturate((sint64)a[59] + b[59]);
+    c[60] = Ifx_MatQ31_saturate((sint64)a[60] + b[60]);
+    c[61] = Ifx_MatQ31_saturate((sint64)a[61] + b[61]);
+    c[62] = Ifx_MatQ31_saturate((sint64)a[62] + b[62]);
+    c[63] = Ifx_MatQ31_saturate((sint64)a[63] + b[63]);
+    c[64] = Ifx_MatQ31_saturate((sint64)a[64] + b[64]);
+    c[65] = Ifx_MatQ31_saturate((sint64)a[65] + b[65]);
+    c[66] = Ifx_MatQ31_saturate((sint64)a[66] + b[66]);
+    c[67] = Ifx_MatQ31_saturate((sint64)a[67] + b[67]);
+    c[68] = Ifx_MatQ31_saturate((sint64)a[68] + b[68]);
+    c[69] = Ifx_MatQ31_saturate((sint64)a[69] + b[69]);
+    c[70] = Ifx_MatQ31_saturate((sint64)a[70] + b[70]);
+    c[71] = Ifx_MatQ31_saturate((sint64)a[71] + b[71]);
+    c[72] = Ifx_MatQ31_saturate((sint64)a[72] + b[72]);
+    c[73] = Ifx_MatQ31_saturate((sint64)a[73] + b[73]);
+    c[74] = Ifx_MatQ31_saturate((sint64)a[74] + b[74]);
+    c[75] = Ifx_MatQ31_saturate((sint64)a[75] + b[75]);
+    c[76] = Ifx_MatQ31_saturate((sint64)a[76] + b[76]);
+    c[77] = Ifx_MatQ31_saturate((sint64)a[77] + b[77]);
+    c[78] = Ifx_MatQ31_saturate((sint64)a[78] + b[78]);
+    c[79] = Ifx_MatQ31_saturate((sint64)a[79] + b[79]);
+    c[80] = Ifx_MatQ31_saturate((sint64)a[80] + b[80]);
+}
+
+
+void Ifx_MatQ31_transpose9(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[9];
+    c[2] = a[18];
+    c[3] = a[27];
+    c[4] = a[36];
+    c[5] = a[45];
+    c[6] = a[54];
+    c[7] = a[63];
+    c[8] = a[72];
+    c[9] = a[1];
+    c[10] = a[10];
+    c[11] = a[19];
+    c[12] = a[28];
+    c[13] = a[37];
+    c[14] = a[46];
+    c[15] = a[55];
+    c[16] = a[64];
+    c[17] = a[73];
+    c[18] = a[2];
+    c[19] = a[11];
+    c[20] = a[20];
+    c[21] = a[29];
+    c[22] = a[38];
+    c[23] = a[47];
+    c[24] = a[56];
+    c[25] = a[65];
+    c[26] = a[74];
+    c[27] = a[3];
+    c[28] = a[12];
+    c[29] = a[21];
+    c[30] = a[30];
+    c[31] = a[39];
+    c[32] = a[48];
+    c[33] = a[57];
+    c[34] = a[66];
+    c[35] = a[75];
+    c[36] = a[4];
+    c[37] = a[13];
+    c[38] = a[22];
+    c[39] = a[31];
+    c[40] = a[40];
+    c[41] = a[49];
+    c[42] = a[58];
+    c[43] = a[67];
+    c[44] = a[76];
+    c[45] = a[5];
+    c[46] = a[14];
+    c[47] = a[23];
+    c[48] = a[32];
+    c[49] = a[41];
+    c[50] = a[50];
+    c[51] = a[59];
+    c[52] = a[68];
+    c[53] = a[77];
+    c[54] = a[6];
+    c[55] = a[15];
+    c[56] = a[24];
+    c[57] = a[33];
+    c[58] = a[42];
+    c[59] = a[51];
+    c[60] = a[60];
+    c[61] = a[69];
+    c[62] = a[78];
+    c[63] = a[7];
+    c[64] = a[16];
+    c[65] = a[25];
+    c[66] = a[34];
+    c[67] = a[43];
+    c[68] = a[52];
+    c[69] = a[61];
+    c[70] = a[70];
+    c[71] = a[79];
+    c[72] = a[8];
+    c[73] = a[17];
+    c[74] = a[26];
+    c[75] = a[35];
+    c[76] = a[44];
+    c[77] = a[53];
+    c[78] = a[62];
+    c[79] = a[71];
+    c[80] = a[80];
+}
+
+
+void Ifx_MatQ31_mul9(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[9]) + IFX_MATQ31_Q58(a[2], b[18])
+        + IFX_MATQ31_Q58(a[3], b[27]) + IFX_MATQ31_Q58(a[4], b[36]) + IFX_MATQ31_Q58(a[5], b[45])
+        + IFX_MATQ31_Q58(a[6], b[54]) + IFX_MATQ31_Q58(a[7], b[63]) + IFX_MATQ31_Q58(a[8], b[72]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[10]) + IFX_MATQ31_Q58(a[2], b[19])
+        + IFX_MATQ31_Q58(a[3], b[28]) + IFX_MATQ31_Q58(a[4], b[37]) + IFX_MATQ31_Q58(a[5], b[46])
+        + IFX_MATQ31_Q58(a[6], b[55]) + IFX_MATQ31_Q58(a[7], b[64]) + IFX_MATQ31_Q58(a[8], b[73]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[20])
+        + IFX_MATQ31_Q58(a[3], b[29]) + IFX_MATQ31_Q58(a[4], b[38]) + IFX_MATQ31_Q58(a[5], b[47])
+        + IFX_MATQ31_Q58(a[6], b[56]) + IFX_MATQ31_Q58(a[7], b[65]) + IFX_MATQ31_Q58(a[8], b[74]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[21])
+        + IFX_MATQ31_Q58(a[3], b[30]) + IFX_MATQ31_Q58(a[4], b[39]) + IFX_MATQ31_Q58(a[5], b[48])
+        + IFX_MATQ31_Q58(a[6], b[57]) + IFX_MATQ31_Q58(a[7], b[66]) + IFX_MATQ31_Q58(a[8], b[75]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[22])
+        + IFX_MATQ31_Q58(a[3], b[31]) + IFX_MATQ31_Q58(a[4], b[40]) + IFX_MATQ31_Q58(a[5], b[49])
+        + IFX_MATQ31_Q58(a[6], b[58]) + IFX_MATQ31_Q58(a[7], b[67]) + IFX_MATQ31_Q58(a[8], b[76]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[14]) + IFX_MATQ31_Q58(a[2], b[23])
+        + IFX_MATQ31_Q58(a[3], b[32]) + IFX_MATQ31_Q58(a[4], b[41]) + IFX_MATQ31_Q58(a[5], b[50])
+        + IFX_MATQ31_Q58(a[6], b[59]) + IFX_MATQ31_Q58(a[7], b[68]) + IFX_MATQ31_Q58(a[8], b[77]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[15]) + IFX_MATQ31_Q58(a[2], b[24])
+        + IFX_MATQ31_Q58(a[3], b[33]) + IFX_MATQ31_Q58(a[4], b[42]) + IFX_MATQ31_Q58(a[5], b[51])
+        + IFX_MATQ31_Q58(a[6], b[60]) + IFX_MATQ31_Q58(a[7], b[69]) + IFX_MATQ31_Q58(a[8], b[78]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[7]) + IFX_MATQ31_Q58(a[1], b[16]) + IFX_MATQ31_Q58(a[2], b[25])
+        + IFX_MATQ31_Q58(a[3], b[34]) + IFX_MATQ31_Q58(a[4], b[43]) + IFX_MATQ31_Q58(a[5], b[52])
+        + IFX_MATQ31_Q58(a[6], b[61]) + IFX_MATQ31_Q58(a[7], b[70]) + IFX_MATQ31_Q58(a[8], b[79]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[8]) + IFX_MATQ31_Q58(a[1], b[17]) + IFX_MATQ31_Q58(a[2], b[26])
+        + IFX_MATQ31_Q58(a[3], b[35]) + IFX_MATQ31_Q58(a[4], b[44]) + IFX_MATQ31_Q58(a[5], b[53])
+        + IFX_MATQ31_Q58(a[6], b[62]) + IFX_MATQ31_Q58(a[7], b[71]) + IFX_MATQ31_Q58(a[8], b[80]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[0]) + IFX_MATQ31_Q58(a[10], b[9]) + IFX_MATQ31_Q58(a[11], b[18])
+        + IFX_MATQ31_Q58(a[12], b[27]) + IFX_MATQ31_Q58(a[13], b[36]) + IFX_MATQ31_Q58(a[14], b[45])
+        + IFX_MATQ31_Q58(a[15], b[54]) + IFX_MATQ31_Q58(a[16], b[63]) + IFX_MATQ31_Q58(a[17], b[72]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[1]) + IFX_MATQ31_Q58(a[10], b[10]) + IFX_MATQ31_Q58(a[11], b[19])
+        + IFX_MATQ31_Q58(a[12], b[28]) + IFX_MATQ31_Q58(a[13], b[37]) + IFX_MATQ31_Q58(a[14], b[46])
+        + IFX_MATQ31_Q58(a[15], b[55]) + IFX_MATQ31_Q58(a[16], b[64]) + IFX_MATQ31_Q58(a[17], b[73]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[2]) + IFX_MATQ31_Q58(a[10], b[11]) + IFX_MATQ31_Q58(a[11], b[20])
+        + IFX_MATQ31_Q58(a[12], b[29]) + IFX_MATQ31_Q58(a[13], b[38]) + IFX_MATQ31_Q58(a[14], b[47])
+        + IFX_MATQ31_Q58(a[15], b[56]) + IFX_MATQ31_Q58(a[16], b[65]) + IFX_MATQ31_Q58(a[17], b[74]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[3]) + IFX_MATQ31_Q58(a[10], b[12]) + IFX_MATQ31_Q58(a[11], b[21])
+        + IFX_MATQ31_Q58(a[12], b[30]) + IFX_MATQ31_Q58(a[13], b[39]) + IFX_MATQ31_Q58(a[14], b[48])
+        + IFX_MATQ31_Q58(a[15], b[57]) + IFX_MATQ31_Q58(a[16], b[66]) + IFX_MATQ31_Q58(a[17], b[75]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[4]) + IFX_MATQ31_Q58(a[10], b[13]) + IFX_MATQ31_Q58(a[11], b[22])
+        + IFX_MATQ31_Q58(a[12], b[31]) + IFX_MATQ31_Q58(a[13], b[40]) + IFX_MATQ31_Q58(a[14], b[49])
+        + IFX_MATQ31_Q58(a[15], b[58]) + IFX_MATQ31_Q58(a[16], b[67]) + IFX_MATQ31_Q58(a[17], b[76]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[5]) + IFX_MATQ31_Q58(a[10], b[14]) + IFX_MATQ31_Q58(a[11], b[23])
+        + IFX_MATQ31_Q58(a[12], b[32]) + IFX_MATQ31_Q58(a[13], b[41]) + IFX_MATQ31_Q58(a[14], b[50])
+        + IFX_MATQ31_Q58(a[15], b[59]) + IFX_MATQ31_Q58(a[16], b[68]) + IFX_MATQ31_Q58(a[17], b[77]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[6]) + IFX_MATQ31_Q58(a[10], b[15]) + IFX_MATQ31_Q58(a[11], b[24])
+        + IFX_MATQ31_Q58(a[12], b[33]) + IFX_MATQ31_Q58(a[13], b[42]) + IFX_MATQ31_Q58(a[14], b[51])
+        + IFX_MATQ31_Q58(a[15], b[60]) + IFX_MATQ31_Q58(a[16], b[69]) + IFX_MATQ31_Q58(a[17], b[78]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[7]) + IFX_MATQ31_Q58(a[10], b[16]) + IFX_MATQ31_Q58(a[11], b[25])
+        + IFX_MATQ31_Q58(a[12], b[34]) + IFX_MATQ31_Q58(a[13], b[43]) + IFX_MATQ31_Q58(a[14], b[52])
+        + IFX_MATQ31_Q58(a[15], b[61]) + IFX_MATQ31_Q58(a[16], b[70]) + IFX_MATQ31_Q58(a[17], b[79]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], b[8]) + IFX_MATQ31_Q58(a[10], b[17]) + IFX_MATQ31_Q58(a[11], b[26])
+        + IFX_MATQ31_Q58(a[12], b[35]) + IFX_MATQ31_Q58(a[13], b[44]) + IFX_MATQ31_Q58(a[14], b[53])
+        + IFX_MATQ31_Q58(a[15], b[62]) + IFX_MATQ31_Q58(a[16], b[71]) + IFX_MATQ31_Q58(a[17], b[80]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[0]) + IFX_MATQ31_Q58(a[19], b[9]) + IFX_MATQ31_Q58(a[20], b[18])
+        + IFX_MATQ31_Q58(a[21], b[27]) + IFX_MATQ31_Q58(a[22], b[36]) + IFX_MATQ31_Q58(a[23], b[45])
+        + IFX_MATQ31_Q58(a[24], b[54]) + IFX_MATQ31_Q58(a[25], b[63]) + IFX_MATQ31_Q58(a[26], b[72]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[1]) + IFX_MATQ31_Q58(a[19], b[10]) + IFX_MATQ31_Q58(a[20], b[19])
+        + IFX_MATQ31_Q58(a[21], b[28]) + IFX_MATQ31_Q58(a[22], b[37]) + IFX_MATQ31_Q58(a[23], b[46])
+        + IFX_MATQ31_Q58(a[24], b[55]) + IFX_MATQ31_Q58(a[25], b[64]) + IFX_MATQ31_Q58(a[26], b[73]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[2]) + IFX_MATQ31_Q58(a[19], b[11]) + IFX_MATQ31_Q58(a[20], b[20])
+        + IFX_MATQ31_Q58(a[21], b[29]) + IFX_MATQ31_Q58(a[22], b[38]) + IFX_MATQ31_Q58(a[23], b[47])
+        + IFX_MATQ31_Q58(a[24], b[56]) + IFX_MATQ31_Q58(a[25], b[65]) + IFX_MATQ31_Q58(a[26], b[74]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[3]) + IFX_MATQ31_Q58(a[19], b[12]) + IFX_MATQ31_Q58(a[20], b[21])
+        + IFX_MATQ31_Q58(a[21], b[30]) + IFX_MATQ31_Q58(a[22], b[39]) + IFX_MATQ31_Q58(a[23], b[48])
+        + IFX_MATQ31_Q58(a[24], b[57]) + IFX_MATQ31_Q58(a[25], b[66]) + IFX_MATQ31_Q58(a[26], b[75]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[4]) + IFX_MATQ31_Q58(a[19], b[13]) + IFX_MATQ31_Q58(a[20], b[22])
+        + IFX_MATQ31_Q58(a[21], b[31]) + IFX_MATQ31_Q58(a[22], b[40]) + IFX_MATQ31_Q58(a[23], b[49])
+        + IFX_MATQ31_Q58(a[24], b[58]) + IFX_MATQ31_Q58(a[25], b[67]) + IFX_MATQ31_Q58(a[26], b[76]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[5]) + IFX_MATQ31_Q58(a[19], b[14]) + IFX_MATQ31_Q58(a[20], b[23])
+        + IFX_MATQ31_Q58(a[21], b[32]) + IFX_MATQ31_Q58(a[22], b[41]) + IFX_MATQ31_Q58(a[23], b[50])
+        + IFX_MATQ31_Q58(a[24], b[59]) + IFX_MATQ31_Q58(a[25], b[68]) + IFX_MATQ31_Q58(a[26], b[77]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[6]) + IFX_MATQ31_Q58(a[19], b[15]) + IFX_MATQ31_Q58(a[20], b[24])
+        + IFX_MATQ31_Q58(a[21], b[33]) + IFX_MATQ31_Q58(a[22], b[42]) + IFX_MATQ31_Q58(a[23], b[51])
+        + IFX_MATQ31_Q58(a[24], b[60]) + IFX_MATQ31_Q58(a[25], b[69]) + IFX_MATQ31_Q58(a[26], b[78]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[7]) + IFX_MATQ31_Q58(a[19], b[16]) + IFX_MATQ31_Q58(a[20], b[25])
+        + IFX_MATQ31_Q58(a[21], b[34]) + IFX_MATQ31_Q58(a[22], b[43]) + IFX_MATQ31_Q58(a[23], b[52])
+        + IFX_MATQ31_Q58(a[24], b[61]) + IFX_MATQ31_Q58(a[25], b[70]) + IFX_MATQ31_Q58(a[26], b[79]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], b[8]) + IFX_MATQ31_Q58(a[19], b[17]) + IFX_MATQ31_Q58(a[20], b[26])
+        + IFX_MATQ31_Q58(a[21], b[35]) + IFX_MATQ31_Q58(a[22], b[44]) + IFX_MATQ31_Q58(a[23], b[53])
+        + IFX_MATQ31_Q58(a[24], b[62]) + IFX_MATQ31_Q58(a[25], b[71]) + IFX_MATQ31_Q58(a[26], b[80]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[0]) + IFX_MATQ31_Q58(a[28], b[9]) + IFX_MATQ31_Q58(a[29], b[18])
+        + IFX_MATQ31_Q58(a[30], b[27]) + IFX_MATQ31_Q58(a[31], b[36]) + IFX_MATQ31_Q58(a[32], b[45])
+        + IFX_MATQ31_Q58(a[33], b[54]) + IFX_MATQ31_Q58(a[34], b[63]) + IFX_MATQ31_Q58(a[35], b[72]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[1]) + IFX_MATQ31_Q58(a[28], b[10]) + IFX_MATQ31_Q58(a[29], b[19])
+        + IFX_MATQ31_Q58(a[30], b[28]) + IFX_MATQ31_Q58(a[31], b[37]) + IFX_MATQ31_Q58(a[32], b[46])
+        + IFX_MATQ31_Q58(a[33], b[55]) + IFX_MATQ31_Q58(a[34], b[64]) + IFX_MATQ31_Q58(a[35], b[73]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[2]) + IFX_MATQ31_Q58(a[28], b[11]) + IFX_MATQ31_Q58(a[29], b[20])
+        + IFX_MATQ31_Q58(a[30], b[29]) + IFX_MATQ31_Q58(a[31], b[38]) + IFX_MATQ31_Q58(a[32], b[47])
+        + IFX_MATQ31_Q58(a[33], b[56]) + IFX_MATQ31_Q58(a[34], b[65]) + IFX_MATQ31_Q58(a[35], b[74]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[3]) + IFX_MATQ31_Q58(a[28], b[12]) + IFX_MATQ31_Q58(a[29], b[21])
+        + IFX_MATQ31_Q58(a[30], b[30]) + IFX_MATQ31_Q58(a[31], b[39]) + IFX_MATQ31_Q58(a[32], b[48])
+        + IFX_MATQ31_Q58(a[33], b[57]) + IFX_MATQ31_Q58(a[34], b[66]) + IFX_MATQ31_Q58(a[35], b[75]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[4]) + IFX_MATQ31_Q58(a[28], b[13]) + IFX_MATQ31_Q58(a[29], b[22])
+        + IFX_MATQ31_Q58(a[30], b[31]) + IFX_MATQ31_Q58(a[31], b[40]) + IFX_MATQ31_Q58(a[32], b[49])
+        + IFX_MATQ31_Q58(a[33], b[58]) + IFX_MATQ31_Q58(a[34], b[67]) + IFX_MATQ31_Q58(a[35], b[76]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[5]) + IFX_MATQ31_Q58(a[28], b[14]) + IFX_MATQ31_Q58(a[29], b[23])
+        + IFX_MATQ31_Q58(a[30], b[32]) + IFX_MATQ31_Q58(a[31], b[41]) + IFX_MATQ31_Q58(a[32], b[50])
+        + IFX_MATQ31_Q58(a[33], b[59]) + IFX_MATQ31_Q58(a[34], b[68]) + IFX_MATQ31_Q58(a[35], b[77]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[6]) + IFX_MATQ31_Q58(a[28], b[15]) + IFX_MATQ31_Q58(a[29], b[24])
+        + IFX_MATQ31_Q58(a[30], b[33]) + IFX_MATQ31_Q58(a[31], b[42]) + IFX_MATQ31_Q58(a[32], b[51])
+        + IFX_MATQ31_Q58(a[33], b[60]) + IFX_MATQ31_Q58(a[34], b[69]) + IFX_MATQ31_Q58(a[35], b[78]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[7]) + IFX_MATQ31_Q58(a[28], b[16]) + IFX_MATQ31_Q58(a[29], b[25])
+        + IFX_MATQ31_Q58(a[30], b[34]) + IFX_MATQ31_Q58(a[31], b[43]) + IFX_MATQ31_Q58(a[32], b[52])
+        + IFX_MATQ31_Q58(a[33], b[61]) + IFX_MATQ31_Q58(a[34], b[70]) + IFX_MATQ31_Q58(a[35], b[79]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], b[8]) + IFX_MATQ31_Q58(a[28], b[17]) + IFX_MATQ31_Q58(a[29], b[26])
+        + IFX_MATQ31_Q58(a[30], b[35]) + IFX_MATQ31_Q58(a[31], b[44]) + IFX_MATQ31_Q58(a[32], b[53])
+        + IFX_MATQ31_Q58(a[33], b[62]) + IFX_MATQ31_Q58(a[34], b[71]) + IFX_MATQ31_Q58(a[35], b[80]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[0]) + IFX_MATQ31_Q58(a[37], b[9]) + IFX_MATQ31_Q58(a[38], b[18])
+        + IFX_MATQ31_Q58(a[39], b[27]) + IFX_MATQ31_Q58(a[40], b[36]) + IFX_MATQ31_Q58(a[41], b[45])
+        + IFX_MATQ31_Q58(a[42], b[54]) + IFX_MATQ31_Q58(a[43], b[63]) + IFX_MATQ31_Q58(a[44], b[72]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[1]) + IFX_MATQ31_Q58(a[37], b[10]) + IFX_MATQ31_Q58(a[38], b[19])
+        + IFX_MATQ31_Q58(a[39], b[28]) + IFX_MATQ31_Q58(a[40], b[37]) + IFX_MATQ31_Q58(a[41], b[46])
+        + IFX_MATQ31_Q58(a[42], b[55]) + IFX_MATQ31_Q58(a[43], b[64]) + IFX_MATQ31_Q58(a[44], b[73]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[2]) + IFX_MATQ31_Q58(a[37], b[11]) + IFX_MATQ31_Q58(a[38], b[20])
+        + IFX_MATQ31_Q58(a[39], b[29]) + IFX_MATQ31_Q58(a[40], b[38]) + IFX_MATQ31_Q58(a[41], b[47])
+        + IFX_MATQ31_Q58(a[42], b[56]) + IFX_MATQ31_Q58(a[43], b[65]) + IFX_MATQ31_Q58(a[44], b[74]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[3]) + IFX_MATQ31_Q58(a[37], b[12]) + IFX_MATQ31_Q58(a[38], b[21])
+        + IFX_MATQ31_Q58(a[39], b[30]) + IFX_MATQ31_Q58(a[40], b[39]) + IFX_MATQ31_Q58(a[41], b[48])
+        + IFX_MATQ31_Q58(a[42], b[57]) + IFX_MATQ31_Q58(a[43], b[66]) + IFX_MATQ31_Q58(a[44], b[75]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[4]) + IFX_MATQ31_Q58(a[37], b[13]) + IFX_MATQ31_Q58(a[38], b[22])
+        + IFX_MATQ31_Q58(a[39], b[31]) + IFX_MATQ31_Q58(a[40], b[40]) + IFX_MATQ31_Q58(a[41], b[49])
+        + IFX_MATQ31_Q58(a[42], b[58]) + IFX_MATQ31_Q58(a[43], b[67]) + IFX_MATQ31_Q58(a[44], b[76]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[5]) + IFX_MATQ31_Q58(a[37], b[14]) + IFX_MATQ31_Q58(a[38], b[23])
+        + IFX_MATQ31_Q58(a[39], b[32]) + IFX_MATQ31_Q58(a[40], b[41]) + IFX_MATQ31_Q58(a[41], b[50])
+        + IFX_MATQ31_Q58(a[42], b[59]) + IFX_MATQ31_Q58(a[43], b[68]) + IFX_MATQ31_Q58(a[44], b[77]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[6]) + IFX_MATQ31_Q58(a[37], b[15]) + IFX_MATQ31_Q58(a[38], b[24])
+        + IFX_MATQ31_Q58(a[39], b[33]) + IFX_MATQ31_Q58(a[40], b[42]) + IFX_MATQ31_Q58(a[41], b[51])
+        + IFX_MATQ31_Q58(a[42], b[60]) + IFX_MATQ31_Q58(a[43], b[69]) + IFX_MATQ31_Q58(a[44], b[78]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[7]) + IFX_MATQ31_Q58(a[37], b[16]) + IFX_MATQ31_Q58(a[38], b[25])
+        + IFX_MATQ31_Q58(a[39], b[34]) + IFX_MATQ31_Q58(a[40], b[43]) + IFX_MATQ31_Q58(a[41], b[52])
+        + IFX_MATQ31_Q58(a[42], b[61]) + IFX_MATQ31_Q58(a[43], b[70]) + IFX_MATQ31_Q58(a[44], b[79]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[8]) + IFX_MATQ31_Q58(a[37], b[17]) + IFX_MATQ31_Q58(a[38], b[26])
+        + IFX_MATQ31_Q58(a[39], b[35]) + IFX_MATQ31_Q58(a[40], b[44]) + IFX_MATQ31_Q58(a[41], b[53])
+        + IFX_MATQ31_Q58(a[42], b[62]) + IFX_MATQ31_Q58(a[43], b[71]) + IFX_MATQ31_Q58(a[44], b[80]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[0]) + IFX_MATQ31_Q58(a[46], b[9]) + IFX_MATQ31_Q58(a[47], b[18])
+        + IFX_MATQ31_Q58(a[48], b[27]) + IFX_MATQ31_Q58(a[49], b[36]) + IFX_MATQ31_Q58(a[50], b[45])
+        + IFX_MATQ31_Q58(a[51], b[54]) + IFX_MATQ31_Q58(a[52], b[63]) + IFX_MATQ31_Q58(a[53], b[72]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[1]) + IFX_MATQ31_Q58(a[46], b[10]) + IFX_MATQ31_Q58(a[47], b[19])
+        + IFX_MATQ31_Q58(a[48], b[28]) + IFX_MATQ31_Q58(a[49], b[37]) + IFX_MATQ31_Q58(a[50], b[46])
+        + IFX_MATQ31_Q58(a[51], b[55]) + IFX_MATQ31_Q58(a[52], b[64]) + IFX_MATQ31_Q58(a[53], b[73]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[2]) + IFX_MATQ31_Q58(a[46], b[11]) + IFX_MATQ31_Q58(a[47], b[20])
+        + IFX_MATQ31_Q58(a[48], b[29]) + IFX_MATQ31_Q58(a[49], b[38]) + IFX_MATQ31_Q58(a[50], b[47])
+        + IFX_MATQ31_Q58(a[51], b[56]) + IFX_MATQ31_Q58(a[52], b[65]) + IFX_MATQ31_Q58(a[53], b[74]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[3]) + IFX_MATQ31_Q58(a[46], b[12]) + IFX_MATQ31_Q58(a[47], b[21])
+        + IFX_MATQ31_Q58(a[48], b[30]) + IFX_MATQ31_Q58(a[49], b[39]) + IFX_MATQ31_Q58(a[50], b[48])
+        + IFX_MATQ31_Q58(a[51], b[57]) + IFX_MATQ31_Q58(a[52], b[66]) + IFX_MATQ31_Q58(a[53], b[75]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[4]) + IFX_MATQ31_Q58(a[46], b[13]) + IFX_MATQ31_Q58(a[47], b[22])
+        + IFX_MATQ31_Q58(a[48], b[31]) + IFX_MATQ31_Q58(a[49], b[40]) + IFX_MATQ31_Q58(a[50], b[49])
+        + IFX_MATQ31_Q58(a[51], b[58]) + IFX_MATQ31_Q58(a[52], b[67]) + IFX_MATQ31_Q58(a[53], b[76]);
+    c[49] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[5]) + IFX_MATQ31_Q58(a[46], b[14]) + IFX_MATQ31_Q58(a[47], b[23])
+        + IFX_MATQ31_Q58(a[48], b[32]) + IFX_MATQ31_Q58(a[49], b[41]) + IFX_MATQ31_Q58(a[50], b[50])
+        + IFX_MATQ31_Q58(a[51], b[59]) + IFX_MATQ31_Q58(a[52], b[68]) + IFX_MATQ31_Q58(a[53], b[77]);
+    c[50] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[6]) + IFX_MATQ31_Q58(a[46], b[15]) + IFX_MATQ31_Q58(a[47], b[24])
+        + IFX_MATQ31_Q58(a[48], b[33]) + IFX_MATQ31_Q58(a[49], b[42]) + IFX_MATQ31_Q58(a[50], b[51])
+        + IFX_MATQ31_Q58(a[51], b[60]) + IFX_MATQ31_Q58(a[52], b[69]) + IFX_MATQ31_Q58(a[53], b[78]);
+    c[51] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[7]) + IFX_MATQ31_Q58(a[46], b[16]) + IFX_MATQ31_Q58(a[47], b[25])
+        + IFX_MATQ31_Q58(a[48], b[34]) + IFX_MATQ31_Q58(a[49], b[43]) + IFX_MATQ31_Q58(a[50], b[52])
+        + IFX_MATQ31_Q58(a[51], b[61]) + IFX_MATQ31_Q58(a[52], b[70]) + IFX_MATQ31_Q58(a[53], b[79]);
+    c[52] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], b[8]) + IFX_MATQ31_Q58(a[46], b[17]) + IFX_MATQ31_Q58(a[47], b[26])
+        + IFX_MATQ31_Q58(a[48], b[35]) + IFX_MATQ31_Q58(a[49], b[44]) + IFX_MATQ31_Q58(a[50], b[53])
+        + IFX_MATQ31_Q58(a[51], b[62]) + IFX_MATQ31_Q58(a[52], b[71]) + IFX_MATQ31_Q58(a[53], b[80]);
+    c[53] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[0]) + IFX_MATQ31_Q58(a[55], b[9]) + IFX_MATQ31_Q58(a[56], b[18])
+        + IFX_MATQ31_Q58(a[57], b[27]) + IFX_MATQ31_Q58(a[58], b[36]) + IFX_MATQ31_Q58(a[59], b[45])
+        + IFX_MATQ31_Q58(a[60], b[54]) + IFX_MATQ31_Q58(a[61], b[63]) + IFX_MATQ31_Q58(a[62], b[72]);
+    c[54] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[1]) + IFX_MATQ31_Q58(a[55], b[10]) + IFX_MATQ31_Q58(a[56], b[19])
+        + IFX_MATQ31_Q58(a[57], b[28]) + IFX_MATQ31_Q58(a[58], b[37]) + IFX_MATQ31_Q58(a[59], b[46])
+        + IFX_MATQ31_Q58(a[60], b[55]) + IFX_MATQ31_Q58(a[61], b[64]) + IFX_MATQ31_Q58(a[62], b[73]);
+    c[55] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[2]) + IFX_MATQ31_Q58(a[55], b[11]) + IFX_MATQ31_Q58(a[56], b[20])
+        + IFX_MATQ31_Q58(a[57], b[29]) + IFX_MATQ31_Q58(a[58], b[38]) + IFX_MATQ31_Q58(a[59], b[47])
+        + IFX_MATQ31_Q58(a[60], b[56]) + IFX_MATQ31_Q58(a[61], b[65]) + IFX_MATQ31_Q58(a[62], b[74]);
+    c[56] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[3]) + IFX_MATQ31_Q58(a[55], b[12]) + IFX_MATQ31_Q58(a[56], b[21])
+        + IFX_MATQ31_Q58(a[57], b[30]) + IFX_MATQ31_Q58(a[58], b[39]) + IFX_MATQ31_Q58(a[59], b[48])
+        + IFX_MATQ31_Q58(a[60], b[57]) + IFX_MATQ31_Q58(a[61], b[66]) + IFX_MATQ31_Q58(a[62], b[75]);
+    c[57] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[4]) + IFX_MATQ31_Q58(a[55], b[13]) + IFX_MATQ31_Q58(a[56], b[22])
+        + IFX_MATQ31_Q58(a[57], b[31]) + IFX_MATQ31_Q58(a[58], b[40]) + IFX_MATQ31_Q58(a[59], b[49])
+        + IFX_MATQ31_Q58(a[60], b[58]) + IFX_MATQ31_Q58(a[61], b[67]) + IFX_MATQ31_Q58(a[62], b[76]);
+    c[58] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[5]) + IFX_MATQ31_Q58(a[55], b[14]) + IFX_MATQ31_Q58(a[56], b[23])
+        + IFX_MATQ31_Q58(a[57], b[32]) + IFX_MATQ31_Q58(a[58], b[41]) + IFX_MATQ31_Q58(a[59], b[50])
+        + IFX_MATQ31_Q58(a[60], b[59]) + IFX_MATQ31_Q58(a[61], b[68]) + IFX_MATQ31_Q58(a[62], b[77]);
+    c[59] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[6]) + IFX_MATQ31_Q58(a[55], b[15]) + IFX_MATQ31_Q58(a[56], b[24])
+        + IFX_MATQ31_Q58(a[57], b[33]) + IFX_MATQ31_Q58(a[58], b[42]) + IFX_MATQ31_Q58(a[59], b[51])
+        + IFX_MATQ31_Q58(a[60], b[60]) + IFX_MATQ31_Q58(a[61], b[69]) + IFX_MATQ31_Q58(a[62], b[78]);
+    c[60] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[7]) + IFX_MATQ31_Q58(a[55], b[16]) + IFX_MATQ31_Q58(a[56], b[25])
+        + IFX_MATQ31_Q58(a[57], b[34]) + IFX_MATQ31_Q58(a[58], b[43]) + IFX_MATQ31_Q58(a[59], b[52])
+        + IFX_MATQ31_Q58(a[60], b[61]) + IFX_MATQ31_Q58(a[61], b[70]) + IFX_MATQ31_Q58(a[62], b[79]);
+    c[61] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], b[8]) + IFX_MATQ31_Q58(a[55], b[17]) + IFX_MATQ31_Q58(a[56], b[26])
+        + IFX_MATQ31_Q58(a[57], b[35]) + IFX_MATQ31_Q58(a[58], b[44]) + IFX_MATQ31_Q58(a[59], b[53])
+        + IFX_MATQ31_Q58(a[60], b[62]) + IFX_MATQ31_Q58(a[61], b[71]) + IFX_MATQ31_Q58(a[62], b[80]);
+    c[62] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[0]) + IFX_MATQ31_Q58(a[64], b[9]) + IFX_MATQ31_Q58(a[65], b[18])
+        + IFX_MATQ31_Q58(a[66], b[27]) + IFX_MATQ31_Q58(a[67], b[36]) + IFX_MATQ31_Q58(a[68], b[45])
+        + IFX_MATQ31_Q58(a[69], b[54]) + IFX_MATQ31_Q58(a[70], b[63]) + IFX_MATQ31_Q58(a[71], b[72]);
+    c[63] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[1]) + IFX_MATQ31_Q58(a[64], b[10]) + IFX_MATQ31_Q58(a[65], b[19])
+        + IFX_MATQ31_Q58(a[66], b[28]) + IFX_MATQ31_Q58(a[67], b[37]) + IFX_MATQ31_Q58(a[68], b[46])
+        + IFX_MATQ31_Q58(a[69], b[55]) + IFX_MATQ31_Q58(a[70], b[64]) + IFX_MATQ31_Q58(a[71], b[73]);
+    c[64] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[2]) + IFX_MATQ31_Q58(a[64], b[11]) + IFX_MATQ31_Q58(a[65], b[20])
+        + IFX_MATQ31_Q58(a[66], b[29]) + IFX_MATQ31_Q58(a[67], b[38]) + IFX_MATQ31_Q58(a[68], b[47])
+        + IFX_MATQ31_Q58(a[69], b[56]) + IFX_MATQ31_Q58(a[70], b[65]) + IFX_MATQ31_Q58(a[71], b[74]);
+    c[65] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[3]) + IFX_MATQ31_Q58(a[64], b[12]) + IFX_MATQ31_Q58(a[65], b[21])
+        + IFX_MATQ31_Q58(a[66], b[30]) + IFX_MATQ31_Q58(a[67], b[39]) + IFX_MATQ31_Q58(a[68], b[48])
+        + IFX_MATQ31_Q58(a[69], b[57]) + IFX_MATQ31_Q58(a[70], b[66]) + IFX_MATQ31_Q58(a[71], b[75]);
+    c[66] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[4]) + IFX_MATQ31_Q58(a[64], b[13]) + IFX_MATQ31_Q58(a[65], b[22])
+        + IFX_MATQ31_Q58(a[66], b[31]) + IFX_MATQ31_Q58(a[67], b[40]) + IFX_MATQ31_Q58(a[68], b[49])
+        + IFX_MATQ31_Q58(a[69], b[58]) + IFX_MATQ31_Q58(a[70], b[67]) + IFX_MATQ31_Q58(a[71], b[76]);
+    c[67] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[5]) + IFX_MATQ31_Q58(a[64], b[14]) + IFX_MATQ31_Q58(a[65], b[23])
+        + IFX_MATQ31_Q58(a[66], b[32]) + IFX_MATQ31_Q58(a[67], b[41]) + IFX_MATQ31_Q58(a[68], b[50])
+        + IFX_MATQ31_Q58(a[69], b[59]) + IFX_MATQ31_Q58(a[70], b[68]) + IFX_MATQ31_Q58(a[71], b[77]);
+    c[68] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[6]) + IFX_MATQ31_Q58(a[64], b[15]) + IFX_MATQ31_Q58(a[65], b[24])
+        + IFX_MATQ31_Q58(a[66], b[33]) + IFX_MATQ31_Q58(a[67], b[42]) + IFX_MATQ31_Q58(a[68], b[51])
+        + IFX_MATQ31_Q58(a[69], b[60]) + IFX_MATQ31_Q58(a[70], b[69]) + IFX_MATQ31_Q58(a[71], b[78]);
+    c[69] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[7]) + IFX_MATQ31_Q58(a[64], b[16]) + IFX_MATQ31_Q58(a[65], b[25])
+        + IFX_MATQ31_Q58(a[66], b[34]) + IFX_MATQ31_Q58(a[67], b[43]) + IFX_MATQ31_Q58(a[68], b[52])
+        + IFX_MATQ31_Q58(a[69], b[61]) + IFX_MATQ31_Q58(a[70], b[70]) + IFX_MATQ31_Q58(a[71], b[79]);
+    c[70] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], b[8]) + IFX_MATQ31_Q58(a[64], b[17]) + IFX_MATQ31_Q58(a[65], b[26])
+        + IFX_MATQ31_Q58(a[66], b[35]) + IFX_MATQ31_Q58(a[67], b[44]) + IFX_MATQ31_Q58(a[68], b[53])
+        + IFX_MATQ31_Q58(a[69], b[62]) + IFX_MATQ31_Q58(a[70], b[71]) + IFX_MATQ31_Q58(a[71], b[80]);
+    c[71] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[0]) + IFX_MATQ31_Q58(a[73], b[9]) + IFX_MATQ31_Q58(a[74], b[18])
+        + IFX_MATQ31_Q58(a[75], b[27]) + IFX_MATQ31_Q58(a[76], b[36]) + IFX_MATQ31_Q58(a[77], b[45])
+        + IFX_MATQ31_Q58(a[78], b[54]) + IFX_MATQ31_Q58(a[79], b[63]) + IFX_MATQ31_Q58(a[80], b[72]);
+    c[72] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[1]) + IFX_MATQ31_Q58(a[73], b[10]) + IFX_MATQ31_Q58(a[74], b[19])
+        + IFX_MATQ31_Q58(a[75], b[28]) + IFX_MATQ31_Q58(a[76], b[37]) + IFX_MATQ31_Q58(a[77], b[46])
+        + IFX_MATQ31_Q58(a[78], b[55]) + IFX_MATQ31_Q58(a[79], b[64]) + IFX_MATQ31_Q58(a[80], b[73]);
+    c[73] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[2]) + IFX_MATQ31_Q58(a[73], b[11]) + IFX_MATQ31_Q58(a[74], b[20])
+        + IFX_MATQ31_Q58(a[75], b[29]) + IFX_MATQ31_Q58(a[76], b[38]) + IFX_MATQ31_Q58(a[77], b[47])
+        + IFX_MATQ31_Q58(a[78], b[56]) + IFX_MATQ31_Q58(a[79], b[65]) + IFX_MATQ31_Q58(a[80], b[74]);
+    c[74] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[3]) + IFX_MATQ31_Q58(a[73], b[12]) + IFX_MATQ31_Q58(a[74], b[21])
+        + IFX_MATQ31_Q58(a[75], b[30]) + IFX_MATQ31_Q58(a[76], b[39]) + IFX_MATQ31_Q58(a[77], b[48])
+        + IFX_MATQ31_Q58(a[78], b[57]) + IFX_MATQ31_Q58(a[79], b[66]) + IFX_MATQ31_Q58(a[80], b[75]);
+    c[75] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[4]) + IFX_MATQ31_Q58(a[73], b[13]) + IFX_MATQ31_Q58(a[74], b[22])
+        + IFX_MATQ31_Q58(a[75], b[31]) + IFX_MATQ31_Q58(a[76], b[40]) + IFX_MATQ31_Q58(a[77], b[49])
+        + IFX_MATQ31_Q58(a[78], b[58]) + IFX_MATQ31_Q58(a[79], b[67]) + IFX_MATQ31_Q58(a[80], b[76]);
+    c[76] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[5]) + IFX_MATQ31_Q58(a[73], b[14]) + IFX_MATQ31_Q58(a[74], b[23])
+        + IFX_MATQ31_Q58(a[75], b[32]) + IFX_MATQ31_Q58(a[76], b[41]) + IFX_MATQ31_Q58(a[77], b[50])
+        + IFX_MATQ31_Q58(a[78], b[59]) + IFX_MATQ31_Q58(a[79], b[68]) + IFX_MATQ31_Q58(a[80], b[77]);
+    c[77] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[6]) + IFX_MATQ31_Q58(a[73], b[15]) + IFX_MATQ31_Q58(a[74], b[24])
+        + IFX_MATQ31_Q58(a[75], b[33]) + IFX_MATQ31_Q58(a[76], b[42]) + IFX_MATQ31_Q58(a[77], b[51])
+        + IFX_MATQ31_Q58(a[78], b[60]) + IFX_MATQ31_Q58(a[79], b[69]) + IFX_MATQ31_Q58(a[80], b[78]);
+    c[78] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[7]) + IFX_MATQ31_Q58(a[73], b[16]) + IFX_MATQ31_Q58(a[74], b[25])
+        + IFX_MATQ31_Q58(a[75], b[34]) + IFX_MATQ31_Q58(a[76], b[43]) + IFX_MATQ31_Q58(a[77], b[52])
+        + IFX_MATQ31_Q58(a[78], b[61]) + IFX_MATQ31_Q58(a[79], b[70]) + IFX_MATQ31_Q58(a[80], b[79]);
+    c[79] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[8]) + IFX_MATQ31_Q58(a[73], b[17]) + IFX_MATQ31_Q58(a[74], b[26])
+        + IFX_MATQ31_Q58(a[75], b[35]) + IFX_MATQ31_Q58(a[76], b[44]) + IFX_MATQ31_Q58(a[77], b[53])
+        + IFX_MATQ31_Q58(a[78], b[62]) + IFX_MATQ31_Q58(a[79], b[71]) + IFX_MATQ31_Q58(a[80], b[80]);
+    c[80] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec9(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]) + IFX_MATQ31_Q58(a[7], x[7]) + IFX_MATQ31_Q58(a[8], x[8]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[9], x[0]) + IFX_MATQ31_Q58(a[10], x[1]) + IFX_MATQ31_Q58(a[11], x[2])
+        + IFX_MATQ31_Q58(a[12], x[3]) + IFX_MATQ31_Q58(a[13], x[4]) + IFX_MATQ31_Q58(a[14], x[5])
+        + IFX_MATQ31_Q58(a[15], x[6]) + IFX_MATQ31_Q58(a[16], x[7]) + IFX_MATQ31_Q58(a[17], x[8]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[18], x[0]) + IFX_MATQ31_Q58(a[19], x[1]) + IFX_MATQ31_Q58(a[20], x[2])
+        + IFX_MATQ31_Q58(a[21], x[3]) + IFX_MATQ31_Q58(a[22], x[4]) + IFX_MATQ31_Q58(a[23], x[5])
+        + IFX_MATQ31_Q58(a[24], x[6]) + IFX_MATQ31_Q58(a[25], x[7]) + IFX_MATQ31_Q58(a[26], x[8]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[27], x[0]) + IFX_MATQ31_Q58(a[28], x[1]) + IFX_MATQ31_Q58(a[29], x[2])
+        + IFX_MATQ31_Q58(a[30], x[3]) + IFX_MATQ31_Q58(a[31], x[4]) + IFX_MATQ31_Q58(a[32], x[5])
+        + IFX_MATQ31_Q58(a[33], x[6]) + IFX_MATQ31_Q58(a[34], x[7]) + IFX_MATQ31_Q58(a[35], x[8]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], x[0]) + IFX_MATQ31_Q58(a[37], x[1]) + IFX_MATQ31_Q58(a[38], x[2])
+        + IFX_MATQ31_Q58(a[39], x[3]) + IFX_MATQ31_Q58(a[40], x[4]) + IFX_MATQ31_Q58(a[41], x[5])
+        + IFX_MATQ31_Q58(a[42], x[6]) + IFX_MATQ31_Q58(a[43], x[7]) + IFX_MATQ31_Q58(a[44], x[8]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[45], x[0]) + IFX_MATQ31_Q58(a[46], x[1]) + IFX_MATQ31_Q58(a[47], x[2])
+        + IFX_MATQ31_Q58(a[48], x[3]) + IFX_MATQ31_Q58(a[49], x[4]) + IFX_MATQ31_Q58(a[50], x[5])
+        + IFX_MATQ31_Q58(a[51], x[6]) + IFX_MATQ31_Q58(a[52], x[7]) + IFX_MATQ31_Q58(a[53], x[8]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[54], x[0]) + IFX_MATQ31_Q58(a[55], x[1]) + IFX_MATQ31_Q58(a[56], x[2])
+        + IFX_MATQ31_Q58(a[57], x[3]) + IFX_MATQ31_Q58(a[58], x[4]) + IFX_MATQ31_Q58(a[59], x[5])
+        + IFX_MATQ31_Q58(a[60], x[6]) + IFX_MATQ31_Q58(a[61], x[7]) + IFX_MATQ31_Q58(a[62], x[8]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[63], x[0]) + IFX_MATQ31_Q58(a[64], x[1]) + IFX_MATQ31_Q58(a[65], x[2])
+        + IFX_MATQ31_Q58(a[66], x[3]) + IFX_MATQ31_Q58(a[67], x[4]) + IFX_MATQ31_Q58(a[68], x[5])
+        + IFX_MATQ31_Q58(a[69], x[6]) + IFX_MATQ31_Q58(a[70], x[7]) + IFX_MATQ31_Q58(a[71], x[8]);
+    y[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], x[0]) + IFX_MATQ31_Q58(a[73], x[1]) + IFX_MATQ31_Q58(a[74], x[2])
+        + IFX_MATQ31_Q58(a[75], x[3]) + IFX_MATQ31_Q58(a[76], x[4]) + IFX_MATQ31_Q58(a[77], x[5])
+        + IFX_MATQ31_Q58(a[78], x[6]) + IFX_MATQ31_Q58(a[79], x[7]) + IFX_MATQ31_Q58(a[80], x[8]);
+    y[8] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add10(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+    c[49] = Ifx_MatQ31_saturate((sint64)a[49] + b[49]);
+    c[50] = Ifx_MatQ31_saturate((sint64)a[50] + b[50]);
+    c[51] = Ifx_MatQ31_saturate((sint64)a[51] + b[51]);
+    c[52] = Ifx_MatQ31_saturate((sint64)a[52] + b[52]);
+    c[53] = Ifx_MatQ31_saturate((sint64)a[53] + b[53]);
+    c[54] = Ifx_MatQ31_saturate((sint64)a[54] + b[54]);
+    c[55] = Ifx_MatQ31_saturate((sint64)a[55] + b[55]);
+    c[56] = Ifx_MatQ31_saturate((sint64)a[56] + b[56]);
+    c[57] = Ifx_MatQ31_saturate((sint64)a[57] + b[57]);
+    c[58] = Ifx_MatQ31_saturate((sint64)a[58] + b[58]);
+    c[59] = Ifx_MatQ31_saturate((sint64)a[59] + b[59]);
+    c[60] = Ifx_MatQ31_saturate((sint64)a[60] + b[60]);
+    c[61] = Ifx_MatQ31_saturate((sint64)a[61] + b[61]);
+    c[62] = Ifx_MatQ31_saturate((sint64)a[62] + b[62]);
+    c[63] = Ifx_MatQ31_saturate((sint64)a[63] + b[63]);
+    c[64] = Ifx_MatQ31_saturate((sint64)a[64] + b[64]);
+    c[65] = Ifx_MatQ31_saturate((sint64)a[65] + b[65]);
+    c[66] = Ifx_MatQ31_saturate((sint64)a[66] + b[66]);
+    c[67] = Ifx_MatQ31_saturate((sint64)a[67] + b[67]);
+    c[68] = Ifx_MatQ31_saturate((sint64)a[68] + b[68]);
+    c[69] = Ifx_MatQ31_saturate((sint64)a[69] + b[69]);
+    c[70] = Ifx_MatQ31_saturate((sint64)a[70] + b[70]);
+    c[71] = Ifx_MatQ31_saturate((sint64)a[71] + b[71]);
+    c[72] = Ifx_MatQ31_saturate((sint64)a[72] + b[72]);
+    c[73] = Ifx_MatQ31_saturate((sint64)a[73] + b[73]);
+    c[74] = Ifx_MatQ31_saturate((sint64)a[74] + b[74]);
+    c[75] = Ifx_MatQ31_saturate((sint64)a[75] + b[75]);
+    c[76] = Ifx_MatQ31_saturate((sint64)a[76] + b[76]);
+    c[77] = Ifx_MatQ31_saturate((sint64)a[77] + b[77]);
+    c[78] = Ifx_MatQ31_saturate((sint64)a[78] + b[78]);
+    c[79] = Ifx_MatQ31_saturate((sint64)a[79] + b[79]);
+    c[80] = Ifx_MatQ31_saturate((sint64)a[80] + b[80]);
+    c[81] = Ifx_MatQ31_saturate((sint64)a[81] + b[81]);
+    c[82] = Ifx_MatQ31_saturate((sint64)a[82] + b[82]);
+    c[83] = Ifx_MatQ31_saturate((sint64)a[83] + b[83]);
+    c[84] = Ifx_MatQ31_saturate((sint64)a[84] + b[84]);
+    c[85] = Ifx_MatQ31_saturate((sint64)a[85] + b[85]);
+    c[86] = Ifx_MatQ31_saturate((sint64)a[86] + b[86]);
+    c[87] = Ifx_MatQ31_saturate((sint64)a[87] + b[87]);
+    c[88] = Ifx_MatQ31_saturate((sint64)a[88] + b[88]);
+    c[89] = Ifx_MatQ31_saturate((sint64)a[89] + b[89]);
+    c[90] = Ifx_MatQ31_saturate((sint64)a[90] + b[90]);
+    c[91] = Ifx_MatQ31_saturate((sint64)a[91] + b[91]);
+    c[92] = Ifx_MatQ31_saturate((sint64)a[92] + b[92]);
+    c[93] = Ifx_MatQ31_saturate((sint64)a[93] + b[93]);
+    c[94] = Ifx_MatQ31_saturate((sint64)a[94] + b[94]);
+    c[95] = Ifx_MatQ31_saturate((sint64)a[95] + b[95]);
+    c[96] = Ifx_MatQ31_saturate((sint64)a[96] + b[96]);
+    c[97] = Ifx_MatQ31_saturate((sint64)a[97] + b[97]);
+    c[98] = Ifx_MatQ31_saturate((sint64)a[98] + b[98]);
+    c[99] = Ifx_MatQ31_saturate((sint64)a[99] + b[99]);
+}
+
+
+void Ifx_MatQ31_transpose10(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[10];
+    c[2] = a[20];
+    c[3] = a[30];
+    c[4] = a[40];
+    c[5] = a[50];
+    c[6] = a[60];
+    c[7] = a[70];
+    c[8] = a[80];
+    c[9] = a[90];
+    c[10] = a[1];
+    c[11] = a[11];
+    c[12] = a[21];
+    c[13] = a[31];
+    c[14] = a[41];
+    c[15] = a[51];
+    c[16] = a[61];
+    c[17] = a[71];
+    c[18] = a[81];
+    c[19] = a[91];
+    c[20] = a[2];
+    c[21] = a[12];
+    c[22] = a[22];
+    c[23] = a[32];
+    c[24] = a[42];
+    c[25] = a[52];
+    c[26] = a[62];
+    c[27] = a[72];
+    c[28] = a[82];
+    c[29] = a[92];
+    c[30] = a[3];
+    c[31] = a[13];
+    c[32] = a[23];
+    c[33] = a[33];
+    c[34] = a[43];
+    c[35] = a[53];
+    c[36] = a[63];
+    c[37] = a[73];
+    c[38] = a[83];
+    c[39] = a[93];
+    c[40] = a[4];
+    c[41] = a[14];
+    c[42] = a[24];
+    c[43] = a[34];
+    c[44] = a[44];
+    c[45] = a[54];
+    c[46] = a[64];
+    c[47] = a[74];
+    c[48] = a[84];
+    c[49] = a[94];
+    c[50] = a[5];
+    c[51] = a[15];
+    c[52] = a[25];
+    c[53] = a[35];
+    c[54] = a[45];
+    c[55] = a[55];
+    c[56] = a[65];
+    c[57] = a[75];
+    c[58] = a[85];
+    c[59] = a[95];
+    c[60] = a[6];
+    c[61] = a[16];
+    c[62] = a[26];
+    c[63] = a[36];
+    c[64] = a[46];
+    c[65] = a[56];
+    c[66] = a[66];
+    c[67] = a[76];
+    c[68] = a[86];
+    c[69] = a[96];
+    c[70] = a[7];
+    c[71] = a[17];
+    c[72] = a[27];
+    c[73] = a[37];
+    c[74] = a[47];
+    c[75] = a[57];
+    c[76] = a[67];
+    c[77] = a[77];
+    c[78] = a[87];
+    c[79] = a[97];
+    c[80] = a[8];
+    c[81] = a[18];
+    c[82] = a[28];
+    c[83] = a[38];
+    c[84] = a[48];
+    c[85] = a[58];
+    c[86] = a[68];
+    c[87] = a[78];
+    c[88] = a[88];
+    c[89] = a[98];
+    c[90] = a[9];
+    c[91] = a[19];
+    c[92] = a[29];
+    c[93] = a[39];
+    c[94] = a[49];
+    c[95] = a[59];
+    c[96] = a[69];
+    c[97] = a[79];
+    c[98] = a[89];
+    c[99] = a[99];
+}
+
+
+void Ifx_MatQ31_mul10(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[10]) + IFX_MATQ31_Q58(a[2], b[20])
+        + IFX_MATQ31_Q58(a[3], b[30]) + IFX_MATQ31_Q58(a[4], b[40]) + IFX_MATQ31_Q58(a[5], b[50])
+        + IFX_MATQ31_Q58(a[6], b[60]) + IFX_MATQ31_Q58(a[7], b[70]) + IFX_MATQ31_Q58(a[8], b[80])
+        + IFX_MATQ31_Q58(a[9], b[90]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[21])
+        + IFX_MATQ31_Q58(a[3], b[31]) + IFX_MATQ31_Q58(a[4], b[41]) + IFX_MATQ31_Q58(a[5], b[51])
+        + IFX_MATQ31_Q58(a[6], b[61]) + IFX_MATQ31_Q58(a[7], b[71]) + IFX_MATQ31_Q58(a[8], b[81])
+        + IFX_MATQ31_Q58(a[9], b[91]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[22])
+        + IFX_MATQ31_Q58(a[3], b[32]) + IFX_MATQ31_Q58(a[4], b[42]) + IFX_MATQ31_Q58(a[5], b[52])
+        + IFX_MATQ31_Q58(a[6], b[62]) + IFX_MATQ31_Q58(a[7], b[72]) + IFX_MATQ31_Q58(a[8], b[82])
+        + IFX_MATQ31_Q58(a[9], b[92]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[23])
+        + IFX_MATQ31_Q58(a[3], b[33]) + IFX_MATQ31_Q58(a[4], b[43]) + IFX_MATQ31_Q58(a[5], b[53])
+        + IFX_MATQ31_Q58(a[6], b[63]) + IFX_MATQ31_Q58(a[7], b[73]) + IFX_MATQ31_Q58(a[8], b[83])
+        + IFX_MATQ31_Q58(a[9], b[93]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[14]) + IFX_MATQ31_Q58(a[2], b[24])
+        + IFX_MATQ31_Q58(a[3], b[34]) + IFX_MATQ31_Q58(a[4], b[44]) + IFX_MATQ31_Q58(a[5], b[54])
+        + IFX_MATQ31_Q58(a[6], b[64]) + IFX_MATQ31_Q58(a[7], b[74]) + IFX_MATQ31_Q58(a[8], b[84])
+        + IFX_MATQ31_Q58(a[9], b[94]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[15]) + IFX_MATQ31_Q58(a[2], b[25])
+        + IFX_MATQ31_Q58(a[3], b[35]) + IFX_MATQ31_Q58(a[4], b[45]) + IFX_MATQ31_Q58(a[5], b[55])
+        + IFX_MATQ31_Q58(a[6], b[65]) + IFX_MATQ31_Q58(a[7], b[75]) + IFX_MATQ31_Q58(a[8], b[85])
+        + IFX_MATQ31_Q58(a[9], b[95]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[16]) + IFX_MATQ31_Q58(a[2], b[26])
+        + IFX_MATQ31_Q58(a[3], b[36]) + IFX_MATQ31_Q58(a[4], b[46]) + IFX_MATQ31_Q58(a[5], b[56])
+        + IFX_MATQ31_Q58(a[6], b[66]) + IFX_MATQ31_Q58(a[7], b[76]) + IFX_MATQ31_Q58(a[8], b[86])
+        + IFX_MATQ31_Q58(a[9], b[96]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[7]) + IFX_MATQ31_Q58(a[1], b[17]) + IFX_MATQ31_Q58(a[2], b[27])
+        + IFX_MATQ31_Q58(a[3], b[37]) + IFX_MATQ31_Q58(a[4], b[47]) + IFX_MATQ31_Q58(a[5], b[57])
+        + IFX_MATQ31_Q58(a[6], b[67]) + IFX_MATQ31_Q58(a[7], b[77]) + IFX_MATQ31_Q58(a[8], b[87])
+        + IFX_MATQ31_Q58(a[9], b[97]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[8]) + IFX_MATQ31_Q58(a[1], b[18]) + IFX_MATQ31_Q58(a[2], b[28])
+        + IFX_MATQ31_Q58(a[3], b[38]) + IFX_MATQ31_Q58(a[4], b[48]) + IFX_MATQ31_Q58(a[5], b[58])
+        + IFX_MATQ31_Q58(a[6], b[68]) + IFX_MATQ31_Q58(a[7], b[78]) + IFX_MATQ31_Q58(a[8], b[88])
+        + IFX_MATQ31_Q58(a[9], b[98]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[9]) + IFX_MATQ31_Q58(a[1], b[19]) + IFX_MATQ31_Q58(a[2], b[29])
+        + IFX_MATQ31_Q58(a[3], b[39]) + IFX_MATQ31_Q58(a[4], b[49]) + IFX_MATQ31_Q58(a[5], b[59])
+        + IFX_MATQ31_Q58(a[6], b[69]) + IFX_MATQ31_Q58(a[7], b[79]) + IFX_MATQ31_Q58(a[8], b[89])
+        + IFX_MATQ31_Q58(a[9], b[99]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[0]) + IFX_MATQ31_Q58(a[11], b[10]) + IFX_MATQ31_Q58(a[12], b[20])
+        + IFX_MATQ31_Q58(a[13], b[30]) + IFX_MATQ31_Q58(a[14], b[40]) + IFX_MATQ31_Q58(a[15], b[50])
+        + IFX_MATQ31_Q58(a[16], b[60]) + IFX_MATQ31_Q58(a[17], b[70]) + IFX_MATQ31_Q58(a[18], b[80])
+        + IFX_MATQ31_Q58(a[19], b[90]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[1]) + IFX_MATQ31_Q58(a[11], b[11]) + IFX_MATQ31_Q58(a[12], b[21])
+        + IFX_MATQ31_Q58(a[13], b[31]) + IFX_MATQ31_Q58(a[14], b[41]) + IFX_MATQ31_Q58(a[15], b[51])
+        + IFX_MATQ31_Q58(a[16], b[61]) + IFX_MATQ31_Q58(a[17], b[71]) + IFX_MATQ31_Q58(a[18], b[81])
+        + IFX_MATQ31_Q58(a[19], b[91]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[2]) + IFX_MATQ31_Q58(a[11], b[12]) + IFX_MATQ31_Q58(a[12], b[22])
+        + IFX_MATQ31_Q58(a[13], b[32]) + IFX_MATQ31_Q58(a[14], b[42]) + IFX_MATQ31_Q58(a[15], b[52])
+        + IFX_MATQ31_Q58(a[16], b[62]) + IFX_MATQ31_Q58(a[17], b[72]) + IFX_MATQ31_Q58(a[18], b[82])
+        + IFX_MATQ31_Q58(a[19], b[92]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[3]) + IFX_MATQ31_Q58(a[11], b[13]) + IFX_MATQ31_Q58(a[12], b[23])
+        + IFX_MATQ31_Q58(a[13], b[33]) + IFX_MATQ31_Q58(a[14], b[43]) + IFX_MATQ31_Q58(a[15], b[53])
+        + IFX_MATQ31_Q58(a[16], b[63]) + IFX_MATQ31_Q58(a[17], b[73]) + IFX_MATQ31_Q58(a[18], b[83])
+        + IFX_MATQ31_Q58(a[19], b[93]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[4]) + IFX_MATQ31_Q58(a[11], b[14]) + IFX_MATQ31_Q58(a[12], b[24])
+        + IFX_MATQ31_Q58(a[13], b[34]) + IFX_MATQ31_Q58(a[14], b[44]) + IFX_MATQ31_Q58(a[15], b[54])
+        + IFX_MATQ31_Q58(a[16], b[64]) + IFX_MATQ31_Q58(a[17], b[74]) + IFX_MATQ31_Q58(a[18], b[84])
+        + IFX_MATQ31_Q58(a[19], b[94]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[5]) + IFX_MATQ31_Q58(a[11], b[15]) + IFX_MATQ31_Q58(a[12], b[25])
+        + IFX_MATQ31_Q58(a[13], b[35]) + IFX_MATQ31_Q58(a[14], b[45]) + IFX_MATQ31_Q58(a[15], b[55])
+        + IFX_MATQ31_Q58(a[16], b[65]) + IFX_MATQ31_Q58(a[17], b[75]) + IFX_MATQ31_Q58(a[18], b[85])
+        + IFX_MATQ31_Q58(a[19], b[95]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[6]) + IFX_MATQ31_Q58(a[11], b[16]) + IFX_MATQ31_Q58(a[12], b[26])
+        + IFX_MATQ31_Q58(a[13], b[36]) + IFX_MATQ31_Q58(a[14], b[46]) + IFX_MATQ31_Q58(a[15], b[56])
+        + IFX_MATQ31_Q58(a[16], b[66]) + IFX_MATQ31_Q58(a[17], b[76]) + IFX_MATQ31_Q58(a[18], b[86])
+        + IFX_MATQ31_Q58(a[19], b[96]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[7]) + IFX_MATQ31_Q58(a[11], b[17]) + IFX_MATQ31_Q58(a[12], b[27])
+        + IFX_MATQ31_Q58(a[13], b[37]) + IFX_MATQ31_Q58(a[14], b[47]) + IFX_MATQ31_Q58(a[15], b[57])
+        + IFX_MATQ31_Q58(a[16], b[67]) + IFX_MATQ31_Q58(a[17], b[77]) + IFX_MATQ31_Q58(a[18], b[87])
+        + IFX_MATQ31_Q58(a[19], b[97]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[8]) + IFX_MATQ31_Q58(a[11], b[18]) + IFX_MATQ31_Q58(a[12], b[28])
+        + IFX_MATQ31_Q58(a[13], b[38]) + IFX_MATQ31_Q58(a[14], b[48]) + IFX_MATQ31_Q58(a[15], b[58])
+        + IFX_MATQ31_Q58(a[16], b[68]) + IFX_MATQ31_Q58(a[17], b[78]) + IFX_MATQ31_Q58(a[18], b[88])
+        + IFX_MATQ31_Q58(a[19], b[98]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], b[9]) + IFX_MATQ31_Q58(a[11], b[19]) + IFX_MATQ31_Q58(a[12], b[29])
+        + IFX_MATQ31_Q58(a[13], b[39]) + IFX_MATQ31_Q58(a[14], b[49]) + IFX_MATQ31_Q58(a[15], b[59])
+        + IFX_MATQ31_Q58(a[16], b[69]) + IFX_MATQ31_Q58(a[17], b[79]) + IFX_MATQ31_Q58(a[18], b[89])
+        + IFX_MATQ31_Q58(a[19], b[99]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[0]) + IFX_MATQ31_Q58(a[21], b[10]) + IFX_MATQ31_Q58(a[22], b[20])
+        + IFX_MATQ31_Q58(a[23], b[30]) + IFX_MATQ31_Q58(a[24], b[40]) + IFX_MATQ31_Q58(a[25], b[50])
+        + IFX_MATQ31_Q58(a[26], b[60]) + IFX_MATQ31_Q58(a[27], b[70]) + IFX_MATQ31_Q58(a[28], b[80])
+        + IFX_MATQ31_Q58(a[29], b[90]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[1]) + IFX_MATQ31_Q58(a[21], b[11]) + IFX_MATQ31_Q58(a[22], b[21])
+        + IFX_MATQ31_Q58(a[23], b[31]) + IFX_MATQ31_Q58(a[24], b[41]) + IFX_MATQ31_Q58(a[25], b[51])
+        + IFX_MATQ31_Q58(a[26], b[61]) + IFX_MATQ31_Q58(a[27], b[71]) + IFX_MATQ31_Q58(a[28], b[81])
+        + IFX_MATQ31_Q58(a[29], b[91]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[2]) + IFX_MATQ31_Q58(a[21], b[12]) + IFX_MATQ31_Q58(a[22], b[22])
+        + IFX_MATQ31_Q58(a[23], b[32]) + IFX_MATQ31_Q58(a[24], b[42]) + IFX_MATQ31_Q58(a[25], b[52])
+        + IFX_MATQ31_Q58(a[26], b[62]) + IFX_MATQ31_Q58(a[27], b[72]) + IFX_MATQ31_Q58(a[28], b[82])
+        + IFX_MATQ31_Q58(a[29], b[92]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[3]) + IFX_MATQ31_Q58(a[21], b[13]) + IFX_MATQ31_Q58(a[22], b[23])
+        + IFX_MATQ31_Q58(a[23], b[33]) + IFX_MATQ31_Q58(a[24], b[43]) + IFX_MATQ31_Q58(a[25], b[53])
+        + IFX_MATQ31_Q58(a[26], b[63]) + IFX_MATQ31_Q58(a[27], b[73]) + IFX_MATQ31_Q58(a[28], b[83])
+        + IFX_MATQ31_Q58(a[29], b[93]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[4]) + IFX_MATQ31_Q58(a[21], b[14]) + IFX_MATQ31_Q58(a[22], b[24])
+        + IFX_MATQ31_Q58(a[23], b[34]) + IFX_MATQ31_Q58(a[24], b[44]) + IFX_MATQ31_Q58(a[25], b[54])
+        + IFX_MATQ31_Q58(a[26], b[64]) + IFX_MATQ31_Q58(a[27], b[74]) + IFX_MATQ31_Q58(a[28], b[84])
+        + IFX_MATQ31_Q58(a[29], b[94]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[5]) + IFX_MATQ31_Q58(a[21], b[15]) + IFX_MATQ31_Q58(a[22], b[25])
+        + IFX_MATQ31_Q58(a[23], b[35]) + IFX_MATQ31_Q58(a[24], b[45]) + IFX_MATQ31_Q58(a[25], b[55])
+        + IFX_MATQ31_Q58(a[26], b[65]) + IFX_MATQ31_Q58(a[27], b[75]) + IFX_MATQ31_Q58(a[28], b[85])
+        + IFX_MATQ31_Q58(a[29], b[95]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[6]) + IFX_MATQ31_Q58(a[21], b[16]) + IFX_MATQ31_Q58(a[22], b[26])
+        + IFX_MATQ31_Q58(a[23], b[36]) + IFX_MATQ31_Q58(a[24], b[46]) + IFX_MATQ31_Q58(a[25], b[56])
+        + IFX_MATQ31_Q58(a[26], b[66]) + IFX_MATQ31_Q58(a[27], b[76]) + IFX_MATQ31_Q58(a[28], b[86])
+        + IFX_MATQ31_Q58(a[29], b[96]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[7]) + IFX_MATQ31_Q58(a[21], b[17]) + IFX_MATQ31_Q58(a[22], b[27])
+        + IFX_MATQ31_Q58(a[23], b[37]) + IFX_MATQ31_Q58(a[24], b[47]) + IFX_MATQ31_Q58(a[25], b[57])
+        + IFX_MATQ31_Q58(a[26], b[67]) + IFX_MATQ31_Q58(a[27], b[77]) + IFX_MATQ31_Q58(a[28], b[87])
+        + IFX_MATQ31_Q58(a[29], b[97]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[8]) + IFX_MATQ31_Q58(a[21], b[18]) + IFX_MATQ31_Q58(a[22], b[28])
+        + IFX_MATQ31_Q58(a[23], b[38]) + IFX_MATQ31_Q58(a[24], b[48]) + IFX_MATQ31_Q58(a[25], b[58])
+        + IFX_MATQ31_Q58(a[26], b[68]) + IFX_MATQ31_Q58(a[27], b[78]) + IFX_MATQ31_Q58(a[28], b[88])
+        + IFX_MATQ31_Q58(a[29], b[98]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], b[9]) + IFX_MATQ31_Q58(a[21], b[19]) + IFX_MATQ31_Q58(a[22], b[29])
+        + IFX_MATQ31_Q58(a[23], b[39]) + IFX_MATQ31_Q58(a[24], b[49]) + IFX_MATQ31_Q58(a[25], b[59])
+        + IFX_MATQ31_Q58(a[26], b[69]) + IFX_MATQ31_Q58(a[27], b[79]) + IFX_MATQ31_Q58(a[28], b[89])
+        + IFX_MATQ31_Q58(a[29], b[99]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[0]) + IFX_MATQ31_Q58(a[31], b[10]) + IFX_MATQ31_Q58(a[32], b[20])
+        + IFX_MATQ31_Q58(a[33], b[30]) + IFX_MATQ31_Q58(a[34], b[40]) + IFX_MATQ31_Q58(a[35], b[50])
+        + IFX_MATQ31_Q58(a[36], b[60]) + IFX_MATQ31_Q58(a[37], b[70]) + IFX_MATQ31_Q58(a[38], b[80])
+        + IFX_MATQ31_Q58(a[39], b[90]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[1]) + IFX_MATQ31_Q58(a[31], b[11]) + IFX_MATQ31_Q58(a[32], b[21])
+        + IFX_MATQ31_Q58(a[33], b[31]) + IFX_MATQ31_Q58(a[34], b[41]) + IFX_MATQ31_Q58(a[35], b[51])
+        + IFX_MATQ31_Q58(a[36], b[61]) + IFX_MATQ31_Q58(a[37], b[71]) + IFX_MATQ31_Q58(a[38], b[81])
+        + IFX_MATQ31_Q58(a[39], b[91]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[2]) + IFX_MATQ31_Q58(a[31], b[12]) + IFX_MATQ31_Q58(a[32], b[22])
+        + IFX_MATQ31_Q58(a[33], b[32]) + IFX_MATQ31_Q58(a[34], b[42]) + IFX_MATQ31_Q58(a[35], b[52])
+        + IFX_MATQ31_Q58(a[36], b[62]) + IFX_MATQ31_Q58(a[37], b[72]) + IFX_MATQ31_Q58(a[38], b[82])
+        + IFX_MATQ31_Q58(a[39], b[92]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[3]) + IFX_MATQ31_Q58(a[31], b[13]) + IFX_MATQ31_Q58(a[32], b[23])
+        + IFX_MATQ31_Q58(a[33], b[33]) + IFX_MATQ31_Q58(a[34], b[43]) + IFX_MATQ31_Q58(a[35], b[53])
+        + IFX_MATQ31_Q58(a[36], b[63]) + IFX_MATQ31_Q58(a[37], b[73]) + IFX_MATQ31_Q58(a[38], b[83])
+        + IFX_MATQ31_Q58(a[39], b[93]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[4]) + IFX_MATQ31_Q58(a[31], b[14]) + IFX_MATQ31_Q58(a[32], b[24])
+        + IFX_MATQ31_Q58(a[33], b[34]) + IFX_MATQ31_Q58(a[34], b[44]) + IFX_MATQ31_Q58(a[35], b[54])
+        + IFX_MATQ31_Q58(a[36], b[64]) + IFX_MATQ31_Q58(a[37], b[74]) + IFX_MATQ31_Q58(a[38], b[84])
+        + IFX_MATQ31_Q58(a[39], b[94]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[5]) + IFX_MATQ31_Q58(a[31], b[15]) + IFX_MATQ31_Q58(a[32], b[25])
+        + IFX_MATQ31_Q58(a[33], b[35]) + IFX_MATQ31_Q58(a[34], b[45]) + IFX_MATQ31_Q58(a[35], b[55])
+        + IFX_MATQ31_Q58(a[36], b[65]) + IFX_MATQ31_Q58(a[37], b[75]) + IFX_MATQ31_Q58(a[38], b[85])
+        + IFX_MATQ31_Q58(a[39], b[95]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[6]) + IFX_MATQ31_Q58(a[31], b[16]) + IFX_MATQ31_Q58(a[32], b[26])
+        + IFX_MATQ31_Q58(a[33], b[36]) + IFX_MATQ31_Q58(a[34], b[46]) + IFX_MATQ31_Q58(a[35], b[56])
+        + IFX_MATQ31_Q58(a[36], b[66]) + IFX_MATQ31_Q58(a[37], b[76]) + IFX_MATQ31_Q58(a[38], b[86])
+        + IFX_MATQ31_Q58(a[39], b[96]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[7]) + IFX_MATQ31_Q58(a[31], b[17]) + IFX_MATQ31_Q58(a[32], b[27])
+        + IFX_MATQ31_Q58(a[33], b[37]) + IFX_MATQ31_Q58(a[34], b[47]) + IFX_MATQ31_Q58(a[35], b[57])
+        + IFX_MATQ31_Q58(a[36], b[67]) + IFX_MATQ31_Q58(a[37], b[77]) + IFX_MATQ31_Q58(a[38], b[87])
+        + IFX_MATQ31_Q58(a[39], b[97]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[8]) + IFX_MATQ31_Q58(a[31], b[18]) + IFX_MATQ31_Q58(a[32], b[28])
+        + IFX_MATQ31_Q58(a[33], b[38]) + IFX_MATQ31_Q58(a[34], b[48]) + IFX_MATQ31_Q58(a[35], b[58])
+        + IFX_MATQ31_Q58(a[36], b[68]) + IFX_MATQ31_Q58(a[37], b[78]) + IFX_MATQ31_Q58(a[38], b[88])
+        + IFX_MATQ31_Q58(a[39], b[98]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], b[9]) + IFX_MATQ31_Q58(a[31], b[19]) + IFX_MATQ31_Q58(a[32], b[29])
+        + IFX_MATQ31_Q58(a[33], b[39]) + IFX_MATQ31_Q58(a[34], b[49]) + IFX_MATQ31_Q58(a[35], b[59])
+        + IFX_MATQ31_Q58(a[36], b[69]) + IFX_MATQ31_Q58(a[37], b[79]) + IFX_MATQ31_Q58(a[38], b[89])
+        + IFX_MATQ31_Q58(a[39], b[99]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[0]) + IFX_MATQ31_Q58(a[41], b[10]) + IFX_MATQ31_Q58(a[42], b[20])
+        + IFX_MATQ31_Q58(a[43], b[30]) + IFX_MATQ31_Q58(a[44], b[40]) + IFX_MATQ31_Q58(a[45], b[50])
+        + IFX_MATQ31_Q58(a[46], b[60]) + IFX_MATQ31_Q58(a[47], b[70]) + IFX_MATQ31_Q58(a[48], b[80])
+        + IFX_MATQ31_Q58(a[49], b[90]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[1]) + IFX_MATQ31_Q58(a[41], b[11]) + IFX_MATQ31_Q58(a[42], b[21])
+        + IFX_MATQ31_Q58(a[43], b[31]) + IFX_MATQ31_Q58(a[44], b[41]) + IFX_MATQ31_Q58(a[45], b[51])
+        + IFX_MATQ31_Q58(a[46], b[61]) + IFX_MATQ31_Q58(a[47], b[71]) + IFX_MATQ31_Q58(a[48], b[81])
+        + IFX_MATQ31_Q58(a[49], b[91]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[2]) + IFX_MATQ31_Q58(a[41], b[12]) + IFX_MATQ31_Q58(a[42], b[22])
+        + IFX_MATQ31_Q58(a[43], b[32]) + IFX_MATQ31_Q58(a[44], b[42]) + IFX_MATQ31_Q58(a[45], b[52])
+        + IFX_MATQ31_Q58(a[46], b[62]) + IFX_MATQ31_Q58(a[47], b[72]) + IFX_MATQ31_Q58(a[48], b[82])
+        + IFX_MATQ31_Q58(a[49], b[92]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[3]) + IFX_MATQ31_Q58(a[41], b[13]) + IFX_MATQ31_Q58(a[42], b[23])
+        + IFX_MATQ31_Q58(a[43], b[33]) + IFX_MATQ31_Q58(a[44], b[43]) + IFX_MATQ31_Q58(a[45], b[53])
+        + IFX_MATQ31_Q58(a[46], b[63]) + IFX_MATQ31_Q58(a[47], b[73]) + IFX_MATQ31_Q58(a[48], b[83])
+        + IFX_MATQ31_Q58(a[49], b[93]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[4]) + IFX_MATQ31_Q58(a[41], b[14]) + IFX_MATQ31_Q58(a[42], b[24])
+        + IFX_MATQ31_Q58(a[43], b[34]) + IFX_MATQ31_Q58(a[44], b[44]) + IFX_MATQ31_Q58(a[45], b[54])
+        + IFX_MATQ31_Q58(a[46], b[64]) + IFX_MATQ31_Q58(a[47], b[74]) + IFX_MATQ31_Q58(a[48], b[84])
+        + IFX_MATQ31_Q58(a[49], b[94]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[5]) + IFX_MATQ31_Q58(a[41], b[15]) + IFX_MATQ31_Q58(a[42], b[25])
+        + IFX_MATQ31_Q58(a[43], b[35]) + IFX_MATQ31_Q58(a[44], b[45]) + IFX_MATQ31_Q58(a[45], b[55])
+        + IFX_MATQ31_Q58(a[46], b[65]) + IFX_MATQ31_Q58(a[47], b[75]) + IFX_MATQ31_Q58(a[48], b[85])
+        + IFX_MATQ31_Q58(a[49], b[95]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[6]) + IFX_MATQ31_Q58(a[41], b[16]) + IFX_MATQ31_Q58(a[42], b[26])
+        + IFX_MATQ31_Q58(a[43], b[36]) + IFX_MATQ31_Q58(a[44], b[46]) + IFX_MATQ31_Q58(a[45], b[56])
+        + IFX_MATQ31_Q58(a[46], b[66]) + IFX_MATQ31_Q58(a[47], b[76]) + IFX_MATQ31_Q58(a[48], b[86])
+        + IFX_MATQ31_Q58(a[49], b[96]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[7]) + IFX_MATQ31_Q58(a[41], b[17]) + IFX_MATQ31_Q58(a[42], b[27])
+        + IFX_MATQ31_Q58(a[43], b[37]) + IFX_MATQ31_Q58(a[44], b[47]) + IFX_MATQ31_Q58(a[45], b[57])
+        + IFX_MATQ31_Q58(a[46], b[67]) + IFX_MATQ31_Q58(a[47], b[77]) + IFX_MATQ31_Q58(a[48], b[87])
+        + IFX_MATQ31_Q58(a[49], b[97]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[8]) + IFX_MATQ31_Q58(a[41], b[18]) + IFX_MATQ31_Q58(a[42], b[28])
+        + IFX_MATQ31_Q58(a[43], b[38]) + IFX_MATQ31_Q58(a[44], b[48]) + IFX_MATQ31_Q58(a[45], b[58])
+        + IFX_MATQ31_Q58(a[46], b[68]) + IFX_MATQ31_Q58(a[47], b[78]) + IFX_MATQ31_Q58(a[48], b[88])
+        + IFX_MATQ31_Q58(a[49], b[98]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], b[9]) + IFX_MATQ31_Q58(a[41], b[19]) + IFX_MATQ31_Q58(a[42], b[29])
+        + IFX_MATQ31_Q58(a[43], b[39]) + IFX_MATQ31_Q58(a[44], b[49]) + IFX_MATQ31_Q58(a[45], b[59])
+        + IFX_MATQ31_Q58(a[46], b[69]) + IFX_MATQ31_Q58(a[47], b[79]) + IFX_MATQ31_Q58(a[48], b[89])
+        + IFX_MATQ31_Q58(a[49], b[99]);
+    c[49] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[0]) + IFX_MATQ31_Q58(a[51], b[10]) + IFX_MATQ31_Q58(a[52], b[20])
+        + IFX_MATQ31_Q58(a[53], b[30]) + IFX_MATQ31_Q58(a[54], b[40]) + IFX_MATQ31_Q58(a[55], b[50])
+        + IFX_MATQ31_Q58(a[56], b[60]) + IFX_MATQ31_Q58(a[57], b[70]) + IFX_MATQ31_Q58(a[58], b[80])
+        + IFX_MATQ31_Q58(a[59], b[90]);
+    c[50] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[1]) + IFX_MATQ31_Q58(a[51], b[11]) + IFX_MATQ31_Q58(a[52], b[21])
+        + IFX_MATQ31_Q58(a[53], b[31]) + IFX_MATQ31_Q58(a[54], b[41]) + IFX_MATQ31_Q58(a[55], b[51])
+        + IFX_MATQ31_Q58(a[56], b[61]) + IFX_MATQ31_Q58(a[57], b[71]) + IFX_MATQ31_Q58(a[58], b[81])
+        + IFX_MATQ31_Q58(a[59], b[91]);
+    c[51] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[2]) + IFX_MATQ31_Q58(a[51], b[12]) + IFX_MATQ31_Q58(a[52], b[22])
+        + IFX_MATQ31_Q58(a[53], b[32]) + IFX_MATQ31_Q58(a[54], b[42]) + IFX_MATQ31_Q58(a[55], b[52])
+        + IFX_MATQ31_Q58(a[56], b[62]) + IFX_MATQ31_Q58(a[57], b[72]) + IFX_MATQ31_Q58(a[58], b[82])
+        + IFX_MATQ31_Q58(a[59], b[92]);
+    c[52] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[3]) + IFX_MATQ31_Q58(a[51], b[13]) + IFX_MATQ31_Q58(a[52], b[23])
+        + IFX_MATQ31_Q58(a[53], b[33]) + IFX_MATQ31_Q58(a[54], b[43]) + IFX_MATQ31_Q58(a[55], b[53])
+        + IFX_MATQ31_Q58(a[56], b[63]) + IFX_MATQ31_Q58(a[57], b[73]) + IFX_MATQ31_Q58(a[58], b[83])
+        + IFX_MATQ31_Q58(a[59], b[93]);
+    c[53] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[4]) + IFX_MATQ31_Q58(a[51], b[14]) + IFX_MATQ31_Q58(a[52], b[24])
+        + IFX_MATQ31_Q58(a[53], b[34]) + IFX_MATQ31_Q58(a[54], b[44]) + IFX_MATQ31_Q58(a[55], b[54])
+        + IFX_MATQ31_Q58(a[56], b[64]) + IFX_MATQ31_Q58(a[57], b[74]) + IFX_MATQ31_Q58(a[58], b[84])
+        + IFX_MATQ31_Q58(a[59], b[94]);
+    c[54] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[5]) + IFX_MATQ31_Q58(a[51], b[15]) + IFX_MATQ31_Q58(a[52], b[25])
+        + IFX_MATQ31_Q58(a[53], b[35]) + IFX_MATQ31_Q58(a[54], b[45]) + IFX_MATQ31_Q58(a[55], b[55])
+        + IFX_MATQ31_Q58(a[56], b[65]) + IFX_MATQ31_Q58(a[57], b[75]) + IFX_MATQ31_Q58(a[58], b[85])
+        + IFX_MATQ31_Q58(a[59], b[95]);
+    c[55] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[6]) + IFX_MATQ31_Q58(a[51], b[16]) + IFX_MATQ31_Q58(a[52], b[26])
+        + IFX_MATQ31_Q58(a[53], b[36]) + IFX_MATQ31_Q58(a[54], b[46]) + IFX_MATQ31_Q58(a[55], b[56])
+        + IFX_MATQ31_Q58(a[56], b[66]) + IFX_MATQ31_Q58(a[57], b[76]) + IFX_MATQ31_Q58(a[58], b[86])
+        + IFX_MATQ31_Q58(a[59], b[96]);
+    c[56] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[7]) + IFX_MATQ31_Q58(a[51], b[17]) + IFX_MATQ31_Q58(a[52], b[27])
+        + IFX_MATQ31_Q58(a[53], b[37]) + IFX_MATQ31_Q58(a[54], b[47]) + IFX_MATQ31_Q58(a[55], b[57])
+        + IFX_MATQ31_Q58(a[56], b[67]) + IFX_MATQ31_Q58(a[57], b[77]) + IFX_MATQ31_Q58(a[58], b[87])
+        + IFX_MATQ31_Q58(a[59], b[97]);
+    c[57] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[8]) + IFX_MATQ31_Q58(a[51], b[18]) + IFX_MATQ31_Q58(a[52], b[28])
+        + IFX_MATQ31_Q58(a[53], b[38]) + IFX_MATQ31_Q58(a[54], b[48]) + IFX_MATQ31_Q58(a[55], b[58])
+        + IFX_MATQ31_Q58(a[56], b[68]) + IFX_MATQ31_Q58(a[57], b[78]) + IFX_MATQ31_Q58(a[58], b[88])
+        + IFX_MATQ31_Q58(a[59], b[98]);
+    c[58] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], b[9]) + IFX_MATQ31_Q58(a[51], b[19]) + IFX_MATQ31_Q58(a[52], b[29])
+        + IFX_MATQ31_Q58(a[53], b[39]) + IFX_MATQ31_Q58(a[54], b[49]) + IFX_MATQ31_Q58(a[55], b[59])
+        + IFX_MATQ31_Q58(a[56], b[69]) + IFX_MATQ31_Q58(a[57], b[79]) + IFX_MATQ31_Q58(a[58], b[89])
+        + IFX_MATQ31_Q58(a[59], b[99]);
+    c[59] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[0]) + IFX_MATQ31_Q58(a[61], b[10]) + IFX_MATQ31_Q58(a[62], b[20])
+        + IFX_MATQ31_Q58(a[63], b[30]) + IFX_MATQ31_Q58(a[64], b[40]) + IFX_MATQ31_Q58(a[65], b[50])
+        + IFX_MATQ31_Q58(a[66], b[60]) + IFX_MATQ31_Q58(a[67], b[70]) + IFX_MATQ31_Q58(a[68], b[80])
+        + IFX_MATQ31_Q58(a[69], b[90]);
+    c[60] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[1]) + IFX_MATQ31_Q58(a[61], b[11]) + IFX_MATQ31_Q58(a[62], b[21])
+        + IFX_MATQ31_Q58(a[63], b[31]) + IFX_MATQ31_Q58(a[64], b[41]) + IFX_MATQ31_Q58(a[65], b[51])
+        + IFX_MATQ31_Q58(a[66], b[61]) + IFX_MATQ31_Q58(a[67], b[71]) + IFX_MATQ31_Q58(a[68], b[81])
+        + IFX_MATQ31_Q58(a[69], b[91]);
+    c[61] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[2]) + IFX_MATQ31_Q58(a[61], b[12]) + IFX_MATQ31_Q58(a[62], b[22])
+        + IFX_MATQ31_Q58(a[63], b[32]) + IFX_MATQ31_Q58(a[64], b[42]) + IFX_MATQ31_Q58(a[65], b[52])
+        + IFX_MATQ31_Q58(a[66], b[62]) + IFX_MATQ31_Q58(a[67], b[72]) + IFX_MATQ31_Q58(a[68], b[82])
+        + IFX_MATQ31_Q58(a[69], b[92]);
+    c[62] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[3]) + IFX_MATQ31_Q58(a[61], b[13]) + IFX_MATQ31_Q58(a[62], b[23])
+        + IFX_MATQ31_Q58(a[63], b[33]) + IFX_MATQ31_Q58(a[64], b[43]) + IFX_MATQ31_Q58(a[65], b[53])
+        + IFX_MATQ31_Q58(a[66], b[63]) + IFX_MATQ31_Q58(a[67], b[73]) + IFX_MATQ31_Q58(a[68], b[83])
+        + IFX_MATQ31_Q58(a[69], b[93]);
+    c[63] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[4]) + IFX_MATQ31_Q58(a[61], b[14]) + IFX_MATQ31_Q58(a[62], b[24])
+        + IFX_MATQ31_Q58(a[63], b[34]) + IFX_MATQ31_Q58(a[64], b[44]) + IFX_MATQ31_Q58(a[65], b[54])
+        + IFX_MATQ31_Q58(a[66], b[64]) + IFX_MATQ31_Q58(a[67], b[74]) + IFX_MATQ31_Q58(a[68], b[84])
+        + IFX_MATQ31_Q58(a[69], b[94]);
+    c[64] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[5]) + IFX_MATQ31_Q58(a[61], b[15]) + IFX_MATQ31_Q58(a[62], b[25])
+        + IFX_MATQ31_Q58(a[63], b[35]) + IFX_MATQ31_Q58(a[64], b[45]) + IFX_MATQ31_Q58(a[65], b[55])
+        + IFX_MATQ31_Q58(a[66], b[65]) + IFX_MATQ31_Q58(a[67], b[75]) + IFX_MATQ31_Q58(a[68], b[85])
+        + IFX_MATQ31_Q58(a[69], b[95]);
+    c[65] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[6]) + IFX_MATQ31_Q58(a[61], b[16]) + IFX_MATQ31_Q58(a[62], b[26])
+        + IFX_MATQ31_Q58(a[63], b[36]) + IFX_MATQ31_Q58(a[64], b[46]) + IFX_MATQ31_Q58(a[65], b[56])
+        + IFX_MATQ31_Q58(a[66], b[66]) + IFX_MATQ31_Q58(a[67], b[76]) + IFX_MATQ31_Q58(a[68], b[86])
+        + IFX_MATQ31_Q58(a[69], b[96]);
+    c[66] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[7]) + IFX_MATQ31_Q58(a[61], b[17]) + IFX_MATQ31_Q58(a[62], b[27])
+        + IFX_MATQ31_Q58(a[63], b[37]) + IFX_MATQ31_Q58(a[64], b[47]) + IFX_MATQ31_Q58(a[65], b[57])
+        + IFX_MATQ31_Q58(a[66], b[67]) + IFX_MATQ31_Q58(a[67], b[77]) + IFX_MATQ31_Q58(a[68], b[87])
+        + IFX_MATQ31_Q58(a[69], b[97]);
+    c[67] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[8]) + IFX_MATQ31_Q58(a[61], b[18]) + IFX_MATQ31_Q58(a[62], b[28])
+        + IFX_MATQ31_Q58(a[63], b[38]) + IFX_MATQ31_Q58(a[64], b[48]) + IFX_MATQ31_Q58(a[65], b[58])
+        + IFX_MATQ31_Q58(a[66], b[68]) + IFX_MATQ31_Q58(a[67], b[78]) + IFX_MATQ31_Q58(a[68], b[88])
+        + IFX_MATQ31_Q58(a[69], b[98]);
+    c[68] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[9]) + IFX_MATQ31_Q58(a[61], b[19]) + IFX_MATQ31_Q58(a[62], b[29])
+        + IFX_MATQ31_Q58(a[63], b[39]) + IFX_MATQ31_Q58(a[64], b[49]) + IFX_MATQ31_Q58(a[65], b[59])
+        + IFX_MATQ31_Q58(a[66], b[69]) + IFX_MATQ31_Q58(a[67], b[79]) + IFX_MATQ31_Q58(a[68], b[89])
+        + IFX_MATQ31_Q58(a[69], b[99]);
+    c[69] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[0]) + IFX_MATQ31_Q58(a[71], b[10]) + IFX_MATQ31_Q58(a[72], b[20])
+        + IFX_MATQ31_Q58(a[73], b[30]) + IFX_MATQ31_Q58(a[74], b[40]) + IFX_MATQ31_Q58(a[75], b[50])
+        + IFX_MATQ31_Q58(a[76], b[60]) + IFX_MATQ31_Q58(a[77], b[70]) + IFX_MATQ31_Q58(a[78], b[80])
+        + IFX_MATQ31_Q58(a[79], b[90]);
+    c[70] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[1]) + IFX_MATQ31_Q58(a[71], b[11]) + IFX_MATQ31_Q58(a[72], b[21])
+        + IFX_MATQ31_Q58(a[73], b[31]) + IFX_MATQ31_Q58(a[74], b[41]) + IFX_MATQ31_Q58(a[75], b[51])
+        + IFX_MATQ31_Q58(a[76], b[61]) + IFX_MATQ31_Q58(a[77], b[71]) + IFX_MATQ31_Q58(a[78], b[81])
+        + IFX_MATQ31_Q58(a[79], b[91]);
+    c[71] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[2]) + IFX_MATQ31_Q58(a[71], b[12]) + IFX_MATQ31_Q58(a[72], b[22])
+        + IFX_MATQ31_Q58(a[73], b[32]) + IFX_MATQ31_Q58(a[74], b[42]) + IFX_MATQ31_Q58(a[75], b[52])
+        + IFX_MATQ31_Q58(a[76], b[62]) + IFX_MATQ31_Q58(a[77], b[72]) + IFX_MATQ31_Q58(a[78], b[82])
+        + IFX_MATQ31_Q58(a[79], b[92]);
+    c[72] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[3]) + IFX_MATQ31_Q58(a[71], b[13]) + IFX_MATQ31_Q58(a[72], b[23])
+        + IFX_MATQ31_Q58(a[73], b[33]) + IFX_MATQ31_Q58(a[74], b[43]) + IFX_MATQ31_Q58(a[75], b[53])
+        + IFX_MATQ31_Q58(a[76], b[63]) + IFX_MATQ31_Q58(a[77], b[73]) + IFX_MATQ31_Q58(a[78], b[83])
+        + IFX_MATQ31_Q58(a[79], b[93]);
+    c[73] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[4]) + IFX_MATQ31_Q58(a[71], b[14]) + IFX_MATQ31_Q58(a[72], b[24])
+        + IFX_MATQ31_Q58(a[73], b[34]) + IFX_MATQ31_Q58(a[74], b[44]) + IFX_MATQ31_Q58(a[75], b[54])
+        + IFX_MATQ31_Q58(a[76], b[64]) + IFX_MATQ31_Q58(a[77], b[74]) + IFX_MATQ31_Q58(a[78], b[84])
+        + IFX_MATQ31_Q58(a[79], b[94]);
+    c[74] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[5]) + IFX_MATQ31_Q58(a[71], b[15]) + IFX_MATQ31_Q58(a[72], b[25])
+        + IFX_MATQ31_Q58(a[73], b[35]) + IFX_MATQ31_Q58(a[74], b[45]) + IFX_MATQ31_Q58(a[75], b[55])
+        + IFX_MATQ31_Q58(a[76], b[65]) + IFX_MATQ31_Q58(a[77], b[75]) + IFX_MATQ31_Q58(a[78], b[85])
+        + IFX_MATQ31_Q58(a[79], b[95]);
+    c[75] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[6]) + IFX_MATQ31_Q58(a[71], b[16]) + IFX_MATQ31_Q58(a[72], b[26])
+        + IFX_MATQ31_Q58(a[73], b[36]) + IFX_MATQ31_Q58(a[74], b[46]) + IFX_MATQ31_Q58(a[75], b[56])
+        + IFX_MATQ31_Q58(a[76], b[66]) + IFX_MATQ31_Q58(a[77], b[76]) + IFX_MATQ31_Q58(a[78], b[86])
+        + IFX_MATQ31_Q58(a[79], b[96]);
+    c[76] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[7]) + IFX_MATQ31_Q58(a[71], b[17]) + IFX_MATQ31_Q58(a[72], b[27])
+        + IFX_MATQ31_Q58(a[73], b[37]) + IFX_MATQ31_Q58(a[74], b[47]) + IFX_MATQ31_Q58(a[75], b[57])
+        + IFX_MATQ31_Q58(a[76], b[67]) + IFX_MATQ31_Q58(a[77], b[77]) + IFX_MATQ31_Q58(a[78], b[87])
+        + IFX_MATQ31_Q58(a[79], b[97]);
+    c[77] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[8]) + IFX_MATQ31_Q58(a[71], b[18]) + IFX_MATQ31_Q58(a[72], b[28])
+        + IFX_MATQ31_Q58(a[73], b[38]) + IFX_MATQ31_Q58(a[74], b[48]) + IFX_MATQ31_Q58(a[75], b[58])
+        + IFX_MATQ31_Q58(a[76], b[68]) + IFX_MATQ31_Q58(a[77], b[78]) + IFX_MATQ31_Q58(a[78], b[88])
+        + IFX_MATQ31_Q58(a[79], b[98]);
+    c[78] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], b[9]) + IFX_MATQ31_Q58(a[71], b[19]) + IFX_MATQ31_Q58(a[72], b[29])
+        + IFX_MATQ31_Q58(a[73], b[39]) + IFX_MATQ31_Q58(a[74], b[49]) + IFX_MATQ31_Q58(a[75], b[59])
+        + IFX_MATQ31_Q58(a[76], b[69]) + IFX_MATQ31_Q58(a[77], b[79]) + IFX_MATQ31_Q58(a[78], b[89])
+        + IFX_MATQ31_Q58(a[79], b[99]);
+    c[79] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[0]) + IFX_MATQ31_Q58(a[81], b[10]) + IFX_MATQ31_Q58(a[82], b[20])
+        + IFX_MATQ31_Q58(a[83], b[30]) + IFX_MATQ31_Q58(a[84], b[40]) + IFX_MATQ31_Q58(a[85], b[50])
+        + IFX_MATQ31_Q58(a[86], b[60]) + IFX_MATQ31_Q58(a[87], b[70]) + IFX_MATQ31_Q58(a[88], b[80])
+        + IFX_MATQ31_Q58(a[89], b[90]);
+    c[80] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[1]) + IFX_MATQ31_Q58(a[81], b[11]) + IFX_MATQ31_Q58(a[82], b[21])
+        + IFX_MATQ31_Q58(a[83], b[31]) + IFX_MATQ31_Q58(a[84], b[41]) + IFX_MATQ31_Q58(a[85], b[51])
+        + IFX_MATQ31_Q58(a[86], b[61]) + IFX_MATQ31_Q58(a[87], b[71]) + IFX_MATQ31_Q58(a[88], b[81])
+        + IFX_MATQ31_Q58(a[89], b[91]);
+    c[81] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[2]) + IFX_MATQ31_Q58(a[81], b[12]) + IFX_MATQ31_Q58(a[82], b[22])
+        + IFX_MATQ31_Q58(a[83], b[32]) + IFX_MATQ31_Q58(a[84], b[42]) + IFX_MATQ31_Q58(a[85], b[52])
+        + IFX_MATQ31_Q58(a[86], b[62]) + IFX_MATQ31_Q58(a[87], b[72]) + IFX_MATQ31_Q58(a[88], b[82])
+        + IFX_MATQ31_Q58(a[89], b[92]);
+    c[82] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[3]) + IFX_MATQ31_Q58(a[81], b[13]) + IFX_MATQ31_Q58(a[82], b[23])
+        + IFX_MATQ31_Q58(a[83], b[33]) + IFX_MATQ31_Q58(a[84], b[43]) + IFX_MATQ31_Q58(a[85], b[53])
+        + IFX_MATQ31_Q58(a[86], b[63]) + IFX_MATQ31_Q58(a[87], b[73]) + IFX_MATQ31_Q58(a[88], b[83])
+        + IFX_MATQ31_Q58(a[89], b[93]);
+    c[83] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[4]) + IFX_MATQ31_Q58(a[81], b[14]) + IFX_MATQ31_Q58(a[82], b[24])
+        + IFX_MATQ31_Q58(a[83], b[34]) + IFX_MATQ31_Q58(a[84], b[44]) + IFX_MATQ31_Q58(a[85], b[54])
+        + IFX_MATQ31_Q58(a[86], b[64]) + IFX_MATQ31_Q58(a[87], b[74]) + IFX_MATQ31_Q58(a[88], b[84])
+        + IFX_MATQ31_Q58(a[89], b[94]);
+    c[84] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[5]) + IFX_MATQ31_Q58(a[81], b[15]) + IFX_MATQ31_Q58(a[82], b[25])
+        + IFX_MATQ31_Q58(a[83], b[35]) + IFX_MATQ31_Q58(a[84], b[45]) + IFX_MATQ31_Q58(a[85], b[55])
+        + IFX_MATQ31_Q58(a[86], b[65]) + IFX_MATQ31_Q58(a[87], b[75]) + IFX_MATQ31_Q58(a[88], b[85])
+        + IFX_MATQ31_Q58(a[89], b[95]);
+    c[85] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[6]) + IFX_MATQ31_Q58(a[81], b[16]) + IFX_MATQ31_Q58(a[82], b[26])
+        + IFX_MATQ31_Q58(a[83], b[36]) + IFX_MATQ31_Q58(a[84], b[46]) + IFX_MATQ31_Q58(a[85], b[56])
+        + IFX_MATQ31_Q58(a[86], b[66]) + IFX_MATQ31_Q58(a[87], b[76]) + IFX_MATQ31_Q58(a[88], b[86])
+        + IFX_MATQ31_Q58(a[89], b[96]);
+    c[86] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[7]) + IFX_MATQ31_Q58(a[81], b[17]) + IFX_MATQ31_Q58(a[82], b[27])
+        + IFX_MATQ31_Q58(a[83], b[37]) + IFX_MATQ31_Q58(a[84], b[47]) + IFX_MATQ31_Q58(a[85], b[57])
+        + IFX_MATQ31_Q58(a[86], b[67]) + IFX_MATQ31_Q58(a[87], b[77]) + IFX_MATQ31_Q58(a[88], b[87])
+        + IFX_MATQ31_Q58(a[89], b[97]);
+    c[87] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[8]) + IFX_MATQ31_Q58(a[81], b[18]) + IFX_MATQ31_Q58(a[82], b[28])
+        + IFX_MATQ31_Q58(a[83], b[38]) + IFX_MATQ31_Q58(a[84], b[48]) + IFX_MATQ31_Q58(a[85], b[58])
+        + IFX_MATQ31_Q58(a[86], b[68]) + IFX_MATQ31_Q58(a[87], b[78]) + IFX_MATQ31_Q58(a[88], b[88])
+        + IFX_MATQ31_Q58(a[89], b[98]);
+    c[88] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], b[9]) + IFX_MATQ31_Q58(a[81], b[19]) + IFX_MATQ31_Q58(a[82], b[29])
+        + IFX_MATQ31_Q58(a[83], b[39]) + IFX_MATQ31_Q58(a[84], b[49]) + IFX_MATQ31_Q58(a[85], b[59])
+        + IFX_MATQ31_Q58(a[86], b[69]) + IFX_MATQ31_Q58(a[87], b[79]) + IFX_MATQ31_Q58(a[88], b[89])
+        + IFX_MATQ31_Q58(a[89], b[99]);
+    c[89] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[0]) + IFX_MATQ31_Q58(a[91], b[10]) + IFX_MATQ31_Q58(a[92], b[20])
+        + IFX_MATQ31_Q58(a[93], b[30]) + IFX_MATQ31_Q58(a[94], b[40]) + IFX_MATQ31_Q58(a[95], b[50])
+        + IFX_MATQ31_Q58(a[96], b[60]) + IFX_MATQ31_Q58(a[97], b[70]) + IFX_MATQ31_Q58(a[98], b[80])
+        + IFX_MATQ31_Q58(a[99], b[90]);
+    c[90] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[1]) + IFX_MATQ31_Q58(a[91], b[11]) + IFX_MATQ31_Q58(a[92], b[21])
+        + IFX_MATQ31_Q58(a[93], b[31]) + IFX_MATQ31_Q58(a[94], b[41]) + IFX_MATQ31_Q58(a[95], b[51])
+        + IFX_MATQ31_Q58(a[96], b[61]) + IFX_MATQ31_Q58(a[97], b[71]) + IFX_MATQ31_Q58(a[98], b[81])
+        + IFX_MATQ31_Q58(a[99], b[91]);
+    c[91] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[2]) + IFX_MATQ31_Q58(a[91], b[12]) + IFX_MATQ31_Q58(a[92], b[22])
+        + IFX_MATQ31_Q58(a[93], b[32]) + IFX_MATQ31_Q58(a[94], b[42]) + IFX_MATQ31_Q58(a[95], b[52])
+        + IFX_MATQ31_Q58(a[96], b[62]) + IFX_MATQ31_Q58(a[97], b[72]) + IFX_MATQ31_Q58(a[98], b[82])
+        + IFX_MATQ31_Q58(a[99], b[92]);
+    c[92] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[3]) + IFX_MATQ31_Q58(a[91], b[13]) + IFX_MATQ31_Q58(a[92], b[23])
+        + IFX_MATQ31_Q58(a[93], b[33]) + IFX_MATQ31_Q58(a[94], b[43]) + IFX_MATQ31_Q58(a[95], b[53])
+        + IFX_MATQ31_Q58(a[96], b[63]) + IFX_MATQ31_Q58(a[97], b[73]) + IFX_MATQ31_Q58(a[98], b[83])
+        + IFX_MATQ31_Q58(a[99], b[93]);
+    c[93] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[4]) + IFX_MATQ31_Q58(a[91], b[14]) + IFX_MATQ31_Q58(a[92], b[24])
+        + IFX_MATQ31_Q58(a[93], b[34]) + IFX_MATQ31_Q58(a[94], b[44]) + IFX_MATQ31_Q58(a[95], b[54])
+        + IFX_MATQ31_Q58(a[96], b[64]) + IFX_MATQ31_Q58(a[97], b[74]) + IFX_MATQ31_Q58(a[98], b[84])
+        + IFX_MATQ31_Q58(a[99], b[94]);
+    c[94] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[5]) + IFX_MATQ31_Q58(a[91], b[15]) + IFX_MATQ31_Q58(a[92], b[25])
+        + IFX_MATQ31_Q58(a[93], b[35]) + IFX_MATQ31_Q58(a[94], b[45]) + IFX_MATQ31_Q58(a[95], b[55])
+        + IFX_MATQ31_Q58(a[96], b[65]) + IFX_MATQ31_Q58(a[97], b[75]) + IFX_MATQ31_Q58(a[98], b[85])
+        + IFX_MATQ31_Q58(a[99], b[95]);
+    c[95] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[6]) + IFX_MATQ31_Q58(a[91], b[16]) + IFX_MATQ31_Q58(a[92], b[26])
+        + IFX_MATQ31_Q58(a[93], b[36]) + IFX_MATQ31_Q58(a[94], b[46]) + IFX_MATQ31_Q58(a[95], b[56])
+        + IFX_MATQ31_Q58(a[96], b[66]) + IFX_MATQ31_Q58(a[97], b[76]) + IFX_MATQ31_Q58(a[98], b[86])
+        + IFX_MATQ31_Q58(a[99], b[96]);
+    c[96] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[7]) + IFX_MATQ31_Q58(a[91], b[17]) + IFX_MATQ31_Q58(a[92], b[27])
+        + IFX_MATQ31_Q58(a[93], b[37]) + IFX_MATQ31_Q58(a[94], b[47]) + IFX_MATQ31_Q58(a[95], b[57])
+        + IFX_MATQ31_Q58(a[96], b[67]) + IFX_MATQ31_Q58(a[97], b[77]) + IFX_MATQ31_Q58(a[98], b[87])
+        + IFX_MATQ31_Q58(a[99], b[97]);
+    c[97] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[8]) + IFX_MATQ31_Q58(a[91], b[18]) + IFX_MATQ31_Q58(a[92], b[28])
+        + IFX_MATQ31_Q58(a[93], b[38]) + IFX_MATQ31_Q58(a[94], b[48]) + IFX_MATQ31_Q58(a[95], b[58])
+        + IFX_MATQ31_Q58(a[96], b[68]) + IFX_MATQ31_Q58(a[97], b[78]) + IFX_MATQ31_Q58(a[98], b[88])
+        + IFX_MATQ31_Q58(a[99], b[98]);
+    c[98] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], b[9]) + IFX_MATQ31_Q58(a[91], b[19]) + IFX_MATQ31_Q58(a[92], b[29])
+        + IFX_MATQ31_Q58(a[93], b[39]) + IFX_MATQ31_Q58(a[94], b[49]) + IFX_MATQ31_Q58(a[95], b[59])
+        + IFX_MATQ31_Q58(a[96], b[69]) + IFX_MATQ31_Q58(a[97], b[79]) + IFX_MATQ31_Q58(a[98], b[89])
+        + IFX_MATQ31_Q58(a[99], b[99]);
+    c[99] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec10(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]) + IFX_MATQ31_Q58(a[7], x[7]) + IFX_MATQ31_Q58(a[8], x[8])
+        + IFX_MATQ31_Q58(a[9], x[9]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[10], x[0]) + IFX_MATQ31_Q58(a[11], x[1]) + IFX_MATQ31_Q58(a[12], x[2])
+        + IFX_MATQ31_Q58(a[13], x[3]) + IFX_MATQ31_Q58(a[14], x[4]) + IFX_MATQ31_Q58(a[15], x[5])
+        + IFX_MATQ31_Q58(a[16], x[6]) + IFX_MATQ31_Q58(a[17], x[7]) + IFX_MATQ31_Q58(a[18], x[8])
+        + IFX_MATQ31_Q58(a[19], x[9]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[20], x[0]) + IFX_MATQ31_Q58(a[21], x[1]) + IFX_MATQ31_Q58(a[22], x[2])
+        + IFX_MATQ31_Q58(a[23], x[3]) + IFX_MATQ31_Q58(a[24], x[4]) + IFX_MATQ31_Q58(a[25], x[5])
+        + IFX_MATQ31_Q58(a[26], x[6]) + IFX_MATQ31_Q58(a[27], x[7]) + IFX_MATQ31_Q58(a[28], x[8])
+        + IFX_MATQ31_Q58(a[29], x[9]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[30], x[0]) + IFX_MATQ31_Q58(a[31], x[1]) + IFX_MATQ31_Q58(a[32], x[2])
+        + IFX_MATQ31_Q58(a[33], x[3]) + IFX_MATQ31_Q58(a[34], x[4]) + IFX_MATQ31_Q58(a[35], x[5])
+        + IFX_MATQ31_Q58(a[36], x[6]) + IFX_MATQ31_Q58(a[37], x[7]) + IFX_MATQ31_Q58(a[38], x[8])
+        + IFX_MATQ31_Q58(a[39], x[9]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[40], x[0]) + IFX_MATQ31_Q58(a[41], x[1]) + IFX_MATQ31_Q58(a[42], x[2])
+        + IFX_MATQ31_Q58(a[43], x[3]) + IFX_MATQ31_Q58(a[44], x[4]) + IFX_MATQ31_Q58(a[45], x[5])
+        + IFX_MATQ31_Q58(a[46], x[6]) + IFX_MATQ31_Q58(a[47], x[7]) + IFX_MATQ31_Q58(a[48], x[8])
+        + IFX_MATQ31_Q58(a[49], x[9]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[50], x[0]) + IFX_MATQ31_Q58(a[51], x[1]) + IFX_MATQ31_Q58(a[52], x[2])
+        + IFX_MATQ31_Q58(a[53], x[3]) + IFX_MATQ31_Q58(a[54], x[4]) + IFX_MATQ31_Q58(a[55], x[5])
+        + IFX_MATQ31_Q58(a[56], x[6]) + IFX_MATQ31_Q58(a[57], x[7]) + IFX_MATQ31_Q58(a[58], x[8])
+        + IFX_MATQ31_Q58(a[59], x[9]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], x[0]) + IFX_MATQ31_Q58(a[61], x[1]) + IFX_MATQ31_Q58(a[62], x[2])
+        + IFX_MATQ31_Q58(a[63], x[3]) + IFX_MATQ31_Q58(a[64], x[4]) + IFX_MATQ31_Q58(a[65], x[5])
+        + IFX_MATQ31_Q58(a[66], x[6]) + IFX_MATQ31_Q58(a[67], x[7]) + IFX_MATQ31_Q58(a[68], x[8])
+        + IFX_MATQ31_Q58(a[69], x[9]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[70], x[0]) + IFX_MATQ31_Q58(a[71], x[1]) + IFX_MATQ31_Q58(a[72], x[2])
+        + IFX_MATQ31_Q58(a[73], x[3]) + IFX_MATQ31_Q58(a[74], x[4]) + IFX_MATQ31_Q58(a[75], x[5])
+        + IFX_MATQ31_Q58(a[76], x[6]) + IFX_MATQ31_Q58(a[77], x[7]) + IFX_MATQ31_Q58(a[78], x[8])
+        + IFX_MATQ31_Q58(a[79], x[9]);
+    y[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[80], x[0]) + IFX_MATQ31_Q58(a[81], x[1]) + IFX_MATQ31_Q58(a[82], x[2])
+        + IFX_MATQ31_Q58(a[83], x[3]) + IFX_MATQ31_Q58(a[84], x[4]) + IFX_MATQ31_Q58(a[85], x[5])
+        + IFX_MATQ31_Q58(a[86], x[6]) + IFX_MATQ31_Q58(a[87], x[7]) + IFX_MATQ31_Q58(a[88], x[8])
+        + IFX_MATQ31_Q58(a[89], x[9]);
+    y[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[90], x[0]) + IFX_MATQ31_Q58(a[91], x[1]) + IFX_MATQ31_Q58(a[92], x[2])
+        + IFX_MATQ31_Q58(a[93], x[3]) + IFX_MATQ31_Q58(a[94], x[4]) + IFX_MATQ31_Q58(a[95], x[5])
+        + IFX_MATQ31_Q58(a[96], x[6]) + IFX_MATQ31_Q58(a[97], x[7]) + IFX_MATQ31_Q58(a[98], x[8])
+        + IFX_MATQ31_Q58(a[99], x[9]);
+    y[9] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add11(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+    c[49] = Ifx_MatQ31_saturate((sint64)a[49] + b[49]);
+    c[50] = Ifx_MatQ31_saturate((sint64)a[50] + b[50]);
+    c[51] = Ifx_MatQ31_saturate((sint64)a[51] + b[51]);
+    c[52] = Ifx_MatQ31_saturate((sint64)a[52] + b[52]);
+    c[53] = Ifx_MatQ31_saturate((sint64)a[53] + b[53]);
+    c[54] = Ifx_MatQ31_saturate((sint64)a[54] + b[54]);
+    c[55] = Ifx_MatQ31_saturate((sint64)a[55] + b[55]);
+    c[56] = Ifx_MatQ31_saturate((sint64)a[56] + b[56]);
+    c[57] = Ifx_MatQ31_saturate((sint64)a[57] + b[57]);
+    c[58] = Ifx_MatQ31_saturate((sint64)a[58] + b[58]);
+    c[59] = Ifx_MatQ31_saturate((sint64)a[59] + b[59]);
+    c[60] = Ifx_MatQ31_saturate((sint64)a[60] + b[60]);
+    c[61] = Ifx_MatQ31_saturate((sint64)a[61] + b[61]);
+    c[62] = Ifx_MatQ31_saturate((sint64)a[62] + b[62]);
+    c[63] = Ifx_MatQ31_saturate((sint64)a[63] + b[63]);
+    c[64] = Ifx_MatQ31_saturate((sint64)a[64] + b[64]);
+    c[65] = Ifx_MatQ31_saturate((sint64)a[65] + b[65]);
+    c[66] = Ifx_MatQ31_saturate((sint64)a[66] + b[66]);
+    c[67] = Ifx_MatQ31_saturate((sint64)a[67] + b[67]);
+    c[68] = Ifx_MatQ31_saturate((sint64)a[68] + b[68]);
+    c[69] = Ifx_MatQ31_saturate((sint64)a[69] + b[69]);
+    c[70] = Ifx_MatQ31_saturate((sint64)a[70] + b[70]);
+    c[71] = Ifx_MatQ31_saturate((sint64)a[71] + b[71]);
+    c[72] = Ifx_MatQ31_saturate((sint64)a[72] + b[72]);
+    c[73] = Ifx_MatQ31_saturate((sint64)a[73] + b[73]);
+    c[74] = Ifx_MatQ31_saturate((sint64)a[74] + b[74]);
+    c[75] = Ifx_MatQ31_saturate((sint64)a[75] + b[75]);
+    c[76] = Ifx_MatQ31_saturate((sint64)a[76] + b[76]);
+    c[77] = Ifx_MatQ31_saturate((sint64)a[77] + b[77]);
+    c[78] = Ifx_MatQ31_saturate((sint64)a[78] + b[78]);
+    c[79] = Ifx_MatQ31_saturate((sint64)a[79] + b[79]);
+    c[80] = Ifx_MatQ31_saturate((sint64)a[80] + b[80]);
+    c[81] = Ifx_MatQ31_saturate((sint64)a[81] + b[81]);
+    c[82] = Ifx_MatQ31_saturate((sint64)a[82] + b[82]);
+    c[83] = Ifx_MatQ31_saturate((sint64)a[83] + b[83]);
+    c[84] = Ifx_MatQ31_saturate((sint64)a[84] + b[84]);
+    c[85] = Ifx_MatQ31_saturate((sint64)a[85] + b[85]);
+    c[86] = Ifx_MatQ31_saturate((sint64)a[86] + b[86]);
+    c[87] = Ifx_MatQ31_saturate((sint64)a[87] + b[87]);
+    c[88] = Ifx_MatQ31_saturate((sint64)a[88] + b[88]);
+    c[89] = Ifx_MatQ31_saturate((sint64)a[89] + b[89]);
+    c[90] = Ifx_MatQ31_saturate((sint64)a[90] + b[90]);
+    c[91] = Ifx_MatQ31_saturate((sint64)a[91] + b[91]);
+    c[92] = Ifx_MatQ31_saturate((sint64)a[92] + b[92]);
+    c[93] = Ifx_MatQ31_saturate((sint64)a[93] + b[93]);
+    c[94] = Ifx_MatQ31_saturate((sint64)a[94] + b[94]);
+    c[95] = Ifx_MatQ31_saturate((sint64)a[95] + b[95]);
+    c[96] = Ifx_MatQ31_saturate((sint64)a[96] + b[96]);
+    c[97] = Ifx_MatQ31_saturate((sint64)a[97] + b[97]);
+    c[98] = Ifx_MatQ31_saturate((sint64)a[98] + b[98]);
+    c[99] = Ifx_MatQ31_saturate((sint64)a[99] + b[99]);
+    c[100] = Ifx_MatQ31_saturate((sint64)a[100] + b[100]);
+    c[101] = Ifx_MatQ31_saturate((sint64)a[101] + b[101]);
+    c[102] = Ifx_MatQ31_saturate((sint64)a[102] + b[102]);
+    c[103] = Ifx_MatQ31_saturate((sint64)a[103] + b[103]);
+    c[104] = Ifx_MatQ31_saturate((sint64)a[104] + b[104]);
+    c[105] = Ifx_MatQ31_saturate((sint64)a[105] + b[105]);
+    c[106] = Ifx_MatQ31_saturate((sint64)a[106] + b[106]);
+    c[107] = Ifx_MatQ31_saturate((sint64)a[107] + b[107]);
+    c[108] = Ifx_MatQ31_saturate((sint64)a[108] + b[108]);
+    c[109] = Ifx_MatQ31_saturate((sint64)a[109] + b[109]);
+    c[110] = Ifx_MatQ31_saturate((sint64)a[110] + b[110]);
+    c[111] = Ifx_MatQ31_saturate((sint64)a[111] + b[111]);
+    c[112] = Ifx_MatQ31_saturate((sint64)a[112] + b[112]);
+    c[113] = Ifx_MatQ31_saturate((sint64)a[113] + b[113]);
+    c[114] = Ifx_MatQ31_saturate((sint64)a[114] + b[114]);
+    c[115] = Ifx_MatQ31_saturate((sint64)a[115] + b[115]);
+    c[116] = Ifx_MatQ31_saturate((sint64)a[116] + b[116]);
+    c[117] = Ifx_MatQ31_saturate((sint64)a[117] + b[117]);
+    c[118] = Ifx_MatQ31_saturate((sint64)a[118] + b[118]);
+    c[119] = Ifx_MatQ31_saturate((sint64)a[119] + b[119]);
+    c[120] = Ifx_MatQ31_saturate((sint64)a[120] + b[120]);
+}
+
+
+void Ifx_MatQ31_transpose11(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[11];
+    c[2] = a[22];
+    c[3] = a[33];
+    c[4] = a[44];
+    c[5] = a[55];
+    c[6] = a[66];
+    c[7] = a[77];
+    c[8] = a[88];
+    c[9] = a[99];
+    c[10] = a[110];
+    c[11] = a[1];
+    c[12] = a[12];
+    c[13] = a[23];
+    c[14] = a[34];
+    c[15] = a[45];
+    c[16] = a[56];
+    c[17] = a[67];
+    c[18] = a[78];
+    c[19] = a[89];
+    c[20] = a[100];
+    c[21] = a[111];
+    c[22] = a[2];
+    c[23] = a[13];
+    c[24] = a[24];
+    c[25] = a[35];
+    c[26] = a[46];
+    c[27] = a[57];
+    c[28] = a[68];
+    c[29] = a[79];
+    c[30] = a[90];
+    c[31] = a[101];
+    c[32] = a[112];
+    c[33] = a[3];
+    c[34] = a[14];
+    c[35] = a[25];
+    c[36] = a[36];
+    c[37] = a[47];
+    c[38] = a[58];
+    c[39] = a[69];
+    c[40] = a[80];
+    c[41] = a[91];
+    c[42] = a[102];
+    c[43] = a[113];
+    c[44] = a[4];
+    c[45] = a[15];
+    c[46] = a[26];
+    c[47] = a[37];
+    c[48] = a[48];
+    c[49] = a[59];
+    c[50] = a[70];
+    c[51] = a[81];
+    c[52] = a[92];
+    c[53] = a[103];
+    c[54] = a[114];
+    c[55] = a[5];
+    c[56] = a[16];
+    c[57] = a[27];
+    c[58] = a[38];
+    c[59] = a[49];
+    c[60] = a[60];
+    c[61] = a[71];
+    c[62] = a[82];
+    c[63] = a[93];
+    c[64] = a[104];
+    c[65] = a[115];
+    c[66] = a[6];
+    c[67] = a[17];
+    c[68] = a[28];
+    c[69] = a[39];
+    c[70] = a[50];
+    c[71] = a[61];
+    c[72] = a[72];
+    c[73] = a[83];
+    c[74] = a[94];
+    c[75] = a[105];
+    c[76] = a[116];
+    c[77] = a[7];
+    c[78] = a[18];
+    c[79] = a[29];
+    c[80] = a[40];
+    c[81] = a[51];
+    c[82] = a[62];
+    c[83] = a[73];
+    c[84] = a[84];
+    c[85] = a[95];
+    c[86] = a[106];
+    c[87] = a[117];
+    c[88] = a[8];
+    c[89] = a[19];
+    c[90] = a[30];
+    c[91] = a[41];
+    c[92] = a[52];
+    c[93] = a[63];
+    c[94] = a[74];
+    c[95] = a[85];
+    c[96] = a[96];
+    c[97] = a[107];
+    c[98] = a[118];
+    c[99] = a[9];
+    c[100] = a[20];
+    c[101] = a[31];
+    c[102] = a[42];
+    c[103] = a[53];
+    c[104] = a[64];
+    c[105] = a[75];
+    c[106] = a[86];
+    c[107] = a[97];
+    c[108] = a[108];
+    c[109] = a[119];
+    c[110] = a[10];
+    c[111] = a[21];
+    c[112] = a[32];
+    c[113] = a[43];
+    c[114] = a[54];
+    c[115] = a[65];
+    c[116] = a[76];
+    c[117] = a[87];
+    c[118] = a[98];
+    c[119] = a[109];
+    c[120] = a[120];
+}
+
+
+void Ifx_MatQ31_mul11(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[11]) + IFX_MATQ31_Q58(a[2], b[22])
+        + IFX_MATQ31_Q58(a[3], b[33]) + IFX_MATQ31_Q58(a[4], b[44]) + IFX_MATQ31_Q58(a[5], b[55])
+        + IFX_MATQ31_Q58(a[6], b[66]) + IFX_MATQ31_Q58(a[7], b[77]) + IFX_MATQ31_Q58(a[8], b[88])
+        + IFX_MATQ31_Q58(a[9], b[99]) + IFX_MATQ31_Q58(a[10], b[110]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[23])
+        + IFX_MATQ31_Q58(a[3], b[34]) + IFX_MATQ31_Q58(a[4], b[45]) + IFX_MATQ31_Q58(a[5], b[56])
+        + IFX_MATQ31_Q58(a[6], b[67]) + IFX_MATQ31_Q58(a[7], b[78]) + IFX_MATQ31_Q58(a[8], b[89])
+        + IFX_MATQ31_Q58(a[9], b[100]) + IFX_MATQ31_Q58(a[10], b[111]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[24])
+        + IFX_MATQ31_Q58(a[3], b[35]) + IFX_MATQ31_Q58(a[4], b[46]) + IFX_MATQ31_Q58(a[5], b[57])
+        + IFX_MATQ31_Q58(a[6], b[68]) + IFX_MATQ31_Q58(a[7], b[79]) + IFX_MATQ31_Q58(a[8], b[90])
+        + IFX_MATQ31_Q58(a[9], b[101]) + IFX_MATQ31_Q58(a[10], b[112]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[14]) + IFX_MATQ31_Q58(a[2], b[25])
+        + IFX_MATQ31_Q58(a[3], b[36]) + IFX_MATQ31_Q58(a[4], b[47]) + IFX_MATQ31_Q58(a[5], b[58])
+        + IFX_MATQ31_Q58(a[6], b[69]) + IFX_MATQ31_Q58(a[7], b[80]) + IFX_MATQ31_Q58(a[8], b[91])
+        + IFX_MATQ31_Q58(a[9], b[102]) + IFX_MATQ31_Q58(a[10], b[113]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[15]) + IFX_MATQ31_Q58(a[2], b[26])
+        + IFX_MATQ31_Q58(a[3], b[37]) + IFX_MATQ31_Q58(a[4], b[48]) + IFX_MATQ31_Q58(a[5], b[59])
+        + IFX_MATQ31_Q58(a[6], b[70]) + IFX_MATQ31_Q58(a[7], b[81]) + IFX_MATQ31_Q58(a[8], b[92])
+        + IFX_MATQ31_Q58(a[9], b[103]) + IFX_MATQ31_Q58(a[10], b[114]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[16]) + IFX_MATQ31_Q58(a[2], b[27])
+        + IFX_MATQ31_Q58(a[3], b[38]) + IFX_MATQ31_Q58(a[4], b[49]) + IFX_MATQ31_Q58(a[5], b[60])
+        + IFX_MATQ31_Q58(a[6], b[71]) + IFX_MATQ31_Q58(a[7], b[82]) + IFX_MATQ31_Q58(a[8], b[93])
+        + IFX_MATQ31_Q58(a[9], b[104]) + IFX_MATQ31_Q58(a[10], b[115]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[17]) + IFX_MATQ31_Q58(a[2], b[28])
+        + IFX_MATQ31_Q58(a[3], b[39]) + IFX_MATQ31_Q58(a[4], b[50]) + IFX_MATQ31_Q58(a[5], b[61])
+        + IFX_MATQ31_Q58(a[6], b[72]) + IFX_MATQ31_Q58(a[7], b[83]) + IFX_MATQ31_Q58(a[8], b[94])
+        + IFX_MATQ31_Q58(a[9], b[105]) + IFX_MATQ31_Q58(a[10], b[116]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[7]) + IFX_MATQ31_Q58(a[1], b[18]) + IFX_MATQ31_Q58(a[2], b[29])
+        + IFX_MATQ31_Q58(a[3], b[40]) + IFX_MATQ31_Q58(a[4], b[51]) + IFX_MATQ31_Q58(a[5], b[62])
+        + IFX_MATQ31_Q58(a[6], b[73]) + IFX_MATQ31_Q58(a[7], b[84]) + IFX_MATQ31_Q58(a[8], b[95])
+        + IFX_MATQ31_Q58(a[9], b[106]) + IFX_MATQ31_Q58(a[10], b[117]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[8]) + IFX_MATQ31_Q58(a[1], b[19]) + IFX_MATQ31_Q58(a[2], b[30])
+        + IFX_MATQ31_Q58(a[3], b[41]) + IFX_MATQ31_Q58(a[4], b[52]) + IFX_MATQ31_Q58(a[5], b[63])
+        + IFX_MATQ31_Q58(a[6], b[74]) + IFX_MATQ31_Q58(a[7], b[85]) + IFX_MATQ31_Q58(a[8], b[96])
+        + IFX_MATQ31_Q58(a[9], b[107]) + IFX_MATQ31_Q58(a[10], b[118]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[9]) + IFX_MATQ31_Q58(a[1], b[20]) + IFX_MATQ31_Q58(a[2], b[31])
+        + IFX_MATQ31_Q58(a[3], b[42]) + IFX_MATQ31_Q58(a[4], b[53]) + IFX_MATQ31_Q58(a[5], b[64])
+        + IFX_MATQ31_Q58(a[6], b[75]) + IFX_MATQ31_Q58(a[7], b[86]) + IFX_MATQ31_Q58(a[8], b[97])
+        + IFX_MATQ31_Q58(a[9], b[108]) + IFX_MATQ31_Q58(a[10], b[119]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[10]) + IFX_MATQ31_Q58(a[1], b[21]) + IFX_MATQ31_Q58(a[2], b[32])
+        + IFX_MATQ31_Q58(a[3], b[43]) + IFX_MATQ31_Q58(a[4], b[54]) + IFX_MATQ31_Q58(a[5], b[65])
+        + IFX_MATQ31_Q58(a[6], b[76]) + IFX_MATQ31_Q58(a[7], b[87]) + IFX_MATQ31_Q58(a[8], b[98])
+        + IFX_MATQ31_Q58(a[9], b[109]) + IFX_MATQ31_Q58(a[10], b[120]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[0]) + IFX_MATQ31_Q58(a[12], b[11]) + IFX_MATQ31_Q58(a[13], b[22])
+        + IFX_MATQ31_Q58(a[14], b[33]) + IFX_MATQ31_Q58(a[15], b[44]) + IFX_MATQ31_Q58(a[16], b[55])
+        + IFX_MATQ31_Q58(a[17], b[66]) + IFX_MATQ31_Q58(a[18], b[77]) + IFX_MATQ31_Q58(a[19], b[88])
+        + IFX_MATQ31_Q58(a[20], b[99]) + IFX_MATQ31_Q58(a[21], b[110]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[1]) + IFX_MATQ31_Q58(a[12], b[12]) + IFX_MATQ31_Q58(a[13], b[23])
+        + IFX_MATQ31_Q58(a[14], b[34]) + IFX_MATQ31_Q58(a[15], b[45]) + IFX_MATQ31_Q58(a[16], b[56])
+        + IFX_MATQ31_Q58(a[17], b[67]) + IFX_MATQ31_Q58(a[18], b[78]) + IFX_MATQ31_Q58(a[19], b[89])
+        + IFX_MATQ31_Q58(a[20], b[100]) + IFX_MATQ31_Q58(a[21], b[111]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[2]) + IFX_MATQ31_Q58(a[12], b[13]) + IFX_MATQ31_Q58(a[13], b[24])
+        + IFX_MATQ31_Q58(a[14], b[35]) + IFX_MATQ31_Q58(a[15], b[46]) + IFX_MATQ31_Q58(a[16], b[57])
+        + IFX_MATQ31_Q58(a[17], b[68]) + IFX_MATQ31_Q58(a[18], b[79]) + IFX_MATQ31_Q58(a[19], b[90])
+        + IFX_MATQ31_Q58(a[20], b[101]) + IFX_MATQ31_Q58(a[21], b[112]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[3]) + IFX_MATQ31_Q58(a[12], b[14]) + IFX_MATQ31_Q58(a[13], b[25])
+        + IFX_MATQ31_Q58(a[14], b[36]) + IFX_MATQ31_Q58(a[15], b[47]) + IFX_MATQ31_Q58(a[16], b[58])
+        + IFX_MATQ31_Q58(a[17], b[69]) + IFX_MATQ31_Q58(a[18], b[80]) + IFX_MATQ31_Q58(a[19], b[91])
+        + IFX_MATQ31_Q58(a[20], b[102]) + IFX_MATQ31_Q58(a[21], b[113]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[4]) + IFX_MATQ31_Q58(a[12], b[15]) + IFX_MATQ31_Q58(a[13], b[26])
+        + IFX_MATQ31_Q58(a[14], b[37]) + IFX_MATQ31_Q58(a[15], b[48]) + IFX_MATQ31_Q58(a[16], b[59])
+        + IFX_MATQ31_Q58(a[17], b[70]) + IFX_MATQ31_Q58(a[18], b[81]) + IFX_MATQ31_Q58(a[19], b[92])
+        + IFX_MATQ31_Q58(a[20], b[103]) + IFX_MATQ31_Q58(a[21], b[114]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[5]) + IFX_MATQ31_Q58(a[12], b[16]) + IFX_MATQ31_Q58(a[13], b[27])
+        + IFX_MATQ31_Q58(a[14], b[38]) + IFX_MATQ31_Q58(a[15], b[49]) + IFX_MATQ31_Q58(a[16], b[60])
+        + IFX_MATQ31_Q58(a[17], b[71]) + IFX_MATQ31_Q58(a[18], b[82]) + IFX_MATQ31_Q58(a[19], b[93])
+        + IFX_MATQ31_Q58(a[20], b[104]) + IFX_MATQ31_Q58(a[21], b[115]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[6]) + IFX_MATQ31_Q58(a[12], b[17]) + IFX_MATQ31_Q58(a[13], b[28])
+        + IFX_MATQ31_Q58(a[14], b[39]) + IFX_MATQ31_Q58(a[15], b[50]) + IFX_MATQ31_Q58(a[16], b[61])
+        + IFX_MATQ31_Q58(a[17], b[72]) + IFX_MATQ31_Q58(a[18], b[83]) + IFX_MATQ31_Q58(a[19], b[94])
+        + IFX_MATQ31_Q58(a[20], b[105]) + IFX_MATQ31_Q58(a[21], b[116]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[7]) + IFX_MATQ31_Q58(a[12], b[18]) + IFX_MATQ31_Q58(a[13], b[29])
+        + IFX_MATQ31_Q58(a[14], b[40]) + IFX_MATQ31_Q58(a[15], b[51]) + IFX_MATQ31_Q58(a[16], b[62])
+        + IFX_MATQ31_Q58(a[17], b[73]) + IFX_MATQ31_Q58(a[18], b[84]) + IFX_MATQ31_Q58(a[19], b[95])
+        + IFX_MATQ31_Q58(a[20], b[106]) + IFX_MATQ31_Q58(a[21], b[117]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[8]) + IFX_MATQ31_Q58(a[12], b[19]) + IFX_MATQ31_Q58(a[13], b[30])
+        + IFX_MATQ31_Q58(a[14], b[41]) + IFX_MATQ31_Q58(a[15], b[52]) + IFX_MATQ31_Q58(a[16], b[63])
+        + IFX_MATQ31_Q58(a[17], b[74]) + IFX_MATQ31_Q58(a[18], b[85]) + IFX_MATQ31_Q58(a[19], b[96])
+        + IFX_MATQ31_Q58(a[20], b[107]) + IFX_MATQ31_Q58(a[21], b[118]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[9]) + IFX_MATQ31_Q58(a[12], b[20]) + IFX_MATQ31_Q58(a[13], b[31])
+        + IFX_MATQ31_Q58(a[14], b[42]) + IFX_MATQ31_Q58(a[15], b[53]) + IFX_MATQ31_Q58(a[16], b[64])
+        + IFX_MATQ31_Q58(a[17], b[75]) + IFX_MATQ31_Q58(a[18], b[86]) + IFX_MATQ31_Q58(a[19], b[97])
+        + IFX_MATQ31_Q58(a[20], b[108]) + IFX_MATQ31_Q58(a[21], b[119]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], b[10]) + IFX_MATQ31_Q58(a[12], b[21]) + IFX_MATQ31_Q58(a[13], b[32])
+        + IFX_MATQ31_Q58(a[14], b[43]) + IFX_MATQ31_Q58(a[15], b[54]) + IFX_MATQ31_Q58(a[16], b[65])
+        + IFX_MATQ31_Q58(a[17], b[76]) + IFX_MATQ31_Q58(a[18], b[87]) + IFX_MATQ31_Q58(a[19], b[98])
+        + IFX_MATQ31_Q58(a[20], b[109]) + IFX_MATQ31_Q58(a[21], b[120]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[0]) + IFX_MATQ31_Q58(a[23], b[11]) + IFX_MATQ31_Q58(a[24], b[22])
+        + IFX_MATQ31_Q58(a[25], b[33]) + IFX_MATQ31_Q58(a[26], b[44]) + IFX_MATQ31_Q58(a[27], b[55])
+        + IFX_MATQ31_Q58(a[28], b[66]) + IFX_MATQ31_Q58(a[29], b[77]) + IFX_MATQ31_Q58(a[30], b[88])
+        + IFX_MATQ31_Q58(a[31], b[99]) + IFX_MATQ31_Q58(a[32], b[110]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[1]) + IFX_MATQ31_Q58(a[23], b[12]) + IFX_MATQ31_Q58(a[24], b[23])
+        + IFX_MATQ31_Q58(a[25], b[34]) + IFX_MATQ31_Q58(a[26], b[45]) + IFX_MATQ31_Q58(a[27], b[56])
+        + IFX_MATQ31_Q58(a[28], b[67]) + IFX_MATQ31_Q58(a[29], b[78]) + IFX_MATQ31_Q58(a[30], b[89])
+        + IFX_MATQ31_Q58(a[31], b[100]) + IFX_MATQ31_Q58(a[32], b[111]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[2]) + IFX_MATQ31_Q58(a[23], b[13]) + IFX_MATQ31_Q58(a[24], b[24])
+        + IFX_MATQ31_Q58(a[25], b[35]) + IFX_MATQ31_Q58(a[26], b[46]) + IFX_MATQ31_Q58(a[27], b[57])
+        + IFX_MATQ31_Q58(a[28], b[68]) + IFX_MATQ31_Q58(a[29], b[79]) + IFX_MATQ31_Q58(a[30], b[90])
+        + IFX_MATQ31_Q58(a[31], b[101]) + IFX_MATQ31_Q58(a[32], b[112]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[3]) + IFX_MATQ31_Q58(a[23], b[14]) + IFX_MATQ31_Q58(a[24], b[25])
+        + IFX_MATQ31_Q58(a[25], b[36]) + IFX_MATQ31_Q58(a[26], b[47]) + IFX_MATQ31_Q58(a[27], b[58])
+        + IFX_MATQ31_Q58(a[28], b[69]) + IFX_MATQ31_Q58(a[29], b[80]) + IFX_MATQ31_Q58(a[30], b[91])
+        + IFX_MATQ31_Q58(a[31], b[102]) + IFX_MATQ31_Q58(a[32], b[113]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[4]) + IFX_MATQ31_Q58(a[23], b[15]) + IFX_MATQ31_Q58(a[24], b[26])
+        + IFX_MATQ31_Q58(a[25], b[37]) + IFX_MATQ31_Q58(a[26], b[48]) + IFX_MATQ31_Q58(a[27], b[59])
+        + IFX_MATQ31_Q58(a[28], b[70]) + IFX_MATQ31_Q58(a[29], b[81]) + IFX_MATQ31_Q58(a[30], b[92])
+        + IFX_MATQ31_Q58(a[31], b[103]) + IFX_MATQ31_Q58(a[32], b[114]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[5]) + IFX_MATQ31_Q58(a[23], b[16]) + IFX_MATQ31_Q58(a[24], b[27])
+        + IFX_MATQ31_Q58(a[25], b[38]) + IFX_MATQ31_Q58(a[26], b[49]) + IFX_MATQ31_Q58(a[27], b[60])
+        + IFX_MATQ31_Q58(a[28], b[71]) + IFX_MATQ31_Q58(a[29], b[82]) + IFX_MATQ31_Q58(a[30], b[93])
+        + IFX_MATQ31_Q58(a[31], b[104]) + IFX_MATQ31_Q58(a[32], b[115]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[6]) + IFX_MATQ31_Q58(a[23], b[17]) + IFX_MATQ31_Q58(a[24], b[28])
+        + IFX_MATQ31_Q58(a[25], b[39]) + IFX_MATQ31_Q58(a[26], b[50]) + IFX_MATQ31_Q58(a[27], b[61])
+        + IFX_MATQ31_Q58(a[28], b[72]) + IFX_MATQ31_Q58(a[29], b[83]) + IFX_MATQ31_Q58(a[30], b[94])
+        + IFX_MATQ31_Q58(a[31], b[105]) + IFX_MATQ31_Q58(a[32], b[116]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[7]) + IFX_MATQ31_Q58(a[23], b[18]) + IFX_MATQ31_Q58(a[24], b[29])
+        + IFX_MATQ31_Q58(a[25], b[40]) + IFX_MATQ31_Q58(a[26], b[51]) + IFX_MATQ31_Q58(a[27], b[62])
+        + IFX_MATQ31_Q58(a[28], b[73]) + IFX_MATQ31_Q58(a[29], b[84]) + IFX_MATQ31_Q58(a[30], b[95])
+        + IFX_MATQ31_Q58(a[31], b[106]) + IFX_MATQ31_Q58(a[32], b[117]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[8]) + IFX_MATQ31_Q58(a[23], b[19]) + IFX_MATQ31_Q58(a[24], b[30])
+        + IFX_MATQ31_Q58(a[25], b[41]) + IFX_MATQ31_Q58(a[26], b[52]) + IFX_MATQ31_Q58(a[27], b[63])
+        + IFX_MATQ31_Q58(a[28], b[74]) + IFX_MATQ31_Q58(a[29], b[85]) + IFX_MATQ31_Q58(a[30], b[96])
+        + IFX_MATQ31_Q58(a[31], b[107]) + IFX_MATQ31_Q58(a[32], b[118]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[9]) + IFX_MATQ31_Q58(a[23], b[20]) + IFX_MATQ31_Q58(a[24], b[31])
+        + IFX_MATQ31_Q58(a[25], b[42]) + IFX_MATQ31_Q58(a[26], b[53]) + IFX_MATQ31_Q58(a[27], b[64])
+        + IFX_MATQ31_Q58(a[28], b[75]) + IFX_MATQ31_Q58(a[29], b[86]) + IFX_MATQ31_Q58(a[30], b[97])
+        + IFX_MATQ31_Q58(a[31], b[108]) + IFX_MATQ31_Q58(a[32], b[119]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], b[10]) + IFX_MATQ31_Q58(a[23], b[21]) + IFX_MATQ31_Q58(a[24], b[32])
+        + IFX_MATQ31_Q58(a[25], b[43]) + IFX_MATQ31_Q58(a[26], b[54]) + IFX_MATQ31_Q58(a[27], b[65])
+        + IFX_MATQ31_Q58(a[28], b[76]) + IFX_MATQ31_Q58(a[29], b[87]) + IFX_MATQ31_Q58(a[30], b[98])
+        + IFX_MATQ31_Q58(a[31], b[109]) + IFX_MATQ31_Q58(a[32], b[120]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[0]) + IFX_MATQ31_Q58(a[34], b[11]) + IFX_MATQ31_Q58(a[35], b[22])
+        + IFX_MATQ31_Q58(a[36], b[33]) + IFX_MATQ31_Q58(a[37], b[44]) + IFX_MATQ31_Q58(a[38], b[55])
+        + IFX_MATQ31_Q58(a[39], b[66]) + IFX_MATQ31_Q58(a[40], b[77]) + IFX_MATQ31_Q58(a[41], b[88])
+        + IFX_MATQ31_Q58(a[42], b[99]) + IFX_MATQ31_Q58(a[43], b[110]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[1]) + IFX_MATQ31_Q58(a[34], b[12]) + IFX_MATQ31_Q58(a[35], b[23])
+        + IFX_MATQ31_Q58(a[36], b[34]) + IFX_MATQ31_Q58(a[37], b[45]) + IFX_MATQ31_Q58(a[38], b[56])
+        + IFX_MATQ31_Q58(a[39], b[67]) + IFX_MATQ31_Q58(a[40], b[78]) + IFX_MATQ31_Q58(a[41], b[89])
+        + IFX_MATQ31_Q58(a[42], b[100]) + IFX_MATQ31_Q58(a[43], b[111]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[2]) + IFX_MATQ31_Q58(a[34], b[13]) + IFX_MATQ31_Q58(a[35], b[24])
+        + IFX_MATQ31_Q58(a[36], b[35]) + IFX_MATQ31_Q58(a[37], b[46]) + IFX_MATQ31_Q58(a[38], b[57])
+        + IFX_MATQ31_Q58(a[39], b[68]) + IFX_MATQ31_Q58(a[40], b[79]) + IFX_MATQ31_Q58(a[41], b[90])
+        + IFX_MATQ31_Q58(a[42], b[101]) + IFX_MATQ31_Q58(a[43], b[112]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[3]) + IFX_MATQ31_Q58(a[34], b[14]) + IFX_MATQ31_Q58(a[35], b[25])
+        + IFX_MATQ31_Q58(a[36], b[36]) + IFX_MATQ31_Q58(a[37], b[47]) + IFX_MATQ31_Q58(a[38], b[58])
+        + IFX_MATQ31_Q58(a[39], b[69]) + IFX_MATQ31_Q58(a[40], b[80]) + IFX_MATQ31_Q58(a[41], b[91])
+        + IFX_MATQ31_Q58(a[42], b[102]) + IFX_MATQ31_Q58(a[43], b[113]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[4]) + IFX_MATQ31_Q58(a[34], b[15]) + IFX_MATQ31_Q58(a[35], b[26])
+        + IFX_MATQ31_Q58(a[36], b[37]) + IFX_MATQ31_Q58(a[37], b[48]) + IFX_MATQ31_Q58(a[38], b[59])
+        + IFX_MATQ31_Q58(a[39], b[70]) + IFX_MATQ31_Q58(a[40], b[81]) + IFX_MATQ31_Q58(a[41], b[92])
+        + IFX_MATQ31_Q58(a[42], b[103]) + IFX_MATQ31_Q58(a[43], b[114]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[5]) + IFX_MATQ31_Q58(a[34], b[16]) + IFX_MATQ31_Q58(a[35], b[27])
+        + IFX_MATQ31_Q58(a[36], b[38]) + IFX_MATQ31_Q58(a[37], b[49]) + IFX_MATQ31_Q58(a[38], b[60])
+        + IFX_MATQ31_Q58(a[39], b[71]) + IFX_MATQ31_Q58(a[40], b[82]) + IFX_MATQ31_Q58(a[41], b[93])
+        + IFX_MATQ31_Q58(a[42], b[104]) + IFX_MATQ31_Q58(a[43], b[115]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[6]) + IFX_MATQ31_Q58(a[34], b[17]) + IFX_MATQ31_Q58(a[35], b[28])
+        + IFX_MATQ31_Q58(a[36], b[39]) + IFX_MATQ31_Q58(a[37], b[50]) + IFX_MATQ31_Q58(a[38], b[61])
+        + IFX_MATQ31_Q58(a[39], b[72]) + IFX_MATQ31_Q58(a[40], b[83]) + IFX_MATQ31_Q58(a[41], b[94])
+        + IFX_MATQ31_Q58(a[42], b[105]) + IFX_MATQ31_Q58(a[43], b[116]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[7]) + IFX_MATQ31_Q58(a[34], b[18]) + IFX_MATQ31_Q58(a[35], b[29])
+        + IFX_MATQ31_Q58(a[36], b[40]) + IFX_MATQ31_Q58(a[37], b[51]) + IFX_MATQ31_Q58(a[38], b[62])
+        + IFX_MATQ31_Q58(a[39], b[73]) + IFX_MATQ31_Q58(a[40], b[84]) + IFX_MATQ31_Q58(a[41], b[95])
+        + IFX_MATQ31_Q58(a[42], b[106]) + IFX_MATQ31_Q58(a[43], b[117]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[8]) + IFX_MATQ31_Q58(a[34], b[19]) + IFX_MATQ31_Q58(a[35], b[30])
+        + IFX_MATQ31_Q58(a[36], b[41]) + IFX_MATQ31_Q58(a[37], b[52]) + IFX_MATQ31_Q58(a[38], b[63])
+        + IFX_MATQ31_Q58(a[39], b[74]) + IFX_MATQ31_Q58(a[40], b[85]) + IFX_MATQ31_Q58(a[41], b[96])
+        + IFX_MATQ31_Q58(a[42], b[107]) + IFX_MATQ31_Q58(a[43], b[118]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[9]) + IFX_MATQ31_Q58(a[34], b[20]) + IFX_MATQ31_Q58(a[35], b[31])
+        + IFX_MATQ31_Q58(a[36], b[42]) + IFX_MATQ31_Q58(a[37], b[53]) + IFX_MATQ31_Q58(a[38], b[64])
+        + IFX_MATQ31_Q58(a[39], b[75]) + IFX_MATQ31_Q58(a[40], b[86]) + IFX_MATQ31_Q58(a[41], b[97])
+        + IFX_MATQ31_Q58(a[42], b[108]) + IFX_MATQ31_Q58(a[43], b[119]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], b[10]) + IFX_MATQ31_Q58(a[34], b[21]) + IFX_MATQ31_Q58(a[35], b[32])
+        + IFX_MATQ31_Q58(a[36], b[43]) + IFX_MATQ31_Q58(a[37], b[54]) + IFX_MATQ31_Q58(a[38], b[65])
+        + IFX_MATQ31_Q58(a[39], b[76]) + IFX_MATQ31_Q58(a[40], b[87]) + IFX_MATQ31_Q58(a[41], b[98])
+        + IFX_MATQ31_Q58(a[42], b[109]) + IFX_MATQ31_Q58(a[43], b[120]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[0]) + IFX_MATQ31_Q58(a[45], b[11]) + IFX_MATQ31_Q58(a[46], b[22])
+        + IFX_MATQ31_Q58(a[47], b[33]) + IFX_MATQ31_Q58(a[48], b[44]) + IFX_MATQ31_Q58(a[49], b[55])
+        + IFX_MATQ31_Q58(a[50], b[66]) + IFX_MATQ31_Q58(a[51], b[77]) + IFX_MATQ31_Q58(a[52], b[88])
+        + IFX_MATQ31_Q58(a[53], b[99]) + IFX_MATQ31_Q58(a[54], b[110]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[1]) + IFX_MATQ31_Q58(a[45], b[12]) + IFX_MATQ31_Q58(a[46], b[23])
+        + IFX_MATQ31_Q58(a[47], b[34]) + IFX_MATQ31_Q58(a[48], b[45]) + IFX_MATQ31_Q58(a[49], b[56])
+        + IFX_MATQ31_Q58(a[50], b[67]) + IFX_MATQ31_Q58(a[51], b[78]) + IFX_MATQ31_Q58(a[52], b[89])
+        + IFX_MATQ31_Q58(a[53], b[100]) + IFX_MATQ31_Q58(a[54], b[111]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[2]) + IFX_MATQ31_Q58(a[45], b[13]) + IFX_MATQ31_Q58(a[46], b[24])
+        + IFX_MATQ31_Q58(a[47], b[35]) + IFX_MATQ31_Q58(a[48], b[46]) + IFX_MATQ31_Q58(a[49], b[57])
+        + IFX_MATQ31_Q58(a[50], b[68]) + IFX_MATQ31_Q58(a[51], b[79]) + IFX_MATQ31_Q58(a[52], b[90])
+        + IFX_MATQ31_Q58(a[53], b[101]) + IFX_MATQ31_Q58(a[54], b[112]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[3]) + IFX_MATQ31_Q58(a[45], b[14]) + IFX_MATQ31_Q58(a[46], b[25])
+        + IFX_MATQ31_Q58(a[47], b[36]) + IFX_MATQ31_Q58(a[48], b[47]) + IFX_MATQ31_Q58(a[49], b[58])
+        + IFX_MATQ31_Q58(a[50], b[69]) + IFX_MATQ31_Q58(a[51], b[80]) + IFX_MATQ31_Q58(a[52], b[91])
+        + IFX_MATQ31_Q58(a[53], b[102]) + IFX_MATQ31_Q58(a[54], b[113]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[4]) + IFX_MATQ31_Q58(a[45], b[15]) + IFX_MATQ31_Q58(a[46], b[26])
+        + IFX_MATQ31_Q58(a[47], b[37]) + IFX_MATQ31_Q58(a[48], b[48]) + IFX_MATQ31_Q58(a[49], b[59])
+        + IFX_MATQ31_Q58(a[50], b[70]) + IFX_MATQ31_Q58(a[51], b[81]) + IFX_MATQ31_Q58(a[52], b[92])
+        + IFX_MATQ31_Q58(a[53], b[103]) + IFX_MATQ31_Q58(a[54], b[114]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[5]) + IFX_MATQ31_Q58(a[45], b[16]) + IFX_MATQ31_Q58(a[46], b[27])
+        + IFX_MATQ31_Q58(a[47], b[38]) + IFX_MATQ31_Q58(a[48], b[49]) + IFX_MATQ31_Q58(a[49], b[60])
+        + IFX_MATQ31_Q58(a[50], b[71]) + IFX_MATQ31_Q58(a[51], b[82]) + IFX_MATQ31_Q58(a[52], b[93])
+        + IFX_MATQ31_Q58(a[53], b[104]) + IFX_MATQ31_Q58(a[54], b[115]);
+    c[49] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[6]) + IFX_MATQ31_Q58(a[45], b[17]) + IFX_MATQ31_Q58(a[46], b[28])
+        + IFX_MATQ31_Q58(a[47], b[39]) + IFX_MATQ31_Q58(a[48], b[50]) + IFX_MATQ31_Q58(a[49], b[61])
+        + IFX_MATQ31_Q58(a[50], b[72]) + IFX_MATQ31_Q58(a[51], b[83]) + IFX_MATQ31_Q58(a[52], b[94])
+        + IFX_MATQ31_Q58(a[53], b[105]) + IFX_MATQ31_Q58(a[54], b[116]);
+    c[50] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[7]) + IFX_MATQ31_Q58(a[45], b[18]) + IFX_MATQ31_Q58(a[46], b[29])
+        + IFX_MATQ31_Q58(a[47], b[40]) + IFX_MATQ31_Q58(a[48], b[51]) + IFX_MATQ31_Q58(a[49], b[62])
+        + IFX_MATQ31_Q58(a[50], b[73]) + IFX_MATQ31_Q58(a[51], b[84]) + IFX_MATQ31_Q58(a[52], b[95])
+        + IFX_MATQ31_Q58(a[53], b[106]) + IFX_MATQ31_Q58(a[54], b[117]);
+    c[51] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[8]) + IFX_MATQ31_Q58(a[45], b[19]) + IFX_MATQ31_Q58(a[46], b[30])
+        + IFX_MATQ31_Q58(a[47], b[41]) + IFX_MATQ31_Q58(a[48], b[52]) + IFX_MATQ31_Q58(a[49], b[63])
+        + IFX_MATQ31_Q58(a[50], b[74]) + IFX_MATQ31_Q58(a[51], b[85]) + IFX_MATQ31_Q58(a[52], b[96])
+        + IFX_MATQ31_Q58(a[53], b[107]) + IFX_MATQ31_Q58(a[54], b[118]);
+    c[52] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[9]) + IFX_MATQ31_Q58(a[45], b[20]) + IFX_MATQ31_Q58(a[46], b[31])
+        + IFX_MATQ31_Q58(a[47], b[42]) + IFX_MATQ31_Q58(a[48], b[53]) + IFX_MATQ31_Q58(a[49], b[64])
+        + IFX_MATQ31_Q58(a[50], b[75]) + IFX_MATQ31_Q58(a[51], b[86]) + IFX_MATQ31_Q58(a[52], b[97])
+        + IFX_MATQ31_Q58(a[53], b[108]) + IFX_MATQ31_Q58(a[54], b[119]);
+    c[53] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], b[10]) + IFX_MATQ31_Q58(a[45], b[21]) + IFX_MATQ31_Q58(a[46], b[32])
+        + IFX_MATQ31_Q58(a[47], b[43]) + IFX_MATQ31_Q58(a[48], b[54]) + IFX_MATQ31_Q58(a[49], b[65])
+        + IFX_MATQ31_Q58(a[50], b[76]) + IFX_MATQ31_Q58(a[51], b[87]) + IFX_MATQ31_Q58(a[52], b[98])
+        + IFX_MATQ31_Q58(a[53], b[109]) + IFX_MATQ31_Q58(a[54], b[120]);
+    c[54] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[0]) + IFX_MATQ31_Q58(a[56], b[11]) + IFX_MATQ31_Q58(a[57], b[22])
+        + IFX_MATQ31_Q58(a[58], b[33]) + IFX_MATQ31_Q58(a[59], b[44]) + IFX_MATQ31_Q58(a[60], b[55])
+        + IFX_MATQ31_Q58(a[61], b[66]) + IFX_MATQ31_Q58(a[62], b[77]) + IFX_MATQ31_Q58(a[63], b[88])
+        + IFX_MATQ31_Q58(a[64], b[99]) + IFX_MATQ31_Q58(a[65], b[110]);
+    c[55] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[1]) + IFX_MATQ31_Q58(a[56], b[12]) + IFX_MATQ31_Q58(a[57], b[23])
+        + IFX_MATQ31_Q58(a[58], b[34]) + IFX_MATQ31_Q58(a[59], b[45]) + IFX_MATQ31_Q58(a[60], b[56])
+        + IFX_MATQ31_Q58(a[61], b[67]) + IFX_MATQ31_Q58(a[62], b[78]) + IFX_MATQ31_Q58(a[63], b[89])
+        + IFX_MATQ31_Q58(a[64], b[100]) + IFX_MATQ31_Q58(a[65], b[111]);
+    c[56] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[2]) + IFX_MATQ31_Q58(a[56], b[13]) + IFX_MATQ31_Q58(a[57], b[24])
+        + IFX_MATQ31_Q58(a[58], b[35]) + IFX_MATQ31_Q58(a[59], b[46]) + IFX_MATQ31_Q58(a[60], b[57])
+        + IFX_MATQ31_Q58(a[61], b[68]) + IFX_MATQ31_Q58(a[62], b[79]) + IFX_MATQ31_Q58(a[63], b[90])
+        + IFX_MATQ31_Q58(a[64], b[101]) + IFX_MATQ31_Q58(a[65], b[112]);
+    c[57] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[3]) + IFX_MATQ31_Q58(a[56], b[14]) + IFX_MATQ31_Q58(a[57], b[25])
+        + IFX_MATQ31_Q58(a[58], b[36]) + IFX_MATQ31_Q58(a[59], b[47]) + IFX_MATQ31_Q58(a[60], b[58])
+        + IFX_MATQ31_Q58(a[61], b[69]) + IFX_MATQ31_Q58(a[62], b[80]) + IFX_MATQ31_Q58(a[63], b[91])
+        + IFX_MATQ31_Q58(a[64], b[102]) + IFX_MATQ31_Q58(a[65], b[113]);
+    c[58] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[4]) + IFX_MATQ31_Q58(a[56], b[15]) + IFX_MATQ31_Q58(a[57], b[26])
+        + IFX_MATQ31_Q58(a[58], b[37]) + IFX_MATQ31_Q58(a[59], b[48]) + IFX_MATQ31_Q58(a[60], b[59])
+        + IFX_MATQ31_Q58(a[61], b[70]) + IFX_MATQ31_Q58(a[62], b[81]) + IFX_MATQ31_Q58(a[63], b[92])
+        + IFX_MATQ31_Q58(a[64], b[103]) + IFX_MATQ31_Q58(a[65], b[114]);
+    c[59] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[5]) + IFX_MATQ31_Q58(a[56], b[16]) + IFX_MATQ31_Q58(a[57], b[27])
+        + IFX_MATQ31_Q58(a[58], b[38]) + IFX_MATQ31_Q58(a[59], b[49]) + IFX_MATQ31_Q58(a[60], b[60])
+        + IFX_MATQ31_Q58(a[61], b[71]) + IFX_MATQ31_Q58(a[62], b[82]) + IFX_MATQ31_Q58(a[63], b[93])
+        + IFX_MATQ31_Q58(a[64], b[104]) + IFX_MATQ31_Q58(a[65], b[115]);
+    c[60] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[6]) + IFX_MATQ31_Q58(a[56], b[17]) + IFX_MATQ31_Q58(a[57], b[28])
+        + IFX_MATQ31_Q58(a[58], b[39]) + IFX_MATQ31_Q58(a[59], b[50]) + IFX_MATQ31_Q58(a[60], b[61])
+        + IFX_MATQ31_Q58(a[61], b[72]) + IFX_MATQ31_Q58(a[62], b[83]) + IFX_MATQ31_Q58(a[63], b[94])
+        + IFX_MATQ31_Q58(a[64], b[105]) + IFX_MATQ31_Q58(a[65], b[116]);
+    c[61] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[7]) + IFX_MATQ31_Q58(a[56], b[18]) + IFX_MATQ31_Q58(a[57], b[29])
+        + IFX_MATQ31_Q58(a[58], b[40]) + IFX_MATQ31_Q58(a[59], b[51]) + IFX_MATQ31_Q58(a[60], b[62])
+        + IFX_MATQ31_Q58(a[61], b[73]) + IFX_MATQ31_Q58(a[62], b[84]) + IFX_MATQ31_Q58(a[63], b[95])
+        + IFX_MATQ31_Q58(a[64], b[106]) + IFX_MATQ31_Q58(a[65], b[117]);
+    c[62] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[8]) + IFX_MATQ31_Q58(a[56], b[19]) + IFX_MATQ31_Q58(a[57], b[30])
+        + IFX_MATQ31_Q58(a[58], b[41]) + IFX_MATQ31_Q58(a[59], b[52]) + IFX_MATQ31_Q58(a[60], b[63])
+        + IFX_MATQ31_Q58(a[61], b[74]) + IFX_MATQ31_Q58(a[62], b[85]) + IFX_MATQ31_Q58(a[63], b[96])
+        + IFX_MATQ31_Q58(a[64], b[107]) + IFX_MATQ31_Q58(a[65], b[118]);
+    c[63] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[9]) + IFX_MATQ31_Q58(a[56], b[20]) + IFX_MATQ31_Q58(a[57], b[31])
+        + IFX_MATQ31_Q58(a[58], b[42]) + IFX_MATQ31_Q58(a[59], b[53]) + IFX_MATQ31_Q58(a[60], b[64])
+        + IFX_MATQ31_Q58(a[61], b[75]) + IFX_MATQ31_Q58(a[62], b[86]) + IFX_MATQ31_Q58(a[63], b[97])
+        + IFX_MATQ31_Q58(a[64], b[108]) + IFX_MATQ31_Q58(a[65], b[119]);
+    c[64] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], b[10]) + IFX_MATQ31_Q58(a[56], b[21]) + IFX_MATQ31_Q58(a[57], b[32])
+        + IFX_MATQ31_Q58(a[58], b[43]) + IFX_MATQ31_Q58(a[59], b[54]) + IFX_MATQ31_Q58(a[60], b[65])
+        + IFX_MATQ31_Q58(a[61], b[76]) + IFX_MATQ31_Q58(a[62], b[87]) + IFX_MATQ31_Q58(a[63], b[98])
+        + IFX_MATQ31_Q58(a[64], b[109]) + IFX_MATQ31_Q58(a[65], b[120]);
+    c[65] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[0]) + IFX_MATQ31_Q58(a[67], b[11]) + IFX_MATQ31_Q58(a[68], b[22])
+        + IFX_MATQ31_Q58(a[69], b[33]) + IFX_MATQ31_Q58(a[70], b[44]) + IFX_MATQ31_Q58(a[71], b[55])
+        + IFX_MATQ31_Q58(a[72], b[66]) + IFX_MATQ31_Q58(a[73], b[77]) + IFX_MATQ31_Q58(a[74], b[88])
+        + IFX_MATQ31_Q58(a[75], b[99]) + IFX_MATQ31_Q58(a[76], b[110]);
+    c[66] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[1]) + IFX_MATQ31_Q58(a[67], b[12]) + IFX_MATQ31_Q58(a[68], b[23])
+        + IFX_MATQ31_Q58(a[69], b[34]) + IFX_MATQ31_Q58(a[70], b[45]) + IFX_MATQ31_Q58(a[71], b[56])
+        + IFX_MATQ31_Q58(a[72], b[67]) + IFX_MATQ31_Q58(a[73], b[78]) + IFX_MATQ31_Q58(a[74], b[89])
+        + IFX_MATQ31_Q58(a[75], b[100]) + IFX_MATQ31_Q58(a[76], b[111]);
+    c[67] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[2]) + IFX_MATQ31_Q58(a[67], b[13]) + IFX_MATQ31_Q58(a[68], b[24])
+        + IFX_MATQ31_Q58(a[69], b[35]) + IFX_MATQ31_Q58(a[70], b[46]) + IFX_MATQ31_Q58(a[71], b[57])
+        + IFX_MATQ31_Q58(a[72], b[68]) + IFX_MATQ31_Q58(a[73], b[79]) + IFX_MATQ31_Q58(a[74], b[90])
+        + IFX_MATQ31_Q58(a[75], b[101]) + IFX_MATQ31_Q58(a[76], b[112]);
+    c[68] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[3]) + IFX_MATQ31_Q58(a[67], b[14]) + IFX_MATQ31_Q58(a[68], b[25])
+        + IFX_MATQ31_Q58(a[69], b[36]) + IFX_MATQ31_Q58(a[70], b[47]) + IFX_MATQ31_Q58(a[71], b[58])
+        + IFX_MATQ31_Q58(a[72], b[69]) + IFX_MATQ31_Q58(a[73], b[80]) + IFX_MATQ31_Q58(a[74], b[91])
+        + IFX_MATQ31_Q58(a[75], b[102]) + IFX_MATQ31_Q58(a[76], b[113]);
+    c[69] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[4]) + IFX_MATQ31_Q58(a[67], b[15]) + IFX_MATQ31_Q58(a[68], b[26])
+        + IFX_MATQ31_Q58(a[69], b[37]) + IFX_MATQ31_Q58(a[70], b[48]) + IFX_MATQ31_Q58(a[71], b[59])
+        + IFX_MATQ31_Q58(a[72], b[70]) + IFX_MATQ31_Q58(a[73], b[81]) + IFX_MATQ31_Q58(a[74], b[92])
+        + IFX_MATQ31_Q58(a[75], b[103]) + IFX_MATQ31_Q58(a[76], b[114]);
+    c[70] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[5]) + IFX_MATQ31_Q58(a[67], b[16]) + IFX_MATQ31_Q58(a[68], b[27])
+        + IFX_MATQ31_Q58(a[69], b[38]) + IFX_MATQ31_Q58(a[70], b[49]) + IFX_MATQ31_Q58(a[71], b[60])
+        + IFX_MATQ31_Q58(a[72], b[71]) + IFX_MATQ31_Q58(a[73], b[82]) + IFX_MATQ31_Q58(a[74], b[93])
+        + IFX_MATQ31_Q58(a[75], b[104]) + IFX_MATQ31_Q58(a[76], b[115]);
+    c[71] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[6]) + IFX_MATQ31_Q58(a[67], b[17]) + IFX_MATQ31_Q58(a[68], b[28])
+        + IFX_MATQ31_Q58(a[69], b[39]) + IFX_MATQ31_Q58(a[70], b[50]) + IFX_MATQ31_Q58(a[71], b[61])
+        + IFX_MATQ31_Q58(a[72], b[72]) + IFX_MATQ31_Q58(a[73], b[83]) + IFX_MATQ31_Q58(a[74], b[94])
+        + IFX_MATQ31_Q58(a[75], b[105]) + IFX_MATQ31_Q58(a[76], b[116]);
+    c[72] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[7]) + IFX_MATQ31_Q58(a[67], b[18]) + IFX_MATQ31_Q58(a[68], b[29])
+        + IFX_MATQ31_Q58(a[69], b[40]) + IFX_MATQ31_Q58(a[70], b[51]) + IFX_MATQ31_Q58(a[71], b[62])
+        + IFX_MATQ31_Q58(a[72], b[73]) + IFX_MATQ31_Q58(a[73], b[84]) + IFX_MATQ31_Q58(a[74], b[95])
+        + IFX_MATQ31_Q58(a[75], b[106]) + IFX_MATQ31_Q58(a[76], b[117]);
+    c[73] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[8]) + IFX_MATQ31_Q58(a[67], b[19]) + IFX_MATQ31_Q58(a[68], b[30])
+        + IFX_MATQ31_Q58(a[69], b[41]) + IFX_MATQ31_Q58(a[70], b[52]) + IFX_MATQ31_Q58(a[71], b[63])
+        + IFX_MATQ31_Q58(a[72], b[74]) + IFX_MATQ31_Q58(a[73], b[85]) + IFX_MATQ31_Q58(a[74], b[96])
+        + IFX_MATQ31_Q58(a[75], b[107]) + IFX_MATQ31_Q58(a[76], b[118]);
+    c[74] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[9]) + IFX_MATQ31_Q58(a[67], b[20]) + IFX_MATQ31_Q58(a[68], b[31])
+        + IFX_MATQ31_Q58(a[69], b[42]) + IFX_MATQ31_Q58(a[70], b[53]) + IFX_MATQ31_Q58(a[71], b[64])
+        + IFX_MATQ31_Q58(a[72], b[75]) + IFX_MATQ31_Q58(a[73], b[86]) + IFX_MATQ31_Q58(a[74], b[97])
+        + IFX_MATQ31_Q58(a[75], b[108]) + IFX_MATQ31_Q58(a[76], b[119]);
+    c[75] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], b[10]) + IFX_MATQ31_Q58(a[67], b[21]) + IFX_MATQ31_Q58(a[68], b[32])
+        + IFX_MATQ31_Q58(a[69], b[43]) + IFX_MATQ31_Q58(a[70], b[54]) + IFX_MATQ31_Q58(a[71], b[65])
+        + IFX_MATQ31_Q58(a[72], b[76]) + IFX_MATQ31_Q58(a[73], b[87]) + IFX_MATQ31_Q58(a[74], b[98])
+        + IFX_MATQ31_Q58(a[75], b[109]) + IFX_MATQ31_Q58(a[76], b[120]);
+    c[76] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[0]) + IFX_MATQ31_Q58(a[78], b[11]) + IFX_MATQ31_Q58(a[79], b[22])
+        + IFX_MATQ31_Q58(a[80], b[33]) + IFX_MATQ31_Q58(a[81], b[44]) + IFX_MATQ31_Q58(a[82], b[55])
+        + IFX_MATQ31_Q58(a[83], b[66]) + IFX_MATQ31_Q58(a[84], b[77]) + IFX_MATQ31_Q58(a[85], b[88])
+        + IFX_MATQ31_Q58(a[86], b[99]) + IFX_MATQ31_Q58(a[87], b[110]);
+    c[77] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[1]) + IFX_MATQ31_Q58(a[78], b[12]) + IFX_MATQ31_Q58(a[79], b[23])
+        + IFX_MATQ31_Q58(a[80], b[34]) + IFX_MATQ31_Q58(a[81], b[45]) + IFX_MATQ31_Q58(a[82], b[56])
+        + IFX_MATQ31_Q58(a[83], b[67]) + IFX_MATQ31_Q58(a[84], b[78]) + IFX_MATQ31_Q58(a[85], b[89])
+        + IFX_MATQ31_Q58(a[86], b[100]) + IFX_MATQ31_Q58(a[87], b[111]);
+    c[78] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[2]) + IFX_MATQ31_Q58(a[78], b[13]) + IFX_MATQ31_Q58(a[79], b[24])
+        + IFX_MATQ31_Q58(a[80], b[35]) + IFX_MATQ31_Q58(a[81], b[46]) + IFX_MATQ31_Q58(a[82], b[57])
+        + IFX_MATQ31_Q58(a[83], b[68]) + IFX_MATQ31_Q58(a[84], b[79]) + IFX_MATQ31_Q58(a[85], b[90])
+        + IFX_MATQ31_Q58(a[86], b[101]) + IFX_MATQ31_Q58(a[87], b[112]);
+    c[79] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[3]) + IFX_MATQ31_Q58(a[78], b[14]) + IFX_MATQ31_Q58(a[79], b[25])
+        + IFX_MATQ31_Q58(a[80], b[36]) + IFX_MATQ31_Q58(a[81], b[47]) + IFX_MATQ31_Q58(a[82], b[58])
+        + IFX_MATQ31_Q58(a[83], b[69]) + IFX_MATQ31_Q58(a[84], b[80]) + IFX_MATQ31_Q58(a[85], b[91])
+        + IFX_MATQ31_Q58(a[86], b[102]) + IFX_MATQ31_Q58(a[87], b[113]);
+    c[80] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[4]) + IFX_MATQ31_Q58(a[78], b[15]) + IFX_MATQ31_Q58(a[79], b[26])
+        + IFX_MATQ31_Q58(a[80], b[37]) + IFX_MATQ31_Q58(a[81], b[48]) + IFX_MATQ31_Q58(a[82], b[59])
+        + IFX_MATQ31_Q58(a[83], b[70]) + IFX_MATQ31_Q58(a[84], b[81]) + IFX_MATQ31_Q58(a[85], b[92])
+        + IFX_MATQ31_Q58(a[86], b[103]) + IFX_MATQ31_Q58(a[87], b[114]);
+    c[81] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[5]) + IFX_MATQ31_Q58(a[78], b[16]) + IFX_MATQ31_Q58(a[79], b[27])
+        + IFX_MATQ31_Q58(a[80], b[38]) + IFX_MATQ31_Q58(a[81], b[49]) + IFX_MATQ31_Q58(a[82], b[60])
+        + IFX_MATQ31_Q58(a[83], b[71]) + IFX_MATQ31_Q58(a[84], b[82]) + IFX_MATQ31_Q58(a[85], b[93])
+        + IFX_MATQ31_Q58(a[86], b[104]) + IFX_MATQ31_Q58(a[87], b[115]);
+    c[82] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[6]) + IFX_MATQ31_Q58(a[78], b[17]) + IFX_MATQ31_Q58(a[79], b[28])
+        + IFX_MATQ31_Q58(a[80], b[39]) + IFX_MATQ31_Q58(a[81], b[50]) + IFX_MATQ31_Q58(a[82], b[61])
+        + IFX_MATQ31_Q58(a[83], b[72]) + IFX_MATQ31_Q58(a[84], b[83]) + IFX_MATQ31_Q58(a[85], b[94])
+        + IFX_MATQ31_Q58(a[86], b[105]) + IFX_MATQ31_Q58(a[87], b[116]);
+    c[83] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[7]) + IFX_MATQ31_Q58(a[78], b[18]) + IFX_MATQ31_Q58(a[79], b[29])
+        + IFX_MATQ31_Q58(a[80], b[40]) + IFX_MATQ31_Q58(a[81], b[51]) + IFX_MATQ31_Q58(a[82], b[62])
+        + IFX_MATQ31_Q58(a[83], b[73]) + IFX_MATQ31_Q58(a[84], b[84]) + IFX_MATQ31_Q58(a[85], b[95])
+        + IFX_MATQ31_Q58(a[86], b[106]) + IFX_MATQ31_Q58(a[87], b[117]);
+    c[84] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[8]) + IFX_MATQ31_Q58(a[78], b[19]) + IFX_MATQ31_Q58(a[79], b[30])
+        + IFX_MATQ31_Q58(a[80], b[41]) + IFX_MATQ31_Q58(a[81], b[52]) + IFX_MATQ31_Q58(a[82], b[63])
+        + IFX_MATQ31_Q58(a[83], b[74]) + IFX_MATQ31_Q58(a[84], b[85]) + IFX_MATQ31_Q58(a[85], b[96])
+        + IFX_MATQ31_Q58(a[86], b[107]) + IFX_MATQ31_Q58(a[87], b[118]);
+    c[85] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[9]) + IFX_MATQ31_Q58(a[78], b[20]) + IFX_MATQ31_Q58(a[79], b[31])
+        + IFX_MATQ31_Q58(a[80], b[42]) + IFX_MATQ31_Q58(a[81], b[53]) + IFX_MATQ31_Q58(a[82], b[64])
+        + IFX_MATQ31_Q58(a[83], b[75]) + IFX_MATQ31_Q58(a[84], b[86]) + IFX_MATQ31_Q58(a[85], b[97])
+        + IFX_MATQ31_Q58(a[86], b[108]) + IFX_MATQ31_Q58(a[87], b[119]);
+    c[86] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], b[10]) + IFX_MATQ31_Q58(a[78], b[21]) + IFX_MATQ31_Q58(a[79], b[32])
+        + IFX_MATQ31_Q58(a[80], b[43]) + IFX_MATQ31_Q58(a[81], b[54]) + IFX_MATQ31_Q58(a[82], b[65])
+        + IFX_MATQ31_Q58(a[83], b[76]) + IFX_MATQ31_Q58(a[84], b[87]) + IFX_MATQ31_Q58(a[85], b[98])
+        + IFX_MATQ31_Q58(a[86], b[109]) + IFX_MATQ31_Q58(a[87], b[120]);
+    c[87] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[0]) + IFX_MATQ31_Q58(a[89], b[11]) + IFX_MATQ31_Q58(a[90], b[22])
+        + IFX_MATQ31_Q58(a[91], b[33]) + IFX_MATQ31_Q58(a[92], b[44]) + IFX_MATQ31_Q58(a[93], b[55])
+        + IFX_MATQ31_Q58(a[94], b[66]) + IFX_MATQ31_Q58(a[95], b[77]) + IFX_MATQ31_Q58(a[96], b[88])
+        + IFX_MATQ31_Q58(a[97], b[99]) + IFX_MATQ31_Q58(a[98], b[110]);
+    c[88] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[1]) + IFX_MATQ31_Q58(a[89], b[12]) + IFX_MATQ31_Q58(a[90], b[23])
+        + IFX_MATQ31_Q58(a[91], b[34]) + IFX_MATQ31_Q58(a[92], b[45]) + IFX_MATQ31_Q58(a[93], b[56])
+        + IFX_MATQ31_Q58(a[94], b[67]) + IFX_MATQ31_Q58(a[95], b[78]) + IFX_MATQ31_Q58(a[96], b[89])
+        + IFX_MATQ31_Q58(a[97], b[100]) + IFX_MATQ31_Q58(a[98], b[111]);
+    c[89] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[2]) + IFX_MATQ31_Q58(a[89], b[13]) + IFX_MATQ31_Q58(a[90], b[24])
+        + IFX_MATQ31_Q58(a[91], b[35]) + IFX_MATQ31_Q58(a[92], b[46]) + IFX_MATQ31_Q58(a[93], b[57])
+        + IFX_MATQ31_Q58(a[94], b[68]) + IFX_MATQ31_Q58(a[95], b[79]) + IFX_MATQ31_Q58(a[96], b[90])
+        + IFX_MATQ31_Q58(a[97], b[101]) + IFX_MATQ31_Q58(a[98], b[112]);
+    c[90] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[3]) + IFX_MATQ31_Q58(a[89], b[14]) + IFX_MATQ31_Q58(a[90], b[25])
+        + IFX_MATQ31_Q58(a[91], b[36]) + IFX_MATQ31_Q58(a[92], b[47]) + IFX_MATQ31_Q58(a[93], b[58])
+        + IFX_MATQ31_Q58(a[94], b[69]) + IFX_MATQ31_Q58(a[95], b[80]) + IFX_MATQ31_Q58(a[96], b[91])
+        + IFX_MATQ31_Q58(a[97], b[102]) + IFX_MATQ31_Q58(a[98], b[113]);
+    c[91] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[4]) + IFX_MATQ31_Q58(a[89], b[15]) + IFX_MATQ31_Q58(a[90], b[26])
+        + IFX_MATQ31_Q58(a[91], b[37]) + IFX_MATQ31_Q58(a[92], b[48]) + IFX_MATQ31_Q58(a[93], b[59])
+        + IFX_MATQ31_Q58(a[94], b[70]) + IFX_MATQ31_Q58(a[95], b[81]) + IFX_MATQ31_Q58(a[96], b[92])
+        + IFX_MATQ31_Q58(a[97], b[103]) + IFX_MATQ31_Q58(a[98], b[114]);
+    c[92] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[5]) + IFX_MATQ31_Q58(a[89], b[16]) + IFX_MATQ31_Q58(a[90], b[27])
+        + IFX_MATQ31_Q58(a[91], b[38]) + IFX_MATQ31_Q58(a[92], b[49]) + IFX_MATQ31_Q58(a[93], b[60])
+        + IFX_MATQ31_Q58(a[94], b[71]) + IFX_MATQ31_Q58(a[95], b[82]) + IFX_MATQ31_Q58(a[96], b[93])
+        + IFX_MATQ31_Q58(a[97], b[104]) + IFX_MATQ31_Q58(a[98], b[115]);
+    c[93] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[6]) + IFX_MATQ31_Q58(a[89], b[17]) + IFX_MATQ31_Q58(a[90], b[28])
+        + IFX_MATQ31_Q58(a[91], b[39]) + IFX_MATQ31_Q58(a[92], b[50]) + IFX_MATQ31_Q58(a[93], b[61])
+        + IFX_MATQ31_Q58(a[94], b[72]) + IFX_MATQ31_Q58(a[95], b[83]) + IFX_MATQ31_Q58(a[96], b[94])
+        + IFX_MATQ31_Q58(a[97], b[105]) + IFX_MATQ31_Q58(a[98], b[116]);
+    c[94] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[7]) + IFX_MATQ31_Q58(a[89], b[18]) + IFX_MATQ31_Q58(a[90], b[29])
+        + IFX_MATQ31_Q58(a[91], b[40]) + IFX_MATQ31_Q58(a[92], b[51]) + IFX_MATQ31_Q58(a[93], b[62])
+        + IFX_MATQ31_Q58(a[94], b[73]) + IFX_MATQ31_Q58(a[95], b[84]) + IFX_MATQ31_Q58(a[96], b[95])
+        + IFX_MATQ31_Q58(a[97], b[106]) + IFX_MATQ31_Q58(a[98], b[117]);
+    c[95] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[8]) + IFX_MATQ31_Q58(a[89], b[19]) + IFX_MATQ31_Q58(a[90], b[30])
+        + IFX_MATQ31_Q58(a[91], b[41]) + IFX_MATQ31_Q58(a[92], b[52]) + IFX_MATQ31_Q58(a[93], b[63])
+        + IFX_MATQ31_Q58(a[94], b[74]) + IFX_MATQ31_Q58(a[95], b[85]) + IFX_MATQ31_Q58(a[96], b[96])
+        + IFX_MATQ31_Q58(a[97], b[107]) + IFX_MATQ31_Q58(a[98], b[118]);
+    c[96] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[9]) + IFX_MATQ31_Q58(a[89], b[20]) + IFX_MATQ31_Q58(a[90], b[31])
+        + IFX_MATQ31_Q58(a[91], b[42]) + IFX_MATQ31_Q58(a[92], b[53]) + IFX_MATQ31_Q58(a[93], b[64])
+        + IFX_MATQ31_Q58(a[94], b[75]) + IFX_MATQ31_Q58(a[95], b[86]) + IFX_MATQ31_Q58(a[96], b[97])
+        + IFX_MATQ31_Q58(a[97], b[108]) + IFX_MATQ31_Q58(a[98], b[119]);
+    c[97] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], b[10]) + IFX_MATQ31_Q58(a[89], b[21]) + IFX_MATQ31_Q58(a[90], b[32])
+        + IFX_MATQ31_Q58(a[91], b[43]) + IFX_MATQ31_Q58(a[92], b[54]) + IFX_MATQ31_Q58(a[93], b[65])
+        + IFX_MATQ31_Q58(a[94], b[76]) + IFX_MATQ31_Q58(a[95], b[87]) + IFX_MATQ31_Q58(a[96], b[98])
+        + IFX_MATQ31_Q58(a[97], b[109]) + IFX_MATQ31_Q58(a[98], b[120]);
+    c[98] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[0]) + IFX_MATQ31_Q58(a[100], b[11]) + IFX_MATQ31_Q58(a[101], b[22])
+        + IFX_MATQ31_Q58(a[102], b[33]) + IFX_MATQ31_Q58(a[103], b[44]) + IFX_MATQ31_Q58(a[104], b[55])
+        + IFX_MATQ31_Q58(a[105], b[66]) + IFX_MATQ31_Q58(a[106], b[77]) + IFX_MATQ31_Q58(a[107], b[88])
+        + IFX_MATQ31_Q58(a[108], b[99]) + IFX_MATQ31_Q58(a[109], b[110]);
+    c[99] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[1]) + IFX_MATQ31_Q58(a[100], b[12]) + IFX_MATQ31_Q58(a[101], b[23])
+        + IFX_MATQ31_Q58(a[102], b[34]) + IFX_MATQ31_Q58(a[103], b[45]) + IFX_MATQ31_Q58(a[104], b[56])
+        + IFX_MATQ31_Q58(a[105], b[67]) + IFX_MATQ31_Q58(a[106], b[78]) + IFX_MATQ31_Q58(a[107], b[89])
+        + IFX_MATQ31_Q58(a[108], b[100]) + IFX_MATQ31_Q58(a[109], b[111]);
+    c[100] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[2]) + IFX_MATQ31_Q58(a[100], b[13]) + IFX_MATQ31_Q58(a[101], b[24])
+        + IFX_MATQ31_Q58(a[102], b[35]) + IFX_MATQ31_Q58(a[103], b[46]) + IFX_MATQ31_Q58(a[104], b[57])
+        + IFX_MATQ31_Q58(a[105], b[68]) + IFX_MATQ31_Q58(a[106], b[79]) + IFX_MATQ31_Q58(a[107], b[90])
+        + IFX_MATQ31_Q58(a[108], b[101]) + IFX_MATQ31_Q58(a[109], b[112]);
+    c[101] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[3]) + IFX_MATQ31_Q58(a[100], b[14]) + IFX_MATQ31_Q58(a[101], b[25])
+        + IFX_MATQ31_Q58(a[102], b[36]) + IFX_MATQ31_Q58(a[103], b[47]) + IFX_MATQ31_Q58(a[104], b[58])
+        + IFX_MATQ31_Q58(a[105], b[69]) + IFX_MATQ31_Q58(a[106], b[80]) + IFX_MATQ31_Q58(a[107], b[91])
+        + IFX_MATQ31_Q58(a[108], b[102]) + IFX_MATQ31_Q58(a[109], b[113]);
+    c[102] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[4]) + IFX_MATQ31_Q58(a[100], b[15]) + IFX_MATQ31_Q58(a[101], b[26])
+        + IFX_MATQ31_Q58(a[102], b[37]) + IFX_MATQ31_Q58(a[103], b[48]) + IFX_MATQ31_Q58(a[104], b[59])
+        + IFX_MATQ31_Q58(a[105], b[70]) + IFX_MATQ31_Q58(a[106], b[81]) + IFX_MATQ31_Q58(a[107], b[92])
+        + IFX_MATQ31_Q58(a[108], b[103]) + IFX_MATQ31_Q58(a[109], b[114]);
+    c[103] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[5]) + IFX_MATQ31_Q58(a[100], b[16]) + IFX_MATQ31_Q58(a[101], b[27])
+        + IFX_MATQ31_Q58(a[102], b[38]) + IFX_MATQ31_Q58(a[103], b[49]) + IFX_MATQ31_Q58(a[104], b[60])
+        + IFX_MATQ31_Q58(a[105], b[71]) + IFX_MATQ31_Q58(a[106], b[82]) + IFX_MATQ31_Q58(a[107], b[93])
+        + IFX_MATQ31_Q58(a[108], b[104]) + IFX_MATQ31_Q58(a[109], b[115]);
+    c[104] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[6]) + IFX_MATQ31_Q58(a[100], b[17]) + IFX_MATQ31_Q58(a[101], b[28])
+        + IFX_MATQ31_Q58(a[102], b[39]) + IFX_MATQ31_Q58(a[103], b[50]) + IFX_MATQ31_Q58(a[104], b[61])
+        + IFX_MATQ31_Q58(a[105], b[72]) + IFX_MATQ31_Q58(a[106], b[83]) + IFX_MATQ31_Q58(a[107], b[94])
+        + IFX_MATQ31_Q58(a[108], b[105]) + IFX_MATQ31_Q58(a[109], b[116]);
+    c[105] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[7]) + IFX_MATQ31_Q58(a[100], b[18]) + IFX_MATQ31_Q58(a[101], b[29])
+        + IFX_MATQ31_Q58(a[102], b[40]) + IFX_MATQ31_Q58(a[103], b[51]) + IFX_MATQ31_Q58(a[104], b[62])
+        + IFX_MATQ31_Q58(a[105], b[73]) + IFX_MATQ31_Q58(a[106], b[84]) + IFX_MATQ31_Q58(a[107], b[95])
+        + IFX_MATQ31_Q58(a[108], b[106]) + IFX_MATQ31_Q58(a[109], b[117]);
+    c[106] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[8]) + IFX_MATQ31_Q58(a[100], b[19]) + IFX_MATQ31_Q58(a[101], b[30])
+        + IFX_MATQ31_Q58(a[102], b[41]) + IFX_MATQ31_Q58(a[103], b[52]) + IFX_MATQ31_Q58(a[104], b[63])
+        + IFX_MATQ31_Q58(a[105], b[74]) + IFX_MATQ31_Q58(a[106], b[85]) + IFX_MATQ31_Q58(a[107], b[96])
+        + IFX_MATQ31_Q58(a[108], b[107]) + IFX_MATQ31_Q58(a[109], b[118]);
+    c[107] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[9]) + IFX_MATQ31_Q58(a[100], b[20]) + IFX_MATQ31_Q58(a[101], b[31])
+        + IFX_MATQ31_Q58(a[102], b[42]) + IFX_MATQ31_Q58(a[103], b[53]) + IFX_MATQ31_Q58(a[104], b[64])
+        + IFX_MATQ31_Q58(a[105], b[75]) + IFX_MATQ31_Q58(a[106], b[86]) + IFX_MATQ31_Q58(a[107], b[97])
+        + IFX_MATQ31_Q58(a[108], b[108]) + IFX_MATQ31_Q58(a[109], b[119]);
+    c[108] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], b[10]) + IFX_MATQ31_Q58(a[100], b[21]) + IFX_MATQ31_Q58(a[101], b[32])
+        + IFX_MATQ31_Q58(a[102], b[43]) + IFX_MATQ31_Q58(a[103], b[54]) + IFX_MATQ31_Q58(a[104], b[65])
+        + IFX_MATQ31_Q58(a[105], b[76]) + IFX_MATQ31_Q58(a[106], b[87]) + IFX_MATQ31_Q58(a[107], b[98])
+        + IFX_MATQ31_Q58(a[108], b[109]) + IFX_MATQ31_Q58(a[109], b[120]);
+    c[109] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[0]) + IFX_MATQ31_Q58(a[111], b[11]) + IFX_MATQ31_Q58(a[112], b[22])
+        + IFX_MATQ31_Q58(a[113], b[33]) + IFX_MATQ31_Q58(a[114], b[44]) + IFX_MATQ31_Q58(a[115], b[55])
+        + IFX_MATQ31_Q58(a[116], b[66]) + IFX_MATQ31_Q58(a[117], b[77]) + IFX_MATQ31_Q58(a[118], b[88])
+        + IFX_MATQ31_Q58(a[119], b[99]) + IFX_MATQ31_Q58(a[120], b[110]);
+    c[110] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[1]) + IFX_MATQ31_Q58(a[111], b[12]) + IFX_MATQ31_Q58(a[112], b[23])
+        + IFX_MATQ31_Q58(a[113], b[34]) + IFX_MATQ31_Q58(a[114], b[45]) + IFX_MATQ31_Q58(a[115], b[56])
+        + IFX_MATQ31_Q58(a[116], b[67]) + IFX_MATQ31_Q58(a[117], b[78]) + IFX_MATQ31_Q58(a[118], b[89])
+        + IFX_MATQ31_Q58(a[119], b[100]) + IFX_MATQ31_Q58(a[120], b[111]);
+    c[111] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[2]) + IFX_MATQ31_Q58(a[111], b[13]) + IFX_MATQ31_Q58(a[112], b[24])
+        + IFX_MATQ31_Q58(a[113], b[35]) + IFX_MATQ31_Q58(a[114], b[46]) + IFX_MATQ31_Q58(a[115], b[57])
+        + IFX_MATQ31_Q58(a[116], b[68]) + IFX_MATQ31_Q58(a[117], b[79]) + IFX_MATQ31_Q58(a[118], b[90])
+        + IFX_MATQ31_Q58(a[119], b[101]) + IFX_MATQ31_Q58(a[120], b[112]);
+    c[112] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[3]) + IFX_MATQ31_Q58(a[111], b[14]) + IFX_MATQ31_Q58(a[112], b[25])
+        + IFX_MATQ31_Q58(a[113], b[36]) + IFX_MATQ31_Q58(a[114], b[47]) + IFX_MATQ31_Q58(a[115], b[58])
+        + IFX_MATQ31_Q58(a[116], b[69]) + IFX_MATQ31_Q58(a[117], b[80]) + IFX_MATQ31_Q58(a[118], b[91])
+        + IFX_MATQ31_Q58(a[119], b[102]) + IFX_MATQ31_Q58(a[120], b[113]);
+    c[113] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[4]) + IFX_MATQ31_Q58(a[111], b[15]) + IFX_MATQ31_Q58(a[112], b[26])
+        + IFX_MATQ31_Q58(a[113], b[37]) + IFX_MATQ31_Q58(a[114], b[48]) + IFX_MATQ31_Q58(a[115], b[59])
+        + IFX_MATQ31_Q58(a[116], b[70]) + IFX_MATQ31_Q58(a[117], b[81]) + IFX_MATQ31_Q58(a[118], b[92])
+        + IFX_MATQ31_Q58(a[119], b[103]) + IFX_MATQ31_Q58(a[120], b[114]);
+    c[114] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[5]) + IFX_MATQ31_Q58(a[111], b[16]) + IFX_MATQ31_Q58(a[112], b[27])
+        + IFX_MATQ31_Q58(a[113], b[38]) + IFX_MATQ31_Q58(a[114], b[49]) + IFX_MATQ31_Q58(a[115], b[60])
+        + IFX_MATQ31_Q58(a[116], b[71]) + IFX_MATQ31_Q58(a[117], b[82]) + IFX_MATQ31_Q58(a[118], b[93])
+        + IFX_MATQ31_Q58(a[119], b[104]) + IFX_MATQ31_Q58(a[120], b[115]);
+    c[115] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[6]) + IFX_MATQ31_Q58(a[111], b[17]) + IFX_MATQ31_Q58(a[112], b[28])
+        + IFX_MATQ31_Q58(a[113], b[39]) + IFX_MATQ31_Q58(a[114], b[50]) + IFX_MATQ31_Q58(a[115], b[61])
+        + IFX_MATQ31_Q58(a[116], b[72]) + IFX_MATQ31_Q58(a[117], b[83]) + IFX_MATQ31_Q58(a[118], b[94])
+        + IFX_MATQ31_Q58(a[119], b[105]) + IFX_MATQ31_Q58(a[120], b[116]);
+    c[116] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[7]) + IFX_MATQ31_Q58(a[111], b[18]) + IFX_MATQ31_Q58(a[112], b[29])
+        + IFX_MATQ31_Q58(a[113], b[40]) + IFX_MATQ31_Q58(a[114], b[51]) + IFX_MATQ31_Q58(a[115], b[62])
+        + IFX_MATQ31_Q58(a[116], b[73]) + IFX_MATQ31_Q58(a[117], b[84]) + IFX_MATQ31_Q58(a[118], b[95])
+        + IFX_MATQ31_Q58(a[119], b[106]) + IFX_MATQ31_Q58(a[120], b[117]);
+    c[117] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[8]) + IFX_MATQ31_Q58(a[111], b[19]) + IFX_MATQ31_Q58(a[112], b[30])
+        + IFX_MATQ31_Q58(a[113], b[41]) + IFX_MATQ31_Q58(a[114], b[52]) + IFX_MATQ31_Q58(a[115], b[63])
+        + IFX_MATQ31_Q58(a[116], b[74]) + IFX_MATQ31_Q58(a[117], b[85]) + IFX_MATQ31_Q58(a[118], b[96])
+        + IFX_MATQ31_Q58(a[119], b[107]) + IFX_MATQ31_Q58(a[120], b[118]);
+    c[118] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[9]) + IFX_MATQ31_Q58(a[111], b[20]) + IFX_MATQ31_Q58(a[112], b[31])
+        + IFX_MATQ31_Q58(a[113], b[42]) + IFX_MATQ31_Q58(a[114], b[53]) + IFX_MATQ31_Q58(a[115], b[64])
+        + IFX_MATQ31_Q58(a[116], b[75]) + IFX_MATQ31_Q58(a[117], b[86]) + IFX_MATQ31_Q58(a[118], b[97])
+        + IFX_MATQ31_Q58(a[119], b[108]) + IFX_MATQ31_Q58(a[120], b[119]);
+    c[119] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], b[10]) + IFX_MATQ31_Q58(a[111], b[21]) + IFX_MATQ31_Q58(a[112], b[32])
+        + IFX_MATQ31_Q58(a[113], b[43]) + IFX_MATQ31_Q58(a[114], b[54]) + IFX_MATQ31_Q58(a[115], b[65])
+        + IFX_MATQ31_Q58(a[116], b[76]) + IFX_MATQ31_Q58(a[117], b[87]) + IFX_MATQ31_Q58(a[118], b[98])
+        + IFX_MATQ31_Q58(a[119], b[109]) + IFX_MATQ31_Q58(a[120], b[120]);
+    c[120] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec11(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]) + IFX_MATQ31_Q58(a[7], x[7]) + IFX_MATQ31_Q58(a[8], x[8])
+        + IFX_MATQ31_Q58(a[9], x[9]) + IFX_MATQ31_Q58(a[10], x[10]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[11], x[0]) + IFX_MATQ31_Q58(a[12], x[1]) + IFX_MATQ31_Q58(a[13], x[2])
+        + IFX_MATQ31_Q58(a[14], x[3]) + IFX_MATQ31_Q58(a[15], x[4]) + IFX_MATQ31_Q58(a[16], x[5])
+        + IFX_MATQ31_Q58(a[17], x[6]) + IFX_MATQ31_Q58(a[18], x[7]) + IFX_MATQ31_Q58(a[19], x[8])
+        + IFX_MATQ31_Q58(a[20], x[9]) + IFX_MATQ31_Q58(a[21], x[10]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[22], x[0]) + IFX_MATQ31_Q58(a[23], x[1]) + IFX_MATQ31_Q58(a[24], x[2])
+        + IFX_MATQ31_Q58(a[25], x[3]) + IFX_MATQ31_Q58(a[26], x[4]) + IFX_MATQ31_Q58(a[27], x[5])
+        + IFX_MATQ31_Q58(a[28], x[6]) + IFX_MATQ31_Q58(a[29], x[7]) + IFX_MATQ31_Q58(a[30], x[8])
+        + IFX_MATQ31_Q58(a[31], x[9]) + IFX_MATQ31_Q58(a[32], x[10]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[33], x[0]) + IFX_MATQ31_Q58(a[34], x[1]) + IFX_MATQ31_Q58(a[35], x[2])
+        + IFX_MATQ31_Q58(a[36], x[3]) + IFX_MATQ31_Q58(a[37], x[4]) + IFX_MATQ31_Q58(a[38], x[5])
+        + IFX_MATQ31_Q58(a[39], x[6]) + IFX_MATQ31_Q58(a[40], x[7]) + IFX_MATQ31_Q58(a[41], x[8])
+        + IFX_MATQ31_Q58(a[42], x[9]) + IFX_MATQ31_Q58(a[43], x[10]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[44], x[0]) + IFX_MATQ31_Q58(a[45], x[1]) + IFX_MATQ31_Q58(a[46], x[2])
+        + IFX_MATQ31_Q58(a[47], x[3]) + IFX_MATQ31_Q58(a[48], x[4]) + IFX_MATQ31_Q58(a[49], x[5])
+        + IFX_MATQ31_Q58(a[50], x[6]) + IFX_MATQ31_Q58(a[51], x[7]) + IFX_MATQ31_Q58(a[52], x[8])
+        + IFX_MATQ31_Q58(a[53], x[9]) + IFX_MATQ31_Q58(a[54], x[10]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[55], x[0]) + IFX_MATQ31_Q58(a[56], x[1]) + IFX_MATQ31_Q58(a[57], x[2])
+        + IFX_MATQ31_Q58(a[58], x[3]) + IFX_MATQ31_Q58(a[59], x[4]) + IFX_MATQ31_Q58(a[60], x[5])
+        + IFX_MATQ31_Q58(a[61], x[6]) + IFX_MATQ31_Q58(a[62], x[7]) + IFX_MATQ31_Q58(a[63], x[8])
+        + IFX_MATQ31_Q58(a[64], x[9]) + IFX_MATQ31_Q58(a[65], x[10]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[66], x[0]) + IFX_MATQ31_Q58(a[67], x[1]) + IFX_MATQ31_Q58(a[68], x[2])
+        + IFX_MATQ31_Q58(a[69], x[3]) + IFX_MATQ31_Q58(a[70], x[4]) + IFX_MATQ31_Q58(a[71], x[5])
+        + IFX_MATQ31_Q58(a[72], x[6]) + IFX_MATQ31_Q58(a[73], x[7]) + IFX_MATQ31_Q58(a[74], x[8])
+        + IFX_MATQ31_Q58(a[75], x[9]) + IFX_MATQ31_Q58(a[76], x[10]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[77], x[0]) + IFX_MATQ31_Q58(a[78], x[1]) + IFX_MATQ31_Q58(a[79], x[2])
+        + IFX_MATQ31_Q58(a[80], x[3]) + IFX_MATQ31_Q58(a[81], x[4]) + IFX_MATQ31_Q58(a[82], x[5])
+        + IFX_MATQ31_Q58(a[83], x[6]) + IFX_MATQ31_Q58(a[84], x[7]) + IFX_MATQ31_Q58(a[85], x[8])
+        + IFX_MATQ31_Q58(a[86], x[9]) + IFX_MATQ31_Q58(a[87], x[10]);
+    y[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[88], x[0]) + IFX_MATQ31_Q58(a[89], x[1]) + IFX_MATQ31_Q58(a[90], x[2])
+        + IFX_MATQ31_Q58(a[91], x[3]) + IFX_MATQ31_Q58(a[92], x[4]) + IFX_MATQ31_Q58(a[93], x[5])
+        + IFX_MATQ31_Q58(a[94], x[6]) + IFX_MATQ31_Q58(a[95], x[7]) + IFX_MATQ31_Q58(a[96], x[8])
+        + IFX_MATQ31_Q58(a[97], x[9]) + IFX_MATQ31_Q58(a[98], x[10]);
+    y[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[99], x[0]) + IFX_MATQ31_Q58(a[100], x[1]) + IFX_MATQ31_Q58(a[101], x[2])
+        + IFX_MATQ31_Q58(a[102], x[3]) + IFX_MATQ31_Q58(a[103], x[4]) + IFX_MATQ31_Q58(a[104], x[5])
+        + IFX_MATQ31_Q58(a[105], x[6]) + IFX_MATQ31_Q58(a[106], x[7]) + IFX_MATQ31_Q58(a[107], x[8])
+        + IFX_MATQ31_Q58(a[108], x[9]) + IFX_MATQ31_Q58(a[109], x[10]);
+    y[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[110], x[0]) + IFX_MATQ31_Q58(a[111], x[1]) + IFX_MATQ31_Q58(a[112], x[2])
+        + IFX_MATQ31_Q58(a[113], x[3]) + IFX_MATQ31_Q58(a[114], x[4]) + IFX_MATQ31_Q58(a[115], x[5])
+        + IFX_MATQ31_Q58(a[116], x[6]) + IFX_MATQ31_Q58(a[117], x[7]) + IFX_MATQ31_Q58(a[118], x[8])
+        + IFX_MATQ31_Q58(a[119], x[9]) + IFX_MATQ31_Q58(a[120], x[10]);
+    y[10] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_add12(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    c[0] = Ifx_MatQ31_saturate((sint64)a[0] + b[0]);
+    c[1] = Ifx_MatQ31_saturate((sint64)a[1] + b[1]);
+    c[2] = Ifx_MatQ31_saturate((sint64)a[2] + b[2]);
+    c[3] = Ifx_MatQ31_saturate((sint64)a[3] + b[3]);
+    c[4] = Ifx_MatQ31_saturate((sint64)a[4] + b[4]);
+    c[5] = Ifx_MatQ31_saturate((sint64)a[5] + b[5]);
+    c[6] = Ifx_MatQ31_saturate((sint64)a[6] + b[6]);
+    c[7] = Ifx_MatQ31_saturate((sint64)a[7] + b[7]);
+    c[8] = Ifx_MatQ31_saturate((sint64)a[8] + b[8]);
+    c[9] = Ifx_MatQ31_saturate((sint64)a[9] + b[9]);
+    c[10] = Ifx_MatQ31_saturate((sint64)a[10] + b[10]);
+    c[11] = Ifx_MatQ31_saturate((sint64)a[11] + b[11]);
+    c[12] = Ifx_MatQ31_saturate((sint64)a[12] + b[12]);
+    c[13] = Ifx_MatQ31_saturate((sint64)a[13] + b[13]);
+    c[14] = Ifx_MatQ31_saturate((sint64)a[14] + b[14]);
+    c[15] = Ifx_MatQ31_saturate((sint64)a[15] + b[15]);
+    c[16] = Ifx_MatQ31_saturate((sint64)a[16] + b[16]);
+    c[17] = Ifx_MatQ31_saturate((sint64)a[17] + b[17]);
+    c[18] = Ifx_MatQ31_saturate((sint64)a[18] + b[18]);
+    c[19] = Ifx_MatQ31_saturate((sint64)a[19] + b[19]);
+    c[20] = Ifx_MatQ31_saturate((sint64)a[20] + b[20]);
+    c[21] = Ifx_MatQ31_saturate((sint64)a[21] + b[21]);
+    c[22] = Ifx_MatQ31_saturate((sint64)a[22] + b[22]);
+    c[23] = Ifx_MatQ31_saturate((sint64)a[23] + b[23]);
+    c[24] = Ifx_MatQ31_saturate((sint64)a[24] + b[24]);
+    c[25] = Ifx_MatQ31_saturate((sint64)a[25] + b[25]);
+    c[26] = Ifx_MatQ31_saturate((sint64)a[26] + b[26]);
+    c[27] = Ifx_MatQ31_saturate((sint64)a[27] + b[27]);
+    c[28] = Ifx_MatQ31_saturate((sint64)a[28] + b[28]);
+    c[29] = Ifx_MatQ31_saturate((sint64)a[29] + b[29]);
+    c[30] = Ifx_MatQ31_saturate((sint64)a[30] + b[30]);
+    c[31] = Ifx_MatQ31_saturate((sint64)a[31] + b[31]);
+    c[32] = Ifx_MatQ31_saturate((sint64)a[32] + b[32]);
+    c[33] = Ifx_MatQ31_saturate((sint64)a[33] + b[33]);
+    c[34] = Ifx_MatQ31_saturate((sint64)a[34] + b[34]);
+    c[35] = Ifx_MatQ31_saturate((sint64)a[35] + b[35]);
+    c[36] = Ifx_MatQ31_saturate((sint64)a[36] + b[36]);
+    c[37] = Ifx_MatQ31_saturate((sint64)a[37] + b[37]);
+    c[38] = Ifx_MatQ31_saturate((sint64)a[38] + b[38]);
+    c[39] = Ifx_MatQ31_saturate((sint64)a[39] + b[39]);
+    c[40] = Ifx_MatQ31_saturate((sint64)a[40] + b[40]);
+    c[41] = Ifx_MatQ31_saturate((sint64)a[41] + b[41]);
+    c[42] = Ifx_MatQ31_saturate((sint64)a[42] + b[42]);
+    c[43] = Ifx_MatQ31_saturate((sint64)a[43] + b[43]);
+    c[44] = Ifx_MatQ31_saturate((sint64)a[44] + b[44]);
+    c[45] = Ifx_MatQ31_saturate((sint64)a[45] + b[45]);
+    c[46] = Ifx_MatQ31_saturate((sint64)a[46] + b[46]);
+    c[47] = Ifx_MatQ31_saturate((sint64)a[47] + b[47]);
+    c[48] = Ifx_MatQ31_saturate((sint64)a[48] + b[48]);
+    c[49] = Ifx_MatQ31_saturate((sint64)a[49] + b[49]);
+    c[50] = Ifx_MatQ31_saturate((sint64)a[50] + b[50]);
+    c[51] = Ifx_MatQ31_saturate((sint64)a[51] + b[51]);
+    c[52] = Ifx_MatQ31_saturate((sint64)a[52] + b[52]);
+    c[53] = Ifx_MatQ31_saturate((sint64)a[53] + b[53]);
+    c[54] = Ifx_MatQ31_saturate((sint64)a[54] + b[54]);
+    c[55] = Ifx_MatQ31_saturate((sint64)a[55] + b[55]);
+    c[56] = Ifx_MatQ31_saturate((sint64)a[56] + b[56]);
+    c[57] = Ifx_MatQ31_saturate((sint64)a[57] + b[57]);
+    c[58] = Ifx_MatQ31_saturate((sint64)a[58] + b[58]);
+    c[59] = Ifx_MatQ31_saturate((sint64)a[59] + b[59]);
+    c[60] = Ifx_MatQ31_saturate((sint64)a[60] + b[60]);
+    c[61] = Ifx_MatQ31_saturate((sint64)a[61] + b[61]);
+    c[62] = Ifx_MatQ31_saturate((sint64)a[62] + b[62]);
+    c[63] = Ifx_MatQ31_saturate((sint64)a[63] + b[63]);
+    c[64] = Ifx_MatQ31_saturate((sint64)a[64] + b[64]);
+    c[65] = Ifx_MatQ31_saturate((sint64)a[65] + b[65]);
+    c[66] = Ifx_MatQ31_saturate((sint64)a[66] + b[66]);
+    c[67] = Ifx_MatQ31_saturate((sint64)a[67] + b[67]);
+    c[68] = Ifx_MatQ31_saturate((sint64)a[68] + b[68]);
+    c[69] = Ifx_MatQ31_saturate((sint64)a[69] + b[69]);
+    c[70] = Ifx_MatQ31_saturate((sint64)a[70] + b[70]);
+    c[71] = Ifx_MatQ31_saturate((sint64)a[71] + b[71]);
+    c[72] = Ifx_MatQ31_saturate((sint64)a[72] + b[72]);
+    c[73] = Ifx_MatQ31_saturate((sint64)a[73] + b[73]);
+    c[74] = Ifx_MatQ31_saturate((sint64)a[74] + b[74]);
+    c[75] = Ifx_MatQ31_saturate((sint64)a[75] + b[75]);
+    c[76] = Ifx_MatQ31_saturate((sint64)a[76] + b[76]);
+    c[77] = Ifx_MatQ31_saturate((sint64)a[77] + b[77]);
+    c[78] = Ifx_MatQ31_saturate((sint64)a[78] + b[78]);
+    c[79] = Ifx_MatQ31_saturate((sint64)a[79] + b[79]);
+    c[80] = Ifx_MatQ31_saturate((sint64)a[80] + b[80]);
+    c[81] = Ifx_MatQ31_saturate((sint64)a[81] + b[81]);
+    c[82] = Ifx_MatQ31_saturate((sint64)a[82] + b[82]);
+    c[83] = Ifx_MatQ31_saturate((sint64)a[83] + b[83]);
+    c[84] = Ifx_MatQ31_saturate((sint64)a[84] + b[84]);
+    c[85] = Ifx_MatQ31_saturate((sint64)a[85] + b[85]);
+    c[86] = Ifx_MatQ31_saturate((sint64)a[86] + b[86]);
+    c[87] = Ifx_MatQ31_saturate((sint64)a[87] + b[87]);
+    c[88] = Ifx_MatQ31_saturate((sint64)a[88] + b[88]);
+    c[89] = Ifx_MatQ31_saturate((sint64)a[89] + b[89]);
+    c[90] = Ifx_MatQ31_saturate((sint64)a[90] + b[90]);
+    c[91] = Ifx_MatQ31_saturate((sint64)a[91] + b[91]);
+    c[92] = Ifx_MatQ31_saturate((sint64)a[92] + b[92]);
+    c[93] = Ifx_MatQ31_saturate((sint64)a[93] + b[93]);
+    c[94] = Ifx_MatQ31_saturate((sint64)a[94] + b[94]);
+    c[95] = Ifx_MatQ31_saturate((sint64)a[95] + b[95]);
+    c[96] = Ifx_MatQ31_saturate((sint64)a[96] + b[96]);
+    c[97] = Ifx_MatQ31_saturate((sint64)a[97] + b[97]);
+    c[98] = Ifx_MatQ31_saturate((sint64)a[98] + b[98]);
+    c[99] = Ifx_MatQ31_saturate((sint64)a[99] + b[99]);
+    c[100] = Ifx_MatQ31_saturate((sint64)a[100] + b[100]);
+    c[101] = Ifx_MatQ31_saturate((sint64)a[101] + b[101]);
+    c[102] = Ifx_MatQ31_saturate((sint64)a[102] + b[102]);
+    c[103] = Ifx_MatQ31_saturate((sint64)a[103] + b[103]);
+    c[104] = Ifx_MatQ31_saturate((sint64)a[104] + b[104]);
+    c[105] = Ifx_MatQ31_saturate((sint64)a[105] + b[105]);
+    c[106] = Ifx_MatQ31_saturate((sint64)a[106] + b[106]);
+    c[107] = Ifx_MatQ31_saturate((sint64)a[107] + b[107]);
+    c[108] = Ifx_MatQ31_saturate((sint64)a[108] + b[108]);
+    c[109] = Ifx_MatQ31_saturate((sint64)a[109] + b[109]);
+    c[110] = Ifx_MatQ31_saturate((sint64)a[110] + b[110]);
+    c[111] = Ifx_MatQ31_saturate((sint64)a[111] + b[111]);
+    c[112] = Ifx_MatQ31_saturate((sint64)a[112] + b[112]);
+    c[113] = Ifx_MatQ31_saturate((sint64)a[113] + b[113]);
+    c[114] = Ifx_MatQ31_saturate((sint64)a[114] + b[114]);
+    c[115] = Ifx_MatQ31_saturate((sint64)a[115] + b[115]);
+    c[116] = Ifx_MatQ31_saturate((sint64)a[116] + b[116]);
+    c[117] = Ifx_MatQ31_saturate((sint64)a[117] + b[117]);
+    c[118] = Ifx_MatQ31_saturate((sint64)a[118] + b[118]);
+    c[119] = Ifx_MatQ31_saturate((sint64)a[119] + b[119]);
+    c[120] = Ifx_MatQ31_saturate((sint64)a[120] + b[120]);
+    c[121] = Ifx_MatQ31_saturate((sint64)a[121] + b[121]);
+    c[122] = Ifx_MatQ31_saturate((sint64)a[122] + b[122]);
+    c[123] = Ifx_MatQ31_saturate((sint64)a[123] + b[123]);
+    c[124] = Ifx_MatQ31_saturate((sint64)a[124] + b[124]);
+    c[125] = Ifx_MatQ31_saturate((sint64)a[125] + b[125]);
+    c[126] = Ifx_MatQ31_saturate((sint64)a[126] + b[126]);
+    c[127] = Ifx_MatQ31_saturate((sint64)a[127] + b[127]);
+    c[128] = Ifx_MatQ31_saturate((sint64)a[128] + b[128]);
+    c[129] = Ifx_MatQ31_saturate((sint64)a[129] + b[129]);
+    c[130] = Ifx_MatQ31_saturate((sint64)a[130] + b[130]);
+    c[131] = Ifx_MatQ31_saturate((sint64)a[131] + b[131]);
+    c[132] = Ifx_MatQ31_saturate((sint64)a[132] + b[132]);
+    c[133] = Ifx_MatQ31_saturate((sint64)a[133] + b[133]);
+    c[134] = Ifx_MatQ31_saturate((sint64)a[134] + b[134]);
+    c[135] = Ifx_MatQ31_saturate((sint64)a[135] + b[135]);
+    c[136] = Ifx_MatQ31_saturate((sint64)a[136] + b[136]);
+    c[137] = Ifx_MatQ31_saturate((sint64)a[137] + b[137]);
+    c[138] = Ifx_MatQ31_saturate((sint64)a[138] + b[138]);
+    c[139] = Ifx_MatQ31_saturate((sint64)a[139] + b[139]);
+    c[140] = Ifx_MatQ31_saturate((sint64)a[140] + b[140]);
+    c[141] = Ifx_MatQ31_saturate((sint64)a[141] + b[141]);
+    c[142] = Ifx_MatQ31_saturate((sint64)a[142] + b[142]);
+    c[143] = Ifx_MatQ31_saturate((sint64)a[143] + b[143]);
+}
+
+
+void Ifx_MatQ31_transpose12(sint32 *c, const sint32 *a)
+{
+    c[0] = a[0];
+    c[1] = a[12];
+    c[2] = a[24];
+    c[3] = a[36];
+    c[4] = a[48];
+    c[5] = a[60];
+    c[6] = a[72];
+    c[7] = a[84];
+    c[8] = a[96];
+    c[9] = a[108];
+    c[10] = a[120];
+    c[11] = a[132];
+    c[12] = a[1];
+    c[13] = a[13];
+    c[14] = a[25];
+    c[15] = a[37];
+    c[16] = a[49];
+    c[17] = a[61];
+    c[18] = a[73];
+    c[19] = a[85];
+    c[20] = a[97];
+    c[21] = a[109];
+    c[22] = a[121];
+    c[23] = a[133];
+    c[24] = a[2];
+    c[25] = a[14];
+    c[26] = a[26];
+    c[27] = a[38];
+    c[28] = a[50];
+    c[29] = a[62];
+    c[30] = a[74];
+    c[31] = a[86];
+    c[32] = a[98];
+    c[33] = a[110];
+    c[34] = a[122];
+    c[35] = a[134];
+    c[36] = a[3];
+    c[37] = a[15];
+    c[38] = a[27];
+    c[39] = a[39];
+    c[40] = a[51];
+    c[41] = a[63];
+    c[42] = a[75];
+    c[43] = a[87];
+    c[44] = a[99];
+    c[45] = a[111];
+    c[46] = a[123];
+    c[47] = a[135];
+    c[48] = a[4];
+    c[49] = a[16];
+    c[50] = a[28];
+    c[51] = a[40];
+    c[52] = a[52];
+    c[53] = a[64];
+    c[54] = a[76];
+    c[55] = a[88];
+    c[56] = a[100];
+    c[57] = a[112];
+    c[58] = a[124];
+    c[59] = a[136];
+    c[60] = a[5];
+    c[61] = a[17];
+    c[62] = a[29];
+    c[63] = a[41];
+    c[64] = a[53];
+    c[65] = a[65];
+    c[66] = a[77];
+    c[67] = a[89];
+    c[68] = a[101];
+    c[69] = a[113];
+    c[70] = a[125];
+    c[71] = a[137];
+    c[72] = a[6];
+    c[73] = a[18];
+    c[74] = a[30];
+    c[75] = a[42];
+    c[76] = a[54];
+    c[77] = a[66];
+    c[78] = a[78];
+    c[79] = a[90];
+    c[80] = a[102];
+    c[81] = a[114];
+    c[82] = a[126];
+    c[83] = a[138];
+    c[84] = a[7];
+    c[85] = a[19];
+    c[86] = a[31];
+    c[87] = a[43];
+    c[88] = a[55];
+    c[89] = a[67];
+    c[90] = a[79];
+    c[91] = a[91];
+    c[92] = a[103];
+    c[93] = a[115];
+    c[94] = a[127];
+    c[95] = a[139];
+    c[96] = a[8];
+    c[97] = a[20];
+    c[98] = a[32];
+    c[99] = a[44];
+    c[100] = a[56];
+    c[101] = a[68];
+    c[102] = a[80];
+    c[103] = a[92];
+    c[104] = a[104];
+    c[105] = a[116];
+    c[106] = a[128];
+    c[107] = a[140];
+    c[108] = a[9];
+    c[109] = a[21];
+    c[110] = a[33];
+    c[111] = a[45];
+    c[112] = a[57];
+    c[113] = a[69];
+    c[114] = a[81];
+    c[115] = a[93];
+    c[116] = a[105];
+    c[117] = a[117];
+    c[118] = a[129];
+    c[119] = a[141];
+    c[120] = a[10];
+    c[121] = a[22];
+    c[122] = a[34];
+    c[123] = a[46];
+    c[124] = a[58];
+    c[125] = a[70];
+    c[126] = a[82];
+    c[127] = a[94];
+    c[128] = a[106];
+    c[129] = a[118];
+    c[130] = a[130];
+    c[131] = a[142];
+    c[132] = a[11];
+    c[133] = a[23];
+    c[134] = a[35];
+    c[135] = a[47];
+    c[136] = a[59];
+    c[137] = a[71];
+    c[138] = a[83];
+    c[139] = a[95];
+    c[140] = a[107];
+    c[141] = a[119];
+    c[142] = a[131];
+    c[143] = a[143];
+}
+
+
+void Ifx_MatQ31_mul12(sint32 *c, const sint32 *a, const sint32 *b)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], b[0]) + IFX_MATQ31_Q58(a[1], b[12]) + IFX_MATQ31_Q58(a[2], b[24])
+        + IFX_MATQ31_Q58(a[3], b[36]) + IFX_MATQ31_Q58(a[4], b[48]) + IFX_MATQ31_Q58(a[5], b[60])
+        + IFX_MATQ31_Q58(a[6], b[72]) + IFX_MATQ31_Q58(a[7], b[84]) + IFX_MATQ31_Q58(a[8], b[96])
+        + IFX_MATQ31_Q58(a[9], b[108]) + IFX_MATQ31_Q58(a[10], b[120]) + IFX_MATQ31_Q58(a[11], b[132]);
+    c[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[1]) + IFX_MATQ31_Q58(a[1], b[13]) + IFX_MATQ31_Q58(a[2], b[25])
+        + IFX_MATQ31_Q58(a[3], b[37]) + IFX_MATQ31_Q58(a[4], b[49]) + IFX_MATQ31_Q58(a[5], b[61])
+        + IFX_MATQ31_Q58(a[6], b[73]) + IFX_MATQ31_Q58(a[7], b[85]) + IFX_MATQ31_Q58(a[8], b[97])
+        + IFX_MATQ31_Q58(a[9], b[109]) + IFX_MATQ31_Q58(a[10], b[121]) + IFX_MATQ31_Q58(a[11], b[133]);
+    c[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[2]) + IFX_MATQ31_Q58(a[1], b[14]) + IFX_MATQ31_Q58(a[2], b[26])
+        + IFX_MATQ31_Q58(a[3], b[38]) + IFX_MATQ31_Q58(a[4], b[50]) + IFX_MATQ31_Q58(a[5], b[62])
+        + IFX_MATQ31_Q58(a[6], b[74]) + IFX_MATQ31_Q58(a[7], b[86]) + IFX_MATQ31_Q58(a[8], b[98])
+        + IFX_MATQ31_Q58(a[9], b[110]) + IFX_MATQ31_Q58(a[10], b[122]) + IFX_MATQ31_Q58(a[11], b[134]);
+    c[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[3]) + IFX_MATQ31_Q58(a[1], b[15]) + IFX_MATQ31_Q58(a[2], b[27])
+        + IFX_MATQ31_Q58(a[3], b[39]) + IFX_MATQ31_Q58(a[4], b[51]) + IFX_MATQ31_Q58(a[5], b[63])
+        + IFX_MATQ31_Q58(a[6], b[75]) + IFX_MATQ31_Q58(a[7], b[87]) + IFX_MATQ31_Q58(a[8], b[99])
+        + IFX_MATQ31_Q58(a[9], b[111]) + IFX_MATQ31_Q58(a[10], b[123]) + IFX_MATQ31_Q58(a[11], b[135]);
+    c[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[4]) + IFX_MATQ31_Q58(a[1], b[16]) + IFX_MATQ31_Q58(a[2], b[28])
+        + IFX_MATQ31_Q58(a[3], b[40]) + IFX_MATQ31_Q58(a[4], b[52]) + IFX_MATQ31_Q58(a[5], b[64])
+        + IFX_MATQ31_Q58(a[6], b[76]) + IFX_MATQ31_Q58(a[7], b[88]) + IFX_MATQ31_Q58(a[8], b[100])
+        + IFX_MATQ31_Q58(a[9], b[112]) + IFX_MATQ31_Q58(a[10], b[124]) + IFX_MATQ31_Q58(a[11], b[136]);
+    c[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[5]) + IFX_MATQ31_Q58(a[1], b[17]) + IFX_MATQ31_Q58(a[2], b[29])
+        + IFX_MATQ31_Q58(a[3], b[41]) + IFX_MATQ31_Q58(a[4], b[53]) + IFX_MATQ31_Q58(a[5], b[65])
+        + IFX_MATQ31_Q58(a[6], b[77]) + IFX_MATQ31_Q58(a[7], b[89]) + IFX_MATQ31_Q58(a[8], b[101])
+        + IFX_MATQ31_Q58(a[9], b[113]) + IFX_MATQ31_Q58(a[10], b[125]) + IFX_MATQ31_Q58(a[11], b[137]);
+    c[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[6]) + IFX_MATQ31_Q58(a[1], b[18]) + IFX_MATQ31_Q58(a[2], b[30])
+        + IFX_MATQ31_Q58(a[3], b[42]) + IFX_MATQ31_Q58(a[4], b[54]) + IFX_MATQ31_Q58(a[5], b[66])
+        + IFX_MATQ31_Q58(a[6], b[78]) + IFX_MATQ31_Q58(a[7], b[90]) + IFX_MATQ31_Q58(a[8], b[102])
+        + IFX_MATQ31_Q58(a[9], b[114]) + IFX_MATQ31_Q58(a[10], b[126]) + IFX_MATQ31_Q58(a[11], b[138]);
+    c[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[7]) + IFX_MATQ31_Q58(a[1], b[19]) + IFX_MATQ31_Q58(a[2], b[31])
+        + IFX_MATQ31_Q58(a[3], b[43]) + IFX_MATQ31_Q58(a[4], b[55]) + IFX_MATQ31_Q58(a[5], b[67])
+        + IFX_MATQ31_Q58(a[6], b[79]) + IFX_MATQ31_Q58(a[7], b[91]) + IFX_MATQ31_Q58(a[8], b[103])
+        + IFX_MATQ31_Q58(a[9], b[115]) + IFX_MATQ31_Q58(a[10], b[127]) + IFX_MATQ31_Q58(a[11], b[139]);
+    c[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[8]) + IFX_MATQ31_Q58(a[1], b[20]) + IFX_MATQ31_Q58(a[2], b[32])
+        + IFX_MATQ31_Q58(a[3], b[44]) + IFX_MATQ31_Q58(a[4], b[56]) + IFX_MATQ31_Q58(a[5], b[68])
+        + IFX_MATQ31_Q58(a[6], b[80]) + IFX_MATQ31_Q58(a[7], b[92]) + IFX_MATQ31_Q58(a[8], b[104])
+        + IFX_MATQ31_Q58(a[9], b[116]) + IFX_MATQ31_Q58(a[10], b[128]) + IFX_MATQ31_Q58(a[11], b[140]);
+    c[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[9]) + IFX_MATQ31_Q58(a[1], b[21]) + IFX_MATQ31_Q58(a[2], b[33])
+        + IFX_MATQ31_Q58(a[3], b[45]) + IFX_MATQ31_Q58(a[4], b[57]) + IFX_MATQ31_Q58(a[5], b[69])
+        + IFX_MATQ31_Q58(a[6], b[81]) + IFX_MATQ31_Q58(a[7], b[93]) + IFX_MATQ31_Q58(a[8], b[105])
+        + IFX_MATQ31_Q58(a[9], b[117]) + IFX_MATQ31_Q58(a[10], b[129]) + IFX_MATQ31_Q58(a[11], b[141]);
+    c[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[10]) + IFX_MATQ31_Q58(a[1], b[22]) + IFX_MATQ31_Q58(a[2], b[34])
+        + IFX_MATQ31_Q58(a[3], b[46]) + IFX_MATQ31_Q58(a[4], b[58]) + IFX_MATQ31_Q58(a[5], b[70])
+        + IFX_MATQ31_Q58(a[6], b[82]) + IFX_MATQ31_Q58(a[7], b[94]) + IFX_MATQ31_Q58(a[8], b[106])
+        + IFX_MATQ31_Q58(a[9], b[118]) + IFX_MATQ31_Q58(a[10], b[130]) + IFX_MATQ31_Q58(a[11], b[142]);
+    c[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[0], b[11]) + IFX_MATQ31_Q58(a[1], b[23]) + IFX_MATQ31_Q58(a[2], b[35])
+        + IFX_MATQ31_Q58(a[3], b[47]) + IFX_MATQ31_Q58(a[4], b[59]) + IFX_MATQ31_Q58(a[5], b[71])
+        + IFX_MATQ31_Q58(a[6], b[83]) + IFX_MATQ31_Q58(a[7], b[95]) + IFX_MATQ31_Q58(a[8], b[107])
+        + IFX_MATQ31_Q58(a[9], b[119]) + IFX_MATQ31_Q58(a[10], b[131]) + IFX_MATQ31_Q58(a[11], b[143]);
+    c[11] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[0]) + IFX_MATQ31_Q58(a[13], b[12]) + IFX_MATQ31_Q58(a[14], b[24])
+        + IFX_MATQ31_Q58(a[15], b[36]) + IFX_MATQ31_Q58(a[16], b[48]) + IFX_MATQ31_Q58(a[17], b[60])
+        + IFX_MATQ31_Q58(a[18], b[72]) + IFX_MATQ31_Q58(a[19], b[84]) + IFX_MATQ31_Q58(a[20], b[96])
+        + IFX_MATQ31_Q58(a[21], b[108]) + IFX_MATQ31_Q58(a[22], b[120]) + IFX_MATQ31_Q58(a[23], b[132]);
+    c[12] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[1]) + IFX_MATQ31_Q58(a[13], b[13]) + IFX_MATQ31_Q58(a[14], b[25])
+        + IFX_MATQ31_Q58(a[15], b[37]) + IFX_MATQ31_Q58(a[16], b[49]) + IFX_MATQ31_Q58(a[17], b[61])
+        + IFX_MATQ31_Q58(a[18], b[73]) + IFX_MATQ31_Q58(a[19], b[85]) + IFX_MATQ31_Q58(a[20], b[97])
+        + IFX_MATQ31_Q58(a[21], b[109]) + IFX_MATQ31_Q58(a[22], b[121]) + IFX_MATQ31_Q58(a[23], b[133]);
+    c[13] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[2]) + IFX_MATQ31_Q58(a[13], b[14]) + IFX_MATQ31_Q58(a[14], b[26])
+        + IFX_MATQ31_Q58(a[15], b[38]) + IFX_MATQ31_Q58(a[16], b[50]) + IFX_MATQ31_Q58(a[17], b[62])
+        + IFX_MATQ31_Q58(a[18], b[74]) + IFX_MATQ31_Q58(a[19], b[86]) + IFX_MATQ31_Q58(a[20], b[98])
+        + IFX_MATQ31_Q58(a[21], b[110]) + IFX_MATQ31_Q58(a[22], b[122]) + IFX_MATQ31_Q58(a[23], b[134]);
+    c[14] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[3]) + IFX_MATQ31_Q58(a[13], b[15]) + IFX_MATQ31_Q58(a[14], b[27])
+        + IFX_MATQ31_Q58(a[15], b[39]) + IFX_MATQ31_Q58(a[16], b[51]) + IFX_MATQ31_Q58(a[17], b[63])
+        + IFX_MATQ31_Q58(a[18], b[75]) + IFX_MATQ31_Q58(a[19], b[87]) + IFX_MATQ31_Q58(a[20], b[99])
+        + IFX_MATQ31_Q58(a[21], b[111]) + IFX_MATQ31_Q58(a[22], b[123]) + IFX_MATQ31_Q58(a[23], b[135]);
+    c[15] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[4]) + IFX_MATQ31_Q58(a[13], b[16]) + IFX_MATQ31_Q58(a[14], b[28])
+        + IFX_MATQ31_Q58(a[15], b[40]) + IFX_MATQ31_Q58(a[16], b[52]) + IFX_MATQ31_Q58(a[17], b[64])
+        + IFX_MATQ31_Q58(a[18], b[76]) + IFX_MATQ31_Q58(a[19], b[88]) + IFX_MATQ31_Q58(a[20], b[100])
+        + IFX_MATQ31_Q58(a[21], b[112]) + IFX_MATQ31_Q58(a[22], b[124]) + IFX_MATQ31_Q58(a[23], b[136]);
+    c[16] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[5]) + IFX_MATQ31_Q58(a[13], b[17]) + IFX_MATQ31_Q58(a[14], b[29])
+        + IFX_MATQ31_Q58(a[15], b[41]) + IFX_MATQ31_Q58(a[16], b[53]) + IFX_MATQ31_Q58(a[17], b[65])
+        + IFX_MATQ31_Q58(a[18], b[77]) + IFX_MATQ31_Q58(a[19], b[89]) + IFX_MATQ31_Q58(a[20], b[101])
+        + IFX_MATQ31_Q58(a[21], b[113]) + IFX_MATQ31_Q58(a[22], b[125]) + IFX_MATQ31_Q58(a[23], b[137]);
+    c[17] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[6]) + IFX_MATQ31_Q58(a[13], b[18]) + IFX_MATQ31_Q58(a[14], b[30])
+        + IFX_MATQ31_Q58(a[15], b[42]) + IFX_MATQ31_Q58(a[16], b[54]) + IFX_MATQ31_Q58(a[17], b[66])
+        + IFX_MATQ31_Q58(a[18], b[78]) + IFX_MATQ31_Q58(a[19], b[90]) + IFX_MATQ31_Q58(a[20], b[102])
+        + IFX_MATQ31_Q58(a[21], b[114]) + IFX_MATQ31_Q58(a[22], b[126]) + IFX_MATQ31_Q58(a[23], b[138]);
+    c[18] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[7]) + IFX_MATQ31_Q58(a[13], b[19]) + IFX_MATQ31_Q58(a[14], b[31])
+        + IFX_MATQ31_Q58(a[15], b[43]) + IFX_MATQ31_Q58(a[16], b[55]) + IFX_MATQ31_Q58(a[17], b[67])
+        + IFX_MATQ31_Q58(a[18], b[79]) + IFX_MATQ31_Q58(a[19], b[91]) + IFX_MATQ31_Q58(a[20], b[103])
+        + IFX_MATQ31_Q58(a[21], b[115]) + IFX_MATQ31_Q58(a[22], b[127]) + IFX_MATQ31_Q58(a[23], b[139]);
+    c[19] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[8]) + IFX_MATQ31_Q58(a[13], b[20]) + IFX_MATQ31_Q58(a[14], b[32])
+        + IFX_MATQ31_Q58(a[15], b[44]) + IFX_MATQ31_Q58(a[16], b[56]) + IFX_MATQ31_Q58(a[17], b[68])
+        + IFX_MATQ31_Q58(a[18], b[80]) + IFX_MATQ31_Q58(a[19], b[92]) + IFX_MATQ31_Q58(a[20], b[104])
+        + IFX_MATQ31_Q58(a[21], b[116]) + IFX_MATQ31_Q58(a[22], b[128]) + IFX_MATQ31_Q58(a[23], b[140]);
+    c[20] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[9]) + IFX_MATQ31_Q58(a[13], b[21]) + IFX_MATQ31_Q58(a[14], b[33])
+        + IFX_MATQ31_Q58(a[15], b[45]) + IFX_MATQ31_Q58(a[16], b[57]) + IFX_MATQ31_Q58(a[17], b[69])
+        + IFX_MATQ31_Q58(a[18], b[81]) + IFX_MATQ31_Q58(a[19], b[93]) + IFX_MATQ31_Q58(a[20], b[105])
+        + IFX_MATQ31_Q58(a[21], b[117]) + IFX_MATQ31_Q58(a[22], b[129]) + IFX_MATQ31_Q58(a[23], b[141]);
+    c[21] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[10]) + IFX_MATQ31_Q58(a[13], b[22]) + IFX_MATQ31_Q58(a[14], b[34])
+        + IFX_MATQ31_Q58(a[15], b[46]) + IFX_MATQ31_Q58(a[16], b[58]) + IFX_MATQ31_Q58(a[17], b[70])
+        + IFX_MATQ31_Q58(a[18], b[82]) + IFX_MATQ31_Q58(a[19], b[94]) + IFX_MATQ31_Q58(a[20], b[106])
+        + IFX_MATQ31_Q58(a[21], b[118]) + IFX_MATQ31_Q58(a[22], b[130]) + IFX_MATQ31_Q58(a[23], b[142]);
+    c[22] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], b[11]) + IFX_MATQ31_Q58(a[13], b[23]) + IFX_MATQ31_Q58(a[14], b[35])
+        + IFX_MATQ31_Q58(a[15], b[47]) + IFX_MATQ31_Q58(a[16], b[59]) + IFX_MATQ31_Q58(a[17], b[71])
+        + IFX_MATQ31_Q58(a[18], b[83]) + IFX_MATQ31_Q58(a[19], b[95]) + IFX_MATQ31_Q58(a[20], b[107])
+        + IFX_MATQ31_Q58(a[21], b[119]) + IFX_MATQ31_Q58(a[22], b[131]) + IFX_MATQ31_Q58(a[23], b[143]);
+    c[23] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[0]) + IFX_MATQ31_Q58(a[25], b[12]) + IFX_MATQ31_Q58(a[26], b[24])
+        + IFX_MATQ31_Q58(a[27], b[36]) + IFX_MATQ31_Q58(a[28], b[48]) + IFX_MATQ31_Q58(a[29], b[60])
+        + IFX_MATQ31_Q58(a[30], b[72]) + IFX_MATQ31_Q58(a[31], b[84]) + IFX_MATQ31_Q58(a[32], b[96])
+        + IFX_MATQ31_Q58(a[33], b[108]) + IFX_MATQ31_Q58(a[34], b[120]) + IFX_MATQ31_Q58(a[35], b[132]);
+    c[24] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[1]) + IFX_MATQ31_Q58(a[25], b[13]) + IFX_MATQ31_Q58(a[26], b[25])
+        + IFX_MATQ31_Q58(a[27], b[37]) + IFX_MATQ31_Q58(a[28], b[49]) + IFX_MATQ31_Q58(a[29], b[61])
+        + IFX_MATQ31_Q58(a[30], b[73]) + IFX_MATQ31_Q58(a[31], b[85]) + IFX_MATQ31_Q58(a[32], b[97])
+        + IFX_MATQ31_Q58(a[33], b[109]) + IFX_MATQ31_Q58(a[34], b[121]) + IFX_MATQ31_Q58(a[35], b[133]);
+    c[25] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[2]) + IFX_MATQ31_Q58(a[25], b[14]) + IFX_MATQ31_Q58(a[26], b[26])
+        + IFX_MATQ31_Q58(a[27], b[38]) + IFX_MATQ31_Q58(a[28], b[50]) + IFX_MATQ31_Q58(a[29], b[62])
+        + IFX_MATQ31_Q58(a[30], b[74]) + IFX_MATQ31_Q58(a[31], b[86]) + IFX_MATQ31_Q58(a[32], b[98])
+        + IFX_MATQ31_Q58(a[33], b[110]) + IFX_MATQ31_Q58(a[34], b[122]) + IFX_MATQ31_Q58(a[35], b[134]);
+    c[26] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[3]) + IFX_MATQ31_Q58(a[25], b[15]) + IFX_MATQ31_Q58(a[26], b[27])
+        + IFX_MATQ31_Q58(a[27], b[39]) + IFX_MATQ31_Q58(a[28], b[51]) + IFX_MATQ31_Q58(a[29], b[63])
+        + IFX_MATQ31_Q58(a[30], b[75]) + IFX_MATQ31_Q58(a[31], b[87]) + IFX_MATQ31_Q58(a[32], b[99])
+        + IFX_MATQ31_Q58(a[33], b[111]) + IFX_MATQ31_Q58(a[34], b[123]) + IFX_MATQ31_Q58(a[35], b[135]);
+    c[27] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[4]) + IFX_MATQ31_Q58(a[25], b[16]) + IFX_MATQ31_Q58(a[26], b[28])
+        + IFX_MATQ31_Q58(a[27], b[40]) + IFX_MATQ31_Q58(a[28], b[52]) + IFX_MATQ31_Q58(a[29], b[64])
+        + IFX_MATQ31_Q58(a[30], b[76]) + IFX_MATQ31_Q58(a[31], b[88]) + IFX_MATQ31_Q58(a[32], b[100])
+        + IFX_MATQ31_Q58(a[33], b[112]) + IFX_MATQ31_Q58(a[34], b[124]) + IFX_MATQ31_Q58(a[35], b[136]);
+    c[28] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[5]) + IFX_MATQ31_Q58(a[25], b[17]) + IFX_MATQ31_Q58(a[26], b[29])
+        + IFX_MATQ31_Q58(a[27], b[41]) + IFX_MATQ31_Q58(a[28], b[53]) + IFX_MATQ31_Q58(a[29], b[65])
+        + IFX_MATQ31_Q58(a[30], b[77]) + IFX_MATQ31_Q58(a[31], b[89]) + IFX_MATQ31_Q58(a[32], b[101])
+        + IFX_MATQ31_Q58(a[33], b[113]) + IFX_MATQ31_Q58(a[34], b[125]) + IFX_MATQ31_Q58(a[35], b[137]);
+    c[29] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[6]) + IFX_MATQ31_Q58(a[25], b[18]) + IFX_MATQ31_Q58(a[26], b[30])
+        + IFX_MATQ31_Q58(a[27], b[42]) + IFX_MATQ31_Q58(a[28], b[54]) + IFX_MATQ31_Q58(a[29], b[66])
+        + IFX_MATQ31_Q58(a[30], b[78]) + IFX_MATQ31_Q58(a[31], b[90]) + IFX_MATQ31_Q58(a[32], b[102])
+        + IFX_MATQ31_Q58(a[33], b[114]) + IFX_MATQ31_Q58(a[34], b[126]) + IFX_MATQ31_Q58(a[35], b[138]);
+    c[30] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[7]) + IFX_MATQ31_Q58(a[25], b[19]) + IFX_MATQ31_Q58(a[26], b[31])
+        + IFX_MATQ31_Q58(a[27], b[43]) + IFX_MATQ31_Q58(a[28], b[55]) + IFX_MATQ31_Q58(a[29], b[67])
+        + IFX_MATQ31_Q58(a[30], b[79]) + IFX_MATQ31_Q58(a[31], b[91]) + IFX_MATQ31_Q58(a[32], b[103])
+        + IFX_MATQ31_Q58(a[33], b[115]) + IFX_MATQ31_Q58(a[34], b[127]) + IFX_MATQ31_Q58(a[35], b[139]);
+    c[31] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[8]) + IFX_MATQ31_Q58(a[25], b[20]) + IFX_MATQ31_Q58(a[26], b[32])
+        + IFX_MATQ31_Q58(a[27], b[44]) + IFX_MATQ31_Q58(a[28], b[56]) + IFX_MATQ31_Q58(a[29], b[68])
+        + IFX_MATQ31_Q58(a[30], b[80]) + IFX_MATQ31_Q58(a[31], b[92]) + IFX_MATQ31_Q58(a[32], b[104])
+        + IFX_MATQ31_Q58(a[33], b[116]) + IFX_MATQ31_Q58(a[34], b[128]) + IFX_MATQ31_Q58(a[35], b[140]);
+    c[32] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[9]) + IFX_MATQ31_Q58(a[25], b[21]) + IFX_MATQ31_Q58(a[26], b[33])
+        + IFX_MATQ31_Q58(a[27], b[45]) + IFX_MATQ31_Q58(a[28], b[57]) + IFX_MATQ31_Q58(a[29], b[69])
+        + IFX_MATQ31_Q58(a[30], b[81]) + IFX_MATQ31_Q58(a[31], b[93]) + IFX_MATQ31_Q58(a[32], b[105])
+        + IFX_MATQ31_Q58(a[33], b[117]) + IFX_MATQ31_Q58(a[34], b[129]) + IFX_MATQ31_Q58(a[35], b[141]);
+    c[33] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[10]) + IFX_MATQ31_Q58(a[25], b[22]) + IFX_MATQ31_Q58(a[26], b[34])
+        + IFX_MATQ31_Q58(a[27], b[46]) + IFX_MATQ31_Q58(a[28], b[58]) + IFX_MATQ31_Q58(a[29], b[70])
+        + IFX_MATQ31_Q58(a[30], b[82]) + IFX_MATQ31_Q58(a[31], b[94]) + IFX_MATQ31_Q58(a[32], b[106])
+        + IFX_MATQ31_Q58(a[33], b[118]) + IFX_MATQ31_Q58(a[34], b[130]) + IFX_MATQ31_Q58(a[35], b[142]);
+    c[34] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], b[11]) + IFX_MATQ31_Q58(a[25], b[23]) + IFX_MATQ31_Q58(a[26], b[35])
+        + IFX_MATQ31_Q58(a[27], b[47]) + IFX_MATQ31_Q58(a[28], b[59]) + IFX_MATQ31_Q58(a[29], b[71])
+        + IFX_MATQ31_Q58(a[30], b[83]) + IFX_MATQ31_Q58(a[31], b[95]) + IFX_MATQ31_Q58(a[32], b[107])
+        + IFX_MATQ31_Q58(a[33], b[119]) + IFX_MATQ31_Q58(a[34], b[131]) + IFX_MATQ31_Q58(a[35], b[143]);
+    c[35] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[0]) + IFX_MATQ31_Q58(a[37], b[12]) + IFX_MATQ31_Q58(a[38], b[24])
+        + IFX_MATQ31_Q58(a[39], b[36]) + IFX_MATQ31_Q58(a[40], b[48]) + IFX_MATQ31_Q58(a[41], b[60])
+        + IFX_MATQ31_Q58(a[42], b[72]) + IFX_MATQ31_Q58(a[43], b[84]) + IFX_MATQ31_Q58(a[44], b[96])
+        + IFX_MATQ31_Q58(a[45], b[108]) + IFX_MATQ31_Q58(a[46], b[120]) + IFX_MATQ31_Q58(a[47], b[132]);
+    c[36] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[1]) + IFX_MATQ31_Q58(a[37], b[13]) + IFX_MATQ31_Q58(a[38], b[25])
+        + IFX_MATQ31_Q58(a[39], b[37]) + IFX_MATQ31_Q58(a[40], b[49]) + IFX_MATQ31_Q58(a[41], b[61])
+        + IFX_MATQ31_Q58(a[42], b[73]) + IFX_MATQ31_Q58(a[43], b[85]) + IFX_MATQ31_Q58(a[44], b[97])
+        + IFX_MATQ31_Q58(a[45], b[109]) + IFX_MATQ31_Q58(a[46], b[121]) + IFX_MATQ31_Q58(a[47], b[133]);
+    c[37] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[2]) + IFX_MATQ31_Q58(a[37], b[14]) + IFX_MATQ31_Q58(a[38], b[26])
+        + IFX_MATQ31_Q58(a[39], b[38]) + IFX_MATQ31_Q58(a[40], b[50]) + IFX_MATQ31_Q58(a[41], b[62])
+        + IFX_MATQ31_Q58(a[42], b[74]) + IFX_MATQ31_Q58(a[43], b[86]) + IFX_MATQ31_Q58(a[44], b[98])
+        + IFX_MATQ31_Q58(a[45], b[110]) + IFX_MATQ31_Q58(a[46], b[122]) + IFX_MATQ31_Q58(a[47], b[134]);
+    c[38] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[3]) + IFX_MATQ31_Q58(a[37], b[15]) + IFX_MATQ31_Q58(a[38], b[27])
+        + IFX_MATQ31_Q58(a[39], b[39]) + IFX_MATQ31_Q58(a[40], b[51]) + IFX_MATQ31_Q58(a[41], b[63])
+        + IFX_MATQ31_Q58(a[42], b[75]) + IFX_MATQ31_Q58(a[43], b[87]) + IFX_MATQ31_Q58(a[44], b[99])
+        + IFX_MATQ31_Q58(a[45], b[111]) + IFX_MATQ31_Q58(a[46], b[123]) + IFX_MATQ31_Q58(a[47], b[135]);
+    c[39] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[4]) + IFX_MATQ31_Q58(a[37], b[16]) + IFX_MATQ31_Q58(a[38], b[28])
+        + IFX_MATQ31_Q58(a[39], b[40]) + IFX_MATQ31_Q58(a[40], b[52]) + IFX_MATQ31_Q58(a[41], b[64])
+        + IFX_MATQ31_Q58(a[42], b[76]) + IFX_MATQ31_Q58(a[43], b[88]) + IFX_MATQ31_Q58(a[44], b[100])
+        + IFX_MATQ31_Q58(a[45], b[112]) + IFX_MATQ31_Q58(a[46], b[124]) + IFX_MATQ31_Q58(a[47], b[136]);
+    c[40] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[5]) + IFX_MATQ31_Q58(a[37], b[17]) + IFX_MATQ31_Q58(a[38], b[29])
+        + IFX_MATQ31_Q58(a[39], b[41]) + IFX_MATQ31_Q58(a[40], b[53]) + IFX_MATQ31_Q58(a[41], b[65])
+        + IFX_MATQ31_Q58(a[42], b[77]) + IFX_MATQ31_Q58(a[43], b[89]) + IFX_MATQ31_Q58(a[44], b[101])
+        + IFX_MATQ31_Q58(a[45], b[113]) + IFX_MATQ31_Q58(a[46], b[125]) + IFX_MATQ31_Q58(a[47], b[137]);
+    c[41] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[6]) + IFX_MATQ31_Q58(a[37], b[18]) + IFX_MATQ31_Q58(a[38], b[30])
+        + IFX_MATQ31_Q58(a[39], b[42]) + IFX_MATQ31_Q58(a[40], b[54]) + IFX_MATQ31_Q58(a[41], b[66])
+        + IFX_MATQ31_Q58(a[42], b[78]) + IFX_MATQ31_Q58(a[43], b[90]) + IFX_MATQ31_Q58(a[44], b[102])
+        + IFX_MATQ31_Q58(a[45], b[114]) + IFX_MATQ31_Q58(a[46], b[126]) + IFX_MATQ31_Q58(a[47], b[138]);
+    c[42] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[7]) + IFX_MATQ31_Q58(a[37], b[19]) + IFX_MATQ31_Q58(a[38], b[31])
+        + IFX_MATQ31_Q58(a[39], b[43]) + IFX_MATQ31_Q58(a[40], b[55]) + IFX_MATQ31_Q58(a[41], b[67])
+        + IFX_MATQ31_Q58(a[42], b[79]) + IFX_MATQ31_Q58(a[43], b[91]) + IFX_MATQ31_Q58(a[44], b[103])
+        + IFX_MATQ31_Q58(a[45], b[115]) + IFX_MATQ31_Q58(a[46], b[127]) + IFX_MATQ31_Q58(a[47], b[139]);
+    c[43] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[8]) + IFX_MATQ31_Q58(a[37], b[20]) + IFX_MATQ31_Q58(a[38], b[32])
+        + IFX_MATQ31_Q58(a[39], b[44]) + IFX_MATQ31_Q58(a[40], b[56]) + IFX_MATQ31_Q58(a[41], b[68])
+        + IFX_MATQ31_Q58(a[42], b[80]) + IFX_MATQ31_Q58(a[43], b[92]) + IFX_MATQ31_Q58(a[44], b[104])
+        + IFX_MATQ31_Q58(a[45], b[116]) + IFX_MATQ31_Q58(a[46], b[128]) + IFX_MATQ31_Q58(a[47], b[140]);
+    c[44] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[9]) + IFX_MATQ31_Q58(a[37], b[21]) + IFX_MATQ31_Q58(a[38], b[33])
+        + IFX_MATQ31_Q58(a[39], b[45]) + IFX_MATQ31_Q58(a[40], b[57]) + IFX_MATQ31_Q58(a[41], b[69])
+        + IFX_MATQ31_Q58(a[42], b[81]) + IFX_MATQ31_Q58(a[43], b[93]) + IFX_MATQ31_Q58(a[44], b[105])
+        + IFX_MATQ31_Q58(a[45], b[117]) + IFX_MATQ31_Q58(a[46], b[129]) + IFX_MATQ31_Q58(a[47], b[141]);
+    c[45] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[10]) + IFX_MATQ31_Q58(a[37], b[22]) + IFX_MATQ31_Q58(a[38], b[34])
+        + IFX_MATQ31_Q58(a[39], b[46]) + IFX_MATQ31_Q58(a[40], b[58]) + IFX_MATQ31_Q58(a[41], b[70])
+        + IFX_MATQ31_Q58(a[42], b[82]) + IFX_MATQ31_Q58(a[43], b[94]) + IFX_MATQ31_Q58(a[44], b[106])
+        + IFX_MATQ31_Q58(a[45], b[118]) + IFX_MATQ31_Q58(a[46], b[130]) + IFX_MATQ31_Q58(a[47], b[142]);
+    c[46] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], b[11]) + IFX_MATQ31_Q58(a[37], b[23]) + IFX_MATQ31_Q58(a[38], b[35])
+        + IFX_MATQ31_Q58(a[39], b[47]) + IFX_MATQ31_Q58(a[40], b[59]) + IFX_MATQ31_Q58(a[41], b[71])
+        + IFX_MATQ31_Q58(a[42], b[83]) + IFX_MATQ31_Q58(a[43], b[95]) + IFX_MATQ31_Q58(a[44], b[107])
+        + IFX_MATQ31_Q58(a[45], b[119]) + IFX_MATQ31_Q58(a[46], b[131]) + IFX_MATQ31_Q58(a[47], b[143]);
+    c[47] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[0]) + IFX_MATQ31_Q58(a[49], b[12]) + IFX_MATQ31_Q58(a[50], b[24])
+        + IFX_MATQ31_Q58(a[51], b[36]) + IFX_MATQ31_Q58(a[52], b[48]) + IFX_MATQ31_Q58(a[53], b[60])
+        + IFX_MATQ31_Q58(a[54], b[72]) + IFX_MATQ31_Q58(a[55], b[84]) + IFX_MATQ31_Q58(a[56], b[96])
+        + IFX_MATQ31_Q58(a[57], b[108]) + IFX_MATQ31_Q58(a[58], b[120]) + IFX_MATQ31_Q58(a[59], b[132]);
+    c[48] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[1]) + IFX_MATQ31_Q58(a[49], b[13]) + IFX_MATQ31_Q58(a[50], b[25])
+        + IFX_MATQ31_Q58(a[51], b[37]) + IFX_MATQ31_Q58(a[52], b[49]) + IFX_MATQ31_Q58(a[53], b[61])
+        + IFX_MATQ31_Q58(a[54], b[73]) + IFX_MATQ31_Q58(a[55], b[85]) + IFX_MATQ31_Q58(a[56], b[97])
+        + IFX_MATQ31_Q58(a[57], b[109]) + IFX_MATQ31_Q58(a[58], b[121]) + IFX_MATQ31_Q58(a[59], b[133]);
+    c[49] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[2]) + IFX_MATQ31_Q58(a[49], b[14]) + IFX_MATQ31_Q58(a[50], b[26])
+        + IFX_MATQ31_Q58(a[51], b[38]) + IFX_MATQ31_Q58(a[52], b[50]) + IFX_MATQ31_Q58(a[53], b[62])
+        + IFX_MATQ31_Q58(a[54], b[74]) + IFX_MATQ31_Q58(a[55], b[86]) + IFX_MATQ31_Q58(a[56], b[98])
+        + IFX_MATQ31_Q58(a[57], b[110]) + IFX_MATQ31_Q58(a[58], b[122]) + IFX_MATQ31_Q58(a[59], b[134]);
+    c[50] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[3]) + IFX_MATQ31_Q58(a[49], b[15]) + IFX_MATQ31_Q58(a[50], b[27])
+        + IFX_MATQ31_Q58(a[51], b[39]) + IFX_MATQ31_Q58(a[52], b[51]) + IFX_MATQ31_Q58(a[53], b[63])
+        + IFX_MATQ31_Q58(a[54], b[75]) + IFX_MATQ31_Q58(a[55], b[87]) + IFX_MATQ31_Q58(a[56], b[99])
+        + IFX_MATQ31_Q58(a[57], b[111]) + IFX_MATQ31_Q58(a[58], b[123]) + IFX_MATQ31_Q58(a[59], b[135]);
+    c[51] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[4]) + IFX_MATQ31_Q58(a[49], b[16]) + IFX_MATQ31_Q58(a[50], b[28])
+        + IFX_MATQ31_Q58(a[51], b[40]) + IFX_MATQ31_Q58(a[52], b[52]) + IFX_MATQ31_Q58(a[53], b[64])
+        + IFX_MATQ31_Q58(a[54], b[76]) + IFX_MATQ31_Q58(a[55], b[88]) + IFX_MATQ31_Q58(a[56], b[100])
+        + IFX_MATQ31_Q58(a[57], b[112]) + IFX_MATQ31_Q58(a[58], b[124]) + IFX_MATQ31_Q58(a[59], b[136]);
+    c[52] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[5]) + IFX_MATQ31_Q58(a[49], b[17]) + IFX_MATQ31_Q58(a[50], b[29])
+        + IFX_MATQ31_Q58(a[51], b[41]) + IFX_MATQ31_Q58(a[52], b[53]) + IFX_MATQ31_Q58(a[53], b[65])
+        + IFX_MATQ31_Q58(a[54], b[77]) + IFX_MATQ31_Q58(a[55], b[89]) + IFX_MATQ31_Q58(a[56], b[101])
+        + IFX_MATQ31_Q58(a[57], b[113]) + IFX_MATQ31_Q58(a[58], b[125]) + IFX_MATQ31_Q58(a[59], b[137]);
+    c[53] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[6]) + IFX_MATQ31_Q58(a[49], b[18]) + IFX_MATQ31_Q58(a[50], b[30])
+        + IFX_MATQ31_Q58(a[51], b[42]) + IFX_MATQ31_Q58(a[52], b[54]) + IFX_MATQ31_Q58(a[53], b[66])
+        + IFX_MATQ31_Q58(a[54], b[78]) + IFX_MATQ31_Q58(a[55], b[90]) + IFX_MATQ31_Q58(a[56], b[102])
+        + IFX_MATQ31_Q58(a[57], b[114]) + IFX_MATQ31_Q58(a[58], b[126]) + IFX_MATQ31_Q58(a[59], b[138]);
+    c[54] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[7]) + IFX_MATQ31_Q58(a[49], b[19]) + IFX_MATQ31_Q58(a[50], b[31])
+        + IFX_MATQ31_Q58(a[51], b[43]) + IFX_MATQ31_Q58(a[52], b[55]) + IFX_MATQ31_Q58(a[53], b[67])
+        + IFX_MATQ31_Q58(a[54], b[79]) + IFX_MATQ31_Q58(a[55], b[91]) + IFX_MATQ31_Q58(a[56], b[103])
+        + IFX_MATQ31_Q58(a[57], b[115]) + IFX_MATQ31_Q58(a[58], b[127]) + IFX_MATQ31_Q58(a[59], b[139]);
+    c[55] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[8]) + IFX_MATQ31_Q58(a[49], b[20]) + IFX_MATQ31_Q58(a[50], b[32])
+        + IFX_MATQ31_Q58(a[51], b[44]) + IFX_MATQ31_Q58(a[52], b[56]) + IFX_MATQ31_Q58(a[53], b[68])
+        + IFX_MATQ31_Q58(a[54], b[80]) + IFX_MATQ31_Q58(a[55], b[92]) + IFX_MATQ31_Q58(a[56], b[104])
+        + IFX_MATQ31_Q58(a[57], b[116]) + IFX_MATQ31_Q58(a[58], b[128]) + IFX_MATQ31_Q58(a[59], b[140]);
+    c[56] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[9]) + IFX_MATQ31_Q58(a[49], b[21]) + IFX_MATQ31_Q58(a[50], b[33])
+        + IFX_MATQ31_Q58(a[51], b[45]) + IFX_MATQ31_Q58(a[52], b[57]) + IFX_MATQ31_Q58(a[53], b[69])
+        + IFX_MATQ31_Q58(a[54], b[81]) + IFX_MATQ31_Q58(a[55], b[93]) + IFX_MATQ31_Q58(a[56], b[105])
+        + IFX_MATQ31_Q58(a[57], b[117]) + IFX_MATQ31_Q58(a[58], b[129]) + IFX_MATQ31_Q58(a[59], b[141]);
+    c[57] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[10]) + IFX_MATQ31_Q58(a[49], b[22]) + IFX_MATQ31_Q58(a[50], b[34])
+        + IFX_MATQ31_Q58(a[51], b[46]) + IFX_MATQ31_Q58(a[52], b[58]) + IFX_MATQ31_Q58(a[53], b[70])
+        + IFX_MATQ31_Q58(a[54], b[82]) + IFX_MATQ31_Q58(a[55], b[94]) + IFX_MATQ31_Q58(a[56], b[106])
+        + IFX_MATQ31_Q58(a[57], b[118]) + IFX_MATQ31_Q58(a[58], b[130]) + IFX_MATQ31_Q58(a[59], b[142]);
+    c[58] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], b[11]) + IFX_MATQ31_Q58(a[49], b[23]) + IFX_MATQ31_Q58(a[50], b[35])
+        + IFX_MATQ31_Q58(a[51], b[47]) + IFX_MATQ31_Q58(a[52], b[59]) + IFX_MATQ31_Q58(a[53], b[71])
+        + IFX_MATQ31_Q58(a[54], b[83]) + IFX_MATQ31_Q58(a[55], b[95]) + IFX_MATQ31_Q58(a[56], b[107])
+        + IFX_MATQ31_Q58(a[57], b[119]) + IFX_MATQ31_Q58(a[58], b[131]) + IFX_MATQ31_Q58(a[59], b[143]);
+    c[59] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[0]) + IFX_MATQ31_Q58(a[61], b[12]) + IFX_MATQ31_Q58(a[62], b[24])
+        + IFX_MATQ31_Q58(a[63], b[36]) + IFX_MATQ31_Q58(a[64], b[48]) + IFX_MATQ31_Q58(a[65], b[60])
+        + IFX_MATQ31_Q58(a[66], b[72]) + IFX_MATQ31_Q58(a[67], b[84]) + IFX_MATQ31_Q58(a[68], b[96])
+        + IFX_MATQ31_Q58(a[69], b[108]) + IFX_MATQ31_Q58(a[70], b[120]) + IFX_MATQ31_Q58(a[71], b[132]);
+    c[60] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[1]) + IFX_MATQ31_Q58(a[61], b[13]) + IFX_MATQ31_Q58(a[62], b[25])
+        + IFX_MATQ31_Q58(a[63], b[37]) + IFX_MATQ31_Q58(a[64], b[49]) + IFX_MATQ31_Q58(a[65], b[61])
+        + IFX_MATQ31_Q58(a[66], b[73]) + IFX_MATQ31_Q58(a[67], b[85]) + IFX_MATQ31_Q58(a[68], b[97])
+        + IFX_MATQ31_Q58(a[69], b[109]) + IFX_MATQ31_Q58(a[70], b[121]) + IFX_MATQ31_Q58(a[71], b[133]);
+    c[61] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[2]) + IFX_MATQ31_Q58(a[61], b[14]) + IFX_MATQ31_Q58(a[62], b[26])
+        + IFX_MATQ31_Q58(a[63], b[38]) + IFX_MATQ31_Q58(a[64], b[50]) + IFX_MATQ31_Q58(a[65], b[62])
+        + IFX_MATQ31_Q58(a[66], b[74]) + IFX_MATQ31_Q58(a[67], b[86]) + IFX_MATQ31_Q58(a[68], b[98])
+        + IFX_MATQ31_Q58(a[69], b[110]) + IFX_MATQ31_Q58(a[70], b[122]) + IFX_MATQ31_Q58(a[71], b[134]);
+    c[62] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[3]) + IFX_MATQ31_Q58(a[61], b[15]) + IFX_MATQ31_Q58(a[62], b[27])
+        + IFX_MATQ31_Q58(a[63], b[39]) + IFX_MATQ31_Q58(a[64], b[51]) + IFX_MATQ31_Q58(a[65], b[63])
+        + IFX_MATQ31_Q58(a[66], b[75]) + IFX_MATQ31_Q58(a[67], b[87]) + IFX_MATQ31_Q58(a[68], b[99])
+        + IFX_MATQ31_Q58(a[69], b[111]) + IFX_MATQ31_Q58(a[70], b[123]) + IFX_MATQ31_Q58(a[71], b[135]);
+    c[63] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[4]) + IFX_MATQ31_Q58(a[61], b[16]) + IFX_MATQ31_Q58(a[62], b[28])
+        + IFX_MATQ31_Q58(a[63], b[40]) + IFX_MATQ31_Q58(a[64], b[52]) + IFX_MATQ31_Q58(a[65], b[64])
+        + IFX_MATQ31_Q58(a[66], b[76]) + IFX_MATQ31_Q58(a[67], b[88]) + IFX_MATQ31_Q58(a[68], b[100])
+        + IFX_MATQ31_Q58(a[69], b[112]) + IFX_MATQ31_Q58(a[70], b[124]) + IFX_MATQ31_Q58(a[71], b[136]);
+    c[64] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[5]) + IFX_MATQ31_Q58(a[61], b[17]) + IFX_MATQ31_Q58(a[62], b[29])
+        + IFX_MATQ31_Q58(a[63], b[41]) + IFX_MATQ31_Q58(a[64], b[53]) + IFX_MATQ31_Q58(a[65], b[65])
+        + IFX_MATQ31_Q58(a[66], b[77]) + IFX_MATQ31_Q58(a[67], b[89]) + IFX_MATQ31_Q58(a[68], b[101])
+        + IFX_MATQ31_Q58(a[69], b[113]) + IFX_MATQ31_Q58(a[70], b[125]) + IFX_MATQ31_Q58(a[71], b[137]);
+    c[65] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[6]) + IFX_MATQ31_Q58(a[61], b[18]) + IFX_MATQ31_Q58(a[62], b[30])
+        + IFX_MATQ31_Q58(a[63], b[42]) + IFX_MATQ31_Q58(a[64], b[54]) + IFX_MATQ31_Q58(a[65], b[66])
+        + IFX_MATQ31_Q58(a[66], b[78]) + IFX_MATQ31_Q58(a[67], b[90]) + IFX_MATQ31_Q58(a[68], b[102])
+        + IFX_MATQ31_Q58(a[69], b[114]) + IFX_MATQ31_Q58(a[70], b[126]) + IFX_MATQ31_Q58(a[71], b[138]);
+    c[66] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[7]) + IFX_MATQ31_Q58(a[61], b[19]) + IFX_MATQ31_Q58(a[62], b[31])
+        + IFX_MATQ31_Q58(a[63], b[43]) + IFX_MATQ31_Q58(a[64], b[55]) + IFX_MATQ31_Q58(a[65], b[67])
+        + IFX_MATQ31_Q58(a[66], b[79]) + IFX_MATQ31_Q58(a[67], b[91]) + IFX_MATQ31_Q58(a[68], b[103])
+        + IFX_MATQ31_Q58(a[69], b[115]) + IFX_MATQ31_Q58(a[70], b[127]) + IFX_MATQ31_Q58(a[71], b[139]);
+    c[67] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[8]) + IFX_MATQ31_Q58(a[61], b[20]) + IFX_MATQ31_Q58(a[62], b[32])
+        + IFX_MATQ31_Q58(a[63], b[44]) + IFX_MATQ31_Q58(a[64], b[56]) + IFX_MATQ31_Q58(a[65], b[68])
+        + IFX_MATQ31_Q58(a[66], b[80]) + IFX_MATQ31_Q58(a[67], b[92]) + IFX_MATQ31_Q58(a[68], b[104])
+        + IFX_MATQ31_Q58(a[69], b[116]) + IFX_MATQ31_Q58(a[70], b[128]) + IFX_MATQ31_Q58(a[71], b[140]);
+    c[68] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[9]) + IFX_MATQ31_Q58(a[61], b[21]) + IFX_MATQ31_Q58(a[62], b[33])
+        + IFX_MATQ31_Q58(a[63], b[45]) + IFX_MATQ31_Q58(a[64], b[57]) + IFX_MATQ31_Q58(a[65], b[69])
+        + IFX_MATQ31_Q58(a[66], b[81]) + IFX_MATQ31_Q58(a[67], b[93]) + IFX_MATQ31_Q58(a[68], b[105])
+        + IFX_MATQ31_Q58(a[69], b[117]) + IFX_MATQ31_Q58(a[70], b[129]) + IFX_MATQ31_Q58(a[71], b[141]);
+    c[69] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[10]) + IFX_MATQ31_Q58(a[61], b[22]) + IFX_MATQ31_Q58(a[62], b[34])
+        + IFX_MATQ31_Q58(a[63], b[46]) + IFX_MATQ31_Q58(a[64], b[58]) + IFX_MATQ31_Q58(a[65], b[70])
+        + IFX_MATQ31_Q58(a[66], b[82]) + IFX_MATQ31_Q58(a[67], b[94]) + IFX_MATQ31_Q58(a[68], b[106])
+        + IFX_MATQ31_Q58(a[69], b[118]) + IFX_MATQ31_Q58(a[70], b[130]) + IFX_MATQ31_Q58(a[71], b[142]);
+    c[70] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], b[11]) + IFX_MATQ31_Q58(a[61], b[23]) + IFX_MATQ31_Q58(a[62], b[35])
+        + IFX_MATQ31_Q58(a[63], b[47]) + IFX_MATQ31_Q58(a[64], b[59]) + IFX_MATQ31_Q58(a[65], b[71])
+        + IFX_MATQ31_Q58(a[66], b[83]) + IFX_MATQ31_Q58(a[67], b[95]) + IFX_MATQ31_Q58(a[68], b[107])
+        + IFX_MATQ31_Q58(a[69], b[119]) + IFX_MATQ31_Q58(a[70], b[131]) + IFX_MATQ31_Q58(a[71], b[143]);
+    c[71] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[0]) + IFX_MATQ31_Q58(a[73], b[12]) + IFX_MATQ31_Q58(a[74], b[24])
+        + IFX_MATQ31_Q58(a[75], b[36]) + IFX_MATQ31_Q58(a[76], b[48]) + IFX_MATQ31_Q58(a[77], b[60])
+        + IFX_MATQ31_Q58(a[78], b[72]) + IFX_MATQ31_Q58(a[79], b[84]) + IFX_MATQ31_Q58(a[80], b[96])
+        + IFX_MATQ31_Q58(a[81], b[108]) + IFX_MATQ31_Q58(a[82], b[120]) + IFX_MATQ31_Q58(a[83], b[132]);
+    c[72] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[1]) + IFX_MATQ31_Q58(a[73], b[13]) + IFX_MATQ31_Q58(a[74], b[25])
+        + IFX_MATQ31_Q58(a[75], b[37]) + IFX_MATQ31_Q58(a[76], b[49]) + IFX_MATQ31_Q58(a[77], b[61])
+        + IFX_MATQ31_Q58(a[78], b[73]) + IFX_MATQ31_Q58(a[79], b[85]) + IFX_MATQ31_Q58(a[80], b[97])
+        + IFX_MATQ31_Q58(a[81], b[109]) + IFX_MATQ31_Q58(a[82], b[121]) + IFX_MATQ31_Q58(a[83], b[133]);
+    c[73] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[2]) + IFX_MATQ31_Q58(a[73], b[14]) + IFX_MATQ31_Q58(a[74], b[26])
+        + IFX_MATQ31_Q58(a[75], b[38]) + IFX_MATQ31_Q58(a[76], b[50]) + IFX_MATQ31_Q58(a[77], b[62])
+        + IFX_MATQ31_Q58(a[78], b[74]) + IFX_MATQ31_Q58(a[79], b[86]) + IFX_MATQ31_Q58(a[80], b[98])
+        + IFX_MATQ31_Q58(a[81], b[110]) + IFX_MATQ31_Q58(a[82], b[122]) + IFX_MATQ31_Q58(a[83], b[134]);
+    c[74] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[3]) + IFX_MATQ31_Q58(a[73], b[15]) + IFX_MATQ31_Q58(a[74], b[27])
+        + IFX_MATQ31_Q58(a[75], b[39]) + IFX_MATQ31_Q58(a[76], b[51]) + IFX_MATQ31_Q58(a[77], b[63])
+        + IFX_MATQ31_Q58(a[78], b[75]) + IFX_MATQ31_Q58(a[79], b[87]) + IFX_MATQ31_Q58(a[80], b[99])
+        + IFX_MATQ31_Q58(a[81], b[111]) + IFX_MATQ31_Q58(a[82], b[123]) + IFX_MATQ31_Q58(a[83], b[135]);
+    c[75] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[4]) + IFX_MATQ31_Q58(a[73], b[16]) + IFX_MATQ31_Q58(a[74], b[28])
+        + IFX_MATQ31_Q58(a[75], b[40]) + IFX_MATQ31_Q58(a[76], b[52]) + IFX_MATQ31_Q58(a[77], b[64])
+        + IFX_MATQ31_Q58(a[78], b[76]) + IFX_MATQ31_Q58(a[79], b[88]) + IFX_MATQ31_Q58(a[80], b[100])
+        + IFX_MATQ31_Q58(a[81], b[112]) + IFX_MATQ31_Q58(a[82], b[124]) + IFX_MATQ31_Q58(a[83], b[136]);
+    c[76] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[5]) + IFX_MATQ31_Q58(a[73], b[17]) + IFX_MATQ31_Q58(a[74], b[29])
+        + IFX_MATQ31_Q58(a[75], b[41]) + IFX_MATQ31_Q58(a[76], b[53]) + IFX_MATQ31_Q58(a[77], b[65])
+        + IFX_MATQ31_Q58(a[78], b[77]) + IFX_MATQ31_Q58(a[79], b[89]) + IFX_MATQ31_Q58(a[80], b[101])
+        + IFX_MATQ31_Q58(a[81], b[113]) + IFX_MATQ31_Q58(a[82], b[125]) + IFX_MATQ31_Q58(a[83], b[137]);
+    c[77] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[6]) + IFX_MATQ31_Q58(a[73], b[18]) + IFX_MATQ31_Q58(a[74], b[30])
+        + IFX_MATQ31_Q58(a[75], b[42]) + IFX_MATQ31_Q58(a[76], b[54]) + IFX_MATQ31_Q58(a[77], b[66])
+        + IFX_MATQ31_Q58(a[78], b[78]) + IFX_MATQ31_Q58(a[79], b[90]) + IFX_MATQ31_Q58(a[80], b[102])
+        + IFX_MATQ31_Q58(a[81], b[114]) + IFX_MATQ31_Q58(a[82], b[126]) + IFX_MATQ31_Q58(a[83], b[138]);
+    c[78] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[7]) + IFX_MATQ31_Q58(a[73], b[19]) + IFX_MATQ31_Q58(a[74], b[31])
+        + IFX_MATQ31_Q58(a[75], b[43]) + IFX_MATQ31_Q58(a[76], b[55]) + IFX_MATQ31_Q58(a[77], b[67])
+        + IFX_MATQ31_Q58(a[78], b[79]) + IFX_MATQ31_Q58(a[79], b[91]) + IFX_MATQ31_Q58(a[80], b[103])
+        + IFX_MATQ31_Q58(a[81], b[115]) + IFX_MATQ31_Q58(a[82], b[127]) + IFX_MATQ31_Q58(a[83], b[139]);
+    c[79] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[8]) + IFX_MATQ31_Q58(a[73], b[20]) + IFX_MATQ31_Q58(a[74], b[32])
+        + IFX_MATQ31_Q58(a[75], b[44]) + IFX_MATQ31_Q58(a[76], b[56]) + IFX_MATQ31_Q58(a[77], b[68])
+        + IFX_MATQ31_Q58(a[78], b[80]) + IFX_MATQ31_Q58(a[79], b[92]) + IFX_MATQ31_Q58(a[80], b[104])
+        + IFX_MATQ31_Q58(a[81], b[116]) + IFX_MATQ31_Q58(a[82], b[128]) + IFX_MATQ31_Q58(a[83], b[140]);
+    c[80] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[9]) + IFX_MATQ31_Q58(a[73], b[21]) + IFX_MATQ31_Q58(a[74], b[33])
+        + IFX_MATQ31_Q58(a[75], b[45]) + IFX_MATQ31_Q58(a[76], b[57]) + IFX_MATQ31_Q58(a[77], b[69])
+        + IFX_MATQ31_Q58(a[78], b[81]) + IFX_MATQ31_Q58(a[79], b[93]) + IFX_MATQ31_Q58(a[80], b[105])
+        + IFX_MATQ31_Q58(a[81], b[117]) + IFX_MATQ31_Q58(a[82], b[129]) + IFX_MATQ31_Q58(a[83], b[141]);
+    c[81] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[10]) + IFX_MATQ31_Q58(a[73], b[22]) + IFX_MATQ31_Q58(a[74], b[34])
+        + IFX_MATQ31_Q58(a[75], b[46]) + IFX_MATQ31_Q58(a[76], b[58]) + IFX_MATQ31_Q58(a[77], b[70])
+        + IFX_MATQ31_Q58(a[78], b[82]) + IFX_MATQ31_Q58(a[79], b[94]) + IFX_MATQ31_Q58(a[80], b[106])
+        + IFX_MATQ31_Q58(a[81], b[118]) + IFX_MATQ31_Q58(a[82], b[130]) + IFX_MATQ31_Q58(a[83], b[142]);
+    c[82] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], b[11]) + IFX_MATQ31_Q58(a[73], b[23]) + IFX_MATQ31_Q58(a[74], b[35])
+        + IFX_MATQ31_Q58(a[75], b[47]) + IFX_MATQ31_Q58(a[76], b[59]) + IFX_MATQ31_Q58(a[77], b[71])
+        + IFX_MATQ31_Q58(a[78], b[83]) + IFX_MATQ31_Q58(a[79], b[95]) + IFX_MATQ31_Q58(a[80], b[107])
+        + IFX_MATQ31_Q58(a[81], b[119]) + IFX_MATQ31_Q58(a[82], b[131]) + IFX_MATQ31_Q58(a[83], b[143]);
+    c[83] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[0]) + IFX_MATQ31_Q58(a[85], b[12]) + IFX_MATQ31_Q58(a[86], b[24])
+        + IFX_MATQ31_Q58(a[87], b[36]) + IFX_MATQ31_Q58(a[88], b[48]) + IFX_MATQ31_Q58(a[89], b[60])
+        + IFX_MATQ31_Q58(a[90], b[72]) + IFX_MATQ31_Q58(a[91], b[84]) + IFX_MATQ31_Q58(a[92], b[96])
+        + IFX_MATQ31_Q58(a[93], b[108]) + IFX_MATQ31_Q58(a[94], b[120]) + IFX_MATQ31_Q58(a[95], b[132]);
+    c[84] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[1]) + IFX_MATQ31_Q58(a[85], b[13]) + IFX_MATQ31_Q58(a[86], b[25])
+        + IFX_MATQ31_Q58(a[87], b[37]) + IFX_MATQ31_Q58(a[88], b[49]) + IFX_MATQ31_Q58(a[89], b[61])
+        + IFX_MATQ31_Q58(a[90], b[73]) + IFX_MATQ31_Q58(a[91], b[85]) + IFX_MATQ31_Q58(a[92], b[97])
+        + IFX_MATQ31_Q58(a[93], b[109]) + IFX_MATQ31_Q58(a[94], b[121]) + IFX_MATQ31_Q58(a[95], b[133]);
+    c[85] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[2]) + IFX_MATQ31_Q58(a[85], b[14]) + IFX_MATQ31_Q58(a[86], b[26])
+        + IFX_MATQ31_Q58(a[87], b[38]) + IFX_MATQ31_Q58(a[88], b[50]) + IFX_MATQ31_Q58(a[89], b[62])
+        + IFX_MATQ31_Q58(a[90], b[74]) + IFX_MATQ31_Q58(a[91], b[86]) + IFX_MATQ31_Q58(a[92], b[98])
+        + IFX_MATQ31_Q58(a[93], b[110]) + IFX_MATQ31_Q58(a[94], b[122]) + IFX_MATQ31_Q58(a[95], b[134]);
+    c[86] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[3]) + IFX_MATQ31_Q58(a[85], b[15]) + IFX_MATQ31_Q58(a[86], b[27])
+        + IFX_MATQ31_Q58(a[87], b[39]) + IFX_MATQ31_Q58(a[88], b[51]) + IFX_MATQ31_Q58(a[89], b[63])
+        + IFX_MATQ31_Q58(a[90], b[75]) + IFX_MATQ31_Q58(a[91], b[87]) + IFX_MATQ31_Q58(a[92], b[99])
+        + IFX_MATQ31_Q58(a[93], b[111]) + IFX_MATQ31_Q58(a[94], b[123]) + IFX_MATQ31_Q58(a[95], b[135]);
+    c[87] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[4]) + IFX_MATQ31_Q58(a[85], b[16]) + IFX_MATQ31_Q58(a[86], b[28])
+        + IFX_MATQ31_Q58(a[87], b[40]) + IFX_MATQ31_Q58(a[88], b[52]) + IFX_MATQ31_Q58(a[89], b[64])
+        + IFX_MATQ31_Q58(a[90], b[76]) + IFX_MATQ31_Q58(a[91], b[88]) + IFX_MATQ31_Q58(a[92], b[100])
+        + IFX_MATQ31_Q58(a[93], b[112]) + IFX_MATQ31_Q58(a[94], b[124]) + IFX_MATQ31_Q58(a[95], b[136]);
+    c[88] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[5]) + IFX_MATQ31_Q58(a[85], b[17]) + IFX_MATQ31_Q58(a[86], b[29])
+        + IFX_MATQ31_Q58(a[87], b[41]) + IFX_MATQ31_Q58(a[88], b[53]) + IFX_MATQ31_Q58(a[89], b[65])
+        + IFX_MATQ31_Q58(a[90], b[77]) + IFX_MATQ31_Q58(a[91], b[89]) + IFX_MATQ31_Q58(a[92], b[101])
+        + IFX_MATQ31_Q58(a[93], b[113]) + IFX_MATQ31_Q58(a[94], b[125]) + IFX_MATQ31_Q58(a[95], b[137]);
+    c[89] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[6]) + IFX_MATQ31_Q58(a[85], b[18]) + IFX_MATQ31_Q58(a[86], b[30])
+        + IFX_MATQ31_Q58(a[87], b[42]) + IFX_MATQ31_Q58(a[88], b[54]) + IFX_MATQ31_Q58(a[89], b[66])
+        + IFX_MATQ31_Q58(a[90], b[78]) + IFX_MATQ31_Q58(a[91], b[90]) + IFX_MATQ31_Q58(a[92], b[102])
+        + IFX_MATQ31_Q58(a[93], b[114]) + IFX_MATQ31_Q58(a[94], b[126]) + IFX_MATQ31_Q58(a[95], b[138]);
+    c[90] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[7]) + IFX_MATQ31_Q58(a[85], b[19]) + IFX_MATQ31_Q58(a[86], b[31])
+        + IFX_MATQ31_Q58(a[87], b[43]) + IFX_MATQ31_Q58(a[88], b[55]) + IFX_MATQ31_Q58(a[89], b[67])
+        + IFX_MATQ31_Q58(a[90], b[79]) + IFX_MATQ31_Q58(a[91], b[91]) + IFX_MATQ31_Q58(a[92], b[103])
+        + IFX_MATQ31_Q58(a[93], b[115]) + IFX_MATQ31_Q58(a[94], b[127]) + IFX_MATQ31_Q58(a[95], b[139]);
+    c[91] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[8]) + IFX_MATQ31_Q58(a[85], b[20]) + IFX_MATQ31_Q58(a[86], b[32])
+        + IFX_MATQ31_Q58(a[87], b[44]) + IFX_MATQ31_Q58(a[88], b[56]) + IFX_MATQ31_Q58(a[89], b[68])
+        + IFX_MATQ31_Q58(a[90], b[80]) + IFX_MATQ31_Q58(a[91], b[92]) + IFX_MATQ31_Q58(a[92], b[104])
+        + IFX_MATQ31_Q58(a[93], b[116]) + IFX_MATQ31_Q58(a[94], b[128]) + IFX_MATQ31_Q58(a[95], b[140]);
+    c[92] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[9]) + IFX_MATQ31_Q58(a[85], b[21]) + IFX_MATQ31_Q58(a[86], b[33])
+        + IFX_MATQ31_Q58(a[87], b[45]) + IFX_MATQ31_Q58(a[88], b[57]) + IFX_MATQ31_Q58(a[89], b[69])
+        + IFX_MATQ31_Q58(a[90], b[81]) + IFX_MATQ31_Q58(a[91], b[93]) + IFX_MATQ31_Q58(a[92], b[105])
+        + IFX_MATQ31_Q58(a[93], b[117]) + IFX_MATQ31_Q58(a[94], b[129]) + IFX_MATQ31_Q58(a[95], b[141]);
+    c[93] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[10]) + IFX_MATQ31_Q58(a[85], b[22]) + IFX_MATQ31_Q58(a[86], b[34])
+        + IFX_MATQ31_Q58(a[87], b[46]) + IFX_MATQ31_Q58(a[88], b[58]) + IFX_MATQ31_Q58(a[89], b[70])
+        + IFX_MATQ31_Q58(a[90], b[82]) + IFX_MATQ31_Q58(a[91], b[94]) + IFX_MATQ31_Q58(a[92], b[106])
+        + IFX_MATQ31_Q58(a[93], b[118]) + IFX_MATQ31_Q58(a[94], b[130]) + IFX_MATQ31_Q58(a[95], b[142]);
+    c[94] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], b[11]) + IFX_MATQ31_Q58(a[85], b[23]) + IFX_MATQ31_Q58(a[86], b[35])
+        + IFX_MATQ31_Q58(a[87], b[47]) + IFX_MATQ31_Q58(a[88], b[59]) + IFX_MATQ31_Q58(a[89], b[71])
+        + IFX_MATQ31_Q58(a[90], b[83]) + IFX_MATQ31_Q58(a[91], b[95]) + IFX_MATQ31_Q58(a[92], b[107])
+        + IFX_MATQ31_Q58(a[93], b[119]) + IFX_MATQ31_Q58(a[94], b[131]) + IFX_MATQ31_Q58(a[95], b[143]);
+    c[95] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[0]) + IFX_MATQ31_Q58(a[97], b[12]) + IFX_MATQ31_Q58(a[98], b[24])
+        + IFX_MATQ31_Q58(a[99], b[36]) + IFX_MATQ31_Q58(a[100], b[48]) + IFX_MATQ31_Q58(a[101], b[60])
+        + IFX_MATQ31_Q58(a[102], b[72]) + IFX_MATQ31_Q58(a[103], b[84]) + IFX_MATQ31_Q58(a[104], b[96])
+        + IFX_MATQ31_Q58(a[105], b[108]) + IFX_MATQ31_Q58(a[106], b[120]) + IFX_MATQ31_Q58(a[107], b[132]);
+    c[96] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[1]) + IFX_MATQ31_Q58(a[97], b[13]) + IFX_MATQ31_Q58(a[98], b[25])
+        + IFX_MATQ31_Q58(a[99], b[37]) + IFX_MATQ31_Q58(a[100], b[49]) + IFX_MATQ31_Q58(a[101], b[61])
+        + IFX_MATQ31_Q58(a[102], b[73]) + IFX_MATQ31_Q58(a[103], b[85]) + IFX_MATQ31_Q58(a[104], b[97])
+        + IFX_MATQ31_Q58(a[105], b[109]) + IFX_MATQ31_Q58(a[106], b[121]) + IFX_MATQ31_Q58(a[107], b[133]);
+    c[97] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[2]) + IFX_MATQ31_Q58(a[97], b[14]) + IFX_MATQ31_Q58(a[98], b[26])
+        + IFX_MATQ31_Q58(a[99], b[38]) + IFX_MATQ31_Q58(a[100], b[50]) + IFX_MATQ31_Q58(a[101], b[62])
+        + IFX_MATQ31_Q58(a[102], b[74]) + IFX_MATQ31_Q58(a[103], b[86]) + IFX_MATQ31_Q58(a[104], b[98])
+        + IFX_MATQ31_Q58(a[105], b[110]) + IFX_MATQ31_Q58(a[106], b[122]) + IFX_MATQ31_Q58(a[107], b[134]);
+    c[98] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[3]) + IFX_MATQ31_Q58(a[97], b[15]) + IFX_MATQ31_Q58(a[98], b[27])
+        + IFX_MATQ31_Q58(a[99], b[39]) + IFX_MATQ31_Q58(a[100], b[51]) + IFX_MATQ31_Q58(a[101], b[63])
+        + IFX_MATQ31_Q58(a[102], b[75]) + IFX_MATQ31_Q58(a[103], b[87]) + IFX_MATQ31_Q58(a[104], b[99])
+        + IFX_MATQ31_Q58(a[105], b[111]) + IFX_MATQ31_Q58(a[106], b[123]) + IFX_MATQ31_Q58(a[107], b[135]);
+    c[99] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[4]) + IFX_MATQ31_Q58(a[97], b[16]) + IFX_MATQ31_Q58(a[98], b[28])
+        + IFX_MATQ31_Q58(a[99], b[40]) + IFX_MATQ31_Q58(a[100], b[52]) + IFX_MATQ31_Q58(a[101], b[64])
+        + IFX_MATQ31_Q58(a[102], b[76]) + IFX_MATQ31_Q58(a[103], b[88]) + IFX_MATQ31_Q58(a[104], b[100])
+        + IFX_MATQ31_Q58(a[105], b[112]) + IFX_MATQ31_Q58(a[106], b[124]) + IFX_MATQ31_Q58(a[107], b[136]);
+    c[100] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[5]) + IFX_MATQ31_Q58(a[97], b[17]) + IFX_MATQ31_Q58(a[98], b[29])
+        + IFX_MATQ31_Q58(a[99], b[41]) + IFX_MATQ31_Q58(a[100], b[53]) + IFX_MATQ31_Q58(a[101], b[65])
+        + IFX_MATQ31_Q58(a[102], b[77]) + IFX_MATQ31_Q58(a[103], b[89]) + IFX_MATQ31_Q58(a[104], b[101])
+        + IFX_MATQ31_Q58(a[105], b[113]) + IFX_MATQ31_Q58(a[106], b[125]) + IFX_MATQ31_Q58(a[107], b[137]);
+    c[101] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[6]) + IFX_MATQ31_Q58(a[97], b[18]) + IFX_MATQ31_Q58(a[98], b[30])
+        + IFX_MATQ31_Q58(a[99], b[42]) + IFX_MATQ31_Q58(a[100], b[54]) + IFX_MATQ31_Q58(a[101], b[66])
+        + IFX_MATQ31_Q58(a[102], b[78]) + IFX_MATQ31_Q58(a[103], b[90]) + IFX_MATQ31_Q58(a[104], b[102])
+        + IFX_MATQ31_Q58(a[105], b[114]) + IFX_MATQ31_Q58(a[106], b[126]) + IFX_MATQ31_Q58(a[107], b[138]);
+    c[102] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[7]) + IFX_MATQ31_Q58(a[97], b[19]) + IFX_MATQ31_Q58(a[98], b[31])
+        + IFX_MATQ31_Q58(a[99], b[43]) + IFX_MATQ31_Q58(a[100], b[55]) + IFX_MATQ31_Q58(a[101], b[67])
+        + IFX_MATQ31_Q58(a[102], b[79]) + IFX_MATQ31_Q58(a[103], b[91]) + IFX_MATQ31_Q58(a[104], b[103])
+        + IFX_MATQ31_Q58(a[105], b[115]) + IFX_MATQ31_Q58(a[106], b[127]) + IFX_MATQ31_Q58(a[107], b[139]);
+    c[103] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[8]) + IFX_MATQ31_Q58(a[97], b[20]) + IFX_MATQ31_Q58(a[98], b[32])
+        + IFX_MATQ31_Q58(a[99], b[44]) + IFX_MATQ31_Q58(a[100], b[56]) + IFX_MATQ31_Q58(a[101], b[68])
+        + IFX_MATQ31_Q58(a[102], b[80]) + IFX_MATQ31_Q58(a[103], b[92]) + IFX_MATQ31_Q58(a[104], b[104])
+        + IFX_MATQ31_Q58(a[105], b[116]) + IFX_MATQ31_Q58(a[106], b[128]) + IFX_MATQ31_Q58(a[107], b[140]);
+    c[104] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[9]) + IFX_MATQ31_Q58(a[97], b[21]) + IFX_MATQ31_Q58(a[98], b[33])
+        + IFX_MATQ31_Q58(a[99], b[45]) + IFX_MATQ31_Q58(a[100], b[57]) + IFX_MATQ31_Q58(a[101], b[69])
+        + IFX_MATQ31_Q58(a[102], b[81]) + IFX_MATQ31_Q58(a[103], b[93]) + IFX_MATQ31_Q58(a[104], b[105])
+        + IFX_MATQ31_Q58(a[105], b[117]) + IFX_MATQ31_Q58(a[106], b[129]) + IFX_MATQ31_Q58(a[107], b[141]);
+    c[105] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[10]) + IFX_MATQ31_Q58(a[97], b[22]) + IFX_MATQ31_Q58(a[98], b[34])
+        + IFX_MATQ31_Q58(a[99], b[46]) + IFX_MATQ31_Q58(a[100], b[58]) + IFX_MATQ31_Q58(a[101], b[70])
+        + IFX_MATQ31_Q58(a[102], b[82]) + IFX_MATQ31_Q58(a[103], b[94]) + IFX_MATQ31_Q58(a[104], b[106])
+        + IFX_MATQ31_Q58(a[105], b[118]) + IFX_MATQ31_Q58(a[106], b[130]) + IFX_MATQ31_Q58(a[107], b[142]);
+    c[106] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], b[11]) + IFX_MATQ31_Q58(a[97], b[23]) + IFX_MATQ31_Q58(a[98], b[35])
+        + IFX_MATQ31_Q58(a[99], b[47]) + IFX_MATQ31_Q58(a[100], b[59]) + IFX_MATQ31_Q58(a[101], b[71])
+        + IFX_MATQ31_Q58(a[102], b[83]) + IFX_MATQ31_Q58(a[103], b[95]) + IFX_MATQ31_Q58(a[104], b[107])
+        + IFX_MATQ31_Q58(a[105], b[119]) + IFX_MATQ31_Q58(a[106], b[131]) + IFX_MATQ31_Q58(a[107], b[143]);
+    c[107] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[0]) + IFX_MATQ31_Q58(a[109], b[12]) + IFX_MATQ31_Q58(a[110], b[24])
+        + IFX_MATQ31_Q58(a[111], b[36]) + IFX_MATQ31_Q58(a[112], b[48]) + IFX_MATQ31_Q58(a[113], b[60])
+        + IFX_MATQ31_Q58(a[114], b[72]) + IFX_MATQ31_Q58(a[115], b[84]) + IFX_MATQ31_Q58(a[116], b[96])
+        + IFX_MATQ31_Q58(a[117], b[108]) + IFX_MATQ31_Q58(a[118], b[120]) + IFX_MATQ31_Q58(a[119], b[132]);
+    c[108] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[1]) + IFX_MATQ31_Q58(a[109], b[13]) + IFX_MATQ31_Q58(a[110], b[25])
+        + IFX_MATQ31_Q58(a[111], b[37]) + IFX_MATQ31_Q58(a[112], b[49]) + IFX_MATQ31_Q58(a[113], b[61])
+        + IFX_MATQ31_Q58(a[114], b[73]) + IFX_MATQ31_Q58(a[115], b[85]) + IFX_MATQ31_Q58(a[116], b[97])
+        + IFX_MATQ31_Q58(a[117], b[109]) + IFX_MATQ31_Q58(a[118], b[121]) + IFX_MATQ31_Q58(a[119], b[133]);
+    c[109] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[2]) + IFX_MATQ31_Q58(a[109], b[14]) + IFX_MATQ31_Q58(a[110], b[26])
+        + IFX_MATQ31_Q58(a[111], b[38]) + IFX_MATQ31_Q58(a[112], b[50]) + IFX_MATQ31_Q58(a[113], b[62])
+        + IFX_MATQ31_Q58(a[114], b[74]) + IFX_MATQ31_Q58(a[115], b[86]) + IFX_MATQ31_Q58(a[116], b[98])
+        + IFX_MATQ31_Q58(a[117], b[110]) + IFX_MATQ31_Q58(a[118], b[122]) + IFX_MATQ31_Q58(a[119], b[134]);
+    c[110] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[3]) + IFX_MATQ31_Q58(a[109], b[15]) + IFX_MATQ31_Q58(a[110], b[27])
+        + IFX_MATQ31_Q58(a[111], b[39]) + IFX_MATQ31_Q58(a[112], b[51]) + IFX_MATQ31_Q58(a[113], b[63])
+        + IFX_MATQ31_Q58(a[114], b[75]) + IFX_MATQ31_Q58(a[115], b[87]) + IFX_MATQ31_Q58(a[116], b[99])
+        + IFX_MATQ31_Q58(a[117], b[111]) + IFX_MATQ31_Q58(a[118], b[123]) + IFX_MATQ31_Q58(a[119], b[135]);
+    c[111] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[4]) + IFX_MATQ31_Q58(a[109], b[16]) + IFX_MATQ31_Q58(a[110], b[28])
+        + IFX_MATQ31_Q58(a[111], b[40]) + IFX_MATQ31_Q58(a[112], b[52]) + IFX_MATQ31_Q58(a[113], b[64])
+        + IFX_MATQ31_Q58(a[114], b[76]) + IFX_MATQ31_Q58(a[115], b[88]) + IFX_MATQ31_Q58(a[116], b[100])
+        + IFX_MATQ31_Q58(a[117], b[112]) + IFX_MATQ31_Q58(a[118], b[124]) + IFX_MATQ31_Q58(a[119], b[136]);
+    c[112] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[5]) + IFX_MATQ31_Q58(a[109], b[17]) + IFX_MATQ31_Q58(a[110], b[29])
+        + IFX_MATQ31_Q58(a[111], b[41]) + IFX_MATQ31_Q58(a[112], b[53]) + IFX_MATQ31_Q58(a[113], b[65])
+        + IFX_MATQ31_Q58(a[114], b[77]) + IFX_MATQ31_Q58(a[115], b[89]) + IFX_MATQ31_Q58(a[116], b[101])
+        + IFX_MATQ31_Q58(a[117], b[113]) + IFX_MATQ31_Q58(a[118], b[125]) + IFX_MATQ31_Q58(a[119], b[137]);
+    c[113] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[6]) + IFX_MATQ31_Q58(a[109], b[18]) + IFX_MATQ31_Q58(a[110], b[30])
+        + IFX_MATQ31_Q58(a[111], b[42]) + IFX_MATQ31_Q58(a[112], b[54]) + IFX_MATQ31_Q58(a[113], b[66])
+        + IFX_MATQ31_Q58(a[114], b[78]) + IFX_MATQ31_Q58(a[115], b[90]) + IFX_MATQ31_Q58(a[116], b[102])
+        + IFX_MATQ31_Q58(a[117], b[114]) + IFX_MATQ31_Q58(a[118], b[126]) + IFX_MATQ31_Q58(a[119], b[138]);
+    c[114] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[7]) + IFX_MATQ31_Q58(a[109], b[19]) + IFX_MATQ31_Q58(a[110], b[31])
+        + IFX_MATQ31_Q58(a[111], b[43]) + IFX_MATQ31_Q58(a[112], b[55]) + IFX_MATQ31_Q58(a[113], b[67])
+        + IFX_MATQ31_Q58(a[114], b[79]) + IFX_MATQ31_Q58(a[115], b[91]) + IFX_MATQ31_Q58(a[116], b[103])
+        + IFX_MATQ31_Q58(a[117], b[115]) + IFX_MATQ31_Q58(a[118], b[127]) + IFX_MATQ31_Q58(a[119], b[139]);
+    c[115] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[8]) + IFX_MATQ31_Q58(a[109], b[20]) + IFX_MATQ31_Q58(a[110], b[32])
+        + IFX_MATQ31_Q58(a[111], b[44]) + IFX_MATQ31_Q58(a[112], b[56]) + IFX_MATQ31_Q58(a[113], b[68])
+        + IFX_MATQ31_Q58(a[114], b[80]) + IFX_MATQ31_Q58(a[115], b[92]) + IFX_MATQ31_Q58(a[116], b[104])
+        + IFX_MATQ31_Q58(a[117], b[116]) + IFX_MATQ31_Q58(a[118], b[128]) + IFX_MATQ31_Q58(a[119], b[140]);
+    c[116] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[9]) + IFX_MATQ31_Q58(a[109], b[21]) + IFX_MATQ31_Q58(a[110], b[33])
+        + IFX_MATQ31_Q58(a[111], b[45]) + IFX_MATQ31_Q58(a[112], b[57]) + IFX_MATQ31_Q58(a[113], b[69])
+        + IFX_MATQ31_Q58(a[114], b[81]) + IFX_MATQ31_Q58(a[115], b[93]) + IFX_MATQ31_Q58(a[116], b[105])
+        + IFX_MATQ31_Q58(a[117], b[117]) + IFX_MATQ31_Q58(a[118], b[129]) + IFX_MATQ31_Q58(a[119], b[141]);
+    c[117] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[10]) + IFX_MATQ31_Q58(a[109], b[22]) + IFX_MATQ31_Q58(a[110], b[34])
+        + IFX_MATQ31_Q58(a[111], b[46]) + IFX_MATQ31_Q58(a[112], b[58]) + IFX_MATQ31_Q58(a[113], b[70])
+        + IFX_MATQ31_Q58(a[114], b[82]) + IFX_MATQ31_Q58(a[115], b[94]) + IFX_MATQ31_Q58(a[116], b[106])
+        + IFX_MATQ31_Q58(a[117], b[118]) + IFX_MATQ31_Q58(a[118], b[130]) + IFX_MATQ31_Q58(a[119], b[142]);
+    c[118] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], b[11]) + IFX_MATQ31_Q58(a[109], b[23]) + IFX_MATQ31_Q58(a[110], b[35])
+        + IFX_MATQ31_Q58(a[111], b[47]) + IFX_MATQ31_Q58(a[112], b[59]) + IFX_MATQ31_Q58(a[113], b[71])
+        + IFX_MATQ31_Q58(a[114], b[83]) + IFX_MATQ31_Q58(a[115], b[95]) + IFX_MATQ31_Q58(a[116], b[107])
+        + IFX_MATQ31_Q58(a[117], b[119]) + IFX_MATQ31_Q58(a[118], b[131]) + IFX_MATQ31_Q58(a[119], b[143]);
+    c[119] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[0]) + IFX_MATQ31_Q58(a[121], b[12]) + IFX_MATQ31_Q58(a[122], b[24])
+        + IFX_MATQ31_Q58(a[123], b[36]) + IFX_MATQ31_Q58(a[124], b[48]) + IFX_MATQ31_Q58(a[125], b[60])
+        + IFX_MATQ31_Q58(a[126], b[72]) + IFX_MATQ31_Q58(a[127], b[84]) + IFX_MATQ31_Q58(a[128], b[96])
+        + IFX_MATQ31_Q58(a[129], b[108]) + IFX_MATQ31_Q58(a[130], b[120]) + IFX_MATQ31_Q58(a[131], b[132]);
+    c[120] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[1]) + IFX_MATQ31_Q58(a[121], b[13]) + IFX_MATQ31_Q58(a[122], b[25])
+        + IFX_MATQ31_Q58(a[123], b[37]) + IFX_MATQ31_Q58(a[124], b[49]) + IFX_MATQ31_Q58(a[125], b[61])
+        + IFX_MATQ31_Q58(a[126], b[73]) + IFX_MATQ31_Q58(a[127], b[85]) + IFX_MATQ31_Q58(a[128], b[97])
+        + IFX_MATQ31_Q58(a[129], b[109]) + IFX_MATQ31_Q58(a[130], b[121]) + IFX_MATQ31_Q58(a[131], b[133]);
+    c[121] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[2]) + IFX_MATQ31_Q58(a[121], b[14]) + IFX_MATQ31_Q58(a[122], b[26])
+        + IFX_MATQ31_Q58(a[123], b[38]) + IFX_MATQ31_Q58(a[124], b[50]) + IFX_MATQ31_Q58(a[125], b[62])
+        + IFX_MATQ31_Q58(a[126], b[74]) + IFX_MATQ31_Q58(a[127], b[86]) + IFX_MATQ31_Q58(a[128], b[98])
+        + IFX_MATQ31_Q58(a[129], b[110]) + IFX_MATQ31_Q58(a[130], b[122]) + IFX_MATQ31_Q58(a[131], b[134]);
+    c[122] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[3]) + IFX_MATQ31_Q58(a[121], b[15]) + IFX_MATQ31_Q58(a[122], b[27])
+        + IFX_MATQ31_Q58(a[123], b[39]) + IFX_MATQ31_Q58(a[124], b[51]) + IFX_MATQ31_Q58(a[125], b[63])
+        + IFX_MATQ31_Q58(a[126], b[75]) + IFX_MATQ31_Q58(a[127], b[87]) + IFX_MATQ31_Q58(a[128], b[99])
+        + IFX_MATQ31_Q58(a[129], b[111]) + IFX_MATQ31_Q58(a[130], b[123]) + IFX_MATQ31_Q58(a[131], b[135]);
+    c[123] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[4]) + IFX_MATQ31_Q58(a[121], b[16]) + IFX_MATQ31_Q58(a[122], b[28])
+        + IFX_MATQ31_Q58(a[123], b[40]) + IFX_MATQ31_Q58(a[124], b[52]) + IFX_MATQ31_Q58(a[125], b[64])
+        + IFX_MATQ31_Q58(a[126], b[76]) + IFX_MATQ31_Q58(a[127], b[88]) + IFX_MATQ31_Q58(a[128], b[100])
+        + IFX_MATQ31_Q58(a[129], b[112]) + IFX_MATQ31_Q58(a[130], b[124]) + IFX_MATQ31_Q58(a[131], b[136]);
+    c[124] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[5]) + IFX_MATQ31_Q58(a[121], b[17]) + IFX_MATQ31_Q58(a[122], b[29])
+        + IFX_MATQ31_Q58(a[123], b[41]) + IFX_MATQ31_Q58(a[124], b[53]) + IFX_MATQ31_Q58(a[125], b[65])
+        + IFX_MATQ31_Q58(a[126], b[77]) + IFX_MATQ31_Q58(a[127], b[89]) + IFX_MATQ31_Q58(a[128], b[101])
+        + IFX_MATQ31_Q58(a[129], b[113]) + IFX_MATQ31_Q58(a[130], b[125]) + IFX_MATQ31_Q58(a[131], b[137]);
+    c[125] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[6]) + IFX_MATQ31_Q58(a[121], b[18]) + IFX_MATQ31_Q58(a[122], b[30])
+        + IFX_MATQ31_Q58(a[123], b[42]) + IFX_MATQ31_Q58(a[124], b[54]) + IFX_MATQ31_Q58(a[125], b[66])
+        + IFX_MATQ31_Q58(a[126], b[78]) + IFX_MATQ31_Q58(a[127], b[90]) + IFX_MATQ31_Q58(a[128], b[102])
+        + IFX_MATQ31_Q58(a[129], b[114]) + IFX_MATQ31_Q58(a[130], b[126]) + IFX_MATQ31_Q58(a[131], b[138]);
+    c[126] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[7]) + IFX_MATQ31_Q58(a[121], b[19]) + IFX_MATQ31_Q58(a[122], b[31])
+        + IFX_MATQ31_Q58(a[123], b[43]) + IFX_MATQ31_Q58(a[124], b[55]) + IFX_MATQ31_Q58(a[125], b[67])
+        + IFX_MATQ31_Q58(a[126], b[79]) + IFX_MATQ31_Q58(a[127], b[91]) + IFX_MATQ31_Q58(a[128], b[103])
+        + IFX_MATQ31_Q58(a[129], b[115]) + IFX_MATQ31_Q58(a[130], b[127]) + IFX_MATQ31_Q58(a[131], b[139]);
+    c[127] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[8]) + IFX_MATQ31_Q58(a[121], b[20]) + IFX_MATQ31_Q58(a[122], b[32])
+        + IFX_MATQ31_Q58(a[123], b[44]) + IFX_MATQ31_Q58(a[124], b[56]) + IFX_MATQ31_Q58(a[125], b[68])
+        + IFX_MATQ31_Q58(a[126], b[80]) + IFX_MATQ31_Q58(a[127], b[92]) + IFX_MATQ31_Q58(a[128], b[104])
+        + IFX_MATQ31_Q58(a[129], b[116]) + IFX_MATQ31_Q58(a[130], b[128]) + IFX_MATQ31_Q58(a[131], b[140]);
+    c[128] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[9]) + IFX_MATQ31_Q58(a[121], b[21]) + IFX_MATQ31_Q58(a[122], b[33])
+        + IFX_MATQ31_Q58(a[123], b[45]) + IFX_MATQ31_Q58(a[124], b[57]) + IFX_MATQ31_Q58(a[125], b[69])
+        + IFX_MATQ31_Q58(a[126], b[81]) + IFX_MATQ31_Q58(a[127], b[93]) + IFX_MATQ31_Q58(a[128], b[105])
+        + IFX_MATQ31_Q58(a[129], b[117]) + IFX_MATQ31_Q58(a[130], b[129]) + IFX_MATQ31_Q58(a[131], b[141]);
+    c[129] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[10]) + IFX_MATQ31_Q58(a[121], b[22]) + IFX_MATQ31_Q58(a[122], b[34])
+        + IFX_MATQ31_Q58(a[123], b[46]) + IFX_MATQ31_Q58(a[124], b[58]) + IFX_MATQ31_Q58(a[125], b[70])
+        + IFX_MATQ31_Q58(a[126], b[82]) + IFX_MATQ31_Q58(a[127], b[94]) + IFX_MATQ31_Q58(a[128], b[106])
+        + IFX_MATQ31_Q58(a[129], b[118]) + IFX_MATQ31_Q58(a[130], b[130]) + IFX_MATQ31_Q58(a[131], b[142]);
+    c[130] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], b[11]) + IFX_MATQ31_Q58(a[121], b[23]) + IFX_MATQ31_Q58(a[122], b[35])
+        + IFX_MATQ31_Q58(a[123], b[47]) + IFX_MATQ31_Q58(a[124], b[59]) + IFX_MATQ31_Q58(a[125], b[71])
+        + IFX_MATQ31_Q58(a[126], b[83]) + IFX_MATQ31_Q58(a[127], b[95]) + IFX_MATQ31_Q58(a[128], b[107])
+        + IFX_MATQ31_Q58(a[129], b[119]) + IFX_MATQ31_Q58(a[130], b[131]) + IFX_MATQ31_Q58(a[131], b[143]);
+    c[131] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[0]) + IFX_MATQ31_Q58(a[133], b[12]) + IFX_MATQ31_Q58(a[134], b[24])
+        + IFX_MATQ31_Q58(a[135], b[36]) + IFX_MATQ31_Q58(a[136], b[48]) + IFX_MATQ31_Q58(a[137], b[60])
+        + IFX_MATQ31_Q58(a[138], b[72]) + IFX_MATQ31_Q58(a[139], b[84]) + IFX_MATQ31_Q58(a[140], b[96])
+        + IFX_MATQ31_Q58(a[141], b[108]) + IFX_MATQ31_Q58(a[142], b[120]) + IFX_MATQ31_Q58(a[143], b[132]);
+    c[132] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[1]) + IFX_MATQ31_Q58(a[133], b[13]) + IFX_MATQ31_Q58(a[134], b[25])
+        + IFX_MATQ31_Q58(a[135], b[37]) + IFX_MATQ31_Q58(a[136], b[49]) + IFX_MATQ31_Q58(a[137], b[61])
+        + IFX_MATQ31_Q58(a[138], b[73]) + IFX_MATQ31_Q58(a[139], b[85]) + IFX_MATQ31_Q58(a[140], b[97])
+        + IFX_MATQ31_Q58(a[141], b[109]) + IFX_MATQ31_Q58(a[142], b[121]) + IFX_MATQ31_Q58(a[143], b[133]);
+    c[133] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[2]) + IFX_MATQ31_Q58(a[133], b[14]) + IFX_MATQ31_Q58(a[134], b[26])
+        + IFX_MATQ31_Q58(a[135], b[38]) + IFX_MATQ31_Q58(a[136], b[50]) + IFX_MATQ31_Q58(a[137], b[62])
+        + IFX_MATQ31_Q58(a[138], b[74]) + IFX_MATQ31_Q58(a[139], b[86]) + IFX_MATQ31_Q58(a[140], b[98])
+        + IFX_MATQ31_Q58(a[141], b[110]) + IFX_MATQ31_Q58(a[142], b[122]) + IFX_MATQ31_Q58(a[143], b[134]);
+    c[134] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[3]) + IFX_MATQ31_Q58(a[133], b[15]) + IFX_MATQ31_Q58(a[134], b[27])
+        + IFX_MATQ31_Q58(a[135], b[39]) + IFX_MATQ31_Q58(a[136], b[51]) + IFX_MATQ31_Q58(a[137], b[63])
+        + IFX_MATQ31_Q58(a[138], b[75]) + IFX_MATQ31_Q58(a[139], b[87]) + IFX_MATQ31_Q58(a[140], b[99])
+        + IFX_MATQ31_Q58(a[141], b[111]) + IFX_MATQ31_Q58(a[142], b[123]) + IFX_MATQ31_Q58(a[143], b[135]);
+    c[135] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[4]) + IFX_MATQ31_Q58(a[133], b[16]) + IFX_MATQ31_Q58(a[134], b[28])
+        + IFX_MATQ31_Q58(a[135], b[40]) + IFX_MATQ31_Q58(a[136], b[52]) + IFX_MATQ31_Q58(a[137], b[64])
+        + IFX_MATQ31_Q58(a[138], b[76]) + IFX_MATQ31_Q58(a[139], b[88]) + IFX_MATQ31_Q58(a[140], b[100])
+        + IFX_MATQ31_Q58(a[141], b[112]) + IFX_MATQ31_Q58(a[142], b[124]) + IFX_MATQ31_Q58(a[143], b[136]);
+    c[136] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[5]) + IFX_MATQ31_Q58(a[133], b[17]) + IFX_MATQ31_Q58(a[134], b[29])
+        + IFX_MATQ31_Q58(a[135], b[41]) + IFX_MATQ31_Q58(a[136], b[53]) + IFX_MATQ31_Q58(a[137], b[65])
+        + IFX_MATQ31_Q58(a[138], b[77]) + IFX_MATQ31_Q58(a[139], b[89]) + IFX_MATQ31_Q58(a[140], b[101])
+        + IFX_MATQ31_Q58(a[141], b[113]) + IFX_MATQ31_Q58(a[142], b[125]) + IFX_MATQ31_Q58(a[143], b[137]);
+    c[137] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[6]) + IFX_MATQ31_Q58(a[133], b[18]) + IFX_MATQ31_Q58(a[134], b[30])
+        + IFX_MATQ31_Q58(a[135], b[42]) + IFX_MATQ31_Q58(a[136], b[54]) + IFX_MATQ31_Q58(a[137], b[66])
+        + IFX_MATQ31_Q58(a[138], b[78]) + IFX_MATQ31_Q58(a[139], b[90]) + IFX_MATQ31_Q58(a[140], b[102])
+        + IFX_MATQ31_Q58(a[141], b[114]) + IFX_MATQ31_Q58(a[142], b[126]) + IFX_MATQ31_Q58(a[143], b[138]);
+    c[138] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[7]) + IFX_MATQ31_Q58(a[133], b[19]) + IFX_MATQ31_Q58(a[134], b[31])
+        + IFX_MATQ31_Q58(a[135], b[43]) + IFX_MATQ31_Q58(a[136], b[55]) + IFX_MATQ31_Q58(a[137], b[67])
+        + IFX_MATQ31_Q58(a[138], b[79]) + IFX_MATQ31_Q58(a[139], b[91]) + IFX_MATQ31_Q58(a[140], b[103])
+        + IFX_MATQ31_Q58(a[141], b[115]) + IFX_MATQ31_Q58(a[142], b[127]) + IFX_MATQ31_Q58(a[143], b[139]);
+    c[139] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[8]) + IFX_MATQ31_Q58(a[133], b[20]) + IFX_MATQ31_Q58(a[134], b[32])
+        + IFX_MATQ31_Q58(a[135], b[44]) + IFX_MATQ31_Q58(a[136], b[56]) + IFX_MATQ31_Q58(a[137], b[68])
+        + IFX_MATQ31_Q58(a[138], b[80]) + IFX_MATQ31_Q58(a[139], b[92]) + IFX_MATQ31_Q58(a[140], b[104])
+        + IFX_MATQ31_Q58(a[141], b[116]) + IFX_MATQ31_Q58(a[142], b[128]) + IFX_MATQ31_Q58(a[143], b[140]);
+    c[140] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[9]) + IFX_MATQ31_Q58(a[133], b[21]) + IFX_MATQ31_Q58(a[134], b[33])
+        + IFX_MATQ31_Q58(a[135], b[45]) + IFX_MATQ31_Q58(a[136], b[57]) + IFX_MATQ31_Q58(a[137], b[69])
+        + IFX_MATQ31_Q58(a[138], b[81]) + IFX_MATQ31_Q58(a[139], b[93]) + IFX_MATQ31_Q58(a[140], b[105])
+        + IFX_MATQ31_Q58(a[141], b[117]) + IFX_MATQ31_Q58(a[142], b[129]) + IFX_MATQ31_Q58(a[143], b[141]);
+    c[141] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[10]) + IFX_MATQ31_Q58(a[133], b[22]) + IFX_MATQ31_Q58(a[134], b[34])
+        + IFX_MATQ31_Q58(a[135], b[46]) + IFX_MATQ31_Q58(a[136], b[58]) + IFX_MATQ31_Q58(a[137], b[70])
+        + IFX_MATQ31_Q58(a[138], b[82]) + IFX_MATQ31_Q58(a[139], b[94]) + IFX_MATQ31_Q58(a[140], b[106])
+        + IFX_MATQ31_Q58(a[141], b[118]) + IFX_MATQ31_Q58(a[142], b[130]) + IFX_MATQ31_Q58(a[143], b[142]);
+    c[142] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], b[11]) + IFX_MATQ31_Q58(a[133], b[23]) + IFX_MATQ31_Q58(a[134], b[35])
+        + IFX_MATQ31_Q58(a[135], b[47]) + IFX_MATQ31_Q58(a[136], b[59]) + IFX_MATQ31_Q58(a[137], b[71])
+        + IFX_MATQ31_Q58(a[138], b[83]) + IFX_MATQ31_Q58(a[139], b[95]) + IFX_MATQ31_Q58(a[140], b[107])
+        + IFX_MATQ31_Q58(a[141], b[119]) + IFX_MATQ31_Q58(a[142], b[131]) + IFX_MATQ31_Q58(a[143], b[143]);
+    c[143] = Ifx_MatQ31_fromQ58(sum);
+}
+
+
+void Ifx_MatQ31_mulVec12(sint32 *y, const sint32 *a, const sint32 *x)
+{
+    sint64 sum;
+
+    sum = IFX_MATQ31_Q58(a[0], x[0]) + IFX_MATQ31_Q58(a[1], x[1]) + IFX_MATQ31_Q58(a[2], x[2])
+        + IFX_MATQ31_Q58(a[3], x[3]) + IFX_MATQ31_Q58(a[4], x[4]) + IFX_MATQ31_Q58(a[5], x[5])
+        + IFX_MATQ31_Q58(a[6], x[6]) + IFX_MATQ31_Q58(a[7], x[7]) + IFX_MATQ31_Q58(a[8], x[8])
+        + IFX_MATQ31_Q58(a[9], x[9]) + IFX_MATQ31_Q58(a[10], x[10]) + IFX_MATQ31_Q58(a[11], x[11]);
+    y[0] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[12], x[0]) + IFX_MATQ31_Q58(a[13], x[1]) + IFX_MATQ31_Q58(a[14], x[2])
+        + IFX_MATQ31_Q58(a[15], x[3]) + IFX_MATQ31_Q58(a[16], x[4]) + IFX_MATQ31_Q58(a[17], x[5])
+        + IFX_MATQ31_Q58(a[18], x[6]) + IFX_MATQ31_Q58(a[19], x[7]) + IFX_MATQ31_Q58(a[20], x[8])
+        + IFX_MATQ31_Q58(a[21], x[9]) + IFX_MATQ31_Q58(a[22], x[10]) + IFX_MATQ31_Q58(a[23], x[11]);
+    y[1] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[24], x[0]) + IFX_MATQ31_Q58(a[25], x[1]) + IFX_MATQ31_Q58(a[26], x[2])
+        + IFX_MATQ31_Q58(a[27], x[3]) + IFX_MATQ31_Q58(a[28], x[4]) + IFX_MATQ31_Q58(a[29], x[5])
+        + IFX_MATQ31_Q58(a[30], x[6]) + IFX_MATQ31_Q58(a[31], x[7]) + IFX_MATQ31_Q58(a[32], x[8])
+        + IFX_MATQ31_Q58(a[33], x[9]) + IFX_MATQ31_Q58(a[34], x[10]) + IFX_MATQ31_Q58(a[35], x[11]);
+    y[2] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[36], x[0]) + IFX_MATQ31_Q58(a[37], x[1]) + IFX_MATQ31_Q58(a[38], x[2])
+        + IFX_MATQ31_Q58(a[39], x[3]) + IFX_MATQ31_Q58(a[40], x[4]) + IFX_MATQ31_Q58(a[41], x[5])
+        + IFX_MATQ31_Q58(a[42], x[6]) + IFX_MATQ31_Q58(a[43], x[7]) + IFX_MATQ31_Q58(a[44], x[8])
+        + IFX_MATQ31_Q58(a[45], x[9]) + IFX_MATQ31_Q58(a[46], x[10]) + IFX_MATQ31_Q58(a[47], x[11]);
+    y[3] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[48], x[0]) + IFX_MATQ31_Q58(a[49], x[1]) + IFX_MATQ31_Q58(a[50], x[2])
+        + IFX_MATQ31_Q58(a[51], x[3]) + IFX_MATQ31_Q58(a[52], x[4]) + IFX_MATQ31_Q58(a[53], x[5])
+        + IFX_MATQ31_Q58(a[54], x[6]) + IFX_MATQ31_Q58(a[55], x[7]) + IFX_MATQ31_Q58(a[56], x[8])
+        + IFX_MATQ31_Q58(a[57], x[9]) + IFX_MATQ31_Q58(a[58], x[10]) + IFX_MATQ31_Q58(a[59], x[11]);
+    y[4] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[60], x[0]) + IFX_MATQ31_Q58(a[61], x[1]) + IFX_MATQ31_Q58(a[62], x[2])
+        + IFX_MATQ31_Q58(a[63], x[3]) + IFX_MATQ31_Q58(a[64], x[4]) + IFX_MATQ31_Q58(a[65], x[5])
+        + IFX_MATQ31_Q58(a[66], x[6]) + IFX_MATQ31_Q58(a[67], x[7]) + IFX_MATQ31_Q58(a[68], x[8])
+        + IFX_MATQ31_Q58(a[69], x[9]) + IFX_MATQ31_Q58(a[70], x[10]) + IFX_MATQ31_Q58(a[71], x[11]);
+    y[5] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[72], x[0]) + IFX_MATQ31_Q58(a[73], x[1]) + IFX_MATQ31_Q58(a[74], x[2])
+        + IFX_MATQ31_Q58(a[75], x[3]) + IFX_MATQ31_Q58(a[76], x[4]) + IFX_MATQ31_Q58(a[77], x[5])
+        + IFX_MATQ31_Q58(a[78], x[6]) + IFX_MATQ31_Q58(a[79], x[7]) + IFX_MATQ31_Q58(a[80], x[8])
+        + IFX_MATQ31_Q58(a[81], x[9]) + IFX_MATQ31_Q58(a[82], x[10]) + IFX_MATQ31_Q58(a[83], x[11]);
+    y[6] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[84], x[0]) + IFX_MATQ31_Q58(a[85], x[1]) + IFX_MATQ31_Q58(a[86], x[2])
+        + IFX_MATQ31_Q58(a[87], x[3]) + IFX_MATQ31_Q58(a[88], x[4]) + IFX_MATQ31_Q58(a[89], x[5])
+        + IFX_MATQ31_Q58(a[90], x[6]) + IFX_MATQ31_Q58(a[91], x[7]) + IFX_MATQ31_Q58(a[92], x[8])
+        + IFX_MATQ31_Q58(a[93], x[9]) + IFX_MATQ31_Q58(a[94], x[10]) + IFX_MATQ31_Q58(a[95], x[11]);
+    y[7] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[96], x[0]) + IFX_MATQ31_Q58(a[97], x[1]) + IFX_MATQ31_Q58(a[98], x[2])
+        + IFX_MATQ31_Q58(a[99], x[3]) + IFX_MATQ31_Q58(a[100], x[4]) + IFX_MATQ31_Q58(a[101], x[5])
+        + IFX_MATQ31_Q58(a[102], x[6]) + IFX_MATQ31_Q58(a[103], x[7]) + IFX_MATQ31_Q58(a[104], x[8])
+        + IFX_MATQ31_Q58(a[105], x[9]) + IFX_MATQ31_Q58(a[106], x[10]) + IFX_MATQ31_Q58(a[107], x[11]);
+    y[8] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[108], x[0]) + IFX_MATQ31_Q58(a[109], x[1]) + IFX_MATQ31_Q58(a[110], x[2])
+        + IFX_MATQ31_Q58(a[111], x[3]) + IFX_MATQ31_Q58(a[112], x[4]) + IFX_MATQ31_Q58(a[113], x[5])
+        + IFX_MATQ31_Q58(a[114], x[6]) + IFX_MATQ31_Q58(a[115], x[7]) + IFX_MATQ31_Q58(a[116], x[8])
+        + IFX_MATQ31_Q58(a[117], x[9]) + IFX_MATQ31_Q58(a[118], x[10]) + IFX_MATQ31_Q58(a[119], x[11]);
+    y[9] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[120], x[0]) + IFX_MATQ31_Q58(a[121], x[1]) + IFX_MATQ31_Q58(a[122], x[2])
+        + IFX_MATQ31_Q58(a[123], x[3]) + IFX_MATQ31_Q58(a[124], x[4]) + IFX_MATQ31_Q58(a[125], x[5])
+        + IFX_MATQ31_Q58(a[126], x[6]) + IFX_MATQ31_Q58(a[127], x[7]) + IFX_MATQ31_Q58(a[128], x[8])
+        + IFX_MATQ31_Q58(a[129], x[9]) + IFX_MATQ31_Q58(a[130], x[10]) + IFX_MATQ31_Q58(a[131], x[11]);
+    y[10] = Ifx_MatQ31_fromQ58(sum);
+    sum = IFX_MATQ31_Q58(a[132], x[0]) + IFX_MATQ31_Q58(a[133], x[1]) + IFX_MATQ31_Q58(a[134], x[2])
+        + IFX_MATQ31_Q58(a[135], x[3]) + IFX_MATQ31_Q58(a[136], x[4]) + IFX_MATQ31_Q58(a[137], x[5])
+        + IFX_MATQ31_Q58(a[138], x[6]) + IFX_MATQ31_Q58(a[139], x[7]) + IFX_MATQ31_Q58(a[140], x[8])
+        + IFX_MATQ31_Q58(a[141], x[9]) + IFX_MATQ31_Q58(a[142], x[10]) + IFX_MATQ31_Q58(a[143], x[11]);
+    y[11] = Ifx_MatQ31_fromQ58(sum);
+}
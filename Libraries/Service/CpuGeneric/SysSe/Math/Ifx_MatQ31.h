@@ -0,0 +1,175 @@
+/**
+ * \file Ifx_MatQ31.h
+ * \brief Fixed-size Q31 matrices
+ *
+ * Generated by tools/mat_gen.py - do not edit.
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ * \defgroup library_srvsw_sysse_math_q31_mat Fixed-size Q31 matrices
+ * This module holds the operations on n x n Q31 matrices for n = 2 to 12,
+ * laid out as those of \ref library_srvsw_sysse_math_f32_mat: add,
+ * transpose, multiply and matrix-vector multiply. An element is a sint32
+ * with 1.0 at 2^31.
+ *
+ * Products are summed exactly to 58 fractional bits, which holds 16 full
+ * scale products without overflow, rounded once to Q31 and saturated.
+ * Additions saturate. The factorisations and the Kalman filter are float32
+ * only, their intermediate values needing more range than Q31 has.
+ *
+ * \ingroup library_srvsw_sysse_math
+ */
+
+#ifndef IFX_MATQ31_H
+#define IFX_MATQ31_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+
+/** \brief Product of two Q31 values in Q58 */
+#define IFX_MATQ31_Q58(a, b) (((sint64)(a) * (b)) >> 4)
+
+/** \brief Saturate to Q31
+ * \param value Sum of two Q31 values
+ * \return value limited to -1 .. 1 - 2^-31
+ */
+IFX_INLINE sint32 Ifx_MatQ31_saturate(sint64 value)
+{
+    return (sint32)((value > 0x7FFFFFFF) ? 0x7FFFFFFF : ((value < -0x7FFFFFFF - 1) ? (-0x7FFFFFFF - 1) : value));
+}
+
+
+/** \brief Round a Q58 sum to Q31 and saturate
+ * \param sum Sum of IFX_MATQ31_Q58() products
+ * \return Q31 value
+ */
+IFX_INLINE sint32 Ifx_MatQ31_fromQ58(sint64 sum)
+{
+    return Ifx_MatQ31_saturate((sum + (1LL << 26)) >> 27);
+}
+
+/** \addtogroup library_srvsw_sysse_math_q31_mat
+ * \{ */
+
+/** \name 2 x 2
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add2(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose2(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul2(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec2(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 3 x 3
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add3(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose3(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul3(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec3(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 4 x 4
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add4(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose4(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul4(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec4(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 5 x 5
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add5(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose5(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul5(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec5(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 6 x 6
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add6(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose6(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul6(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec6(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 7 x 7
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add7(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose7(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul7(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec7(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 8 x 8
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add8(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose8(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul8(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec8(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 9 x 9
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add9(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose9(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul9(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec9(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 10 x 10
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add10(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose10(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul10(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec10(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 11 x 11
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add11(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose11(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul11(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec11(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \name 12 x 12
+ * \{ */
+IFX_EXTERN void Ifx_MatQ31_add12(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_transpose12(sint32 *c, const sint32 *a);
+IFX_EXTERN void Ifx_MatQ31_mul12(sint32 *c, const sint32 *a, const sint32 *b);
+IFX_EXTERN void Ifx_MatQ31_mulVec12(sint32 *y, const sint32 *a, const sint32 *x);
+/** \} */
+
+/** \} */
+
+#endif /* IFX_MATQ31_H */
@@ -362,6 +362,37 @@ void IfxGeth_mtl_setTxStoreAndForward(Ifx_GETH *gethSFR, IfxGeth_TxMtlQueue queu
 }
 
 
+void IfxGeth_mtl_setTxCreditBasedShaper(Ifx_GETH *gethSFR, IfxGeth_TxMtlQueue queueId, uint32 idleSlope, uint32 sendSlope, uint32 hiCredit, uint32 loCredit)
+{
+    Ifx_GETH_MTL_TXQ *txQueue = NULL_PTR;
+
+    switch (queueId)
+    {
+    case IfxGeth_TxMtlQueue_1:
+        txQueue = &gethSFR->MTL_TXQ1;
+        break;
+    case IfxGeth_TxMtlQueue_2:
+        txQueue = &gethSFR->MTL_TXQ2;
+        break;
+    case IfxGeth_TxMtlQueue_3:
+        txQueue = &gethSFR->MTL_TXQ3;
+        break;
+    default:
+        break;
+    }
+
+    if (txQueue != NULL_PTR)
+    {
+        txQueue->QUANTUM_WEIGHT.B.ISCQW = idleSlope;
+        txQueue->SENDSLOPECREDIT.B.SSC  = sendSlope;
+        txQueue->HICREDIT.B.HC          = hiCredit;
+        txQueue->LOCREDIT.B.LC          = loCredit;
+        txQueue->ETS_CONTROL.B.CC       = 0;
+        txQueue->ETS_CONTROL.B.AVALG    = 1;
+    }
+}
+
+
 void IfxGeth_resetModule(Ifx_GETH *gethSFR)
 {
     uint16 passwd = IfxScuWdt_getCpuWatchdogPassword();
@@ -560,3 +591,80 @@ boolean IfxGeth_mac_readQueueVlanTag(Ifx_GETH *gethSFR, IfxGeth_MtlQueue queueId
 
     return TRUE;
 }
+
+
+void IfxGeth_mac_initSystemTime(Ifx_GETH *gethSFR, uint8 subSecondIncrement, uint32 addend)
+{
+    Ifx_GETH_MAC_TIMESTAMP_CONTROL control;
+
+    control.U             = 0;
+    control.B.TSENA       = 1;
+    control.B.TSCFUPDT    = 1;    /* fine update, the addend sets the rate */
+    control.B.TSCTRLSSR   = 1;    /* sub seconds count nanoseconds */
+    control.B.TSVER2ENA   = 1;
+    control.B.TSIPV4ENA   = 1;
+    control.B.SNAPTYPSEL  = 1;    /* all PTP messages, TSEVNTENA = 0 */
+
+    gethSFR->MAC_TIMESTAMP_CONTROL.U            = control.U;
+    gethSFR->MAC_SUB_SECOND_INCREMENT.U         = 0;
+    gethSFR->MAC_SUB_SECOND_INCREMENT.B.SSINC   = subSecondIncrement;
+
+    IfxGeth_mac_setTimestampAddend(gethSFR, addend);
+
+    gethSFR->MAC_SYSTEM_TIME_SECONDS_UPDATE.U     = 0;
+    gethSFR->MAC_SYSTEM_TIME_NANOSECONDS_UPDATE.U = 0;
+    gethSFR->MAC_TIMESTAMP_CONTROL.B.TSINIT       = 1;
+
+    // Wait until operation is finished
+    while (gethSFR->MAC_TIMESTAMP_CONTROL.B.TSINIT)
+    {}
+}
+
+
+void IfxGeth_mac_setTimestampAddend(Ifx_GETH *gethSFR, uint32 addend)
+{
+    // Wait until a previous update is finished
+    while (gethSFR->MAC_TIMESTAMP_CONTROL.B.TSADDREG)
+    {}
+
+    gethSFR->MAC_TIMESTAMP_ADDEND.U           = addend;
+    gethSFR->MAC_TIMESTAMP_CONTROL.B.TSADDREG = 1;
+}
+
+
+void IfxGeth_mac_getSystemTime(Ifx_GETH *gethSFR, uint32 *seconds, uint32 *nanoseconds)
+{
+    uint32 before;
+
+    /* read the seconds again, the nanoseconds may have rolled over in between */
+    do
+    {
+        before       = gethSFR->MAC_SYSTEM_TIME_SECONDS.U;
+        *nanoseconds = gethSFR->MAC_SYSTEM_TIME_NANOSECONDS.B.TSSS;
+        *seconds     = gethSFR->MAC_SYSTEM_TIME_SECONDS.U;
+    } while (before != *seconds);
+}
+
+
+void IfxGeth_mac_updateSystemTime(Ifx_GETH *gethSFR, boolean subtract, uint32 seconds, uint32 nanoseconds)
+{
+    Ifx_GETH_MAC_SYSTEM_TIME_NANOSECONDS_UPDATE update;
+
+    // Wait until a previous update is finished
+    while (gethSFR->MAC_TIMESTAMP_CONTROL.B.TSUPDT)
+    {}
+
+    /* a subtraction takes the complement of the seconds to 2^32 and, with
+     * digital rollover, of the nanoseconds to 10^9 */
+    update.U          = 0;
+    update.B.TSSS     = (subtract != FALSE) ? (1000000000U - nanoseconds) : nanoseconds;
+    update.B.ADDSUB   = (subtract != FALSE) ? 1 : 0;
+
+    gethSFR->MAC_SYSTEM_TIME_SECONDS_UPDATE.U     = (subtract != FALSE) ? (0U - seconds) : seconds;
+    gethSFR->MAC_SYSTEM_TIME_NANOSECONDS_UPDATE.U = update.U;
+    gethSFR->MAC_TIMESTAMP_CONTROL.B.TSUPDT       = 1;
+
+    // Wait until operation is finished
+    while (gethSFR->MAC_TIMESTAMP_CONTROL.B.TSUPDT)
+    {}
+}
@@ -742,6 +742,13 @@ IFX_INLINE void IfxGeth_mac_setAllMulticastPassing(Ifx_GETH *gethSFR, boolean en
  */
 IFX_INLINE void IfxGeth_mac_setCrcChecking(Ifx_GETH *gethSFR, boolean enabled);
 
+/** \brief Enables / Disables the Checksum Offload of received IPv4 headers and TCP, UDP or ICMP payloads
+ * \param gethSFR Pointer to GETH register base address
+ * \param enabled Checksum Offload enable / disable
+ * \return None
+ */
+IFX_INLINE void IfxGeth_mac_setChecksumOffload(Ifx_GETH *gethSFR, boolean enabled);
+
 /** \brief Enables/Disables the Automatic Pad or CRC Stripping for frames less than 1536 bytes and \n
  *     CRC stripping for Type packets
  * \param gethSFR Pointer to GETH register base address
@@ -821,6 +828,40 @@ IFX_EXTERN boolean IfxGeth_mac_writeQueueVlanTag(Ifx_GETH *gethSFR, IfxGeth_MtlQ
  */
 IFX_EXTERN boolean IfxGeth_mac_readQueueVlanTag(Ifx_GETH *gethSFR, IfxGeth_MtlQueue queueId, uint16 *const vLanTag);
 
+/** \brief Starts the system time at 0 and enables the timestamps of received PTPv2 over UDP/IPv4 messages
+ * The time runs in fine update mode with digital rollover: every clock cycle the addend is added to a 32 bit
+ * accumulator, and every overflow advances the nanoseconds by the sub-second increment
+ * \param gethSFR Pointer to GETH register base address
+ * \param subSecondIncrement Nanoseconds added per accumulator overflow
+ * \param addend Timestamp addend, 2^32 * 10^9 / (subSecondIncrement * clock frequency) for a nominal rate
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_mac_initSystemTime(Ifx_GETH *gethSFR, uint8 subSecondIncrement, uint32 addend);
+
+/** \brief Sets the Timestamp addend, which adjusts the rate of the system time
+ * \param gethSFR Pointer to GETH register base address
+ * \param addend Timestamp addend
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_mac_setTimestampAddend(Ifx_GETH *gethSFR, uint32 addend);
+
+/** \brief Reads the system time
+ * \param gethSFR Pointer to GETH register base address
+ * \param seconds Seconds of the system time
+ * \param nanoseconds Nanoseconds of the system time
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_mac_getSystemTime(Ifx_GETH *gethSFR, uint32 *seconds, uint32 *nanoseconds);
+
+/** \brief Adds an offset to or subtracts it from the system time
+ * \param gethSFR Pointer to GETH register base address
+ * \param subtract TRUE to subtract the offset
+ * \param seconds Seconds of the offset
+ * \param nanoseconds Nanoseconds of the offset, less than 10^9
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_mac_updateSystemTime(Ifx_GETH *gethSFR, boolean subtract, uint32 seconds, uint32 nanoseconds);
+
 /** \} */
 
 /** \addtogroup IfxLld_Geth_Std_Module_Functions
@@ -1070,6 +1111,18 @@ IFX_EXTERN void IfxGeth_mtl_setTxQueueSize(Ifx_GETH *gethSFR, IfxGeth_TxMtlQueue
  */
 IFX_EXTERN void IfxGeth_mtl_setTxStoreAndForward(Ifx_GETH *gethSFR, IfxGeth_TxMtlQueue queueId, boolean enabled);
 
+/** \brief Enables the credit based shaper (AV algorithm) of the selected TX Queue\n
+ * Queue 0 has no shaper and is left unchanged.
+ * \param gethSFR Pointer to GETH register base address
+ * \param queueId Tx Queue Index
+ * \param idleSlope idleSlopeCredit, MTL_TXQi_QUANTUM_WEIGHT.ISCQW
+ * \param sendSlope sendSlopeCredit, MTL_TXQi_SENDSLOPECREDIT.SSC
+ * \param hiCredit hiCredit, MTL_TXQi_HICREDIT.HC
+ * \param loCredit loCredit, MTL_TXQi_LOCREDIT.LC
+ * \return None
+ */
+IFX_EXTERN void IfxGeth_mtl_setTxCreditBasedShaper(Ifx_GETH *gethSFR, IfxGeth_TxMtlQueue queueId, uint32 idleSlope, uint32 sendSlope, uint32 hiCredit, uint32 loCredit);
+
 /** \} */
 
 /** \addtogroup IfxLld_Geth_Std_DMA_Functions
@@ -1485,6 +1538,12 @@ IFX_INLINE void IfxGeth_mac_setCrcChecking(Ifx_GETH *gethSFR, boolean enabled)
 }
 
 
+IFX_INLINE void IfxGeth_mac_setChecksumOffload(Ifx_GETH *gethSFR, boolean enabled)
+{
+    gethSFR->MAC_CONFIGURATION.B.IPC = ((enabled == 1) ? 1 : 0);
+}
+
+
 IFX_INLINE void IfxGeth_mac_setCrcStripping(Ifx_GETH *gethSFR, boolean acsEnabled, boolean cstEnabled)
 {
     gethSFR->MAC_CONFIGURATION.B.ACS = ((acsEnabled == 1) ? 1 : 0);
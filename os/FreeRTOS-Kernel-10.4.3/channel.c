@@ -0,0 +1,491 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "channel.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include channel functionality.  This #if is closed at the very bottom of
+ * this file.  If you want to include channels then ensure configUSE_CHANNELS
+ * is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_CHANNELS == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build channel.c
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build channel.c
+    #endif
+
+/*
+ * The producer and the consumer run on the same core, so the order in which
+ * the indices and the items are accessed only has to be kept by the compiler.
+ * The head and tail indices run freely and wrap with the unsigned type, which
+ * is why the length must be a power of two.
+ */
+typedef struct ChannelDef_t
+{
+    volatile UBaseType_t uxHead;           /*< Number of items posted, only written by the producer. */
+    volatile UBaseType_t uxTail;           /*< Number of items drained, only written by the consumer. */
+    volatile BaseType_t xConsumerBlocked;  /*< pdTRUE while the consumer is about to block or blocked. */
+    volatile UBaseType_t uxOverruns;       /*< Items dropped because the channel was full, only written by the producer. */
+    TaskHandle_t volatile xConsumer;       /*< The task that last blocked on the channel. */
+    uint8_t * pucStorage;                  /*< uxLength items of uxItemSize bytes. */
+    UBaseType_t uxLength;                  /*< Number of items the channel holds, a power of two. */
+    UBaseType_t uxItemSize;                /*< Size of each item in bytes. */
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the channel is statically allocated to ensure no attempt is made to free the memory. */
+    #endif
+} Channel_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Fill in a newly allocated channel structure.
+ */
+static void prvInitialiseNewChannel( Channel_t * const pxChannel,
+                                     UBaseType_t uxLength,
+                                     UBaseType_t uxItemSize,
+                                     uint8_t * pucChannelStorage ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy an item into the channel and publish it.  Only called by the producer.
+ */
+static BaseType_t prvPostItem( Channel_t * const pxChannel,
+                               const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the consumer if it announced that it blocks, clearing the
+ * announcement, or NULL.  Only called by the producer after prvPostItem().
+ */
+static TaskHandle_t prvTakeBlockedConsumer( Channel_t * const pxChannel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy up to uxMaxItems items out of the channel with at most two memcpy()
+ * calls and release their slots.  Only called by the consumer.
+ */
+static UBaseType_t prvDrainItems( Channel_t * const pxChannel,
+                                  void * pvBuffer,
+                                  UBaseType_t uxMaxItems ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    ChannelHandle_t xChannelCreateStatic( UBaseType_t uxLength,
+                                          UBaseType_t uxItemSize,
+                                          uint8_t * pucChannelStorage,
+                                          StaticChannel_t * pxStaticChannel )
+    {
+        Channel_t * pxChannel;
+
+        configASSERT( pxStaticChannel );
+        configASSERT( pucChannelStorage );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticChannel_t equals the size of the real
+                 * channel structure. */
+                volatile size_t xSize = sizeof( StaticChannel_t );
+                configASSERT( xSize == sizeof( Channel_t ) );
+            } /*lint !e529 xSize is referenced if configASSERT() is defined. */
+        #endif /* configASSERT_DEFINED */
+
+        pxChannel = ( Channel_t * ) pxStaticChannel; /*lint !e740 !e9087 Channel_t and StaticChannel_t are deliberately aliased for data hiding purposes. */
+
+        if( pxChannel != NULL )
+        {
+            prvInitialiseNewChannel( pxChannel, uxLength, uxItemSize, pucChannelStorage );
+
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    pxChannel->ucStaticallyAllocated = pdTRUE;
+                }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxChannel;
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    ChannelHandle_t xChannelCreate( UBaseType_t uxLength,
+                                    UBaseType_t uxItemSize )
+    {
+        Channel_t * pxChannel;
+
+        /* The storage area follows the structure in the same allocation. */
+        pxChannel = ( Channel_t * ) pvPortMalloc( sizeof( Channel_t ) + ( ( size_t ) uxLength * ( size_t ) uxItemSize ) ); /*lint !e9087 !e9079 pvPortMalloc() returns memory aligned for any kernel structure. */
+
+        if( pxChannel != NULL )
+        {
+            prvInitialiseNewChannel( pxChannel, uxLength, uxItemSize, ( ( uint8_t * ) pxChannel ) + sizeof( Channel_t ) );
+
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    pxChannel->ucStaticallyAllocated = pdFALSE;
+                }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxChannel;
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewChannel( Channel_t * const pxChannel,
+                                     UBaseType_t uxLength,
+                                     UBaseType_t uxItemSize,
+                                     uint8_t * pucChannelStorage )
+{
+    /* The length must be a non zero power of two. */
+    configASSERT( uxLength > ( UBaseType_t ) 0 );
+    configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+    configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+    pxChannel->uxHead = ( UBaseType_t ) 0;
+    pxChannel->uxTail = ( UBaseType_t ) 0;
+    pxChannel->xConsumerBlocked = pdFALSE;
+    pxChannel->uxOverruns = ( UBaseType_t ) 0;
+    pxChannel->xConsumer = NULL;
+    pxChannel->pucStorage = pucChannelStorage;
+    pxChannel->uxLength = uxLength;
+    pxChannel->uxItemSize = uxItemSize;
+}
+/*-----------------------------------------------------------*/
+
+void vChannelDelete( ChannelHandle_t xChannel )
+{
+    Channel_t * pxChannel = xChannel;
+
+    configASSERT( pxChannel );
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            vPortFree( pxChannel );
+        }
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            if( pxChannel->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxChannel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPostItem( Channel_t * const pxChannel,
+                               const void * pvItem )
+{
+    const UBaseType_t uxHead = pxChannel->uxHead;
+    BaseType_t xReturn;
+
+    if( ( uxHead - pxChannel->uxTail ) < pxChannel->uxLength )
+    {
+        ( void ) memcpy( ( void * ) &( pxChannel->pucStorage[ ( uxHead & ( pxChannel->uxLength - ( UBaseType_t ) 1 ) ) * pxChannel->uxItemSize ] ), pvItem, ( size_t ) pxChannel->uxItemSize ); /*lint !e9087 Cast to void required by function signature. */
+
+        /* The item must be complete before the head index makes it visible. */
+        portMEMORY_BARRIER();
+        pxChannel->uxHead = uxHead + ( UBaseType_t ) 1;
+        xReturn = pdPASS;
+    }
+    else
+    {
+        pxChannel->uxOverruns++;
+        xReturn = errQUEUE_FULL;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t prvTakeBlockedConsumer( Channel_t * const pxChannel )
+{
+    TaskHandle_t xReturn = NULL;
+
+    /* The head index must be written before the flag is read, the consumer
+     * sets the flag before it reads the head index.  One of the two therefore
+     * sees the other, and a wakeup cannot be lost. */
+    portMEMORY_BARRIER();
+
+    if( pxChannel->xConsumerBlocked != pdFALSE )
+    {
+        pxChannel->xConsumerBlocked = pdFALSE;
+        xReturn = pxChannel->xConsumer;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xChannelSendFromISR( ChannelHandle_t xChannel,
+                                const void * pvItem,
+                                BaseType_t * pxHigherPriorityTaskWoken )
+{
+    Channel_t * const pxChannel = xChannel;
+    TaskHandle_t xConsumer;
+    BaseType_t xReturn;
+
+    configASSERT( pxChannel );
+    configASSERT( pvItem );
+
+    xReturn = prvPostItem( pxChannel, pvItem );
+
+    if( xReturn == pdPASS )
+    {
+        xConsumer = prvTakeBlockedConsumer( pxChannel );
+
+        if( xConsumer != NULL )
+        {
+            vTaskGenericNotifyGiveFromISR( xConsumer, configCHANNEL_NOTIFICATION_INDEX, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xChannelSend( ChannelHandle_t xChannel,
+                         const void * pvItem )
+{
+    Channel_t * const pxChannel = xChannel;
+    TaskHandle_t xConsumer;
+    BaseType_t xReturn;
+
+    configASSERT( pxChannel );
+    configASSERT( pvItem );
+
+    xReturn = prvPostItem( pxChannel, pvItem );
+
+    if( xReturn == pdPASS )
+    {
+        xConsumer = prvTakeBlockedConsumer( pxChannel );
+
+        if( xConsumer != NULL )
+        {
+            /* Yields if the consumer has the higher priority. */
+            ( void ) xTaskGenericNotify( xConsumer, configCHANNEL_NOTIFICATION_INDEX, 0, eIncrement, NULL );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvDrainItems( Channel_t * const pxChannel,
+                                  void * pvBuffer,
+                                  UBaseType_t uxMaxItems )
+{
+    const UBaseType_t uxTail = pxChannel->uxTail;
+    const UBaseType_t uxItemSize = pxChannel->uxItemSize;
+    UBaseType_t uxCount, uxFirst, uxSlot;
+
+    uxCount = pxChannel->uxHead - uxTail;
+
+    /* The head index must be read before the items it covers. */
+    portMEMORY_BARRIER();
+
+    if( uxCount > uxMaxItems )
+    {
+        uxCount = uxMaxItems;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( uxCount > ( UBaseType_t ) 0 )
+    {
+        uxSlot = uxTail & ( pxChannel->uxLength - ( UBaseType_t ) 1 );
+        uxFirst = pxChannel->uxLength - uxSlot;
+
+        if( uxFirst > uxCount )
+        {
+            uxFirst = uxCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( pvBuffer, ( const void * ) &( pxChannel->pucStorage[ uxSlot * uxItemSize ] ), ( size_t ) ( uxFirst * uxItemSize ) );
+
+        if( uxFirst < uxCount )
+        {
+            /* The block wraps around the end of the storage area. */
+            ( void ) memcpy( ( void * ) &( ( ( uint8_t * ) pvBuffer )[ uxFirst * uxItemSize ] ), ( const void * ) pxChannel->pucStorage, ( size_t ) ( ( uxCount - uxFirst ) * uxItemSize ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The items must be copied out before their slots are released. */
+        portMEMORY_BARRIER();
+        pxChannel->uxTail = uxTail + uxCount;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxChannelReceive( ChannelHandle_t xChannel,
+                              void * pvBuffer,
+                              UBaseType_t uxMaxItems,
+                              TickType_t xTicksToWait )
+{
+    Channel_t * const pxChannel = xChannel;
+    TimeOut_t xTimeOut;
+    UBaseType_t uxReceived;
+
+    configASSERT( pxChannel );
+    configASSERT( pvBuffer );
+    configASSERT( uxMaxItems > ( UBaseType_t ) 0 );
+
+    vTaskSetTimeOutState( &xTimeOut );
+
+    for( ; ; )
+    {
+        uxReceived = prvDrainItems( pxChannel, pvBuffer, uxMaxItems );
+
+        if( ( uxReceived > ( UBaseType_t ) 0 ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+        {
+            break;
+        }
+        else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+        {
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Announce the block, then look at the head index once more: an item
+         * posted before the producer could see the flag is found here, any
+         * later item comes with a notification. */
+        pxChannel->xConsumer = xTaskGetCurrentTaskHandle();
+        pxChannel->xConsumerBlocked = pdTRUE;
+        portMEMORY_BARRIER();
+
+        if( pxChannel->uxHead == pxChannel->uxTail )
+        {
+            /* A notification left over from an earlier wakeup only causes one
+             * extra pass round the loop. */
+            ( void ) ulTaskGenericNotifyTake( configCHANNEL_NOTIFICATION_INDEX, pdTRUE, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxChannel->xConsumerBlocked = pdFALSE;
+    }
+
+    return uxReceived;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxChannelItemsWaiting( ChannelHandle_t xChannel )
+{
+    configASSERT( xChannel );
+
+    return xChannel->uxHead - xChannel->uxTail;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxChannelGetOverruns( ChannelHandle_t xChannel )
+{
+    configASSERT( xChannel );
+
+    return xChannel->uxOverruns;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include channel functionality.  If you want to include channels then
+ * ensure configUSE_CHANNELS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_CHANNELS == 1 */
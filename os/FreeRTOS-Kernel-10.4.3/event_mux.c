@@ -0,0 +1,469 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_mux.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include event multiplexer functionality.  This #if is closed at the very
+ * bottom of this file.  If you want to include event multiplexers then ensure
+ * configUSE_EVENT_MUX is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_EVENT_MUX == 1 )
+
+typedef struct EventMuxDef_t
+{
+    List_t xReadySources; /*< Sources that became ready and have not yet been returned by uxEventMuxWait(), in the order in which they became ready. */
+    List_t xTasksWaiting; /*< The task blocked in uxEventMuxWait(). */
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the multiplexer is statically allocated to ensure no attempt is made to free the memory. */
+    #endif
+} EventMux_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Unlink up to uxMaxSources ready sources into ppxReadySources.  Level
+ * triggered sources whose object still holds data are linked again at the end
+ * of the ready list.  Must be called from a critical section.
+ */
+static UBaseType_t prvCollectReadySources( EventMux_t * const pxEventMux,
+                                           EventMuxSource_t ** ppxReadySources,
+                                           UBaseType_t uxMaxSources ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    EventMuxHandle_t xEventMuxCreateStatic( StaticEventMux_t * pxEventMuxBuffer )
+    {
+        EventMux_t * pxEventMux;
+
+        /* A StaticEventMux_t object must be provided. */
+        configASSERT( pxEventMuxBuffer );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticEventMux_t equals the size of the real
+                 * multiplexer structure. */
+                volatile size_t xSize = sizeof( StaticEventMux_t );
+                configASSERT( xSize == sizeof( EventMux_t ) );
+            } /*lint !e529 xSize is referenced if configASSERT() is defined. */
+        #endif /* configASSERT_DEFINED */
+
+        pxEventMux = ( EventMux_t * ) pxEventMuxBuffer; /*lint !e740 !e9087 EventMux_t and StaticEventMux_t are deliberately aliased for data hiding purposes. */
+
+        if( pxEventMux != NULL )
+        {
+            vListInitialise( &( pxEventMux->xReadySources ) );
+            vListInitialise( &( pxEventMux->xTasksWaiting ) );
+
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    pxEventMux->ucStaticallyAllocated = pdTRUE;
+                }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxEventMux;
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    EventMuxHandle_t xEventMuxCreate( void )
+    {
+        EventMux_t * pxEventMux;
+
+        pxEventMux = ( EventMux_t * ) pvPortMalloc( sizeof( EventMux_t ) ); /*lint !e9087 !e9079 pvPortMalloc() returns memory aligned for any kernel structure. */
+
+        if( pxEventMux != NULL )
+        {
+            vListInitialise( &( pxEventMux->xReadySources ) );
+            vListInitialise( &( pxEventMux->xTasksWaiting ) );
+
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    pxEventMux->ucStaticallyAllocated = pdFALSE;
+                }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxEventMux;
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vEventMuxDelete( EventMuxHandle_t xEventMux )
+{
+    EventMux_t * pxEventMux = xEventMux;
+
+    configASSERT( pxEventMux );
+    configASSERT( listLIST_IS_EMPTY( &( pxEventMux->xTasksWaiting ) ) != pdFALSE );
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            vPortFree( pxEventMux );
+        }
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            if( pxEventMux->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxEventMux );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEventMuxInternalAdd( EventMuxHandle_t xEventMux,
+                                 EventMuxSource_t * pxSource,
+                                 void * pvObject,
+                                 EventMuxSource_t * volatile * ppxObjectLink,
+                                 EventMuxReadyFunction_t pxIsReady,
+                                 eEventMuxTrigger eTrigger,
+                                 void * pvUserData )
+{
+    EventMux_t * pxEventMux = xEventMux;
+    BaseType_t xReturn;
+
+    configASSERT( pxEventMux );
+    configASSERT( pxSource );
+
+    taskENTER_CRITICAL();
+    {
+        if( ( ppxObjectLink != NULL ) && ( *ppxObjectLink != NULL ) )
+        {
+            /* The object already belongs to a multiplexer. */
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            vListInitialiseItem( &( pxSource->xReadyListItem ) );
+            listSET_LIST_ITEM_OWNER( &( pxSource->xReadyListItem ), pxSource );
+            pxSource->pxMux = pxEventMux;
+            pxSource->pvObject = pvObject;
+            pxSource->ppxObjectLink = ppxObjectLink;
+            pxSource->pxIsReady = pxIsReady;
+            pxSource->pvUserData = pvUserData;
+            pxSource->eTrigger = ( pxIsReady != NULL ) ? eTrigger : eEventMuxEdge;
+
+            if( ppxObjectLink != NULL )
+            {
+                *ppxObjectLink = pxSource;
+            }
+
+            /* An object that already holds data is ready straight away, as no
+             * further transition may ever happen. */
+            if( ( pxIsReady != NULL ) && ( pxIsReady( pvObject ) != pdFALSE ) )
+            {
+                if( xEventMuxInternalSignal( pxSource ) != pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEventMuxAddSignal( EventMuxHandle_t xEventMux,
+                               EventMuxSource_t * pxSource,
+                               void * pvUserData )
+{
+    return xEventMuxInternalAdd( xEventMux, pxSource, NULL, NULL, NULL, eEventMuxEdge, pvUserData );
+}
+/*-----------------------------------------------------------*/
+
+void vEventMuxRemove( EventMuxSource_t * pxSource )
+{
+    configASSERT( pxSource );
+
+    taskENTER_CRITICAL();
+    {
+        if( listLIST_ITEM_CONTAINER( &( pxSource->xReadyListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxSource->xReadyListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxSource->ppxObjectLink != NULL )
+        {
+            *( pxSource->ppxObjectLink ) = NULL;
+            pxSource->ppxObjectLink = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxSource->pxMux = NULL;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEventMuxInternalSignal( EventMuxSource_t * pxSource )
+{
+    EventMux_t * const pxEventMux = pxSource->pxMux;
+    BaseType_t xReturn = pdFALSE;
+
+    /* A source that is already on the ready list has nothing more to report,
+     * and the waiting task was woken when it was linked. */
+    if( ( pxEventMux != NULL ) && ( listLIST_ITEM_CONTAINER( &( pxSource->xReadyListItem ) ) == NULL ) )
+    {
+        vListInsertEnd( &( pxEventMux->xReadySources ), &( pxSource->xReadyListItem ) );
+
+        if( listLIST_IS_EMPTY( &( pxEventMux->xTasksWaiting ) ) == pdFALSE )
+        {
+            xReturn = xTaskRemoveFromEventList( &( pxEventMux->xTasksWaiting ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vEventMuxSignal( EventMuxSource_t * pxSource )
+{
+    configASSERT( pxSource );
+
+    taskENTER_CRITICAL();
+    {
+        if( xEventMuxInternalSignal( pxSource ) != pdFALSE )
+        {
+            /* Yes it is ok to do this from within the critical section - the
+             * kernel takes care of that. */
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEventMuxSignalFromISR( EventMuxSource_t * pxSource,
+                                   BaseType_t * pxHigherPriorityTaskWoken )
+{
+    UBaseType_t uxSavedInterruptStatus;
+    BaseType_t xReturn;
+
+    configASSERT( pxSource );
+
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xReturn = ( listLIST_ITEM_CONTAINER( &( pxSource->xReadyListItem ) ) == NULL ) ? pdTRUE : pdFALSE;
+
+        if( xEventMuxInternalSignal( pxSource ) != pdFALSE )
+        {
+            if( pxHigherPriorityTaskWoken != NULL )
+            {
+                *pxHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvCollectReadySources( EventMux_t * const pxEventMux,
+                                           EventMuxSource_t ** ppxReadySources,
+                                           UBaseType_t uxMaxSources )
+{
+    UBaseType_t uxPending = listCURRENT_LIST_LENGTH( &( pxEventMux->xReadySources ) );
+    UBaseType_t uxCount = 0;
+    EventMuxSource_t * pxSource;
+
+    /* Only the sources present on entry are visited, so a level triggered
+     * source that is linked again is not reported twice. */
+    while( ( uxPending > ( UBaseType_t ) 0 ) && ( uxCount < uxMaxSources ) )
+    {
+        uxPending--;
+
+        pxSource = ( EventMuxSource_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxEventMux->xReadySources ) ); /*lint !e9079 void * is used as the list owner type. */
+        ( void ) uxListRemove( &( pxSource->xReadyListItem ) );
+
+        if( pxSource->eTrigger == eEventMuxEdge )
+        {
+            ppxReadySources[ uxCount ] = pxSource;
+            uxCount++;
+        }
+        else if( pxSource->pxIsReady( pxSource->pvObject ) != pdFALSE )
+        {
+            ppxReadySources[ uxCount ] = pxSource;
+            uxCount++;
+            vListInsertEnd( &( pxEventMux->xReadySources ), &( pxSource->xReadyListItem ) );
+        }
+        else
+        {
+            /* The level triggered source was drained since it was last
+             * reported; the next send links it again. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxEventMuxWait( EventMuxHandle_t xEventMux,
+                            EventMuxSource_t ** ppxReadySources,
+                            UBaseType_t uxMaxSources,
+                            TickType_t xTicksToWait )
+{
+    EventMux_t * const pxEventMux = xEventMux;
+    UBaseType_t uxCount;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    configASSERT( pxEventMux );
+    configASSERT( ppxReadySources );
+    configASSERT( uxMaxSources > ( UBaseType_t ) 0 );
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+    #endif
+
+    /*lint -save -e904 This function relaxes the coding standard somewhat to
+     * allow return statements within the function itself.  This is done in the
+     * interest of execution time efficiency. */
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            uxCount = prvCollectReadySources( pxEventMux, ppxReadySources, uxMaxSources );
+
+            if( ( uxCount > ( UBaseType_t ) 0 ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+            {
+                taskEXIT_CRITICAL();
+                return uxCount;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                taskEXIT_CRITICAL();
+                return ( UBaseType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Nothing is ready.  Every signal that links a source onto the
+             * empty ready list also unblocks this task. */
+            vTaskPlaceOnEventList( &( pxEventMux->xTasksWaiting ), xTicksToWait );
+
+            /* All ports are written to allow a yield in a critical section
+             * (some will yield immediately, others wait until the critical
+             * section exits) - but it is not something that application code
+             * should ever do. */
+            portYIELD_WITHIN_API();
+        }
+        taskEXIT_CRITICAL();
+    } /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include event multiplexer functionality.  If you want to include event
+ * multiplexers then ensure configUSE_EVENT_MUX is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_EVENT_MUX == 1 */
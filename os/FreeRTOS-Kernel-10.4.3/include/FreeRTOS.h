@@ -283,6 +283,21 @@
     #define portSOFTWARE_BARRIER()
 #endif
 
+/* Orders memory accesses as seen by the other cores.  Used by the lock free
+ * task snapshot tables. */
+#ifndef portDATA_SYNC_BARRIER
+    #define portDATA_SYNC_BARRIER()    portMEMORY_BARRIER()
+#endif
+
+/* Used to keep data written by different cores on different cache lines. */
+#ifndef portCACHE_LINE_SIZE
+    #define portCACHE_LINE_SIZE    32
+#endif
+
+#ifndef portCACHE_ALIGNED
+    #define portCACHE_ALIGNED
+#endif
+
 /* The timers module relies on xTaskGetSchedulerState(). */
 #if configUSE_TIMERS == 1
 
@@ -356,6 +371,17 @@
     #define traceTASK_SWITCHED_IN()
 #endif
 
+#ifndef traceISR_ENTER
+
+/* Called on entry to, and just before the return from, the interrupts owned by
+ * the port (the tick and the partition windows). */
+    #define traceISR_ENTER()
+#endif
+
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT()
+#endif
+
 #ifndef traceINCREASE_TICK_COUNT
 
 /* Called before stepping the tick count after waking from tickless idle
@@ -564,6 +590,14 @@
     #define traceTASK_DELAY()
 #endif
 
+#ifndef traceTASK_PERIODIC_OVERRUN
+    #define traceTASK_PERIODIC_OVERRUN( pxTask )
+#endif
+
+#ifndef traceTASK_PARTITION_SWITCH
+    #define traceTASK_PARTITION_SWITCH( uxOldPartition, uxNewPartition )
+#endif
+
 #ifndef traceTASK_PRIORITY_SET
     #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
 #endif
@@ -882,6 +916,62 @@
     #define configUSE_POSIX_ERRNO    0
 #endif
 
+#ifndef configUSE_EVENT_MUX
+    #define configUSE_EVENT_MUX    0
+#endif
+
+#ifndef configUSE_MESSAGE_POOLS
+    #define configUSE_MESSAGE_POOLS    0
+#endif
+
+#ifndef configUSE_CHANNELS
+    #define configUSE_CHANNELS    0
+#endif
+
+#ifndef configCHANNEL_NOTIFICATION_INDEX
+    #define configCHANNEL_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_RWLOCKS
+    #define configUSE_RWLOCKS    0
+#endif
+
+#ifndef configRWLOCK_SPIN_COUNT
+    #define configRWLOCK_SPIN_COUNT    64
+#endif
+
+#ifndef configUSE_RCU
+    #define configUSE_RCU    0
+#endif
+
+#ifndef configUSE_PERIODIC_TASKS
+    #define configUSE_PERIODIC_TASKS    0
+#endif
+
+#ifndef configPERIODIC_MAX_PERIODS
+    #define configPERIODIC_MAX_PERIODS    4
+#endif
+
+#ifndef configUSE_PARTITIONS
+    #define configUSE_PARTITIONS    0
+#endif
+
+#ifndef configNUM_PARTITIONS
+    #define configNUM_PARTITIONS    4
+#endif
+
+#ifndef configUSE_TASK_SNAPSHOT
+    #define configUSE_TASK_SNAPSHOT    0
+#endif
+
+#ifndef configTASK_SNAPSHOT_MAX_TASKS
+    #define configTASK_SNAPSHOT_MAX_TASKS    8
+#endif
+
+#ifndef configTASK_SNAPSHOT_READ_RETRIES
+    #define configTASK_SNAPSHOT_READ_RETRIES    16
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
     #define portTICK_TYPE_IS_ATOMIC    0
 #endif
@@ -926,6 +1016,16 @@
     #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if ( configUSE_PARTITIONS == 1 )
+    #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION must be set to 0 to use partitions, each partition keeps its own ready lists
+    #endif
+
+    #if ( configNUM_PARTITIONS < 1 )
+        #error configNUM_PARTITIONS must be at least 1
+    #endif
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -1209,6 +1309,16 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configUSE_TASK_SNAPSHOT == 1 )
+        UBaseType_t uxDummy23;
+    #endif
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        void * pvDummy24;
+        uint32_t ulDummy25[ 2 ];
+    #endif
+    #if ( configUSE_PARTITIONS == 1 )
+        UBaseType_t uxDummy26;
+    #endif
 } StaticTask_t;
 
 /*
@@ -1247,6 +1357,10 @@ typedef struct xSTATIC_QUEUE
         void * pvDummy7;
     #endif
 
+    #if ( configUSE_EVENT_MUX == 1 )
+        void * pvDummy10;
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
@@ -1331,11 +1445,77 @@ typedef struct xSTATIC_STREAM_BUFFER
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy4;
     #endif
+    #if ( configUSE_EVENT_MUX == 1 )
+        void * pvDummy5;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the event multiplexer structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create an event multiplexer then the size of the object needs to be know.
+ * The StaticEventMux_t structure below is provided for this purpose.  Its sizes
+ * and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_EVENT_MUX
+{
+    StaticList_t xDummy1[ 2 ];
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy2;
+    #endif
+} StaticEventMux_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the message pool structure used internally by FreeRTOS
+ * is not accessible to application code.  The StaticMessagePool_t structure
+ * below is provided so a pool can be statically allocated.  Its size and
+ * alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.
+ */
+typedef struct xSTATIC_MESSAGE_POOL
+{
+    void * pvDummy1[ 2 ];
+    size_t xDummy2;
+    UBaseType_t uxDummy3[ 2 ];
+    BaseType_t xDummy4;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy5;
+    #endif
+} StaticMessagePool_t;
+
+/*
+ * The StaticChannel_t structure below is provided so a channel can be
+ * statically allocated.  Its size and alignment requirements are guaranteed to
+ * match those of the genuine structure, which is hidden from application code
+ * like every other kernel object.
+ */
+typedef struct xSTATIC_CHANNEL
+{
+    UBaseType_t uxDummy1[ 2 ];
+    BaseType_t xDummy2;
+    UBaseType_t uxDummy3;
+    void * pvDummy4[ 2 ];
+    UBaseType_t uxDummy5[ 2 ];
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy6;
+    #endif
+} StaticChannel_t;
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
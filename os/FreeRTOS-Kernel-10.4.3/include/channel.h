@@ -0,0 +1,199 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include channel.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A channel is a single producer, single consumer ring of fixed size items
+ * meant to carry data from one interrupt to one task.
+ *
+ * The data path takes no lock and never masks interrupts: the producer only
+ * writes the head index and the consumer only writes the tail index, each after
+ * the item itself has been written or read.  The consumer task announces that
+ * it is about to block by setting a flag, and the producer only calls
+ * vTaskNotifyGiveFromISR() when it finds the flag set, so an interrupt that
+ * posts to a consumer that is busy draining costs a copy and two stores.
+ *
+ * Only one interrupt (or task) may send to a channel and only one task may
+ * receive from it.  The wakeup uses a direct to task notification, so the
+ * producer must run on the core of the consumer task; the index of the
+ * notification used is configCHANNEL_NOTIFICATION_INDEX.
+ * configUSE_CHANNELS must be set to 1 in FreeRTOSConfig.h for this
+ * functionality to be available.
+ *
+ * \defgroup Channel
+ */
+
+/**
+ * channel.h
+ *
+ * Type by which channels are referenced.
+ *
+ * \defgroup ChannelHandle_t ChannelHandle_t
+ * \ingroup Channel
+ */
+struct ChannelDef_t;
+typedef struct ChannelDef_t * ChannelHandle_t;
+
+/**
+ * channel.h
+ * <pre>
+ * ChannelHandle_t xChannelCreate( UBaseType_t uxLength,
+ *                                 UBaseType_t uxItemSize );
+ * ChannelHandle_t xChannelCreateStatic( UBaseType_t uxLength,
+ *                                       UBaseType_t uxItemSize,
+ *                                       uint8_t *pucChannelStorage,
+ *                                       StaticChannel_t *pxStaticChannel );
+ * </pre>
+ *
+ * Create a channel that holds up to uxLength items of uxItemSize bytes.
+ * uxLength must be a power of two.  The static variant takes storage of
+ * uxLength * uxItemSize bytes.
+ *
+ * @return The handle of the channel, or NULL if it could not be created.
+ *
+ * \defgroup xChannelCreate xChannelCreate
+ * \ingroup Channel
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    ChannelHandle_t xChannelCreate( UBaseType_t uxLength,
+                                    UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    ChannelHandle_t xChannelCreateStatic( UBaseType_t uxLength,
+                                          UBaseType_t uxItemSize,
+                                          uint8_t * pucChannelStorage,
+                                          StaticChannel_t * pxStaticChannel ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * channel.h
+ * <pre>
+ * void vChannelDelete( ChannelHandle_t xChannel );
+ * </pre>
+ *
+ * Delete a channel.  Neither side may use it any more.
+ *
+ * \defgroup vChannelDelete vChannelDelete
+ * \ingroup Channel
+ */
+void vChannelDelete( ChannelHandle_t xChannel ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel.h
+ * <pre>
+ * BaseType_t xChannelSendFromISR( ChannelHandle_t xChannel,
+ *                                 const void *pvItem,
+ *                                 BaseType_t *pxHigherPriorityTaskWoken );
+ * BaseType_t xChannelSend( ChannelHandle_t xChannel,
+ *                          const void *pvItem );
+ * </pre>
+ *
+ * Post one item.  Neither function blocks; when the channel is full the item
+ * is dropped and counted, see uxChannelGetOverruns().  xChannelSend() is for
+ * a producer that is a task and yields itself when the consumer is woken.
+ *
+ * @return pdPASS if the item was posted, errQUEUE_FULL if it was dropped.
+ *
+ * \defgroup xChannelSendFromISR xChannelSendFromISR
+ * \ingroup Channel
+ */
+BaseType_t xChannelSendFromISR( ChannelHandle_t xChannel,
+                                const void * pvItem,
+                                BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+BaseType_t xChannelSend( ChannelHandle_t xChannel,
+                         const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel.h
+ * <pre>
+ * UBaseType_t uxChannelReceive( ChannelHandle_t xChannel,
+ *                               void *pvBuffer,
+ *                               UBaseType_t uxMaxItems,
+ *                               TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Drain up to uxMaxItems items into pvBuffer, which must have room for that
+ * many items.  If the channel is empty the calling task blocks for up to
+ * xTicksToWait until at least one item arrives.
+ *
+ * @return The number of items received, zero if the call timed out.
+ *
+ * Example usage:
+ * <pre>
+ * void vFilterTask( void *pvParameters )
+ * {
+ * int16_t sSamples[ 32 ];
+ * UBaseType_t uxCount;
+ *
+ *     for( ;; )
+ *     {
+ *         uxCount = uxChannelReceive( xSampleChannel, sSamples, 32, portMAX_DELAY );
+ *         vFilterBlock( sSamples, uxCount );
+ *     }
+ * }
+ * </pre>
+ * \defgroup uxChannelReceive uxChannelReceive
+ * \ingroup Channel
+ */
+UBaseType_t uxChannelReceive( ChannelHandle_t xChannel,
+                              void * pvBuffer,
+                              UBaseType_t uxMaxItems,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel.h
+ * <pre>
+ * UBaseType_t uxChannelItemsWaiting( ChannelHandle_t xChannel );
+ * UBaseType_t uxChannelGetOverruns( ChannelHandle_t xChannel );
+ * </pre>
+ *
+ * Return the number of items in the channel, and the number of items that
+ * were dropped because the channel was full since it was created.
+ */
+UBaseType_t uxChannelItemsWaiting( ChannelHandle_t xChannel ) PRIVILEGED_FUNCTION;
+UBaseType_t uxChannelGetOverruns( ChannelHandle_t xChannel ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* CHANNEL_H */
@@ -0,0 +1,343 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef EVENT_MUX_H
+#define EVENT_MUX_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include event_mux.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "list.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An event multiplexer lets one task wait on many sources - queues,
+ * semaphores, stream buffers and application signals - and learn about every
+ * source that became ready in a single call.
+ *
+ * Unlike a queue set, nothing is copied when a member source receives data.
+ * Each registered source owns an EventMuxSource_t record that contains a list
+ * item.  When the source becomes ready the item is linked onto the ready list
+ * held inside the multiplexer, which is O(1), and the waiting task is unblocked
+ * only if the ready list was previously empty.  uxEventMuxWait() then unlinks up
+ * to the requested number of records in one critical section.
+ *
+ * Each source is registered either edge triggered or level triggered:
+ *
+ * + An edge triggered source is reported once per transition to ready.  The
+ *   task must drain it, as it is not reported again until new data arrives.
+ *
+ * + A level triggered source is reported by every uxEventMuxWait() call for as
+ *   long as the object still holds data, so the task may consume one item per
+ *   wakeup.
+ *
+ * A multiplexer, its sources and the task that waits on it must belong to the
+ * same core, as for every other kernel object of this port.  configUSE_EVENT_MUX
+ * must be set to 1 in FreeRTOSConfig.h for this functionality to be available.
+ *
+ * \defgroup EventMux
+ */
+
+/**
+ * event_mux.h
+ *
+ * Type by which event multiplexers are referenced.
+ *
+ * \defgroup EventMuxHandle_t EventMuxHandle_t
+ * \ingroup EventMux
+ */
+struct EventMuxDef_t;
+typedef struct EventMuxDef_t * EventMuxHandle_t;
+
+/* How the readiness of a source is reported, see the description above. */
+typedef enum
+{
+    eEventMuxEdge = 0,
+    eEventMuxLevel
+} eEventMuxTrigger;
+
+/* Returns pdTRUE if the object still holds data.  Used for level triggered
+ * sources and always called with interrupts masked. */
+typedef BaseType_t (* EventMuxReadyFunction_t)( void * pvObject );
+
+/*
+ * The registration record of one source.  The memory is provided by the
+ * application, normally alongside the object it describes, and must remain
+ * valid until the source is removed again.  The members are private to the
+ * kernel; use pvEventMuxGetSourceUserData() to retrieve the application value.
+ */
+typedef struct xEVENT_MUX_SOURCE
+{
+    ListItem_t xReadyListItem;                           /*< Linked onto the ready list of the multiplexer while the source is ready. */
+    struct EventMuxDef_t * pxMux;                        /*< The multiplexer the source is registered with. */
+    void * pvObject;                                     /*< The queue, semaphore or stream buffer, or NULL for a signal source. */
+    struct xEVENT_MUX_SOURCE * volatile * ppxObjectLink; /*< The member of the object that points back at this record. */
+    EventMuxReadyFunction_t pxIsReady;                   /*< Level check for the object, NULL for a signal source. */
+    void * pvUserData;                                   /*< Application value returned with the source. */
+    eEventMuxTrigger eTrigger;
+} EventMuxSource_t;
+
+/**
+ * event_mux.h
+ * <pre>
+ * EventMuxHandle_t xEventMuxCreate( void );
+ * EventMuxHandle_t xEventMuxCreateStatic( StaticEventMux_t *pxEventMuxBuffer );
+ * </pre>
+ *
+ * Create a new event multiplexer.  The structure is either allocated with
+ * pvPortMalloc() or provided by the application in pxEventMuxBuffer.
+ *
+ * @return The handle of the multiplexer, or NULL if it could not be created.
+ *
+ * \defgroup xEventMuxCreate xEventMuxCreate
+ * \ingroup EventMux
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    EventMuxHandle_t xEventMuxCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    EventMuxHandle_t xEventMuxCreateStatic( StaticEventMux_t * pxEventMuxBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * event_mux.h
+ * <pre>
+ * void vEventMuxDelete( EventMuxHandle_t xEventMux );
+ * </pre>
+ *
+ * Delete a multiplexer.  All sources must have been removed and no task may be
+ * blocked on it.
+ *
+ * \defgroup vEventMuxDelete vEventMuxDelete
+ * \ingroup EventMux
+ */
+void vEventMuxDelete( EventMuxHandle_t xEventMux ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_mux.h
+ * <pre>
+ * BaseType_t xQueueAddToEventMux( QueueHandle_t xQueueOrSemaphore,
+ *                                 EventMuxHandle_t xEventMux,
+ *                                 EventMuxSource_t *pxSource,
+ *                                 eEventMuxTrigger eTrigger,
+ *                                 void *pvUserData );
+ * BaseType_t xStreamBufferAddToEventMux( StreamBufferHandle_t xStreamBuffer,
+ *                                        EventMuxHandle_t xEventMux,
+ *                                        EventMuxSource_t *pxSource,
+ *                                        eEventMuxTrigger eTrigger,
+ *                                        void *pvUserData );
+ * BaseType_t xEventMuxAddSignal( EventMuxHandle_t xEventMux,
+ *                                EventMuxSource_t *pxSource,
+ *                                void *pvUserData );
+ * </pre>
+ *
+ * Register a source with a multiplexer.  A queue or semaphore becomes ready
+ * when an item is posted or the semaphore is given, a stream buffer when its
+ * trigger level is reached.  A signal source has no object behind it and is
+ * made ready by xEventMuxSignal() or xEventMuxSignalFromISR(), which is how
+ * direct notifications from drivers are multiplexed; signal sources are always
+ * edge triggered.
+ *
+ * An object can be registered with one multiplexer at a time.  It can be a
+ * member of a queue set as well.
+ *
+ * @param pxSource The record that describes the source, see EventMuxSource_t.
+ *
+ * @param eTrigger eEventMuxEdge or eEventMuxLevel.
+ *
+ * @param pvUserData Value returned by pvEventMuxGetSourceUserData(), for
+ * example a pointer to the driver context that owns the object.
+ *
+ * @return pdPASS if the source was registered, pdFAIL if the object is already
+ * registered with a multiplexer.
+ *
+ * \defgroup xEventMuxAddSignal xEventMuxAddSignal
+ * \ingroup EventMux
+ */
+BaseType_t xQueueAddToEventMux( QueueHandle_t xQueueOrSemaphore,
+                                EventMuxHandle_t xEventMux,
+                                EventMuxSource_t * pxSource,
+                                eEventMuxTrigger eTrigger,
+                                void * pvUserData ) PRIVILEGED_FUNCTION;
+
+BaseType_t xStreamBufferAddToEventMux( StreamBufferHandle_t xStreamBuffer,
+                                       EventMuxHandle_t xEventMux,
+                                       EventMuxSource_t * pxSource,
+                                       eEventMuxTrigger eTrigger,
+                                       void * pvUserData ) PRIVILEGED_FUNCTION;
+
+BaseType_t xEventMuxAddSignal( EventMuxHandle_t xEventMux,
+                               EventMuxSource_t * pxSource,
+                               void * pvUserData ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_mux.h
+ * <pre>
+ * void vEventMuxRemove( EventMuxSource_t *pxSource );
+ * </pre>
+ *
+ * Remove a source from its multiplexer.  A pending readiness of the source is
+ * discarded.  Deleting a registered queue removes its source automatically.
+ *
+ * \defgroup vEventMuxRemove vEventMuxRemove
+ * \ingroup EventMux
+ */
+void vEventMuxRemove( EventMuxSource_t * pxSource ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_mux.h
+ * <pre>
+ * void vEventMuxSignal( EventMuxSource_t *pxSource );
+ * BaseType_t xEventMuxSignalFromISR( EventMuxSource_t *pxSource,
+ *                                    BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Mark a source as ready.  Intended for signal sources, but can be used on any
+ * source to force it to be reported.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if signalling unblocked a task
+ * of higher priority than the interrupted task, in which case a context switch
+ * should be requested before the interrupt exits.
+ *
+ * @return pdTRUE if the source was newly linked onto the ready list, pdFALSE
+ * if it was already pending.
+ *
+ * \defgroup vEventMuxSignal vEventMuxSignal
+ * \ingroup EventMux
+ */
+void vEventMuxSignal( EventMuxSource_t * pxSource ) PRIVILEGED_FUNCTION;
+
+BaseType_t xEventMuxSignalFromISR( EventMuxSource_t * pxSource,
+                                   BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_mux.h
+ * <pre>
+ * UBaseType_t uxEventMuxWait( EventMuxHandle_t xEventMux,
+ *                             EventMuxSource_t **ppxReadySources,
+ *                             UBaseType_t uxMaxSources,
+ *                             TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Block until at least one source is ready, then return every ready source,
+ * up to uxMaxSources, in the order in which they became ready.  Sources that
+ * do not fit remain pending for the next call.
+ *
+ * @param ppxReadySources Array that receives pointers to the ready sources.
+ *
+ * @param uxMaxSources The number of entries in ppxReadySources.
+ *
+ * @param xTicksToWait The maximum time to wait for a source to become ready.
+ *
+ * @return The number of sources written to ppxReadySources, 0 on timeout.
+ *
+ * Example usage:
+ * <pre>
+ * EventMuxSource_t xCanSources[ 32 ], xUartSources[ 8 ];
+ *
+ * void vGatewayTask( void *pvParameters )
+ * {
+ * EventMuxHandle_t xMux = xEventMuxCreate();
+ * EventMuxSource_t *pxReady[ 16 ];
+ * UBaseType_t uxCount, x;
+ *
+ *     for( x = 0; x < 32; x++ )
+ *     {
+ *         xQueueAddToEventMux( xCanQueues[ x ], xMux, &xCanSources[ x ], eEventMuxEdge, &xCanChannels[ x ] );
+ *     }
+ *
+ *     for( ;; )
+ *     {
+ *         uxCount = uxEventMuxWait( xMux, pxReady, 16, portMAX_DELAY );
+ *
+ *         for( x = 0; x < uxCount; x++ )
+ *         {
+ *             // Drain the channel the source belongs to.
+ *             prvDrain( pvEventMuxGetSourceUserData( pxReady[ x ] ) );
+ *         }
+ *     }
+ * }
+ * </pre>
+ * \defgroup uxEventMuxWait uxEventMuxWait
+ * \ingroup EventMux
+ */
+UBaseType_t uxEventMuxWait( EventMuxHandle_t xEventMux,
+                            EventMuxSource_t ** ppxReadySources,
+                            UBaseType_t uxMaxSources,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_mux.h
+ * <pre>
+ * void *pvEventMuxGetSourceUserData( const EventMuxSource_t *pxSource );
+ * void *pvEventMuxGetSourceObject( const EventMuxSource_t *pxSource );
+ * </pre>
+ *
+ * Return the application value or the queue, semaphore or stream buffer handle
+ * a source was registered with.
+ */
+#define pvEventMuxGetSourceUserData( pxSource )    ( ( pxSource )->pvUserData )
+#define pvEventMuxGetSourceObject( pxSource )      ( ( pxSource )->pvObject )
+
+/* Functions below here are not part of the public API. */
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  It is used by the
+ * queue and stream buffer implementations to register themselves.
+ */
+BaseType_t xEventMuxInternalAdd( EventMuxHandle_t xEventMux,
+                                 EventMuxSource_t * pxSource,
+                                 void * pvObject,
+                                 EventMuxSource_t * volatile * ppxObjectLink,
+                                 EventMuxReadyFunction_t pxIsReady,
+                                 eEventMuxTrigger eTrigger,
+                                 void * pvUserData ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  Marks a source ready
+ * and unblocks the waiting task.  Must be called with interrupts masked, from
+ * a critical section or from an interrupt.  Returns pdTRUE if the unblocked task
+ * has a higher priority than the running task.
+ */
+BaseType_t xEventMuxInternalSignal( EventMuxSource_t * pxSource ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* EVENT_MUX_H */
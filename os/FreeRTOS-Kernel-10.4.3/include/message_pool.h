@@ -0,0 +1,291 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef MESSAGE_POOL_H
+#define MESSAGE_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include message_pool.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "queue.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A message pool hands out fixed size, reference counted buffers that are
+ * passed between tasks by pointer instead of being copied into and out of the
+ * queue storage.  A message queue is an ordinary queue whose items are message
+ * pointers, so only four bytes are copied per send and receive regardless of
+ * the size of the message.
+ *
+ * Each pool belongs to the core that created it and only that core allocates
+ * from it, so every core should create its own pools.  A message can be
+ * released on any core and from interrupts: the last reference returns the
+ * buffer to a lock free return list of the owning pool, which the owner takes
+ * over in one atomic exchange when its own free list runs empty.  The reference
+ * count is updated with portATOMIC_COMPARE_AND_SWAP_U32(), so one message can be
+ * fanned out to several receivers, each of which releases it when done.
+ *
+ * The queues themselves are ordinary kernel objects and as such must be used
+ * from a single core.  configUSE_MESSAGE_POOLS must be set to 1 in
+ * FreeRTOSConfig.h for this functionality to be available.
+ *
+ * \defgroup MessagePool
+ */
+
+/**
+ * message_pool.h
+ *
+ * Type by which message pools are referenced.
+ *
+ * \defgroup MessagePoolHandle_t MessagePoolHandle_t
+ * \ingroup MessagePool
+ */
+struct MessagePoolDef_t;
+typedef struct MessagePoolDef_t * MessagePoolHandle_t;
+
+/*
+ * Size of the header that precedes every message in the pool storage, and the
+ * number of bytes of storage required for uxNumMessages messages of xMessageSize
+ * bytes, for use with xMessagePoolCreateStatic().
+ */
+#define messagePOOL_HEADER_SIZE                                  \
+    ( ( ( 3U * sizeof( void * ) ) + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+#define messagePOOL_STORAGE_SIZE( xMessageSize, uxNumMessages )  \
+    ( ( size_t ) ( uxNumMessages ) * ( messagePOOL_HEADER_SIZE + ( ( ( size_t ) ( xMessageSize ) + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) ) )
+
+/**
+ * message_pool.h
+ * <pre>
+ * MessagePoolHandle_t xMessagePoolCreate( size_t xMessageSize,
+ *                                         UBaseType_t uxNumMessages );
+ * MessagePoolHandle_t xMessagePoolCreateStatic( size_t xMessageSize,
+ *                                               UBaseType_t uxNumMessages,
+ *                                               uint8_t *pucPoolStorage,
+ *                                               StaticMessagePool_t *pxStaticPool );
+ * </pre>
+ *
+ * Create a pool of uxNumMessages buffers of xMessageSize bytes each, owned by
+ * the calling core.  The static variant takes storage of at least
+ * messagePOOL_STORAGE_SIZE( xMessageSize, uxNumMessages ) bytes, aligned to
+ * portBYTE_ALIGNMENT.
+ *
+ * @return The handle of the pool, or NULL if it could not be created.
+ *
+ * \defgroup xMessagePoolCreate xMessagePoolCreate
+ * \ingroup MessagePool
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    MessagePoolHandle_t xMessagePoolCreate( size_t xMessageSize,
+                                            UBaseType_t uxNumMessages ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    MessagePoolHandle_t xMessagePoolCreateStatic( size_t xMessageSize,
+                                                  UBaseType_t uxNumMessages,
+                                                  uint8_t * pucPoolStorage,
+                                                  StaticMessagePool_t * pxStaticPool ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * message_pool.h
+ * <pre>
+ * void *pvMessageAlloc( MessagePoolHandle_t xPool );
+ * void *pvMessageAllocFromISR( MessagePoolHandle_t xPool );
+ * </pre>
+ *
+ * Take a message from a pool of the calling core.  The message starts with a
+ * reference count of one, held by the caller.  Allocation never blocks.
+ *
+ * @return A pointer to the message payload, or NULL if the pool is empty.
+ *
+ * \defgroup pvMessageAlloc pvMessageAlloc
+ * \ingroup MessagePool
+ */
+void * pvMessageAlloc( MessagePoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+void * pvMessageAllocFromISR( MessagePoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ * <pre>
+ * void vMessageRetain( void *pvMessage );
+ * void vMessageRelease( void *pvMessage );
+ * </pre>
+ *
+ * Add or drop a reference to a message.  Dropping the last reference returns
+ * the buffer to its pool.  Both may be called from any core, from a task or
+ * from an interrupt.
+ *
+ * \defgroup vMessageRelease vMessageRelease
+ * \ingroup MessagePool
+ */
+void vMessageRetain( void * pvMessage ) PRIVILEGED_FUNCTION;
+void vMessageRelease( void * pvMessage ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ * <pre>
+ * size_t xMessageGetSize( const void *pvMessage );
+ * UBaseType_t uxMessagePoolGetNumFree( MessagePoolHandle_t xPool );
+ * </pre>
+ *
+ * Return the payload size of a message, and the number of messages of a pool
+ * that are not referenced at the time of the call.
+ */
+size_t xMessageGetSize( const void * pvMessage ) PRIVILEGED_FUNCTION;
+UBaseType_t uxMessagePoolGetNumFree( MessagePoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ * <pre>
+ * QueueHandle_t xMessageQueueCreate( UBaseType_t uxQueueLength );
+ * QueueHandle_t xMessageQueueCreateStatic( UBaseType_t uxQueueLength,
+ *                                          uint8_t *pucQueueStorage,
+ *                                          StaticQueue_t *pxQueueBuffer );
+ * </pre>
+ *
+ * Create a queue that carries message pointers.  The storage of the static
+ * variant must hold uxQueueLength pointers.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xMessageQueueCreate( uxQueueLength )    xQueueCreate( ( uxQueueLength ), sizeof( void * ) )
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #define xMessageQueueCreateStatic( uxQueueLength, pucQueueStorage, pxQueueBuffer ) \
+    xQueueCreateStatic( ( uxQueueLength ), sizeof( void * ), ( pucQueueStorage ), ( pxQueueBuffer ) )
+#endif
+
+/**
+ * message_pool.h
+ * <pre>
+ * BaseType_t xMessageQueueSend( QueueHandle_t xQueue,
+ *                               void *pvMessage,
+ *                               TickType_t xTicksToWait );
+ * BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue,
+ *                                      void *pvMessage,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Post a message to the back of a message queue.  The reference held by the
+ * caller moves to the queue when the call succeeds; on failure the caller
+ * still owns it.
+ *
+ * @return pdPASS or errQUEUE_FULL, as xQueueSend().
+ *
+ * \defgroup xMessageQueueSend xMessageQueueSend
+ * \ingroup MessagePool
+ */
+BaseType_t xMessageQueueSend( QueueHandle_t xQueue,
+                              void * pvMessage,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue,
+                                     void * pvMessage,
+                                     BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ * <pre>
+ * BaseType_t xMessageQueueSendShared( QueueHandle_t xQueue,
+ *                                     void *pvMessage,
+ *                                     TickType_t xTicksToWait );
+ * BaseType_t xMessageQueueSendSharedFromISR( QueueHandle_t xQueue,
+ *                                            void *pvMessage,
+ *                                            BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Post a message while keeping the reference of the caller.  A new reference
+ * is taken for the queue, so the same message can be posted to several queues
+ * before the caller releases its own reference.
+ *
+ * Example usage:
+ * <pre>
+ * void vPublish( const uint8_t *pucFrame, size_t xLength )
+ * {
+ * uint8_t *pucMessage = pvMessageAlloc( xFramePool );
+ *
+ *     if( pucMessage != NULL )
+ *     {
+ *         memcpy( pucMessage, pucFrame, xLength );
+ *         ( void ) xMessageQueueSendShared( xLoggerQueue, pucMessage, 0 );
+ *         ( void ) xMessageQueueSendShared( xRouterQueue, pucMessage, 0 );
+ *         vMessageRelease( pucMessage );
+ *     }
+ * }
+ * </pre>
+ * \defgroup xMessageQueueSendShared xMessageQueueSendShared
+ * \ingroup MessagePool
+ */
+BaseType_t xMessageQueueSendShared( QueueHandle_t xQueue,
+                                    void * pvMessage,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+BaseType_t xMessageQueueSendSharedFromISR( QueueHandle_t xQueue,
+                                           void * pvMessage,
+                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ * <pre>
+ * BaseType_t xMessageQueueReceive( QueueHandle_t xQueue,
+ *                                  void **ppvMessage,
+ *                                  TickType_t xTicksToWait );
+ * BaseType_t xMessageQueueReceiveFromISR( QueueHandle_t xQueue,
+ *                                         void **ppvMessage,
+ *                                         BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Take a message from a message queue.  The caller receives the reference the
+ * queue held and must release it with vMessageRelease() when done.
+ *
+ * @return pdPASS or pdFAIL, as xQueueReceive().
+ *
+ * \defgroup xMessageQueueReceive xMessageQueueReceive
+ * \ingroup MessagePool
+ */
+BaseType_t xMessageQueueReceive( QueueHandle_t xQueue,
+                                 void ** ppvMessage,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+BaseType_t xMessageQueueReceiveFromISR( QueueHandle_t xQueue,
+                                        void ** ppvMessage,
+                                        BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* MESSAGE_POOL_H */
@@ -1416,6 +1416,105 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                                  void * const pvBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ * UBaseType_t xQueueSendMultiple(
+ *                                   QueueHandle_t xQueue,
+ *                                   const void *pvItemsToQueue,
+ *                                   UBaseType_t uxItemCount,
+ *                                   TickType_t xTicksToWait
+ *                               );
+ * UBaseType_t xQueueSendMultipleFromISR(
+ *                                   QueueHandle_t xQueue,
+ *                                   const void *pvItemsToQueue,
+ *                                   UBaseType_t uxItemCount,
+ *                                   BaseType_t *pxHigherPriorityTaskWoken
+ *                               );
+ * </pre>
+ *
+ * Post up to uxItemCount items, stored back to back at pvItemsToQueue, to the
+ * back of a queue.  The items are copied into the queue storage as one block
+ * from a single critical section, and the decision to unblock receivers and
+ * yield is taken once for the whole block, which makes bursts cheaper than the
+ * same number of xQueueSend() calls.
+ *
+ * If the queue is full xQueueSendMultiple() blocks for up to xTicksToWait
+ * until there is room for at least one item, then posts as many items as fit.
+ * The call does not wait for room for the remainder.  Neither function can
+ * be used with semaphores or mutexes.
+ *
+ * @return The number of items posted, from 0 to uxItemCount.
+ *
+ * Example usage:
+ * <pre>
+ * void vAdcBlockISR( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ * UBaseType_t uxPosted;
+ *
+ *  uxPosted = xQueueSendMultipleFromISR( xSampleQueue, usSamples, 32, &xHigherPriorityTaskWoken );
+ *
+ *  if( uxPosted < 32 )
+ *  {
+ *      // The queue overflowed, count the samples that were dropped.
+ *      ulDropped += 32 - uxPosted;
+ *  }
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                const void * const pvItemsToQueue,
+                                const UBaseType_t uxItemCount,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                       const void * const pvItemsToQueue,
+                                       const UBaseType_t uxItemCount,
+                                       BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ * UBaseType_t xQueueReceiveMultiple(
+ *                                      QueueHandle_t xQueue,
+ *                                      void *pvBuffer,
+ *                                      UBaseType_t uxMaxItems,
+ *                                      TickType_t xTicksToWait
+ *                                  );
+ * UBaseType_t xQueueReceiveMultipleFromISR(
+ *                                      QueueHandle_t xQueue,
+ *                                      void *pvBuffer,
+ *                                      UBaseType_t uxMaxItems,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken
+ *                                  );
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from the front of a queue into pvBuffer,
+ * which must have room for uxMaxItems items.  The items are copied out as one
+ * block from a single critical section.  If the queue is empty
+ * xQueueReceiveMultiple() blocks for up to xTicksToWait until at least one item
+ * is available.
+ *
+ * @return The number of items received, from 0 to uxMaxItems.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxMaxItems,
+                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxMaxItems,
+                                          BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
@@ -0,0 +1,202 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RCU_H
+#define RCU_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rcu.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Read-copy-update lets tasks on all cores read a shared object, such as a
+ * routing or calibration table, without a lock, while a writer replaces it
+ * with a new copy and frees the old copy once no reader can still use it.
+ *
+ * Readers bracket each access with vRcuReadLock() and vRcuReadUnlock(), which
+ * only count the readers of the calling core.  Every context switch, and every
+ * pass of the idle task, on a core with no open read section is a quiescent
+ * state: the core advances its quiescent counter.  A writer publishes the new
+ * copy with rcuASSIGN_POINTER(), then either waits in vRcuSynchronize() or
+ * defers the release of the old copy with vRcuCall().  The grace period ends
+ * once every core has advanced its counter, or was not running the kernel.
+ *
+ * Read sections must be short and must not block.  A reader preempted inside
+ * a section delays the grace period until it is resumed and leaves it.  The
+ * published pointer must be declared volatile and live in memory that all
+ * cores access uncached.  configUSE_RCU must be set to 1 in FreeRTOSConfig.h
+ * for this functionality to be available.
+ *
+ * \defgroup RCU
+ */
+
+struct xRCU_HEAD;
+
+/* Called once the grace period of a deferred release has ended. */
+typedef void (* RcuCallbackFunction_t)( struct xRCU_HEAD * pxHead );
+
+/*
+ * Record used to defer a release, normally a member of the object that is
+ * released.  The members are private to the kernel.
+ */
+typedef struct xRCU_HEAD
+{
+    struct xRCU_HEAD * pxNext;
+    RcuCallbackFunction_t pxCallback;
+} RcuHead_t;
+
+/**
+ * rcu.h
+ * <pre>
+ * rcuASSIGN_POINTER( xPointer, xValue );
+ * </pre>
+ *
+ * Publish a new version of a shared object.  The object is complete in memory
+ * before any other core can see the new pointer.
+ *
+ * \defgroup rcuASSIGN_POINTER rcuASSIGN_POINTER
+ * \ingroup RCU
+ */
+#define rcuASSIGN_POINTER( xPointer, xValue ) \
+    do {                                      \
+        portDATA_SYNC_BARRIER();              \
+        ( xPointer ) = ( xValue );            \
+        portDATA_SYNC_BARRIER();              \
+    } while( 0 )
+
+/**
+ * rcu.h
+ * <pre>
+ * void vRcuReadLock( void );
+ * void vRcuReadUnlock( void );
+ * </pre>
+ *
+ * Open and close a read section on the calling core.  Sections nest.  They
+ * may be used from tasks and from interrupts at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY; interrupts above it are not masked
+ * while the core reports a quiescent state.
+ *
+ * Example usage:
+ * <pre>
+ * RoutingTable_t * volatile pxRoutes;
+ *
+ * uint32_t ulRouteLookup( uint32_t ulId )
+ * {
+ * uint32_t ulPort;
+ *
+ *     vRcuReadLock();
+ *     ulPort = pxRoutes->ulPort[ ulId ];
+ *     vRcuReadUnlock();
+ *
+ *     return ulPort;
+ * }
+ *
+ * static void prvFreeRoutes( RcuHead_t *pxHead )
+ * {
+ *     // xRcu is the first member of RoutingTable_t.
+ *     vPortFree( pxHead );
+ * }
+ *
+ * void vRouteUpdate( RoutingTable_t *pxNew )
+ * {
+ * RoutingTable_t *pxOld = pxRoutes;
+ *
+ *     rcuASSIGN_POINTER( pxRoutes, pxNew );
+ *     vRcuCall( &( pxOld->xRcu ), prvFreeRoutes );
+ * }
+ * </pre>
+ * \defgroup vRcuReadLock vRcuReadLock
+ * \ingroup RCU
+ */
+void vRcuReadLock( void ) PRIVILEGED_FUNCTION;
+void vRcuReadUnlock( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rcu.h
+ * <pre>
+ * void vRcuQuiescentState( void );
+ * </pre>
+ *
+ * Report a quiescent state of the calling core, unless a read section is
+ * open on it.  The kernel calls this on every context switch and from the
+ * idle task; a task that runs for a long time without being switched out can
+ * call it to keep grace periods short.
+ *
+ * \defgroup vRcuQuiescentState vRcuQuiescentState
+ * \ingroup RCU
+ */
+void vRcuQuiescentState( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rcu.h
+ * <pre>
+ * void vRcuSynchronize( void );
+ * </pre>
+ *
+ * Block the calling task until a grace period has ended, after which every
+ * read section that could have seen a pointer replaced before the call has
+ * been left.  Must not be called from a read section or an interrupt.
+ *
+ * \defgroup vRcuSynchronize vRcuSynchronize
+ * \ingroup RCU
+ */
+void vRcuSynchronize( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rcu.h
+ * <pre>
+ * void vRcuCall( RcuHead_t *pxHead, RcuCallbackFunction_t pxCallback );
+ * UBaseType_t uxRcuProcessCallbacks( void );
+ * </pre>
+ *
+ * vRcuCall() queues pxCallback to be called with pxHead once a grace period
+ * that starts after the call has ended.  It does not block.
+ *
+ * Callbacks are queued per core and called from uxRcuProcessCallbacks() on
+ * the core that queued them, outside any critical section, so they may free
+ * memory.  Call it periodically, for example from the writer task or the idle
+ * hook.  It returns the number of callbacks it called.
+ *
+ * \defgroup vRcuCall vRcuCall
+ * \ingroup RCU
+ */
+void vRcuCall( RcuHead_t * pxHead,
+               RcuCallbackFunction_t pxCallback ) PRIVILEGED_FUNCTION;
+UBaseType_t uxRcuProcessCallbacks( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RCU_H */
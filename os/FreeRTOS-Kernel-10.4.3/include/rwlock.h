@@ -0,0 +1,161 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rwlock.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A reader-writer lock shared by all cores, for tables that are read
+ * continuously and updated rarely.
+ *
+ * Each core counts its readers in a counter of its own, padded to a cache
+ * line, so readers on different cores never compete for the same word.  A
+ * writer first claims the writer word, which stops new readers on every core,
+ * then waits for the counter of each core to drain - writers are preferred.
+ *
+ * When the lock is not available the caller spins configRWLOCK_SPIN_COUNT
+ * times.  With a block time it then sleeps one tick at a time until the lock
+ * is granted or the time expires, which lets a lower priority holder on the
+ * same core run.  With a block time of zero the call fails after the spin,
+ * which is the only mode allowed from interrupts.
+ *
+ * Unlike other kernel objects a lock is not allocated by the kernel: declare
+ * it portCACHE_ALIGNED in memory that every core accesses uncached, and
+ * initialise it once before use.  configUSE_RWLOCKS must be set to 1 in
+ * FreeRTOSConfig.h for this functionality to be available.
+ *
+ * \defgroup RwLock
+ */
+
+/* The reader count of one core, alone on its cache line. */
+typedef struct xRWLOCK_READERS
+{
+    volatile uint32_t ulCount;
+    uint8_t ucPadding[ portCACHE_LINE_SIZE - sizeof( uint32_t ) ];
+} RwLockReaders_t;
+
+/*
+ * The lock.  The members are private to the kernel.
+ */
+typedef struct xRWLOCK
+{
+    RwLockReaders_t xReaders[ configNUM_CORES ]; /*< Number of readers holding the lock, per core. */
+    volatile uint32_t ulWriter;                  /*< Zero, the handle of the task that holds the lock, or one more than the core ID for an interrupt. */
+    uint8_t ucPadding[ portCACHE_LINE_SIZE - sizeof( uint32_t ) ];
+} RwLock_t;
+
+/**
+ * rwlock.h
+ * <pre>
+ * void vRwLockInitialise( RwLock_t *pxLock );
+ * </pre>
+ *
+ * Initialise a lock as free.  Must be called once, before any core uses it.
+ *
+ * Example usage:
+ * <pre>
+ * static RwLock_t xRoutingLock portCACHE_ALIGNED;
+ *
+ * void vRoutingInit( void )
+ * {
+ *     vRwLockInitialise( &xRoutingLock );
+ * }
+ *
+ * uint32_t ulRouteLookup( uint32_t ulId )
+ * {
+ * uint32_t ulPort = 0;
+ *
+ *     if( xRwLockReadTake( &xRoutingLock, portMAX_DELAY ) == pdPASS )
+ *     {
+ *         ulPort = ulRoutes[ ulId ];
+ *         vRwLockReadGive( &xRoutingLock );
+ *     }
+ *
+ *     return ulPort;
+ * }
+ * </pre>
+ * \defgroup vRwLockInitialise vRwLockInitialise
+ * \ingroup RwLock
+ */
+void vRwLockInitialise( RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>
+ * BaseType_t xRwLockReadTake( RwLock_t *pxLock, TickType_t xTicksToWait );
+ * void vRwLockReadGive( RwLock_t *pxLock );
+ * </pre>
+ *
+ * Take or give the lock as a reader.  Any number of readers on any cores hold
+ * the lock at the same time.  The give must happen on the core of the take.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL if xTicksToWait expired.
+ *
+ * \defgroup xRwLockReadTake xRwLockReadTake
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockReadTake( RwLock_t * const pxLock,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vRwLockReadGive( RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>
+ * BaseType_t xRwLockWriteTake( RwLock_t *pxLock, TickType_t xTicksToWait );
+ * void vRwLockWriteGive( RwLock_t *pxLock );
+ * </pre>
+ *
+ * Take or give the lock as the single writer.  While a writer waits for the
+ * readers to drain no new reader is admitted.  The lock is not recursive, and
+ * the give must come from the task that took it, or from an interrupt of the
+ * core whose interrupt took it.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL if xTicksToWait expired.
+ *
+ * \defgroup xRwLockWriteTake xRwLockWriteTake
+ * \ingroup RwLock
+ */
+BaseType_t xRwLockWriteTake( RwLock_t * const pxLock,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vRwLockWriteGive( RwLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RWLOCK_H */
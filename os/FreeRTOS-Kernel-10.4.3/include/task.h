@@ -155,6 +155,28 @@ typedef struct xTASK_STATUS
     configSTACK_DEPTH_TYPE usStackHighWaterMark;     /* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Used with the uxTaskSnapshotRead() function.  Each core publishes one record
+ * per task at its context switches, so the values describe the task as it was
+ * when it was last switched in or out. */
+typedef struct xTASK_SNAPSHOT_RECORD
+{
+    TaskHandle_t xHandle;                            /* The handle of the task to which the rest of the information in the structure relates. */
+    eTaskState eCurrentState;                        /* The state of the task when it was last switched in or out. */
+    UBaseType_t uxCurrentPriority;                   /* The priority at which the task was running (may be inherited) when it was last switched in or out. */
+    uint32_t ulRunTimeCounter;                       /* The run time allocated to the task up to its last switch out.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+    uint32_t ulSwitchInCount;                        /* The number of times the task has been switched in. */
+    configSTACK_DEPTH_TYPE usStackHighWaterMark;     /* The minimum stack space, in words, that remained at any switch out of the task.  Sampled from the saved stack pointer, so it can be higher than the uxTaskGetStackHighWaterMark() value. */
+    UBaseType_t uxContextHighWaterMark;              /* The maximum number of saved contexts held by the task at any switch out.  Only valid if the port defines portGET_TASK_CONTEXT_USAGE(). */
+} TaskSnapshotRecord_t;
+
+/* Used with the xTaskSetPartitionSchedule() function.  A window gives the
+ * processor to the tasks of one partition for a fixed time. */
+typedef struct xPARTITION_WINDOW
+{
+    UBaseType_t uxPartition;                         /* The partition that owns the window.  Partition 0 is the background partition. */
+    uint32_t ulDuration;                             /* The length of the window in microseconds. */
+} PartitionWindow_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -855,6 +877,202 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
     ( void ) xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement ); \
 }
 
+/**
+ * task. h
+ * <pre>
+ * BaseType_t xTaskSetPeriod( TaskHandle_t xTask, TickType_t xPeriod );
+ * </pre>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Make a task periodic.  The kernel then releases the task at every tick count
+ * that is a multiple of xPeriod, counted from the first multiple after this
+ * call, and the task waits for each release with xTaskWaitForNextPeriod().
+ * Release times do not depend on when the task runs, so unlike a loop on
+ * vTaskDelay() the period does not drift by the execution time of the task.
+ *
+ * All the tasks of a core that use the same period wait in a single list and
+ * are released together by the tick interrupt, so a release costs one check
+ * per distinct period rather than one delayed list insertion per task.  At
+ * most configPERIODIC_MAX_PERIODS distinct periods can be in use on a core.
+ *
+ * xTask must run on the calling core and must not be waiting for a release.
+ *
+ * @param xTask The handle of the task.  Passing NULL makes the calling task
+ * periodic.
+ *
+ * @param xPeriod The period in ticks.  Passing 0 makes the task non periodic.
+ *
+ * @return pdPASS if the period was set, or pdFAIL if all the periods of the
+ * core are already in use.
+ *
+ * \defgroup xTaskSetPeriod xTaskSetPeriod
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskSetPeriod( TaskHandle_t xTask,
+                           const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>
+ * BaseType_t xTaskWaitForNextPeriod( void );
+ * </pre>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Block the calling periodic task until its next release.
+ *
+ * If the task was released again before it called this function it has
+ * overrun: the function returns at once, without blocking, so the task starts
+ * its late period immediately.  The releases that were missed are added to the
+ * overrun count of the task, see ulTaskGetPeriodicOverruns(), and
+ * traceTASK_PERIODIC_OVERRUN() is called.
+ *
+ * @return pdPASS if the task waited for its release, or pdFAIL if it overran.
+ *
+ * Example usage:
+ * <pre>
+ * void vControlTask( void * pvParameters )
+ * {
+ *     ( void ) xTaskSetPeriod( NULL, pdMS_TO_TICKS( 10 ) );
+ *
+ *     for( ;; )
+ *     {
+ *         if( xTaskWaitForNextPeriod() == pdFAIL )
+ *         {
+ *             // The previous cycle took longer than the period.
+ *         }
+ *
+ *         vRunControlCycle();
+ *     }
+ * }
+ * </pre>
+ * \defgroup xTaskWaitForNextPeriod xTaskWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>
+ * uint32_t ulTaskGetPeriodicOverruns( TaskHandle_t xTask );
+ * </pre>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The number of releases of xTask that happened while it was still
+ * running a previous period.  The count is updated when the task next calls
+ * xTaskWaitForNextPeriod().  Passing NULL queries the calling task.
+ *
+ * \defgroup ulTaskGetPeriodicOverruns ulTaskGetPeriodicOverruns
+ * \ingroup TaskCtrl
+ */
+uint32_t ulTaskGetPeriodicOverruns( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>
+ * BaseType_t xTaskSetPartitionSchedule( const PartitionWindow_t * const pxWindows,
+ *                                       const UBaseType_t uxWindowCount );
+ * </pre>
+ *
+ * configUSE_PARTITIONS must be defined as 1 for this function to be
+ * available.
+ *
+ * Install the window table of the calling core.  The core runs the windows in
+ * order and starts again at the first one when the last one ends.  During a
+ * window only the tasks of the partition that owns it are selected, in
+ * priority order.  When that partition has no task ready the rest of the
+ * window is donated to the background partition, partition 0, which also
+ * holds the idle task.  A task of the owner that becomes ready takes the
+ * processor back at once.
+ *
+ * The table is not copied and must stay valid.  It can only be installed
+ * before vTaskStartScheduler() is called on the core.  Each core without a
+ * table runs partition 0 only.
+ *
+ * The port ends the windows from a hardware timer, see
+ * ulTaskNextPartitionWindowFromISR().
+ *
+ * @param pxWindows The window table.
+ *
+ * @param uxWindowCount The number of windows in the table.
+ *
+ * @return pdPASS if the table was installed, pdFAIL if the scheduler is
+ * already running or a window names a partition that does not exist or has a
+ * zero duration.
+ *
+ * Example usage:
+ * <pre>
+ * static const PartitionWindow_t xWindows[] =
+ * {
+ *     { 1, 500 },    // Control, 500us.
+ *     { 2, 300 },    // Diagnostics, 300us.
+ *     { 0, 200 }     // Background, 200us.
+ * };
+ *
+ * void vCoreMain( void )
+ * {
+ *     xTaskCreate( vControlTask, "ctrl", 512, NULL, 4, &xControlTask );
+ *     vTaskSetPartition( xControlTask, 1 );
+ *     xTaskCreate( vDiagTask, "diag", 512, NULL, 2, &xDiagTask );
+ *     vTaskSetPartition( xDiagTask, 2 );
+ *
+ *     xTaskSetPartitionSchedule( xWindows, 3 );
+ *     vTaskStartScheduler();
+ * }
+ * </pre>
+ * \defgroup xTaskSetPartitionSchedule xTaskSetPartitionSchedule
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskSetPartitionSchedule( const PartitionWindow_t * const pxWindows,
+                                      const UBaseType_t uxWindowCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>
+ * void vTaskSetPartition( TaskHandle_t xTask, UBaseType_t uxPartition );
+ * </pre>
+ *
+ * configUSE_PARTITIONS must be defined as 1 for this function to be
+ * available.
+ *
+ * Move a task to a partition.  Tasks are created in partition 0.  The idle
+ * task cannot be moved.
+ *
+ * @param xTask The handle of the task.  Passing NULL moves the calling task.
+ *
+ * @param uxPartition The new partition, less than configNUM_PARTITIONS.
+ *
+ * \defgroup vTaskSetPartition vTaskSetPartition
+ * \ingroup TaskCtrl
+ */
+void vTaskSetPartition( TaskHandle_t xTask,
+                        UBaseType_t uxPartition ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>
+ * UBaseType_t uxTaskGetActivePartition( void );
+ * uint32_t ulTaskGetPartitionWindowDuration( void );
+ * </pre>
+ *
+ * configUSE_PARTITIONS must be defined as 1 for these functions to be
+ * available.
+ *
+ * Return the partition that owns the current window of the calling core, and
+ * the length of that window in microseconds, or 0 if the core has no window
+ * table.
+ *
+ * \defgroup uxTaskGetActivePartition uxTaskGetActivePartition
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskGetActivePartition( void ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGetPartitionWindowDuration( void ) PRIVILEGED_FUNCTION;
+
 
 /**
  * task. h
@@ -1772,6 +1990,63 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
                                   const UBaseType_t uxArraySize,
                                   uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>UBaseType_t uxTaskSnapshotRead( BaseType_t xCoreID, TaskSnapshotRecord_t * const pxRecords, const UBaseType_t uxArraySize );</PRE>
+ *
+ * configUSE_TASK_SNAPSHOT must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Each core keeps a table of TaskSnapshotRecord_t structures, one for each of
+ * the first configTASK_SNAPSHOT_MAX_TASKS tasks created on that core.  The
+ * table is updated by vTaskSwitchContext() for the task being switched out and
+ * the task being switched in, under a sequence counter.  uxTaskSnapshotRead()
+ * copies the table of any core without suspending the scheduler or entering a
+ * critical section: the copy is simply repeated if the owning core updated the
+ * table while it was being taken.  It is therefore safe to call periodically
+ * from a monitor task without disturbing the tasks being observed.
+ *
+ * The records are only as current as the last context switch on the observed
+ * core.  A task that has run without being switched out keeps reporting the
+ * run time counter of its previous switch out.
+ *
+ * @param xCoreID The core whose table is read.
+ *
+ * @param pxRecords An array into which a consistent copy of the records is
+ * written.
+ *
+ * @param uxArraySize The size of the array pointed to by pxRecords.  Tasks that
+ * do not fit are not reported.
+ *
+ * @return The number of records written to pxRecords.  Zero is returned if no
+ * consistent copy could be taken within configTASK_SNAPSHOT_READ_RETRIES
+ * attempts.
+ *
+ * Example usage:
+ * <pre>
+ *  void vMonitorTask( void *pvParameters )
+ *  {
+ *  TaskSnapshotRecord_t xRecords[ configTASK_SNAPSHOT_MAX_TASKS ];
+ *  UBaseType_t uxCount, x;
+ *
+ *      for( ;; )
+ *      {
+ *          uxCount = uxTaskSnapshotRead( 1, xRecords, configTASK_SNAPSHOT_MAX_TASKS );
+ *
+ *          for( x = 0; x < uxCount; x++ )
+ *          {
+ *              // Publish xRecords[ x ].
+ *          }
+ *
+ *          vTaskDelay( pdMS_TO_TICKS( 100 ) );
+ *      }
+ *  }
+ *  </pre>
+ */
+UBaseType_t uxTaskSnapshotRead( BaseType_t xCoreID,
+                                TaskSnapshotRecord_t * const pxRecords,
+                                const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>void vTaskList( char *pcWriteBuffer );</PRE>
@@ -1903,6 +2178,31 @@ void vTaskGetRunTimeStats( char * pcWriteBuffer ) PRIVILEGED_FUNCTION;     /*lin
  */
 uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetIdleRunTimeCounterFromCore( BaseType_t xCoreID );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS and INCLUDE_xTaskGetIdleTaskHandle must both
+ * be defined as 1 for this function to be available, and the port must
+ * define portGET_RUN_TIME_COUNTER_VALUE() with a counter that every core can
+ * read.
+ *
+ * Returns the total run time of the idle task of any core, including the
+ * time since its last switch in if it is running now.  The other core is not
+ * stopped while its counters are read, so the value of one call can be off by
+ * one run interval.  Take differences between calls over windows much longer
+ * than a task's run interval, and clamp them, when deriving a utilisation.
+ *
+ * @param xCoreID The core whose idle task is queried.
+ *
+ * @return The run time of the idle task of xCoreID, in run time counter units,
+ * or 0 if the scheduler has not been started on xCoreID.
+ *
+ * \defgroup ulTaskGetIdleRunTimeCounterFromCore ulTaskGetIdleRunTimeCounterFromCore
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetIdleRunTimeCounterFromCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
@@ -2858,6 +3158,21 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
+ * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
+ * AN INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called from the partition window timer of the calling core when the
+ * current window ends.  Moves to the next window of the table installed by
+ * xTaskSetPartitionSchedule() and returns its length in microseconds, which
+ * the port uses to program the end of the new window.  Returns 0 if the core
+ * has no window table.  *pxHigherPriorityTaskWoken is set to pdTRUE when the
+ * new window belongs to another partition, in which case a context switch
+ * must be requested before the interrupt exits.
+ */
+uint32_t ulTaskNextPartitionWindowFromISR( BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
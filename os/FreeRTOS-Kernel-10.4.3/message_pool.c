@@ -0,0 +1,491 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "message_pool.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include message pool functionality.  This #if is closed at the very bottom
+ * of this file.  If you want to include message pools then ensure
+ * configUSE_MESSAGE_POOLS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MESSAGE_POOLS == 1 )
+
+    #ifndef portATOMIC_COMPARE_AND_SWAP_U32
+        #error portATOMIC_COMPARE_AND_SWAP_U32 must be provided by the port to use message pools
+    #endif
+
+/* Round a payload size up so the next header stays aligned. */
+    #define poolALIGN_SIZE( xSize )    ( ( ( xSize ) + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The header placed in front of each message payload. */
+typedef struct xMESSAGE_HEADER
+{
+    struct xMESSAGE_HEADER * pxNext;   /*< Next free message while the message is on a free or return list. */
+    struct MessagePoolDef_t * pxPool;  /*< The pool the message belongs to. */
+    volatile uint32_t ulReferenceCount; /*< Number of holders, zero while the message is free. */
+} MessageHeader_t;
+
+typedef struct MessagePoolDef_t
+{
+    MessageHeader_t * pxFreeList;              /*< Free messages, only accessed by the owning core with interrupts masked. */
+    MessageHeader_t * volatile pxReturnList;   /*< Messages released since the free list was last refilled, pushed by any core. */
+    size_t xMessageSize;                       /*< Payload size of each message, rounded up to portBYTE_ALIGNMENT. */
+    UBaseType_t uxNumMessages;                 /*< Number of messages in the pool storage. */
+    volatile UBaseType_t uxNumFree;            /*< Number of messages on either list. */
+    BaseType_t xCoreID;                        /*< The core that allocates from the pool. */
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the pool is statically allocated to ensure no attempt is made to free the memory. */
+    #endif
+} MessagePool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Link uxNumMessages messages carved out of pucPoolStorage onto the free list
+ * of a new pool.
+ */
+static void prvInitialiseNewMessagePool( MessagePool_t * const pxPool,
+                                         size_t xMessageSize,
+                                         UBaseType_t uxNumMessages,
+                                         uint8_t * pucPoolStorage ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add lDelta to a word shared between cores and return the new value.
+ */
+static uint32_t prvAtomicAdd( volatile uint32_t * pulValue,
+                              int32_t lDelta ) PRIVILEGED_FUNCTION;
+
+/*
+ * Pop a message off the free list of the pool, refilling the free list from
+ * the return list when it is empty.  Must be called on the owning core with
+ * interrupts masked.
+ */
+static void * prvAllocateMessage( MessagePool_t * const pxPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common body of the shared send functions.
+ */
+static BaseType_t prvSendShared( QueueHandle_t xQueue,
+                                 void * pvMessage,
+                                 TickType_t xTicksToWait,
+                                 BaseType_t * pxHigherPriorityTaskWoken,
+                                 BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* Map between a payload pointer and the header in front of it. */
+    #define poolHEADER_FROM_MESSAGE( pvMessage )    ( ( MessageHeader_t * ) ( ( ( uint8_t * ) ( pvMessage ) ) - messagePOOL_HEADER_SIZE ) )
+    #define poolMESSAGE_FROM_HEADER( pxHeader )     ( ( void * ) ( ( ( uint8_t * ) ( pxHeader ) ) + messagePOOL_HEADER_SIZE ) )
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    MessagePoolHandle_t xMessagePoolCreateStatic( size_t xMessageSize,
+                                                  UBaseType_t uxNumMessages,
+                                                  uint8_t * pucPoolStorage,
+                                                  StaticMessagePool_t * pxStaticPool )
+    {
+        MessagePool_t * pxPool;
+
+        configASSERT( pxStaticPool );
+        configASSERT( pucPoolStorage );
+        configASSERT( xMessageSize > ( size_t ) 0 );
+        configASSERT( uxNumMessages > ( UBaseType_t ) 0 );
+        configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorage ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == 0U );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticMessagePool_t equals the size of the
+                 * real pool structure. */
+                volatile size_t xSize = sizeof( StaticMessagePool_t );
+                configASSERT( xSize == sizeof( MessagePool_t ) );
+            } /*lint !e529 xSize is referenced if configASSERT() is defined. */
+        #endif /* configASSERT_DEFINED */
+
+        pxPool = ( MessagePool_t * ) pxStaticPool; /*lint !e740 !e9087 MessagePool_t and StaticMessagePool_t are deliberately aliased for data hiding purposes. */
+
+        if( pxPool != NULL )
+        {
+            prvInitialiseNewMessagePool( pxPool, xMessageSize, uxNumMessages, pucPoolStorage );
+
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    pxPool->ucStaticallyAllocated = pdTRUE;
+                }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxPool;
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    MessagePoolHandle_t xMessagePoolCreate( size_t xMessageSize,
+                                            UBaseType_t uxNumMessages )
+    {
+        MessagePool_t * pxPool;
+        size_t xPoolStructSize;
+
+        configASSERT( xMessageSize > ( size_t ) 0 );
+        configASSERT( uxNumMessages > ( UBaseType_t ) 0 );
+
+        /* The storage follows the pool structure in the same allocation, so
+         * round the structure size up to keep the first header aligned. */
+        xPoolStructSize = poolALIGN_SIZE( sizeof( MessagePool_t ) );
+
+        pxPool = ( MessagePool_t * ) pvPortMalloc( xPoolStructSize + messagePOOL_STORAGE_SIZE( xMessageSize, uxNumMessages ) ); /*lint !e9087 !e9079 pvPortMalloc() returns memory aligned for any kernel structure. */
+
+        if( pxPool != NULL )
+        {
+            prvInitialiseNewMessagePool( pxPool, xMessageSize, uxNumMessages, ( ( uint8_t * ) pxPool ) + xPoolStructSize );
+
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    pxPool->ucStaticallyAllocated = pdFALSE;
+                }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxPool;
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewMessagePool( MessagePool_t * const pxPool,
+                                         size_t xMessageSize,
+                                         UBaseType_t uxNumMessages,
+                                         uint8_t * pucPoolStorage )
+{
+    MessageHeader_t * pxHeader;
+    UBaseType_t uxMessage;
+
+    configASSERT( sizeof( MessageHeader_t ) <= messagePOOL_HEADER_SIZE );
+
+    pxPool->xMessageSize = poolALIGN_SIZE( xMessageSize );
+    pxPool->uxNumMessages = uxNumMessages;
+    pxPool->uxNumFree = uxNumMessages;
+    pxPool->xCoreID = ( BaseType_t ) portGET_CORE_ID();
+    pxPool->pxFreeList = NULL;
+    pxPool->pxReturnList = NULL;
+
+    /* Link the messages in reverse so the first allocation returns the lowest
+     * address. */
+    for( uxMessage = uxNumMessages; uxMessage > ( UBaseType_t ) 0; uxMessage-- )
+    {
+        pxHeader = ( MessageHeader_t * ) ( pucPoolStorage + ( ( size_t ) ( uxMessage - ( UBaseType_t ) 1 ) * ( messagePOOL_HEADER_SIZE + pxPool->xMessageSize ) ) ); /*lint !e9087 !e826 The storage is aligned and sized by messagePOOL_STORAGE_SIZE(). */
+        pxHeader->pxPool = pxPool;
+        pxHeader->ulReferenceCount = 0U;
+        pxHeader->pxNext = pxPool->pxFreeList;
+        pxPool->pxFreeList = pxHeader;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvAtomicAdd( volatile uint32_t * pulValue,
+                              int32_t lDelta )
+{
+    uint32_t ulOld, ulNew;
+
+    do
+    {
+        ulOld = *pulValue;
+        ulNew = ulOld + ( uint32_t ) lDelta;
+    } while( portATOMIC_COMPARE_AND_SWAP_U32( pulValue, ulNew, ulOld ) != ulOld );
+
+    return ulNew;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvAllocateMessage( MessagePool_t * const pxPool )
+{
+    MessageHeader_t * pxHeader;
+    void * pvReturn = NULL;
+
+    if( pxPool->pxFreeList == NULL )
+    {
+        /* Take over everything other cores and interrupts returned since the
+         * last refill.  The return list is only ever pushed to or exchanged as
+         * a whole, never popped one message at a time, so the exchange is not
+         * exposed to ABA reuse of a message. */
+        do
+        {
+            pxHeader = pxPool->pxReturnList;
+        } while( ( pxHeader != NULL ) &&
+                 ( portATOMIC_COMPARE_AND_SWAP_U32( &( pxPool->pxReturnList ), 0U, pxHeader ) != ( uint32_t ) pxHeader ) ); /*lint !e923 The port casts pointers to words of the same size. */
+
+        pxPool->pxFreeList = pxHeader;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxHeader = pxPool->pxFreeList;
+
+    if( pxHeader != NULL )
+    {
+        pxPool->pxFreeList = pxHeader->pxNext;
+        pxHeader->pxNext = NULL;
+        pxHeader->ulReferenceCount = 1U;
+        ( void ) prvAtomicAdd( ( volatile uint32_t * ) &( pxPool->uxNumFree ), -1 );
+        pvReturn = poolMESSAGE_FROM_HEADER( pxHeader );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void * pvMessageAlloc( MessagePoolHandle_t xPool )
+{
+    MessagePool_t * const pxPool = xPool;
+    void * pvReturn;
+
+    configASSERT( pxPool );
+
+    /* Only the owning core takes messages off the free list. */
+    configASSERT( pxPool->xCoreID == ( BaseType_t ) portGET_CORE_ID() );
+
+    taskENTER_CRITICAL();
+    {
+        pvReturn = prvAllocateMessage( pxPool );
+    }
+    taskEXIT_CRITICAL();
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void * pvMessageAllocFromISR( MessagePoolHandle_t xPool )
+{
+    MessagePool_t * const pxPool = xPool;
+    void * pvReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxPool );
+    configASSERT( pxPool->xCoreID == ( BaseType_t ) portGET_CORE_ID() );
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        pvReturn = prvAllocateMessage( pxPool );
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMessageRetain( void * pvMessage )
+{
+    MessageHeader_t * const pxHeader = poolHEADER_FROM_MESSAGE( pvMessage );
+    uint32_t ulReferences;
+
+    configASSERT( pvMessage );
+
+    ulReferences = prvAtomicAdd( &( pxHeader->ulReferenceCount ), 1 );
+
+    /* A free message cannot gain a reference. */
+    configASSERT( ulReferences > 1U );
+    ( void ) ulReferences;
+}
+/*-----------------------------------------------------------*/
+
+void vMessageRelease( void * pvMessage )
+{
+    MessageHeader_t * const pxHeader = poolHEADER_FROM_MESSAGE( pvMessage );
+    MessagePool_t * pxPool;
+    MessageHeader_t * pxHead;
+
+    configASSERT( pvMessage );
+    configASSERT( pxHeader->ulReferenceCount > 0U );
+
+    if( prvAtomicAdd( &( pxHeader->ulReferenceCount ), -1 ) == 0U )
+    {
+        /* That was the last reference.  Push the message onto the return list
+         * of its pool, which is safe from any core and any context. */
+        pxPool = pxHeader->pxPool;
+
+        do
+        {
+            pxHead = pxPool->pxReturnList;
+            pxHeader->pxNext = pxHead;
+        } while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxPool->pxReturnList ), pxHeader, pxHead ) != ( uint32_t ) pxHead ); /*lint !e923 The port casts pointers to words of the same size. */
+
+        ( void ) prvAtomicAdd( ( volatile uint32_t * ) &( pxPool->uxNumFree ), 1 );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xMessageGetSize( const void * pvMessage )
+{
+    configASSERT( pvMessage );
+
+    return poolHEADER_FROM_MESSAGE( pvMessage )->pxPool->xMessageSize;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMessagePoolGetNumFree( MessagePoolHandle_t xPool )
+{
+    configASSERT( xPool );
+
+    return xPool->uxNumFree;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSend( QueueHandle_t xQueue,
+                              void * pvMessage,
+                              TickType_t xTicksToWait )
+{
+    configASSERT( pvMessage );
+
+    /* Only the pointer is copied into the queue storage. */
+    return xQueueSend( xQueue, &pvMessage, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue,
+                                     void * pvMessage,
+                                     BaseType_t * pxHigherPriorityTaskWoken )
+{
+    configASSERT( pvMessage );
+
+    return xQueueSendFromISR( xQueue, &pvMessage, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSendShared( QueueHandle_t xQueue,
+                                 void * pvMessage,
+                                 TickType_t xTicksToWait,
+                                 BaseType_t * pxHigherPriorityTaskWoken,
+                                 BaseType_t xFromISR )
+{
+    BaseType_t xReturn;
+
+    /* Take the reference of the queue first, a receiver may release it before
+     * the send call returns. */
+    vMessageRetain( pvMessage );
+
+    if( xFromISR != pdFALSE )
+    {
+        xReturn = xQueueSendFromISR( xQueue, &pvMessage, pxHigherPriorityTaskWoken );
+    }
+    else
+    {
+        xReturn = xQueueSend( xQueue, &pvMessage, xTicksToWait );
+    }
+
+    if( xReturn != pdPASS )
+    {
+        vMessageRelease( pvMessage );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSendShared( QueueHandle_t xQueue,
+                                    void * pvMessage,
+                                    TickType_t xTicksToWait )
+{
+    return prvSendShared( xQueue, pvMessage, xTicksToWait, NULL, pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSendSharedFromISR( QueueHandle_t xQueue,
+                                           void * pvMessage,
+                                           BaseType_t * pxHigherPriorityTaskWoken )
+{
+    return prvSendShared( xQueue, pvMessage, 0, pxHigherPriorityTaskWoken, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueReceive( QueueHandle_t xQueue,
+                                 void ** ppvMessage,
+                                 TickType_t xTicksToWait )
+{
+    configASSERT( ppvMessage );
+
+    return xQueueReceive( xQueue, ppvMessage, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueReceiveFromISR( QueueHandle_t xQueue,
+                                        void ** ppvMessage,
+                                        BaseType_t * pxHigherPriorityTaskWoken )
+{
+    configASSERT( ppvMessage );
+
+    return xQueueReceiveFromISR( xQueue, ppvMessage, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include message pool functionality.  If you want to include message pools
+ * then ensure configUSE_MESSAGE_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MESSAGE_POOLS == 1 */
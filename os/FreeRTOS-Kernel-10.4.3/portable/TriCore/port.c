@@ -75,6 +75,10 @@
 
 #include "Ifx_Types.h"
 #include "IfxStm.h"
+#include "IfxCpu.h"
+#if ( configENABLE_TRICORE_PRS_ISOLATION == 1 )
+    #include "IfxScuWdt.h"
+#endif
 #if configCHECK_FOR_STACK_OVERFLOW > 0
     #error "Stack checking cannot be used with this port, as, unlike most ports, the pxTopOfStack member of the TCB is consumed CSA.  CSA starvation, loosely equivalent to stack overflow, will result in a trap exception."
     /* The stack pointer is accessible using portCSA_TO_ADDRESS( portCSA_TO_ADDRESS( pxCurrentTCB->pxTopOfStack )[ 0 ] )[ 2 ]; */
@@ -88,6 +92,12 @@
 #define portINITIAL_UNPRIVILEGED_PROGRAM_STATUS_WORD      ( 0x000010FFUL ) /* IO Level 0, MPU Register Set 1 and Call Depth Counting disabled. */
 #define portINITIAL_PCXI_UPPER_CONTEXT_WORD               ( 0x00300000UL ) /* The lower 20 bits identify the CSA address. */
 #define portINITIAL_SYSCON                                ( 0x00000000UL ) /* MPU Disable. */
+#define portSYSCON_PROTEN                                 ( 0x00000002UL ) /* MPU Enable. */
+
+/* PSW.PRS is split into bits 13:12 and PSW.PRS2 at bit 15. */
+#define portPSW_PRS_MASK                                  ( 0x0000B000UL )
+#define portPSW_PRS( uxSet )                              ( ( ( ( uxSet ) & 0x3UL ) << 12 ) | ( ( ( uxSet ) & 0x4UL ) << 13 ) )
+#define portPSW_TO_PRS( ulPSW )                           ( ( ( ( ulPSW ) >> 12 ) & 0x3UL ) | ( ( ( ulPSW ) >> 13 ) & 0x4UL ) )
 
 /* CSA manipulation macros. */
 #define portCSA_FCX_MASK                                  ( 0x000FFFFFUL )
@@ -196,6 +206,48 @@ IfxStm_CompareConfig g_STMConf[7];                                 /* STM config
 IfxSrc_Tos stm_tos[7] = {IfxSrc_Tos_cpu0,IfxSrc_Tos_cpu1,IfxSrc_Tos_cpu2,IfxSrc_Tos_cpu3,IfxSrc_Tos_cpu4,IfxSrc_Tos_dma,IfxSrc_Tos_cpu5};
 Ifx_TickTime g_ticksFor1ms;
 
+#if ( configUSE_PARTITIONS == 1 )
+
+/* Comparator 1 of the same STM ends the partition windows.  It is routed to
+ * the service request of the tick, so a window boundary and a tick are handled
+ * one after the other at ISR_PRIORITY_STM and never preempt each other. */
+IfxStm_CompareConfig g_STMPartitionConf[7];                        /* STM configuration structure of the windows        */
+boolean g_STMPartitionUsed[7];                                     /* TRUE on the cores that run partition windows      */
+Ifx_TickTime g_ticksFor1us;
+
+void vPortPartitionWindowHandler( void );
+
+#endif /* configUSE_PARTITIONS */
+
+/* On a core with partition windows the interrupt may come from either
+ * comparator.  Each flag is cleared before its work, so a match that follows
+ * requests the interrupt again. */
+TRICORE_CINLINE void prvSTMInterrupt(void)
+{
+    volatile Ifx_STM *const pxSTM = STM[portGET_CORE_ID()];
+
+    #if ( configUSE_PARTITIONS == 1 )
+    if( g_STMPartitionUsed[portGET_CORE_ID()] != FALSE )
+    {
+        if( IfxStm_isCompareFlagSet(pxSTM, IfxStm_Comparator_1) != FALSE )
+        {
+            IfxStm_clearCompareFlag(pxSTM, IfxStm_Comparator_1);
+            vPortPartitionWindowHandler();
+        }
+
+        if( IfxStm_isCompareFlagSet(pxSTM, IfxStm_Comparator_0) == FALSE )
+        {
+            return;
+        }
+
+        IfxStm_clearCompareFlag(pxSTM, IfxStm_Comparator_0);
+    }
+    #endif /* configUSE_PARTITIONS */
+
+    IfxStm_increaseCompare(pxSTM, g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
+    vPortSystemTickHandler();
+}
+
 IFX_INTERRUPT(isrSTM, 0, ISR_PRIORITY_STM);
 IFX_INTERRUPT(isrSTM1, 1, ISR_PRIORITY_STM);
 IFX_INTERRUPT(isrSTM2, 2, ISR_PRIORITY_STM);
@@ -204,37 +256,39 @@ IFX_INTERRUPT(isrSTM4, 4, ISR_PRIORITY_STM);
 IFX_INTERRUPT(isrSTM5, 5, ISR_PRIORITY_STM);
 void isrSTM(void)
 {
-    //__disable();
-    //portDISABLE_INTERRUPTS();
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
-    //portENABLE_INTERRUPTS();
-    //__enable();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 void isrSTM1(void)
 {
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 void isrSTM2(void)
 {
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 void isrSTM3(void)
 {
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 void isrSTM4(void)
 {
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 void isrSTM5(void)
 {
-    IfxStm_increaseCompare(STM[portGET_CORE_ID()], g_STMConf[portGET_CORE_ID()].comparator, g_ticksFor1ms);
-    vPortSystemTickHandler();
+    traceISR_ENTER();
+    prvSTMInterrupt();
+    traceISR_EXIT();
 }
 
 /* Function to initialize the STM */
@@ -251,7 +305,239 @@ void initSTM(void)
     g_STMConf[portGET_CORE_ID()].ticks = g_ticksFor1ms;              /* Set the number of ticks after which the timer triggers an
                                                      * interrupt for the first time                                 */
     IfxStm_initCompare(STM[portGET_CORE_ID()], &g_STMConf[portGET_CORE_ID()]);            /* Initialize the STM with the user configuration               */
+
+    #if ( configUSE_PARTITIONS == 1 )
+    {
+        uint32_t ulDuration = ulTaskGetPartitionWindowDuration();
+
+        /* Only cores with a window table use the second comparator.  On core 0
+           it is also the gate list of os_net_geth, which does not start while
+           the comparator is in use; the other order is caught here. */
+        if( ulDuration != 0UL )
+        {
+            configASSERT( STM[portGET_CORE_ID()]->ICR.B.CMP1EN == 0U );
+
+            g_ticksFor1us = IfxStm_getTicksFromMicroseconds(STM[portGET_CORE_ID()], 1);
+            IfxStm_initCompareConfig(&g_STMPartitionConf[portGET_CORE_ID()]);
+
+            g_STMPartitionConf[portGET_CORE_ID()].comparator = IfxStm_Comparator_1;
+            g_STMPartitionConf[portGET_CORE_ID()].comparatorInterrupt = IfxStm_ComparatorInterrupt_ir0;   /* The tick's service request, set up above */
+            g_STMPartitionConf[portGET_CORE_ID()].ticks = ( uint32 ) ( g_ticksFor1us * ulDuration );  /* The end of the first window */
+            IfxStm_initCompare(STM[portGET_CORE_ID()], &g_STMPartitionConf[portGET_CORE_ID()]);
+            g_STMPartitionUsed[portGET_CORE_ID()] = TRUE;
+        }
+    }
+    #endif /* configUSE_PARTITIONS */
+}
+#if ( configENABLE_TRICORE_PRS_ISOLATION == 1 )
+
+/* The MTCR address has to be an immediate, hence the unrolled selectors. */
+#define portSET_DPR_CASE( n )    case n: TriCore__mtcr( TRICORE_CPU_DPR0_L + ( 8 * n ), ulLower ); TriCore__mtcr( TRICORE_CPU_DPR0_L + ( 8 * n ) + 4, ulUpper ); break
+#define portSET_SET_CASE( n, re, we, xe )    case n: TriCore__mtcr( re, ulRead ); TriCore__mtcr( we, ulWrite ); TriCore__mtcr( xe, ulExecute ); break
+
+static void prvSetDataRange( unsigned long ulRange, unsigned long ulLower, unsigned long ulUpper )
+{
+    switch( ulRange )
+    {
+        portSET_DPR_CASE( 0 );  portSET_DPR_CASE( 1 );  portSET_DPR_CASE( 2 );
+        portSET_DPR_CASE( 3 );  portSET_DPR_CASE( 4 );  portSET_DPR_CASE( 5 );
+        portSET_DPR_CASE( 6 );  portSET_DPR_CASE( 7 );  portSET_DPR_CASE( 8 );
+        portSET_DPR_CASE( 9 );  portSET_DPR_CASE( 10 ); portSET_DPR_CASE( 11 );
+        portSET_DPR_CASE( 12 ); portSET_DPR_CASE( 13 ); portSET_DPR_CASE( 14 );
+        portSET_DPR_CASE( 15 ); portSET_DPR_CASE( 16 ); portSET_DPR_CASE( 17 );
+        default: break;
+    }
+}
+
+static void prvSetProtectionSet( unsigned long ulSet, unsigned long ulRead, unsigned long ulWrite, unsigned long ulExecute )
+{
+    switch( ulSet )
+    {
+        portSET_SET_CASE( 0, TRICORE_CPU_DPRE_0,     TRICORE_CPU_DPWE_0,     TRICORE_CPU_CPXE_0 );
+        portSET_SET_CASE( 1, TRICORE_CPU_DPRE_0 + 4, TRICORE_CPU_DPWE_0 + 4, TRICORE_CPU_CPXE_0 + 4 );
+        portSET_SET_CASE( 2, TRICORE_CPU_DPRE_0 + 8, TRICORE_CPU_DPWE_0 + 8, TRICORE_CPU_CPXE_0 + 8 );
+        portSET_SET_CASE( 3, TRICORE_CPU_DPRE_0 + 12, TRICORE_CPU_DPWE_0 + 12, TRICORE_CPU_CPXE_0 + 12 );
+        portSET_SET_CASE( 4, TRICORE_CPU_DPRE_4,     TRICORE_CPU_DPWE_4,     TRICORE_CPU_CPXE_4 );
+        portSET_SET_CASE( 5, TRICORE_CPU_DPRE_4 + 4, TRICORE_CPU_DPWE_4 + 4, TRICORE_CPU_CPXE_4 + 4 );
+        default: break;
+    }
+}
+
+/*
+ * Programs the protection ranges of the calling core.  Data range 0 covers the
+ * whole address space and is only enabled for the kernel set, code range 0
+ * covers the whole address space for every set.  The user ranges occupy data
+ * ranges 1 to 17.  Must be called before vTaskStartScheduler() on each core
+ * that uses isolation; nothing is reprogrammed afterwards.
+ */
+BaseType_t xPortProtectionConfigure( const PortProtectionConfig_t *pxConfig )
+{
+    unsigned long ulRead[ portNUM_PROTECTION_SETS ] = { 0UL };
+    unsigned long ulWrite[ portNUM_PROTECTION_SETS ] = { 0UL };
+    unsigned long ulRange, ulSet;
+    const unsigned long ulAllSets = portPROTECTION_SET_MASK( portNUM_PROTECTION_SETS ) - 1UL;
+    const PortProtectionRange_t *pxRange;
+    uint16 usPassword;
+
+    if( ( pxConfig == NULL ) || ( pxConfig->ulNumDataRanges > ( portNUM_DATA_PROTECTION_RANGES - 1UL ) ) )
+    {
+        return pdFAIL;
+    }
+
+    ulRead[ portKERNEL_PROTECTION_SET ] = 1UL;
+    ulWrite[ portKERNEL_PROTECTION_SET ] = 1UL;
+
+    for( ulRange = 0UL; ulRange < pxConfig->ulNumDataRanges; ulRange++ )
+    {
+        pxRange = &pxConfig->pxDataRanges[ ulRange ];
+
+        if( ( pxRange->ulStart >= pxRange->ulEnd ) || ( ( ( pxRange->ulReadSets | pxRange->ulWriteSets ) & ~ulAllSets ) != 0UL ) )
+        {
+            return pdFAIL;
+        }
+
+        for( ulSet = 0UL; ulSet < portNUM_PROTECTION_SETS; ulSet++ )
+        {
+            if( ( pxRange->ulReadSets & portPROTECTION_SET_MASK( ulSet ) ) != 0UL )
+            {
+                ulRead[ ulSet ] |= 1UL << ( ulRange + 1UL );
+            }
+            if( ( pxRange->ulWriteSets & portPROTECTION_SET_MASK( ulSet ) ) != 0UL )
+            {
+                ulWrite[ ulSet ] |= 1UL << ( ulRange + 1UL );
+            }
+        }
+    }
+
+    vPortSafetyEndinitLock();
+    usPassword = IfxScuWdt_getSafetyWatchdogPassword();
+    IfxScuWdt_clearSafetyEndinit( usPassword );
+    TriCore__disable();
+    {
+        TriCore__dsync();
+
+        /* Ranges are [lower, upper) with 8 byte (data) and 32 byte (code) granularity. */
+        prvSetDataRange( 0UL, 0x00000000UL, 0xFFFFFFF8UL );
+        for( ulRange = 0UL; ulRange < pxConfig->ulNumDataRanges; ulRange++ )
+        {
+            pxRange = &pxConfig->pxDataRanges[ ulRange ];
+            prvSetDataRange( ulRange + 1UL, pxRange->ulStart & ~0x7UL, ( pxRange->ulEnd + 0x7UL ) & ~0x7UL );
+        }
+        TriCore__mtcr( TRICORE_CPU_CPR0_L, 0x00000000UL );
+        TriCore__mtcr( TRICORE_CPU_CPR0_L + 4, 0xFFFFFFE0UL );
+
+        for( ulSet = 0UL; ulSet < portNUM_PROTECTION_SETS; ulSet++ )
+        {
+            prvSetProtectionSet( ulSet, ulRead[ ulSet ], ulWrite[ ulSet ], 1UL );
+        }
+
+        TriCore__mtcr( TRICORE_CPU_SYSCON, TriCore__mfcr( TRICORE_CPU_SYSCON ) | portSYSCON_PROTEN );
+        TriCore__isync();
+    }
+    TriCore__enable();
+    IfxScuWdt_setSafetyEndinit( usPassword );
+    vPortSafetyEndinitUnlock();
+
+    return pdPASS;
 }
+/*-----------------------------------------------------------*/
+
+/*
+ * The PSW of a task that is not running lives in the upper context linked from
+ * the lower context that pxTopOfStack refers to; this holds for a freshly
+ * initialised task as well as for one switched out by prvYield(), from either
+ * the tick interrupt or vPortYield().
+ */
+static unsigned long *prvTaskSavedPSW( struct tskTaskControlBlock *xTask )
+{
+    unsigned long *pulLowerCSA = portCSA_TO_ADDRESS( *( ( unsigned long * ) xTask ) );
+
+    return &( portCSA_TO_ADDRESS( pulLowerCSA[ 0 ] )[ 1 ] );
+}
+
+void vPortSetTaskProtectionSet( struct tskTaskControlBlock *xTask, UBaseType_t uxSet )
+{
+    unsigned long ulPSW;
+    unsigned long *pulPSW;
+
+    configASSERT( uxSet < portNUM_PROTECTION_SETS );
+
+    if( ( xTask == NULL ) || ( ( unsigned long * ) xTask == pxCurrentTCB ) )
+    {
+        /* The running task: update the live PSW, it is saved with the upper
+        context on the next switch. */
+        TriCore__disable();
+        ulPSW = TriCore__mfcr( TRICORE_CPU_PSW );
+        ulPSW = ( ulPSW & ~portPSW_PRS_MASK ) | portPSW_PRS( uxSet );
+        TriCore__dsync();
+        TriCore__mtcr( TRICORE_CPU_PSW, ulPSW );
+        TriCore__isync();
+        TriCore__enable();
+    }
+    else
+    {
+        portENTER_CRITICAL();
+        {
+            pulPSW = prvTaskSavedPSW( xTask );
+            *pulPSW = ( *pulPSW & ~portPSW_PRS_MASK ) | portPSW_PRS( uxSet );
+            TriCore__dsync();
+        }
+        portEXIT_CRITICAL();
+    }
+}
+
+UBaseType_t uxPortGetTaskProtectionSet( struct tskTaskControlBlock *xTask )
+{
+    unsigned long ulPSW;
+
+    if( ( xTask == NULL ) || ( ( unsigned long * ) xTask == pxCurrentTCB ) )
+    {
+        ulPSW = TriCore__mfcr( TRICORE_CPU_PSW );
+    }
+    else
+    {
+        portENTER_CRITICAL();
+        {
+            ulPSW = *prvTaskSavedPSW( xTask );
+        }
+        portEXIT_CRITICAL();
+    }
+
+    return ( UBaseType_t ) portPSW_TO_PRS( ulPSW );
+}
+
+#endif /* configENABLE_TRICORE_PRS_ISOLATION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+/* Bound on the CSA chain walk, a deeper chain is reported as this value. */
+#define portMAX_CONTEXT_DEPTH                             ( 64UL )
+
+void vPortGetTaskContextUsage( const struct tskTaskControlBlock *xTask, StackType_t **ppxStackPointer, UBaseType_t *puxContextDepth )
+{
+    unsigned long ulLink = *( ( const unsigned long * ) xTask ) & portCSA_FCX_MASK;
+    unsigned long *pulUpperCSA;
+    UBaseType_t uxDepth = 0UL;
+
+    /* The lower context that pxTopOfStack refers to links to the upper
+    context of the switched out code, whose A10 is the saved stack pointer. */
+    pulUpperCSA = portCSA_TO_ADDRESS( portCSA_TO_ADDRESS( ulLink )[ 0 ] & portCSA_FCX_MASK );
+    *ppxStackPointer = ( StackType_t * ) pulUpperCSA[ 2 ];
+
+    /* Every call level of the task holds one CSA. */
+    while( ( ulLink != 0UL ) && ( uxDepth < portMAX_CONTEXT_DEPTH ) )
+    {
+        uxDepth++;
+        ulLink = portCSA_TO_ADDRESS( ulLink )[ 0 ] & portCSA_FCX_MASK;
+    }
+
+    *puxContextDepth = uxDepth;
+}
+
+#endif /* configUSE_TASK_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
 BaseType_t xPortStartScheduler( void )
 {
     unsigned long ulMFCR = 0UL;
@@ -263,7 +549,12 @@ BaseType_t xPortStartScheduler( void )
     TriCore__disable();
     {
         /* Load the initial SYSCON. */
-        TriCore__mtcr( TRICORE_CPU_SYSCON, portINITIAL_SYSCON );
+        #if ( configENABLE_TRICORE_PRS_ISOLATION == 1 )
+            /* Keep the protection enabled by xPortProtectionConfigure(). */
+            TriCore__mtcr( TRICORE_CPU_SYSCON, portINITIAL_SYSCON | ( TriCore__mfcr( TRICORE_CPU_SYSCON ) & portSYSCON_PROTEN ) );
+        #else
+            TriCore__mtcr( TRICORE_CPU_SYSCON, portINITIAL_SYSCON );
+        #endif
         TriCore__isync();
 
         /* ENDINIT has already been applied in the 'cstart.c' code. */
@@ -369,6 +660,34 @@ TRICORE_NOINLINE void vPortSystemTickHandler( void )
         prvYield();
     }
 }
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PARTITIONS == 1 )
+
+TRICORE_NOINLINE void vPortPartitionWindowHandler( void )
+{
+    BaseType_t xYieldRequired = pdFALSE;
+    uint32_t ulDuration;
+
+    /* The kernel masks interrupts itself while it changes windows. */
+    ulDuration = ulTaskNextPartitionWindowFromISR( &xYieldRequired );
+
+    /* Advance from the previous compare value rather than from the current
+       time, so interrupt latency does not accumulate into the major frame. */
+    if( ulDuration != 0UL )
+    {
+        IfxStm_increaseCompare(STM[portGET_CORE_ID()], IfxStm_Comparator_1, ( uint32 ) ( g_ticksFor1us * ulDuration ));
+    }
+
+    /* With a tick due in the same interrupt, the tick handler switches once
+       for both: the kernel left xYieldPending set. */
+    if( ( xYieldRequired != pdFALSE ) && ( IfxStm_isCompareFlagSet(STM[portGET_CORE_ID()], IfxStm_Comparator_0) == FALSE ) )
+    {
+        prvYield();
+    }
+}
+
+#endif /* configUSE_PARTITIONS */
 
 /*-----------------------------------------------------------*/
 
@@ -488,8 +807,15 @@ unsigned long uxPortSetInterruptMaskFromISR( void )
 
     TriCore__disable();
     uxReturn = TriCore__mfcr( TRICORE_CPU_ICR );
-    TriCore__mtcr( TRICORE_CPU_ICR, ( ( uxReturn & ~portCCPN_MASK ) | configMAX_SYSCALL_INTERRUPT_PRIORITY ) );
-    TriCore__isync();
+
+    /* Only ever raise the mask.  An interrupt above
+       configMAX_SYSCALL_INTERRUPT_PRIORITY, such as the tick, keeps its own
+       level, so its source cannot enter it again inside the kernel. */
+    if( ( uxReturn & portCCPN_MASK ) < configMAX_SYSCALL_INTERRUPT_PRIORITY )
+    {
+        TriCore__mtcr( TRICORE_CPU_ICR, ( ( uxReturn & ~portCCPN_MASK ) | configMAX_SYSCALL_INTERRUPT_PRIORITY ) );
+        TriCore__isync();
+    }
     TriCore__enable();
 
     /* Return just the interrupt mask bits. */
@@ -497,6 +823,23 @@ unsigned long uxPortSetInterruptMaskFromISR( void )
 }
 /*-----------------------------------------------------------*/
 
+/* The safety ENDINIT is shared by all cores. */
+static IfxCpu_spinLock xSafetyEndinitLock = 0;
+
+void vPortSafetyEndinitLock( void )
+{
+    while( IfxCpu_setSpinLock( &xSafetyEndinitLock, 0xFFFFFFFFUL ) == FALSE )
+    {
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSafetyEndinitUnlock( void )
+{
+    IfxCpu_resetSpinLock( &xSafetyEndinitLock );
+}
+/*-----------------------------------------------------------*/
+
 __attribute__((__noreturn__)) void vPortLoopForever(void)
 {
 	while(1);
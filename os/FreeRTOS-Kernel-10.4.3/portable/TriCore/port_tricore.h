@@ -59,6 +59,17 @@
 #define TRICORE_CPU_PCXI   0xFE00
 #define TRICORE_CPU_CORE_ID 0xFE1C
 
+/* Memory protection registers. DPRn_L/U and CPRn_L/U are 8 bytes apart, the
+ * enable registers of sets 4 and 5 are located after a gap. */
+#define TRICORE_CPU_DPR0_L  0xC000
+#define TRICORE_CPU_CPR0_L  0xD000
+#define TRICORE_CPU_CPXE_0  0xE000
+#define TRICORE_CPU_DPRE_0  0xE010
+#define TRICORE_CPU_DPWE_0  0xE020
+#define TRICORE_CPU_CPXE_4  0xE040
+#define TRICORE_CPU_DPRE_4  0xE050
+#define TRICORE_CPU_DPWE_4  0xE060
+
 /******************************************************************************
  *                         Compiler Specific Defines                          *
  *****************************************************************************/
@@ -83,6 +94,16 @@
 #define TriCore__debug( )                           _debug( )
 #define TriCore__nop( )                             _nop( )
 #define TriCore__mem_barrier( )                     __asm__ volatile("":::"memory")
+#define TriCore__aligned( n )                       __attribute__ ((aligned(n)))
+
+/* Atomic compare and swap of a word, returns the previous value. */
+TRICORE_CINLINE unsigned long TriCore__cmpswap( volatile unsigned long *address, unsigned long value, unsigned long comparand )
+{
+    __extension__ unsigned long long reg64 = value | ( ( unsigned long long ) comparand << 32 );
+
+    __asm__ volatile( "cmpswap.w [%[addr]]0, %A[reg]" : [reg] "+d" ( reg64 ) : [addr] "a" ( address ) : "memory" );
+    return ( unsigned long ) reg64;
+}
 
 /******************************************************************************
  *                              GNUC Macros END                               *
@@ -106,6 +127,8 @@
 #define TriCore__debug( )                           __debug( )
 #define TriCore__nop( )                             __nop( )
 #define TriCore__mem_barrier( )                     __asm ("":::"memory")
+#define TriCore__aligned( n )                       __attribute__ ((__align(n)))
+#define TriCore__cmpswap( address, value, comparand ) __cmpswapw( ( volatile unsigned int * )( address ), ( value ), ( comparand ) )
 
 /******************************************************************************
  *                             TASKING Macros END                             *
@@ -133,6 +156,15 @@
 #define TriCore__debug( )                           __debug( )
 #define TriCore__nop( )                             __nop( )
 #define TriCore__mem_barrier( )                     __asm__ volatile("":::"memory")
+#define TriCore__aligned( n )                       __attribute__ ((aligned(n)))
+
+TRICORE_CINLINE unsigned long TriCore__cmpswap( volatile unsigned long *address, unsigned long value, unsigned long comparand )
+{
+    unsigned long long reg64 = value | ( ( unsigned long long ) comparand << 32 );
+
+    __asm__ volatile( "cmpswap.w [%[addr]]0, %A[reg]" : [reg] "+d" ( reg64 ) : [addr] "a" ( address ) : "memory" );
+    return ( unsigned long ) reg64;
+}
 
 /******************************************************************************
  *                               GHS Macros END                               *
@@ -162,6 +194,16 @@ extern void TriCore__syscall( const unsigned int)     __attribute__((intrinsic_f
 extern void TriCore__debug( void )                    __attribute__((intrinsic_function(0x103, 0, "debug") ));
 extern void TriCore__nop( void )                      __attribute__((intrinsic_function(0x103, 0, "nop") ));
 extern void TriCore__mem_barrier( void)               __attribute__((intrinsic_function(0x103, 4, "diabmbar") ));
+#define TriCore__aligned( n )                       __attribute__ ((aligned(n)))
+
+asm volatile unsigned long TriCore__cmpswap( volatile unsigned long *address, unsigned long value, unsigned long comparand )
+{
+%reg address, value, comparand
+! "%d2", "%d3"
+  mov %d2, value
+  mov %d3, comparand
+  cmpswap.w [address]0, %e2
+}
 
 /******************************************************************************
  *                               DCC Macros END                               *
@@ -159,6 +159,62 @@ typedef unsigned long UBaseType_t;
 
 typedef struct MPU_SETTINGS { unsigned long  ulNotUsed; } xMPU_SETTINGS;
 
+/* The TCB is opaque to the port; the protection set and context usage
+functions below take it by pointer. */
+struct tskTaskControlBlock;
+
+/* Protection register set (PRS) isolation.
+
+When enabled, each task group is mapped to one of the TriCore protection
+register sets.  The data and code ranges are programmed once per core by
+xPortProtectionConfigure() before the scheduler starts.  The PRS is a field of
+the PSW, which is part of the upper context, so switching between tasks of
+different groups costs nothing beyond the existing context switch.
+
+PRS 0 is the kernel set: interrupts and traps always execute with PRS 0 and it
+is given unrestricted data access.  Tasks start in PRS 0 and are moved to their
+group with vPortSetTaskProtectionSet().  Tasks still execute in supervisor mode
+(the critical section macros need MTCR), so the isolation contains stray
+accesses but does not stop a task from deliberately rewriting its PSW. */
+#ifndef configENABLE_TRICORE_PRS_ISOLATION
+	#define configENABLE_TRICORE_PRS_ISOLATION		0
+#endif
+
+#define portNUM_PROTECTION_SETS					( 6UL )
+#define portNUM_DATA_PROTECTION_RANGES			( 18UL )
+#define portNUM_CODE_PROTECTION_RANGES			( 10UL )
+#define portKERNEL_PROTECTION_SET				( 0UL )
+#define portPROTECTION_SET_MASK( uxSet )		( 1UL << ( uxSet ) )
+
+#if ( configENABLE_TRICORE_PRS_ISOLATION == 1 )
+
+	/* One data range, [ulStart, ulEnd), with 8 byte granularity.  The masks hold
+	one bit per protection set, see portPROTECTION_SET_MASK(). */
+	typedef struct xPORT_PROTECTION_RANGE
+	{
+		unsigned long ulStart;
+		unsigned long ulEnd;
+		unsigned long ulReadSets;
+		unsigned long ulWriteSets;
+	} PortProtectionRange_t;
+
+	/* The ranges shared by every group (kernel data, heap, CSA pool and the
+	stacks handed to the kernel) must be listed with all set bits, because kernel
+	code called from a task runs with that task's PRS.  One data range and one
+	code range are reserved by the port for the kernel set and for code fetch. */
+	typedef struct xPORT_PROTECTION_CONFIG
+	{
+		const PortProtectionRange_t *pxDataRanges;
+		unsigned long ulNumDataRanges;
+	} PortProtectionConfig_t;
+
+	BaseType_t xPortProtectionConfigure( const PortProtectionConfig_t *pxConfig );
+	/* xTask is a TaskHandle_t; NULL selects the calling task. */
+	void vPortSetTaskProtectionSet( struct tskTaskControlBlock *xTask, UBaseType_t uxSet );
+	UBaseType_t uxPortGetTaskProtectionSet( struct tskTaskControlBlock *xTask );
+
+#endif /* configENABLE_TRICORE_PRS_ISOLATION */
+
 /* Define away the instruction from the Restore Context Macro. */
 #define portPRIVILEGE_BIT							0x0UL
 
@@ -232,6 +288,12 @@ extern __attribute__((__noreturn__)) void vPortLoopForever(void);
 extern unsigned long  uxPortSetInterruptMaskFromISR( void );
 #define portSET_INTERRUPT_MASK_FROM_ISR() 	uxPortSetInterruptMaskFromISR()
 
+/* Spinlock held across every clear/set of the safety ENDINIT, which all cores
+share.  Hold it inside a critical section so the core is not preempted while
+the other cores wait. */
+extern void vPortSafetyEndinitLock( void );
+extern void vPortSafetyEndinitUnlock( void );
+
 /* As this port holds a CSA address in pxTopOfStack, the assert that checks the
 pxTopOfStack alignment is removed. */
 #define portALIGNMENT_ASSERT_pxCurrentTCB ( void )
@@ -252,10 +314,43 @@ void vPortReclaimCSA( unsigned long *pxTCB );
 #define portCLEAN_UP_TCB( pxTCB )		vPortReclaimCSA( ( unsigned long * ) ( pxTCB ) )
 
 #define portMEMORY_BARRIER() TriCore__mem_barrier()
+#define portDATA_SYNC_BARRIER()		{ TriCore__mem_barrier(); TriCore__dsync(); }
+
+/* Word compare and swap that is atomic across all cores (CMPSWAP.W).  Returns
+the value found at pulDestination; the swap took place if it equals
+ulComparand. */
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand )	\
+	( ( uint32_t ) TriCore__cmpswap( ( volatile unsigned long * ) ( pulDestination ), ( unsigned long ) ( ulExchange ), ( unsigned long ) ( ulComparand ) ) )
+
+/* Size of a data cache line of the TC3xx CPUs.  Data that different cores
+write is kept on separate lines. */
+#define portCACHE_LINE_SIZE		32
+#define portCACHE_ALIGNED		TriCore__aligned( portCACHE_LINE_SIZE )
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	/* Run time is counted in STM0 ticks on every core.  STM0 runs from the same
+	clock whatever the CPU dividers are set to, so run times stay comparable
+	between cores and across CPU frequency changes. */
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+	#define portSTM0_TIM0							( 0xF0001010UL )
+	#define portGET_RUN_TIME_COUNTER_VALUE()		( *( volatile unsigned long * ) portSTM0_TIM0 )
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+	/* Reads the stack pointer saved in the upper context of a task that is not
+	running, and the number of CSAs its call chain holds. */
+	void vPortGetTaskContextUsage( const struct tskTaskControlBlock *xTask, StackType_t **ppxStackPointer, UBaseType_t *puxContextDepth );
+	#define portGET_TASK_CONTEXT_USAGE( pxTCB, ppxStackPointer, puxContextDepth )		\
+		vPortGetTaskContextUsage( ( const struct tskTaskControlBlock * ) ( pxTCB ), ( ppxStackPointer ), ( puxContextDepth ) )
+#endif /* configUSE_TASK_SNAPSHOT */
+
+/* Non-zero while the core runs an interrupt handler: PSW.IS is set on the
+interrupt stack. */
+#define portIS_INSIDE_INTERRUPT()		( ( TriCore__mfcr(TRICORE_CPU_PSW) & ( 1U << 9U ) ) != 0x00000000U )
 
 TRICORE_CINLINE void vPortAssertIfInISR(void)
 {
-	configASSERT( ( TriCore__mfcr(TRICORE_CPU_PSW) & ( 1U << 9U ) ) == 0x00000000U);
+	configASSERT( portIS_INSIDE_INTERRUPT() == 0 );
 }
 
 #ifdef __cplusplus
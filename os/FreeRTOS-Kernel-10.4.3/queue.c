@@ -40,6 +40,10 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_EVENT_MUX == 1 )
+    #include "event_mux.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -124,6 +128,10 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         struct QueueDefinition * pxQueueSetContainer;
     #endif
 
+    #if ( configUSE_EVENT_MUX == 1 )
+        EventMuxSource_t * volatile pxEventMuxSource; /*< The event multiplexer source the queue is registered as, or NULL. */
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
@@ -201,6 +209,43 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copy uxItemCount consecutive items to the back of the queue, or out of the
+ * front of the queue, with at most two memcpy() calls each - one up to the end
+ * of the storage area and one from its start.  The caller has checked there is
+ * enough space or data.  Must be called from a critical section.
+ */
+static void prvCopyBlockToQueue( Queue_t * const pxQueue,
+                                 const void * pvItemsToQueue,
+                                 const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static void prvCopyBlockFromQueue( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove up to uxItemCount tasks from pxEventList, one for each item that was
+ * moved into or out of the queue.  Returns pdTRUE if any of the unblocked tasks
+ * has a priority above that of the running task.
+ */
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList,
+                                          UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Notify the queue set the queue belongs to, or the tasks waiting to receive
+ * from the queue, that uxItemCount items were added.  Returns pdTRUE if a
+ * context switch is required.
+ */
+static BaseType_t prvNotifyItemsAdded( Queue_t * const pxQueue,
+                                       UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add uxItemCount to the count held in cTxLock or cRxLock while the queue is
+ * locked.  Each count unblocks at most one task when the queue is unlocked, so
+ * the count saturates instead of overflowing.
+ */
+static int8_t prvAddToLockCount( const int8_t cLockCount,
+                                 const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -210,6 +255,15 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
     static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_EVENT_MUX == 1 )
+
+/*
+ * Level check used for queues registered level triggered with an event
+ * multiplexer.
+ */
+    static BaseType_t prvQueueHoldsData( void * pvQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Called after a Queue_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -483,6 +537,12 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
         }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_EVENT_MUX == 1 )
+        {
+            pxNewQueue->pxEventMuxSource = NULL;
+        }
+    #endif /* configUSE_EVENT_MUX */
+
     traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -773,7 +833,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                               TickType_t xTicksToWait,
                               const BaseType_t xCopyPosition )
 {
-    BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+    BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired, xSwitchRequired;
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
 
@@ -801,6 +861,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             {
                 traceQUEUE_SEND( pxQueue );
 
+                xSwitchRequired = pdFALSE;
+
                 #if ( configUSE_QUEUE_SETS == 1 )
                     {
                         const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -821,7 +883,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                                 /* The queue is a member of a queue set, and posting
                                  * to the queue set caused a higher priority task to
                                  * unblock. A context switch is required. */
-                                queueYIELD_IF_USING_PREEMPTION();
+                                xSwitchRequired = pdTRUE;
                             }
                             else
                             {
@@ -837,10 +899,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                                 if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                                 {
                                     /* The unblocked task has a priority higher than
-                                     * our own so yield immediately.  Yes it is ok to
-                                     * do this from within the critical section - the
-                                     * kernel takes care of that. */
-                                    queueYIELD_IF_USING_PREEMPTION();
+                                     * our own so a yield is required. */
+                                    xSwitchRequired = pdTRUE;
                                 }
                                 else
                                 {
@@ -853,7 +913,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                                  * executed if the task was holding multiple mutexes
                                  * and the mutexes were given back in an order that is
                                  * different to that in which they were taken. */
-                                queueYIELD_IF_USING_PREEMPTION();
+                                xSwitchRequired = pdTRUE;
                             }
                             else
                             {
@@ -872,10 +932,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                             if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
                                 /* The unblocked task has a priority higher than
-                                 * our own so yield immediately.  Yes it is ok to do
-                                 * this from within the critical section - the kernel
-                                 * takes care of that. */
-                                queueYIELD_IF_USING_PREEMPTION();
+                                 * our own so a yield is required. */
+                                xSwitchRequired = pdTRUE;
                             }
                             else
                             {
@@ -888,7 +946,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                              * executed if the task was holding multiple mutexes and
                              * the mutexes were given back in an order that is
                              * different to that in which they were taken. */
-                            queueYIELD_IF_USING_PREEMPTION();
+                            xSwitchRequired = pdTRUE;
                         }
                         else
                         {
@@ -897,6 +955,34 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                     }
                 #endif /* configUSE_QUEUE_SETS */
 
+                #if ( configUSE_EVENT_MUX == 1 )
+                    {
+                        /* The multiplexer is signalled once the item is in the
+                         * queue, as the yield below switches to a woken waiter
+                         * at once. */
+                        if( ( pxQueue->pxEventMuxSource != NULL ) && ( xEventMuxInternalSignal( pxQueue->pxEventMuxSource ) != pdFALSE ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_EVENT_MUX */
+
+                /* One yield for the waiter, the queue set and the multiplexer.
+                 * Yielding from within the critical section is ok - the kernel
+                 * takes care of that. */
+                if( xSwitchRequired != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
                 taskEXIT_CRITICAL();
                 return pdPASS;
             }
@@ -1030,6 +1116,25 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
              *  the scheduler is suspended before accessing the ready lists. */
             ( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
+            #if ( configUSE_EVENT_MUX == 1 )
+                {
+                    /* Signalled once the item is in the queue.  The multiplexer
+                     * has no queue lock to respect, its lists are only ever
+                     * accessed with interrupts masked. */
+                    if( pxQueue->pxEventMuxSource != NULL )
+                    {
+                        if( ( xEventMuxInternalSignal( pxQueue->pxEventMuxSource ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            #endif /* configUSE_EVENT_MUX */
+
             /* The event list is not altered if the queue is locked.  This will
              * be done when the queue is unlocked later. */
             if( cTxLock == queueUNLOCKED )
@@ -1208,6 +1313,25 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
              * messages (semaphores) available. */
             pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
 
+            #if ( configUSE_EVENT_MUX == 1 )
+                {
+                    /* Signalled once the item is in the queue.  The multiplexer
+                     * has no queue lock to respect, its lists are only ever
+                     * accessed with interrupts masked. */
+                    if( pxQueue->pxEventMuxSource != NULL )
+                    {
+                        if( ( xEventMuxInternalSignal( pxQueue->pxEventMuxSource ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            #endif /* configUSE_EVENT_MUX */
+
             /* The event list is not altered if the queue is locked.  This will
              * be done when the queue is unlocked later. */
             if( cTxLock == queueUNLOCKED )
@@ -1923,133 +2047,565 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
-                              void * const pvBuffer )
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                const void * const pvItemsToQueue,
+                                const UBaseType_t uxItemCount,
+                                TickType_t xTicksToWait )
 {
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-    int8_t * pcOriginalReadPosition;
+    BaseType_t xEntryTimeSet = pdFALSE, xSwitchRequired;
+    TimeOut_t xTimeOut;
+    UBaseType_t uxItemsSent;
     Queue_t * const pxQueue = xQueue;
 
     configASSERT( pxQueue );
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+    configASSERT( pvItemsToQueue );
+    configASSERT( uxItemCount > ( UBaseType_t ) 0 );
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+    /* Semaphores and mutexes carry no data to batch. */
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+    #endif
 
-    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    /*lint -save -e904 This function relaxes the coding standard somewhat to
+     * allow return statements within the function itself.  This is done in the
+     * interest of execution time efficiency. */
+    for( ; ; )
     {
-        /* Cannot block in an ISR, so check there is data available. */
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        taskENTER_CRITICAL();
         {
-            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+            /* Send as many of the items as there is room for now. */
+            uxItemsSent = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
 
-            /* Remember the read position so it can be reset as nothing is
-             * actually being removed from the queue. */
-            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+            if( uxItemsSent > uxItemCount )
+            {
+                uxItemsSent = uxItemCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-            xReturn = pdPASS;
-        }
-        else
-        {
-            xReturn = pdFAIL;
-            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
-        }
-    }
-    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+            if( uxItemsSent > ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_SEND( pxQueue );
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+                prvCopyBlockToQueue( pxQueue, pvItemsToQueue, uxItemsSent );
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
+                xSwitchRequired = prvNotifyItemsAdded( pxQueue, uxItemsSent );
 
-    configASSERT( xQueue );
+                #if ( configUSE_EVENT_MUX == 1 )
+                    {
+                        /* Signalled once the block is in the queue, as the
+                         * yield below switches to a woken waiter at once. */
+                        if( ( pxQueue->pxEventMuxSource != NULL ) && ( xEventMuxInternalSignal( pxQueue->pxEventMuxSource ) != pdFALSE ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_EVENT_MUX */
 
-    taskENTER_CRITICAL();
-    {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-    }
-    taskEXIT_CRITICAL();
+                /* One yield for the whole block, its waiters and the
+                 * multiplexer.  Yielding from within the critical section is
+                 * ok - the kernel takes care of that. */
+                if( xSwitchRequired != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+                taskEXIT_CRITICAL();
+                return uxItemsSent;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was full and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
+                    traceQUEUE_SEND_FAILED( pxQueue );
+                    return 0;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
+        /* Block until there is room for at least one item, as
+         * xQueueGenericSend() does. */
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
 
-    configASSERT( pxQueue );
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
 
-    taskENTER_CRITICAL();
-    {
-        uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
-    }
-    taskEXIT_CRITICAL();
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
+            }
+            else
+            {
+                /* Try again. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* The timeout has expired. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
 
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+            traceQUEUE_SEND_FAILED( pxQueue );
+            return 0;
+        }
+    } /*lint -restore */
+}
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                       const void * const pvItemsToQueue,
+                                       const UBaseType_t uxItemCount,
+                                       BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    UBaseType_t uxReturn;
+    UBaseType_t uxItemsSent;
+    UBaseType_t uxSavedInterruptStatus;
     Queue_t * const pxQueue = xQueue;
 
     configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
-
-    return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+    configASSERT( pvItemsToQueue );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-void vQueueDelete( QueueHandle_t xQueue )
-{
-    Queue_t * const pxQueue = xQueue;
+    /* See the comment in xQueueGenericSendFromISR(). */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-    configASSERT( pxQueue );
-    traceQUEUE_DELETE( pxQueue );
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        uxItemsSent = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
 
-    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+        if( uxItemsSent > uxItemCount )
         {
-            vQueueUnregisterQueue( pxQueue );
+            uxItemsSent = uxItemCount;
         }
-    #endif
-
-    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        else
         {
-            /* The queue can only have been allocated dynamically - free it
-             * again. */
-            vPortFree( pxQueue );
+            mtCOVERAGE_TEST_MARKER();
         }
-    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+        if( uxItemsSent > ( UBaseType_t ) 0 )
         {
-            /* The queue could have been allocated statically or dynamically, so
-             * check before attempting to free the memory. */
-            if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-            {
-                vPortFree( pxQueue );
-            }
+            const int8_t cTxLock = pxQueue->cTxLock;
+
+            traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+            prvCopyBlockToQueue( pxQueue, pvItemsToQueue, uxItemsSent );
+
+            #if ( configUSE_EVENT_MUX == 1 )
+                {
+                    /* Signalled once the block is in the queue. */
+                    if( pxQueue->pxEventMuxSource != NULL )
+                    {
+                        if( ( xEventMuxInternalSignal( pxQueue->pxEventMuxSource ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            #endif /* configUSE_EVENT_MUX */
+
+            /* The event list is not altered if the queue is locked.  This will
+             * be done when the queue is unlocked later. */
+            if( cTxLock == queueUNLOCKED )
+            {
+                if( ( prvNotifyItemsAdded( pxQueue, uxItemsSent ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                pxQueue->cTxLock = prvAddToLockCount( cTxLock, uxItemsSent );
+            }
+        }
+        else
+        {
+            traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return uxItemsSent;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxMaxItems,
+                                   TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    UBaseType_t uxItemsReceived;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    configASSERT( pvBuffer );
+    configASSERT( uxMaxItems > ( UBaseType_t ) 0 );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+    #endif
+
+    /*lint -save -e904  This function relaxes the coding standard somewhat to
+     * allow return statements within the function itself.  This is done in the
+     * interest of execution time efficiency. */
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            uxItemsReceived = pxQueue->uxMessagesWaiting;
+
+            if( uxItemsReceived > uxMaxItems )
+            {
+                uxItemsReceived = uxMaxItems;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxItemsReceived > ( UBaseType_t ) 0 )
+            {
+                prvCopyBlockFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting -= uxItemsReceived;
+
+                /* Each item removed makes room for one waiting sender. */
+                if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                taskEXIT_CRITICAL();
+                return uxItemsReceived;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    taskEXIT_CRITICAL();
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return 0;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Block until at least one item is available, as xQueueReceive()
+         * does. */
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The queue contains data again.  Loop back to try and read the
+                 * data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* Timed out.  If there is no data in the queue exit, otherwise loop
+             * back and attempt to read the data. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                return 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    } /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxMaxItems,
+                                          BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    UBaseType_t uxItemsReceived;
+    UBaseType_t uxSavedInterruptStatus;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    configASSERT( pvBuffer );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    /* See the comment in xQueueReceiveFromISR(). */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        uxItemsReceived = pxQueue->uxMessagesWaiting;
+
+        if( uxItemsReceived > uxMaxItems )
+        {
+            uxItemsReceived = uxMaxItems;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( uxItemsReceived > ( UBaseType_t ) 0 )
+        {
+            const int8_t cRxLock = pxQueue->cRxLock;
+
+            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+            prvCopyBlockFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+            pxQueue->uxMessagesWaiting -= uxItemsReceived;
+
+            /* If the queue is locked the event list will not be modified.
+             * Instead update the lock count so the task that unlocks the queue
+             * will know that an ISR has removed data while the queue was
+             * locked. */
+            if( cRxLock == queueUNLOCKED )
+            {
+                if( ( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                pxQueue->cRxLock = prvAddToLockCount( cRxLock, uxItemsReceived );
+            }
+        }
+        else
+        {
+            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return uxItemsReceived;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
+                              void * const pvBuffer )
+{
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+    int8_t * pcOriginalReadPosition;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        /* Cannot block in an ISR, so check there is data available. */
+        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        {
+            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+            /* Remember the read position so it can be reset as nothing is
+             * actually being removed from the queue. */
+            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    configASSERT( xQueue );
+
+    taskENTER_CRITICAL();
+    {
+        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+    }
+    taskEXIT_CRITICAL();
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+
+    taskENTER_CRITICAL();
+    {
+        uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+    }
+    taskEXIT_CRITICAL();
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    uxReturn = pxQueue->uxMessagesWaiting;
+
+    return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+    Queue_t * const pxQueue = xQueue;
+
+    configASSERT( pxQueue );
+    traceQUEUE_DELETE( pxQueue );
+
+    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+        {
+            vQueueUnregisterQueue( pxQueue );
+        }
+    #endif
+
+    #if ( configUSE_EVENT_MUX == 1 )
+        {
+            if( pxQueue->pxEventMuxSource != NULL )
+            {
+                vEventMuxRemove( pxQueue->pxEventMuxSource );
+            }
+        }
+    #endif
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The queue can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxQueue );
+        }
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The queue could have been allocated statically or dynamically, so
+             * check before attempting to free the memory. */
+            if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxQueue );
+            }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
@@ -2227,6 +2783,185 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyBlockToQueue( Queue_t * const pxQueue,
+                                 const void * pvItemsToQueue,
+                                 const UBaseType_t uxItemCount )
+{
+    const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+    size_t xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo ); /*lint !e946 !e9033 Pointer subtraction within the queue storage area. */
+
+    /* This function is called from a critical section. */
+
+    if( xFirstBytes > xBytes )
+    {
+        xFirstBytes = xBytes;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+
+    if( xFirstBytes < xBytes )
+    {
+        /* The block wraps around the end of the storage area. */
+        ( void ) memcpy( ( void * ) pxQueue->pcHead, ( ( const uint8_t * ) pvItemsToQueue ) + xFirstBytes, xBytes - xFirstBytes ); /*lint !e961 !e418 !e9087 !e9016 MISRA exception as the casts are only redundant for some ports. */
+        pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstBytes );                                                      /*lint !e9016 Pointer arithmetic on char types ok. */
+    }
+    else
+    {
+        pxQueue->pcWriteTo += xFirstBytes; /*lint !e9016 Pointer arithmetic on char types ok. */
+
+        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+        {
+            pxQueue->pcWriteTo = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxQueue->uxMessagesWaiting += uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyBlockFromQueue( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxItemCount )
+{
+    const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+    int8_t * pcReadFrom;
+    size_t xFirstBytes;
+
+    /* This function is called from a critical section.  pcReadFrom points at
+     * the item that was read last, so the block starts one item later. */
+    pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+
+    if( pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+    {
+        pcReadFrom = pxQueue->pcHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom ); /*lint !e946 !e9033 Pointer subtraction within the queue storage area. */
+
+    if( xFirstBytes > xBytes )
+    {
+        xFirstBytes = xBytes;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    ( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstBytes ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports. */
+
+    if( xFirstBytes < xBytes )
+    {
+        /* The block wraps around the end of the storage area. */
+        ( void ) memcpy( ( ( uint8_t * ) pvBuffer ) + xFirstBytes, ( void * ) pxQueue->pcHead, xBytes - xFirstBytes ); /*lint !e961 !e418 !e9087 !e9016 MISRA exception as the casts are only redundant for some ports. */
+        pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstBytes );                                                     /*lint !e9016 Pointer arithmetic on char types ok. */
+    }
+    else
+    {
+        pcReadFrom += xFirstBytes; /*lint !e9016 Pointer arithmetic on char types ok. */
+    }
+
+    /* Leave pcReadFrom on the last item read, as prvCopyDataFromQueue() does. */
+    pxQueue->u.xQueue.pcReadFrom = pcReadFrom - pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok. */
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList,
+                                          UBaseType_t uxItemCount )
+{
+    BaseType_t xReturn = pdFALSE;
+
+    while( ( uxItemCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+    {
+        if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxItemCount--;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvNotifyItemsAdded( Queue_t * const pxQueue,
+                                       UBaseType_t uxItemCount )
+{
+    BaseType_t xReturn = pdFALSE;
+
+    #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                /* The set receives one entry per item, exactly as if the items
+                 * had been sent one at a time.  Tasks never block on a queue
+                 * that is a member of a set, so the count is consumed here. */
+                for( ; uxItemCount > ( UBaseType_t ) 0; uxItemCount-- )
+                {
+                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                    {
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configUSE_QUEUE_SETS */
+
+    if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemCount ) != pdFALSE )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static int8_t prvAddToLockCount( const int8_t cLockCount,
+                                 const UBaseType_t uxItemCount )
+{
+    int8_t cReturn;
+
+    if( uxItemCount >= ( UBaseType_t ) ( queueINT8_MAX - cLockCount ) )
+    {
+        cReturn = queueINT8_MAX;
+    }
+    else
+    {
+        cReturn = ( int8_t ) ( cLockCount + ( int8_t ) uxItemCount );
+    }
+
+    return cReturn;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -3014,3 +3749,27 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     }
 
 #endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_MUX == 1 )
+
+    static BaseType_t prvQueueHoldsData( void * pvQueue )
+    {
+        return ( ( ( Queue_t * ) pvQueue )->uxMessagesWaiting != ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueAddToEventMux( QueueHandle_t xQueueOrSemaphore,
+                                    EventMuxHandle_t xEventMux,
+                                    EventMuxSource_t * pxSource,
+                                    eEventMuxTrigger eTrigger,
+                                    void * pvUserData )
+    {
+        Queue_t * const pxQueue = xQueueOrSemaphore;
+
+        configASSERT( pxQueue );
+
+        return xEventMuxInternalAdd( xEventMux, pxSource, pxQueue, &( pxQueue->pxEventMuxSource ), prvQueueHoldsData, eTrigger, pvUserData );
+    }
+
+#endif /* configUSE_EVENT_MUX */
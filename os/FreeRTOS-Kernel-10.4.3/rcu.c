@@ -0,0 +1,286 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rcu.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include RCU functionality.  This #if is closed at the very bottom of this
+ * file.  If you want to include RCU then ensure configUSE_RCU is set to 1 in
+ * FreeRTOSConfig.h. */
+#if ( configUSE_RCU == 1 )
+
+    #ifndef portATOMIC_COMPARE_AND_SWAP_U32
+        #error portATOMIC_COMPARE_AND_SWAP_U32 must be provided by the port to use RCU
+    #endif
+
+/* A quiescent counter that still holds this value belongs to a core that has
+ * not run the kernel yet, and so cannot hold a reference. */
+    #define rcuCORE_OFFLINE    ( ( uint32_t ) 0 )
+
+/* The state of one core that other cores read, alone on its cache line. */
+typedef struct xRCU_CORE
+{
+    volatile uint32_t ulQuiescentCount; /*< Advanced at each quiescent state of the core. */
+    volatile uint32_t ulReadNesting;    /*< Read sections open on the core, over all its tasks and interrupts. */
+    uint8_t ucPadding[ portCACHE_LINE_SIZE - ( 2 * sizeof( uint32_t ) ) ];
+} RcuCore_t;
+
+/* The deferred releases of one core, only accessed by that core. */
+typedef struct xRCU_CALLBACKS
+{
+    RcuHead_t * pxWaiting;                      /*< Queued since the current grace period started. */
+    RcuHead_t * pxInGrace;                      /*< Waiting for the current grace period to end. */
+    uint32_t ulSnapshot[ configNUM_CORES ];     /*< Quiescent counters when the current grace period started. */
+} RcuCallbacks_t;
+
+PRIVILEGED_DATA static RcuCore_t xRcuCores[ configNUM_CORES ] portCACHE_ALIGNED;
+PRIVILEGED_DATA static RcuCallbacks_t xRcuCallbacks[ configNUM_CORES ];
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Record the quiescent counters of all cores, at the start of a grace period.
+ */
+static void prvTakeSnapshot( uint32_t * pulSnapshot ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if every core has passed a quiescent state since
+ * pulSnapshot was taken.
+ */
+static BaseType_t prvGracePeriodElapsed( const uint32_t * pulSnapshot ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vRcuReadLock( void )
+{
+    volatile uint32_t * const pulNesting = &( xRcuCores[ portGET_CORE_ID() ].ulReadNesting );
+    uint32_t ulOld;
+
+    /* Tasks and interrupts of this core may open sections concurrently. */
+    do
+    {
+        ulOld = *pulNesting;
+    } while( portATOMIC_COMPARE_AND_SWAP_U32( pulNesting, ulOld + 1U, ulOld ) != ulOld );
+
+    /* Reads of the protected data must not move above this point. */
+    portMEMORY_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+void vRcuReadUnlock( void )
+{
+    volatile uint32_t * const pulNesting = &( xRcuCores[ portGET_CORE_ID() ].ulReadNesting );
+    uint32_t ulOld;
+
+    configASSERT( *pulNesting > 0U );
+
+    portMEMORY_BARRIER();
+
+    do
+    {
+        ulOld = *pulNesting;
+    } while( portATOMIC_COMPARE_AND_SWAP_U32( pulNesting, ulOld - 1U, ulOld ) != ulOld );
+}
+/*-----------------------------------------------------------*/
+
+void vRcuQuiescentState( void )
+{
+    RcuCore_t * pxCore;
+    uint32_t ulCount;
+    UBaseType_t uxSavedInterruptStatus;
+
+    /* An interrupt of this core that opened a read section between the
+     * check and the increment would hold a reference across a quiescent
+     * state, so both are done with interrupts masked. */
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    pxCore = &( xRcuCores[ portGET_CORE_ID() ] );
+
+    if( pxCore->ulReadNesting == 0U )
+    {
+        /* Only this core writes its counter.  Zero is skipped as it marks a
+         * core that is offline. */
+        ulCount = pxCore->ulQuiescentCount + 1U;
+
+        if( ulCount == rcuCORE_OFFLINE )
+        {
+            ulCount++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxCore->ulQuiescentCount = ulCount;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTakeSnapshot( uint32_t * pulSnapshot )
+{
+    UBaseType_t uxCore;
+
+    /* The new version must be visible to all cores before the grace period
+     * starts. */
+    portDATA_SYNC_BARRIER();
+
+    for( uxCore = 0; uxCore < ( UBaseType_t ) configNUM_CORES; uxCore++ )
+    {
+        pulSnapshot[ uxCore ] = xRcuCores[ uxCore ].ulQuiescentCount;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGracePeriodElapsed( const uint32_t * pulSnapshot )
+{
+    BaseType_t xReturn = pdTRUE;
+    UBaseType_t uxCore;
+
+    for( uxCore = 0; uxCore < ( UBaseType_t ) configNUM_CORES; uxCore++ )
+    {
+        if( ( pulSnapshot[ uxCore ] != rcuCORE_OFFLINE ) &&
+            ( xRcuCores[ uxCore ].ulQuiescentCount == pulSnapshot[ uxCore ] ) )
+        {
+            xReturn = pdFALSE;
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRcuSynchronize( void )
+{
+    uint32_t ulSnapshot[ configNUM_CORES ];
+
+    configASSERT( xRcuCores[ portGET_CORE_ID() ].ulReadNesting == 0U );
+
+    prvTakeSnapshot( ulSnapshot );
+
+    /* The delay switches this core out, which is its own quiescent state. */
+    while( prvGracePeriodElapsed( ulSnapshot ) == pdFALSE )
+    {
+        vTaskDelay( ( TickType_t ) 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vRcuCall( RcuHead_t * pxHead,
+               RcuCallbackFunction_t pxCallback )
+{
+    RcuCallbacks_t * pxCallbacks;
+
+    configASSERT( pxHead );
+    configASSERT( pxCallback );
+
+    pxHead->pxCallback = pxCallback;
+
+    taskENTER_CRITICAL();
+    {
+        pxCallbacks = &( xRcuCallbacks[ portGET_CORE_ID() ] );
+        pxHead->pxNext = pxCallbacks->pxWaiting;
+        pxCallbacks->pxWaiting = pxHead;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxRcuProcessCallbacks( void )
+{
+    RcuCallbacks_t * pxCallbacks;
+    RcuHead_t * pxDone = NULL;
+    RcuHead_t * pxNext;
+    UBaseType_t uxCalled = 0;
+
+    taskENTER_CRITICAL();
+    {
+        pxCallbacks = &( xRcuCallbacks[ portGET_CORE_ID() ] );
+
+        if( ( pxCallbacks->pxInGrace != NULL ) && ( prvGracePeriodElapsed( pxCallbacks->ulSnapshot ) != pdFALSE ) )
+        {
+            pxDone = pxCallbacks->pxInGrace;
+            pxCallbacks->pxInGrace = NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Start the next grace period for everything queued since the last
+         * one started. */
+        if( ( pxCallbacks->pxInGrace == NULL ) && ( pxCallbacks->pxWaiting != NULL ) )
+        {
+            pxCallbacks->pxInGrace = pxCallbacks->pxWaiting;
+            pxCallbacks->pxWaiting = NULL;
+            prvTakeSnapshot( pxCallbacks->ulSnapshot );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    while( pxDone != NULL )
+    {
+        pxNext = pxDone->pxNext;
+        pxDone->pxCallback( pxDone );
+        pxDone = pxNext;
+        uxCalled++;
+    }
+
+    return uxCalled;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include RCU functionality.  If you want to include RCU then ensure
+ * configUSE_RCU is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_RCU == 1 */
@@ -0,0 +1,338 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rwlock.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer locks.  This #if is closed at the very bottom of
+ * this file.  If you want to include reader-writer locks then ensure
+ * configUSE_RWLOCKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RWLOCKS == 1 )
+
+    #ifndef portATOMIC_COMPARE_AND_SWAP_U32
+        #error portATOMIC_COMPARE_AND_SWAP_U32 must be provided by the port to use reader-writer locks
+    #endif
+
+    #ifndef portIS_INSIDE_INTERRUPT
+        #error portIS_INSIDE_INTERRUPT must be provided by the port to use reader-writer locks
+    #endif
+
+    #if ( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) ) || ( ( INCLUDE_xTaskGetSchedulerState != 1 ) && ( configUSE_TIMERS != 1 ) )
+        #error INCLUDE_xTaskGetCurrentTaskHandle and INCLUDE_xTaskGetSchedulerState must be set to 1 to use reader-writer locks
+    #endif
+
+/* Value of ulWriter while no writer claims the lock. */
+    #define rwlockNO_WRITER    ( ( uint32_t ) 0 )
+
+/* Value of ulWriter while an interrupt, or code that runs before the
+ * scheduler, of core uxCore holds the lock.  Never a task handle. */
+    #define rwlockCORE_WRITER( uxCore )    ( ( uint32_t ) ( uxCore ) + 1U )
+
+/* The state of a caller that waits for a lock. */
+typedef struct xRWLOCK_WAIT
+{
+    TimeOut_t xTimeOut;
+    TickType_t xTicksToWait;
+    UBaseType_t uxSpins;
+    BaseType_t xTimeOutSet;
+} RwLockWait_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add lDelta to the reader count of the calling core.  Tasks and interrupts of
+ * the same core may update the count concurrently, other cores only read it.
+ */
+static void prvAddReaders( volatile uint32_t * pulCount,
+                           int32_t lDelta ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the value the caller writes to ulWriter: the handle of the calling
+ * task, or rwlockCORE_WRITER() outside a task.  *pxIsTask tells which.
+ */
+static uint32_t prvGetWriterID( BaseType_t * const pxIsTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called each time the lock was found unavailable.  Spins, then sleeps one tick
+ * while the block time lasts.  Returns pdFALSE once the caller must give up.
+ */
+static BaseType_t prvWaitForLock( RwLockWait_t * const pxWait ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vRwLockInitialise( RwLock_t * const pxLock )
+{
+    UBaseType_t uxCore;
+
+    configASSERT( pxLock );
+    configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxLock ) & ( ( portPOINTER_SIZE_TYPE ) portCACHE_LINE_SIZE - 1U ) ) == 0U );
+
+    for( uxCore = 0; uxCore < ( UBaseType_t ) configNUM_CORES; uxCore++ )
+    {
+        pxLock->xReaders[ uxCore ].ulCount = 0U;
+    }
+
+    pxLock->ulWriter = rwlockNO_WRITER;
+    portDATA_SYNC_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddReaders( volatile uint32_t * pulCount,
+                           int32_t lDelta )
+{
+    uint32_t ulOld;
+
+    do
+    {
+        ulOld = *pulCount;
+    } while( portATOMIC_COMPARE_AND_SWAP_U32( pulCount, ulOld + ( uint32_t ) lDelta, ulOld ) != ulOld );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvGetWriterID( BaseType_t * const pxIsTask )
+{
+    uint32_t ulID;
+
+    if( ( portIS_INSIDE_INTERRUPT() ) || ( xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED ) )
+    {
+        ulID = rwlockCORE_WRITER( portGET_CORE_ID() );
+        *pxIsTask = pdFALSE;
+    }
+    else
+    {
+        ulID = ( uint32_t ) ( portPOINTER_SIZE_TYPE ) xTaskGetCurrentTaskHandle();
+        *pxIsTask = pdTRUE;
+    }
+
+    return ulID;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWaitForLock( RwLockWait_t * const pxWait )
+{
+    BaseType_t xReturn = pdTRUE;
+
+    pxWait->uxSpins++;
+
+    if( pxWait->uxSpins >= ( UBaseType_t ) configRWLOCK_SPIN_COUNT )
+    {
+        pxWait->uxSpins = 0;
+
+        if( pxWait->xTicksToWait == ( TickType_t ) 0 )
+        {
+            xReturn = pdFALSE;
+        }
+        else
+        {
+            if( pxWait->xTimeOutSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &( pxWait->xTimeOut ) );
+                pxWait->xTimeOutSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &( pxWait->xTimeOut ), &( pxWait->xTicksToWait ) ) != pdFALSE )
+            {
+                xReturn = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xReturn != pdFALSE )
+            {
+                /* The holder may be a lower priority task of this core, or be
+                 * on another core; either way it needs time, not this task. */
+                vTaskDelay( ( TickType_t ) 1 );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRwLockReadTake( RwLock_t * const pxLock,
+                            TickType_t xTicksToWait )
+{
+    volatile uint32_t * const pulCount = &( pxLock->xReaders[ portGET_CORE_ID() ].ulCount );
+    RwLockWait_t xWait = { { 0 }, xTicksToWait, 0, pdFALSE };
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( pxLock );
+
+    for( ; ; )
+    {
+        if( pxLock->ulWriter == rwlockNO_WRITER )
+        {
+            prvAddReaders( pulCount, 1 );
+
+            /* The count must reach memory before the writer word is read
+             * again, a writer reads them in the opposite order. */
+            portDATA_SYNC_BARRIER();
+
+            if( pxLock->ulWriter == rwlockNO_WRITER )
+            {
+                xReturn = pdPASS;
+                break;
+            }
+            else
+            {
+                /* A writer claimed the lock meanwhile.  Step back so it is not
+                 * kept waiting by a reader that arrived after it. */
+                prvAddReaders( pulCount, -1 );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( prvWaitForLock( &xWait ) == pdFALSE )
+        {
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRwLockReadGive( RwLock_t * const pxLock )
+{
+    volatile uint32_t * const pulCount = &( pxLock->xReaders[ portGET_CORE_ID() ].ulCount );
+
+    configASSERT( pxLock );
+    configASSERT( *pulCount > 0U );
+
+    /* Reads of the protected data complete before the count drops. */
+    portDATA_SYNC_BARRIER();
+    prvAddReaders( pulCount, -1 );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRwLockWriteTake( RwLock_t * const pxLock,
+                             TickType_t xTicksToWait )
+{
+    RwLockWait_t xWait = { { 0 }, xTicksToWait, 0, pdFALSE };
+    UBaseType_t uxCore;
+    BaseType_t xIsTask;
+    uint32_t ulOwner;
+
+    configASSERT( pxLock );
+
+    ulOwner = prvGetWriterID( &xIsTask );
+
+    /* A task that takes the lock again would wait for itself.  Another task
+     * or an interrupt of the same core only contends for it: the task sleeps
+     * until the holder gives it, the interrupt fails after the spin.  An
+     * interrupt cannot tell a nested interrupt from itself, so it is not
+     * checked. */
+    configASSERT( ( xIsTask == pdFALSE ) || ( pxLock->ulWriter != ulOwner ) );
+
+    /* Claim the writer word, which stops new readers on all cores. */
+    while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxLock->ulWriter ), ulOwner, rwlockNO_WRITER ) != rwlockNO_WRITER )
+    {
+        if( prvWaitForLock( &xWait ) == pdFALSE )
+        {
+            return pdFAIL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    portDATA_SYNC_BARRIER();
+
+    /* Wait for the readers already inside to leave. */
+    for( uxCore = 0; uxCore < ( UBaseType_t ) configNUM_CORES; uxCore++ )
+    {
+        while( pxLock->xReaders[ uxCore ].ulCount != 0U )
+        {
+            if( prvWaitForLock( &xWait ) == pdFALSE )
+            {
+                pxLock->ulWriter = rwlockNO_WRITER;
+                portDATA_SYNC_BARRIER();
+                return pdFAIL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+    return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+void vRwLockWriteGive( RwLock_t * const pxLock )
+{
+    BaseType_t xIsTask;
+
+    configASSERT( pxLock );
+
+    /* Only the task, or the interrupt level of the core, that took it. */
+    configASSERT( pxLock->ulWriter == prvGetWriterID( &xIsTask ) );
+    ( void ) xIsTask;
+
+    /* Writes to the protected data complete before the lock is seen free. */
+    portDATA_SYNC_BARRIER();
+    pxLock->ulWriter = rwlockNO_WRITER;
+    portDATA_SYNC_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer locks.  If you want to include reader-writer locks
+ * then ensure configUSE_RWLOCKS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_RWLOCKS == 1 */
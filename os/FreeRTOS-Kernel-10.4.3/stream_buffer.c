@@ -38,6 +38,10 @@
 #include "task.h"
 #include "stream_buffer.h"
 
+#if ( configUSE_EVENT_MUX == 1 )
+    #include "event_mux.h"
+#endif
+
 #if ( configUSE_TASK_NOTIFICATIONS != 1 )
     #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
 #endif
@@ -151,6 +155,10 @@ typedef struct StreamBufferDef_t                 /*lint !e9058 Style convention
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxStreamBufferNumber; /* Used for tracing purposes. */
     #endif
+
+    #if ( configUSE_EVENT_MUX == 1 )
+        EventMuxSource_t * volatile pxEventMuxSource; /* The event multiplexer source the stream buffer is registered as, or NULL. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -158,6 +166,23 @@ typedef struct StreamBufferDef_t                 /*lint !e9058 Style convention
  */
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_EVENT_MUX == 1 )
+
+/*
+ * Signal the event multiplexer the stream buffer is registered with, if any,
+ * once the trigger level has been reached.  The ISR variant must be called
+ * with interrupts masked.
+ */
+    static void prvNotifyEventMux( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    static void prvNotifyEventMuxFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                          BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Level check used for stream buffers registered level triggered.
+ */
+    static BaseType_t prvStreamBufferHoldsData( void * pvStreamBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Add xCount bytes from pucData into the pxStreamBuffer message buffer.
  * Returns the number of bytes written, which will either equal xCount in the
@@ -376,6 +401,15 @@ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
 
     traceSTREAM_BUFFER_DELETE( xStreamBuffer );
 
+    #if ( configUSE_EVENT_MUX == 1 )
+        {
+            if( pxStreamBuffer->pxEventMuxSource != NULL )
+            {
+                vEventMuxRemove( pxStreamBuffer->pxEventMuxSource );
+            }
+        }
+    #endif
+
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
     {
         #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
@@ -410,6 +444,10 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_EVENT_MUX == 1 )
+        EventMuxSource_t * pxEventMuxSource;
+    #endif
+
     configASSERT( pxStreamBuffer );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -427,6 +465,13 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         {
             if( pxStreamBuffer->xTaskWaitingToSend == NULL )
             {
+                #if ( configUSE_EVENT_MUX == 1 )
+                    {
+                        /* The multiplexer registration survives a reset. */
+                        pxEventMuxSource = pxStreamBuffer->pxEventMuxSource;
+                    }
+                #endif
+
                 prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                               pxStreamBuffer->pucBuffer,
                                               pxStreamBuffer->xLength,
@@ -440,6 +485,12 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
                     }
                 #endif
 
+                #if ( configUSE_EVENT_MUX == 1 )
+                    {
+                        pxStreamBuffer->pxEventMuxSource = pxEventMuxSource;
+                    }
+                #endif
+
                 traceSTREAM_BUFFER_RESET( xStreamBuffer );
             }
         }
@@ -630,6 +681,12 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
             sbSEND_COMPLETED( pxStreamBuffer );
+
+            #if ( configUSE_EVENT_MUX == 1 )
+                {
+                    prvNotifyEventMux( pxStreamBuffer );
+                }
+            #endif
         }
         else
         {
@@ -680,6 +737,18 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
             sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            #if ( configUSE_EVENT_MUX == 1 )
+                {
+                    UBaseType_t uxSavedInterruptStatus;
+
+                    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+                    {
+                        prvNotifyEventMuxFromISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                    }
+                    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+                }
+            #endif
         }
         else
         {
@@ -1312,3 +1381,62 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_MUX == 1 )
+
+    static void prvNotifyEventMux( StreamBuffer_t * const pxStreamBuffer )
+    {
+        if( pxStreamBuffer->pxEventMuxSource != NULL )
+        {
+            vEventMuxSignal( pxStreamBuffer->pxEventMuxSource );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvNotifyEventMuxFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                          BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        if( pxStreamBuffer->pxEventMuxSource != NULL )
+        {
+            if( ( xEventMuxInternalSignal( pxStreamBuffer->pxEventMuxSource ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+            {
+                *pxHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvStreamBufferHoldsData( void * pvStreamBuffer )
+    {
+        const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pvStreamBuffer;
+
+        return ( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes ) ? pdTRUE : pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xStreamBufferAddToEventMux( StreamBufferHandle_t xStreamBuffer,
+                                           EventMuxHandle_t xEventMux,
+                                           EventMuxSource_t * pxSource,
+                                           eEventMuxTrigger eTrigger,
+                                           void * pvUserData )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        configASSERT( pxStreamBuffer );
+
+        return xEventMuxInternalAdd( xEventMux, pxSource, pxStreamBuffer, &( pxStreamBuffer->pxEventMuxSource ), prvStreamBufferHoldsData, eTrigger, pvUserData );
+    }
+
+#endif /* configUSE_EVENT_MUX */
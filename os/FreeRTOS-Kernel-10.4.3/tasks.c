@@ -39,6 +39,10 @@
 #include "timers.h"
 #include "stack_macros.h"
 
+#if ( configUSE_RCU == 1 )
+    #include "rcu.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -131,6 +135,14 @@
 
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_PARTITIONS == 1 )
+
+/* Tasks are selected from the ready lists of the partition that owns the
+ * current window, see prvSelectHighestPriorityTask(). */
+        #define taskSELECT_HIGHEST_PRIORITY_TASK()    prvSelectHighestPriorityTask()
+
+    #else
+
     #define taskSELECT_HIGHEST_PRIORITY_TASK()                                \
     {                                                                         \
         UBaseType_t uxTopPriority = uxTopReadyPriority;                       \
@@ -148,6 +160,8 @@
         uxTopReadyPriority = uxTopPriority;                                                   \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
+    #endif /* configUSE_PARTITIONS */
+
 /*-----------------------------------------------------------*/
 
 /* Define away taskRESET_READY_PRIORITY() and portRESET_READY_PRIORITY() as
@@ -216,11 +230,26 @@
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
+#if ( configUSE_PARTITIONS == 1 )
+
+    #define prvAddTaskToReadyList( pxTCB )                                                                  \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                            \
+    if( ( pxTCB )->uxPriority > taskTOP_READY_PRIORITY( pxTCB ) )                                       \
+    {                                                                                                   \
+        taskTOP_READY_PRIORITY( pxTCB ) = ( pxTCB )->uxPriority;                                        \
+    }                                                                                                   \
+    vListInsertEnd( &( taskREADY_LISTS( pxTCB )[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+    tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+#else
+
 #define prvAddTaskToReadyList( pxTCB )                                                                 \
     traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
     taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
     vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+#endif /* configUSE_PARTITIONS */
 /*-----------------------------------------------------------*/
 
 /*
@@ -327,6 +356,20 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_TASK_SNAPSHOT == 1 )
+        UBaseType_t uxSnapshotSlot; /*< Index of the task's record in the snapshot table of its core, or configTASK_SNAPSHOT_MAX_TASKS if the table was full when the task was created. */
+    #endif
+
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        struct xPERIODIC_GROUP * pxPeriodicGroup; /*< The period group of the task, NULL if the task is not periodic. */
+        uint32_t ulPeriodicRelease;               /*< The release count of the group when the task was last released. */
+        uint32_t ulPeriodicOverruns;              /*< The number of releases that happened while the task was still running. */
+    #endif
+
+    #if ( configUSE_PARTITIONS == 1 )
+        UBaseType_t uxPartition; /*< The partition whose windows the task runs in. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -342,14 +385,24 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUM_CORES ] = { NULL };
  * xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
-PRIVILEGED_DATA static List_t pxReadyTasksListss[ configNUM_CORES ][ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
+#if ( configUSE_PARTITIONS == 1 )
+    PRIVILEGED_DATA static List_t pxReadyTasksListss[ configNUM_CORES ][ configNUM_PARTITIONS ][ configMAX_PRIORITIES ]; /*< Prioritised ready tasks of each partition. */
+#else
+    PRIVILEGED_DATA static List_t pxReadyTasksListss[ configNUM_CORES ][ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
+#endif
 PRIVILEGED_DATA static List_t xDelayedTaskList1s[ configNUM_CORES ];                         /*< Delayed tasks. */
 PRIVILEGED_DATA static List_t xDelayedTaskList2s[ configNUM_CORES ];                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskLists[ configNUM_CORES ];              /*< Points to the delayed task list currently being used. */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskLists[ configNUM_CORES ];      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyLists[ configNUM_CORES ];                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
-#define pxReadyTasksLists pxReadyTasksListss[portGET_CORE_ID()]
+#if ( configUSE_PARTITIONS == 1 )
+    #define pxReadyTasksLists pxReadyTasksListss[portGET_CORE_ID()][ uxActivePartition ]
+    #define taskREADY_LISTS( pxTCB ) pxReadyTasksListss[portGET_CORE_ID()][ ( pxTCB )->uxPartition ]
+#else
+    #define pxReadyTasksLists pxReadyTasksListss[portGET_CORE_ID()]
+    #define taskREADY_LISTS( pxTCB ) pxReadyTasksLists
+#endif
 #define xDelayedTaskList1 xDelayedTaskList1s[portGET_CORE_ID()]
 #define xDelayedTaskList2 xDelayedTaskList2s[portGET_CORE_ID()]
 #define pxDelayedTaskList pxDelayedTaskLists[portGET_CORE_ID()]
@@ -383,7 +436,11 @@ PRIVILEGED_DATA static List_t xPendingReadyLists[ configNUM_CORES ];
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTaskss[ configNUM_CORES ] = {( UBaseType_t ) 0U};
 PRIVILEGED_DATA static volatile TickType_t xTickCounts[ configNUM_CORES ] = {( TickType_t ) configINITIAL_TICK_COUNT};
-PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPrioritys[ configNUM_CORES ] = {tskIDLE_PRIORITY};
+#if ( configUSE_PARTITIONS == 1 )
+    PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPrioritys[ configNUM_CORES ][ configNUM_PARTITIONS ] = {{tskIDLE_PRIORITY}};
+#else
+    PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPrioritys[ configNUM_CORES ] = {tskIDLE_PRIORITY};
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunnings[ configNUM_CORES ] = {pdFALSE};
 PRIVILEGED_DATA static volatile TickType_t xPendedTickss[ configNUM_CORES ] = {( TickType_t ) 0U};
 PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUM_CORES ] = {pdFALSE};
@@ -394,7 +451,12 @@ PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUM_CORES ] = {NULL}
 
 #define uxCurrentNumberOfTasks uxCurrentNumberOfTaskss[portGET_CORE_ID()]
 #define xTickCount xTickCounts[portGET_CORE_ID()]
-#define uxTopReadyPriority uxTopReadyPrioritys[portGET_CORE_ID()]
+#if ( configUSE_PARTITIONS == 1 )
+    #define uxTopReadyPriority uxTopReadyPrioritys[portGET_CORE_ID()][ uxActivePartition ]
+    #define taskTOP_READY_PRIORITY( pxTCB ) uxTopReadyPrioritys[portGET_CORE_ID()][ ( pxTCB )->uxPartition ]
+#else
+    #define uxTopReadyPriority uxTopReadyPrioritys[portGET_CORE_ID()]
+#endif
 #define xSchedulerRunning xSchedulerRunnings[portGET_CORE_ID()]
 #define xPendedTicks xPendedTickss[portGET_CORE_ID()]
 #define xYieldPending xYieldPendings[portGET_CORE_ID()]
@@ -431,6 +493,70 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspendeds[ configNUM_COR
 
 #endif
 
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+/* Each core is the only writer of its own table.  ulSequence is odd while the
+ * records are being updated, so a reader on any core can detect a torn copy by
+ * comparing the sequence before and after taking it. */
+    typedef struct xTASK_SNAPSHOT_TABLE
+    {
+        uint32_t ulSequence;
+        TaskSnapshotRecord_t xRecords[ configTASK_SNAPSHOT_MAX_TASKS ];
+    } TaskSnapshotTable_t;
+
+    PRIVILEGED_DATA static volatile TaskSnapshotTable_t xTaskSnapshotTables[ configNUM_CORES ];
+
+    #define xTaskSnapshotTable xTaskSnapshotTables[portGET_CORE_ID()]
+
+#endif
+
+#if ( configUSE_PERIODIC_TASKS == 1 )
+
+/* The periodic tasks of a core that share a period wait in the list of their
+ * group rather than in the delayed list.  The tick interrupt counts down to the
+ * earliest release of all the groups of the core and, when it is reached,
+ * releases every task waiting in the groups that are due. */
+    typedef struct xPERIODIC_GROUP
+    {
+        TickType_t xPeriod;        /*< The period in ticks, 0 if the group is not in use. */
+        TickType_t xNextRelease;   /*< The tick count at which the group is next released. */
+        uint32_t ulReleaseCount;   /*< The number of releases since the group was put in use. */
+        UBaseType_t uxMembers;     /*< The number of tasks that use the period. */
+        List_t xWaitingTasks;      /*< The tasks waiting for the next release. */
+    } PeriodicGroup_t;
+
+    PRIVILEGED_DATA static PeriodicGroup_t xPeriodicGroupss[ configNUM_CORES ][ configPERIODIC_MAX_PERIODS ];
+    PRIVILEGED_DATA static volatile TickType_t xPeriodicCountdowns[ configNUM_CORES ] = {( TickType_t ) 0U}; /*< Ticks to the next release of any group, 0 if no group is in use. */
+
+    #define xPeriodicGroups xPeriodicGroupss[portGET_CORE_ID()]
+    #define xPeriodicCountdown xPeriodicCountdowns[portGET_CORE_ID()]
+
+#endif
+
+#if ( configUSE_PARTITIONS == 1 )
+
+/* Each core cycles through its own table of windows (the major frame).  The
+ * port calls ulTaskNextPartitionWindowFromISR() at the end of each window. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxActivePartitions[ configNUM_CORES ] = {( UBaseType_t ) 0U};                 /*< The partition that owns the current window. */
+    PRIVILEGED_DATA static const PartitionWindow_t * pxPartitionWindowss[ configNUM_CORES ] = {NULL};                         /*< The window table, NULL when the core has no schedule. */
+    PRIVILEGED_DATA static UBaseType_t uxPartitionWindowCounts[ configNUM_CORES ] = {( UBaseType_t ) 0U};                     /*< The number of windows in the table. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxPartitionWindowIndexs[ configNUM_CORES ] = {( UBaseType_t ) 0U};            /*< The index of the current window. */
+
+    #define uxActivePartition uxActivePartitions[portGET_CORE_ID()]
+    #define pxPartitionWindows pxPartitionWindowss[portGET_CORE_ID()]
+    #define uxPartitionWindowCount uxPartitionWindowCounts[portGET_CORE_ID()]
+    #define uxPartitionWindowIndex uxPartitionWindowIndexs[portGET_CORE_ID()]
+
+/* A task of the partition that owns the window preempts any task of another
+ * partition that was given the window because the owner had nothing ready. */
+    #define taskPARTITION_PRIORITY( pxTCB )    ( ( pxTCB )->uxPriority + ( ( ( pxTCB )->uxPartition == uxActivePartition ) ? ( UBaseType_t ) configMAX_PRIORITIES : ( UBaseType_t ) 0U ) )
+
+#else
+
+    #define taskPARTITION_PRIORITY( pxTCB )    ( ( pxTCB )->uxPriority )
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -532,6 +658,46 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 
 #endif
 
+/*
+ * Helpers that maintain the snapshot table of the calling core.  They must be
+ * called from a critical section or from vTaskSwitchContext().
+ */
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+    static void prvSnapshotAddTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvSnapshotRemoveTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvSnapshotSwitch( const TCB_t * pxPreviousTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Helpers for periodic tasks.  They must be called with the scheduler
+ * suspended or from a critical section, except prvReleasePeriodicTasks() which
+ * is called from the tick interrupt.
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+
+    static void prvPeriodicDetach( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvResetPeriodicCountdown( void ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvReleasePeriodicTasks( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Select the task to run from the ready lists of the partition that owns the
+ * current window, or from the background partition when the owner has no task
+ * ready.
+ */
+#if ( configUSE_PARTITIONS == 1 )
+
+    static void prvSelectHighestPriorityTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Return the amount of time, in ticks, that will pass before the kernel will
  * next move a task from the Blocked state to the Running state.
@@ -1028,6 +1194,21 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif
 
+    #if ( configUSE_PARTITIONS == 1 )
+        {
+            /* Tasks start in the background partition. */
+            pxNewTCB->uxPartition = ( UBaseType_t ) 0U;
+        }
+    #endif
+
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        {
+            pxNewTCB->pxPeriodicGroup = NULL;
+            pxNewTCB->ulPeriodicRelease = 0UL;
+            pxNewTCB->ulPeriodicOverruns = 0UL;
+        }
+    #endif
+
     /* Initialize the TCB stack to look as if the task was already running,
      * but had been interrupted by the scheduler.  The return address is set
      * to the start of the task function. Once the stack has been initialised
@@ -1153,6 +1334,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
         prvAddTaskToReadyList( pxNewTCB );
 
+        #if ( configUSE_TASK_SNAPSHOT == 1 )
+            {
+                prvSnapshotAddTask( pxNewTCB );
+            }
+        #endif
+
         portSETUP_TCB( pxNewTCB );
     }
     taskEXIT_CRITICAL();
@@ -1161,7 +1348,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         /* If the created task is of a higher priority than the current task
          * then it should run now. */
-        if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        if( taskPARTITION_PRIORITY( pxCurrentTCB ) < taskPARTITION_PRIORITY( pxNewTCB ) )
         {
             taskYIELD_IF_USING_PREEMPTION();
         }
@@ -1209,6 +1396,25 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_TASK_SNAPSHOT == 1 )
+                {
+                    prvSnapshotRemoveTask( pxTCB );
+                }
+            #endif
+
+            #if ( configUSE_PERIODIC_TASKS == 1 )
+                {
+                    if( pxTCB->pxPeriodicGroup != NULL )
+                    {
+                        prvPeriodicDetach( pxTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1436,6 +1642,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 eReturn = eBlocked;
             }
 
+            #if ( configUSE_PERIODIC_TASKS == 1 )
+                else if( ( pxTCB->pxPeriodicGroup != NULL ) && ( pxStateList == &( pxTCB->pxPeriodicGroup->xWaitingTasks ) ) )
+                {
+                    /* The task is waiting for the next release of its period. */
+                    eReturn = eBlocked;
+                }
+            #endif
+
             #if ( INCLUDE_vTaskSuspend == 1 )
                 else if( pxStateList == &xSuspendedTaskList )
                 {
@@ -1685,7 +1899,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * nothing more than change its priority variable. However, if
                  * the task is in a ready list it needs to be removed and placed
                  * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( &( taskREADY_LISTS( pxTCB )[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                 {
                     /* The task is currently in its ready list - remove before
                      * adding it to it's new ready list.  As we are in a critical
@@ -1906,7 +2120,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     prvAddTaskToReadyList( pxTCB );
 
                     /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskPARTITION_PRIORITY( pxTCB ) >= taskPARTITION_PRIORITY( pxCurrentTCB ) )
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -1974,7 +2188,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 {
                     /* Ready lists can be accessed so move the task from the
                      * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskPARTITION_PRIORITY( pxTCB ) >= taskPARTITION_PRIORITY( pxCurrentTCB ) )
                     {
                         xYieldRequired = pdTRUE;
 
@@ -2086,6 +2300,14 @@ void vTaskStartScheduler( void )
          * starts to run. */
         portDISABLE_INTERRUPTS();
 
+        #if ( configUSE_PARTITIONS == 1 )
+            {
+                /* The task created last is not necessarily in the partition
+                 * that owns the first window. */
+                taskSELECT_HIGHEST_PRIORITY_TASK();
+            }
+        #endif
+
         #if ( configUSE_NEWLIB_REENTRANT == 1 )
             {
                 /* Switch Newlib's _impure_ptr variable to point to the _reent
@@ -2210,7 +2432,7 @@ void vTaskSuspendAll( void )
         {
             xReturn = 0;
         }
-        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > 1 )
+        else if( listCURRENT_LIST_LENGTH( &( taskREADY_LISTS( pxCurrentTCB )[ tskIDLE_PRIORITY ] ) ) > 1 )
         {
             /* There are other idle priority tasks in the ready state.  If
              * time slicing is used then the very next tick interrupt must be
@@ -2227,6 +2449,20 @@ void vTaskSuspendAll( void )
         else
         {
             xReturn = xNextTaskUnblockTime - xTickCount;
+
+            #if ( configUSE_PERIODIC_TASKS == 1 )
+                {
+                    /* The next periodic release also ends the idle period. */
+                    if( ( xPeriodicCountdown != ( TickType_t ) 0U ) && ( xPeriodicCountdown < xReturn ) )
+                    {
+                        xReturn = xPeriodicCountdown;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
         }
 
         return xReturn;
@@ -2268,7 +2504,7 @@ BaseType_t xTaskResumeAll( void )
 
                     /* If the moved task has a priority higher than the current
                      * task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskPARTITION_PRIORITY( pxTCB ) >= taskPARTITION_PRIORITY( pxCurrentTCB ) )
                     {
                         xYieldPending = pdTRUE;
                     }
@@ -2488,23 +2724,37 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
         UBaseType_t uxQueue = configMAX_PRIORITIES;
         TCB_t * pxTCB;
 
+        #if ( configUSE_PARTITIONS == 1 )
+            UBaseType_t uxPartition;
+        #endif
+
         /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
         configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
 
         vTaskSuspendAll();
         {
             /* Search the ready lists. */
-            do
-            {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
-
-                if( pxTCB != NULL )
+            #if ( configUSE_PARTITIONS == 1 )
+                for( uxPartition = ( UBaseType_t ) 0U, pxTCB = NULL; ( uxPartition < ( UBaseType_t ) configNUM_PARTITIONS ) && ( pxTCB == NULL ); uxPartition++ )
                 {
-                    /* Found the handle. */
-                    break;
+                    for( uxQueue = configMAX_PRIORITIES; ( uxQueue > ( UBaseType_t ) 0U ) && ( pxTCB == NULL ); uxQueue-- )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksListss[ portGET_CORE_ID() ][ uxPartition ][ uxQueue - 1U ] ), pcNameToQuery );
+                    }
                 }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            #else
+                do
+                {
+                    uxQueue--;
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+
+                    if( pxTCB != NULL )
+                    {
+                        /* Found the handle. */
+                        break;
+                    }
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            #endif /* configUSE_PARTITIONS */
 
             /* Search the delayed lists. */
             if( pxTCB == NULL )
@@ -2553,6 +2803,10 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
     {
         UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
+        #if ( configUSE_PARTITIONS == 1 )
+            UBaseType_t uxPartition;
+        #endif
+
         vTaskSuspendAll();
         {
             /* Is there a space in the array for each task in the system? */
@@ -2560,11 +2814,21 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             {
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                #if ( configUSE_PARTITIONS == 1 )
+                    for( uxPartition = ( UBaseType_t ) 0U; uxPartition < ( UBaseType_t ) configNUM_PARTITIONS; uxPartition++ )
+                    {
+                        for( uxQueue = configMAX_PRIORITIES; uxQueue > ( UBaseType_t ) 0U; uxQueue-- )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksListss[ portGET_CORE_ID() ][ uxPartition ][ uxQueue - 1U ] ), eReady );
+                        }
+                    }
+                #else
+                    do
+                    {
+                        uxQueue--;
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                    } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                #endif /* configUSE_PARTITIONS */
 
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
@@ -2646,6 +2910,25 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
          * each stepped tick. */
         configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
         xTickCount += xTicksToJump;
+
+        #if ( configUSE_PERIODIC_TASKS == 1 )
+            {
+                /* A release that fell within the jump is made by the next
+                 * tick, which also catches up the release times. */
+                if( xPeriodicCountdown > xTicksToJump )
+                {
+                    xPeriodicCountdown -= xTicksToJump;
+                }
+                else if( xPeriodicCountdown != ( TickType_t ) 0U )
+                {
+                    xPeriodicCountdown = ( TickType_t ) 1U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
         traceINCREASE_TICK_COUNT( xTicksToJump );
     }
 
@@ -2724,7 +3007,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          *  performed if the unblocked task has a priority that is
                          *  equal to or higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskPARTITION_PRIORITY( pxTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -2848,7 +3131,7 @@ BaseType_t xTaskIncrementTick( void )
                              * only be performed if the unblocked task has a
                              * priority that is equal to or higher than the
                              * currently executing task. */
-                            if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                            if( taskPARTITION_PRIORITY( pxTCB ) >= taskPARTITION_PRIORITY( pxCurrentTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -2862,12 +3145,42 @@ BaseType_t xTaskIncrementTick( void )
             }
         }
 
+        #if ( configUSE_PERIODIC_TASKS == 1 )
+            {
+                /* Only the countdown is touched on ticks without a release. */
+                if( xPeriodicCountdown != ( TickType_t ) 0U )
+                {
+                    xPeriodicCountdown--;
+
+                    if( xPeriodicCountdown == ( TickType_t ) 0U )
+                    {
+                        if( prvReleasePeriodicTasks( xConstTickCount ) != pdFALSE )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_PERIODIC_TASKS */
+
         /* Tasks of equal priority to the currently running task will share
          * processing time (time slice) if preemption is on, and the application
          * writer has not explicitly turned time slicing off. */
         #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                if( listCURRENT_LIST_LENGTH( &( taskREADY_LISTS( pxCurrentTCB )[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -3045,6 +3358,10 @@ void vTaskSwitchContext( void )
     }
     else
     {
+        #if ( configUSE_TASK_SNAPSHOT == 1 )
+            const TCB_t * const pxPreviousTCB = pxCurrentTCB;
+        #endif
+
         xYieldPending = pdFALSE;
         traceTASK_SWITCHED_OUT();
 
@@ -3086,11 +3403,33 @@ void vTaskSwitchContext( void )
             }
         #endif
 
+        #if ( configUSE_RCU == 1 )
+            {
+                /* A context switch is a quiescent state for the RCU readers
+                 * of this core, unless one of them is still inside a read
+                 * section. */
+                vRcuQuiescentState();
+            }
+        #endif
+
         /* Select a new task to run using either the generic C or port
          * optimised asm code. */
         taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
         traceTASK_SWITCHED_IN();
 
+        #if ( configUSE_TASK_SNAPSHOT == 1 )
+            {
+                if( pxPreviousTCB != pxCurrentTCB )
+                {
+                    prvSnapshotSwitch( pxPreviousTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
         /* After the new task is switched in, update the global errno. */
         #if ( configUSE_POSIX_ERRNO == 1 )
             {
@@ -3238,7 +3577,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
     }
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    if( taskPARTITION_PRIORITY( pxUnblockedTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
     {
         /* Return true if the task removed from the event list has a higher
          * priority than the calling task.  This allows the calling task to know if
@@ -3296,7 +3635,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     ( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
     prvAddTaskToReadyList( pxUnblockedTCB );
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    if( taskPARTITION_PRIORITY( pxUnblockedTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
     {
         /* The unblocked task has a priority above that of the calling task, so
          * a context switch is required.  This function is called with the
@@ -3467,6 +3806,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
          * is responsible for freeing the deleted task's TCB and stack. */
         prvCheckTasksWaitingTermination();
 
+        #if ( configUSE_RCU == 1 )
+            {
+                /* A core that only runs its idle task must not hold up RCU
+                 * grace periods. */
+                vRcuQuiescentState();
+            }
+        #endif
+
         #if ( configUSE_PREEMPTION == 0 )
             {
                 /* If we are not using preemption we keep forcing a task switch to
@@ -3488,7 +3835,7 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                  * the list, and an occasional incorrect value will not matter.  If
                  * the ready list at the idle priority contains more than one task
                  * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                if( listCURRENT_LIST_LENGTH( &( taskREADY_LISTS( pxCurrentTCB )[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
                 {
                     taskYIELD();
                 }
@@ -3677,10 +4024,22 @@ static void prvInitialiseTaskLists( void )
 {
     UBaseType_t uxPriority;
 
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
-    {
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-    }
+    #if ( configUSE_PARTITIONS == 1 )
+        UBaseType_t uxPartition;
+
+        for( uxPartition = ( UBaseType_t ) 0U; uxPartition < ( UBaseType_t ) configNUM_PARTITIONS; uxPartition++ )
+        {
+            for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+            {
+                vListInitialise( &( pxReadyTasksListss[ portGET_CORE_ID() ][ uxPartition ][ uxPriority ] ) );
+            }
+        }
+    #else
+        for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+        {
+            vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+        }
+    #endif
 
     vListInitialise( &xDelayedTaskList1 );
     vListInitialise( &xDelayedTaskList2 );
@@ -3867,40 +4226,790 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( configUSE_TASK_SNAPSHOT == 1 )
 
-    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    static eTaskState prvSnapshotTaskState( const TCB_t * pxTCB )
     {
-        uint32_t ulCount = 0U;
+        eTaskState eReturn;
+        List_t const * pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        /* Same classification as eTaskGetState(), without the critical
+         * section as this is only called with the lists already protected. */
+        if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
         {
-            pucStackByte -= portSTACK_GROWTH;
-            ulCount++;
+            eReturn = eBlocked;
         }
 
-        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+        #if ( configUSE_PERIODIC_TASKS == 1 )
+            else if( ( pxTCB->pxPeriodicGroup != NULL ) && ( pxStateList == &( pxTCB->pxPeriodicGroup->xWaitingTasks ) ) )
+            {
+                eReturn = eBlocked;
+            }
+        #endif
 
-        return ( configSTACK_DEPTH_TYPE ) ulCount;
-    }
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            else if( pxStateList == &xSuspendedTaskList )
+            {
+                /* Blocked indefinitely on an event or a notification also
+                 * places the task in the suspended list. */
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+                {
+                    eReturn = eSuspended;
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
-/*-----------------------------------------------------------*/
+                    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                        {
+                            BaseType_t x;
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+                            for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                            {
+                                if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                {
+                                    eReturn = eBlocked;
+                                    break;
+                                }
+                            }
+                        }
+                    #endif
+                }
+                else
+                {
+                    eReturn = eBlocked;
+                }
+            }
+        #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
 
-/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
- * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
- * user to determine the return type.  It gets around the problem of the value
- * overflowing on 8-bit types without breaking backward compatibility for
- * applications that expect an 8-bit return type. */
-    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
-    {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        configSTACK_DEPTH_TYPE uxReturn;
+        #if ( INCLUDE_vTaskDelete == 1 )
+            else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
+            {
+                eReturn = eDeleted;
+            }
+        #endif
 
-        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+        else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
+        {
+            eReturn = eReady;
+        }
+
+        return eReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSnapshotSampleContext( volatile TaskSnapshotRecord_t * pxRecord,
+                                          const TCB_t * pxTCB )
+    {
+        StackType_t * pxStackPointer;
+        UBaseType_t uxContextDepth;
+        configSTACK_DEPTH_TYPE usFreeSpace;
+
+        /* The task is not running, so its saved context describes how much
+         * stack it was using when it was last switched out. */
+        #ifdef portGET_TASK_CONTEXT_USAGE
+            portGET_TASK_CONTEXT_USAGE( pxTCB, &pxStackPointer, &uxContextDepth );
+        #else
+            pxStackPointer = ( StackType_t * ) pxTCB->pxTopOfStack;
+            uxContextDepth = ( UBaseType_t ) 0U;
+        #endif
+
+        #if ( portSTACK_GROWTH < 0 )
+            {
+                usFreeSpace = ( configSTACK_DEPTH_TYPE ) ( pxStackPointer - pxTCB->pxStack );
+            }
+        #else
+            {
+                usFreeSpace = ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxEndOfStack - pxStackPointer );
+            }
+        #endif
+
+        if( usFreeSpace < pxRecord->usStackHighWaterMark )
+        {
+            pxRecord->usStackHighWaterMark = usFreeSpace;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( uxContextDepth > pxRecord->uxContextHighWaterMark )
+        {
+            pxRecord->uxContextHighWaterMark = uxContextDepth;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSnapshotAddTask( TCB_t * pxTCB )
+    {
+        volatile TaskSnapshotTable_t * const pxTable = &( xTaskSnapshotTable );
+        volatile TaskSnapshotRecord_t * pxRecord;
+        UBaseType_t uxSlot;
+
+        for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS; uxSlot++ )
+        {
+            if( pxTable->xRecords[ uxSlot ].xHandle == NULL )
+            {
+                break;
+            }
+        }
+
+        pxTCB->uxSnapshotSlot = uxSlot;
+
+        if( uxSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS )
+        {
+            pxRecord = &( pxTable->xRecords[ uxSlot ] );
+
+            pxTable->ulSequence++;
+            portDATA_SYNC_BARRIER();
+            {
+                pxRecord->eCurrentState = eReady;
+                pxRecord->uxCurrentPriority = pxTCB->uxPriority;
+                pxRecord->ulRunTimeCounter = 0UL;
+                pxRecord->ulSwitchInCount = 0UL;
+                pxRecord->usStackHighWaterMark = ( configSTACK_DEPTH_TYPE ) ~( ( configSTACK_DEPTH_TYPE ) 0U );
+                pxRecord->uxContextHighWaterMark = ( UBaseType_t ) 0U;
+                prvSnapshotSampleContext( pxRecord, pxTCB );
+                pxRecord->xHandle = ( TaskHandle_t ) pxTCB;
+            }
+            portDATA_SYNC_BARRIER();
+            pxTable->ulSequence++;
+        }
+        else
+        {
+            /* The table is full, the task is not reported. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSnapshotRemoveTask( TCB_t * pxTCB )
+    {
+        volatile TaskSnapshotTable_t * const pxTable = &( xTaskSnapshotTable );
+
+        if( pxTCB->uxSnapshotSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS )
+        {
+            pxTable->ulSequence++;
+            portDATA_SYNC_BARRIER();
+            {
+                pxTable->xRecords[ pxTCB->uxSnapshotSlot ].xHandle = NULL;
+            }
+            portDATA_SYNC_BARRIER();
+            pxTable->ulSequence++;
+
+            /* A task deleting itself is still switched out once more. */
+            pxTCB->uxSnapshotSlot = ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSnapshotSwitch( const TCB_t * pxPreviousTCB )
+    {
+        volatile TaskSnapshotTable_t * const pxTable = &( xTaskSnapshotTable );
+        volatile TaskSnapshotRecord_t * pxRecord;
+        const TCB_t * const pxNextTCB = pxCurrentTCB;
+
+        /* Both records are published in one update so a reader never sees
+         * two tasks of the same core in the Running state. */
+        pxTable->ulSequence++;
+        portDATA_SYNC_BARRIER();
+        {
+            if( pxPreviousTCB->uxSnapshotSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS )
+            {
+                pxRecord = &( pxTable->xRecords[ pxPreviousTCB->uxSnapshotSlot ] );
+                pxRecord->eCurrentState = prvSnapshotTaskState( pxPreviousTCB );
+                pxRecord->uxCurrentPriority = pxPreviousTCB->uxPriority;
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                    {
+                        pxRecord->ulRunTimeCounter = pxPreviousTCB->ulRunTimeCounter;
+                    }
+                #endif
+
+                prvSnapshotSampleContext( pxRecord, pxPreviousTCB );
+            }
+
+            if( pxNextTCB->uxSnapshotSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS )
+            {
+                pxRecord = &( pxTable->xRecords[ pxNextTCB->uxSnapshotSlot ] );
+                pxRecord->eCurrentState = eRunning;
+                pxRecord->uxCurrentPriority = pxNextTCB->uxPriority;
+                pxRecord->ulSwitchInCount++;
+            }
+        }
+        portDATA_SYNC_BARRIER();
+        pxTable->ulSequence++;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskSnapshotRead( BaseType_t xCoreID,
+                                    TaskSnapshotRecord_t * const pxRecords,
+                                    const UBaseType_t uxArraySize )
+    {
+        volatile TaskSnapshotTable_t * pxTable;
+        UBaseType_t uxAttempt, uxSlot, uxCount = ( UBaseType_t ) 0U;
+        uint32_t ulSequence;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUM_CORES ) );
+        configASSERT( pxRecords );
+
+        pxTable = &( xTaskSnapshotTables[ xCoreID ] );
+
+        for( uxAttempt = ( UBaseType_t ) 0U; uxAttempt < ( UBaseType_t ) configTASK_SNAPSHOT_READ_RETRIES; uxAttempt++ )
+        {
+            ulSequence = pxTable->ulSequence;
+            portDATA_SYNC_BARRIER();
+
+            if( ( ulSequence & 1UL ) == 0UL )
+            {
+                uxCount = ( UBaseType_t ) 0U;
+
+                for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) configTASK_SNAPSHOT_MAX_TASKS; uxSlot++ )
+                {
+                    if( ( pxTable->xRecords[ uxSlot ].xHandle != NULL ) && ( uxCount < uxArraySize ) )
+                    {
+                        pxRecords[ uxCount ] = pxTable->xRecords[ uxSlot ];
+                        uxCount++;
+                    }
+                }
+
+                portDATA_SYNC_BARRIER();
+
+                if( pxTable->ulSequence == ulSequence )
+                {
+                    break;
+                }
+            }
+
+            /* The owning core updated the table during the copy, try again. */
+            uxCount = ( UBaseType_t ) 0U;
+        }
+
+        return uxCount;
+    }
+
+#endif /* configUSE_TASK_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PERIODIC_TASKS == 1 )
+
+    static void prvResetPeriodicCountdown( void )
+    {
+        UBaseType_t x;
+        TickType_t xTicksToRelease, xCountdown = ( TickType_t ) 0U;
+        const TickType_t xConstTickCount = xTickCount;
+
+        for( x = 0; x < ( UBaseType_t ) configPERIODIC_MAX_PERIODS; x++ )
+        {
+            if( xPeriodicGroups[ x ].xPeriod != ( TickType_t ) 0U )
+            {
+                /* Release times are always ahead of the tick count, so the
+                 * difference is correct across a tick count overflow. */
+                xTicksToRelease = xPeriodicGroups[ x ].xNextRelease - xConstTickCount;
+
+                if( ( xCountdown == ( TickType_t ) 0U ) || ( xTicksToRelease < xCountdown ) )
+                {
+                    xCountdown = xTicksToRelease;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        xPeriodicCountdown = xCountdown;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReleasePeriodicTasks( const TickType_t xConstTickCount )
+    {
+        UBaseType_t x;
+        TCB_t * pxTCB;
+        PeriodicGroup_t * pxGroup;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        for( x = 0; x < ( UBaseType_t ) configPERIODIC_MAX_PERIODS; x++ )
+        {
+            pxGroup = &( xPeriodicGroups[ x ] );
+
+            /* A group is due when its release time is not ahead of the tick
+             * count.  The release time can be more than one period behind
+             * after a tickless idle period, every missed release is counted. */
+            if( ( pxGroup->xPeriod == ( TickType_t ) 0U ) ||
+                ( ( TickType_t ) ( xConstTickCount - pxGroup->xNextRelease ) > ( portMAX_DELAY >> 1 ) ) )
+            {
+                continue;
+            }
+
+            do
+            {
+                pxGroup->xNextRelease += pxGroup->xPeriod;
+                pxGroup->ulReleaseCount++;
+            } while( ( TickType_t ) ( xConstTickCount - pxGroup->xNextRelease ) <= ( portMAX_DELAY >> 1 ) );
+
+            while( listLIST_IS_EMPTY( &( pxGroup->xWaitingTasks ) ) == pdFALSE )
+            {
+                pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxGroup->xWaitingTasks ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                pxTCB->ulPeriodicRelease = pxGroup->ulReleaseCount;
+                prvAddTaskToReadyList( pxTCB );
+
+                #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        if( taskPARTITION_PRIORITY( pxTCB ) >= taskPARTITION_PRIORITY( pxCurrentTCB ) )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_PREEMPTION */
+            }
+        }
+
+        prvResetPeriodicCountdown();
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvPeriodicDetach( TCB_t * pxTCB )
+    {
+        PeriodicGroup_t * pxGroup = pxTCB->pxPeriodicGroup;
+
+        pxTCB->pxPeriodicGroup = NULL;
+        pxGroup->uxMembers--;
+
+        if( pxGroup->uxMembers == ( UBaseType_t ) 0U )
+        {
+            /* The last task using the period left, free the group. */
+            pxGroup->xPeriod = ( TickType_t ) 0U;
+            prvResetPeriodicCountdown();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskSetPeriod( TaskHandle_t xTask,
+                               const TickType_t xPeriod )
+    {
+        TCB_t * pxTCB;
+        PeriodicGroup_t * pxGroup = NULL;
+        UBaseType_t x;
+        BaseType_t xReturn = pdPASS;
+
+        vTaskSuspendAll();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            if( xPeriod != ( TickType_t ) 0U )
+            {
+                /* Join the group of tasks that already use the period, or
+                 * else take a free group. */
+                for( x = 0; x < ( UBaseType_t ) configPERIODIC_MAX_PERIODS; x++ )
+                {
+                    if( xPeriodicGroups[ x ].xPeriod == xPeriod )
+                    {
+                        pxGroup = &( xPeriodicGroups[ x ] );
+                        break;
+                    }
+                    else if( ( pxGroup == NULL ) && ( xPeriodicGroups[ x ].xPeriod == ( TickType_t ) 0U ) )
+                    {
+                        pxGroup = &( xPeriodicGroups[ x ] );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( pxGroup == NULL )
+                {
+                    xReturn = pdFAIL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( xReturn != pdFAIL ) && ( pxGroup != pxTCB->pxPeriodicGroup ) )
+            {
+                if( pxTCB->pxPeriodicGroup != NULL )
+                {
+                    /* The task must not be left in the list of its old
+                     * group. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) ) != &( pxTCB->pxPeriodicGroup->xWaitingTasks ) );
+                    prvPeriodicDetach( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( pxGroup != NULL )
+                {
+                    if( pxGroup->uxMembers == ( UBaseType_t ) 0U )
+                    {
+                        /* Releases fall on multiples of the period. */
+                        pxGroup->xPeriod = xPeriod;
+                        pxGroup->xNextRelease = ( ( xTickCount / xPeriod ) + ( TickType_t ) 1U ) * xPeriod;
+                        pxGroup->ulReleaseCount = 0UL;
+                        vListInitialise( &( pxGroup->xWaitingTasks ) );
+                        prvResetPeriodicCountdown();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxGroup->uxMembers++;
+                    pxTCB->pxPeriodicGroup = pxGroup;
+                    pxTCB->ulPeriodicRelease = pxGroup->ulReleaseCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskWaitForNextPeriod( void )
+    {
+        PeriodicGroup_t * pxGroup;
+        BaseType_t xAlreadyYielded, xReturn = pdPASS;
+
+        configASSERT( pxCurrentTCB->pxPeriodicGroup );
+        configASSERT( uxSchedulerSuspended == 0 );
+
+        vTaskSuspendAll();
+        {
+            pxGroup = pxCurrentTCB->pxPeriodicGroup;
+
+            if( pxGroup->ulReleaseCount == pxCurrentTCB->ulPeriodicRelease )
+            {
+                /* The same list item is used for the ready list and the
+                 * group, and the group list is not ordered, so waiting costs
+                 * two constant time list operations. */
+                if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                vListInsertEnd( &( pxGroup->xWaitingTasks ), &( pxCurrentTCB->xStateListItem ) );
+            }
+            else
+            {
+                /* The group was released again while the task was still
+                 * running: do not block, the task is already late. */
+                pxCurrentTCB->ulPeriodicOverruns += pxGroup->ulReleaseCount - pxCurrentTCB->ulPeriodicRelease;
+                pxCurrentTCB->ulPeriodicRelease = pxGroup->ulReleaseCount;
+                traceTASK_PERIODIC_OVERRUN( pxCurrentTCB );
+                xReturn = pdFAIL;
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xReturn != pdFAIL ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskGetPeriodicOverruns( TaskHandle_t xTask )
+    {
+        TCB_t const * pxTCB = prvGetTCBFromHandle( xTask );
+
+        return pxTCB->ulPeriodicOverruns;
+    }
+
+#endif /* configUSE_PERIODIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PARTITIONS == 1 )
+
+    static void prvSelectHighestPriorityTask( void )
+    {
+        UBaseType_t uxPartition = uxActivePartition;
+        UBaseType_t uxTopPriority;
+        List_t * pxLists;
+
+        for( ; ; )
+        {
+            pxLists = pxReadyTasksListss[ portGET_CORE_ID() ][ uxPartition ];
+            uxTopPriority = uxTopReadyPrioritys[ portGET_CORE_ID() ][ uxPartition ];
+
+            /* Find the highest priority queue of the partition that contains
+             * ready tasks. */
+            while( ( uxTopPriority > ( UBaseType_t ) tskIDLE_PRIORITY ) && ( listLIST_IS_EMPTY( &( pxLists[ uxTopPriority ] ) ) != pdFALSE ) )
+            {
+                --uxTopPriority;
+            }
+
+            uxTopReadyPrioritys[ portGET_CORE_ID() ][ uxPartition ] = uxTopPriority;
+
+            if( listLIST_IS_EMPTY( &( pxLists[ uxTopPriority ] ) ) == pdFALSE )
+            {
+                /* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the
+                 * tasks of the same priority get an equal share of the
+                 * processor time. */
+                listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxLists[ uxTopPriority ] ) );
+                break;
+            }
+
+            /* The owner of the window has nothing ready, so the rest of the
+             * window is donated to the background partition.  The idle task
+             * never leaves the background partition, so the search ends
+             * there. */
+            configASSERT( uxPartition != ( UBaseType_t ) 0U );
+            uxPartition = ( UBaseType_t ) 0U;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskSetPartitionSchedule( const PartitionWindow_t * const pxWindows,
+                                          const UBaseType_t uxWindowCount )
+    {
+        UBaseType_t x;
+        BaseType_t xReturn = pdPASS;
+
+        /* The window interrupt reads the table without a lock, so a table can
+         * only be installed before the scheduler is started on this core. */
+        if( ( xSchedulerRunning != pdFALSE ) || ( pxWindows == NULL ) || ( uxWindowCount == ( UBaseType_t ) 0U ) )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            for( x = 0; x < uxWindowCount; x++ )
+            {
+                if( ( pxWindows[ x ].uxPartition >= ( UBaseType_t ) configNUM_PARTITIONS ) || ( pxWindows[ x ].ulDuration == 0UL ) )
+                {
+                    xReturn = pdFAIL;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        if( xReturn != pdFAIL )
+        {
+            pxPartitionWindows = pxWindows;
+            uxPartitionWindowCount = uxWindowCount;
+            uxPartitionWindowIndex = ( UBaseType_t ) 0U;
+            uxActivePartition = pxWindows[ 0 ].uxPartition;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetPartition( TaskHandle_t xTask,
+                            UBaseType_t uxPartition )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( uxPartition < ( UBaseType_t ) configNUM_PARTITIONS );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            /* The idle task keeps the background partition runnable. */
+            configASSERT( ( pxTCB != ( TCB_t * ) xIdleTaskHandle ) || ( uxPartition == ( UBaseType_t ) 0U ) );
+
+            if( pxTCB->uxPartition != uxPartition )
+            {
+                if( listIS_CONTAINED_WITHIN( &( taskREADY_LISTS( pxTCB )[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    /* The task is ready, move it to the ready list of its
+                     * priority in the new partition. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    pxTCB->uxPartition = uxPartition;
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    pxTCB->uxPartition = uxPartition;
+                }
+
+                /* Moving a task into or out of the partition that owns the
+                 * window can change which task should be running. */
+                if( xSchedulerRunning != pdFALSE )
+                {
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskGetActivePartition( void )
+    {
+        return uxActivePartition;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskGetPartitionWindowDuration( void )
+    {
+        uint32_t ulReturn = 0UL;
+
+        if( pxPartitionWindows != NULL )
+        {
+            ulReturn = pxPartitionWindows[ uxPartitionWindowIndex ].ulDuration;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskNextPartitionWindowFromISR( BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus, uxIndex, uxPartition;
+        uint32_t ulReturn = 0UL;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pxPartitionWindows != NULL )
+            {
+                uxIndex = uxPartitionWindowIndex + ( UBaseType_t ) 1U;
+
+                if( uxIndex >= uxPartitionWindowCount )
+                {
+                    /* Start the next major frame. */
+                    uxIndex = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxPartitionWindowIndex = uxIndex;
+                uxPartition = pxPartitionWindows[ uxIndex ].uxPartition;
+                ulReturn = pxPartitionWindows[ uxIndex ].ulDuration;
+
+                if( uxPartition != uxActivePartition )
+                {
+                    traceTASK_PARTITION_SWITCH( uxActivePartition, uxPartition );
+                    uxActivePartition = uxPartition;
+
+                    /* The running task belongs to the old owner or to the
+                     * background partition, either way a new selection is
+                     * needed.  Mark the yield as pending in case the caller
+                     * does not act on the returned flag. */
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+
+                    xYieldPending = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_PARTITIONS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+
+    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    {
+        uint32_t ulCount = 0U;
+
+        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        {
+            pucStackByte -= portSTACK_GROWTH;
+            ulCount++;
+        }
+
+        ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+
+        return ( configSTACK_DEPTH_TYPE ) ulCount;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+ * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+ * user to determine the return type.  It gets around the problem of the value
+ * overflowing on 8-bit types without breaking backward compatibility for
+ * applications that expect an 8-bit return type. */
+    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        configSTACK_DEPTH_TYPE uxReturn;
+
+        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
          * the same except for their return type.  Using configSTACK_DEPTH_TYPE
          * allows the user to determine the return type.  It gets around the
          * problem of the value overflowing on 8-bit types without breaking
@@ -4110,7 +5219,7 @@ static void prvResetNextTaskUnblockTime( void )
 
                 /* If the task being modified is in the ready state it will need
                  * to be moved into a new list. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( &( taskREADY_LISTS( pxMutexHolderTCB )[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
                 {
                     if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
@@ -4315,7 +5424,7 @@ static void prvResetNextTaskUnblockTime( void )
                      * from its current state list if it is in the Ready state as
                      * the task's priority is going to change and there is one
                      * Ready list per priority. */
-                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                    if( listIS_CONTAINED_WITHIN( &( taskREADY_LISTS( pxTCB )[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                     {
                         if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                         {
@@ -4964,7 +6073,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     }
                 #endif
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskPARTITION_PRIORITY( pxTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5099,7 +6208,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskPARTITION_PRIORITY( pxTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5190,7 +6299,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskPARTITION_PRIORITY( pxTCB ) > taskPARTITION_PRIORITY( pxCurrentTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5284,6 +6393,45 @@ TickType_t uxTaskResetEventItemValue( void )
     {
         return xIdleTaskHandle->ulRunTimeCounter;
     }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskGetIdleRunTimeCounterFromCore( BaseType_t xCoreID )
+    {
+        const TCB_t * pxIdleTCB;
+        uint32_t ulSwitchedInTime, ulCounter = 0UL;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < ( BaseType_t ) configNUM_CORES ) );
+
+        pxIdleTCB = xIdleTaskHandles[ xCoreID ];
+
+        /* The idle task does not exist before the scheduler is started on the
+         * core. */
+        if( pxIdleTCB != NULL )
+        {
+            /* The core only adds to the counter of its idle task when the idle
+             * task is switched out, so a core that is idle now is also credited
+             * with the time since the idle task was switched in.  Nothing here
+             * is locked against the other core, a read that races one of its
+             * context switches can be off by the length of one run interval. */
+            ulSwitchedInTime = ulTaskSwitchedInTimes[ xCoreID ];
+            ulCounter = pxIdleTCB->ulRunTimeCounter;
+
+            if( pxCurrentTCBs[ xCoreID ] == pxIdleTCB )
+            {
+                ulCounter += portGET_RUN_TIME_COUNTER_VALUE() - ulSwitchedInTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulCounter;
+    }
 
 #endif
 /*-----------------------------------------------------------*/
@@ -80,7 +80,7 @@
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1
 #define configUSE_TRACE_FACILITY                0
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
@@ -106,6 +106,39 @@
 #define configTICK_CORE                         0
 #define configRUN_MULTIPLE_PRIORITIES           0
 
+/* TriCore port only */
+#define configENABLE_TRICORE_PRS_ISOLATION      0
+
+/* Event multiplexer, see event_mux.h */
+#define configUSE_EVENT_MUX                     1
+
+/* Zero-copy message pools, see message_pool.h */
+#define configUSE_MESSAGE_POOLS                 1
+
+/* Lock free ISR to task channels, see channel.h */
+#define configUSE_CHANNELS                      1
+
+/* Cross-core reader-writer locks, see rwlock.h */
+#define configUSE_RWLOCKS                       1
+
+/* Read-copy-update for shared tables, see rcu.h */
+#define configUSE_RCU                           0
+
+/* Kernel released periodic tasks, see xTaskWaitForNextPeriod() */
+#define configUSE_PERIODIC_TASKS                1
+#define configPERIODIC_MAX_PERIODS              4
+
+/* Time partitioned scheduling windows, see xTaskSetPartitionSchedule() */
+#define configUSE_PARTITIONS                    0
+#define configNUM_PARTITIONS                    4
+
+/* GPIO trace of task switches and port interrupts, see os_trace.h */
+#define configUSE_GPIO_TRACE                    0
+
+/* Per-core task snapshot tables for uxTaskSnapshotRead() */
+#define configUSE_TASK_SNAPSHOT                 0
+#define configTASK_SNAPSHOT_MAX_TASKS           8
+
 #include <assert.h>
 /* Define to trap errors during development. */
 #define configASSERT(x)                         assert(x)
@@ -132,5 +165,8 @@ to exclude the API function. */
 #define configMAX_API_CALL_INTERRUPT_PRIORITY   31
 #define configKERNEL_INTERRUPT_PRIORITY         1  /* This value must not be changed from 1. */
 /* A header file that defines trace macro can be included here. */
+#if ( configUSE_GPIO_TRACE == 1 )
+    #include "os_trace.h"
+#endif
 #define portNUM_PROCESSORS    configNUM_CORES
 #endif /* FREERTOS_CONFIG_H */
@@ -5,7 +5,9 @@
 #include "Ifx_Cfg_Ssw.h"
 #include "FreeRTOS.h"
 #include "task.h"
-#include <stdio.h>
+#include "os_gen_cfg.h"
+#include "os_console.h"
+#include "os_gw_can.h"
 /******************************************************************************/
 /*------------------------------Global variables------------------------------*/
 /******************************************************************************/
@@ -16,49 +18,48 @@
 /******************************************************************************/
 
 #define CORE0_TASK_PERIOD_MS             (1000)
-#define CORE0_TASK_PRIORITY              (1)
 
 #define CORE1_TASK_PERIOD_MS		     (500)
-#define CORE1_TASK_PRIORITY				 (2)
 
 #define CORE2_TASK_PERIOD_MS             (200)
-#define CORE2_TASK_PRIORITY              (3)
 
 #define CORE3_TASK_PERIOD_MS             (100)
-#define CORE3_TASK_PRIORITY              (4)
 
 #define CORE4_TASK_PERIOD_MS             (50)
-#define CORE4_TASK_PRIORITY              (5)
 
 #define CORE5_TASK_PERIOD_MS             (20)
-#define CORE5_TASK_PRIORITY              (6)
 
 /******************************************************************************/
 /*--------------------------Function Implementations--------------------------*/
 /******************************************************************************/
 volatile uint32 Core0TaskCount= 0UL;
-static void Core0Task(void *arg)
+void Core0Task(void *arg)
 {
     (void)arg;
 
+    /* Released by the kernel every period, see xTaskWaitForNextPeriod() */
+    (void)xTaskSetPeriod(NULL, CORE0_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE0_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core0TaskCount++;
         {
-            printf("Core0Task\n");
+            IfxStdIf_DPipe_print(os_console_getIo(), "Core0Task"ENDL);
         }
     }
 }
 
 volatile uint32 Core1TaskCount= 0UL;
-static void Core1Task(void *arg)
+void Core1Task(void *arg)
 {
     (void)arg;
 
+    (void)xTaskSetPeriod(NULL, CORE1_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE1_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core1TaskCount++;
         {
             __nop();
@@ -67,13 +68,15 @@ static void Core1Task(void *arg)
 }
 
 volatile uint32 Core2TaskCount= 0UL;
-static void Core2Task(void *arg)
+void Core2Task(void *arg)
 {
     (void)arg;
 
+    (void)xTaskSetPeriod(NULL, CORE2_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE2_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core2TaskCount++;
         {
             __nop();
@@ -82,13 +85,15 @@ static void Core2Task(void *arg)
 }
 
 volatile uint32 Core3TaskCount= 0UL;
-static void Core3Task(void *arg)
+void Core3Task(void *arg)
 {
     (void)arg;
 
+    (void)xTaskSetPeriod(NULL, CORE3_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE3_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core3TaskCount++;
         {
             __nop();
@@ -97,13 +102,15 @@ static void Core3Task(void *arg)
 }
 
 volatile uint32 Core4TaskCount= 0UL;
-static void Core4Task(void *arg)
+void Core4Task(void *arg)
 {
     (void)arg;
 
+    (void)xTaskSetPeriod(NULL, CORE4_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE4_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core4TaskCount++;
         {
             __nop();
@@ -112,13 +119,15 @@ static void Core4Task(void *arg)
 }
 
 volatile uint32 Core5TaskCount= 0UL;
-static void Core5Task(void *arg)
+void Core5Task(void *arg)
 {
     (void)arg;
 
+    (void)xTaskSetPeriod(NULL, CORE5_TASK_PERIOD_MS);
+
     while (1)
     {
-        vTaskDelay(CORE5_TASK_PERIOD_MS);
+        (void)xTaskWaitForNextPeriod();
         Core5TaskCount++;
         {
             __nop();
@@ -149,63 +158,8 @@ void os_init_core0(void)
 
     IfxScuWdt_disableSafetyWatchdog(IfxScuWdt_getSafetyWatchdogPassword());
 
-	/* Create tasks. */
-    xTaskCreate(Core0Task,
-                "Core0 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE0_TASK_PRIORITY,
-                NULL);
-}
-
-void os_init_core1(void)
-{
-    xTaskCreate(Core1Task,
-                "Core1 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE1_TASK_PRIORITY,
-                NULL);
-}
-
-void os_init_core2(void)
-{
-    xTaskCreate(Core2Task,
-                "Core2 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE2_TASK_PRIORITY,
-                NULL);
-}
-
-void os_init_core3(void)
-{
-    xTaskCreate(Core3Task,
-                "Core3 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE3_TASK_PRIORITY,
-                NULL);
-}
-
-void os_init_core4(void)
-{
-    xTaskCreate(Core4Task,
-                "Core4 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE4_TASK_PRIORITY,
-                NULL);
-}
-
-void os_init_core5(void)
-{
-    xTaskCreate(Core5Task,
-                "Core5 Task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                CORE5_TASK_PRIORITY,
-                NULL);
+    /* Before the net task of core 0 starts receiving. */
+    os_gw_can_init();
 }
 
 void os_init(void)
@@ -224,26 +178,16 @@ void os_init(void)
     {
         os_init_core0();
     }
-    if ( portGET_CORE_ID() == 1 )
-    {
-        os_init_core1();
-    }
-    if ( portGET_CORE_ID() == 2 )
-    {
-        os_init_core2();
-    }
-    if ( portGET_CORE_ID() == 3 )
-    {
-        os_init_core3();
-    }
-    if ( portGET_CORE_ID() == 4 )
-    {
-        os_init_core4();
-    }
-    if ( portGET_CORE_ID() == 6 )
-    {
-        os_init_core5();
-    }
+
+#if ( configUSE_GPIO_TRACE == 1 )
+    os_trace_init();
+#endif
+
+    os_console_init();
+
+    /* Create the statically allocated tasks of this core, see os_system.json. */
+    os_gen_init();
+
     IfxCpu_enableInterrupts();
 
     vTaskStartScheduler();
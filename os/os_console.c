@@ -0,0 +1,365 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "Asclin/Asc/IfxAsclin_Asc.h"
+#include "os_console.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_CONSOLE_RING_MASK             (OS_CONSOLE_RING_SIZE - 1)
+#define OS_CONSOLE_RX_BUFFER_SIZE        (16)     /* The console takes no input           */
+#define OS_CONSOLE_TAG_SIZE              (5)      /* "[cN] "                              */
+
+#if ((OS_CONSOLE_RING_SIZE & OS_CONSOLE_RING_MASK) != 0) || (OS_CONSOLE_LINE_MAX >= OS_CONSOLE_RING_SIZE)
+#error OS_CONSOLE_RING_SIZE must be a power of two larger than OS_CONSOLE_LINE_MAX
+#endif
+
+/* The ring of one core.  The core's tasks and interrupts are the only writers
+ * of head and status, the console task the only writer of tail. */
+typedef struct
+{
+    volatile uint32  head;                          /* Bytes written since start     */
+    volatile uint32  tail;                          /* Bytes forwarded since start   */
+    OsConsole_Status status;
+    uint8            data[OS_CONSOLE_RING_SIZE];
+} OsConsole_Ring;
+
+/* Logical core number printed in the line tags, indexed by
+ * portGET_CORE_ID(), core ID 5 is not used. */
+static const char     os_console_tags[configNUM_CORES] = {'0', '1', '2', '3', '4', '\0', '5'};
+
+static OsConsole_Ring os_console_rings[configNUM_CORES];
+static IfxStdIf_DPipe os_console_pipes[configNUM_CORES];
+
+/* ASCLIN0 and its driver FIFOs, only used by core 0. */
+static IfxAsclin_Asc  os_console_asc;
+static IfxStdIf_DPipe os_console_uart;
+static uint8          os_console_txBuffer[OS_CONSOLE_TX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+static uint8          os_console_rxBuffer[OS_CONSOLE_RX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+static uint8          os_console_line[OS_CONSOLE_TAG_SIZE + OS_CONSOLE_LINE_MAX + 2];
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+static boolean os_console_write(IfxStdIf_InterfaceDriver stdIf, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    OsConsole_Ring *ring      = (OsConsole_Ring *)stdIf;
+    const uint8    *bytes     = (const uint8 *)data;
+    uint32          start     = portGET_RUN_TIME_COUNTER_VALUE();
+    uint32          requested = (uint32)*count;
+    uint32          length;
+    uint32          offset;
+    uint32          first;
+    uint32          elapsed;
+    UBaseType_t     savedMask;
+
+    (void)timeout;
+
+    /* Tasks and interrupts of the core share the ring, keep them apart until
+     * the head has moved.  Nothing here waits for the console task. */
+    savedMask = taskENTER_CRITICAL_FROM_ISR();
+
+    /* A write that does not fit is dropped whole, a fragment would be joined
+     * to the next line by the console task. */
+    length = OS_CONSOLE_RING_SIZE - (ring->head - ring->tail);
+    length = (length < requested) ? 0 : requested;
+    offset = ring->head & OS_CONSOLE_RING_MASK;
+    first  = OS_CONSOLE_RING_SIZE - offset;
+    first  = (first < length) ? first : length;
+
+    memcpy(&ring->data[offset], bytes, first);
+    memcpy(&ring->data[0], &bytes[first], length - first);
+
+    /* The bytes must be in memory before the head that hands them to core 0. */
+    portMEMORY_BARRIER();
+    ring->head += length;
+
+    ring->status.written += length;
+    ring->status.dropped += requested - length;
+    elapsed               = portGET_RUN_TIME_COUNTER_VALUE() - start;
+
+    if (elapsed > ring->status.maxWriteTicks)
+    {
+        ring->status.maxWriteTicks = elapsed;
+    }
+
+    taskEXIT_CRITICAL_FROM_ISR(savedMask);
+
+    *count = (Ifx_SizeT)length;
+
+    return length == requested;
+}
+
+static boolean os_console_read(IfxStdIf_InterfaceDriver stdIf, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    (void)stdIf;
+    (void)data;
+    (void)timeout;
+
+    *count = 0;
+
+    return FALSE;
+}
+
+static sint32 os_console_getReadCount(IfxStdIf_InterfaceDriver stdIf)
+{
+    (void)stdIf;
+
+    return 0;
+}
+
+static IfxStdIf_DPipe_ReadEvent os_console_getReadEvent(IfxStdIf_InterfaceDriver stdIf)
+{
+    (void)stdIf;
+
+    return NULL_PTR;
+}
+
+static sint32 os_console_getWriteCount(IfxStdIf_InterfaceDriver stdIf)
+{
+    OsConsole_Ring *ring = (OsConsole_Ring *)stdIf;
+
+    return (sint32)(OS_CONSOLE_RING_SIZE - (ring->head - ring->tail));
+}
+
+static IfxStdIf_DPipe_WriteEvent os_console_getWriteEvent(IfxStdIf_InterfaceDriver stdIf)
+{
+    (void)stdIf;
+
+    return NULL_PTR;
+}
+
+static boolean os_console_canReadCount(IfxStdIf_InterfaceDriver stdIf, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    (void)stdIf;
+    (void)count;
+    (void)timeout;
+
+    return FALSE;
+}
+
+static boolean os_console_canWriteCount(IfxStdIf_InterfaceDriver stdIf, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    (void)timeout;
+
+    return os_console_getWriteCount(stdIf) >= (sint32)count;
+}
+
+static boolean os_console_flushTx(IfxStdIf_InterfaceDriver stdIf, Ifx_TickTime timeout)
+{
+    OsConsole_Ring *ring = (OsConsole_Ring *)stdIf;
+
+    (void)timeout;
+
+    return ring->head == ring->tail;
+}
+
+static void os_console_noAction(IfxStdIf_InterfaceDriver stdIf)
+{
+    /* The console task owns the tail and the UART: a core can neither discard
+     * queued output nor take part in the UART interrupts. */
+    (void)stdIf;
+}
+
+static uint32 os_console_getSendCount(IfxStdIf_InterfaceDriver stdIf)
+{
+    OsConsole_Ring *ring = (OsConsole_Ring *)stdIf;
+
+    return ring->status.written;
+}
+
+static Ifx_TickTime os_console_getTxTimeStamp(IfxStdIf_InterfaceDriver stdIf)
+{
+    (void)stdIf;
+
+    return 0;
+}
+
+void os_console_init(void)
+{
+    uint32          coreId = portGET_CORE_ID();
+    IfxStdIf_DPipe *pipe   = &os_console_pipes[coreId];
+
+    memset(pipe, 0, sizeof(IfxStdIf_DPipe));
+
+    pipe->driver         = &os_console_rings[coreId];
+    pipe->write          = &os_console_write;
+    pipe->read           = &os_console_read;
+    pipe->getReadCount   = &os_console_getReadCount;
+    pipe->getReadEvent   = &os_console_getReadEvent;
+    pipe->getWriteCount  = &os_console_getWriteCount;
+    pipe->getWriteEvent  = &os_console_getWriteEvent;
+    pipe->canReadCount   = &os_console_canReadCount;
+    pipe->canWriteCount  = &os_console_canWriteCount;
+    pipe->flushTx        = &os_console_flushTx;
+    pipe->clearTx        = &os_console_noAction;
+    pipe->clearRx        = &os_console_noAction;
+    pipe->onReceive      = &os_console_noAction;
+    pipe->onTransmit     = &os_console_noAction;
+    pipe->onError        = &os_console_noAction;
+    pipe->getSendCount   = &os_console_getSendCount;
+    pipe->getTxTimeStamp = &os_console_getTxTimeStamp;
+    pipe->resetSendCount = &os_console_noAction;
+    pipe->txDisabled     = FALSE;
+}
+
+IfxStdIf_DPipe *os_console_getIo(void)
+{
+    return &os_console_pipes[portGET_CORE_ID()];
+}
+
+static void os_console_initUart(void)
+{
+    static const IfxAsclin_Asc_Pins pins = {
+        NULL_PTR,                 IfxPort_InputMode_pullUp,    /* CTS not used */
+        &IfxAsclin0_RXA_P14_1_IN, IfxPort_InputMode_pullUp,
+        NULL_PTR,                 IfxPort_OutputMode_pushPull, /* RTS not used */
+        &IfxAsclin0_TX_P14_0_OUT, IfxPort_OutputMode_pushPull,
+        IfxPort_PadDriver_cmosAutomotiveSpeed1
+    };
+    IfxAsclin_Asc_Config config;
+
+    IfxAsclin_Asc_initModuleConfig(&config, &MODULE_ASCLIN0);
+
+    config.baudrate.baudrate       = OS_CONSOLE_BAUDRATE;
+    config.interrupt.txPriority    = OS_CONSOLE_ISR_PRIORITY_TX;
+    config.interrupt.rxPriority    = OS_CONSOLE_ISR_PRIORITY_RX;
+    config.interrupt.erPriority    = OS_CONSOLE_ISR_PRIORITY_ER;
+    config.interrupt.typeOfService = IfxSrc_Tos_cpu0;
+    config.pins                    = &pins;
+    config.txBuffer                = os_console_txBuffer;
+    config.txBufferSize            = OS_CONSOLE_TX_BUFFER_SIZE;
+    config.rxBuffer                = os_console_rxBuffer;
+    config.rxBufferSize            = OS_CONSOLE_RX_BUFFER_SIZE;
+
+    (void)IfxAsclin_Asc_initModule(&os_console_asc, &config);
+    (void)IfxAsclin_Asc_stdIfDPipeInit(&os_console_uart, &os_console_asc);
+}
+
+/* Copies the next line of a ring, tagged, into os_console_line and returns
+ * its length, or 0 if the ring holds no complete line. */
+static uint32 os_console_takeLine(uint32 coreId)
+{
+    OsConsole_Ring *ring      = &os_console_rings[coreId];
+    uint8          *line      = &os_console_line[OS_CONSOLE_TAG_SIZE];
+    uint32          tail      = ring->tail;
+    uint32          available = ring->head - tail;
+    uint32          length    = 0;
+    boolean         complete  = FALSE;
+
+    /* Read the head before the bytes it publishes. */
+    portMEMORY_BARRIER();
+
+    available = (available < OS_CONSOLE_LINE_MAX) ? available : OS_CONSOLE_LINE_MAX;
+
+    while ((length < available) && (complete == FALSE))
+    {
+        line[length] = ring->data[(tail + length) & OS_CONSOLE_RING_MASK];
+        complete     = (line[length] == '\n') ? TRUE : FALSE;
+        length++;
+    }
+
+    if ((complete == FALSE) && (length < OS_CONSOLE_LINE_MAX))
+    {
+        /* Wait for the rest of the line. */
+        length = 0;
+    }
+    else
+    {
+        portMEMORY_BARRIER();
+        ring->tail = tail + length;
+
+        if (complete == FALSE)
+        {
+            /* Break an overlong line, its remainder gets a tag of its own. */
+            line[length++] = '\r';
+            line[length++] = '\n';
+        }
+
+        os_console_line[0] = '[';
+        os_console_line[1] = 'c';
+        os_console_line[2] = (uint8)os_console_tags[coreId];
+        os_console_line[3] = ']';
+        os_console_line[4] = ' ';
+        length            += OS_CONSOLE_TAG_SIZE;
+    }
+
+    return length;
+}
+
+void os_console_task(void *arg)
+{
+    uint32    coreId = 0;
+    uint32    idle   = 0;
+    Ifx_SizeT length;
+
+    (void)arg;
+
+    os_console_initUart();
+
+    while (1)
+    {
+        length = (os_console_tags[coreId] != '\0') ? (Ifx_SizeT)os_console_takeLine(coreId) : 0;
+
+        if (length != 0)
+        {
+            /* Sleep rather than spin while the UART drains, the remote cores
+             * never wait for this task. */
+            while (IfxStdIf_DPipe_canWriteCount(&os_console_uart, length, 0) == FALSE)
+            {
+                vTaskDelay(1);
+            }
+
+            (void)IfxStdIf_DPipe_write(&os_console_uart, os_console_line, &length, 0);
+            idle = 0;
+        }
+        else
+        {
+            idle++;
+        }
+
+        /* One line per core and turn keeps a chatty core from starving the
+         * others.  Sleep once a full turn found nothing to send. */
+        coreId = (coreId + 1) % configNUM_CORES;
+
+        if (idle >= configNUM_CORES)
+        {
+            vTaskDelay(pdMS_TO_TICKS(OS_CONSOLE_POLL_MS));
+            idle = 0;
+        }
+    }
+}
+
+boolean os_console_getStatus(uint32 coreId, OsConsole_Status *status)
+{
+    boolean result = FALSE;
+
+    if ((coreId < configNUM_CORES) && (os_console_tags[coreId] != '\0'))
+    {
+        *status = os_console_rings[coreId].status;
+        result  = TRUE;
+    }
+
+    return result;
+}
+
+void os_console_isrTransmit(void)
+{
+    IfxAsclin_Asc_isrTransmit(&os_console_asc);
+}
+
+void os_console_isrReceive(void)
+{
+    IfxAsclin_Asc_isrReceive(&os_console_asc);
+}
+
+void os_console_isrError(void)
+{
+    IfxAsclin_Asc_isrError(&os_console_asc);
+}
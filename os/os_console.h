@@ -0,0 +1,83 @@
+#ifndef OS_CONSOLE_H
+#define OS_CONSOLE_H
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* Every core writes its console output into a ring of its own.  The console
+ * task on core 0 owns ASCLIN0 and is the only reader of the rings. */
+#ifndef OS_CONSOLE_RING_SIZE
+#define OS_CONSOLE_RING_SIZE             (512)    /* Bytes per core, a power of two           */
+#endif
+
+#ifndef OS_CONSOLE_LINE_MAX
+#define OS_CONSOLE_LINE_MAX              (120)    /* Longest line sent without a line break   */
+#endif
+
+#ifndef OS_CONSOLE_POLL_MS
+#define OS_CONSOLE_POLL_MS               (2)      /* Sleep of the console task when idle      */
+#endif
+
+#ifndef OS_CONSOLE_BAUDRATE
+#define OS_CONSOLE_BAUDRATE              (115200.0f)
+#endif
+
+#ifndef OS_CONSOLE_TX_BUFFER_SIZE
+#define OS_CONSOLE_TX_BUFFER_SIZE        (256)    /* Software FIFO of the ASCLIN driver        */
+#endif
+
+/* Interrupt priorities of ASCLIN0 on core 0, they must match os_system.json. */
+#define OS_CONSOLE_ISR_PRIORITY_TX       (10)
+#define OS_CONSOLE_ISR_PRIORITY_RX       (11)
+#define OS_CONSOLE_ISR_PRIORITY_ER       (12)
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* Console statistics of one core, see os_console_getStatus(). */
+typedef struct
+{
+    uint32 written;         /* Bytes accepted into the ring of the core                           */
+    uint32 dropped;         /* Bytes refused because the ring was full                            */
+    uint32 maxWriteTicks;   /* Longest IfxStdIf_DPipe_write() on the core, in STM ticks            */
+} OsConsole_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Sets up the console handle of the calling core.  Called by every core before
+ * it creates its tasks. */
+extern void os_console_init(void);
+
+/* Console handle of the calling core.  Writes never block: they copy the whole
+ * write into the ring of the core, or drop it whole if it does not fit, and
+ * ignore the timeout.  The print functions of IfxStdIf_DPipe and Ifx_Console
+ * write each string at once.  The handle has no input, reads always return
+ * nothing. */
+extern IfxStdIf_DPipe *os_console_getIo(void);
+
+/* Console task, created on core 0 from os_system.json.  It initialises ASCLIN0
+ * and forwards the rings round robin, one line per core and turn, each line
+ * prefixed with the logical core number, e.g. "[c3] ".  Output without a line
+ * break is held back until the break arrives or OS_CONSOLE_LINE_MAX bytes have
+ * accumulated, so that lines of different cores do not interleave. */
+extern void os_console_task(void *arg);
+
+/* Returns FALSE if coreId is not a CPU core ID. */
+extern boolean os_console_getStatus(uint32 coreId, OsConsole_Status *status);
+
+/* ASCLIN0 interrupt handlers, registered in os_system.json. */
+extern void os_console_isrTransmit(void);
+extern void os_console_isrReceive(void);
+extern void os_console_isrError(void);
+
+#endif /* OS_CONSOLE_H */
@@ -0,0 +1,210 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "IfxScuCcu.h"
+#include "Dts/Dts/IfxDts_Dts.h"
+#include "os_dvfs.h"
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+typedef struct
+{
+    uint32        lastTime;     /* Run time counter at the end of the last window  */
+    uint32        lastIdle;     /* Idle run time of the core at the same point     */
+    OsDvfs_Status status;
+} OsDvfs_Core;
+
+/* Indexed by portGET_CORE_ID(), core ID 5 is not used. */
+static const IfxCpu_ResourceCpu os_dvfs_cpus[configNUM_CORES] = {
+    IfxCpu_ResourceCpu_0, IfxCpu_ResourceCpu_1, IfxCpu_ResourceCpu_2, IfxCpu_ResourceCpu_3,
+    IfxCpu_ResourceCpu_4, IfxCpu_ResourceCpu_none, IfxCpu_ResourceCpu_5
+};
+
+static OsDvfs_Core      os_dvfs_cores[configNUM_CORES];
+static volatile boolean os_dvfs_throttled = FALSE;
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+static void os_dvfs_setScale(uint32 coreId, uint32 scale)
+{
+    float32 sriFreq = IfxScuCcu_getSriFrequency();
+
+    /* The divider is written under the safety ENDINIT, which is shared with the
+     * other cores.  The port lock keeps them out of it, the critical section
+     * keeps this core from being preempted while it is open. */
+    taskENTER_CRITICAL();
+    vPortSafetyEndinitLock();
+    (void)IfxScuCcu_setCpuFrequency(os_dvfs_cpus[coreId], (sriFreq * (float32)scale) / (float32)OS_DVFS_SCALE_FULL);
+    vPortSafetyEndinitUnlock();
+    taskEXIT_CRITICAL();
+
+    os_dvfs_cores[coreId].status.scale = scale;
+}
+
+static uint32 os_dvfs_nextScale(uint32 scale, uint32 busy, uint32 maxScale)
+{
+    uint32 next;
+
+    if (busy >= OS_DVFS_UP_PERMILLE)
+    {
+        /* The core is running out of time, go straight to the highest clock
+         * rather than approach it over several windows. */
+        next = maxScale;
+    }
+    else
+    {
+        /* The work of the window takes busy * scale / 64 of the window at the
+         * full clock.  Choose the clock at which it takes the target share. */
+        next = ((busy * scale) + OS_DVFS_TARGET_PERMILLE - 1) / OS_DVFS_TARGET_PERMILLE;
+
+        if ((next + OS_DVFS_STEP_DOWN) < scale)
+        {
+            next = scale - OS_DVFS_STEP_DOWN;
+        }
+
+        if (next < OS_DVFS_MIN_SCALE)
+        {
+            next = OS_DVFS_MIN_SCALE;
+        }
+
+        if (next > maxScale)
+        {
+            next = maxScale;
+        }
+    }
+
+    return next;
+}
+
+static void os_dvfs_update(uint32 coreId, uint32 maxScale)
+{
+    OsDvfs_Core *core     = &os_dvfs_cores[coreId];
+    uint32       now      = portGET_RUN_TIME_COUNTER_VALUE();
+    uint32       idle     = ulTaskGetIdleRunTimeCounterFromCore((BaseType_t)coreId);
+    uint32       elapsed  = now - core->lastTime;
+    uint32       idleTime = idle - core->lastIdle;
+    uint32       busy;
+    uint32       next;
+
+    core->lastTime = now;
+    core->lastIdle = idle;
+
+    /* A read that raced a context switch of the core can make the idle time
+     * negative or longer than the window.  Take a negative value as a fully
+     * busy window, which errs towards a higher clock. */
+    if ((sint32)idleTime < 0)
+    {
+        idleTime = 0;
+    }
+    else if (idleTime > elapsed)
+    {
+        idleTime = elapsed;
+    }
+
+    /* Skip windows too short to resolve a permille, e.g. after a long
+     * preemption of the governor. */
+    if (elapsed >= 1000U)
+    {
+        busy = (elapsed - idleTime) / (elapsed / 1000U);
+        busy = (busy > 1000U) ? 1000U : busy;
+
+        core->status.utilisation = busy;
+        core->status.savedTicks += ((uint64)elapsed * (OS_DVFS_SCALE_FULL - core->status.scale)) / OS_DVFS_SCALE_FULL;
+
+        if ((busy >= OS_DVFS_UP_PERMILLE) && (core->status.scale < OS_DVFS_SCALE_FULL))
+        {
+            core->status.saturated++;
+        }
+
+        next = os_dvfs_nextScale(core->status.scale, busy, maxScale);
+
+        if (next != core->status.scale)
+        {
+            os_dvfs_setScale(coreId, next);
+        }
+    }
+}
+
+void os_dvfs_task(void *arg)
+{
+    const uint16 limit   = IfxDts_Dts_convertFromCelsius(OS_DVFS_THERMAL_LIMIT_C);
+    const uint16 release = IfxDts_Dts_convertFromCelsius(OS_DVFS_THERMAL_RELEASE_C);
+    uint32       coreId;
+    uint32       maxScale;
+    uint16       temperature;
+    IfxDts_Dts_Config dtsConfig;
+
+    (void)arg;
+
+    /* Program the DTS limits with the default SMU alarm thresholds, without
+     * an interrupt.  The first result is ready well before the first sample
+     * below. */
+    IfxDts_Dts_initModuleConfig(&dtsConfig);
+    IfxDts_Dts_initModule(&dtsConfig);
+
+    (void)xTaskSetPeriod(NULL, pdMS_TO_TICKS(OS_DVFS_PERIOD_MS));
+
+    /* Give the other cores one period to start their schedulers, then take
+     * the first sample. */
+    (void)xTaskWaitForNextPeriod();
+
+    for (coreId = 0; coreId < configNUM_CORES; coreId++)
+    {
+        os_dvfs_cores[coreId].status.scale = OS_DVFS_SCALE_FULL;
+        os_dvfs_cores[coreId].lastTime     = portGET_RUN_TIME_COUNTER_VALUE();
+        os_dvfs_cores[coreId].lastIdle     = ulTaskGetIdleRunTimeCounterFromCore((BaseType_t)coreId);
+    }
+
+    while (1)
+    {
+        (void)xTaskWaitForNextPeriod();
+
+        /* The DTS converts continuously, the result register holds the last
+         * measurement.  The release threshold below the limit stops the clocks
+         * from toggling around it. */
+        temperature = IfxDts_getTemperatureValue();
+
+        if (temperature >= limit)
+        {
+            os_dvfs_throttled = TRUE;
+        }
+        else if (temperature <= release)
+        {
+            os_dvfs_throttled = FALSE;
+        }
+
+        maxScale = (os_dvfs_throttled != FALSE) ? OS_DVFS_THERMAL_SCALE : OS_DVFS_SCALE_FULL;
+
+        for (coreId = 0; coreId < configNUM_CORES; coreId++)
+        {
+            if (os_dvfs_cpus[coreId] != IfxCpu_ResourceCpu_none)
+            {
+                os_dvfs_update(coreId, maxScale);
+            }
+        }
+    }
+}
+
+boolean os_dvfs_getStatus(uint32 coreId, OsDvfs_Status *status)
+{
+    boolean result = FALSE;
+
+    if ((coreId < configNUM_CORES) && (os_dvfs_cpus[coreId] != IfxCpu_ResourceCpu_none))
+    {
+        *status = os_dvfs_cores[coreId].status;
+        result  = TRUE;
+    }
+
+    return result;
+}
+
+boolean os_dvfs_isThrottled(void)
+{
+    return os_dvfs_throttled;
+}
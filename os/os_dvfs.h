@@ -0,0 +1,82 @@
+#ifndef OS_DVFS_H
+#define OS_DVFS_H
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* The governor scales the CPU clocks in steps of 1/64 of fSRI, the resolution
+ * of the CCUCON6..11 dividers.  OS_DVFS_SCALE_FULL is the undivided clock. */
+#define OS_DVFS_SCALE_FULL               (64)
+
+#ifndef OS_DVFS_PERIOD_MS
+#define OS_DVFS_PERIOD_MS                (100)   /* Length of a measurement window            */
+#endif
+
+#ifndef OS_DVFS_TARGET_PERMILLE
+#define OS_DVFS_TARGET_PERMILLE          (500)   /* Busy time aimed for after a scale change  */
+#endif
+
+#ifndef OS_DVFS_UP_PERMILLE
+#define OS_DVFS_UP_PERMILLE              (850)   /* Busy time that restores the full clock    */
+#endif
+
+#ifndef OS_DVFS_MIN_SCALE
+#define OS_DVFS_MIN_SCALE                (8)     /* Lowest clock, in 64ths of fSRI            */
+#endif
+
+#ifndef OS_DVFS_STEP_DOWN
+#define OS_DVFS_STEP_DOWN                (8)     /* Largest decrease per window, in 64ths     */
+#endif
+
+#ifndef OS_DVFS_THERMAL_LIMIT_C
+#define OS_DVFS_THERMAL_LIMIT_C          (125.0f) /* Die temperature that starts throttling   */
+#endif
+
+#ifndef OS_DVFS_THERMAL_RELEASE_C
+#define OS_DVFS_THERMAL_RELEASE_C        (115.0f) /* Die temperature that ends throttling     */
+#endif
+
+#ifndef OS_DVFS_THERMAL_SCALE
+#define OS_DVFS_THERMAL_SCALE            (32)    /* Highest clock while throttled, in 64ths   */
+#endif
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* Governor state of one core, see os_dvfs_getStatus(). */
+typedef struct
+{
+    uint32 scale;           /* Current clock in 64ths of fSRI                                           */
+    uint32 utilisation;     /* Busy time of the last window, in permille                                */
+    uint32 saturated;       /* Windows busy above OS_DVFS_UP_PERMILLE while the clock was reduced,
+                             * each one a window in which the governor added deadline risk             */
+    uint64 savedTicks;      /* Sum over the windows of the window length times (64 - scale) / 64, in
+                             * STM ticks.  Times fSRI / fSTM it is the number of CPU cycles not clocked */
+} OsDvfs_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Governor task, created on core 0 from os_system.json.  Every
+ * OS_DVFS_PERIOD_MS it derives the utilisation of each core from the run time
+ * of its idle task and sets the core's divider so the measured work would fill
+ * OS_DVFS_TARGET_PERMILLE of the next window.  The STM, and with it the tick,
+ * is clocked independently of the CPU dividers and is not affected. */
+extern void os_dvfs_task(void *arg);
+
+/* Returns FALSE if coreId is not a CPU core ID. */
+extern boolean os_dvfs_getStatus(uint32 coreId, OsDvfs_Status *status);
+
+/* TRUE while the die temperature holds every core at or below
+ * OS_DVFS_THERMAL_SCALE. */
+extern boolean os_dvfs_isThrottled(void);
+
+#endif /* OS_DVFS_H */
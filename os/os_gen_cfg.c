@@ -0,0 +1,191 @@
+/* Generated by tools/os_gen.py from os_system.json - do not edit. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "os_gen_cfg.h"
+#include "Ifx_Types.h"
+#include "Src/Std/IfxSrc.h"
+
+#if defined(__TASKING__) || defined(__GNUC__)
+#define OS_GEN_SECTION(name) __attribute__((section(name)))
+#else
+#define OS_GEN_SECTION(name)
+#endif
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+TaskHandle_t Core0TaskHandle;
+TaskHandle_t Core1TaskHandle;
+TaskHandle_t Core2TaskHandle;
+TaskHandle_t Core3TaskHandle;
+TaskHandle_t Core4TaskHandle;
+TaskHandle_t Core5TaskHandle;
+TaskHandle_t DvfsTaskHandle;
+TaskHandle_t ConsoleTaskHandle;
+TaskHandle_t NetTaskHandle;
+TaskHandle_t IsoTpTaskHandle;
+TaskHandle_t GatewayTaskHandle;
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+extern void Core0Task(void *arg);
+extern void Core1Task(void *arg);
+extern void Core2Task(void *arg);
+extern void Core3Task(void *arg);
+extern void Core4Task(void *arg);
+extern void Core5Task(void *arg);
+extern void os_console_task(void *arg);
+extern void os_dvfs_task(void *arg);
+extern void os_gw_can_task(void *arg);
+extern void os_isotp_can_task(void *arg);
+extern void os_net_geth_task(void *arg);
+extern void os_console_isrTransmit(void);
+extern void os_console_isrReceive(void);
+extern void os_console_isrError(void);
+extern void os_net_geth_isrReceive(void);
+extern void os_net_geth_isrGate(void);
+extern void os_isotp_can_isrReceive(void);
+extern void os_gw_can_isrReceiveCan1(void);
+extern void os_gw_can_isrReceiveCan2(void);
+
+static StaticTask_t Core0TaskTcb OS_GEN_SECTION(".bss.os_core0");
+static StackType_t  Core0TaskStack[512] OS_GEN_SECTION(".bss.os_core0");
+static StaticTask_t DvfsTaskTcb OS_GEN_SECTION(".bss.os_core0");
+static StackType_t  DvfsTaskStack[512] OS_GEN_SECTION(".bss.os_core0");
+static StaticTask_t ConsoleTaskTcb OS_GEN_SECTION(".bss.os_core0");
+static StackType_t  ConsoleTaskStack[512] OS_GEN_SECTION(".bss.os_core0");
+static StaticTask_t NetTaskTcb OS_GEN_SECTION(".bss.os_core0");
+static StackType_t  NetTaskStack[512] OS_GEN_SECTION(".bss.os_core0");
+static StaticTask_t IsoTpTaskTcb OS_GEN_SECTION(".bss.os_core0");
+static StackType_t  IsoTpTaskStack[512] OS_GEN_SECTION(".bss.os_core0");
+static StaticTask_t Core1TaskTcb OS_GEN_SECTION(".bss.os_core1");
+static StackType_t  Core1TaskStack[512] OS_GEN_SECTION(".bss.os_core1");
+static StaticTask_t GatewayTaskTcb OS_GEN_SECTION(".bss.os_core1");
+static StackType_t  GatewayTaskStack[512] OS_GEN_SECTION(".bss.os_core1");
+static StaticTask_t Core2TaskTcb OS_GEN_SECTION(".bss.os_core2");
+static StackType_t  Core2TaskStack[512] OS_GEN_SECTION(".bss.os_core2");
+static StaticTask_t Core3TaskTcb OS_GEN_SECTION(".bss.os_core3");
+static StackType_t  Core3TaskStack[512] OS_GEN_SECTION(".bss.os_core3");
+static StaticTask_t Core4TaskTcb OS_GEN_SECTION(".bss.os_core4");
+static StackType_t  Core4TaskStack[512] OS_GEN_SECTION(".bss.os_core4");
+static StaticTask_t Core5TaskTcb OS_GEN_SECTION(".bss.os_core5");
+static StackType_t  Core5TaskStack[512] OS_GEN_SECTION(".bss.os_core5");
+
+static const OsGen_Task os_gen_tasks_core0[] = {
+    {Core0Task, "Core0 Task", 512, NULL, 1, Core0TaskStack, &Core0TaskTcb, &Core0TaskHandle},
+    {os_dvfs_task, "DVFS", 512, NULL, 30, DvfsTaskStack, &DvfsTaskTcb, &DvfsTaskHandle},
+    {os_console_task, "Console", 512, NULL, 1, ConsoleTaskStack, &ConsoleTaskTcb, &ConsoleTaskHandle},
+    {os_net_geth_task, "Net", 512, NULL, 20, NetTaskStack, &NetTaskTcb, &NetTaskHandle},
+    {os_isotp_can_task, "ISO-TP", 512, NULL, 19, IsoTpTaskStack, &IsoTpTaskTcb, &IsoTpTaskHandle},
+};
+static const OsGen_Isr os_gen_isrs_core0[] = {
+    {&MODULE_SRC.ASCLIN.ASCLIN[0].TX, IfxSrc_Tos_cpu0, 10},
+    {&MODULE_SRC.ASCLIN.ASCLIN[0].RX, IfxSrc_Tos_cpu0, 11},
+    {&MODULE_SRC.ASCLIN.ASCLIN[0].ERR, IfxSrc_Tos_cpu0, 12},
+    {&MODULE_SRC.GETH.GETH[0].SR[6], IfxSrc_Tos_cpu0, 13},
+    {&MODULE_SRC.STM.STM[0].SR[1], IfxSrc_Tos_cpu0, 14},
+    {&MODULE_SRC.CAN.CAN[0].INT[0], IfxSrc_Tos_cpu0, 15},
+};
+static const OsGen_Task os_gen_tasks_core1[] = {
+    {Core1Task, "Core1 Task", 512, NULL, 2, Core1TaskStack, &Core1TaskTcb, &Core1TaskHandle},
+    {os_gw_can_task, "Gateway", 512, NULL, 20, GatewayTaskStack, &GatewayTaskTcb, &GatewayTaskHandle},
+};
+static const OsGen_Isr os_gen_isrs_core1[] = {
+    {&MODULE_SRC.CAN.CAN[1].INT[0], IfxSrc_Tos_cpu1, 20},
+    {&MODULE_SRC.CAN.CAN[2].INT[0], IfxSrc_Tos_cpu1, 21},
+};
+static const OsGen_Task os_gen_tasks_core2[] = {
+    {Core2Task, "Core2 Task", 512, NULL, 3, Core2TaskStack, &Core2TaskTcb, &Core2TaskHandle},
+};
+static const OsGen_Task os_gen_tasks_core3[] = {
+    {Core3Task, "Core3 Task", 512, NULL, 4, Core3TaskStack, &Core3TaskTcb, &Core3TaskHandle},
+};
+static const OsGen_Task os_gen_tasks_core4[] = {
+    {Core4Task, "Core4 Task", 512, NULL, 5, Core4TaskStack, &Core4TaskTcb, &Core4TaskHandle},
+};
+static const OsGen_Task os_gen_tasks_core5[] = {
+    {Core5Task, "Core5 Task", 512, NULL, 6, Core5TaskStack, &Core5TaskTcb, &Core5TaskHandle},
+};
+
+const OsGen_Core os_gen_cores[configNUM_CORES] = {
+    {os_gen_tasks_core0, 5, NULL, 0, os_gen_isrs_core0, 6},   /* core 0 */
+    {os_gen_tasks_core1, 2, NULL, 0, os_gen_isrs_core1, 2},   /* core 1 */
+    {os_gen_tasks_core2, 1, NULL, 0, NULL, 0},   /* core 2 */
+    {os_gen_tasks_core3, 1, NULL, 0, NULL, 0},   /* core 3 */
+    {os_gen_tasks_core4, 1, NULL, 0, NULL, 0},   /* core 4 */
+    {NULL, 0, NULL, 0, NULL, 0},  /* unused core ID */
+    {os_gen_tasks_core5, 1, NULL, 0, NULL, 0},   /* core 5 */
+};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+IFX_INTERRUPT(ConsoleTx_vector, 0, 10);
+void ConsoleTx_vector(void)
+{
+    os_console_isrTransmit();
+}
+
+IFX_INTERRUPT(ConsoleRx_vector, 0, 11);
+void ConsoleRx_vector(void)
+{
+    os_console_isrReceive();
+}
+
+IFX_INTERRUPT(ConsoleEr_vector, 0, 12);
+void ConsoleEr_vector(void)
+{
+    os_console_isrError();
+}
+
+IFX_INTERRUPT(NetRx_vector, 0, 13);
+void NetRx_vector(void)
+{
+    os_net_geth_isrReceive();
+}
+
+IFX_INTERRUPT(NetGate_vector, 0, 14);
+void NetGate_vector(void)
+{
+    os_net_geth_isrGate();
+}
+
+IFX_INTERRUPT(IsoTpRx_vector, 0, 15);
+void IsoTpRx_vector(void)
+{
+    os_isotp_can_isrReceive();
+}
+
+IFX_INTERRUPT(GwCan1Rx_vector, 1, 20);
+void GwCan1Rx_vector(void)
+{
+    os_gw_can_isrReceiveCan1();
+}
+
+IFX_INTERRUPT(GwCan2Rx_vector, 1, 21);
+void GwCan2Rx_vector(void)
+{
+    os_gw_can_isrReceiveCan2();
+}
+
+void os_gen_init(void)
+{
+    const OsGen_Core *core = &os_gen_cores[portGET_CORE_ID()];
+    uint32_t          i;
+
+    for (i = 0; i < core->numTasks; i++)
+    {
+        const OsGen_Task *t = &core->tasks[i];
+        *t->handle = xTaskCreateStatic(t->entry, t->name, t->stackDepth, t->parameter, t->priority, t->stack, t->tcb);
+    }
+
+    for (i = 0; i < core->numIsrs; i++)
+    {
+        const OsGen_Isr *isr = &core->isrs[i];
+        IfxSrc_init((volatile Ifx_SRC_SRCR *)isr->src, (IfxSrc_Tos)isr->typeOfService, (Ifx_Priority)isr->priority);
+        IfxSrc_enable((volatile Ifx_SRC_SRCR *)isr->src);
+    }
+}
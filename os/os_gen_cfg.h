@@ -0,0 +1,64 @@
+/* Generated by tools/os_gen.py from os_system.json - do not edit. */
+#ifndef OS_GEN_CFG_H
+#define OS_GEN_CFG_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+typedef struct
+{
+    TaskFunction_t  entry;
+    const char     *name;
+    uint32_t        stackDepth;
+    void           *parameter;
+    UBaseType_t     priority;
+    StackType_t    *stack;
+    StaticTask_t   *tcb;
+    TaskHandle_t   *handle;
+} OsGen_Task;
+
+typedef struct
+{
+    UBaseType_t     length;
+    UBaseType_t     itemSize;
+    uint8_t        *storage;
+    void           *queue;      /* StaticQueue_t */
+    void          **handle;     /* QueueHandle_t */
+} OsGen_Queue;
+
+typedef struct
+{
+    volatile void  *src;        /* Ifx_SRC_SRCR */
+    uint32_t        typeOfService;
+    uint32_t        priority;
+} OsGen_Isr;
+
+typedef struct
+{
+    const OsGen_Task  *tasks;
+    uint32_t           numTasks;
+    const OsGen_Queue *queues;
+    uint32_t           numQueues;
+    const OsGen_Isr   *isrs;
+    uint32_t           numIsrs;
+} OsGen_Core;
+
+/* Indexed by portGET_CORE_ID(). */
+extern const OsGen_Core os_gen_cores[configNUM_CORES];
+
+extern TaskHandle_t Core0TaskHandle;
+extern TaskHandle_t Core1TaskHandle;
+extern TaskHandle_t Core2TaskHandle;
+extern TaskHandle_t Core3TaskHandle;
+extern TaskHandle_t Core4TaskHandle;
+extern TaskHandle_t Core5TaskHandle;
+extern TaskHandle_t DvfsTaskHandle;
+extern TaskHandle_t ConsoleTaskHandle;
+extern TaskHandle_t NetTaskHandle;
+extern TaskHandle_t IsoTpTaskHandle;
+extern TaskHandle_t GatewayTaskHandle;
+
+/* Creates the tasks and queues of the calling core and enables its interrupts. */
+extern void os_gen_init(void);
+
+#endif /* OS_GEN_CFG_H */
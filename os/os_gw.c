@@ -0,0 +1,412 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "os_gw.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_GW_QUEUE_MASK                 (OS_GW_QUEUE_SIZE - 1)
+
+#if ((OS_GW_QUEUE_SIZE & OS_GW_QUEUE_MASK) != 0)
+#error OS_GW_QUEUE_SIZE must be a power of two
+#endif
+
+#if (OS_GW_MAX_BUSES > 8)
+#error A route has a bit for each of at most 8 buses
+#endif
+
+/* Mixed into the identifier before hashing, so that the same identifier on
+ * two buses hashes apart.  Must match tools/gw_gen.py. */
+#define OS_GW_HASH_BUS                   (0x9E3779B9UL)
+
+#define OS_GW_CLASSIC_LENGTH             (8)
+#define OS_GW_NO_BUFFER                  (0xFFU)
+
+/* A frame waiting for a full transmit FIFO. */
+typedef struct
+{
+    uint32 id;
+    uint16 route;
+    uint8  length;
+    uint8  data[OS_GW_MAX_DATA_LENGTH];
+} OsGw_Frame;
+
+typedef struct
+{
+    OsGw_Frame frames[OS_GW_QUEUE_SIZE];
+    uint32     head;
+    uint32     tail;
+} OsGw_Queue;
+
+/* PDUs are packed into buffers[active]; buffers[pending] waits to be sent. */
+typedef struct
+{
+    uint8  buffers[2][OS_GW_CONTAINER_SIZE];
+    uint32 fill[2];
+    uint32 opened;               /* us the first PDU of the active buffer was packed at         */
+    uint8  active;
+    uint8  pending;              /* OS_GW_NO_BUFFER while none                                  */
+} OsGw_Container;
+
+static const OsGw_Config *os_gw_config;
+static const OsGw_Driver *os_gw_driver;
+static OsGw_Queue         os_gw_queues[OS_GW_MAX_BUSES];
+static OsGw_Container     os_gw_containers[OS_GW_MAX_CONTAINERS];
+static OsGw_Status        os_gw_status;
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* PDU headers are in network byte order and not aligned: access them
+ * bytewise. */
+static uint32 os_gw_get32(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | (uint32)data[3];
+}
+
+static void os_gw_put32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)(value >> 24);
+    data[1] = (uint8)(value >> 16);
+    data[2] = (uint8)(value >> 8);
+    data[3] = (uint8)value;
+}
+
+/* Writes the frames waiting for bus into its transmit FIFO while there is
+ * room.  Called under the lock. */
+static void os_gw_drain(uint32 bus)
+{
+    OsGw_Queue *queue = &os_gw_queues[bus];
+    boolean     sent  = TRUE;
+
+    while ((queue->tail != queue->head) && (sent != FALSE))
+    {
+        const OsGw_Frame *frame = &queue->frames[queue->tail & OS_GW_QUEUE_MASK];
+
+        sent = os_gw_driver->canSend(os_gw_driver->context, bus, frame->id, frame->data, frame->length);
+
+        if (sent != FALSE)
+        {
+            os_gw_config->counters[frame->route].forwarded++;
+            queue->tail++;
+        }
+        else {}
+    }
+}
+
+/* Sends a frame of a route on bus, behind the frames already waiting for it.
+ * Called under the lock. */
+static void os_gw_sendCan(uint32 bus, uint32 route, const uint8 *data, uint32 length)
+{
+    OsGw_Queue    *queue    = &os_gw_queues[bus];
+    OsGw_Counters *counters = &os_gw_config->counters[route];
+    uint32         id       = os_gw_config->routes[route].canId;
+    uint32         waiting;
+
+    os_gw_drain(bus);
+    waiting = queue->head - queue->tail;
+
+    if ((length > OS_GW_CLASSIC_LENGTH) && ((id & OS_GW_ID_FD) == 0))
+    {
+        counters->dropped++;
+    }
+    else if ((waiting == 0) && (os_gw_driver->canSend(os_gw_driver->context, bus, id, data, length) != FALSE))
+    {
+        counters->forwarded++;
+    }
+    else if (waiting < OS_GW_QUEUE_SIZE)
+    {
+        OsGw_Frame *frame = &queue->frames[queue->head & OS_GW_QUEUE_MASK];
+
+        frame->id     = id;
+        frame->route  = (uint16)route;
+        frame->length = (uint8)length;
+        memcpy(frame->data, data, length);
+        queue->head++;
+        counters->queued++;
+
+        if ((waiting + 1) > os_gw_status.maxQueued)
+        {
+            os_gw_status.maxQueued = waiting + 1;
+        }
+        else {}
+    }
+    else
+    {
+        counters->dropped++;
+    }
+}
+
+/* Hands the active buffer of a container over to be sent, unless the other
+ * one still is.  Returns TRUE if it did.  Called under the lock. */
+static boolean os_gw_close(OsGw_Container *container)
+{
+    boolean closed = (boolean)((container->pending == OS_GW_NO_BUFFER) && (container->fill[container->active] != 0));
+
+    if (closed != FALSE)
+    {
+        container->pending                   = container->active;
+        container->active                   ^= 1U;
+        container->fill[container->active]   = 0;
+    }
+    else {}
+
+    return closed;
+}
+
+/* Packs a frame of a route into its container.  Returns TRUE if a buffer is
+ * ready to be sent.  Called under the lock. */
+static boolean os_gw_pack(uint32 route, const uint8 *data, uint32 length)
+{
+    const OsGw_Route           *config    = &os_gw_config->routes[route];
+    const OsGw_ContainerConfig *settings  = &os_gw_config->containers[config->container];
+    OsGw_Container             *container = &os_gw_containers[config->container];
+    OsGw_Counters              *counters  = &os_gw_config->counters[route];
+    uint32                      size      = OS_GW_PDU_HEADER_SIZE + length;
+    boolean                     ready     = FALSE;
+
+    if ((container->fill[container->active] + size) > settings->size)
+    {
+        ready = os_gw_close(container);
+    }
+    else {}
+
+    if ((container->fill[container->active] + size) <= settings->size)
+    {
+        uint8 *pdu = &container->buffers[container->active][container->fill[container->active]];
+
+        if (container->fill[container->active] == 0)
+        {
+            container->opened = os_gw_driver->getTime(os_gw_driver->context);
+        }
+        else {}
+
+        os_gw_put32(&pdu[0], config->pduId);
+        os_gw_put32(&pdu[4], length);
+        memcpy(&pdu[OS_GW_PDU_HEADER_SIZE], data, length);
+        container->fill[container->active] += size;
+        counters->forwarded++;
+
+        if ((config->flags & OS_GW_ROUTE_TRIGGER) != 0)
+        {
+            ready = (boolean)(os_gw_close(container) || ready);
+        }
+        else {}
+    }
+    else
+    {
+        counters->dropped++;
+    }
+
+    return ready;
+}
+
+/* Sends a frame or PDU to every destination of its route.  Called under the
+ * lock. */
+static boolean os_gw_route(sint32 route, const uint8 *data, uint32 length)
+{
+    boolean ready = FALSE;
+
+    if (route < 0)
+    {
+        os_gw_status.unrouted++;
+    }
+    else
+    {
+        const OsGw_Route *config = &os_gw_config->routes[route];
+        uint32            buses  = config->buses;
+        uint32            bus;
+
+        os_gw_config->counters[route].received++;
+
+        for (bus = 0; buses != 0; bus++)
+        {
+            if ((buses & 1U) != 0)
+            {
+                os_gw_sendCan(bus, (uint32)route, data, length);
+            }
+            else {}
+
+            buses >>= 1;
+        }
+
+        if (config->container < os_gw_config->numContainers)
+        {
+            ready = os_gw_pack((uint32)route, data, length);
+        }
+        else {}
+    }
+
+    return ready;
+}
+
+sint32 os_gw_lookup(const OsGw_Table *table, uint32 bus, uint32 id)
+{
+    uint32          key    = id ^ (bus * OS_GW_HASH_BUS);
+    uint32          bucket = (key * table->bucketMultiplier) >> (32 - table->bucketBits);
+    uint32          slot   = ((key * table->slotMultiplier) >> (32 - table->slotBits)) ^ table->displacements[bucket];
+    const OsGw_Key *entry  = &table->keys[slot];
+
+    return ((entry->id == id) && (entry->bus == bus)) ? (sint32)entry->route : -1;
+}
+
+void os_gw_init(const OsGw_Config *config, const OsGw_Driver *driver)
+{
+    uint32 index;
+
+    memset(os_gw_queues, 0, sizeof(os_gw_queues));
+    memset(&os_gw_status, 0, sizeof(os_gw_status));
+    memset(config->counters, 0, config->numRoutes * sizeof(OsGw_Counters));
+
+    for (index = 0; index < OS_GW_MAX_CONTAINERS; index++)
+    {
+        os_gw_containers[index].fill[0] = 0;
+        os_gw_containers[index].fill[1] = 0;
+        os_gw_containers[index].active  = 0;
+        os_gw_containers[index].pending = OS_GW_NO_BUFFER;
+    }
+
+    os_gw_driver = driver;
+    os_gw_config = config;
+}
+
+boolean os_gw_receiveCan(uint32 bus, uint32 id, const uint8 *data, uint32 length)
+{
+    uint32  state = os_gw_driver->lock(os_gw_driver->context);
+    boolean ready;
+
+    if ((bus < OS_GW_MAX_BUSES) && (length <= OS_GW_MAX_DATA_LENGTH))
+    {
+        ready = os_gw_route(os_gw_lookup(os_gw_config->canTable, bus, id & ~OS_GW_ID_FD), data, length);
+    }
+    else
+    {
+        ready = os_gw_route(-1, data, length);
+    }
+
+    os_gw_driver->unlock(os_gw_driver->context, state);
+
+    return ready;
+}
+
+void os_gw_receivePdus(const uint8 *data, uint32 length)
+{
+    uint32 offset = 0;
+
+    while ((offset + OS_GW_PDU_HEADER_SIZE) <= length)
+    {
+        uint32 id        = os_gw_get32(&data[offset]);
+        uint32 pduLength = os_gw_get32(&data[offset + 4]);
+
+        offset += OS_GW_PDU_HEADER_SIZE;
+
+        if ((pduLength > (length - offset)) || (pduLength > OS_GW_MAX_DATA_LENGTH))
+        {
+            os_gw_status.malformed++;
+            offset = length;
+        }
+        else
+        {
+            uint32 state = os_gw_driver->lock(os_gw_driver->context);
+
+            (void)os_gw_route(os_gw_lookup(os_gw_config->pduTable, OS_GW_BUS_PDU, id), &data[offset], pduLength);
+            os_gw_driver->unlock(os_gw_driver->context, state);
+            offset += pduLength;
+        }
+    }
+
+    if (offset != length)
+    {
+        os_gw_status.malformed++;
+    }
+    else {}
+}
+
+boolean os_gw_poll(void)
+{
+    boolean busy = FALSE;
+    uint32  state;
+    uint32  index;
+
+    for (index = 0; index < OS_GW_MAX_BUSES; index++)
+    {
+        state = os_gw_driver->lock(os_gw_driver->context);
+        os_gw_drain(index);
+        busy  = (boolean)(busy || (os_gw_queues[index].head != os_gw_queues[index].tail));
+        os_gw_driver->unlock(os_gw_driver->context, state);
+    }
+
+    for (index = 0; index < os_gw_config->numContainers; index++)
+    {
+        const OsGw_ContainerConfig *settings  = &os_gw_config->containers[index];
+        OsGw_Container             *container = &os_gw_containers[index];
+        uint32                      pending;
+
+        /* Read the time under the lock, the first PDU may not be packed
+         * after it. */
+        state = os_gw_driver->lock(os_gw_driver->context);
+
+        if ((container->fill[container->active] != 0) &&
+            ((os_gw_driver->getTime(os_gw_driver->context) - container->opened) >= settings->timeout))
+        {
+            (void)os_gw_close(container);
+        }
+        else {}
+
+        busy    = (boolean)(busy || (container->fill[container->active] != 0));
+        pending = container->pending;
+        os_gw_driver->unlock(os_gw_driver->context, state);
+
+        /* The pending buffer is not touched by the interrupts, it is sent
+         * without the lock. */
+        if (pending != OS_GW_NO_BUFFER)
+        {
+            if (os_gw_driver->ethSend(os_gw_driver->context, settings->ip, settings->port,
+                                      container->buffers[pending], container->fill[pending]) != FALSE)
+            {
+                state              = os_gw_driver->lock(os_gw_driver->context);
+                container->pending = OS_GW_NO_BUFFER;
+
+                /* The active buffer filled up while this one was sent. */
+                if ((container->fill[container->active] + OS_GW_PDU_HEADER_SIZE + OS_GW_MAX_DATA_LENGTH) > settings->size)
+                {
+                    busy = (boolean)(os_gw_close(container) || busy);
+                }
+                else {}
+
+                os_gw_driver->unlock(os_gw_driver->context, state);
+                os_gw_status.containers++;
+            }
+            else
+            {
+                busy = TRUE;
+            }
+        }
+        else {}
+    }
+
+    return busy;
+}
+
+boolean os_gw_getCounters(uint32 route, OsGw_Counters *counters)
+{
+    boolean result = (boolean)((os_gw_config != NULL_PTR) && (route < os_gw_config->numRoutes));
+
+    if (result != FALSE)
+    {
+        *counters = os_gw_config->counters[route];
+    }
+    else {}
+
+    return result;
+}
+
+void os_gw_getStatus(OsGw_Status *status)
+{
+    *status = os_gw_status;
+}
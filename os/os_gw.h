@@ -0,0 +1,205 @@
+#ifndef OS_GW_H
+#define OS_GW_H
+
+/* CAN/Ethernet gateway engine.
+ *
+ * Frames are routed by tables compiled offline by tools/gw_gen.py from a
+ * route description (see os/os_gw.json): a perfect hash over the
+ * (bus, CAN identifier) pairs of the CAN routes, and another over the PDU
+ * identifiers of the Ethernet routes, so that a lookup costs two multiplies,
+ * one displacement and one key compare whatever the number of routes, and a
+ * frame without a route is rejected by the same compare.
+ *
+ * A route sends a frame to any set of CAN buses and to at most one container.
+ * os_gw_receiveCan() is called from the receive interrupt with the frame still
+ * in the controller, and writes it straight into the transmit FIFO of every
+ * destination bus: there is no task and no intermediate copy between two CAN
+ * buses.  A frame that finds a transmit FIFO full waits in a queue of
+ * OS_GW_QUEUE_SIZE frames of its bus, which also holds every later frame for
+ * that bus until it is empty again, so that a bus sees its frames in the
+ * order they were received.
+ *
+ * A container packs the frames of its routes as PDUs into one UDP datagram,
+ * each behind an AUTOSAR SoAd PDU header: the PDU identifier and the length,
+ * 32 bits each in network byte order.  A container is sent when the next PDU
+ * does not fit, when a route with OS_GW_ROUTE_TRIGGER is packed, or timeout
+ * us after its first PDU.  It has two buffers, so that PDUs are packed into
+ * one while the other is sent; a PDU is dropped if both are full.  Received
+ * datagrams are unpacked by os_gw_receivePdus(), every PDU being routed by
+ * its identifier like a CAN frame.
+ *
+ * The receive interrupts may nest: the queues, the transmit FIFOs and the
+ * containers are only changed under the lock of the driver.  A container is
+ * sent, and queued frames waiting for a bus whose frames stopped arriving are
+ * moved on, by os_gw_poll(), which a task calls periodically.  This file holds
+ * no hardware access, see os_gw_can.c for MCMCAN and os_net.h. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef OS_GW_MAX_BUSES
+#define OS_GW_MAX_BUSES                  (8)      /* CAN buses, numbered from 0               */
+#endif
+
+#ifndef OS_GW_QUEUE_SIZE
+#define OS_GW_QUEUE_SIZE                 (16)     /* Frames waiting per bus, a power of two   */
+#endif
+
+#ifndef OS_GW_MAX_CONTAINERS
+#define OS_GW_MAX_CONTAINERS             (4)
+#endif
+
+#ifndef OS_GW_CONTAINER_SIZE
+#define OS_GW_CONTAINER_SIZE             (1472)   /* Largest UDP payload on a 1500 byte MTU    */
+#endif
+
+#define OS_GW_PDU_HEADER_SIZE            (8)
+#define OS_GW_MAX_DATA_LENGTH            (64)
+
+/* Flags of a CAN identifier, as in os_isotp.h.  A route that sends a PDU
+ * longer than 8 bytes must set OS_GW_ID_FD. */
+#define OS_GW_ID_EXTENDED                (0x80000000UL)
+#define OS_GW_ID_FD                      (0x40000000UL)
+#define OS_GW_ID_MASK                    (0x1FFFFFFFUL)
+
+/* Bus of the PDU table keys, and of an empty slot. */
+#define OS_GW_BUS_PDU                    (0xFEU)
+#define OS_GW_BUS_NONE                   (0xFFU)
+
+#define OS_GW_NO_CONTAINER               (0xFFU)
+
+/* Route flags. */
+#define OS_GW_ROUTE_TRIGGER              (0x1U)   /* Send the container once the PDU is packed */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* A slot of a perfect hash table. */
+typedef struct
+{
+    uint32 id;                   /* CAN identifier with OS_GW_ID_EXTENDED, or PDU identifier    */
+    uint16 route;
+    uint8  bus;                  /* OS_GW_BUS_NONE for an empty slot                            */
+    uint8  reserved;
+} OsGw_Key;
+
+/* A perfect hash table, see os_gw_lookup() and tools/gw_gen.py. */
+typedef struct
+{
+    uint32          bucketMultiplier;
+    uint32          slotMultiplier;
+    uint32          bucketBits;      /* 1 to 16                                                 */
+    uint32          slotBits;        /* 1 to 16                                                 */
+    const uint16   *displacements;   /* 1 << bucketBits                                         */
+    const OsGw_Key *keys;            /* 1 << slotBits                                           */
+} OsGw_Table;
+
+typedef struct
+{
+    uint32 canId;                /* Identifier sent on the buses, with its flags                */
+    uint32 pduId;                /* Identifier of the PDU in the container                      */
+    uint8  buses;                /* Destination buses, bit n for bus n                          */
+    uint8  container;            /* Destination container, or OS_GW_NO_CONTAINER                */
+    uint8  flags;
+    uint8  reserved;
+} OsGw_Route;
+
+typedef struct
+{
+    uint32 ip;                   /* Destination, host byte order                                */
+    uint16 port;
+    uint16 size;                 /* Bytes a datagram is sent at, up to OS_GW_CONTAINER_SIZE     */
+    uint32 timeout;              /* us from the first PDU                                       */
+} OsGw_ContainerConfig;
+
+/* See os_gw_getCounters(). */
+typedef struct
+{
+    uint32 received;             /* Frames or PDUs that matched the route                       */
+    uint32 forwarded;            /* Frames written to a bus or packed into the container        */
+    uint32 queued;               /* Frames that waited for a full transmit FIFO                 */
+    uint32 dropped;              /* Frames lost to a full queue or container, or too long       */
+} OsGw_Counters;
+
+/* The generated configuration, see tools/gw_gen.py. */
+typedef struct
+{
+    const OsGw_Table           *canTable;
+    const OsGw_Table           *pduTable;
+    const OsGw_Route           *routes;
+    OsGw_Counters              *counters;       /* One per route                                */
+    uint32                      numRoutes;
+    const OsGw_ContainerConfig *containers;
+    uint32                      numContainers;
+    uint16                      port;           /* UDP port sent from and received on           */
+} OsGw_Config;
+
+typedef struct
+{
+    void   *context;
+
+    /* Writes a frame of length bytes, padded by the driver to a valid CAN FD
+     * length, on id with its flags into the transmit FIFO of bus.  data may
+     * point into a controller.  Returns FALSE if the FIFO is full. */
+    boolean (*canSend)(void *context, uint32 bus, uint32 id, const uint8 *data, uint32 length);
+
+    /* Sends length bytes of a container as a UDP datagram.  Returns FALSE if
+     * there is no transmit buffer, the engine tries again at the next poll. */
+    boolean (*ethSend)(void *context, uint32 ip, uint16 port, const uint8 *data, uint32 length);
+
+    /* Keeps the receive interrupts out until unlock, which is given the value
+     * lock returned. */
+    uint32 (*lock)(void *context);
+    void   (*unlock)(void *context, uint32 state);
+
+    /* Returns a free running time in us. */
+    uint32 (*getTime)(void *context);
+} OsGw_Driver;
+
+/* See os_gw_getStatus(). */
+typedef struct
+{
+    uint32 unrouted;             /* Frames and PDUs without a route                             */
+    uint32 malformed;            /* Datagrams cut inside a PDU                                  */
+    uint32 containers;           /* Datagrams sent                                              */
+    uint32 maxQueued;            /* Most frames waiting for one bus                             */
+} OsGw_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Starts the engine on config, which must stay valid. */
+extern void os_gw_init(const OsGw_Config *config, const OsGw_Driver *driver);
+
+/* Returns the route of id on bus in table, or -1. */
+extern sint32 os_gw_lookup(const OsGw_Table *table, uint32 bus, uint32 id);
+
+/* Routes a frame received on bus, id with OS_GW_ID_EXTENDED and OS_GW_ID_FD
+ * as received.  Called from the receive interrupt; data may point into the
+ * controller, it is read before the function returns.  Returns TRUE if a
+ * container is ready to be sent, then os_gw_poll() should run soon. */
+extern boolean os_gw_receiveCan(uint32 bus, uint32 id, const uint8 *data, uint32 length);
+
+/* Routes the PDUs of a datagram received on the container port. */
+extern void os_gw_receivePdus(const uint8 *data, uint32 length);
+
+/* Sends the containers that are full or timed out and moves the queued
+ * frames on.  Returns TRUE while a container holds PDUs or a frame waits, the
+ * caller then polls again within the container timeouts. */
+extern boolean os_gw_poll(void);
+
+/* Copies the counters of a route.  Returns FALSE if there is no such route. */
+extern boolean os_gw_getCounters(uint32 route, OsGw_Counters *counters);
+
+/* Copies the statistics of the engine. */
+extern void os_gw_getStatus(OsGw_Status *status);
+
+#endif /* OS_GW_H */
@@ -0,0 +1,321 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "IfxCpu.h"
+#include "IfxStm.h"
+#include "Can/Can/IfxCan_Can.h"
+#include "os_net.h"
+#include "os_gw_cfg.h"
+#include "os_gw_can.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_GW_CAN_NODES_PER_MODULE       (4)
+#define OS_GW_CAN_PADDING                (0x00U)
+
+/* Message RAM of a node, byte offsets from OS_GW_CAN_NODE_RAM times the node
+ * number.  FIFO elements of 8 header and 64 data bytes, no filter lists. */
+#define OS_GW_CAN_ELEMENT_SIZE           (8 + OS_GW_MAX_DATA_LENGTH)
+#define OS_GW_CAN_NODE_RAM               (0x0A00U)
+#define OS_GW_CAN_RX_FIFO0               (0x0000U)
+#define OS_GW_CAN_TX_BUFFERS             (0x0480U)
+#define OS_GW_CAN_UNUSED                 (0x0900U)
+
+#if (OS_GW_CFG_NUM_BUSES > (2 * OS_GW_CAN_NODES_PER_MODULE))
+#error os_gw.json has more buses than CAN1 and CAN2 have nodes
+#endif
+
+#if ((OS_GW_CAN_RX_FIFO0 + (OS_GW_CAN_RX_FIFO_SIZE * OS_GW_CAN_ELEMENT_SIZE)) > OS_GW_CAN_TX_BUFFERS)
+#error OS_GW_CAN_RX_FIFO_SIZE is too large for the message RAM layout
+#endif
+
+#if ((OS_GW_CAN_TX_BUFFERS + (OS_GW_CAN_TX_FIFO_SIZE * OS_GW_CAN_ELEMENT_SIZE)) > OS_GW_CAN_UNUSED)
+#error OS_GW_CAN_TX_FIFO_SIZE is too large for the message RAM layout
+#endif
+
+/* Frame length of every data length code. */
+static const uint8 os_gw_can_lengths[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/* Pins of every bus, nodes 0 to 3 of CAN1 then of CAN2. */
+static const IfxCan_Can_Pins os_gw_can_pins[2 * OS_GW_CAN_NODES_PER_MODULE] = {
+    {&IfxCan_TXD10_P00_0_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD10A_P00_1_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD11_P00_4_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD11B_P00_5_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD12_P10_7_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD12B_P10_8_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD13_P14_6_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD13A_P14_7_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD20_P10_6_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD20A_P10_5_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD21_P00_2_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD21A_P00_3_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD22_P32_6_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD22B_P32_7_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+    {&IfxCan_TXD23_P13_4_OUT, IfxPort_OutputMode_pushPull, &IfxCan_RXD23D_P13_5_IN, IfxPort_InputMode_pullUp, IfxPort_PadDriver_cmosAutomotiveSpeed2},
+};
+
+static IfxCan_Can         os_gw_can_modules[2];
+static IfxCan_Can_Node    os_gw_can_nodes[2 * OS_GW_CAN_NODES_PER_MODULE];
+static uint32             os_gw_can_numBuses;  /* Nodes initialised, the others are skipped */
+static TaskHandle_t       os_gw_can_taskHandle;
+static uint32             os_gw_can_ticksPerUs;
+
+static boolean            os_gw_can_sendFrame(void *context, uint32 bus, uint32 id, const uint8 *data, uint32 length);
+static boolean            os_gw_can_sendDatagram(void *context, uint32 ip, uint16 port, const uint8 *data, uint32 length);
+static uint32             os_gw_can_lock(void *context);
+static void               os_gw_can_unlock(void *context, uint32 state);
+static uint32             os_gw_can_getTime(void *context);
+
+static const OsGw_Driver os_gw_can_driver = {
+    .context = os_gw_can_nodes,
+    .canSend = os_gw_can_sendFrame,
+    .ethSend = os_gw_can_sendDatagram,
+    .lock    = os_gw_can_lock,
+    .unlock  = os_gw_can_unlock,
+    .getTime = os_gw_can_getTime,
+};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Returns the data length code of the shortest frame that holds length
+ * bytes. */
+static IfxCan_DataLengthCode os_gw_can_getCode(uint32 length)
+{
+    uint32 code = (length < 8) ? length : 8;
+
+    while (os_gw_can_lengths[code] < length)
+    {
+        code++;
+    }
+
+    return (IfxCan_DataLengthCode)code;
+}
+
+/* Writes the frame straight into the next element of the Tx FIFO of bus.  A
+ * bus not initialised yet is full. */
+static boolean os_gw_can_sendFrame(void *context, uint32 bus, uint32 id, const uint8 *data, uint32 length)
+{
+    IfxCan_Can_Node *node = &((IfxCan_Can_Node *)context)[bus];
+    boolean          sent = FALSE;
+
+    if ((bus < os_gw_can_numBuses) && (IfxCan_Node_isTxFifoQueueFull(node->node) == FALSE))
+    {
+        IfxCan_TxBufferId     bufferId = IfxCan_Node_getTxFifoQueuePutIndex(node->node);
+        Ifx_CAN_TXMSG        *element  = IfxCan_Node_getTxBufferElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+        IfxCan_DataLengthCode code     = os_gw_can_getCode(length);
+        uint32                index;
+
+        element->T0.U = 0;
+        element->T1.U = 0;
+        IfxCan_Node_setMsgId(element, id & OS_GW_ID_MASK, ((id & OS_GW_ID_EXTENDED) != 0) ? IfxCan_MessageIdLength_extended : IfxCan_MessageIdLength_standard);
+        IfxCan_Node_setDataLength(element, code);
+        IfxCan_Node_setFrameModeReq(element, ((id & OS_GW_ID_FD) != 0) ? IfxCan_FrameMode_fdLongAndFast : IfxCan_FrameMode_standard);
+
+        for (index = 0; index < length; index++)
+        {
+            element->DB[index].U = data[index];
+        }
+
+        for (index = length; index < os_gw_can_lengths[code]; index++)
+        {
+            element->DB[index].U = OS_GW_CAN_PADDING;
+        }
+
+        IfxCan_Node_setTxBufferAddRequest(node->node, bufferId);
+        sent = TRUE;
+    }
+
+    return sent;
+}
+
+/* Copies a container into the transmit buffer of core 1. */
+static boolean os_gw_can_sendDatagram(void *context, uint32 ip, uint16 port, const uint8 *data, uint32 length)
+{
+    uint8 *payload = os_net_udpGetBuffer();
+
+    (void)context;
+
+    if (payload != NULL_PTR)
+    {
+        memcpy(payload, data, length);
+        (void)os_net_udpSend(payload, (uint16)length, os_gw_cfg.port, ip, port);
+    }
+    else {}
+
+    return (boolean)(payload != NULL_PTR);
+}
+
+static uint32 os_gw_can_lock(void *context)
+{
+    (void)context;
+
+    return (uint32)IfxCpu_disableInterrupts();
+}
+
+static void os_gw_can_unlock(void *context, uint32 state)
+{
+    (void)context;
+
+    IfxCpu_restoreInterrupts((boolean)state);
+}
+
+static uint32 os_gw_can_getTime(void *context)
+{
+    (void)context;
+
+    return (uint32)(IfxStm_get(&MODULE_STM0) / os_gw_can_ticksPerUs);
+}
+
+static void os_gw_can_receiveDatagram(void *arg, const OsNet_Datagram *datagram)
+{
+    (void)arg;
+
+    os_gw_receivePdus(datagram->payload, datagram->length);
+}
+
+/* Routes every frame in Rx FIFO 0 of the nodes of a module in place, then
+ * frees its element. */
+static void os_gw_can_receive(uint32 firstBus)
+{
+    boolean ready = FALSE;
+    uint32  bus;
+
+    for (bus = firstBus; (bus < (firstBus + OS_GW_CAN_NODES_PER_MODULE)) && (bus < os_gw_can_numBuses); bus++)
+    {
+        IfxCan_Can_Node *canNode = &os_gw_can_nodes[bus];
+        Ifx_CAN_N       *node    = canNode->node;
+
+        IfxCan_Node_clearInterruptFlag(node, IfxCan_Interrupt_rxFifo0NewMessage);
+
+        while (IfxCan_Node_getRxFifo0FillLevel(node) != 0)
+        {
+            IfxCan_RxBufferId bufferId = IfxCan_Node_getRxFifo0GetIndex(node);
+            Ifx_CAN_RXMSG    *element  = IfxCan_Node_getRxFifo0ElementAddress(node, canNode->messageRAM.baseAddress,
+                canNode->messageRAM.rxFifo0StartAddress, bufferId);
+            uint32            id       = IfxCan_Node_getMesssageId(element);
+
+            if (element->R0.B.XTD != 0)
+            {
+                id |= OS_GW_ID_EXTENDED;
+            }
+
+            if (element->R1.B.FDF != 0)
+            {
+                id |= OS_GW_ID_FD;
+            }
+
+            ready = (boolean)(os_gw_receiveCan(bus, id, (const uint8 *)&element->DB[0], os_gw_can_lengths[IfxCan_Node_getDataLengthCode(element)]) || ready);
+            IfxCan_Node_setRxFifo0AcknowledgeIndex(node, bufferId);
+        }
+    }
+
+    /* The port cannot switch tasks from a handler called by the vector, the
+     * gateway task runs at the next tick or when the running task blocks. */
+    if (ready != FALSE)
+    {
+        vTaskNotifyGiveFromISR(os_gw_can_taskHandle, NULL);
+    }
+    else {}
+}
+
+static void os_gw_can_initNodes(void)
+{
+    Ifx_CAN              *modules[2]    = {&MODULE_CAN1, &MODULE_CAN2};
+    const uint16          priorities[2] = {OS_GW_CAN_ISR_PRIORITY_CAN1, OS_GW_CAN_ISR_PRIORITY_CAN2};
+    IfxCan_Can_Config     moduleConfig;
+    IfxCan_Can_NodeConfig config;
+    uint32                bus;
+
+    IfxCan_Can_initModuleConfig(&moduleConfig, &MODULE_CAN1);
+    IfxCan_Can_initModule(&os_gw_can_modules[0], &moduleConfig);
+    IfxCan_Can_initModuleConfig(&moduleConfig, &MODULE_CAN2);
+    IfxCan_Can_initModule(&os_gw_can_modules[1], &moduleConfig);
+
+    for (bus = 0; bus < OS_GW_CFG_NUM_BUSES; bus++)
+    {
+        uint32 module = bus / OS_GW_CAN_NODES_PER_MODULE;
+        uint32 base   = (bus % OS_GW_CAN_NODES_PER_MODULE) * OS_GW_CAN_NODE_RAM;
+
+        IfxCan_Can_initNodeConfig(&config, &os_gw_can_modules[module]);
+
+        config.nodeId                              = (IfxCan_NodeId)(bus % OS_GW_CAN_NODES_PER_MODULE);
+        config.pins                                = &os_gw_can_pins[bus];
+        config.frame.type                          = IfxCan_FrameType_transmitAndReceive;
+        config.frame.mode                          = IfxCan_FrameMode_fdLongAndFast;
+        config.baudRate.baudrate                   = OS_GW_CAN_BAUDRATE;
+        config.fastBaudRate.baudrate               = OS_GW_CAN_FAST_BAUDRATE;
+        config.calculateBitTimingValues            = TRUE;
+
+        config.txConfig.txMode                     = IfxCan_TxMode_fifo;
+        config.txConfig.dedicatedTxBuffersNumber   = 0;
+        config.txConfig.txFifoQueueSize            = OS_GW_CAN_TX_FIFO_SIZE;
+        config.txConfig.txBufferDataFieldSize      = IfxCan_DataFieldSize_64;
+
+        config.rxConfig.rxMode                     = IfxCan_RxMode_fifo0;
+        config.rxConfig.rxFifo0DataFieldSize       = IfxCan_DataFieldSize_64;
+        config.rxConfig.rxFifo0OperatingMode       = IfxCan_RxFifoMode_blocking;
+        config.rxConfig.rxFifo0Size                = OS_GW_CAN_RX_FIFO_SIZE;
+
+        /* Every data frame is received, the routing table drops the others. */
+        config.filterConfig.messageIdLength                    = IfxCan_MessageIdLength_both;
+        config.filterConfig.standardListSize                   = 0;
+        config.filterConfig.extendedListSize                   = 0;
+        config.filterConfig.rejectRemoteFramesWithStandardId   = TRUE;
+        config.filterConfig.rejectRemoteFramesWithExtendedId   = TRUE;
+        config.filterConfig.standardFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_acceptToRxFifo0;
+        config.filterConfig.extendedFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_acceptToRxFifo0;
+
+        config.messageRAM.baseAddress                    = (uint32)modules[module];
+        config.messageRAM.standardFilterListStartAddress = base + OS_GW_CAN_UNUSED;
+        config.messageRAM.extendedFilterListStartAddress = base + OS_GW_CAN_UNUSED;
+        config.messageRAM.rxFifo0StartAddress            = base + OS_GW_CAN_RX_FIFO0;
+        config.messageRAM.rxFifo1StartAddress            = base + OS_GW_CAN_UNUSED;
+        config.messageRAM.rxBuffersStartAddress          = base + OS_GW_CAN_UNUSED;
+        config.messageRAM.txEventFifoStartAddress        = base + OS_GW_CAN_UNUSED;
+        config.messageRAM.txBuffersStartAddress          = base + OS_GW_CAN_TX_BUFFERS;
+
+        /* The nodes of a module share interrupt line 0. */
+        config.interruptConfig.rxFifo0NewMessageEnabled    = TRUE;
+        config.interruptConfig.rxf0n.interruptLine         = IfxCan_InterruptLine_0;
+        config.interruptConfig.rxf0n.priority              = priorities[module];
+        config.interruptConfig.rxf0n.typeOfService         = IfxSrc_Tos_cpu1;
+
+        IfxCan_Can_initNode(&os_gw_can_nodes[bus], &config);
+        os_gw_can_numBuses = bus + 1;
+    }
+}
+
+void os_gw_can_init(void)
+{
+    (void)os_net_bind(os_gw_cfg.port, OS_GW_CAN_CORE_ID, os_gw_can_receiveDatagram, NULL_PTR);
+}
+
+void os_gw_can_task(void *arg)
+{
+    (void)arg;
+
+    os_gw_can_taskHandle = xTaskGetCurrentTaskHandle();
+    os_gw_can_ticksPerUs = (uint32)IfxStm_getFrequency(&MODULE_STM0) / 1000000U;
+    os_gw_init(&os_gw_cfg, &os_gw_can_driver);
+    os_gw_can_initNodes();
+
+    while (1)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OS_GW_CAN_POLL_MS));
+
+        (void)os_net_dispatch();
+        (void)os_gw_poll();
+    }
+}
+
+void os_gw_can_isrReceiveCan1(void)
+{
+    os_gw_can_receive(0);
+}
+
+void os_gw_can_isrReceiveCan2(void)
+{
+    os_gw_can_receive(OS_GW_CAN_NODES_PER_MODULE);
+}
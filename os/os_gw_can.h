@@ -0,0 +1,75 @@
+#ifndef OS_GW_CAN_H
+#define OS_GW_CAN_H
+
+/* MCMCAN and UDP driver of the gateway engine, see os_gw.h.
+ *
+ * The buses of os/os_gw.json are the nodes of CAN1 (buses 0 to 3) and CAN2
+ * (buses 4 to 7), CAN0 being left to os_isotp_can.c.  Every node runs in CAN
+ * FD mode with bit rate switching, which also sends and receives classic
+ * frames, and accepts every frame into Rx FIFO 0: a frame without a route is
+ * rejected by the table lookup rather than by a filter list of each bus.  The
+ * new message interrupts of the four nodes of a module share one service
+ * request, whose handler routes the frames of all four in place.
+ *
+ * Everything runs on core 1: the two receive interrupts, the fast path
+ * between the buses, and the gateway task, which sends the containers with
+ * os_net_udpSend() on the transmit channel of core 1 and is the caller of
+ * os_net_dispatch() there, unpacking the datagrams of the container port.  No
+ * other task of core 1 may send UDP. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include "os_gw.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef OS_GW_CAN_BAUDRATE
+#define OS_GW_CAN_BAUDRATE               (500000)   /* bit/s of the arbitration phase        */
+#endif
+
+#ifndef OS_GW_CAN_FAST_BAUDRATE
+#define OS_GW_CAN_FAST_BAUDRATE          (2000000)  /* bit/s of the data phase               */
+#endif
+
+/* Elements of Rx FIFO 0 and the Tx FIFO of every node. */
+#ifndef OS_GW_CAN_RX_FIFO_SIZE
+#define OS_GW_CAN_RX_FIFO_SIZE           (16)
+#endif
+
+#ifndef OS_GW_CAN_TX_FIFO_SIZE
+#define OS_GW_CAN_TX_FIFO_SIZE           (16)
+#endif
+
+#ifndef OS_GW_CAN_POLL_MS
+#define OS_GW_CAN_POLL_MS                (1)      /* Period of the gateway task                */
+#endif
+
+/* Core of the gateway, and the interrupt priorities of CAN1 and CAN2 on it.
+ * They must match os_system.json. */
+#define OS_GW_CAN_CORE_ID                (1)
+#define OS_GW_CAN_ISR_PRIORITY_CAN1      (20)
+#define OS_GW_CAN_ISR_PRIORITY_CAN2      (21)
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Binds the container port to core 1, called on core 0 before the scheduler
+ * starts, see os_net_bind(). */
+extern void os_gw_can_init(void);
+
+/* Gateway task, created on core 1 from os_system.json.  It initialises the
+ * engine and the nodes, then every OS_GW_CAN_POLL_MS, and earlier when a
+ * container is ready, unpacks the received datagrams and runs os_gw_poll(). */
+extern void os_gw_can_task(void *arg);
+
+/* Rx FIFO 0 interrupt handlers of CAN1 and CAN2, registered in
+ * os_system.json. */
+extern void os_gw_can_isrReceiveCan1(void);
+extern void os_gw_can_isrReceiveCan2(void);
+
+#endif /* OS_GW_CAN_H */
@@ -0,0 +1,119 @@
+/* Generated by tools/gw_gen.py from os_gw.json - do not edit. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "os_gw_cfg.h"
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+static const uint16 os_gw_cfg_canDisplacements[16] = {
+    1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+    1, 4, 1, 0,
+};
+
+static const OsGw_Key os_gw_cfg_canKeys[32] = {
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000000A0UL, 15, 0x04U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000003D0UL, 3, 0x00U, 0},
+    {0x000001F0UL, 17, 0x06U, 0},
+    {0x00000210UL, 14, 0x04U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000000B4UL, 5, 0x01U, 0},
+    {0x00000344UL, 12, 0x03U, 0},
+    {0x000002F4UL, 9, 0x02U, 0},
+    {0x000000C0UL, 0, 0x00U, 0},
+    {0x000004C0UL, 16, 0x05U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000001A0UL, 2, 0x00U, 0},
+    {0x000000B8UL, 6, 0x01U, 0},
+    {0x000000C8UL, 7, 0x01U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000001F4UL, 18, 0x06U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000000B0UL, 4, 0x01U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x00000340UL, 11, 0x03U, 0},
+    {0x000002F0UL, 8, 0x02U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x000002F8UL, 10, 0x02U, 0},
+    {0x00000000UL, 0, 0xFFU, 0},
+    {0x98DA1000UL, 13, 0x04U, 0},
+    {0x000000C4UL, 1, 0x00U, 0},
+    {0x00000050UL, 19, 0x04U, 0},
+    {0x000007DFUL, 20, 0x07U, 0},
+};
+
+static const OsGw_Table os_gw_cfg_canTable = {
+    0x6A5DCDE9UL, 0x247BDBC5UL, 4, 5, os_gw_cfg_canDisplacements, os_gw_cfg_canKeys
+};
+
+static const uint16 os_gw_cfg_pduDisplacements[2] = {
+    0, 0,
+};
+
+static const OsGw_Key os_gw_cfg_pduKeys[4] = {
+    {0x00030001UL, 23, 0xFEU, 0},
+    {0x00030002UL, 24, 0xFEU, 0},
+    {0x00020001UL, 21, 0xFEU, 0},
+    {0x00020002UL, 22, 0xFEU, 0},
+};
+
+static const OsGw_Table os_gw_cfg_pduTable = {
+    0xC325494FUL, 0xEB1C5EE1UL, 1, 2, os_gw_cfg_pduDisplacements, os_gw_cfg_pduKeys
+};
+
+/* canId, pduId, buses, container, flags */
+static const OsGw_Route os_gw_cfg_routes[25] = {
+    {0x000000C0UL, 0x000000C0UL, 0x16U, 0x00U, 0x0, 0},   /* EngineSpeed: Chassis, Body, Adas, Backbone */
+    {0x000000C4UL, 0x000000C4UL, 0x12U, 0xFFU, 0x0, 0},   /* EngineTorque: Chassis, Adas */
+    {0x000001A0UL, 0x000001A0UL, 0x2CU, 0x00U, 0x0, 0},   /* GearState: Body, Comfort, Infotainment, Backbone */
+    {0x000003D0UL, 0x000003D0UL, 0x20U, 0x01U, 0x0, 0},   /* FuelLevel: Infotainment, Telematics */
+    {0x000000B0UL, 0x000000B0UL, 0x11U, 0x00U, 0x0, 0},   /* WheelSpeeds: Powertrain, Adas, Backbone */
+    {0x000000B4UL, 0x000000B4UL, 0x10U, 0xFFU, 0x0, 0},   /* YawRate: Adas */
+    {0x000000B8UL, 0x000000B8UL, 0x51U, 0xFFU, 0x0, 0},   /* BrakePressure: Powertrain, Adas, Energy */
+    {0x000000C8UL, 0x000000C8UL, 0x10U, 0x00U, 0x0, 0},   /* SteeringAngle: Adas, Backbone */
+    {0x000002F0UL, 0x000002F0UL, 0x28U, 0x01U, 0x0, 0},   /* DoorState: Comfort, Infotainment, Telematics */
+    {0x000002F4UL, 0x000002F4UL, 0x30U, 0xFFU, 0x0, 0},   /* LightState: Adas, Infotainment */
+    {0x000002F8UL, 0x000002F8UL, 0x10U, 0xFFU, 0x0, 0},   /* WiperState: Adas */
+    {0x00000340UL, 0x00000340UL, 0x40U, 0x00U, 0x0, 0},   /* ClimateRequest: Energy, Backbone */
+    {0x00000344UL, 0x00000344UL, 0x14U, 0xFFU, 0x0, 0},   /* SeatOccupancy: Body, Adas */
+    {0xD8DA1000UL, 0x00010000UL, 0x00U, 0x00U, 0x0, 0},   /* ObjectList: Backbone */
+    {0x40000210UL, 0x00000210UL, 0x20U, 0x00U, 0x0, 0},   /* LaneInfo: Infotainment, Backbone */
+    {0x000000A0UL, 0x000000A0UL, 0x03U, 0xFFU, 0x0, 0},   /* BrakeRequest: Powertrain, Chassis */
+    {0x000004C0UL, 0x000004C0UL, 0x00U, 0x01U, 0x0, 0},   /* MediaState: Telematics */
+    {0x000001F0UL, 0x000001F0UL, 0x21U, 0x00U, 0x0, 0},   /* BatteryState: Powertrain, Infotainment, Backbone */
+    {0x000001F4UL, 0x000001F4UL, 0x20U, 0x01U, 0x1, 0},   /* ChargeState: Infotainment, Telematics */
+    {0x00000050UL, 0x00000050UL, 0x44U, 0x01U, 0x1, 0},   /* Crash: Body, Energy, Telematics */
+    {0x000007DFUL, 0x000007DFUL, 0x7FU, 0xFFU, 0x0, 0},   /* DiagRequest: Powertrain, Chassis, Body, Comfort, Adas, Infotainment, Energy */
+    {0x00000348UL, 0x00020001UL, 0x08U, 0xFFU, 0x0, 0},   /* RemoteClimate: Comfort */
+    {0x000002FCUL, 0x00020002UL, 0x04U, 0xFFU, 0x0, 0},   /* RemoteLock: Body */
+    {0x400004D0UL, 0x00030001UL, 0x20U, 0xFFU, 0x0, 0},   /* DisplayText: Infotainment */
+    {0x0000034CUL, 0x00030002UL, 0x48U, 0xFFU, 0x0, 0},   /* HvacSetpoint: Comfort, Energy */
+};
+
+static OsGw_Counters os_gw_cfg_counters[25];
+
+/* ip, port, size, timeout */
+static const OsGw_ContainerConfig os_gw_cfg_containers[2] = {
+    {0xC0A80114UL, 30500, 1400, 2000},   /* Backbone, 192.168.1.20 */
+    {0xC0A8011EUL, 30501, 1400, 20000},   /* Telematics, 192.168.1.30 */
+};
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+const OsGw_Config os_gw_cfg = {
+    &os_gw_cfg_canTable,
+    &os_gw_cfg_pduTable,
+    os_gw_cfg_routes,
+    os_gw_cfg_counters,
+    25,
+    os_gw_cfg_containers,
+    2,
+    30500,
+};
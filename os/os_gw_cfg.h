@@ -0,0 +1,46 @@
+/* Generated by tools/gw_gen.py from os_gw.json - do not edit. */
+#ifndef OS_GW_CFG_H
+#define OS_GW_CFG_H
+
+#include "os_gw.h"
+
+#define OS_GW_CFG_NUM_BUSES              (8)
+#define OS_GW_CFG_BUS_POWERTRAIN         (0)
+#define OS_GW_CFG_BUS_CHASSIS            (1)
+#define OS_GW_CFG_BUS_BODY               (2)
+#define OS_GW_CFG_BUS_COMFORT            (3)
+#define OS_GW_CFG_BUS_ADAS               (4)
+#define OS_GW_CFG_BUS_INFOTAINMENT       (5)
+#define OS_GW_CFG_BUS_ENERGY             (6)
+#define OS_GW_CFG_BUS_DIAGNOSTIC         (7)
+#define OS_GW_CFG_CONTAINER_BACKBONE     (0)
+#define OS_GW_CFG_CONTAINER_TELEMATICS   (1)
+#define OS_GW_CFG_ROUTE_ENGINE_SPEED     (0)
+#define OS_GW_CFG_ROUTE_ENGINE_TORQUE    (1)
+#define OS_GW_CFG_ROUTE_GEAR_STATE       (2)
+#define OS_GW_CFG_ROUTE_FUEL_LEVEL       (3)
+#define OS_GW_CFG_ROUTE_WHEEL_SPEEDS     (4)
+#define OS_GW_CFG_ROUTE_YAW_RATE         (5)
+#define OS_GW_CFG_ROUTE_BRAKE_PRESSURE   (6)
+#define OS_GW_CFG_ROUTE_STEERING_ANGLE   (7)
+#define OS_GW_CFG_ROUTE_DOOR_STATE       (8)
+#define OS_GW_CFG_ROUTE_LIGHT_STATE      (9)
+#define OS_GW_CFG_ROUTE_WIPER_STATE      (10)
+#define OS_GW_CFG_ROUTE_CLIMATE_REQUEST  (11)
+#define OS_GW_CFG_ROUTE_SEAT_OCCUPANCY   (12)
+#define OS_GW_CFG_ROUTE_OBJECT_LIST      (13)
+#define OS_GW_CFG_ROUTE_LANE_INFO        (14)
+#define OS_GW_CFG_ROUTE_BRAKE_REQUEST    (15)
+#define OS_GW_CFG_ROUTE_MEDIA_STATE      (16)
+#define OS_GW_CFG_ROUTE_BATTERY_STATE    (17)
+#define OS_GW_CFG_ROUTE_CHARGE_STATE     (18)
+#define OS_GW_CFG_ROUTE_CRASH            (19)
+#define OS_GW_CFG_ROUTE_DIAG_REQUEST     (20)
+#define OS_GW_CFG_ROUTE_REMOTE_CLIMATE   (21)
+#define OS_GW_CFG_ROUTE_REMOTE_LOCK      (22)
+#define OS_GW_CFG_ROUTE_DISPLAY_TEXT     (23)
+#define OS_GW_CFG_ROUTE_HVAC_SETPOINT    (24)
+
+extern const OsGw_Config os_gw_cfg;
+
+#endif /* OS_GW_CFG_H */
@@ -0,0 +1,793 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "os_isotp.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_ISOTP_WHEEL_MASK              (OS_ISOTP_WHEEL_SLOTS - 1)
+#define OS_ISOTP_LOOKUP_SIZE             (2 * OS_ISOTP_MAX_SESSIONS)
+
+#if ((OS_ISOTP_WHEEL_SLOTS & OS_ISOTP_WHEEL_MASK) != 0)
+#error OS_ISOTP_WHEEL_SLOTS must be a power of two
+#endif
+
+#if (OS_ISOTP_MAX_SESSIONS > 254)
+#error OS_ISOTP_MAX_SESSIONS must not be above 254
+#endif
+
+/* Protocol control information, the high nibble of the first byte. */
+#define OS_ISOTP_PCI_SINGLE              (0x00U)
+#define OS_ISOTP_PCI_FIRST               (0x10U)
+#define OS_ISOTP_PCI_CONSECUTIVE         (0x20U)
+#define OS_ISOTP_PCI_FLOW_CONTROL        (0x30U)
+#define OS_ISOTP_PCI_MASK                (0xF0U)
+
+#define OS_ISOTP_FLOW_CTS                (0U)
+#define OS_ISOTP_FLOW_WAIT               (1U)
+#define OS_ISOTP_FLOW_OVERFLOW           (2U)
+
+#define OS_ISOTP_CLASSIC_LENGTH          (8)      /* Frames up to this are padded to it        */
+#define OS_ISOTP_SINGLE_MAX_CLASSIC      (7)      /* Single frame with the 4-bit length        */
+#define OS_ISOTP_FIRST_MAX_CLASSIC       (4095)   /* First frame with the 12-bit length        */
+
+/* States of the sending side of a session. */
+#define OS_ISOTP_TX_IDLE                 (0U)
+#define OS_ISOTP_TX_FIRST                (1U)     /* Single or first frame refused by the driver */
+#define OS_ISOTP_TX_FLOW_CONTROL         (2U)     /* Waiting for a flow control, N_Bs          */
+#define OS_ISOTP_TX_CONSECUTIVE          (3U)     /* Sending a block, paced by STmin           */
+
+/* States of the receiving side. */
+#define OS_ISOTP_RX_IDLE                 (0U)
+#define OS_ISOTP_RX_FLOW_CONTROL         (1U)     /* Flow control refused by the driver        */
+#define OS_ISOTP_RX_CONSECUTIVE          (2U)     /* Waiting for a consecutive frame, N_Cr     */
+
+/* Valid CAN FD frame lengths above the classic 8 bytes. */
+static const uint8 os_isotp_fdLengths[] = {12, 16, 20, 24, 32, 48, 64};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Reads the time of the driver and advances the tick count to it. */
+static void os_isotp_updateTime(OsIsoTp *isotp)
+{
+    uint32 now     = isotp->driver->getTime(isotp->driver->context);
+    uint32 elapsed = (now - isotp->tickTime) / OS_ISOTP_TICK;
+
+    isotp->now       = now;
+    isotp->ticks    += elapsed;
+    isotp->tickTime += elapsed * OS_ISOTP_TICK;
+}
+
+/* Returns the length of the frame that carries length bytes: 8 for up to 8,
+ * else the next CAN FD length, 0 if there is none. */
+static uint32 os_isotp_getFrameLength(uint32 length)
+{
+    uint32 frameLength = 0;
+    uint32 index;
+
+    if (length <= OS_ISOTP_CLASSIC_LENGTH)
+    {
+        frameLength = OS_ISOTP_CLASSIC_LENGTH;
+    }
+    else
+    {
+        for (index = 0; (index < sizeof(os_isotp_fdLengths)) && (frameLength == 0); index++)
+        {
+            if (length <= os_isotp_fdLengths[index])
+            {
+                frameLength = os_isotp_fdLengths[index];
+            }
+        }
+    }
+
+    return frameLength;
+}
+
+/* Returns the STmin of a flow control in us.  Reserved values mean the
+ * longest, 127 ms. */
+static uint32 os_isotp_decodeStMin(uint8 stMin)
+{
+    uint32 time;
+
+    if (stMin <= 0x7FU)
+    {
+        time = (uint32)stMin * 1000U;
+    }
+    else if ((stMin >= 0xF1U) && (stMin <= 0xF9U))
+    {
+        time = (uint32)(stMin - 0xF0U) * 100U;
+    }
+    else
+    {
+        time = 127000U;
+    }
+
+    return time;
+}
+
+static uint32 os_isotp_hash(uint32 id)
+{
+    return (id * 2654435761UL) % OS_ISOTP_LOOKUP_SIZE;
+}
+
+static OsIsoTp_Session *os_isotp_findSession(OsIsoTp *isotp, uint32 id)
+{
+    OsIsoTp_Session *session = NULL_PTR;
+    uint32           slot    = os_isotp_hash(id);
+    uint32           probes;
+
+    for (probes = 0; (probes < OS_ISOTP_LOOKUP_SIZE) && (isotp->lookup[slot] != 0) && (session == NULL_PTR); probes++)
+    {
+        OsIsoTp_Session *candidate = &isotp->sessions[isotp->lookup[slot] - 1];
+
+        if (candidate->config->rxId == id)
+        {
+            session = candidate;
+        }
+
+        slot = (slot + 1) % OS_ISOTP_LOOKUP_SIZE;
+    }
+
+    return session;
+}
+
+static void os_isotp_cancel(OsIsoTp_Timer *timer)
+{
+    if (timer->link != NULL_PTR)
+    {
+        *timer->link = timer->next;
+
+        if (timer->next != NULL_PTR)
+        {
+            timer->next->link = timer->link;
+        }
+
+        timer->link = NULL_PTR;
+    }
+}
+
+/* Arms timer to run delay us from now, at the earliest at the next tick. */
+static void os_isotp_arm(OsIsoTp *isotp, OsIsoTp_Timer *timer, uint32 delay)
+{
+    uint32          ticks = (isotp->now - isotp->tickTime + delay + OS_ISOTP_TICK - 1) / OS_ISOTP_TICK;
+    OsIsoTp_Timer **slot;
+
+    os_isotp_cancel(timer);
+
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+
+    timer->expiry = isotp->ticks + ticks;
+    slot          = &isotp->wheel[timer->expiry & OS_ISOTP_WHEEL_MASK];
+    timer->next   = *slot;
+
+    if (timer->next != NULL_PTR)
+    {
+        timer->next->link = &timer->next;
+    }
+
+    *slot       = timer;
+    timer->link = slot;
+}
+
+/* Counts a frame the driver refused and returns TRUE once it has refused the
+ * frames of one side of a session for N_As or N_Ar. */
+static boolean os_isotp_refused(OsIsoTp *isotp, boolean *blocked, uint32 *deadline)
+{
+    boolean expired = FALSE;
+
+    isotp->status.txRefused++;
+
+    if (*blocked == FALSE)
+    {
+        *blocked  = TRUE;
+        *deadline = isotp->now + OS_ISOTP_TIMEOUT_A;
+    }
+    else
+    {
+        expired = ((sint32)(isotp->now - *deadline) >= 0) ? TRUE : FALSE;
+    }
+
+    return expired;
+}
+
+/* Hands a frame to the driver, padded to a valid length. */
+static boolean os_isotp_transmit(OsIsoTp *isotp, const OsIsoTp_Session *session, const uint8 *header, uint32 headerLength, const uint8 *payload, uint32 payloadLength)
+{
+    const OsIsoTp_Driver *driver = isotp->driver;
+    uint32                id     = session->config->txId;
+    boolean               sent;
+
+    if (session->config->frameLength > OS_ISOTP_CLASSIC_LENGTH)
+    {
+        id |= OS_ISOTP_ID_FD;
+    }
+
+    sent = driver->send(driver->context, id, header, headerLength, payload, payloadLength,
+        os_isotp_getFrameLength(headerLength + payloadLength));
+
+    if (sent != FALSE)
+    {
+        isotp->status.txFrames++;
+    }
+
+    return sent;
+}
+
+static void os_isotp_finishTx(OsIsoTp *isotp, OsIsoTp_Session *session, OsIsoTp_Result result)
+{
+    os_isotp_cancel(&session->txTimer);
+    session->txState = OS_ISOTP_TX_IDLE;
+    session->txData  = NULL_PTR;
+
+    if (result == OsIsoTp_Result_ok)
+    {
+        isotp->status.txMessages++;
+    }
+    else
+    {
+        isotp->status.errors++;
+    }
+
+    if (session->config->sent != NULL_PTR)
+    {
+        session->config->sent(session->config->arg, result);
+    }
+}
+
+static void os_isotp_finishRx(OsIsoTp *isotp, OsIsoTp_Session *session, OsIsoTp_Result result)
+{
+    uint8 *data = NULL_PTR;
+
+    os_isotp_cancel(&session->rxTimer);
+    session->rxState = OS_ISOTP_RX_IDLE;
+
+    if (result == OsIsoTp_Result_ok)
+    {
+        data              = session->rxBuffer;
+        session->rxBuffer = NULL_PTR;
+        session->rxSize   = 0;
+        isotp->status.rxMessages++;
+    }
+    else
+    {
+        isotp->status.errors++;
+    }
+
+    if (session->config->received != NULL_PTR)
+    {
+        session->config->received(session->config->arg, data, (data != NULL_PTR) ? session->rxLength : 0, result);
+    }
+}
+
+/* Sends the single or first frame of the message of a session. */
+static void os_isotp_sendFirst(OsIsoTp *isotp, OsIsoTp_Session *session)
+{
+    uint32  frameLength = session->config->frameLength;
+    uint32  length      = session->txLength;
+    uint8   header[OS_ISOTP_MAX_PCI_LENGTH];
+    uint32  headerLength;
+    uint32  payloadLength;
+    boolean single      = TRUE;
+
+    if (length <= OS_ISOTP_SINGLE_MAX_CLASSIC)
+    {
+        header[0]    = (uint8)(OS_ISOTP_PCI_SINGLE | length);
+        headerLength = 1;
+    }
+    else if ((frameLength > OS_ISOTP_CLASSIC_LENGTH) && (length <= (frameLength - 2)))
+    {
+        header[0]    = OS_ISOTP_PCI_SINGLE;
+        header[1]    = (uint8)length;
+        headerLength = 2;
+    }
+    else if (length <= OS_ISOTP_FIRST_MAX_CLASSIC)
+    {
+        header[0]    = (uint8)(OS_ISOTP_PCI_FIRST | (length >> 8));
+        header[1]    = (uint8)length;
+        headerLength = 2;
+        single       = FALSE;
+    }
+    else
+    {
+        header[0]    = OS_ISOTP_PCI_FIRST;
+        header[1]    = 0;
+        header[2]    = (uint8)(length >> 24);
+        header[3]    = (uint8)(length >> 16);
+        header[4]    = (uint8)(length >> 8);
+        header[5]    = (uint8)length;
+        headerLength = 6;
+        single       = FALSE;
+    }
+
+    payloadLength = (single != FALSE) ? length : (frameLength - headerLength);
+
+    if (os_isotp_transmit(isotp, session, header, headerLength, session->txData, payloadLength) != FALSE)
+    {
+        session->txBlocked = FALSE;
+
+        if (single != FALSE)
+        {
+            os_isotp_finishTx(isotp, session, OsIsoTp_Result_ok);
+        }
+        else
+        {
+            session->txOffset   = payloadLength;
+            session->txSequence = 1;
+            session->txState    = OS_ISOTP_TX_FLOW_CONTROL;
+            os_isotp_arm(isotp, &session->txTimer, OS_ISOTP_TIMEOUT_BS);
+        }
+    }
+    else if (os_isotp_refused(isotp, &session->txBlocked, &session->txDeadline) != FALSE)
+    {
+        os_isotp_finishTx(isotp, session, OsIsoTp_Result_timeoutA);
+    }
+    else
+    {
+        session->txState = OS_ISOTP_TX_FIRST;
+        os_isotp_arm(isotp, &session->txTimer, 0);
+    }
+}
+
+/* Sends consecutive frames until the message or the block ends, STmin has to
+ * pass, the driver is full or the session has sent OS_ISOTP_MAX_BURST frames
+ * and lets the others go first. */
+static void os_isotp_sendConsecutive(OsIsoTp *isotp, OsIsoTp_Session *session)
+{
+    uint32  maxPayload = (uint32)session->config->frameLength - 1;
+    uint32  burst      = 0;
+    boolean done       = FALSE;
+
+    while (done == FALSE)
+    {
+        uint8  header        = (uint8)(OS_ISOTP_PCI_CONSECUTIVE | (session->txSequence & 0xFU));
+        uint32 payloadLength = session->txLength - session->txOffset;
+
+        if (payloadLength > maxPayload)
+        {
+            payloadLength = maxPayload;
+        }
+
+        if (burst == OS_ISOTP_MAX_BURST)
+        {
+            os_isotp_arm(isotp, &session->txTimer, 0);
+            done = TRUE;
+        }
+        else if (os_isotp_transmit(isotp, session, &header, 1, &session->txData[session->txOffset], payloadLength) != FALSE)
+        {
+            session->txBlocked  = FALSE;
+            session->txOffset  += payloadLength;
+            session->txSequence++;
+            burst++;
+
+            if (session->txOffset == session->txLength)
+            {
+                os_isotp_finishTx(isotp, session, OsIsoTp_Result_ok);
+                done = TRUE;
+            }
+            else if ((session->txBlock != 0) && (--session->txBlock == 0))
+            {
+                session->txState = OS_ISOTP_TX_FLOW_CONTROL;
+                os_isotp_arm(isotp, &session->txTimer, OS_ISOTP_TIMEOUT_BS);
+                done             = TRUE;
+            }
+            else if (session->txStMin != 0)
+            {
+                os_isotp_arm(isotp, &session->txTimer, session->txStMin);
+                done = TRUE;
+            }
+            else
+            {}
+        }
+        else
+        {
+            if (os_isotp_refused(isotp, &session->txBlocked, &session->txDeadline) != FALSE)
+            {
+                os_isotp_finishTx(isotp, session, OsIsoTp_Result_timeoutA);
+            }
+            else
+            {
+                os_isotp_arm(isotp, &session->txTimer, 0);
+            }
+
+            done = TRUE;
+        }
+    }
+}
+
+/* Sends the clear to send flow control of a session. */
+static void os_isotp_sendFlowControl(OsIsoTp *isotp, OsIsoTp_Session *session)
+{
+    uint8 header[3];
+
+    header[0] = OS_ISOTP_PCI_FLOW_CONTROL | OS_ISOTP_FLOW_CTS;
+    header[1] = session->config->blockSize;
+    header[2] = session->config->stMin;
+
+    if (os_isotp_transmit(isotp, session, header, sizeof(header), NULL_PTR, 0) != FALSE)
+    {
+        session->rxBlocked = FALSE;
+        session->rxBlock   = session->config->blockSize;
+        session->rxState   = OS_ISOTP_RX_CONSECUTIVE;
+        os_isotp_arm(isotp, &session->rxTimer, OS_ISOTP_TIMEOUT_CR);
+    }
+    else if (os_isotp_refused(isotp, &session->rxBlocked, &session->rxDeadline) != FALSE)
+    {
+        os_isotp_finishRx(isotp, session, OsIsoTp_Result_timeoutA);
+    }
+    else
+    {
+        session->rxState = OS_ISOTP_RX_FLOW_CONTROL;
+        os_isotp_arm(isotp, &session->rxTimer, 0);
+    }
+}
+
+/* Rejects a first frame with an overflow flow control.  It is sent once, the
+ * sender times out if the driver refuses it. */
+static void os_isotp_sendOverflow(OsIsoTp *isotp, OsIsoTp_Session *session)
+{
+    uint8 header[3];
+
+    header[0] = OS_ISOTP_PCI_FLOW_CONTROL | OS_ISOTP_FLOW_OVERFLOW;
+    header[1] = 0;
+    header[2] = 0;
+
+    if (os_isotp_transmit(isotp, session, header, sizeof(header), NULL_PTR, 0) == FALSE)
+    {
+        isotp->status.txRefused++;
+    }
+
+    isotp->status.errors++;
+}
+
+static void os_isotp_receiveSingle(OsIsoTp *isotp, OsIsoTp_Session *session, const uint8 *data, uint32 length)
+{
+    uint32 messageLength = data[0] & 0xFU;
+    uint32 offset        = 1;
+
+    if ((messageLength == 0) && (length > OS_ISOTP_CLASSIC_LENGTH))
+    {
+        messageLength = data[1];
+        offset        = 2;
+    }
+
+    if ((messageLength == 0) || (messageLength > (length - offset)))
+    {
+        isotp->status.dropped++;
+    }
+    else
+    {
+        if (session->rxState != OS_ISOTP_RX_IDLE)
+        {
+            os_isotp_finishRx(isotp, session, OsIsoTp_Result_aborted);
+        }
+
+        if ((session->rxBuffer == NULL_PTR) || (messageLength > session->rxSize))
+        {
+            isotp->status.errors++;
+        }
+        else
+        {
+            memcpy(session->rxBuffer, &data[offset], messageLength);
+            session->rxLength = messageLength;
+            os_isotp_finishRx(isotp, session, OsIsoTp_Result_ok);
+        }
+    }
+}
+
+static void os_isotp_receiveFirst(OsIsoTp *isotp, OsIsoTp_Session *session, const uint8 *data, uint32 length)
+{
+    uint32 messageLength = ((uint32)(data[0] & 0xFU) << 8) | data[1];
+    uint32 offset        = 2;
+
+    if ((messageLength == 0) && (length >= OS_ISOTP_MAX_PCI_LENGTH))
+    {
+        messageLength = ((uint32)data[2] << 24) | ((uint32)data[3] << 16) | ((uint32)data[4] << 8) | data[5];
+        offset        = OS_ISOTP_MAX_PCI_LENGTH;
+    }
+
+    if ((length < OS_ISOTP_CLASSIC_LENGTH) || (messageLength <= (length - offset)))
+    {
+        isotp->status.dropped++;
+    }
+    else
+    {
+        if (session->rxState != OS_ISOTP_RX_IDLE)
+        {
+            os_isotp_finishRx(isotp, session, OsIsoTp_Result_aborted);
+        }
+
+        if ((session->rxBuffer == NULL_PTR) || (messageLength > session->rxSize))
+        {
+            os_isotp_sendOverflow(isotp, session);
+        }
+        else
+        {
+            memcpy(session->rxBuffer, &data[offset], length - offset);
+            session->rxLength   = messageLength;
+            session->rxOffset   = length - offset;
+            session->rxSequence = 1;
+            session->rxBlocked  = FALSE;
+            os_isotp_sendFlowControl(isotp, session);
+        }
+    }
+}
+
+static void os_isotp_receiveConsecutive(OsIsoTp *isotp, OsIsoTp_Session *session, const uint8 *data, uint32 length)
+{
+    uint32 payloadLength = length - 1;
+
+    if (session->rxState != OS_ISOTP_RX_CONSECUTIVE)
+    {
+        isotp->status.dropped++;
+    }
+    else if ((data[0] & 0xFU) != (session->rxSequence & 0xFU))
+    {
+        os_isotp_finishRx(isotp, session, OsIsoTp_Result_wrongSequence);
+    }
+    else
+    {
+        if (payloadLength > (session->rxLength - session->rxOffset))
+        {
+            payloadLength = session->rxLength - session->rxOffset;
+        }
+
+        memcpy(&session->rxBuffer[session->rxOffset], &data[1], payloadLength);
+        session->rxOffset += payloadLength;
+        session->rxSequence++;
+
+        if (session->rxOffset == session->rxLength)
+        {
+            os_isotp_finishRx(isotp, session, OsIsoTp_Result_ok);
+        }
+        else if ((session->rxBlock != 0) && (--session->rxBlock == 0))
+        {
+            os_isotp_sendFlowControl(isotp, session);
+        }
+        else
+        {
+            os_isotp_arm(isotp, &session->rxTimer, OS_ISOTP_TIMEOUT_CR);
+        }
+    }
+}
+
+static void os_isotp_receiveFlowControl(OsIsoTp *isotp, OsIsoTp_Session *session, const uint8 *data, uint32 length)
+{
+    uint32 flowStatus = data[0] & 0xFU;
+
+    if ((session->txState != OS_ISOTP_TX_FLOW_CONTROL) || (length < 3))
+    {
+        isotp->status.dropped++;
+    }
+    else if (flowStatus == OS_ISOTP_FLOW_CTS)
+    {
+        session->txBlock   = data[1];
+        session->txStMin   = os_isotp_decodeStMin(data[2]);
+        session->txState   = OS_ISOTP_TX_CONSECUTIVE;
+        session->txBlocked = FALSE;
+        os_isotp_cancel(&session->txTimer);
+        os_isotp_sendConsecutive(isotp, session);
+    }
+    else if (flowStatus == OS_ISOTP_FLOW_WAIT)
+    {
+        os_isotp_arm(isotp, &session->txTimer, OS_ISOTP_TIMEOUT_BS);
+    }
+    else if (flowStatus == OS_ISOTP_FLOW_OVERFLOW)
+    {
+        os_isotp_finishTx(isotp, session, OsIsoTp_Result_overflow);
+    }
+    else
+    {
+        isotp->status.dropped++;
+    }
+}
+
+/* Runs the timer of one side of a session. */
+static void os_isotp_expire(OsIsoTp *isotp, OsIsoTp_Timer *timer)
+{
+    OsIsoTp_Session *session = &isotp->sessions[timer->session];
+
+    if (timer->receiving != FALSE)
+    {
+        if (session->rxState == OS_ISOTP_RX_FLOW_CONTROL)
+        {
+            os_isotp_sendFlowControl(isotp, session);
+        }
+        else
+        {
+            os_isotp_finishRx(isotp, session, OsIsoTp_Result_timeoutCr);
+        }
+    }
+    else if (session->txState == OS_ISOTP_TX_FIRST)
+    {
+        os_isotp_sendFirst(isotp, session);
+    }
+    else if (session->txState == OS_ISOTP_TX_FLOW_CONTROL)
+    {
+        os_isotp_finishTx(isotp, session, OsIsoTp_Result_timeoutBs);
+    }
+    else
+    {
+        os_isotp_sendConsecutive(isotp, session);
+    }
+}
+
+sint32 os_isotp_open(OsIsoTp *isotp, const OsIsoTp_SessionConfig *config)
+{
+    sint32 result = -1;
+    uint32 frameLength = config->frameLength;
+
+    if ((isotp->numSessions < OS_ISOTP_MAX_SESSIONS) && (frameLength >= OS_ISOTP_CLASSIC_LENGTH)
+        && (os_isotp_getFrameLength(frameLength) == frameLength) && (os_isotp_findSession(isotp, config->rxId) == NULL_PTR))
+    {
+        uint32           number  = isotp->numSessions;
+        OsIsoTp_Session *session = &isotp->sessions[number];
+        uint32           slot    = os_isotp_hash(config->rxId);
+
+        while (isotp->lookup[slot] != 0)
+        {
+            slot = (slot + 1) % OS_ISOTP_LOOKUP_SIZE;
+        }
+
+        memset(session, 0, sizeof(*session));
+        session->config             = config;
+        session->txTimer.session    = (uint8)number;
+        session->txTimer.receiving  = FALSE;
+        session->rxTimer.session    = (uint8)number;
+        session->rxTimer.receiving  = TRUE;
+        isotp->lookup[slot]         = (uint8)(number + 1);
+        isotp->numSessions++;
+        result                      = (sint32)number;
+    }
+
+    return result;
+}
+
+void os_isotp_start(OsIsoTp *isotp, const OsIsoTp_Driver *driver)
+{
+    isotp->driver     = driver;
+    isotp->tickTime   = driver->getTime(driver->context);
+    isotp->now        = isotp->tickTime;
+    isotp->ticks      = 0;
+    isotp->wheelTicks = 0;
+}
+
+OsIsoTp_Result os_isotp_send(OsIsoTp *isotp, uint32 session, const uint8 *data, uint32 length)
+{
+    OsIsoTp_Result result = OsIsoTp_Result_ok;
+
+    if ((session >= isotp->numSessions) || (length == 0))
+    {
+        result = OsIsoTp_Result_invalid;
+    }
+    else if (isotp->sessions[session].txState != OS_ISOTP_TX_IDLE)
+    {
+        result = OsIsoTp_Result_busy;
+    }
+    else
+    {
+        OsIsoTp_Session *txSession = &isotp->sessions[session];
+
+        os_isotp_updateTime(isotp);
+        txSession->txData    = data;
+        txSession->txLength  = length;
+        txSession->txOffset  = 0;
+        txSession->txBlocked = FALSE;
+        txSession->txState   = OS_ISOTP_TX_FIRST;
+        os_isotp_sendFirst(isotp, txSession);
+    }
+
+    return result;
+}
+
+boolean os_isotp_setRxBuffer(OsIsoTp *isotp, uint32 session, uint8 *buffer, uint32 size)
+{
+    boolean result = FALSE;
+
+    if ((session < isotp->numSessions) && (isotp->sessions[session].rxState == OS_ISOTP_RX_IDLE))
+    {
+        isotp->sessions[session].rxBuffer = buffer;
+        isotp->sessions[session].rxSize   = size;
+        result                            = TRUE;
+    }
+
+    return result;
+}
+
+void os_isotp_receive(OsIsoTp *isotp, uint32 id, const uint8 *data, uint32 length)
+{
+    OsIsoTp_Session *session = os_isotp_findSession(isotp, id);
+
+    if ((session == NULL_PTR) || (length < 2))
+    {
+        isotp->status.dropped++;
+    }
+    else
+    {
+        os_isotp_updateTime(isotp);
+        isotp->status.rxFrames++;
+
+        switch (data[0] & OS_ISOTP_PCI_MASK)
+        {
+        case OS_ISOTP_PCI_SINGLE:
+            os_isotp_receiveSingle(isotp, session, data, length);
+            break;
+        case OS_ISOTP_PCI_FIRST:
+            os_isotp_receiveFirst(isotp, session, data, length);
+            break;
+        case OS_ISOTP_PCI_CONSECUTIVE:
+            os_isotp_receiveConsecutive(isotp, session, data, length);
+            break;
+        case OS_ISOTP_PCI_FLOW_CONTROL:
+            os_isotp_receiveFlowControl(isotp, session, data, length);
+            break;
+        default:
+            isotp->status.dropped++;
+            break;
+        }
+    }
+}
+
+void os_isotp_poll(OsIsoTp *isotp)
+{
+    uint32 slots = 0;
+
+    os_isotp_updateTime(isotp);
+
+    /* Each slot is visited once however long the poll was late.  A timer that
+     * runs may arm or cancel others in the same slot, so the slot is scanned
+     * again from its head after each. */
+    while ((isotp->wheelTicks != isotp->ticks) && (slots < OS_ISOTP_WHEEL_SLOTS))
+    {
+        OsIsoTp_Timer *timer;
+
+        isotp->wheelTicks++;
+        slots++;
+        timer = isotp->wheel[isotp->wheelTicks & OS_ISOTP_WHEEL_MASK];
+
+        while (timer != NULL_PTR)
+        {
+            if ((sint32)(timer->expiry - isotp->ticks) <= 0)
+            {
+                os_isotp_cancel(timer);
+                os_isotp_expire(isotp, timer);
+                timer = isotp->wheel[isotp->wheelTicks & OS_ISOTP_WHEEL_MASK];
+            }
+            else
+            {
+                timer = timer->next;
+            }
+        }
+    }
+
+    isotp->wheelTicks = isotp->ticks;
+}
+
+boolean os_isotp_isBusy(const OsIsoTp *isotp)
+{
+    boolean busy = FALSE;
+    uint32  index;
+
+    for (index = 0; index < isotp->numSessions; index++)
+    {
+        if ((isotp->sessions[index].txState != OS_ISOTP_TX_IDLE) || (isotp->sessions[index].rxState != OS_ISOTP_RX_IDLE))
+        {
+            busy = TRUE;
+        }
+    }
+
+    return busy;
+}
+
+void os_isotp_getStatus(const OsIsoTp *isotp, OsIsoTp_Status *status)
+{
+    *status = isotp->status;
+}
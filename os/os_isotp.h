@@ -0,0 +1,248 @@
+#ifndef OS_ISOTP_H
+#define OS_ISOTP_H
+
+/* ISO 15765-2 transport protocol (ISO-TP) over CAN and CAN FD.
+ *
+ * An OsIsoTp instance runs any number of sessions up to OS_ISOTP_MAX_SESSIONS
+ * in one task.  A session is a pair of CAN identifiers with normal addressing:
+ * it sends on txId and receives on rxId, one message in each direction at a
+ * time.  Messages of up to 4095 bytes use the classic first frame, longer ones
+ * the 32-bit escape of ISO 15765-2:2016.  Frames are up to frameLength bytes,
+ * 8 for classic CAN and up to 64 for CAN FD; a frame shorter than a valid
+ * CAN FD length is padded with OS_ISOTP_PADDING.
+ *
+ * No payload is copied by the engine: a message is segmented straight from the
+ * buffer of the caller, the driver writing each frame as a protocol control
+ * header and a slice of that buffer into the controller, and consecutive
+ * frames are reassembled straight from the received frame into the receive
+ * buffer of the session.  A session receives only while it has a buffer: the
+ * buffer is handed back with the message, and must be given again with
+ * os_isotp_setRxBuffer() for the next one.  A first frame that finds no
+ * buffer, or one too small, is answered with an overflow flow control.
+ *
+ * The timeouts N_As and N_Ar (the driver does not take a frame), N_Bs (no flow
+ * control) and N_Cr (no consecutive frame) and the STmin pacing of the sender
+ * run on a timer wheel of OS_ISOTP_WHEEL_SLOTS slots of OS_ISOTP_TICK us, so
+ * that os_isotp_poll() only visits the slots that fell due.
+ *
+ * Throughput is set by the receiver with blockSize and stMin: with 0 and 0 the
+ * sender sends a whole message as fast as the driver takes frames, which the
+ * receiver must be able to drain from its receive FIFO.  A blockSize no larger
+ * than that FIFO bounds every burst to what it holds, at the cost of one flow
+ * control round trip per block.
+ *
+ * All functions of an instance, and the callbacks they run, belong to one
+ * task.  Not supported: extended and mixed addressing, functional addressing
+ * and the WAIT flow control on the receiving side (it is accepted from the
+ * sender's peer).  This file holds no hardware access, see os_isotp_can.c for
+ * the CAN driver. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef OS_ISOTP_MAX_SESSIONS
+#define OS_ISOTP_MAX_SESSIONS            (16)     /* Sessions of an instance, at most 254     */
+#endif
+
+#ifndef OS_ISOTP_TICK
+#define OS_ISOTP_TICK                    (100)    /* us per slot of the timer wheel           */
+#endif
+
+#ifndef OS_ISOTP_WHEEL_SLOTS
+#define OS_ISOTP_WHEEL_SLOTS             (256)    /* A power of two                           */
+#endif
+
+/* Timeouts in us, the ISO 15765-2 defaults. */
+#ifndef OS_ISOTP_TIMEOUT_A
+#define OS_ISOTP_TIMEOUT_A               (1000000) /* N_As and N_Ar                           */
+#endif
+
+#ifndef OS_ISOTP_TIMEOUT_BS
+#define OS_ISOTP_TIMEOUT_BS              (1000000)
+#endif
+
+#ifndef OS_ISOTP_TIMEOUT_CR
+#define OS_ISOTP_TIMEOUT_CR              (1000000)
+#endif
+
+#ifndef OS_ISOTP_MAX_BURST
+#define OS_ISOTP_MAX_BURST               (8)      /* Frames a session sends before the others */
+#endif
+
+#ifndef OS_ISOTP_PADDING
+#define OS_ISOTP_PADDING                 (0xCCU)
+#endif
+
+/* Flags of a CAN identifier: an extended, 29-bit identifier, and a CAN FD
+ * frame, which the engine sets for the sessions with a frameLength above 8. */
+#define OS_ISOTP_ID_EXTENDED             (0x80000000UL)
+#define OS_ISOTP_ID_FD                   (0x40000000UL)
+#define OS_ISOTP_ID_MASK                 (0x1FFFFFFFUL)
+
+#define OS_ISOTP_MAX_FRAME_LENGTH        (64)
+#define OS_ISOTP_MAX_PCI_LENGTH          (6)      /* First frame with the 32-bit escape       */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+typedef enum
+{
+    OsIsoTp_Result_ok,
+    OsIsoTp_Result_busy,             /* A message is being sent on the session                  */
+    OsIsoTp_Result_invalid,          /* Unknown session or a length of 0                        */
+    OsIsoTp_Result_timeoutA,         /* The driver did not take a frame within N_As or N_Ar     */
+    OsIsoTp_Result_timeoutBs,        /* No flow control within N_Bs                             */
+    OsIsoTp_Result_timeoutCr,        /* No consecutive frame within N_Cr                        */
+    OsIsoTp_Result_wrongSequence,    /* A consecutive frame out of sequence                     */
+    OsIsoTp_Result_overflow,         /* The peer has no room for the message                    */
+    OsIsoTp_Result_aborted           /* A new message of the peer replaced the one received     */
+} OsIsoTp_Result;
+
+/* A message received into the buffer given with os_isotp_setRxBuffer(), which
+ * belongs to the caller again.  On an error data is NULL_PTR and the buffer
+ * stays with the session. */
+typedef void (*OsIsoTp_Received)(void *arg, uint8 *data, uint32 length, OsIsoTp_Result result);
+
+/* A message given to os_isotp_send() has been sent, or failed. */
+typedef void (*OsIsoTp_Sent)(void *arg, OsIsoTp_Result result);
+
+typedef struct
+{
+    uint32           txId;           /* CAN identifier sent on, OS_ISOTP_ID_EXTENDED for 29 bits */
+    uint32           rxId;           /* CAN identifier received on                              */
+    uint8            frameLength;    /* 8 for classic CAN, or a CAN FD length up to 64          */
+    uint8            blockSize;      /* Consecutive frames between flow controls, 0: no limit   */
+    uint8            stMin;          /* ISO 15765-2 encoding: 0 to 127 ms, 0xF1 to 0xF9 x 100 us */
+    OsIsoTp_Received received;
+    OsIsoTp_Sent     sent;
+    void            *arg;
+} OsIsoTp_SessionConfig;
+
+typedef struct
+{
+    void   *context;
+
+    /* Writes a frame of frameLength bytes, a valid CAN FD length, on id with
+     * its flags to the controller: the header, then payloadLength bytes of
+     * payload, then padding.  Returns FALSE if the controller has no room, the engine
+     * tries again at a later tick. */
+    boolean (*send)(void *context, uint32 id, const uint8 *header, uint32 headerLength,
+                    const uint8 *payload, uint32 payloadLength, uint32 frameLength);
+
+    /* Returns a free running time in us. */
+    uint32 (*getTime)(void *context);
+} OsIsoTp_Driver;
+
+/* See os_isotp_getStatus(). */
+typedef struct
+{
+    uint32 rxFrames;             /* Frames for a session                                        */
+    uint32 txFrames;             /* Frames the driver took                                      */
+    uint32 txRefused;            /* Frames the driver had no room for, tried again              */
+    uint32 dropped;              /* Frames malformed, unexpected or for no session              */
+    uint32 rxMessages;
+    uint32 txMessages;
+    uint32 errors;               /* Messages that failed in either direction                    */
+} OsIsoTp_Status;
+
+/* The members below are private to os_isotp.c. */
+
+typedef struct OsIsoTp_Timer_
+{
+    struct OsIsoTp_Timer_  *next;
+    struct OsIsoTp_Timer_ **link;        /* Pointer to this timer, NULL_PTR while not armed     */
+    uint32                  expiry;      /* Tick                                                */
+    uint8                   session;
+    boolean                 receiving;
+} OsIsoTp_Timer;
+
+typedef struct
+{
+    const OsIsoTp_SessionConfig *config;
+
+    /* Sending.  deadline is the end of N_As while the driver refuses frames. */
+    uint8                        txState;
+    uint8                        txSequence;
+    uint8                        txBlock;        /* Consecutive frames left in the block         */
+    boolean                      txBlocked;      /* The driver refused the last frame            */
+    const uint8                 *txData;
+    uint32                       txLength;
+    uint32                       txOffset;
+    uint32                       txStMin;        /* us                                           */
+    uint32                       txDeadline;
+    OsIsoTp_Timer                txTimer;
+
+    /* Receiving. */
+    uint8                        rxState;
+    uint8                        rxSequence;
+    uint8                        rxBlock;
+    boolean                      rxBlocked;
+    uint8                       *rxBuffer;
+    uint32                       rxSize;
+    uint32                       rxLength;
+    uint32                       rxOffset;
+    uint32                       rxDeadline;
+    OsIsoTp_Timer                rxTimer;
+} OsIsoTp_Session;
+
+/* An instance, zero before the first os_isotp_open(). */
+typedef struct
+{
+    const OsIsoTp_Driver *driver;
+    OsIsoTp_Session       sessions[OS_ISOTP_MAX_SESSIONS];
+    uint32                numSessions;
+    uint8                 lookup[2 * OS_ISOTP_MAX_SESSIONS];   /* By rxId, session + 1, 0 for none */
+    OsIsoTp_Timer        *wheel[OS_ISOTP_WHEEL_SLOTS];
+    uint32                now;                                 /* us, read from the driver        */
+    uint32                tickTime;                            /* us the current tick started at  */
+    uint32                ticks;                               /* Ticks since os_isotp_start()    */
+    uint32                wheelTicks;                          /* Tick the wheel was run up to    */
+    OsIsoTp_Status        status;
+} OsIsoTp;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Adds a session, config must stay valid.  Called before os_isotp_start().
+ * Returns the session number, or -1 if the instance is full, the frame length
+ * is not a CAN FD length, or rxId is taken. */
+extern sint32 os_isotp_open(OsIsoTp *isotp, const OsIsoTp_SessionConfig *config);
+
+/* Starts the instance on driver. */
+extern void os_isotp_start(OsIsoTp *isotp, const OsIsoTp_Driver *driver);
+
+/* Starts sending length bytes of data, which must stay valid until the sent
+ * callback of the session has run.  A single frame message is sent, and the
+ * callback run, before the function returns. */
+extern OsIsoTp_Result os_isotp_send(OsIsoTp *isotp, uint32 session, const uint8 *data, uint32 length);
+
+/* Gives the session a buffer of size bytes to receive the next message into.
+ * Returns FALSE while a message is being received into the current one. */
+extern boolean os_isotp_setRxBuffer(OsIsoTp *isotp, uint32 session, uint8 *buffer, uint32 size);
+
+/* Processes a frame received on id, with OS_ISOTP_ID_EXTENDED for an extended
+ * identifier.  data may point into the controller, it is read before the
+ * function returns. */
+extern void os_isotp_receive(OsIsoTp *isotp, uint32 id, const uint8 *data, uint32 length);
+
+/* Runs the timers that fell due: sends the consecutive frames whose STmin has
+ * passed, retries the frames the driver refused and ends the sessions that
+ * timed out.  Called at least every OS_ISOTP_TICK us while messages are in
+ * flight; a coarser period paces the senders down to it. */
+extern void os_isotp_poll(OsIsoTp *isotp);
+
+/* Returns TRUE while a message is being sent or received on any session. */
+extern boolean os_isotp_isBusy(const OsIsoTp *isotp);
+
+/* Copies the statistics of the instance. */
+extern void os_isotp_getStatus(const OsIsoTp *isotp, OsIsoTp_Status *status);
+
+#endif /* OS_ISOTP_H */
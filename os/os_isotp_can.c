@@ -0,0 +1,287 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "IfxStm.h"
+#include "Can/Can/IfxCan_Can.h"
+#include "os_isotp_can.h"
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+/* Message RAM, byte offsets from the module.  Filters for every session, and
+ * FIFO elements of 8 header and 64 data bytes. */
+#define OS_ISOTP_CAN_ELEMENT_SIZE        (8 + OS_ISOTP_MAX_FRAME_LENGTH)
+#define OS_ISOTP_CAN_STANDARD_FILTERS    (0x0000U)
+#define OS_ISOTP_CAN_EXTENDED_FILTERS    (0x0080U)
+#define OS_ISOTP_CAN_RX_FIFO0            (0x0100U)
+#define OS_ISOTP_CAN_TX_BUFFERS          (0x0A00U)
+#define OS_ISOTP_CAN_UNUSED              (0x1300U)
+
+#if (OS_ISOTP_MAX_SESSIONS > 16)
+#error The message RAM layout has room for 16 filters of each length
+#endif
+
+#if ((OS_ISOTP_CAN_RX_FIFO0 + (OS_ISOTP_CAN_RX_FIFO_SIZE * OS_ISOTP_CAN_ELEMENT_SIZE)) > OS_ISOTP_CAN_TX_BUFFERS)
+#error OS_ISOTP_CAN_RX_FIFO_SIZE is too large for the message RAM layout
+#endif
+
+#if ((OS_ISOTP_CAN_TX_BUFFERS + (OS_ISOTP_CAN_TX_FIFO_SIZE * OS_ISOTP_CAN_ELEMENT_SIZE)) > OS_ISOTP_CAN_UNUSED)
+#error OS_ISOTP_CAN_TX_FIFO_SIZE is too large for the message RAM layout
+#endif
+
+/* Data length code of every frame length, 0 where there is none. */
+static const uint8 os_isotp_can_codes[OS_ISOTP_MAX_FRAME_LENGTH + 1] = {
+    [8] = IfxCan_DataLengthCode_8, [12] = IfxCan_DataLengthCode_12, [16] = IfxCan_DataLengthCode_16,
+    [20] = IfxCan_DataLengthCode_20, [24] = IfxCan_DataLengthCode_24, [32] = IfxCan_DataLengthCode_32,
+    [48] = IfxCan_DataLengthCode_48, [64] = IfxCan_DataLengthCode_64,
+};
+
+/* Frame length of every data length code. */
+static const uint8 os_isotp_can_lengths[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+static const IfxCan_Can_Pins os_isotp_can_pins = {
+    .txPin     = &IfxCan_TXD00_P20_8_OUT,
+    .txPinMode = IfxPort_OutputMode_pushPull,
+    .rxPin     = &IfxCan_RXD00B_P20_7_IN,
+    .rxPinMode = IfxPort_InputMode_pullUp,
+    .padDriver = IfxPort_PadDriver_cmosAutomotiveSpeed2,
+};
+
+static IfxCan_Can         os_isotp_can_module;
+static IfxCan_Can_Node    os_isotp_can_node;
+static OsIsoTp            os_isotp_can;
+static TaskHandle_t       os_isotp_can_taskHandle;
+static uint32             os_isotp_can_ticksPerUs;
+
+static boolean            os_isotp_can_sendFrame(void *context, uint32 id, const uint8 *header, uint32 headerLength,
+                                                 const uint8 *payload, uint32 payloadLength, uint32 frameLength);
+static uint32             os_isotp_can_getTime(void *context);
+
+static const OsIsoTp_Driver os_isotp_can_driver = {
+    .context = &os_isotp_can_node,
+    .send    = os_isotp_can_sendFrame,
+    .getTime = os_isotp_can_getTime,
+};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Writes the frame straight into the next element of the Tx FIFO. */
+static boolean os_isotp_can_sendFrame(void *context, uint32 id, const uint8 *header, uint32 headerLength,
+                                      const uint8 *payload, uint32 payloadLength, uint32 frameLength)
+{
+    IfxCan_Can_Node *node = (IfxCan_Can_Node *)context;
+    boolean          sent = FALSE;
+
+    if (IfxCan_Node_isTxFifoQueueFull(node->node) == FALSE)
+    {
+        IfxCan_TxBufferId bufferId = IfxCan_Node_getTxFifoQueuePutIndex(node->node);
+        Ifx_CAN_TXMSG    *element  = IfxCan_Node_getTxBufferElementAddress(node->node, node->messageRAM.baseAddress, node->messageRAM.txBuffersStartAddress, bufferId);
+        uint32            index;
+
+        element->T0.U = 0;
+        element->T1.U = 0;
+        IfxCan_Node_setMsgId(element, id & OS_ISOTP_ID_MASK, ((id & OS_ISOTP_ID_EXTENDED) != 0) ? IfxCan_MessageIdLength_extended : IfxCan_MessageIdLength_standard);
+        IfxCan_Node_setDataLength(element, (IfxCan_DataLengthCode)os_isotp_can_codes[frameLength]);
+        IfxCan_Node_setFrameModeReq(element, ((id & OS_ISOTP_ID_FD) != 0) ? IfxCan_FrameMode_fdLongAndFast : IfxCan_FrameMode_standard);
+
+        for (index = 0; index < headerLength; index++)
+        {
+            element->DB[index].U = header[index];
+        }
+
+        for (index = 0; index < payloadLength; index++)
+        {
+            element->DB[headerLength + index].U = payload[index];
+        }
+
+        for (index = headerLength + payloadLength; index < frameLength; index++)
+        {
+            element->DB[index].U = OS_ISOTP_PADDING;
+        }
+
+        IfxCan_Node_setTxBufferAddRequest(node->node, bufferId);
+        sent = TRUE;
+    }
+
+    return sent;
+}
+
+static uint32 os_isotp_can_getTime(void *context)
+{
+    (void)context;
+
+    return (uint32)(IfxStm_get(&MODULE_STM0) / os_isotp_can_ticksPerUs);
+}
+
+/* Hands every frame in Rx FIFO 0 to the engine in place, then frees its
+ * element. */
+static void os_isotp_can_receive(void)
+{
+    Ifx_CAN_N *node = os_isotp_can_node.node;
+
+    while (IfxCan_Node_getRxFifo0FillLevel(node) != 0)
+    {
+        IfxCan_RxBufferId bufferId = IfxCan_Node_getRxFifo0GetIndex(node);
+        Ifx_CAN_RXMSG    *element  = IfxCan_Node_getRxFifo0ElementAddress(node, os_isotp_can_node.messageRAM.baseAddress,
+            os_isotp_can_node.messageRAM.rxFifo0StartAddress, bufferId);
+        uint32            id       = IfxCan_Node_getMesssageId(element);
+
+        if (element->R0.B.XTD != 0)
+        {
+            id |= OS_ISOTP_ID_EXTENDED;
+        }
+
+        os_isotp_receive(&os_isotp_can, id, (const uint8 *)&element->DB[0], os_isotp_can_lengths[IfxCan_Node_getDataLengthCode(element)]);
+        IfxCan_Node_setRxFifo0AcknowledgeIndex(node, bufferId);
+    }
+}
+
+static void os_isotp_can_initNode(void)
+{
+    IfxCan_Can_Config     moduleConfig;
+    IfxCan_Can_NodeConfig config;
+    IfxCan_Filter         filter;
+    uint32                standardFilters = 0;
+    uint32                extendedFilters = 0;
+    uint32                index;
+
+    IfxCan_Can_initModuleConfig(&moduleConfig, &MODULE_CAN0);
+    IfxCan_Can_initModule(&os_isotp_can_module, &moduleConfig);
+    IfxCan_Can_initNodeConfig(&config, &os_isotp_can_module);
+
+    for (index = 0; index < os_isotp_can.numSessions; index++)
+    {
+        if ((os_isotp_can.sessions[index].config->rxId & OS_ISOTP_ID_EXTENDED) != 0)
+        {
+            extendedFilters++;
+        }
+        else
+        {
+            standardFilters++;
+        }
+    }
+
+    config.nodeId                              = IfxCan_NodeId_0;
+    config.pins                                = &os_isotp_can_pins;
+    config.frame.type                          = IfxCan_FrameType_transmitAndReceive;
+    config.frame.mode                          = IfxCan_FrameMode_fdLongAndFast;
+    config.baudRate.baudrate                   = OS_ISOTP_CAN_BAUDRATE;
+    config.fastBaudRate.baudrate               = OS_ISOTP_CAN_FAST_BAUDRATE;
+    config.calculateBitTimingValues            = TRUE;
+
+    config.txConfig.txMode                     = IfxCan_TxMode_fifo;
+    config.txConfig.dedicatedTxBuffersNumber   = 0;
+    config.txConfig.txFifoQueueSize            = OS_ISOTP_CAN_TX_FIFO_SIZE;
+    config.txConfig.txBufferDataFieldSize      = IfxCan_DataFieldSize_64;
+
+    config.rxConfig.rxMode                     = IfxCan_RxMode_fifo0;
+    config.rxConfig.rxFifo0DataFieldSize       = IfxCan_DataFieldSize_64;
+    config.rxConfig.rxFifo0OperatingMode       = IfxCan_RxFifoMode_blocking;
+    config.rxConfig.rxFifo0Size                = OS_ISOTP_CAN_RX_FIFO_SIZE;
+
+    /* Only the identifiers of the sessions are received. */
+    config.filterConfig.messageIdLength                    = IfxCan_MessageIdLength_both;
+    config.filterConfig.standardListSize                   = (uint8)standardFilters;
+    config.filterConfig.extendedListSize                   = (uint8)extendedFilters;
+    config.filterConfig.rejectRemoteFramesWithStandardId   = TRUE;
+    config.filterConfig.rejectRemoteFramesWithExtendedId   = TRUE;
+    config.filterConfig.standardFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_reject;
+    config.filterConfig.extendedFilterForNonMatchingFrames = IfxCan_NonMatchingFrame_reject;
+
+    config.messageRAM.baseAddress                    = (uint32)&MODULE_CAN0;
+    config.messageRAM.standardFilterListStartAddress = OS_ISOTP_CAN_STANDARD_FILTERS;
+    config.messageRAM.extendedFilterListStartAddress = OS_ISOTP_CAN_EXTENDED_FILTERS;
+    config.messageRAM.rxFifo0StartAddress            = OS_ISOTP_CAN_RX_FIFO0;
+    config.messageRAM.rxFifo1StartAddress            = OS_ISOTP_CAN_UNUSED;
+    config.messageRAM.rxBuffersStartAddress          = OS_ISOTP_CAN_UNUSED;
+    config.messageRAM.txEventFifoStartAddress        = OS_ISOTP_CAN_UNUSED;
+    config.messageRAM.txBuffersStartAddress          = OS_ISOTP_CAN_TX_BUFFERS;
+
+    config.interruptConfig.rxFifo0NewMessageEnabled    = TRUE;
+    config.interruptConfig.rxf0n.interruptLine         = IfxCan_InterruptLine_0;
+    config.interruptConfig.rxf0n.priority              = OS_ISOTP_CAN_ISR_PRIORITY_RX;
+    config.interruptConfig.rxf0n.typeOfService         = IfxSrc_Tos_cpu0;
+
+    IfxCan_Can_initNode(&os_isotp_can_node, &config);
+
+    standardFilters = 0;
+    extendedFilters = 0;
+
+    for (index = 0; index < os_isotp_can.numSessions; index++)
+    {
+        uint32 rxId = os_isotp_can.sessions[index].config->rxId;
+
+        filter.elementConfiguration = IfxCan_FilterElementConfiguration_storeInRxFifo0;
+        filter.type                 = IfxCan_FilterType_classic;
+        filter.id1                  = rxId & OS_ISOTP_ID_MASK;
+        filter.rxBufferOffset       = IfxCan_RxBufferId_0;
+
+        if ((rxId & OS_ISOTP_ID_EXTENDED) != 0)
+        {
+            filter.number = (uint8)extendedFilters++;
+            filter.id2    = OS_ISOTP_ID_MASK;
+            IfxCan_Can_setExtendedFilter(&os_isotp_can_node, &filter);
+        }
+        else
+        {
+            filter.number = (uint8)standardFilters++;
+            filter.id2    = 0x7FFU;
+            IfxCan_Can_setStandardFilter(&os_isotp_can_node, &filter);
+        }
+    }
+}
+
+sint32 os_isotp_can_open(const OsIsoTp_SessionConfig *config)
+{
+    return os_isotp_open(&os_isotp_can, config);
+}
+
+OsIsoTp_Result os_isotp_can_send(uint32 session, const uint8 *data, uint32 length)
+{
+    return os_isotp_send(&os_isotp_can, session, data, length);
+}
+
+boolean os_isotp_can_setRxBuffer(uint32 session, uint8 *buffer, uint32 size)
+{
+    return os_isotp_setRxBuffer(&os_isotp_can, session, buffer, size);
+}
+
+void os_isotp_can_task(void *arg)
+{
+    (void)arg;
+
+    os_isotp_can_taskHandle = xTaskGetCurrentTaskHandle();
+    os_isotp_can_ticksPerUs = (uint32)IfxStm_getFrequency(&MODULE_STM0) / 1000000U;
+    os_isotp_can_initNode();
+    os_isotp_start(&os_isotp_can, &os_isotp_can_driver);
+
+    while (1)
+    {
+        /* Idle sessions have no timers, the task sleeps until a frame
+         * arrives. */
+        (void)ulTaskNotifyTake(pdTRUE, (os_isotp_isBusy(&os_isotp_can) != FALSE) ? pdMS_TO_TICKS(OS_ISOTP_CAN_POLL_MS) : portMAX_DELAY);
+
+        os_isotp_can_receive();
+        os_isotp_poll(&os_isotp_can);
+    }
+}
+
+void os_isotp_can_isrReceive(void)
+{
+    IfxCan_Node_clearInterruptFlag(os_isotp_can_node.node, IfxCan_Interrupt_rxFifo0NewMessage);
+
+    /* The port cannot switch tasks from a handler called by the vector, the
+     * ISO-TP task runs at the next tick or when the running task blocks. */
+    vTaskNotifyGiveFromISR(os_isotp_can_taskHandle, NULL);
+}
+
+void os_isotp_can_getStatus(OsIsoTp_Status *status)
+{
+    os_isotp_getStatus(&os_isotp_can, status);
+}
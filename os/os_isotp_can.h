@@ -0,0 +1,82 @@
+#ifndef OS_ISOTP_CAN_H
+#define OS_ISOTP_CAN_H
+
+/* CAN FD driver of the ISO-TP engine, see os_isotp.h.
+ *
+ * One MCMCAN node runs in CAN FD mode with bit rate switching.  Frames of
+ * sessions with a frameLength above 8 are sent as CAN FD frames, the others
+ * as classic frames.  The node receives the rxId of every session into Rx
+ * FIFO 0, whose elements the engine reassembles from in place, and sends from
+ * the Tx FIFO, into whose elements the engine's frames are written directly.
+ * The message RAM layout takes the first 0x1300 bytes of the module, the other
+ * nodes of the module must be placed above.
+ *
+ * The sessions are opened with os_isotp_can_open() before the scheduler
+ * starts.  Their callbacks run in the ISO-TP task, and send the answers with
+ * os_isotp_can_send(): a UDS server runs its services in the received
+ * callback, or hands the buffer to a task of its own and answers from the next
+ * callback. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include "os_isotp.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef OS_ISOTP_CAN_BAUDRATE
+#define OS_ISOTP_CAN_BAUDRATE            (500000)   /* bit/s of the arbitration phase        */
+#endif
+
+#ifndef OS_ISOTP_CAN_FAST_BAUDRATE
+#define OS_ISOTP_CAN_FAST_BAUDRATE       (2000000)  /* bit/s of the data phase               */
+#endif
+
+/* Elements of Rx FIFO 0 and the Tx FIFO, at most 64 and 32.  A receiver with
+ * a blockSize no larger than OS_ISOTP_CAN_RX_FIFO_SIZE cannot lose a frame of
+ * a block however late its task runs. */
+#ifndef OS_ISOTP_CAN_RX_FIFO_SIZE
+#define OS_ISOTP_CAN_RX_FIFO_SIZE        (32)
+#endif
+
+#ifndef OS_ISOTP_CAN_TX_FIFO_SIZE
+#define OS_ISOTP_CAN_TX_FIFO_SIZE        (32)
+#endif
+
+#ifndef OS_ISOTP_CAN_POLL_MS
+#define OS_ISOTP_CAN_POLL_MS             (1)      /* Longest sleep of the task while busy      */
+#endif
+
+/* Interrupt priority of the Rx FIFO 0 new message interrupt on core 0, it
+ * must match os_system.json. */
+#define OS_ISOTP_CAN_ISR_PRIORITY_RX     (15)
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Adds a session, see os_isotp_open().  Called before the scheduler starts. */
+extern sint32 os_isotp_can_open(const OsIsoTp_SessionConfig *config);
+
+/* See os_isotp_send(), called by the ISO-TP task, that is from the callbacks. */
+extern OsIsoTp_Result os_isotp_can_send(uint32 session, const uint8 *data, uint32 length);
+
+/* See os_isotp_setRxBuffer(), called before the scheduler starts or from the
+ * callbacks. */
+extern boolean os_isotp_can_setRxBuffer(uint32 session, uint8 *buffer, uint32 size);
+
+/* ISO-TP task, created on core 0 from os_system.json.  It initialises the
+ * node, then receives whenever a frame arrives and polls the timers every
+ * OS_ISOTP_CAN_POLL_MS while a message is in flight. */
+extern void os_isotp_can_task(void *arg);
+
+/* Rx FIFO 0 interrupt handler, registered in os_system.json. */
+extern void os_isotp_can_isrReceive(void);
+
+/* Copies the statistics of the engine. */
+extern void os_isotp_can_getStatus(OsIsoTp_Status *status);
+
+#endif /* OS_ISOTP_CAN_H */
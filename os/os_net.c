@@ -0,0 +1,696 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "os_net.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_NET_DISPATCH_MASK             (OS_NET_DISPATCH_SIZE - 1)
+
+#if ((OS_NET_DISPATCH_SIZE & OS_NET_DISPATCH_MASK) != 0)
+#error OS_NET_DISPATCH_SIZE must be a power of two
+#endif
+
+/* Frame layout, offsets from the start of the Ethernet header. */
+#define OS_NET_ETH_DESTINATION           (0)
+#define OS_NET_ETH_SOURCE                (6)
+#define OS_NET_ETH_TYPE                  (12)
+#define OS_NET_ETH_HEADER_SIZE           (14)
+#define OS_NET_IP_START                  (OS_NET_ETH_HEADER_SIZE)
+#define OS_NET_IP_HEADER_SIZE            (20)
+#define OS_NET_UDP_SIZE                  (8)
+
+#define OS_NET_ETHERTYPE_IP              (0x0800U)
+#define OS_NET_ETHERTYPE_ARP             (0x0806U)
+#define OS_NET_PROTOCOL_ICMP             (1U)
+#define OS_NET_PROTOCOL_UDP              (17U)
+#define OS_NET_IP_DONT_FRAGMENT          (0x4000U)
+#define OS_NET_IP_FRAGMENT_MASK          (0x3FFFU)    /* More fragments and offset */
+#define OS_NET_IP_TTL                    (64U)
+#define OS_NET_ICMP_ECHO_REPLY           (0U)
+#define OS_NET_ICMP_ECHO_REQUEST         (8U)
+#define OS_NET_ARP_REQUEST               (1U)
+#define OS_NET_ARP_REPLY                 (2U)
+#define OS_NET_ARP_SIZE                  (28)
+#define OS_NET_BROADCAST                 (0xFFFFFFFFUL)
+
+/* A peer.  Only the receiving core changes resolved entries; the senders on
+ * the other cores read them under the sequence count, which is odd while an
+ * entry is being written. */
+typedef struct
+{
+    volatile uint32 sequence;
+    uint32          ip;              /* 0 if the entry is free                   */
+    uint8           mac[6];
+    boolean         isStatic;
+} OsNet_Peer;
+
+typedef struct
+{
+    uint16        port;
+    uint32        coreId;
+    OsNet_Receive receive;
+    void         *arg;
+} OsNet_Port;
+
+/* A datagram held in its receive buffer until the core of its port runs the
+ * callback. */
+typedef struct
+{
+    uint8            *frame;
+    const OsNet_Port *binding;
+    OsNet_Datagram    datagram;
+} OsNet_Delivery;
+
+/* Datagrams for one core.  The receiving core is the only writer of head, the
+ * core of the queue the only writer of tail. */
+typedef struct
+{
+    volatile uint32 head;
+    volatile uint32 tail;
+    OsNet_Delivery  items[OS_NET_DISPATCH_SIZE];
+} OsNet_Queue;
+
+static OsNet_Config        os_net_config;
+static const OsNet_Driver *os_net_driver;
+static OsNet_Peer          os_net_peers[OS_NET_ARP_ENTRIES];
+static uint32              os_net_nextVictim;
+static OsNet_Port          os_net_ports[OS_NET_MAX_PORTS];
+static uint32              os_net_portCount;
+static OsNet_Queue         os_net_queues[configNUM_CORES];
+static OsNet_Status        os_net_status[configNUM_CORES];
+
+static const uint8         os_net_broadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Headers are in network byte order and, behind the 14 byte Ethernet header,
+ * only 2 byte aligned: access them bytewise. */
+static uint16 os_net_get16(const uint8 *data)
+{
+    return (uint16)(((uint16)data[0] << 8) | data[1]);
+}
+
+static uint32 os_net_get32(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | (uint32)data[3];
+}
+
+static void os_net_put16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)(value >> 8);
+    data[1] = (uint8)value;
+}
+
+static void os_net_put32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)(value >> 24);
+    data[1] = (uint8)(value >> 16);
+    data[2] = (uint8)(value >> 8);
+    data[3] = (uint8)value;
+}
+
+/* Ones' complement sum of length bytes, added to sum. */
+static uint32 os_net_sum(const uint8 *data, uint32 length, uint32 sum)
+{
+    uint32 index;
+
+    for (index = 0; (index + 1) < length; index += 2)
+    {
+        sum += ((uint32)data[index] << 8) | data[index + 1];
+    }
+
+    if ((length & 1U) != 0)
+    {
+        sum += (uint32)data[length - 1] << 8;
+    }
+
+    return sum;
+}
+
+static uint16 os_net_fold(uint32 sum)
+{
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+
+    return (uint16)~sum;
+}
+
+/* Checksum of a UDP datagram, pseudo header included. */
+static uint16 os_net_udpChecksum(const uint8 *ipHeader, const uint8 *udp, uint16 length)
+{
+    uint32 sum = os_net_sum(&ipHeader[12], 8, 0);   /* Source and destination */
+
+    sum += OS_NET_PROTOCOL_UDP + (uint32)length;
+
+    return os_net_fold(os_net_sum(udp, length, sum));
+}
+
+static boolean os_net_isLocal(uint32 ip)
+{
+    return (boolean)(((ip ^ os_net_config.ip) & os_net_config.netmask) == 0);
+}
+
+/* Copies the MAC address of ip, returns FALSE if ip is not known. */
+static boolean os_net_lookup(uint32 ip, uint8 *mac)
+{
+    uint32  index;
+    boolean found = FALSE;
+
+    for (index = 0; (index < OS_NET_ARP_ENTRIES) && (found == FALSE); index++)
+    {
+        const OsNet_Peer *peer = &os_net_peers[index];
+        uint32            sequence;
+        uint32            entryIp;
+
+        do
+        {
+            sequence = peer->sequence;
+            portMEMORY_BARRIER();
+            entryIp  = peer->ip;
+            memcpy(mac, peer->mac, 6);
+            portMEMORY_BARRIER();
+        } while (((sequence & 1U) != 0) || (sequence != peer->sequence));
+
+        found = (boolean)((entryIp == ip) && (ip != 0));
+    }
+
+    return found;
+}
+
+/* Records ip at mac.  A new peer replaces the oldest resolved one if insert
+ * is TRUE, otherwise only a known peer is updated.  Receiving core only. */
+static void os_net_learn(uint32 ip, const uint8 *mac, boolean insert)
+{
+    OsNet_Peer *peer = NULL_PTR;
+    uint32      index;
+
+    for (index = 0; (index < OS_NET_ARP_ENTRIES) && (peer == NULL_PTR); index++)
+    {
+        if (os_net_peers[index].ip == ip)
+        {
+            peer = &os_net_peers[index];
+        }
+    }
+
+    for (index = 0; (index < OS_NET_ARP_ENTRIES) && (peer == NULL_PTR) && (insert != FALSE); index++)
+    {
+        OsNet_Peer *victim = &os_net_peers[os_net_nextVictim];
+
+        os_net_nextVictim = (os_net_nextVictim + 1) % OS_NET_ARP_ENTRIES;
+
+        if (victim->isStatic == FALSE)
+        {
+            peer = victim;
+        }
+    }
+
+    if ((peer != NULL_PTR) && (peer->isStatic == FALSE) && (ip != 0))
+    {
+        peer->sequence++;
+        portMEMORY_BARRIER();
+        peer->ip = ip;
+        memcpy(peer->mac, mac, 6);
+        portMEMORY_BARRIER();
+        peer->sequence++;
+    }
+}
+
+static void os_net_writeEthernet(uint8 *frame, const uint8 *destination, uint16 type)
+{
+    memcpy(&frame[OS_NET_ETH_DESTINATION], destination, 6);
+    memcpy(&frame[OS_NET_ETH_SOURCE], os_net_config.mac, 6);
+    os_net_put16(&frame[OS_NET_ETH_TYPE], type);
+}
+
+/* Writes an IPv4 header without options for a payload of length bytes. */
+static void os_net_writeIp(uint8 *ip, uint8 protocol, uint32 destination, uint16 length)
+{
+    ip[0] = 0x45;                                          /* Version 4, 20 bytes */
+    ip[1] = 0;
+    os_net_put16(&ip[2], (uint16)(OS_NET_IP_HEADER_SIZE + length));
+    os_net_put16(&ip[4], 0);                               /* ID, RFC 6864 with DF */
+    os_net_put16(&ip[6], OS_NET_IP_DONT_FRAGMENT);
+    ip[8] = OS_NET_IP_TTL;
+    ip[9] = protocol;
+    os_net_put16(&ip[10], 0);
+    os_net_put32(&ip[12], os_net_config.ip);
+    os_net_put32(&ip[16], destination);
+
+    if (os_net_driver->txChecksumOffload == FALSE)
+    {
+        os_net_put16(&ip[10], os_net_fold(os_net_sum(ip, OS_NET_IP_HEADER_SIZE, 0)));
+    }
+}
+
+static boolean os_net_sendFrame(uint8 *frame, uint32 length, uint32 flags)
+{
+    OsNet_Status *status = &os_net_status[portGET_CORE_ID()];
+    boolean       result = os_net_driver->send(os_net_driver->context, frame, length, flags);
+
+    if (result != FALSE)
+    {
+        status->txFrames++;
+    }
+
+    return result;
+}
+
+/* Sends an ARP packet from the buffer frame. */
+static void os_net_sendArp(uint8 *frame, uint16 operation, const uint8 *mac, uint32 ip)
+{
+    uint8 *arp = &frame[OS_NET_ETH_HEADER_SIZE];
+
+    os_net_writeEthernet(frame, (operation == OS_NET_ARP_REQUEST) ? os_net_broadcastMac : mac, OS_NET_ETHERTYPE_ARP);
+    os_net_put16(&arp[0], 1);                              /* Ethernet */
+    os_net_put16(&arp[2], OS_NET_ETHERTYPE_IP);
+    arp[4] = 6;
+    arp[5] = 4;
+    os_net_put16(&arp[6], operation);
+    memcpy(&arp[8], os_net_config.mac, 6);
+    os_net_put32(&arp[14], os_net_config.ip);
+    memcpy(&arp[18], (operation == OS_NET_ARP_REQUEST) ? os_net_broadcastMac : mac, 6);
+    os_net_put32(&arp[24], ip);
+
+    (void)os_net_sendFrame(frame, OS_NET_ETH_HEADER_SIZE + OS_NET_ARP_SIZE, 0);
+}
+
+static void os_net_receiveArp(const uint8 *frame, uint32 length)
+{
+    const uint8 *arp = &frame[OS_NET_ETH_HEADER_SIZE];
+
+    if ((length >= (OS_NET_ETH_HEADER_SIZE + OS_NET_ARP_SIZE)) && (os_net_get16(&arp[0]) == 1)
+        && (os_net_get16(&arp[2]) == OS_NET_ETHERTYPE_IP) && (arp[4] == 6) && (arp[5] == 4))
+    {
+        uint16  operation = os_net_get16(&arp[6]);
+        uint32  sender    = os_net_get32(&arp[14]);
+        boolean forUs     = (boolean)(os_net_get32(&arp[24]) == os_net_config.ip);
+
+        /* RFC 826: update a known sender, add it if the packet is for us. */
+        os_net_learn(sender, &arp[8], forUs);
+
+        if ((forUs != FALSE) && (operation == OS_NET_ARP_REQUEST))
+        {
+            uint8 *reply = os_net_driver->getTxBuffer(os_net_driver->context);
+
+            if (reply != NULL_PTR)
+            {
+                uint8 mac[6];
+
+                memcpy(mac, &arp[8], 6);
+                os_net_sendArp(reply, OS_NET_ARP_REPLY, mac, sender);
+            }
+        }
+    }
+}
+
+/* Answers an ICMP echo request.  The reply is a copy, echo is not a data
+ * path. */
+static void os_net_receiveEcho(const uint8 *frame, const uint8 *ip, const uint8 *icmp, uint16 icmpLength)
+{
+    uint8 *reply = os_net_driver->getTxBuffer(os_net_driver->context);
+
+    if (reply != NULL_PTR)
+    {
+        uint8 *replyIcmp = &reply[OS_NET_ETH_HEADER_SIZE + OS_NET_IP_HEADER_SIZE];
+
+        os_net_writeEthernet(reply, &frame[OS_NET_ETH_SOURCE], OS_NET_ETHERTYPE_IP);
+        os_net_writeIp(&reply[OS_NET_IP_START], OS_NET_PROTOCOL_ICMP, os_net_get32(&ip[12]), icmpLength);
+        memcpy(replyIcmp, icmp, icmpLength);
+        replyIcmp[0] = OS_NET_ICMP_ECHO_REPLY;
+        os_net_put16(&replyIcmp[2], 0);
+        os_net_put16(&replyIcmp[2], os_net_fold(os_net_sum(replyIcmp, icmpLength, 0)));
+
+        (void)os_net_sendFrame(reply, (uint32)(OS_NET_ETH_HEADER_SIZE + OS_NET_IP_HEADER_SIZE + icmpLength), 0);
+    }
+}
+
+/* Passes a datagram to its port.  Returns TRUE if it was queued for another
+ * core, which then owns the frame. */
+static boolean os_net_deliver(uint8 *frame, const OsNet_Datagram *datagram)
+{
+    uint32            coreId  = portGET_CORE_ID();
+    const OsNet_Port *binding = NULL_PTR;
+    boolean           queued  = FALSE;
+    uint32            index;
+
+    for (index = 0; (index < os_net_portCount) && (binding == NULL_PTR); index++)
+    {
+        if (os_net_ports[index].port == datagram->port)
+        {
+            binding = &os_net_ports[index];
+        }
+    }
+
+    if (binding == NULL_PTR)
+    {
+        os_net_status[coreId].rxDropped++;
+    }
+    else if (binding->coreId == coreId)
+    {
+        binding->receive(binding->arg, datagram);
+        os_net_status[coreId].rxDatagrams++;
+    }
+    else
+    {
+        OsNet_Queue *queue = &os_net_queues[binding->coreId];
+        uint32       head  = queue->head;
+
+        if ((head - queue->tail) >= OS_NET_DISPATCH_SIZE)
+        {
+            os_net_status[binding->coreId].dispatchOverruns++;
+        }
+        else
+        {
+            OsNet_Delivery *item = &queue->items[head & OS_NET_DISPATCH_MASK];
+
+            item->frame    = frame;
+            item->binding  = binding;
+            item->datagram = *datagram;
+
+            /* The item must be in memory before the head that hands it over. */
+            portMEMORY_BARRIER();
+            queue->head = head + 1;
+            queued      = TRUE;
+        }
+    }
+
+    return queued;
+}
+
+/* Handles an IPv4 packet, returns TRUE if the frame was queued for another
+ * core. */
+static boolean os_net_receiveIp(uint8 *frame, uint32 length, uint32 flags, uint64 timestamp)
+{
+    OsNet_Status *status       = &os_net_status[portGET_CORE_ID()];
+    const uint8  *ip           = &frame[OS_NET_IP_START];
+    uint32        headerLength = (uint32)(ip[0] & 0x0FU) * 4U;
+    uint32        totalLength  = os_net_get16(&ip[2]);
+    uint32        destination  = os_net_get32(&ip[16]);
+    boolean       verified     = (boolean)((flags & OS_NET_RX_CHECKSUM_VERIFIED) != 0);
+    boolean       queued       = FALSE;
+
+    /* The receive buffers hold a full frame, the header fields can be read
+     * before the length is checked. */
+    if ((length < (OS_NET_ETH_HEADER_SIZE + OS_NET_IP_HEADER_SIZE)) || ((ip[0] >> 4) != 4) || (headerLength < OS_NET_IP_HEADER_SIZE) || (totalLength < headerLength)
+        || ((OS_NET_ETH_HEADER_SIZE + totalLength) > length) || ((os_net_get16(&ip[6]) & OS_NET_IP_FRAGMENT_MASK) != 0)
+        || ((destination != os_net_config.ip) && (destination != OS_NET_BROADCAST)
+            && (destination != (os_net_config.ip | ~os_net_config.netmask))))
+    {
+        status->rxDropped++;
+    }
+    else if ((verified == FALSE) && (os_net_fold(os_net_sum(ip, headerLength, 0)) != 0))
+    {
+        status->rxChecksumErrors++;
+    }
+    else
+    {
+        uint8 *data       = &frame[OS_NET_IP_START + headerLength];
+        uint16 dataLength = (uint16)(totalLength - headerLength);
+
+        if (ip[9] == OS_NET_PROTOCOL_UDP)
+        {
+            uint16 udpLength = (dataLength >= OS_NET_UDP_SIZE) ? os_net_get16(&data[4]) : 0;
+
+            if ((udpLength < OS_NET_UDP_SIZE) || (udpLength > dataLength))
+            {
+                status->rxDropped++;
+            }
+            else if ((verified == FALSE) && (os_net_get16(&data[6]) != 0) && (os_net_udpChecksum(ip, data, udpLength) != 0))
+            {
+                status->rxChecksumErrors++;
+            }
+            else
+            {
+                OsNet_Datagram datagram;
+
+                datagram.payload    = &data[OS_NET_UDP_SIZE];
+                datagram.length     = (uint16)(udpLength - OS_NET_UDP_SIZE);
+                datagram.port       = os_net_get16(&data[2]);
+                datagram.sourceIp   = os_net_get32(&ip[12]);
+                datagram.sourcePort = os_net_get16(&data[0]);
+                datagram.timestamp  = ((flags & OS_NET_RX_TIMESTAMP) != 0) ? timestamp : 0;
+                queued              = os_net_deliver(frame, &datagram);
+            }
+        }
+        else if ((ip[9] == OS_NET_PROTOCOL_ICMP) && (dataLength >= 8) && (data[0] == OS_NET_ICMP_ECHO_REQUEST)
+                 && (destination == os_net_config.ip))
+        {
+            if ((verified == FALSE) && (os_net_fold(os_net_sum(data, dataLength, 0)) != 0))
+            {
+                status->rxChecksumErrors++;
+            }
+            else
+            {
+                os_net_receiveEcho(frame, ip, data, dataLength);
+            }
+        }
+        else
+        {
+            status->rxDropped++;
+        }
+    }
+
+    return queued;
+}
+
+void os_net_init(const OsNet_Config *config, const OsNet_Driver *driver)
+{
+    os_net_config = *config;
+
+    /* The other cores start sending once they see the driver. */
+    portMEMORY_BARRIER();
+    os_net_driver = driver;
+}
+
+boolean os_net_bind(uint16 port, uint32 coreId, OsNet_Receive receive, void *arg)
+{
+    boolean result = (boolean)((os_net_portCount < OS_NET_MAX_PORTS) && (coreId < configNUM_CORES));
+    uint32  index;
+
+    for (index = 0; (index < os_net_portCount) && (result != FALSE); index++)
+    {
+        result = (boolean)(os_net_ports[index].port != port);
+    }
+
+    if (result != FALSE)
+    {
+        OsNet_Port *binding = &os_net_ports[os_net_portCount];
+
+        binding->port     = port;
+        binding->coreId   = coreId;
+        binding->receive  = receive;
+        binding->arg      = arg;
+        os_net_portCount++;
+    }
+
+    return result;
+}
+
+boolean os_net_addPeer(uint32 ip, const uint8 *mac)
+{
+    boolean result = FALSE;
+    uint32  index;
+
+    for (index = 0; (index < OS_NET_ARP_ENTRIES) && (result == FALSE); index++)
+    {
+        OsNet_Peer *peer = &os_net_peers[index];
+
+        if (peer->ip == 0)
+        {
+            peer->ip       = ip;
+            memcpy(peer->mac, mac, 6);
+            peer->isStatic = TRUE;
+            result         = TRUE;
+        }
+    }
+
+    return result;
+}
+
+uint32 os_net_poll(uint32 budget)
+{
+    OsNet_Status *status    = &os_net_status[portGET_CORE_ID()];
+    uint32        count     = 0;
+    uint8        *frame     = NULL_PTR;
+    uint32        length    = 0;
+    uint32        flags     = 0;
+    uint64        timestamp = 0;
+    boolean       queued;
+
+    if (budget != 0)
+    {
+        frame = os_net_driver->receive(os_net_driver->context, &length, &flags, &timestamp);
+    }
+
+    while (frame != NULL_PTR)
+    {
+        queued = FALSE;
+        status->rxFrames++;
+        count++;
+
+        if (length < OS_NET_ETH_HEADER_SIZE)
+        {
+            status->rxDropped++;
+        }
+        else if (os_net_get16(&frame[OS_NET_ETH_TYPE]) == OS_NET_ETHERTYPE_IP)
+        {
+            queued = os_net_receiveIp(frame, length, flags, timestamp);
+        }
+        else if (os_net_get16(&frame[OS_NET_ETH_TYPE]) == OS_NET_ETHERTYPE_ARP)
+        {
+            os_net_receiveArp(frame, length);
+        }
+        else
+        {
+            status->rxDropped++;
+        }
+
+        if (queued == FALSE)
+        {
+            os_net_driver->release(os_net_driver->context, frame);
+        }
+
+        frame = NULL_PTR;
+        flags = 0;
+
+        if (count < budget)
+        {
+            frame = os_net_driver->receive(os_net_driver->context, &length, &flags, &timestamp);
+        }
+    }
+
+    return count;
+}
+
+uint32 os_net_dispatch(void)
+{
+    uint32       coreId = portGET_CORE_ID();
+    OsNet_Queue *queue  = &os_net_queues[coreId];
+    uint32       tail   = queue->tail;
+    uint32       count  = 0;
+
+    while (tail != queue->head)
+    {
+        OsNet_Delivery *item = &queue->items[tail & OS_NET_DISPATCH_MASK];
+
+        /* Read the head before the item it publishes. */
+        portMEMORY_BARRIER();
+
+        item->binding->receive(item->binding->arg, &item->datagram);
+        os_net_driver->release(os_net_driver->context, item->frame);
+        os_net_status[coreId].rxDatagrams++;
+
+        portMEMORY_BARRIER();
+        tail++;
+        queue->tail = tail;
+        count++;
+    }
+
+    return count;
+}
+
+uint8 *os_net_udpGetBuffer(void)
+{
+    const OsNet_Driver *driver = os_net_driver;
+    uint8              *frame  = (driver != NULL_PTR) ? driver->getTxBuffer(driver->context) : NULL_PTR;
+
+    return (frame != NULL_PTR) ? &frame[OS_NET_UDP_HEADER_SIZE] : NULL_PTR;
+}
+
+/* Sends a datagram, see os_net_udpSend().  flags are passed to the driver. */
+static OsNet_Result os_net_udpSendFrame(uint8 *payload, uint16 length, uint16 sourcePort, uint32 ip, uint16 port, uint32 flags)
+{
+    uint8        *frame   = payload - OS_NET_UDP_HEADER_SIZE;
+    uint8        *udp     = &frame[OS_NET_IP_START + OS_NET_IP_HEADER_SIZE];
+    uint32        nextHop = ((os_net_isLocal(ip) != FALSE) || (os_net_config.gateway == 0)) ? ip : os_net_config.gateway;
+    uint8         mac[6];
+    OsNet_Result  result  = OsNet_Result_ok;
+
+    if (length > OS_NET_UDP_PAYLOAD_MAX)
+    {
+        result = OsNet_Result_tooLong;
+    }
+    else if ((ip == OS_NET_BROADCAST) || (ip == (os_net_config.ip | ~os_net_config.netmask)))
+    {
+        memcpy(mac, os_net_broadcastMac, 6);
+    }
+    else if (os_net_lookup(nextHop, mac) == FALSE)
+    {
+        /* The buffer is used for the request, the payload is lost. */
+        os_net_sendArp(frame, OS_NET_ARP_REQUEST, os_net_broadcastMac, nextHop);
+        result = OsNet_Result_unresolved;
+    }
+    else
+    {}
+
+    if (result == OsNet_Result_ok)
+    {
+        uint16 udpLength = (uint16)(OS_NET_UDP_SIZE + length);
+
+        os_net_writeEthernet(frame, mac, OS_NET_ETHERTYPE_IP);
+        os_net_writeIp(&frame[OS_NET_IP_START], OS_NET_PROTOCOL_UDP, ip, udpLength);
+        os_net_put16(&udp[0], sourcePort);
+        os_net_put16(&udp[2], port);
+        os_net_put16(&udp[4], udpLength);
+        os_net_put16(&udp[6], 0);
+
+        if (os_net_driver->txChecksumOffload == FALSE)
+        {
+            uint16 checksum = os_net_udpChecksum(&frame[OS_NET_IP_START], udp, udpLength);
+
+            os_net_put16(&udp[6], (checksum != 0) ? checksum : 0xFFFFU);
+        }
+
+        if (os_net_sendFrame(frame, (uint32)(OS_NET_UDP_HEADER_SIZE + length), flags) == FALSE)
+        {
+            result = OsNet_Result_noBuffer;
+        }
+    }
+
+    if (result != OsNet_Result_ok)
+    {
+        os_net_status[portGET_CORE_ID()].txFailed++;
+    }
+
+    return result;
+}
+
+OsNet_Result os_net_udpSend(uint8 *payload, uint16 length, uint16 sourcePort, uint32 ip, uint16 port)
+{
+    return os_net_udpSendFrame(payload, length, sourcePort, ip, port, 0);
+}
+
+OsNet_Result os_net_udpSendTimestamped(uint8 *payload, uint16 length, uint16 sourcePort, uint32 ip, uint16 port)
+{
+    return os_net_udpSendFrame(payload, length, sourcePort, ip, port, OS_NET_TX_TIMESTAMP);
+}
+
+boolean os_net_getTxTimestamp(uint64 *timestamp)
+{
+    const OsNet_Driver *driver = os_net_driver;
+
+    return ((driver != NULL_PTR) && (driver->getTxTimestamp != NULL_PTR)) ? driver->getTxTimestamp(driver->context, timestamp) : FALSE;
+}
+
+boolean os_net_getStatus(uint32 coreId, OsNet_Status *status)
+{
+    boolean result = FALSE;
+
+    if (coreId < configNUM_CORES)
+    {
+        *status = os_net_status[coreId];
+        result  = TRUE;
+    }
+
+    return result;
+}
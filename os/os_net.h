@@ -0,0 +1,191 @@
+#ifndef OS_NET_H
+#define OS_NET_H
+
+/* Minimal UDP/IPv4 stack with ARP and ICMP echo.
+ *
+ * The stack works on the frame buffers of the Ethernet driver and never copies
+ * UDP payload: received datagrams are handed to the port callbacks in the
+ * receive buffer, and datagrams are sent by writing the payload straight into
+ * a transmit buffer (os_net_udpGetBuffer()) in front of which os_net_udpSend()
+ * builds the headers.  The driver is reached through OsNet_Driver, see
+ * os_net_geth.c for GETH and tools/net_tap/ for a Linux TAP stand-in.
+ *
+ * One core receives: it calls os_net_poll(), which answers ARP and ICMP echo
+ * requests and passes datagrams to the callback of their port.  The callback
+ * of a port bound to another core runs on that core, from os_net_dispatch(),
+ * so every core with bound ports must call os_net_dispatch() periodically.
+ * Any core the driver gives a transmit buffer to may send; the tasks of a core
+ * share its buffer and must not preempt each other between
+ * os_net_udpGetBuffer() and os_net_udpSend().
+ *
+ * Not supported: IP fragments, IP options on transmit, VLAN tags, multicast
+ * and more than one interface. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef OS_NET_MAX_PORTS
+#define OS_NET_MAX_PORTS                 (8)      /* UDP ports that can be bound              */
+#endif
+
+#ifndef OS_NET_ARP_ENTRIES
+#define OS_NET_ARP_ENTRIES               (8)      /* Peers, static and resolved               */
+#endif
+
+#ifndef OS_NET_DISPATCH_SIZE
+#define OS_NET_DISPATCH_SIZE             (8)      /* Datagrams queued per core, a power of two */
+#endif
+
+/* Largest frame without FCS, and the headers in front of a UDP payload. */
+#define OS_NET_FRAME_SIZE                (1514)
+#define OS_NET_UDP_HEADER_SIZE           (14 + 20 + 8)
+#define OS_NET_UDP_PAYLOAD_MAX           (OS_NET_FRAME_SIZE - OS_NET_UDP_HEADER_SIZE)
+
+/* Flag of OsNet_Driver.receive(): the IPv4 header and the UDP or ICMP checksum
+ * of the frame have been verified by the hardware. */
+#define OS_NET_RX_CHECKSUM_VERIFIED      (0x1U)
+
+/* Flag of OsNet_Driver.receive(): the timestamp of the frame is valid. */
+#define OS_NET_RX_TIMESTAMP              (0x2U)
+
+/* Flag of OsNet_Driver.send(): the driver records when the frame leaves, see
+ * getTxTimestamp(). */
+#define OS_NET_TX_TIMESTAMP              (0x1U)
+
+/* IPv4 address in host byte order, e.g. OS_NET_IP(192, 168, 0, 2). */
+#define OS_NET_IP(a, b, c, d)            (((uint32)(a) << 24) | ((uint32)(b) << 16) | ((uint32)(c) << 8) | (uint32)(d))
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* Ethernet driver of the stack. */
+typedef struct
+{
+    void   *context;
+
+    /* Returns the next received frame, FCS excluded, or NULL_PTR.  Frames with
+     * errors are dropped by the driver.  Only called by the receiving core.
+     * With OS_NET_RX_TIMESTAMP set in flags, timestamp is the time the frame
+     * arrived in ns of the clock of the driver. */
+    uint8 *(*receive)(void *context, uint32 *length, uint32 *flags, uint64 *timestamp);
+
+    /* Returns a received frame to the driver.  Called on any core, and not
+     * necessarily in the order of reception. */
+    void (*release)(void *context, uint8 *frame);
+
+    /* Returns the free transmit buffer of the calling core, of at least
+     * OS_NET_FRAME_SIZE bytes, or NULL_PTR.  The same buffer is returned until
+     * it has been sent. */
+    uint8 *(*getTxBuffer)(void *context);
+
+    /* Sends the frame in the buffer returned by getTxBuffer() on the calling
+     * core.  flags may hold OS_NET_TX_TIMESTAMP. */
+    boolean (*send)(void *context, uint8 *frame, uint32 length, uint32 flags);
+
+    /* Returns FALSE until the last frame the calling core sent with
+     * OS_NET_TX_TIMESTAMP has left, then copies the time it did, in ns of the
+     * clock of the driver.  NULL_PTR if the driver has no timestamps. */
+    boolean (*getTxTimestamp)(void *context, uint64 *timestamp);
+
+    /* TRUE if the hardware fills in the IPv4 header and UDP checksums. */
+    boolean txChecksumOffload;
+} OsNet_Driver;
+
+/* Interface configuration, addresses in host byte order. */
+typedef struct
+{
+    uint8  mac[6];
+    uint32 ip;
+    uint32 netmask;
+    uint32 gateway;         /* 0 if there is none                                               */
+} OsNet_Config;
+
+/* A received datagram, valid until the callback returns. */
+typedef struct
+{
+    const uint8 *payload;
+    uint16       length;
+    uint16       port;           /* Destination port                                            */
+    uint32       sourceIp;
+    uint16       sourcePort;
+    uint64       timestamp;      /* ns of the driver clock the frame arrived at, 0 if unknown   */
+} OsNet_Datagram;
+
+typedef void (*OsNet_Receive)(void *arg, const OsNet_Datagram *datagram);
+
+typedef enum
+{
+    OsNet_Result_ok,
+    OsNet_Result_noBuffer,       /* No transmit buffer free on the calling core                 */
+    OsNet_Result_unresolved,     /* The peer is not known yet, an ARP request was sent          */
+    OsNet_Result_tooLong
+} OsNet_Result;
+
+/* Statistics of one core, see os_net_getStatus(). */
+typedef struct
+{
+    uint32 rxFrames;         /* Frames taken from the driver, receiving core only                 */
+    uint32 rxDatagrams;      /* Datagrams passed to the callbacks of the core                      */
+    uint32 rxDropped;        /* Frames not for us, malformed, or for an unbound port               */
+    uint32 rxChecksumErrors; /* Frames dropped for a software checksum mismatch                    */
+    uint32 dispatchOverruns; /* Datagrams for the core dropped because its queue was full          */
+    uint32 txFrames;         /* Frames sent by the core                                            */
+    uint32 txFailed;         /* Sends that did not return OsNet_Result_ok                          */
+} OsNet_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Starts the stack on the receiving core.  Ports and peers may be added
+ * before. */
+extern void os_net_init(const OsNet_Config *config, const OsNet_Driver *driver);
+
+/* Binds a UDP port to a callback that runs on core coreId (portGET_CORE_ID()
+ * numbering).  Called by one core during initialisation, before
+ * os_net_init().  Returns FALSE if the port is bound or the table is full. */
+extern boolean os_net_bind(uint16 port, uint32 coreId, OsNet_Receive receive, void *arg);
+
+/* Adds a peer that is never resolved or replaced.  Called like
+ * os_net_bind().  Returns FALSE if the table is full. */
+extern boolean os_net_addPeer(uint32 ip, const uint8 *mac);
+
+/* Processes up to budget received frames on the receiving core, returns the
+ * number processed. */
+extern uint32 os_net_poll(uint32 budget);
+
+/* Runs the callbacks of the datagrams queued for the calling core, returns
+ * their number. */
+extern uint32 os_net_dispatch(void);
+
+/* Returns where the payload of the next datagram of the calling core goes, or
+ * NULL_PTR before os_net_init() or if the driver has no transmit buffer free.
+ * Up to OS_NET_UDP_PAYLOAD_MAX bytes may be written. */
+extern uint8 *os_net_udpGetBuffer(void);
+
+/* Sends length bytes written at payload, which was returned by
+ * os_net_udpGetBuffer() on the calling core.  If the peer, or the gateway for
+ * a peer outside the subnet, is not known yet, the buffer is used for an ARP
+ * request instead and the payload is lost. */
+extern OsNet_Result os_net_udpSend(uint8 *payload, uint16 length, uint16 sourcePort, uint32 ip, uint16 port);
+
+/* As os_net_udpSend(), and has the driver record when the frame leaves, see
+ * os_net_getTxTimestamp(). */
+extern OsNet_Result os_net_udpSendTimestamped(uint8 *payload, uint16 length, uint16 sourcePort, uint32 ip, uint16 port);
+
+/* Returns FALSE until the last datagram the calling core sent with
+ * os_net_udpSendTimestamped() has left, and always if the driver has no
+ * timestamps; then copies the time it left in ns of the driver clock. */
+extern boolean os_net_getTxTimestamp(uint64 *timestamp);
+
+/* Returns FALSE if coreId is not a CPU core ID. */
+extern boolean os_net_getStatus(uint32 coreId, OsNet_Status *status);
+
+#endif /* OS_NET_H */
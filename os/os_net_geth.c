@@ -0,0 +1,715 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "IfxCpu.h"
+#include "IfxStm.h"
+#include "IfxScuCcu.h"
+#include "Geth/Eth/IfxGeth_Eth.h"
+#include "os_net_geth.h"
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_NET_GETH_BUFFER_SIZE          (1536)   /* A frame with FCS, a multiple of 4 */
+#define OS_NET_GETH_FCS_SIZE             (4)      /* The MAC does not strip the FCS    */
+#define OS_NET_GETH_RX_DESCRIPTORS       (IFXGETH_MAX_RX_DESCRIPTORS)
+#define OS_NET_GETH_TX_DESCRIPTORS       (IFXGETH_MAX_TX_DESCRIPTORS)
+
+/* RDES1.PT of the frames the MAC has verified the payload checksum of. */
+#define OS_NET_GETH_PAYLOAD_UDP          (1U)
+#define OS_NET_GETH_PAYLOAD_ICMP         (3U)
+
+/* Reads of a context descriptor the DMA has not written yet before the frame
+ * in front of it is left for the next poll. */
+#define OS_NET_GETH_CONTEXT_SPIN         (64)
+
+#define OS_NET_GETH_NS_PER_SECOND        (1000000000ULL)
+
+static const IfxGeth_Eth_RgmiiPins os_net_geth_pins = {
+    .txClk   = &IfxGeth_TXCLK_P11_4_OUT,
+    .txd0    = &IfxGeth_TXD0_P11_3_OUT,
+    .txd1    = &IfxGeth_TXD1_P11_2_OUT,
+    .txd2    = &IfxGeth_TXD2_P11_1_OUT,
+    .txd3    = &IfxGeth_TXD3_P11_0_OUT,
+    .txCtl   = &IfxGeth_TXCTL_P11_6_OUT,
+    .rxClk   = &IfxGeth_RXCLKA_P11_12_IN,
+    .rxd0    = &IfxGeth_RXD0A_P11_10_IN,
+    .rxd1    = &IfxGeth_RXD1A_P11_9_IN,
+    .rxd2    = &IfxGeth_RXD2A_P11_8_IN,
+    .rxd3    = &IfxGeth_RXD3A_P11_7_IN,
+    .rxCtl   = &IfxGeth_RXCTLA_P11_11_IN,
+    .mdc     = &IfxGeth_MDC_P12_0_OUT,
+    .mdio    = &IfxGeth_MDIO_P12_1_INOUT,
+    .grefClk = &IfxGeth_GREFCLK_P11_5_IN,
+};
+
+static const OsNet_Config os_net_geth_config = {
+    OS_NET_GETH_MAC_ADDRESS, OS_NET_GETH_IP_ADDRESS, OS_NET_GETH_NETMASK, OS_NET_GETH_GATEWAY
+};
+
+static const sint8        os_net_geth_txChannels[configNUM_CORES] = OS_NET_GETH_TX_CHANNEL_MAP;
+static const OsTsn_Config os_net_geth_tsnConfig = OS_NET_GETH_TSN_CONFIG;
+static const OsPtp_Config os_net_geth_ptpConfig = OS_NET_GETH_PTP_CONFIG;
+
+static IfxGeth_Eth        os_net_geth;
+static TaskHandle_t       os_net_geth_taskHandle;
+static OsNetGeth_Status   os_net_geth_status;
+
+/* Gate list, run on core 0 from comparator 1 of STM0.  Every entry lasts
+ * gateTicks, and cycles start phaseTicks after a multiple of cycleTicks. */
+static boolean            os_net_geth_gated;
+static uint32             os_net_geth_gateTicks[OS_TSN_GATE_ENTRIES];
+static uint32             os_net_geth_gateIndex;
+static uint64             os_net_geth_cycleTicks;
+static uint64             os_net_geth_phaseTicks;
+
+/* Receive side.  The descriptors from rxArmed up to rxNext hold frames owned
+ * by the stack.  The core done with a frame sets its released flag, the net
+ * task re-arms the descriptors in ring order. */
+static IFX_ALIGN(4) uint8 os_net_geth_rxBuffers[OS_NET_GETH_RX_DESCRIPTORS][OS_NET_GETH_BUFFER_SIZE];
+static IFX_ALIGN(4) uint8 os_net_geth_txBuffers[OS_NET_GETH_TX_CHANNELS][OS_NET_GETH_TX_DESCRIPTORS][OS_NET_GETH_BUFFER_SIZE];
+static uint8             *os_net_geth_rxFrames;        /* Global address of the receive buffers */
+static uint32             os_net_geth_rxNext;
+static uint32             os_net_geth_rxArmed;
+static volatile boolean   os_net_geth_released[OS_NET_GETH_RX_DESCRIPTORS];
+
+/* Transmit side.  The descriptor of the last frame each channel sent with a
+ * timestamp, NULL_PTR once the timestamp has been taken or the descriptor is
+ * reused. */
+static uint8             *os_net_geth_txFrames;        /* Global address of the transmit buffers */
+static volatile IfxGeth_TxDescr *os_net_geth_txStamped[OS_NET_GETH_TX_CHANNELS];
+
+/* System time: the addend of the nominal rate. */
+static uint32             os_net_geth_addend;
+
+static uint8             *os_net_geth_receive(void *context, uint32 *length, uint32 *flags, uint64 *timestamp);
+static void               os_net_geth_release(void *context, uint8 *frame);
+static uint8             *os_net_geth_getTxBuffer(void *context);
+static boolean            os_net_geth_send(void *context, uint8 *frame, uint32 length, uint32 flags);
+static boolean            os_net_geth_getTxTimestamp(void *context, uint64 *timestamp);
+static uint64             os_net_geth_getTime(void *context, uint64 *local);
+static void               os_net_geth_adjustFrequency(void *context, sint32 ppb);
+static void               os_net_geth_step(void *context, sint64 offset);
+static uint64             os_net_geth_getLocal(void);
+
+static const OsNet_Driver os_net_geth_driver = {
+    .context           = &os_net_geth,
+    .receive           = os_net_geth_receive,
+    .release           = os_net_geth_release,
+    .getTxBuffer       = os_net_geth_getTxBuffer,
+    .send              = os_net_geth_send,
+    .getTxTimestamp    = os_net_geth_getTxTimestamp,
+    .txChecksumOffload = TRUE,
+};
+
+/* localFrequency is filled in when GETH is initialised. */
+static OsPtp_Clock        os_net_geth_clock = {
+    .context         = &os_net_geth,
+    .getTime         = os_net_geth_getTime,
+    .adjustFrequency = os_net_geth_adjustFrequency,
+    .step            = os_net_geth_step,
+    .getLocal        = os_net_geth_getLocal,
+    .localFrequency  = 0,
+};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Hands the released descriptors at the start of the outstanding ones back to
+ * the DMA.  Net task only. */
+static void os_net_geth_rearm(void)
+{
+    volatile IfxGeth_RxDescr *descriptors = IfxGeth_Eth_getBaseRxDescriptor(&os_net_geth, IfxGeth_RxDmaChannel_0);
+    uint32                    armed       = os_net_geth_rxArmed;
+
+    while ((armed != os_net_geth_rxNext) && (os_net_geth_released[armed % OS_NET_GETH_RX_DESCRIPTORS] != FALSE))
+    {
+        uint32                    index = armed % OS_NET_GETH_RX_DESCRIPTORS;
+        volatile IfxGeth_RxDescr *descr = &descriptors[index];
+        IfxGeth_RxDescr3          rdes3;
+
+        os_net_geth_released[index] = FALSE;
+        descr->RDES0.U              = (uint32)&os_net_geth_rxFrames[index * OS_NET_GETH_BUFFER_SIZE];
+        descr->RDES1.U              = 0;
+        descr->RDES2.U              = 0;
+
+        rdes3.U       = 0;
+        rdes3.R.BUF1V = 1;
+        rdes3.R.IOC   = 1;
+        rdes3.R.OWN   = 1;
+
+        /* The buffer address must be written before the DMA owns the
+         * descriptor. */
+        __dsync();
+        descr->RDES3.U = rdes3.U;
+        armed++;
+    }
+
+    if (armed != os_net_geth_rxArmed)
+    {
+        /* Up to and including the last descriptor armed. */
+        __dsync();
+        IfxGeth_dma_setRxDescriptorTailPointer(os_net_geth.gethSFR, IfxGeth_RxDmaChannel_0,
+            (uint32)&descriptors[((armed - 1) % OS_NET_GETH_RX_DESCRIPTORS) + 1]);
+        IfxGeth_Eth_wakeupReceiver(&os_net_geth, IfxGeth_RxDmaChannel_0);
+        os_net_geth_rxArmed = armed;
+    }
+}
+
+/* Reads the timestamp of the frame in descriptor index from the context
+ * descriptor the DMA writes behind it.  Returns FALSE if that has not been
+ * written yet; the frame is then left for the next poll. */
+static boolean os_net_geth_getRxTimestamp(volatile IfxGeth_RxDescr *descriptors, uint32 index, uint32 *flags, uint64 *timestamp)
+{
+    volatile IfxGeth_RxDescr *context = &descriptors[(index + 1) % OS_NET_GETH_RX_DESCRIPTORS];
+    IfxGeth_RxDescr3          rdes3;
+    uint32                    spin    = 0;
+    boolean                   result  = FALSE;
+
+    /* The DMA only writes the context to a descriptor it owns. */
+    if (((os_net_geth_rxNext + 1) - os_net_geth_rxArmed) < OS_NET_GETH_RX_DESCRIPTORS)
+    {
+        rdes3.U = context->RDES3.U;
+
+        while ((rdes3.C.OWN != 0) && (spin < OS_NET_GETH_CONTEXT_SPIN))
+        {
+            rdes3.U = context->RDES3.U;
+            spin++;
+        }
+
+        result = (boolean)(rdes3.C.OWN == 0);
+    }
+
+    if (result != FALSE)
+    {
+        uint32 nanoseconds = context->RDES0.C.RTSL;
+        uint32 seconds     = context->RDES1.C.RTSH;
+
+        /* All ones: the timestamp was corrupted. */
+        if ((rdes3.C.CTXT != 0) && ((nanoseconds != 0xFFFFFFFFU) || (seconds != 0xFFFFFFFFU)))
+        {
+            *timestamp = ((uint64)seconds * OS_NET_GETH_NS_PER_SECOND) + nanoseconds;
+            *flags    |= OS_NET_RX_TIMESTAMP;
+        }
+
+        os_net_geth_released[(index + 1) % OS_NET_GETH_RX_DESCRIPTORS] = TRUE;
+    }
+
+    return result;
+}
+
+static uint8 *os_net_geth_receive(void *context, uint32 *length, uint32 *flags, uint64 *timestamp)
+{
+    IfxGeth_Eth              *geth        = (IfxGeth_Eth *)context;
+    volatile IfxGeth_RxDescr *descriptors = IfxGeth_Eth_getBaseRxDescriptor(geth, IfxGeth_RxDmaChannel_0);
+    uint8                    *frame       = NULL_PTR;
+    boolean                   deferred    = FALSE;
+
+    os_net_geth_rearm();
+
+    while ((frame == NULL_PTR) && (deferred == FALSE) && ((os_net_geth_rxNext - os_net_geth_rxArmed) < OS_NET_GETH_RX_DESCRIPTORS)
+           && (descriptors[os_net_geth_rxNext % OS_NET_GETH_RX_DESCRIPTORS].RDES3.W.OWN == 0))
+    {
+        uint32                    index = os_net_geth_rxNext % OS_NET_GETH_RX_DESCRIPTORS;
+        volatile IfxGeth_RxDescr *descr = &descriptors[index];
+        IfxGeth_RxDescr1          rdes1;
+        IfxGeth_RxDescr3          rdes3;
+
+        rdes3.U = descr->RDES3.U;
+        rdes1.U = descr->RDES1.U;
+        *flags  = 0;
+
+        /* A timestamped frame is followed by its context descriptor. */
+        if ((rdes3.W.CTXT == 0) && (rdes3.W.LD != 0) && (rdes3.W.RS1V != 0) && (rdes1.W.TSA != 0))
+        {
+            if (os_net_geth_getRxTimestamp(descriptors, index, flags, timestamp) == FALSE)
+            {
+                deferred = TRUE;
+            }
+            else
+            {
+                os_net_geth_rxNext++;
+            }
+        }
+
+        if (deferred == FALSE)
+        {
+            os_net_geth_rxNext++;
+        }
+
+        /* A frame fits one buffer: anything else is an error, as are context
+         * descriptors and frames shorter than their FCS. */
+        if (deferred != FALSE)
+        {}
+        else if ((rdes3.W.ES != 0) || (rdes3.W.FD == 0) || (rdes3.W.LD == 0) || (rdes3.W.CTXT != 0)
+                 || (rdes3.W.PL <= OS_NET_GETH_FCS_SIZE))
+        {
+            os_net_geth_released[index] = TRUE;
+            os_net_geth_rearm();
+        }
+        else
+        {
+            frame   = &os_net_geth_rxFrames[index * OS_NET_GETH_BUFFER_SIZE];
+            *length = rdes3.W.PL - OS_NET_GETH_FCS_SIZE;
+
+            if ((rdes3.W.RS1V != 0) && (rdes1.W.IP4 != 0) && (rdes1.W.IPHE == 0) && (rdes1.W.IPCB == 0)
+                && (rdes1.W.IPCE == 0) && ((rdes1.W.PT == OS_NET_GETH_PAYLOAD_UDP) || (rdes1.W.PT == OS_NET_GETH_PAYLOAD_ICMP)))
+            {
+                *flags |= OS_NET_RX_CHECKSUM_VERIFIED;
+            }
+        }
+    }
+
+    return frame;
+}
+
+static void os_net_geth_release(void *context, uint8 *frame)
+{
+    uint32 index = (uint32)(frame - os_net_geth_rxFrames) / OS_NET_GETH_BUFFER_SIZE;
+
+    (void)context;
+
+    /* The frame must have been read before the net task re-arms it. */
+    portMEMORY_BARRIER();
+    os_net_geth_released[index] = TRUE;
+}
+
+/* The buffer of a descriptor follows from its index: TDES0 is overwritten
+ * with the timestamp of a frame sent with one. */
+static uint8 *os_net_geth_getTxBuffer(void *context)
+{
+    IfxGeth_Eth *geth    = (IfxGeth_Eth *)context;
+    sint8        channel = os_net_geth_txChannels[portGET_CORE_ID()];
+    uint8       *buffer  = NULL_PTR;
+
+    if (channel >= 0)
+    {
+        volatile IfxGeth_TxDescr *descr = IfxGeth_Eth_getActualTxDescriptor(geth, (IfxGeth_TxDmaChannel)channel);
+        uint32                    index = (uint32)(descr - IfxGeth_Eth_getBaseTxDescriptor(geth, (IfxGeth_TxDmaChannel)channel));
+
+        if (descr->TDES3.R.OWN == 0)
+        {
+            buffer = &os_net_geth_txFrames[(((uint32)channel * OS_NET_GETH_TX_DESCRIPTORS) + index) * OS_NET_GETH_BUFFER_SIZE];
+
+            if (descr == os_net_geth_txStamped[channel])
+            {
+                os_net_geth_txStamped[channel] = NULL_PTR;
+            }
+
+            descr->TDES0.U = (uint32)buffer;
+        }
+    }
+
+    return buffer;
+}
+
+/* Hands the frame in the buffer of the current descriptor to the DMA, with
+ * a transmit timestamp if requested.  The channel is not restarted here: the
+ * gate list starts and stops the channels.  A frame always fits one buffer. */
+static void os_net_geth_queueFrame(IfxGeth_Eth *geth, uint32 length, IfxGeth_TxDmaChannel channel, boolean timestamp)
+{
+    volatile IfxGeth_TxDescr *descr = IfxGeth_Eth_getActualTxDescriptor(geth, channel);
+    IfxGeth_TxDescr2          tdes2;
+    IfxGeth_TxDescr3          tdes3;
+
+    tdes2.U           = 0;
+    tdes2.R.B1L       = length;
+    tdes2.R.TTSE_TMWD = (timestamp != FALSE) ? 1 : 0;
+    tdes2.R.IOC       = 1;
+
+    tdes3.U         = 0;
+    tdes3.R.FL_TPL  = length;
+    tdes3.R.CIC_TPL = 3;
+    tdes3.R.FD      = 1;
+    tdes3.R.LD      = 1;
+    tdes3.R.OWN     = 1;
+
+    if (timestamp != FALSE)
+    {
+        os_net_geth_txStamped[channel] = descr;
+    }
+
+    descr->TDES2.U = tdes2.U;
+    __dsync();
+    descr->TDES3.U = tdes3.U;
+
+    IfxGeth_Eth_shuffleTxDescriptor(geth, channel);
+    __dsync();
+    IfxGeth_dma_setTxDescriptorTailPointer(geth->gethSFR, channel, (uint32)IfxGeth_Eth_getActualTxDescriptor(geth, channel));
+    geth->txChannel[channel].txCount++;
+}
+
+static boolean os_net_geth_send(void *context, uint8 *frame, uint32 length, uint32 flags)
+{
+    sint8   channel = os_net_geth_txChannels[portGET_CORE_ID()];
+    boolean result  = FALSE;
+
+    if ((channel >= 0) && (frame != NULL_PTR) && (length <= OS_NET_FRAME_SIZE))
+    {
+        /* The class of the queue admitted no larger frames. */
+        if ((length + OS_NET_GETH_FCS_SIZE) > os_net_geth_tsnConfig.classes[channel].maxFrameSize)
+        {
+            os_net_geth_status.txOversize[channel]++;
+        }
+        else
+        {
+            /* The frame is in the buffer of the current descriptor of the
+             * channel, which also inserts the checksums (CIC = 3).  The iLLD
+             * send is not used: it leaves TDES2 of the previous frame of the
+             * descriptor, timestamp enable included. */
+            __dsync();
+            os_net_geth_queueFrame((IfxGeth_Eth *)context, length, (IfxGeth_TxDmaChannel)channel,
+                (boolean)((flags & OS_NET_TX_TIMESTAMP) != 0));
+
+            if (os_net_geth_gated == FALSE)
+            {
+                IfxGeth_Eth_wakeupTransmitter((IfxGeth_Eth *)context, (IfxGeth_TxDmaChannel)channel);
+            }
+
+            result = TRUE;
+        }
+    }
+
+    return result;
+}
+
+static boolean os_net_geth_getTxTimestamp(void *context, uint64 *timestamp)
+{
+    sint8   channel = os_net_geth_txChannels[portGET_CORE_ID()];
+    boolean result  = FALSE;
+
+    (void)context;
+
+    if ((channel >= 0) && (os_net_geth_txStamped[channel] != NULL_PTR))
+    {
+        volatile IfxGeth_TxDescr *descr = os_net_geth_txStamped[channel];
+        IfxGeth_TxDescr3          tdes3;
+
+        tdes3.U = descr->TDES3.U;
+
+        /* Written back: TDES0 and TDES1 hold the timestamp if TTSS is set. */
+        if (tdes3.W.OWN == 0)
+        {
+            if (tdes3.W.TTSS != 0)
+            {
+                *timestamp = ((uint64)descr->TDES1.U * OS_NET_GETH_NS_PER_SECOND) + descr->TDES0.U;
+                result     = TRUE;
+            }
+
+            os_net_geth_txStamped[channel] = NULL_PTR;
+        }
+    }
+
+    return result;
+}
+
+/* The STM0 time is taken right after the system time, with interrupts
+ * disabled so that the two belong together. */
+static uint64 os_net_geth_getTime(void *context, uint64 *local)
+{
+    IfxGeth_Eth *geth = (IfxGeth_Eth *)context;
+    boolean      interruptState;
+    uint32       seconds;
+    uint32       nanoseconds;
+
+    interruptState = IfxCpu_disableInterrupts();
+    IfxGeth_mac_getSystemTime(geth->gethSFR, &seconds, &nanoseconds);
+    *local         = IfxStm_get(&MODULE_STM0);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return ((uint64)seconds * OS_NET_GETH_NS_PER_SECOND) + nanoseconds;
+}
+
+static void os_net_geth_adjustFrequency(void *context, sint32 ppb)
+{
+    IfxGeth_Eth *geth   = (IfxGeth_Eth *)context;
+    sint64       addend = (sint64)os_net_geth_addend + (((sint64)os_net_geth_addend * ppb) / (sint64)OS_NET_GETH_NS_PER_SECOND);
+
+    IfxGeth_mac_setTimestampAddend(geth->gethSFR, (uint32)addend);
+}
+
+static void os_net_geth_step(void *context, sint64 offset)
+{
+    IfxGeth_Eth *geth      = (IfxGeth_Eth *)context;
+    uint64       magnitude = (uint64)((offset < 0) ? -offset : offset);
+
+    IfxGeth_mac_updateSystemTime(geth->gethSFR, (boolean)(offset < 0), (uint32)(magnitude / OS_NET_GETH_NS_PER_SECOND),
+        (uint32)(magnitude % OS_NET_GETH_NS_PER_SECOND));
+}
+
+static uint64 os_net_geth_getLocal(void)
+{
+    return IfxStm_get(&MODULE_STM0);
+}
+
+/* Starts the system time at its nominal rate.  The addend must leave room
+ * for OS_PTP_MAX_PPB: with the increment rounded up to 2 * 10^9 / fGETH it is
+ * about 2^31. */
+static void os_net_geth_initSystemTime(void)
+{
+    uint32 frequency = (uint32)IfxScuCcu_getGethFrequency();
+    uint32 increment = (2000000000U + frequency - 1U) / frequency;
+
+    os_net_geth_addend              = (uint32)((OS_NET_GETH_NS_PER_SECOND << 32) / ((uint64)increment * frequency));
+    os_net_geth_clock.localFrequency = (uint32)IfxStm_getFrequency(&MODULE_STM0);
+    IfxGeth_mac_initSystemTime(os_net_geth.gethSFR, (uint8)increment, os_net_geth_addend);
+}
+
+/* Link rate of OS_NET_GETH_LINE_SPEED in bit/s. */
+static uint32 os_net_geth_getLinkRate(void)
+{
+    uint32 linkRate;
+
+    switch (OS_NET_GETH_LINE_SPEED)
+    {
+    case IfxGeth_LineSpeed_10Mbps:
+        linkRate = 10000000U;
+        break;
+    case IfxGeth_LineSpeed_100Mbps:
+        linkRate = 100000000U;
+        break;
+    default:
+        linkRate = 1000000000U;
+        break;
+    }
+
+    return linkRate;
+}
+
+/* Admission control of OS_NET_GETH_TSN_CONFIG, before GETH is initialised. */
+static OsTsn_Result os_net_geth_checkTsn(void)
+{
+    OsTsn_Result result = os_tsn_check(&os_net_geth_tsnConfig, os_net_geth_getLinkRate());
+
+    /* Every queue has a class. */
+    if ((result == OsTsn_Result_ok) && (os_net_geth_tsnConfig.numClasses != OS_NET_GETH_TX_CHANNELS))
+    {
+        result = OsTsn_Result_invalid;
+    }
+
+    /* Comparator 1 of STM0 is taken if core 0 runs partition windows.  The
+     * port armed it when core 0 started its scheduler, so this holds from
+     * whichever core the task runs on. */
+    if ((result == OsTsn_Result_ok) && (os_net_geth_tsnConfig.gateListLength != 0) && (MODULE_STM0.ICR.B.CMP1EN != 0))
+    {
+        result = OsTsn_Result_invalid;
+    }
+
+    return result;
+}
+
+/* Returns the STM0 time of the next cycle start at least one cycle ahead. */
+static uint64 os_net_geth_getNextCycle(void)
+{
+    uint64 now = IfxStm_get(&MODULE_STM0);
+
+    return (((now / os_net_geth_cycleTicks) + 2U) * os_net_geth_cycleTicks) + os_net_geth_phaseTicks;
+}
+
+/* Converts the gate list to STM ticks and arms comparator 1 of STM0 for the
+ * first cycle.  The gates stay open until then. */
+static void os_net_geth_startGates(void)
+{
+    IfxStm_CompareConfig compare;
+    uint64               frequency = (uint64)IfxStm_getFrequency(&MODULE_STM0);
+    uint64               elapsed   = 0;
+    uint64               previous  = 0;
+    uint32               entry;
+
+    /* From the sum of the intervals, so that rounding does not add up. */
+    for (entry = 0; entry < os_net_geth_tsnConfig.gateListLength; entry++)
+    {
+        uint64 ticks;
+
+        elapsed                     += os_net_geth_tsnConfig.gateList[entry].interval;
+        ticks                        = (elapsed * frequency) / 1000000000U;
+        os_net_geth_gateTicks[entry] = (uint32)(ticks - previous);
+        previous                     = ticks;
+    }
+
+    os_net_geth_cycleTicks = previous;
+    os_net_geth_phaseTicks = ((uint64)os_net_geth_tsnConfig.phase * frequency) / 1000000000U;
+    os_net_geth_gateIndex  = 0;
+
+    /* The interrupt source is set up from os_system.json. */
+    IfxStm_initCompareConfig(&compare);
+    compare.comparator          = IfxStm_Comparator_1;
+    compare.comparatorInterrupt = IfxStm_ComparatorInterrupt_ir1;
+    compare.ticks               = (uint32)(os_net_geth_getNextCycle() - IfxStm_get(&MODULE_STM0));
+    (void)IfxStm_initCompare(&MODULE_STM0, &compare);
+}
+
+static void os_net_geth_initModule(void)
+{
+    IfxGeth_Eth_Config config;
+    uint32             coreIndex = IfxCpu_getCoreIndex();
+    uint32             index;
+
+    IfxGeth_Eth_initModuleConfig(&config, &MODULE_GETH);
+
+    /* The DMA and the other cores reach the buffers by their global address. */
+    os_net_geth_rxFrames = (uint8 *)IFXCPU_GLB_ADDR_DSPR(coreIndex, &os_net_geth_rxBuffers[0][0]);
+    os_net_geth_txFrames = (uint8 *)IFXCPU_GLB_ADDR_DSPR(coreIndex, &os_net_geth_txBuffers[0][0][0]);
+
+    config.phyInterfaceMode       = IfxGeth_PhyInterfaceMode_rgmii;
+    config.pins.rgmiiPins         = &os_net_geth_pins;
+    config.mac.lineSpeed          = OS_NET_GETH_LINE_SPEED;
+    config.mac.maxPacketSize      = OS_NET_FRAME_SIZE + OS_NET_GETH_FCS_SIZE;
+
+    for (index = 0; index < 6; index++)
+    {
+        config.mac.macAddress[index] = os_net_geth_config.mac[index];
+    }
+
+    /* Checksum insertion needs store and forward, a queue holds a frame.  The
+     * traffic classes need strict priority between the queues. */
+    os_net_geth_status.tsnResult     = os_net_geth_checkTsn();
+    config.mtl.numOfTxQueues         = OS_NET_GETH_TX_CHANNELS;
+    config.mtl.txSchedulingAlgorithm = (os_net_geth_status.tsnResult == OsTsn_Result_ok) ? IfxGeth_TxSchedulingAlgorithm_sp : IfxGeth_TxSchedulingAlgorithm_wrr;
+    config.mtl.numOfRxQueues         = 1;
+
+    for (index = 0; index < OS_NET_GETH_TX_CHANNELS; index++)
+    {
+        config.mtl.txQueue[index].storeAndForward = TRUE;
+        config.mtl.txQueue[index].txQueueSize     = IfxGeth_QueueSize_2048Bytes;
+    }
+
+    config.mtl.rxQueue[0].storeAndForward = TRUE;
+    config.mtl.rxQueue[0].rxQueueSize     = IfxGeth_QueueSize_4096Bytes;
+    config.mtl.rxQueue[0].rxDmaChannelMap = IfxGeth_RxDmaChannel_0;
+
+    config.dma.numOfTxChannels = OS_NET_GETH_TX_CHANNELS;
+    config.dma.numOfRxChannels = 1;
+
+    for (index = 0; index < OS_NET_GETH_TX_CHANNELS; index++)
+    {
+        config.dma.txChannel[index].channelId             = (IfxGeth_TxDmaChannel)index;
+        config.dma.txChannel[index].txDescrList           = &IfxGeth_Eth_txDescrList[0][index];
+        config.dma.txChannel[index].txBuffer1StartAddress = (uint32 *)&os_net_geth_txFrames[index * OS_NET_GETH_TX_DESCRIPTORS * OS_NET_GETH_BUFFER_SIZE];
+        config.dma.txChannel[index].txBuffer1Size         = OS_NET_GETH_BUFFER_SIZE;
+    }
+
+    config.dma.rxChannel[0].channelId             = IfxGeth_RxDmaChannel_0;
+    config.dma.rxChannel[0].rxDescrList           = &IfxGeth_Eth_rxDescrList[0][0];
+    config.dma.rxChannel[0].rxBuffer1StartAddress = (uint32 *)os_net_geth_rxFrames;
+    config.dma.rxChannel[0].rxBuffer1Size         = OS_NET_GETH_BUFFER_SIZE;
+
+    /* Only the receive interrupt, transmit buffers are found free by polling
+     * their descriptors. */
+    config.dma.rxInterrupt[0].channelId = IfxGeth_DmaChannel_0;
+    config.dma.rxInterrupt[0].priority  = OS_NET_GETH_ISR_PRIORITY_RX;
+    config.dma.rxInterrupt[0].provider  = IfxSrc_Tos_cpu0;
+
+    IfxGeth_Eth_initModule(&os_net_geth, &config);
+
+    /* The stack skips the software checksums of the frames the MAC verified. */
+    IfxGeth_mac_setChecksumOffload(os_net_geth.gethSFR, TRUE);
+    os_net_geth_initSystemTime();
+
+    if (os_net_geth_status.tsnResult == OsTsn_Result_ok)
+    {
+        for (index = 1; index < OS_NET_GETH_TX_CHANNELS; index++)
+        {
+            if (os_net_geth_tsnConfig.classes[index].shaper == OsTsn_Shaper_creditBased)
+            {
+                OsTsn_ShaperRegisters shaper;
+
+                os_tsn_getShaper(&os_net_geth_tsnConfig, index, os_net_geth_getLinkRate(), &shaper);
+                IfxGeth_mtl_setTxCreditBasedShaper(os_net_geth.gethSFR, (IfxGeth_TxMtlQueue)index,
+                    shaper.idleSlope, shaper.sendSlope, shaper.hiCredit, shaper.loCredit);
+            }
+        }
+
+        os_net_geth_gated = (os_net_geth_tsnConfig.gateListLength != 0) ? TRUE : FALSE;
+    }
+
+    IfxGeth_Eth_startTransmitters(&os_net_geth, OS_NET_GETH_TX_CHANNELS);
+    IfxGeth_Eth_startReceivers(&os_net_geth, 1);
+
+    if (os_net_geth_gated != FALSE)
+    {
+        os_net_geth_startGates();
+    }
+}
+
+void os_net_geth_task(void *arg)
+{
+    (void)arg;
+
+    os_net_geth_taskHandle = xTaskGetCurrentTaskHandle();
+    os_net_geth_initModule();
+    os_ptp_init(&os_net_geth_ptpConfig, &os_net_geth_clock, os_net_geth_config.mac);
+    os_net_init(&os_net_geth_config, &os_net_geth_driver);
+
+    while (1)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OS_NET_GETH_POLL_MS));
+
+        /* Yield between budgets so that equal priority tasks are not starved
+         * by a flood. */
+        while (os_net_poll(OS_NET_GETH_POLL_BUDGET) == OS_NET_GETH_POLL_BUDGET)
+        {
+            taskYIELD();
+        }
+
+        os_ptp_poll();
+    }
+}
+
+void os_net_geth_isrReceive(void)
+{
+    IfxGeth_dma_clearInterruptFlag(os_net_geth.gethSFR, IfxGeth_DmaChannel_0, IfxGeth_DmaInterruptFlag_receiveInterrupt);
+    IfxGeth_dma_clearInterruptFlag(os_net_geth.gethSFR, IfxGeth_DmaChannel_0, IfxGeth_DmaInterruptFlag_normalInterruptSummary);
+
+    /* The port cannot switch tasks from a handler called by the vector, the
+     * net task runs at the next tick or when the running task blocks. */
+    vTaskNotifyGiveFromISR(os_net_geth_taskHandle, NULL);
+}
+
+void os_net_geth_isrGate(void)
+{
+    const OsTsn_GateEntry *entry = &os_net_geth_tsnConfig.gateList[os_net_geth_gateIndex];
+    uint32                 channel;
+
+    for (channel = 0; channel < OS_NET_GETH_TX_CHANNELS; channel++)
+    {
+        if ((entry->gates & (1U << channel)) != 0)
+        {
+            IfxGeth_dma_startTransmitter(os_net_geth.gethSFR, (IfxGeth_TxDmaChannel)channel);
+        }
+        else
+        {
+            IfxGeth_dma_stopTransmitter(os_net_geth.gethSFR, (IfxGeth_TxDmaChannel)channel);
+        }
+    }
+
+    /* Advance from the previous compare value rather than from the current
+     * time, so that the interrupt latency does not move the cycle. */
+    IfxStm_increaseCompare(&MODULE_STM0, IfxStm_Comparator_1, os_net_geth_gateTicks[os_net_geth_gateIndex]);
+    os_net_geth_gateIndex++;
+
+    if (os_net_geth_gateIndex == os_net_geth_tsnConfig.gateListLength)
+    {
+        os_net_geth_gateIndex = 0;
+        os_net_geth_status.gateCycles++;
+    }
+
+    /* A switch already due has been missed: the gates of this entry stay
+     * until the list restarts on a cycle boundary. */
+    if ((sint32)(MODULE_STM0.CMP[1].U - IfxStm_getLower(&MODULE_STM0)) <= 0)
+    {
+        MODULE_STM0.CMP[1].U  = (uint32)os_net_geth_getNextCycle();
+        os_net_geth_gateIndex = 0;
+        os_net_geth_status.gateOverruns++;
+    }
+}
+
+void os_net_geth_getStatus(OsNetGeth_Status *status)
+{
+    *status = os_net_geth_status;
+}
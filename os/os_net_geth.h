@@ -0,0 +1,136 @@
+#ifndef OS_NET_GETH_H
+#define OS_NET_GETH_H
+
+/* GETH driver of the UDP/IPv4 stack, see os_net.h.
+ *
+ * Frames are received on DMA channel 0 into IFXGETH_MAX_RX_DESCRIPTORS buffers
+ * that the stack passes on in place; a descriptor goes back to the DMA once
+ * its frame and all frames received before it have been released.  Each core
+ * in OS_NET_GETH_TX_CHANNEL_MAP sends on a DMA channel and MTL queue of its
+ * own, the other cores have no transmit buffer.  The MAC verifies and inserts
+ * the IPv4 header and UDP/ICMP checksums.
+ *
+ * The transmit queues carry the traffic classes of OS_NET_GETH_TSN_CONFIG, so
+ * the channel map also picks the class of every sending core.  A frame larger
+ * than the maxFrameSize of its class is not sent.
+ *
+ * The GETH system time is the clock of os_ptp.h, and the net task runs PTP in
+ * the role of OS_NET_GETH_PTP_CONFIG.  Received PTP messages and the frames
+ * sent with OS_NET_TX_TIMESTAMP are timestamped by the MAC.
+ *
+ * The buffers and the iLLD descriptor lists must be located in RAM that is not
+ * cached by the CPUs.  The PHY is not configured: it must come up with its
+ * strap settings at OS_NET_GETH_LINE_SPEED. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include "os_net.h"
+#include "os_tsn.h"
+#include "os_ptp.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* Address of the interface, see OsNet_Config. */
+#ifndef OS_NET_GETH_MAC_ADDRESS
+#define OS_NET_GETH_MAC_ADDRESS          {0x02, 0x00, 0x00, 0x00, 0x03, 0x97}
+#endif
+
+#ifndef OS_NET_GETH_IP_ADDRESS
+#define OS_NET_GETH_IP_ADDRESS           OS_NET_IP(192, 168, 0, 2)
+#endif
+
+#ifndef OS_NET_GETH_NETMASK
+#define OS_NET_GETH_NETMASK              OS_NET_IP(255, 255, 255, 0)
+#endif
+
+#ifndef OS_NET_GETH_GATEWAY
+#define OS_NET_GETH_GATEWAY              (0)
+#endif
+
+#ifndef OS_NET_GETH_LINE_SPEED
+#define OS_NET_GETH_LINE_SPEED           IfxGeth_LineSpeed_1000Mbps
+#endif
+
+/* Transmit DMA channel of every core, indexed by portGET_CORE_ID(), -1 for
+ * none.  The channels in use must be 0 to OS_NET_GETH_TX_CHANNELS - 1: with
+ * checksum insertion a queue holds a whole frame, and the MTL transmit FIFO
+ * has room for two. */
+#ifndef OS_NET_GETH_TX_CHANNEL_MAP
+#define OS_NET_GETH_TX_CHANNELS          (2)
+#define OS_NET_GETH_TX_CHANNEL_MAP       {0, 1, -1, -1, -1, -1, -1}
+#endif
+
+/* Traffic classes of the transmit queues, see os_tsn.h.  By default queue 1
+ * is a control class ahead of queue 0, shaped to 100 Mbit/s so that it cannot
+ * starve the bulk traffic of queue 0.  If admission control rejects the
+ * configuration, the queues are served round robin without gates. */
+#ifndef OS_NET_GETH_TSN_CONFIG
+#define OS_NET_GETH_TSN_CONFIG           {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE},      \
+                                           {OsTsn_Shaper_creditBased, 100000000U, OS_TSN_MAX_FRAME_SIZE}}, \
+                                          OS_NET_GETH_TX_CHANNELS, {{0, 0}}, 0, 0}
+#endif
+
+/* PTP role, see os_ptp.h.  By default a slave of 192.168.0.1.  The net task
+ * wakes at least every OS_NET_GETH_POLL_MS, which must not be longer than the
+ * sync interval. */
+#ifndef OS_NET_GETH_PTP_CONFIG
+#define OS_NET_GETH_PTP_CONFIG           {OsPtp_Role_slave, OS_NET_IP(192, 168, 0, 1), {0}}
+#endif
+
+#ifndef OS_NET_GETH_POLL_BUDGET
+#define OS_NET_GETH_POLL_BUDGET          (8)      /* Frames processed between yields           */
+#endif
+
+#ifndef OS_NET_GETH_POLL_MS
+#define OS_NET_GETH_POLL_MS              (10)     /* Longest sleep of the net task              */
+#endif
+
+/* Interrupt priority of the receive interrupt on core 0, it must match
+ * os_system.json. */
+#define OS_NET_GETH_ISR_PRIORITY_RX      (13)
+
+/* Interrupt priority of the gate list on core 0, it must match os_system.json.
+ * The gates are switched by comparator 1 of STM0.  If core 0 runs partition
+ * windows the comparator is theirs: a gate list is then refused with
+ * OsTsn_Result_invalid, and the port asserts if the gates took it first. */
+#define OS_NET_GETH_ISR_PRIORITY_GATE    (14)
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* See os_net_geth_getStatus(). */
+typedef struct
+{
+    OsTsn_Result tsnResult;                          /* Admission of OS_NET_GETH_TSN_CONFIG    */
+    uint32       gateCycles;                         /* Gate list cycles completed             */
+    uint32       gateOverruns;                       /* Switches too late, the list restarted  */
+    uint32       txOversize[OS_NET_GETH_TX_CHANNELS]; /* Frames over maxFrameSize, per queue   */
+} OsNetGeth_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Net task, created on core 0 from os_system.json.  It initialises GETH and
+ * the stack, then runs os_net_poll() whenever frames arrive, and at least
+ * every OS_NET_GETH_POLL_MS to return the descriptors released by other
+ * cores to the DMA. */
+extern void os_net_geth_task(void *arg);
+
+/* Receive interrupt handler of DMA channel 0, registered in os_system.json. */
+extern void os_net_geth_isrReceive(void);
+
+/* Gate list interrupt handler of STM0 comparator 1, registered in
+ * os_system.json. */
+extern void os_net_geth_isrGate(void);
+
+/* Copies the driver statistics, valid once the net task has initialised
+ * GETH. */
+extern void os_net_geth_getStatus(OsNetGeth_Status *status);
+
+#endif /* OS_NET_GETH_H */
@@ -0,0 +1,600 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "os_net.h"
+#include "os_ptp.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_PTP_NS_PER_SECOND             (1000000000LL)
+
+#if (OS_PTP_LOG_SYNC_INTERVAL >= 0)
+#define OS_PTP_SYNC_INTERVAL             ((uint64)OS_PTP_NS_PER_SECOND << OS_PTP_LOG_SYNC_INTERVAL)
+#else
+#define OS_PTP_SYNC_INTERVAL             ((uint64)OS_PTP_NS_PER_SECOND >> -(OS_PTP_LOG_SYNC_INTERVAL))
+#endif
+
+/* Message layout, offsets from the start of the header. */
+#define OS_PTP_TYPE                      (0)
+#define OS_PTP_VERSION                   (1)
+#define OS_PTP_LENGTH                    (2)
+#define OS_PTP_DOMAIN                    (4)
+#define OS_PTP_FLAGS                     (6)
+#define OS_PTP_CORRECTION                (8)
+#define OS_PTP_SOURCE                    (20)
+#define OS_PTP_SEQUENCE                  (30)
+#define OS_PTP_CONTROL                   (32)
+#define OS_PTP_LOG_INTERVAL              (33)
+#define OS_PTP_TIMESTAMP                 (34)
+#define OS_PTP_REQUESTING                (44)    /* Delay_Resp */
+#define OS_PTP_HEADER_SIZE               (34)
+#define OS_PTP_IDENTITY_SIZE             (10)    /* clockIdentity and portNumber */
+#define OS_PTP_MESSAGE_SIZE              (OS_PTP_HEADER_SIZE + 10)
+#define OS_PTP_DELAY_RESP_SIZE           (OS_PTP_MESSAGE_SIZE + OS_PTP_IDENTITY_SIZE)
+
+#define OS_PTP_TYPE_SYNC                 (0x0U)
+#define OS_PTP_TYPE_DELAY_REQ            (0x1U)
+#define OS_PTP_TYPE_FOLLOW_UP            (0x8U)
+#define OS_PTP_TYPE_DELAY_RESP           (0x9U)
+#define OS_PTP_VERSION_2                 (2U)
+#define OS_PTP_FLAG_TWO_STEP             (0x0200U)
+#define OS_PTP_FLAG_UNICAST              (0x0400U)
+#define OS_PTP_LOG_INTERVAL_NONE         (0x7F)
+
+/* Mapping from STM0 to network time, ns = baseNet + (local - baseLocal) *
+ * (whole + fraction / 2^32).  The receiving core writes it, the other cores
+ * read it under the sequence count, which is odd while it is being written. */
+typedef struct
+{
+    volatile uint32 sequence;
+    uint64          baseLocal;
+    uint64          baseNet;
+    uint32          whole;
+    uint32          fraction;
+} OsPtp_Mapping;
+
+static OsPtp_Config       os_ptp_config;
+static const OsPtp_Clock *os_ptp_clock;
+static uint8              os_ptp_identity[OS_PTP_IDENTITY_SIZE];
+static OsPtp_Status       os_ptp_status;
+static OsPtp_Mapping      os_ptp_mapping;
+
+/* Last sample of the clock against STM0, and the rate of the clock in ns per
+ * STM0 tick as Q32.32.  The clock ran at sampleFrequency since the sample:
+ * every change of the rate or step is followed by a sample. */
+static uint64             os_ptp_sampleLocal;
+static uint64             os_ptp_sampleNet;
+static sint32             os_ptp_sampleFrequency;
+static boolean            os_ptp_sampleValid;
+static sint64             os_ptp_ratio;
+
+/* Master. */
+static uint64             os_ptp_nextSync;
+static uint16             os_ptp_syncSequence;
+
+/* Slave: the Sync waiting for its Follow_Up, the Delay_Req waiting for its
+ * Delay_Resp, and the servo. */
+static boolean            os_ptp_syncPending;
+static uint16             os_ptp_syncSequenceRx;
+static uint64             os_ptp_syncReceived;
+static sint64             os_ptp_syncCorrection;
+static boolean            os_ptp_delayPending;
+static uint16             os_ptp_delaySequence;
+static uint64             os_ptp_delaySent;
+static sint64             os_ptp_delayMasterToSlave;
+static boolean            os_ptp_pathDelayValid;
+static sint64             os_ptp_pathDelay;
+static boolean            os_ptp_previousValid;
+static sint64             os_ptp_previousMasterToSlave;
+static uint64             os_ptp_previousOrigin;
+static float32            os_ptp_drift;
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Messages are in network byte order and not aligned: access them bytewise. */
+static uint16 os_ptp_get16(const uint8 *data)
+{
+    return (uint16)(((uint16)data[0] << 8) | data[1]);
+}
+
+static uint32 os_ptp_get32(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | (uint32)data[3];
+}
+
+static void os_ptp_put16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)(value >> 8);
+    data[1] = (uint8)value;
+}
+
+static void os_ptp_put32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)(value >> 24);
+    data[1] = (uint8)(value >> 16);
+    data[2] = (uint8)(value >> 8);
+    data[3] = (uint8)value;
+}
+
+/* A timestamp is 48 bits of seconds and 32 bits of ns. */
+static uint64 os_ptp_getTimestamp(const uint8 *data)
+{
+    uint64 seconds = ((uint64)os_ptp_get16(data) << 32) | os_ptp_get32(&data[2]);
+
+    return (seconds * (uint64)OS_PTP_NS_PER_SECOND) + os_ptp_get32(&data[6]);
+}
+
+static void os_ptp_putTimestamp(uint8 *data, uint64 time)
+{
+    uint64 seconds = time / (uint64)OS_PTP_NS_PER_SECOND;
+
+    os_ptp_put16(data, (uint16)(seconds >> 32));
+    os_ptp_put32(&data[2], (uint32)seconds);
+    os_ptp_put32(&data[6], (uint32)(time % (uint64)OS_PTP_NS_PER_SECOND));
+}
+
+/* The correction field holds ns scaled by 2^16. */
+static sint64 os_ptp_getCorrection(const uint8 *header)
+{
+    uint64 value = ((uint64)os_ptp_get32(&header[OS_PTP_CORRECTION]) << 32) | os_ptp_get32(&header[OS_PTP_CORRECTION + 4]);
+
+    return (sint64)value / 65536;
+}
+
+static void os_ptp_writeHeader(uint8 *message, uint8 type, uint16 length, uint16 flags, uint16 sequence, uint8 logInterval)
+{
+    static const uint8 control[16] = {0, 1, 5, 5, 5, 5, 5, 5, 2, 3, 5, 5, 5, 5, 5, 5};
+
+    memset(message, 0, OS_PTP_HEADER_SIZE);
+    message[OS_PTP_TYPE]    = type;
+    message[OS_PTP_VERSION] = OS_PTP_VERSION_2;
+    os_ptp_put16(&message[OS_PTP_LENGTH], length);
+    os_ptp_put16(&message[OS_PTP_FLAGS], (uint16)(flags | OS_PTP_FLAG_UNICAST));
+    memcpy(&message[OS_PTP_SOURCE], os_ptp_identity, OS_PTP_IDENTITY_SIZE);
+    os_ptp_put16(&message[OS_PTP_SEQUENCE], sequence);
+    message[OS_PTP_CONTROL]      = control[type & 0x0FU];
+    message[OS_PTP_LOG_INTERVAL] = logInterval;
+}
+
+static uint64 os_ptp_getClock(void)
+{
+    uint64 local;
+
+    return os_ptp_clock->getTime(os_ptp_clock->context, &local);
+}
+
+/* ticks * (whole + fraction / 2^32) without overflow. */
+static uint64 os_ptp_scale(uint64 ticks, uint32 whole, uint32 fraction)
+{
+    return (ticks * whole) + ((ticks >> 32) * fraction) + (((ticks & 0xFFFFFFFFU) * fraction) >> 32);
+}
+
+/* Samples the clock against STM0, updates the rate and publishes the
+ * mapping.  The rate is measured over at least half a sync interval and
+ * averaged; it is then corrected for a change of the frequency of the clock
+ * made just before, which the measurement has not seen yet. */
+static void os_ptp_sample(void)
+{
+    uint64 local;
+    uint64 net        = os_ptp_clock->getTime(os_ptp_clock->context, &local);
+    uint64 deltaNet   = net - os_ptp_sampleNet;
+    uint64 deltaLocal = local - os_ptp_sampleLocal;
+    sint64 ratio      = os_ptp_ratio;
+
+    if ((os_ptp_sampleValid != FALSE) && (net > os_ptp_sampleNet) && (deltaLocal != 0)
+        && (deltaNet >= (OS_PTP_SYNC_INTERVAL / 2U)) && (deltaNet < 0x80000000U))
+    {
+        sint64 measured = (sint64)((deltaNet << 32) / deltaLocal);
+
+        ratio += (measured - ratio) / OS_PTP_RATIO_FILTER;
+    }
+
+    ratio += (ratio * (sint64)(os_ptp_status.frequency - os_ptp_sampleFrequency))
+             / (OS_PTP_NS_PER_SECOND + os_ptp_sampleFrequency);
+
+    os_ptp_mapping.sequence++;
+    portMEMORY_BARRIER();
+    os_ptp_mapping.baseLocal = local;
+    os_ptp_mapping.baseNet   = net;
+    os_ptp_mapping.whole     = (uint32)((uint64)ratio >> 32);
+    os_ptp_mapping.fraction  = (uint32)ratio;
+    portMEMORY_BARRIER();
+    os_ptp_mapping.sequence++;
+
+    os_ptp_ratio           = ratio;
+    os_ptp_sampleLocal     = local;
+    os_ptp_sampleNet       = net;
+    os_ptp_sampleFrequency = os_ptp_status.frequency;
+    os_ptp_sampleValid     = TRUE;
+}
+
+static void os_ptp_setFrequency(float32 ppb)
+{
+    if (ppb > (float32)OS_PTP_MAX_PPB)
+    {
+        ppb = (float32)OS_PTP_MAX_PPB;
+    }
+    else if (ppb < -(float32)OS_PTP_MAX_PPB)
+    {
+        ppb = -(float32)OS_PTP_MAX_PPB;
+    }
+    else
+    {}
+
+    os_ptp_status.frequency = (sint32)ppb;
+    os_ptp_clock->adjustFrequency(os_ptp_clock->context, os_ptp_status.frequency);
+}
+
+static void os_ptp_step(sint64 offset)
+{
+    os_ptp_clock->step(os_ptp_clock->context, offset);
+    os_ptp_status.steps++;
+    os_ptp_sampleValid   = FALSE;
+    os_ptp_previousValid = FALSE;
+}
+
+/* Waits up to OS_PTP_TX_TIMEOUT for the transmit timestamp of the datagram
+ * just sent. */
+static boolean os_ptp_waitTxTimestamp(uint64 *timestamp)
+{
+    uint64  start  = os_ptp_getClock();
+    boolean result = os_net_getTxTimestamp(timestamp);
+
+    while ((result == FALSE) && ((os_ptp_getClock() - start) < OS_PTP_TX_TIMEOUT))
+    {
+        result = os_net_getTxTimestamp(timestamp);
+    }
+
+    if (result == FALSE)
+    {
+        os_ptp_status.missingTimestamps++;
+    }
+
+    return result;
+}
+
+/* Sends Sync and Follow_Up to every slave. */
+static void os_ptp_sendSync(uint64 now)
+{
+    uint32 index;
+
+    for (index = 0; index < OS_PTP_MAX_SLAVES; index++)
+    {
+        uint32 slave   = os_ptp_config.slaves[index];
+        uint8 *message = (slave != 0) ? os_net_udpGetBuffer() : NULL_PTR;
+        uint64 origin;
+
+        if (message != NULL_PTR)
+        {
+            os_ptp_writeHeader(message, OS_PTP_TYPE_SYNC, OS_PTP_MESSAGE_SIZE, OS_PTP_FLAG_TWO_STEP, os_ptp_syncSequence,
+                (uint8)OS_PTP_LOG_SYNC_INTERVAL);
+            os_ptp_putTimestamp(&message[OS_PTP_TIMESTAMP], now);
+
+            if ((os_net_udpSendTimestamped(message, OS_PTP_MESSAGE_SIZE, OS_PTP_EVENT_PORT, slave, OS_PTP_EVENT_PORT) == OsNet_Result_ok)
+                && (os_ptp_waitTxTimestamp(&origin) != FALSE))
+            {
+                message = os_net_udpGetBuffer();
+
+                if (message != NULL_PTR)
+                {
+                    os_ptp_writeHeader(message, OS_PTP_TYPE_FOLLOW_UP, OS_PTP_MESSAGE_SIZE, 0, os_ptp_syncSequence,
+                        (uint8)OS_PTP_LOG_SYNC_INTERVAL);
+                    os_ptp_putTimestamp(&message[OS_PTP_TIMESTAMP], origin);
+
+                    if (os_net_udpSend(message, OS_PTP_MESSAGE_SIZE, OS_PTP_GENERAL_PORT, slave, OS_PTP_GENERAL_PORT) == OsNet_Result_ok)
+                    {
+                        os_ptp_status.syncs++;
+                    }
+                }
+            }
+        }
+    }
+
+    os_ptp_syncSequence++;
+}
+
+/* Answers a Delay_Req with the time it arrived. */
+static void os_ptp_receiveDelayReq(const OsNet_Datagram *datagram)
+{
+    uint8 *message = (datagram->timestamp != 0) ? os_net_udpGetBuffer() : NULL_PTR;
+
+    if (datagram->timestamp == 0)
+    {
+        os_ptp_status.missingTimestamps++;
+    }
+    else if (message != NULL_PTR)
+    {
+        os_ptp_writeHeader(message, OS_PTP_TYPE_DELAY_RESP, OS_PTP_DELAY_RESP_SIZE, 0, os_ptp_get16(&datagram->payload[OS_PTP_SEQUENCE]),
+            (uint8)OS_PTP_LOG_SYNC_INTERVAL);
+        memcpy(&message[OS_PTP_CORRECTION], &datagram->payload[OS_PTP_CORRECTION], 8);
+        os_ptp_putTimestamp(&message[OS_PTP_TIMESTAMP], datagram->timestamp);
+        memcpy(&message[OS_PTP_REQUESTING], &datagram->payload[OS_PTP_SOURCE], OS_PTP_IDENTITY_SIZE);
+
+        if (os_net_udpSend(message, OS_PTP_DELAY_RESP_SIZE, OS_PTP_GENERAL_PORT, datagram->sourceIp, OS_PTP_GENERAL_PORT) == OsNet_Result_ok)
+        {
+            os_ptp_status.delayRequests++;
+        }
+    }
+    else
+    {
+        os_ptp_status.dropped++;
+    }
+}
+
+/* Sends a Delay_Req to the master.  masterToSlave is t2 - t1 of the last
+ * Sync, on the clock as it is now. */
+static void os_ptp_sendDelayReq(sint64 masterToSlave)
+{
+    uint8 *message = os_net_udpGetBuffer();
+
+    os_ptp_delayPending = FALSE;
+
+    if (message != NULL_PTR)
+    {
+        os_ptp_delaySequence++;
+        os_ptp_writeHeader(message, OS_PTP_TYPE_DELAY_REQ, OS_PTP_MESSAGE_SIZE, 0, os_ptp_delaySequence, OS_PTP_LOG_INTERVAL_NONE);
+        os_ptp_putTimestamp(&message[OS_PTP_TIMESTAMP], 0);
+
+        if ((os_net_udpSendTimestamped(message, OS_PTP_MESSAGE_SIZE, OS_PTP_EVENT_PORT, os_ptp_config.master, OS_PTP_EVENT_PORT) == OsNet_Result_ok)
+            && (os_ptp_waitTxTimestamp(&os_ptp_delaySent) != FALSE))
+        {
+            os_ptp_delayMasterToSlave = masterToSlave;
+            os_ptp_delayPending       = TRUE;
+        }
+    }
+}
+
+/* PI servo: removes OS_PTP_SERVO_KP of the offset over the next interval and
+ * integrates OS_PTP_SERVO_KI of it into the drift. */
+static void os_ptp_servo(sint64 offset, uint64 interval)
+{
+    float32 seconds = (float32)interval / (float32)OS_PTP_NS_PER_SECOND;
+
+    os_ptp_drift -= (OS_PTP_SERVO_KI * (float32)offset) / seconds;
+
+    if (os_ptp_drift > (float32)OS_PTP_MAX_PPB)
+    {
+        os_ptp_drift = (float32)OS_PTP_MAX_PPB;
+    }
+    else if (os_ptp_drift < -(float32)OS_PTP_MAX_PPB)
+    {
+        os_ptp_drift = -(float32)OS_PTP_MAX_PPB;
+    }
+    else
+    {}
+
+    os_ptp_setFrequency(os_ptp_drift - ((OS_PTP_SERVO_KP * (float32)offset) / seconds));
+}
+
+/* Handles the origin and arrival time of a Sync on a slave. */
+static void os_ptp_synchronize(uint64 origin, uint64 received)
+{
+    sint64 masterToSlave = (sint64)(received - origin);
+    sint64 offset        = masterToSlave - ((os_ptp_pathDelayValid != FALSE) ? os_ptp_pathDelay : 0);
+    uint64 interval      = origin - os_ptp_previousOrigin;
+
+    if ((os_ptp_previousValid == FALSE) || (origin <= os_ptp_previousOrigin) || (interval > (4U * OS_PTP_SYNC_INTERVAL)))
+    {
+        interval = OS_PTP_SYNC_INTERVAL;
+    }
+
+    os_ptp_status.syncs++;
+    os_ptp_status.offset = offset;
+
+    if ((offset > OS_PTP_STEP_THRESHOLD) || (offset < -OS_PTP_STEP_THRESHOLD))
+    {
+        os_ptp_step(-offset);
+        masterToSlave       -= offset;
+        os_ptp_status.state  = OsPtp_State_uncalibrated;
+    }
+    else if (os_ptp_status.state == OsPtp_State_slave)
+    {
+        os_ptp_servo(offset, interval);
+    }
+    else if ((os_ptp_pathDelayValid != FALSE) && (os_ptp_previousValid != FALSE))
+    {
+        /* The servo starts from the rate of the clock against the master over
+         * the last interval. */
+        os_ptp_drift = (float32)os_ptp_status.frequency
+                       - (((float32)(masterToSlave - os_ptp_previousMasterToSlave) * (float32)OS_PTP_NS_PER_SECOND) / (float32)interval);
+        os_ptp_setFrequency(os_ptp_drift);
+        os_ptp_status.state = OsPtp_State_slave;
+    }
+    else
+    {
+        os_ptp_status.state = OsPtp_State_uncalibrated;
+    }
+
+    os_ptp_sample();
+
+    os_ptp_previousValid         = TRUE;
+    os_ptp_previousMasterToSlave = masterToSlave;
+    os_ptp_previousOrigin        = origin;
+
+    os_ptp_sendDelayReq(masterToSlave);
+}
+
+static void os_ptp_receiveDelayResp(const uint8 *message)
+{
+    uint64 received = os_ptp_getTimestamp(&message[OS_PTP_TIMESTAMP]) - (uint64)os_ptp_getCorrection(message);
+    sint64 delay    = ((sint64)(received - os_ptp_delaySent) + os_ptp_delayMasterToSlave) / 2;
+
+    os_ptp_delayPending = FALSE;
+    os_ptp_status.delayRequests++;
+
+    if (delay < 0)
+    {
+        os_ptp_status.dropped++;
+    }
+    else if (os_ptp_pathDelayValid == FALSE)
+    {
+        os_ptp_pathDelay      = delay;
+        os_ptp_pathDelayValid = TRUE;
+    }
+    else
+    {
+        os_ptp_pathDelay += (delay - os_ptp_pathDelay) / OS_PTP_DELAY_FILTER;
+    }
+
+    os_ptp_status.pathDelay = (uint32)os_ptp_pathDelay;
+}
+
+/* Callback of both ports. */
+static void os_ptp_receive(void *arg, const OsNet_Datagram *datagram)
+{
+    const uint8 *message  = datagram->payload;
+    boolean      isMaster = (boolean)(os_ptp_config.role == OsPtp_Role_master);
+    boolean      handled  = FALSE;
+
+    (void)arg;
+
+    if ((datagram->length >= OS_PTP_MESSAGE_SIZE) && ((message[OS_PTP_VERSION] & 0x0FU) == OS_PTP_VERSION_2)
+        && (message[OS_PTP_DOMAIN] == 0) && (os_ptp_get16(&message[OS_PTP_LENGTH]) <= datagram->length))
+    {
+        uint8  type     = (uint8)(message[OS_PTP_TYPE] & 0x0FU);
+        uint16 sequence = os_ptp_get16(&message[OS_PTP_SEQUENCE]);
+
+        handled = TRUE;
+
+        if ((isMaster != FALSE) && (type == OS_PTP_TYPE_DELAY_REQ))
+        {
+            os_ptp_receiveDelayReq(datagram);
+        }
+        else if ((isMaster != FALSE) || (datagram->sourceIp != os_ptp_config.master))
+        {
+            handled = FALSE;
+        }
+        else if ((type == OS_PTP_TYPE_SYNC) && (datagram->timestamp == 0))
+        {
+            os_ptp_status.missingTimestamps++;
+        }
+        else if ((type == OS_PTP_TYPE_SYNC) && ((os_ptp_get16(&message[OS_PTP_FLAGS]) & OS_PTP_FLAG_TWO_STEP) == 0))
+        {
+            os_ptp_synchronize(os_ptp_getTimestamp(&message[OS_PTP_TIMESTAMP]) + (uint64)os_ptp_getCorrection(message), datagram->timestamp);
+        }
+        else if (type == OS_PTP_TYPE_SYNC)
+        {
+            os_ptp_syncPending    = TRUE;
+            os_ptp_syncSequenceRx = sequence;
+            os_ptp_syncReceived   = datagram->timestamp;
+            os_ptp_syncCorrection = os_ptp_getCorrection(message);
+
+            if (os_ptp_status.state == OsPtp_State_listening)
+            {
+                os_ptp_status.state = OsPtp_State_uncalibrated;
+            }
+        }
+        else if ((type == OS_PTP_TYPE_FOLLOW_UP) && (os_ptp_syncPending != FALSE) && (sequence == os_ptp_syncSequenceRx))
+        {
+            os_ptp_syncPending = FALSE;
+            os_ptp_synchronize(os_ptp_getTimestamp(&message[OS_PTP_TIMESTAMP]) + (uint64)(os_ptp_syncCorrection + os_ptp_getCorrection(message)),
+                os_ptp_syncReceived);
+        }
+        else if ((type == OS_PTP_TYPE_DELAY_RESP) && (datagram->length >= OS_PTP_DELAY_RESP_SIZE) && (os_ptp_delayPending != FALSE)
+                 && (sequence == os_ptp_delaySequence) && (memcmp(&message[OS_PTP_REQUESTING], os_ptp_identity, OS_PTP_IDENTITY_SIZE) == 0))
+        {
+            os_ptp_receiveDelayResp(message);
+        }
+        else
+        {
+            handled = FALSE;
+        }
+    }
+
+    if (handled == FALSE)
+    {
+        os_ptp_status.dropped++;
+    }
+}
+
+void os_ptp_init(const OsPtp_Config *config, const OsPtp_Clock *clock, const uint8 *mac)
+{
+    uint32 coreId = portGET_CORE_ID();
+
+    os_ptp_config = *config;
+    os_ptp_clock  = clock;
+
+    /* EUI-64 from the MAC address, port 1. */
+    memcpy(&os_ptp_identity[0], &mac[0], 3);
+    os_ptp_identity[3] = 0xFF;
+    os_ptp_identity[4] = 0xFE;
+    memcpy(&os_ptp_identity[5], &mac[3], 3);
+    os_ptp_put16(&os_ptp_identity[8], 1);
+
+    os_ptp_status.state = (config->role == OsPtp_Role_master) ? OsPtp_State_master : OsPtp_State_listening;
+    os_ptp_ratio        = (sint64)(((uint64)OS_PTP_NS_PER_SECOND << 32) / clock->localFrequency);
+    os_ptp_sample();
+    os_ptp_nextSync     = os_ptp_sampleNet;
+
+    (void)os_net_bind(OS_PTP_EVENT_PORT, coreId, os_ptp_receive, NULL_PTR);
+    (void)os_net_bind(OS_PTP_GENERAL_PORT, coreId, os_ptp_receive, NULL_PTR);
+}
+
+void os_ptp_poll(void)
+{
+    if (os_ptp_clock != NULL_PTR)
+    {
+        uint64 now = os_ptp_getClock();
+
+        if ((os_ptp_config.role == OsPtp_Role_master) && ((sint64)(now - os_ptp_nextSync) >= 0))
+        {
+            os_ptp_sendSync(now);
+            os_ptp_nextSync += OS_PTP_SYNC_INTERVAL;
+
+            /* Late by more than an interval: restart from now. */
+            if ((sint64)(now - os_ptp_nextSync) >= 0)
+            {
+                os_ptp_nextSync = now + OS_PTP_SYNC_INTERVAL;
+            }
+        }
+
+        /* A slave samples after every Sync, and here only when they stop. */
+        if ((now - os_ptp_sampleNet) >= (((os_ptp_config.role == OsPtp_Role_master) ? 1U : 2U) * OS_PTP_SYNC_INTERVAL))
+        {
+            os_ptp_sample();
+        }
+    }
+}
+
+uint64 os_ptp_toNetworkTime(uint64 local)
+{
+    uint32 sequence;
+    uint64 baseLocal;
+    uint64 baseNet;
+    uint32 whole;
+    uint32 fraction;
+
+    do
+    {
+        sequence  = os_ptp_mapping.sequence;
+        portMEMORY_BARRIER();
+        baseLocal = os_ptp_mapping.baseLocal;
+        baseNet   = os_ptp_mapping.baseNet;
+        whole     = os_ptp_mapping.whole;
+        fraction  = os_ptp_mapping.fraction;
+        portMEMORY_BARRIER();
+    } while (((sequence & 1U) != 0) || (sequence != os_ptp_mapping.sequence));
+
+    /* An event may have been timestamped before the mapping was published. */
+    return (local >= baseLocal) ? (baseNet + os_ptp_scale(local - baseLocal, whole, fraction))
+                                : (baseNet - os_ptp_scale(baseLocal - local, whole, fraction));
+}
+
+uint64 os_ptp_getTime(void)
+{
+    const OsPtp_Clock *clock = os_ptp_clock;
+
+    return (clock != NULL_PTR) ? os_ptp_toNetworkTime(clock->getLocal()) : 0;
+}
+
+void os_ptp_getStatus(OsPtp_Status *status)
+{
+    *status = os_ptp_status;
+}
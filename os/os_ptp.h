@@ -0,0 +1,162 @@
+#ifndef OS_PTP_H
+#define OS_PTP_H
+
+/* IEEE 1588 precision time protocol over UDP/IPv4, and network time for the
+ * tasks of all cores.
+ *
+ * The roles are static: the master sends a two-step Sync and Follow_Up to each
+ * of its slaves by unicast every sync interval, the slaves measure the path
+ * delay with Delay_Req and Delay_Resp (end to end).  All four timestamps are
+ * taken by the hardware clock of the Ethernet driver, OsPtp_Clock, and a PI
+ * servo on every slave steers that clock onto the master: it steps the clock
+ * when the offset is above OS_PTP_STEP_THRESHOLD and adjusts its rate
+ * otherwise.  Network time is the clock of the master in ns since it started,
+ * not TAI.
+ *
+ * The service runs on the receiving core of os_net.h: os_ptp_init() binds the
+ * PTP ports to that core and os_ptp_poll() is called from the same task as
+ * os_net_poll().  After every servo update, and every sync interval, it
+ * publishes a mapping from the local time, STM0, to network time that any core
+ * reads without locking: os_ptp_toNetworkTime() converts an STM0 timestamp
+ * with a few multiplications, so a task can take IfxStm_get() at an event and
+ * convert it later, or call os_ptp_getTime().
+ *
+ * Not supported: the best master clock algorithm and Announce, multicast,
+ * peer delay, transparent clocks and more than one domain. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define OS_PTP_EVENT_PORT                (319)
+#define OS_PTP_GENERAL_PORT              (320)
+
+#ifndef OS_PTP_MAX_SLAVES
+#define OS_PTP_MAX_SLAVES                (4)      /* Slaves a master sends Sync to            */
+#endif
+
+#ifndef OS_PTP_LOG_SYNC_INTERVAL
+#define OS_PTP_LOG_SYNC_INTERVAL         (-3)     /* log2 of the sync interval in s, -7 to 3  */
+#endif
+
+#ifndef OS_PTP_STEP_THRESHOLD
+#define OS_PTP_STEP_THRESHOLD            (100000) /* ns of offset above which the clock steps */
+#endif
+
+#ifndef OS_PTP_MAX_PPB
+#define OS_PTP_MAX_PPB                   (500000) /* Largest rate adjustment of the servo     */
+#endif
+
+/* Gains of the servo, as fractions of the offset removed per sync interval. */
+#ifndef OS_PTP_SERVO_KP
+#define OS_PTP_SERVO_KP                  (0.7f)
+#endif
+
+#ifndef OS_PTP_SERVO_KI
+#define OS_PTP_SERVO_KI                  (0.3f)
+#endif
+
+#ifndef OS_PTP_DELAY_FILTER
+#define OS_PTP_DELAY_FILTER              (8)      /* Path delay averaged over about as many   */
+#endif
+
+#ifndef OS_PTP_RATIO_FILTER
+#define OS_PTP_RATIO_FILTER              (4)      /* Mapping rate averaged over about as many */
+#endif
+
+#ifndef OS_PTP_TX_TIMEOUT
+#define OS_PTP_TX_TIMEOUT                (1000000) /* ns to wait for a transmit timestamp, raise
+                                                    * it above the gate cycle of a gated queue */
+#endif
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* Hardware clock the timestamps of the driver are taken with. */
+typedef struct
+{
+    void   *context;
+
+    /* Returns the clock in ns, and in local the STM0 time at the same
+     * instant. */
+    uint64 (*getTime)(void *context, uint64 *local);
+
+    /* Runs the clock at its nominal rate plus ppb parts per billion. */
+    void (*adjustFrequency)(void *context, sint32 ppb);
+
+    /* Adds offset ns to the clock. */
+    void (*step)(void *context, sint64 offset);
+
+    /* Returns STM0, called by os_ptp_getTime() on any core. */
+    uint64 (*getLocal)(void);
+
+    uint32  localFrequency;      /* Hz of STM0                                                  */
+} OsPtp_Clock;
+
+typedef enum
+{
+    OsPtp_Role_master,
+    OsPtp_Role_slave
+} OsPtp_Role;
+
+/* Addresses in host byte order. */
+typedef struct
+{
+    OsPtp_Role role;
+    uint32     master;                        /* Slave: the master                              */
+    uint32     slaves[OS_PTP_MAX_SLAVES];     /* Master: its slaves, 0 for none                 */
+} OsPtp_Config;
+
+typedef enum
+{
+    OsPtp_State_master,
+    OsPtp_State_listening,       /* Slave without Sync from the master yet                      */
+    OsPtp_State_uncalibrated,    /* Slave measuring the path delay, or stepped                  */
+    OsPtp_State_slave            /* Slave with the servo running                                */
+} OsPtp_State;
+
+/* See os_ptp_getStatus(). */
+typedef struct
+{
+    OsPtp_State state;
+    sint64      offset;              /* ns the clock was ahead of the master at the last Sync   */
+    uint32      pathDelay;           /* ns, filtered                                            */
+    sint32      frequency;           /* ppb the clock runs off its nominal rate                 */
+    uint32      syncs;               /* Sync and Follow_Up pairs sent or used                   */
+    uint32      delayRequests;       /* Delay_Req sent or answered                              */
+    uint32      steps;               /* Times the servo stepped the clock                       */
+    uint32      missingTimestamps;   /* Event messages dropped for lack of a timestamp          */
+    uint32      dropped;             /* Messages malformed, unexpected or not sent              */
+} OsPtp_Status;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Binds the PTP ports to the calling core, which must be the receiving core
+ * of os_net.h.  Called before os_net_init(), with the clock running.  The
+ * clock identity is derived from mac. */
+extern void os_ptp_init(const OsPtp_Config *config, const OsPtp_Clock *clock, const uint8 *mac);
+
+/* Sends the Sync messages that are due on a master, and publishes the
+ * mapping every sync interval.  Called periodically by the task that calls
+ * os_net_poll(), at least as often as the sync interval. */
+extern void os_ptp_poll(void);
+
+/* Converts an STM0 time to network time in ns.  Returns 0 before the first
+ * mapping is published.  Any core. */
+extern uint64 os_ptp_toNetworkTime(uint64 local);
+
+/* Returns the network time now in ns, see os_ptp_toNetworkTime(). */
+extern uint64 os_ptp_getTime(void);
+
+/* Copies the state of the service.  Receiving core only. */
+extern void os_ptp_getStatus(OsPtp_Status *status);
+
+#endif /* OS_PTP_H */
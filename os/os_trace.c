@@ -0,0 +1,76 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "FreeRTOS.h"
+#include "Port/Std/IfxPort.h"
+
+#if ( configUSE_GPIO_TRACE == 1 )
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+/* OMR word that drives the ID pins first..first+2 to id. */
+#define OS_TRACE_CODE(first, id) \
+    ((((unsigned long)(id)) << (first)) | (((~(unsigned long)(id)) & OS_TRACE_ID_MASK) << ((first) + 16)))
+
+/* The ISR pin of a group is the pin above the ID pins. */
+#define OS_TRACE_ISR_SET(first)   (1UL << ((first) + OS_TRACE_ID_BITS))
+#define OS_TRACE_ISR_CLR(first)   (1UL << ((first) + OS_TRACE_ID_BITS + 16))
+
+#define OS_TRACE_CORE(port, first)                                                           \
+    {                                                                                        \
+        (volatile unsigned long *)&(port).OMR.U,                                             \
+        { OS_TRACE_CODE(first, 0), OS_TRACE_CODE(first, 1), OS_TRACE_CODE(first, 2),         \
+          OS_TRACE_CODE(first, 3), OS_TRACE_CODE(first, 4), OS_TRACE_CODE(first, 5),         \
+          OS_TRACE_CODE(first, 6), OS_TRACE_CODE(first, 7) },                                \
+        OS_TRACE_ISR_SET(first),                                                             \
+        OS_TRACE_ISR_CLR(first)                                                              \
+    }
+
+typedef struct
+{
+    Ifx_P *port;
+    uint8  first;           /* Lowest pin of the group, a multiple of 4 */
+} OsTrace_Pins;
+
+/* Pin groups indexed by portGET_CORE_ID(), core ID 5 is not used.  Each group
+ * fills one IOCR register, so the cores never share a read-modify-write of
+ * the port configuration.
+ *
+ *   core 0  P33.0..3     core 3  P33.12..15
+ *   core 1  P33.4..7     core 4  P22.0..3
+ *   core 2  P33.8..11    core 5  P22.4..7
+ *
+ * The lowest pin of a group is ID bit 0, the highest the ISR flag. */
+static const OsTrace_Pins os_trace_pins[configNUM_CORES] = {
+    {&MODULE_P33, 0}, {&MODULE_P33, 4}, {&MODULE_P33, 8}, {&MODULE_P33, 12},
+    {&MODULE_P22, 0}, {NULL_PTR, 0},    {&MODULE_P22, 4}
+};
+
+/* Core ID 5 writes to the OMR of P22 with all bits clear, which has no effect,
+ * should a trace macro ever run there. */
+const OsTrace_Core os_trace_cores[configNUM_CORES] = {
+    OS_TRACE_CORE(MODULE_P33, 0), OS_TRACE_CORE(MODULE_P33, 4), OS_TRACE_CORE(MODULE_P33, 8),
+    OS_TRACE_CORE(MODULE_P33, 12), OS_TRACE_CORE(MODULE_P22, 0),
+    {(volatile unsigned long *)&MODULE_P22.OMR.U, {0}, 0, 0},
+    OS_TRACE_CORE(MODULE_P22, 4)
+};
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+void os_trace_init(void)
+{
+    const OsTrace_Pins *pins = &os_trace_pins[portGET_CORE_ID()];
+    const uint16        mask = (uint16)((1U << OS_TRACE_PINS_PER_CORE) - 1U);
+
+    if (pins->port != NULL_PTR)
+    {
+        IfxPort_setGroupState(pins->port, pins->first, mask, 0);
+        IfxPort_setGroupModeOutput(pins->port, pins->first, mask, IfxPort_OutputMode_pushPull, IfxPort_OutputIdx_general);
+    }
+}
+
+#endif /* configUSE_GPIO_TRACE */
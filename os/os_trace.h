@@ -0,0 +1,72 @@
+#ifndef OS_TRACE_H
+#define OS_TRACE_H
+
+/* GPIO trace backend for the kernel trace macros, included by FreeRTOSConfig.h
+ * when configUSE_GPIO_TRACE is 1.
+ *
+ * Each core drives a group of OS_TRACE_PINS_PER_CORE pins on one port.  The low
+ * OS_TRACE_ID_BITS pins carry the TCB number of the running task, modulo
+ * 2^OS_TRACE_ID_BITS, and the top pin is high while an interrupt of the port
+ * runs.  Every event is a single store of a precomputed word to the OMR
+ * register of the port.  OMR sets and clears pins in the same write, so a
+ * logic analyser never sees an intermediate task ID.
+ *
+ * Application interrupts can be traced the same way with traceISR_ENTER() and
+ * traceISR_EXIT().  The ISR pin is a flag, not a counter, so it only shows
+ * interrupts correctly while they do not nest.
+ *
+ * tools/trace_decode.py turns a logic analyser CSV export into per-core
+ * timelines.  The pin groups are listed in os_trace.c. */
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+    #error configUSE_TRACE_FACILITY must be set to 1 for the GPIO trace, it provides the TCB numbers
+#endif
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* The code tables of os_trace.c are written out for 3 ID bits. */
+#define OS_TRACE_ID_BITS           (3)
+#define OS_TRACE_ID_MASK           ((1UL << OS_TRACE_ID_BITS) - 1UL)
+#define OS_TRACE_PINS_PER_CORE     (OS_TRACE_ID_BITS + 1)
+
+#define traceTASK_SWITCHED_IN()                                                                      \
+    {                                                                                                \
+        const OsTrace_Core *pxTraceCore = &os_trace_cores[portGET_CORE_ID()];                        \
+        *pxTraceCore->omr = pxTraceCore->taskCodes[pxCurrentTCB->uxTCBNumber & OS_TRACE_ID_MASK];    \
+    }
+
+#define traceISR_ENTER()    ( *os_trace_cores[portGET_CORE_ID()].omr = os_trace_cores[portGET_CORE_ID()].isrEnter )
+#define traceISR_EXIT()     ( *os_trace_cores[portGET_CORE_ID()].omr = os_trace_cores[portGET_CORE_ID()].isrExit )
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/* The OMR words of one core.  The lower half of an OMR word sets pins, the
+ * upper half clears them. */
+typedef struct
+{
+    volatile unsigned long *omr;                                /* OMR register of the port                 */
+    unsigned long           taskCodes[OS_TRACE_ID_MASK + 1UL];  /* Drives the ID pins to the index          */
+    unsigned long           isrEnter;                           /* Sets the ISR pin                         */
+    unsigned long           isrExit;                            /* Clears the ISR pin                       */
+} OsTrace_Core;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+/* Indexed by portGET_CORE_ID(). */
+extern const OsTrace_Core os_trace_cores[configNUM_CORES];
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Makes the pin group of the calling core a push-pull output and drives it
+ * low.  Called by every core before it creates its tasks. */
+extern void os_trace_init(void);
+
+#endif /* OS_TRACE_H */
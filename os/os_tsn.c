@@ -0,0 +1,202 @@
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "os_tsn.h"
+
+/******************************************************************************/
+/*-------------------------Private Variables/Constants------------------------*/
+/******************************************************************************/
+
+#define OS_TSN_NS_PER_SECOND             (1000000000ULL)
+#define OS_TSN_CREDIT_SCALE              (1024ULL)
+
+/******************************************************************************/
+/*--------------------------Function Implementations--------------------------*/
+/******************************************************************************/
+
+/* Bits the MAC transmits per clock cycle, the unit of the slope registers:
+ * 8 on GMII/RGMII at 1000 Mbps, 4 on MII. */
+static uint64 os_tsn_bitsPerCycle(uint32 linkRate)
+{
+    return (linkRate >= 1000000000U) ? 8U : 4U;
+}
+
+uint32 os_tsn_getFrameTime(uint32 size, uint32 linkRate)
+{
+    uint64 bits = ((uint64)size + OS_TSN_FRAME_OVERHEAD) * 8U;
+
+    return (uint32)(((bits * OS_TSN_NS_PER_SECOND) + linkRate - 1U) / linkRate);
+}
+
+uint32 os_tsn_getCycle(const OsTsn_Config *config)
+{
+    uint32 cycle = 0;
+    uint32 entry;
+
+    for (entry = 0; entry < config->gateListLength; entry++)
+    {
+        cycle += config->gateList[entry].interval;
+    }
+
+    return cycle;
+}
+
+/* Checks every window against the frames of its queues and the guard band,
+ * and the time each queue is open against its idleSlope. */
+static OsTsn_Result os_tsn_checkGates(const OsTsn_Config *config, uint32 linkRate)
+{
+    OsTsn_Result result = OsTsn_Result_ok;
+    uint64       open[OS_TSN_QUEUES] = {0};
+    uint64       cycle = 0;
+    uint32       frameTime[OS_TSN_QUEUES];
+    uint8        queues = (uint8)((1U << config->numClasses) - 1U);
+    uint8        opened = 0;
+    uint32       entry;
+    uint32       queue;
+
+    for (queue = 0; queue < config->numClasses; queue++)
+    {
+        frameTime[queue] = os_tsn_getFrameTime(config->classes[queue].maxFrameSize, linkRate);
+    }
+
+    for (entry = 0; (result == OsTsn_Result_ok) && (entry < config->gateListLength); entry++)
+    {
+        const OsTsn_GateEntry *current  = &config->gateList[entry];
+        uint8                  previous = config->gateList[(entry + config->gateListLength - 1U) % config->gateListLength].gates;
+        uint8                  closing  = (uint8)(previous & ~current->gates);
+        uint64                 guard    = OS_TSN_GATE_LATENCY;
+
+        if ((current->interval == 0) || ((current->gates & ~queues) != 0))
+        {
+            result = OsTsn_Result_invalid;
+        }
+
+        /* A queue that closes still sends the frame on the wire and the one
+         * in its MTL queue. */
+        for (queue = 0; queue < config->numClasses; queue++)
+        {
+            if ((closing & (1U << queue)) != 0)
+            {
+                guard += 2U * (uint64)frameTime[queue];
+            }
+        }
+
+        for (queue = 0; (result == OsTsn_Result_ok) && (queue < config->numClasses); queue++)
+        {
+            if ((current->gates & (1U << queue)) != 0)
+            {
+                if (current->interval < (guard + frameTime[queue]))
+                {
+                    result = OsTsn_Result_gateTooShort;
+                }
+                else
+                {
+                    open[queue] += current->interval - guard;
+                }
+            }
+        }
+
+        opened |= current->gates;
+        cycle  += current->interval;
+    }
+
+    if ((result == OsTsn_Result_ok) && ((opened != queues) || (cycle > OS_TSN_MAX_CYCLE) || (config->phase >= cycle)))
+    {
+        result = OsTsn_Result_invalid;
+    }
+
+    for (queue = 1; (result == OsTsn_Result_ok) && (queue < config->numClasses); queue++)
+    {
+        if ((open[queue] * linkRate) < ((uint64)config->classes[queue].idleSlope * cycle))
+        {
+            result = OsTsn_Result_overbooked;
+        }
+    }
+
+    return result;
+}
+
+OsTsn_Result os_tsn_check(const OsTsn_Config *config, uint32 linkRate)
+{
+    OsTsn_Result result   = OsTsn_Result_ok;
+    uint64       reserved = 0;
+    uint32       queue;
+
+    if ((linkRate == 0) || (config->numClasses == 0) || (config->numClasses > OS_TSN_QUEUES)
+        || (config->gateListLength > OS_TSN_GATE_ENTRIES) || (config->classes[0].shaper != OsTsn_Shaper_strictPriority))
+    {
+        result = OsTsn_Result_invalid;
+    }
+
+    for (queue = 0; (result == OsTsn_Result_ok) && (queue < config->numClasses); queue++)
+    {
+        const OsTsn_Class *trafficClass = &config->classes[queue];
+
+        if ((trafficClass->maxFrameSize < OS_TSN_MIN_FRAME_SIZE) || (trafficClass->maxFrameSize > OS_TSN_MAX_FRAME_SIZE))
+        {
+            result = OsTsn_Result_invalid;
+        }
+        else if (queue != 0)
+        {
+            /* The shaper must be able to represent the slope, and the other
+             * queues above 0 must say what they send. */
+            if ((trafficClass->idleSlope == 0)
+                || ((trafficClass->shaper == OsTsn_Shaper_creditBased)
+                    && (((uint64)trafficClass->idleSlope * OS_TSN_CREDIT_SCALE * os_tsn_bitsPerCycle(linkRate)) < linkRate)))
+            {
+                result = OsTsn_Result_invalid;
+            }
+
+            reserved += trafficClass->idleSlope;
+        }
+    }
+
+    if ((result == OsTsn_Result_ok) && ((reserved * 100U) > ((uint64)linkRate * OS_TSN_MAX_RESERVATION)))
+    {
+        result = OsTsn_Result_overbooked;
+    }
+
+    if ((result == OsTsn_Result_ok) && (config->gateListLength != 0))
+    {
+        result = os_tsn_checkGates(config, linkRate);
+    }
+
+    return result;
+}
+
+void os_tsn_getShaper(const OsTsn_Config *config, uint32 queue, uint32 linkRate, OsTsn_ShaperRegisters *registers)
+{
+    uint64 idleSlope    = config->classes[queue].idleSlope;
+    uint64 lowerFrame   = 0;
+    uint64 higherFrames = 0;
+    uint64 higherSlope  = 0;
+    uint64 hiCredit;
+    uint64 loCredit;
+    uint32 other;
+
+    for (other = 0; other < config->numClasses; other++)
+    {
+        uint64 frameBits = ((uint64)config->classes[other].maxFrameSize + OS_TSN_FRAME_OVERHEAD) * 8U;
+
+        if ((other < queue) && (frameBits > lowerFrame))
+        {
+            lowerFrame = frameBits;
+        }
+        else if (other > queue)
+        {
+            higherFrames += frameBits;
+            higherSlope  += config->classes[other].idleSlope;
+        }
+    }
+
+    /* Credit gained while a lower frame finishes and the higher queues send
+     * at their rate, and lost sending one largest frame of the queue. */
+    hiCredit = ((idleSlope * lowerFrame) / (linkRate - higherSlope)) + ((idleSlope * higherFrames) / linkRate);
+    loCredit = (((uint64)config->classes[queue].maxFrameSize * 8U) * (linkRate - idleSlope)) / linkRate;
+
+    registers->idleSlope = (uint32)((idleSlope * OS_TSN_CREDIT_SCALE * os_tsn_bitsPerCycle(linkRate)) / linkRate);
+    registers->sendSlope = (uint32)(((linkRate - idleSlope) * OS_TSN_CREDIT_SCALE * os_tsn_bitsPerCycle(linkRate)) / linkRate);
+    registers->hiCredit  = (uint32)(hiCredit * OS_TSN_CREDIT_SCALE) & OS_TSN_CREDIT_MASK;
+    registers->loCredit  = (0U - (uint32)(loCredit * OS_TSN_CREDIT_SCALE)) & OS_TSN_CREDIT_MASK;
+}
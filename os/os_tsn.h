@@ -0,0 +1,130 @@
+#ifndef OS_TSN_H
+#define OS_TSN_H
+
+/* Traffic classes of the GETH transmit queues: IEEE 802.1Qav credit based
+ * shaper per queue, a time-aware gate list, and the admission control of both.
+ *
+ * Every transmit queue carries one traffic class, the class of queue n is
+ * classes[n].  The MTL schedules the queues by strict priority, the queue with
+ * the higher number first; queue 0 carries the best effort traffic and has no
+ * shaper.  A credit based queue sends at most idleSlope on average and delays
+ * the lower queues by at most its hiCredit.  A strict priority queue above 0
+ * is not limited by the hardware: its idleSlope is the rate its senders
+ * promise, and admission control relies on it.
+ *
+ * GETH has no gate control hardware.  The gate list is run by the driver from
+ * an STM compare interrupt: a closed gate stops the transmit DMA of its queue,
+ * which lets the frame on the wire and the frame already in the MTL queue go
+ * out.  Admission control therefore requires every window to be longer than
+ * its own frames plus a guard band of those two frames of each queue that
+ * closes, plus OS_TSN_GATE_LATENCY.  Cycles start at multiples of the cycle
+ * time on the STM, phase ns later.
+ *
+ * This file holds no hardware access, see os_net_geth.c for the driver. */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Types.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define OS_TSN_QUEUES                    (4)      /* Transmit queues of GETH                  */
+
+#ifndef OS_TSN_MAX_RESERVATION
+#define OS_TSN_MAX_RESERVATION           (75)     /* Percent of the link queues 1 to 3 may use */
+#endif
+
+#ifndef OS_TSN_GATE_ENTRIES
+#define OS_TSN_GATE_ENTRIES              (8)      /* Longest gate list                        */
+#endif
+
+#ifndef OS_TSN_GATE_LATENCY
+#define OS_TSN_GATE_LATENCY              (2000)   /* ns from a gate switch to the DMA seeing it */
+#endif
+
+#define OS_TSN_MAX_CYCLE                 (1000000000U)  /* ns                                  */
+
+/* Frame sizes with FCS, and the preamble and inter-frame gap a frame also
+ * occupies the link for. */
+#define OS_TSN_MIN_FRAME_SIZE            (64)
+#define OS_TSN_MAX_FRAME_SIZE            (1518)
+#define OS_TSN_FRAME_OVERHEAD            (8 + 12)
+
+/* Width of the HICREDIT and LOCREDIT fields. */
+#define OS_TSN_CREDIT_MASK               (0x1FFFFFFFU)
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+typedef enum
+{
+    OsTsn_Shaper_strictPriority,
+    OsTsn_Shaper_creditBased
+} OsTsn_Shaper;
+
+/* Traffic class of one transmit queue. */
+typedef struct
+{
+    OsTsn_Shaper shaper;
+    uint32       idleSlope;      /* bit/s the queue may send, ignored for queue 0                */
+    uint16       maxFrameSize;   /* Largest frame of the class with FCS, larger ones are not sent */
+} OsTsn_Class;
+
+typedef struct
+{
+    uint32 interval;             /* ns                                                           */
+    uint8  gates;                /* Bit n set: queue n may start frames                          */
+} OsTsn_GateEntry;
+
+typedef struct
+{
+    OsTsn_Class     classes[OS_TSN_QUEUES];
+    uint32          numClasses;                  /* Queues in use, from queue 0                  */
+    OsTsn_GateEntry gateList[OS_TSN_GATE_ENTRIES];
+    uint32          gateListLength;              /* 0: the gates stay open                       */
+    uint32          phase;                       /* ns, less than the cycle                      */
+} OsTsn_Config;
+
+/* Register values of the credit based shaper of one queue, credits in bits
+ * scaled by 1024. */
+typedef struct
+{
+    uint32 idleSlope;            /* MTL_TXQ_QUANTUM_WEIGHT.ISCQW                                 */
+    uint32 sendSlope;            /* MTL_TXQ_SENDSLOPECREDIT.SSC                                  */
+    uint32 hiCredit;             /* MTL_TXQ_HICREDIT.HC                                          */
+    uint32 loCredit;             /* MTL_TXQ_LOCREDIT.LC, negative                                */
+} OsTsn_ShaperRegisters;
+
+typedef enum
+{
+    OsTsn_Result_ok,
+    OsTsn_Result_invalid,        /* Out of range, queue 0 shaped, or a queue that never opens    */
+    OsTsn_Result_overbooked,     /* More than OS_TSN_MAX_RESERVATION of the link, or a queue open
+                                  * for less time than its idleSlope needs                       */
+    OsTsn_Result_gateTooShort    /* A window shorter than its frames and guard band              */
+} OsTsn_Result;
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/* Admission control of config on a link of linkRate bit/s. */
+extern OsTsn_Result os_tsn_check(const OsTsn_Config *config, uint32 linkRate);
+
+/* Computes the shaper registers of queue, which must be 1 or above, of a
+ * config accepted by os_tsn_check().  hiCredit is the IEEE 802.1Q Annex L
+ * bound: one largest frame of the lower queues, plus one largest frame of
+ * each higher queue. */
+extern void os_tsn_getShaper(const OsTsn_Config *config, uint32 queue, uint32 linkRate, OsTsn_ShaperRegisters *registers);
+
+/* Returns the ns a frame of size bytes with FCS occupies the link. */
+extern uint32 os_tsn_getFrameTime(uint32 size, uint32 linkRate);
+
+/* Returns the cycle time of the gate list in ns, 0 without one. */
+extern uint32 os_tsn_getCycle(const OsTsn_Config *config);
+
+#endif /* OS_TSN_H */
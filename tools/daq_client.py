@@ -0,0 +1,402 @@
+#!/usr/bin/env python3
+"""
+Host client for the measurement and calibration protocol of the shell.
+
+Talks the XCP subset of Libraries/Service/CpuGeneric/SysSe/Comm/Ifx_Daq.c
+over a serial port or a TCP stream:
+
+  info                          connect and print the DAQ capabilities
+  read ADDR SIZE                upload memory and print it as hex
+  write ADDR HEX                download bytes to memory
+  measure --signal NAME=ADDR:TYPE ...
+                                run a DAQ list and record the samples
+
+Usage:
+    tools/daq_client.py --serial /dev/ttyUSB0 --shell info
+    tools/daq_client.py --tcp 192.168.0.10:5555 read 0x70000000 16
+    tools/daq_client.py --serial /dev/ttyUSB0 --shell measure \\
+        --signal speed=0x70001000:f32 --signal state=0x70001004:u8 \\
+        --event 1 --duration 5 -o speed.csv
+
+Addresses and sizes accept C notation (0x...).  TYPE is one of u8, s8, u16,
+s16, u32, s32 or f32.  '--shell' first sends "protocol start" to the shell
+command line; without it the target must already run the protocol.
+
+The signals of 'measure' are packed into as few ODTs as the maximum DAQ
+packet size allows, in the given order, into DAQ list 0.  The samples are
+written as CSV with the target time in seconds, taken from the timestamp
+of the first ODT.  At the end the client prints the samples and signals per
+second received and the dropped frames, the latter detected from gaps in
+the frame counter and from incomplete samples.
+"""
+
+import argparse
+import os
+import select
+import socket
+import struct
+import sys
+import time
+
+CMD_CONNECT = 0xFF
+CMD_DISCONNECT = 0xFE
+CMD_GET_STATUS = 0xFD
+CMD_SET_MTA = 0xF6
+CMD_SHORT_UPLOAD = 0xF4
+CMD_DOWNLOAD = 0xF0
+CMD_SET_DAQ_PTR = 0xE2
+CMD_WRITE_DAQ = 0xE1
+CMD_SET_DAQ_LIST_MODE = 0xE0
+CMD_START_STOP_DAQ_LIST = 0xDE
+CMD_START_STOP_SYNCH = 0xDD
+CMD_GET_DAQ_CLOCK = 0xDC
+CMD_GET_DAQ_PROCESSOR_INFO = 0xDA
+CMD_GET_DAQ_RESOLUTION_INFO = 0xD9
+CMD_FREE_DAQ = 0xD6
+CMD_ALLOC_DAQ = 0xD5
+CMD_ALLOC_ODT = 0xD4
+CMD_ALLOC_ODT_ENTRY = 0xD3
+
+MODE_TIMESTAMP = 0x10
+TIMESTAMP_SIZE = 4
+
+ERR_CMD_BUSY = 0x10
+BUSY_RETRIES = 10
+BUSY_DELAY = 0.01
+
+ERRORS = {
+    0x10: 'busy',
+    0x11: 'DAQ active',
+    0x20: 'unknown command',
+    0x21: 'command syntax',
+    0x22: 'out of range',
+    0x29: 'sequence',
+    0x2A: 'DAQ configuration',
+    0x30: 'memory overflow',
+}
+
+TYPES = {
+    'u8': 'B', 's8': 'b', 'u16': 'H', 's16': 'h', 'u32': 'I', 's32': 'i', 'f32': 'f',
+}
+
+
+class ConfigError(Exception):
+    pass
+
+
+class ProtocolError(Exception):
+    pass
+
+
+def parse_int(text):
+    try:
+        return int(text, 0)
+    except ValueError:
+        raise ConfigError('"%s" is not a number' % text)
+
+
+def parse_signal(spec):
+    try:
+        name, rest = spec.split('=', 1)
+        address, type_name = rest.split(':', 1)
+    except ValueError:
+        raise ConfigError('signal "%s" is not NAME=ADDR:TYPE' % spec)
+    if type_name not in TYPES:
+        raise ConfigError('signal "%s": type must be one of %s' % (spec, ', '.join(sorted(TYPES))))
+    return name, parse_int(address), TYPES[type_name]
+
+
+class SerialTransport(object):
+    def __init__(self, path, baudrate):
+        import termios
+        import tty
+        speed = getattr(termios, 'B%d' % baudrate, None)
+        if speed is None:
+            raise ConfigError('baud rate %d is not supported by termios' % baudrate)
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        attr = termios.tcgetattr(self.fd)
+        attr[4] = attr[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attr)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+
+    def write(self, data):
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def read(self, count, timeout):
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        return os.read(self.fd, count) if ready else b''
+
+    def close(self):
+        os.close(self.fd)
+
+
+class TcpTransport(object):
+    def __init__(self, spec):
+        try:
+            host, port = spec.rsplit(':', 1)
+            self.sock = socket.create_connection((host, int(port)), timeout=5)
+        except ValueError:
+            raise ConfigError('"%s" is not HOST:PORT' % spec)
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def write(self, data):
+        self.sock.sendall(data)
+
+    def read(self, count, timeout):
+        ready, _, _ = select.select([self.sock], [], [], timeout)
+        return self.sock.recv(count) if ready else b''
+
+    def close(self):
+        self.sock.close()
+
+
+class Xcp(object):
+    def __init__(self, transport, timeout=1.0):
+        self.transport = transport
+        self.timeout = timeout
+        self.buffer = b''
+        self.counter = 0
+        self.rx_counter = None
+        self.lost = 0
+        self.daq = []
+        self.max_cto = 8
+        self.max_dto = 8
+
+    def frame(self, timeout):
+        """Returns the next packet received, or None on timeout."""
+        deadline = time.monotonic() + timeout
+        while True:
+            if len(self.buffer) >= 4:
+                length, counter = struct.unpack_from('<HH', self.buffer)
+                if len(self.buffer) >= 4 + length:
+                    packet = self.buffer[4:4 + length]
+                    self.buffer = self.buffer[4 + length:]
+                    if self.rx_counter is not None and counter != self.rx_counter:
+                        self.lost += (counter - self.rx_counter) & 0xFFFF
+                    self.rx_counter = (counter + 1) & 0xFFFF
+                    return packet
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                return None
+            self.buffer += self.transport.read(4096, remaining)
+
+    def command(self, *fields):
+        # The target answers busy while an event still samples a list that the
+        # command changes; the command is repeated, as XCP specifies.
+        for _ in range(BUSY_RETRIES):
+            packet = self.request(fields)
+            if packet[0] == 0xFF:
+                return packet
+            code = packet[1] if len(packet) > 1 else 0
+            if code != ERR_CMD_BUSY:
+                break
+            time.sleep(BUSY_DELAY)
+        raise ProtocolError('command 0x%02X: error 0x%02X (%s)' % (
+            fields[0], code, ERRORS.get(code, 'unknown')))
+
+    def request(self, fields):
+        packet = bytes(fields)
+        self.transport.write(struct.pack('<HH', len(packet), self.counter) + packet)
+        self.counter = (self.counter + 1) & 0xFFFF
+        deadline = time.monotonic() + self.timeout
+        while True:
+            packet = self.frame(max(0.0, deadline - time.monotonic()))
+            if packet is None:
+                raise ProtocolError('no response to command 0x%02X' % fields[0])
+            if packet and packet[0] in (0xFF, 0xFE):
+                return packet
+            self.daq.append(packet)
+
+    def connect(self):
+        packet = self.command(CMD_CONNECT, 0)
+        self.max_cto = packet[3]
+        self.max_dto = struct.unpack_from('<H', packet, 4)[0]
+        self.rx_counter = None
+        self.lost = 0
+
+    def disconnect(self):
+        self.command(CMD_DISCONNECT)
+
+    def upload(self, address, size):
+        data = b''
+        while len(data) < size:
+            count = min(size - len(data), self.max_cto - 1)
+            packet = self.command(CMD_SHORT_UPLOAD, count, 0, 0, *struct.pack('<I', address + len(data)))
+            data += packet[1:1 + count]
+        return data
+
+    def download(self, address, data):
+        self.command(CMD_SET_MTA, 0, 0, 0, *struct.pack('<I', address))
+        for offset in range(0, len(data), self.max_cto - 2):
+            chunk = data[offset:offset + self.max_cto - 2]
+            self.command(CMD_DOWNLOAD, len(chunk), *chunk)
+
+    def processor_info(self):
+        packet = self.command(CMD_GET_DAQ_PROCESSOR_INFO)
+        properties, max_daq, max_event = struct.unpack_from('<BHH', packet, 1)
+        return properties, max_daq, max_event
+
+    def timestamp_ns(self):
+        packet = self.command(CMD_GET_DAQ_RESOLUTION_INFO)
+        mode, ticks = struct.unpack_from('<BH', packet, 5)
+        unit = 10 ** (mode >> 4)
+        return ticks * unit
+
+
+def pack_odts(signals, max_dto):
+    """Splits the signals into ODTs: lists of (name, address, format)."""
+    odts = [[]]
+    room = max_dto - 1 - TIMESTAMP_SIZE
+    for signal in signals:
+        size = struct.calcsize('<' + signal[2])
+        if size > max_dto - 1 - TIMESTAMP_SIZE:
+            raise ConfigError('signal %s does not fit into a DAQ packet' % signal[0])
+        if size > room:
+            odts.append([])
+            room = max_dto - 1
+        odts[-1].append(signal)
+        room -= size
+    return odts
+
+
+def configure(xcp, odts, event, prescaler):
+    xcp.command(CMD_FREE_DAQ)
+    xcp.command(CMD_ALLOC_DAQ, 0, 1, 0)
+    xcp.command(CMD_ALLOC_ODT, 0, 0, 0, len(odts))
+    for index, odt in enumerate(odts):
+        xcp.command(CMD_ALLOC_ODT_ENTRY, 0, 0, 0, index, len(odt))
+    for index, odt in enumerate(odts):
+        xcp.command(CMD_SET_DAQ_PTR, 0, 0, 0, index, 0)
+        for _, address, fmt in odt:
+            xcp.command(CMD_WRITE_DAQ, 0xFF, struct.calcsize('<' + fmt), 0, *struct.pack('<I', address))
+    xcp.command(CMD_SET_DAQ_LIST_MODE, MODE_TIMESTAMP, 0, 0, *struct.pack('<HBB', event, prescaler, 0))
+
+
+def measure(xcp, args, out):
+    signals = [parse_signal(s) for s in args.signal]
+    odts = pack_odts(signals, xcp.max_dto)
+    tick_ns = xcp.timestamp_ns()
+    configure(xcp, odts, args.event, args.prescaler)
+    formats = ['<' + ''.join(fmt for _, _, fmt in odt) for odt in odts]
+
+    out.write('time_s,%s\n' % ','.join(name for name, _, _ in signals))
+    first_pid = xcp.command(CMD_START_STOP_DAQ_LIST, 1, 0, 0)[1]
+    start = time.monotonic()
+    samples = incomplete = 0
+    row = None
+    base = None
+    try:
+        while time.monotonic() - start < args.duration:
+            packet = xcp.daq.pop(0) if xcp.daq else xcp.frame(0.1)
+            if not packet or packet[0] >= 0xFC:
+                continue
+            odt = packet[0] - first_pid
+            if odt < 0 or odt >= len(odts):
+                raise ProtocolError('unexpected PID 0x%02X' % packet[0])
+            data = packet[1:]
+            if odt == 0:
+                if row is not None:
+                    incomplete += 1
+                stamp = struct.unpack_from('<I', data)[0]
+                base = stamp if base is None else base
+                row = [((stamp - base) & 0xFFFFFFFF) * tick_ns * 1e-9]
+                data = data[TIMESTAMP_SIZE:]
+            elif row is None or len(row) != 1 + sum(len(o) for o in odts[:odt]):
+                incomplete += 1
+                row = None
+                continue
+            row.extend(struct.unpack_from(formats[odt], data))
+            if odt == len(odts) - 1:
+                out.write('%.9f,%s\n' % (row[0], ','.join(repr(v) for v in row[1:])))
+                samples += 1
+                row = None
+    finally:
+        elapsed = time.monotonic() - start
+        xcp.command(CMD_START_STOP_SYNCH, 0)
+
+    sys.stderr.write('%d samples in %.3f s, %.0f samples/s, %.0f signals/s\n' % (
+        samples, elapsed, samples / elapsed, samples * len(signals) / elapsed))
+    sys.stderr.write('%d ODTs per sample, %d frames lost, %d samples incomplete\n' % (
+        len(odts), xcp.lost, incomplete))
+
+
+def run(xcp, args):
+    xcp.connect()
+    try:
+        if args.action == 'info':
+            properties, max_daq, max_event = xcp.processor_info()
+            status = xcp.command(CMD_GET_STATUS)[1]
+            clock = struct.unpack_from('<I', xcp.command(CMD_GET_DAQ_CLOCK), 4)[0]
+            print('MAX_CTO %d, MAX_DTO %d' % (xcp.max_cto, xcp.max_dto))
+            print('DAQ lists %d, event channels %d, properties 0x%02X' % (max_daq, max_event, properties))
+            print('timestamp %d ns per tick, clock 0x%08X' % (xcp.timestamp_ns(), clock))
+            print('DAQ %s' % ('running' if status & 0x40 else 'stopped'))
+        elif args.action == 'read':
+            data = xcp.upload(parse_int(args.address), parse_int(args.size))
+            for offset in range(0, len(data), 16):
+                print('%08X  %s' % (parse_int(args.address) + offset,
+                                    ' '.join('%02X' % b for b in data[offset:offset + 16])))
+        elif args.action == 'write':
+            try:
+                data = bytes.fromhex(args.data)
+            except ValueError:
+                raise ConfigError('"%s" is not a hex string' % args.data)
+            xcp.download(parse_int(args.address), data)
+        elif args.output:
+            with open(args.output, 'w') as f:
+                measure(xcp, args, f)
+        else:
+            measure(xcp, args, sys.stdout)
+    finally:
+        xcp.disconnect()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    link = parser.add_mutually_exclusive_group(required=True)
+    link.add_argument('--serial', metavar='DEVICE', help='serial port, e.g. /dev/ttyUSB0')
+    link.add_argument('--tcp', metavar='HOST:PORT', help='TCP stream')
+    parser.add_argument('--baud', type=int, default=115200, help='serial baud rate, default 115200')
+    parser.add_argument('--shell', action='store_true', help='send "protocol start" to the shell first')
+    actions = parser.add_subparsers(dest='action', required=True)
+    actions.add_parser('info', help='print the DAQ capabilities')
+    read = actions.add_parser('read', help='upload memory')
+    read.add_argument('address')
+    read.add_argument('size')
+    write = actions.add_parser('write', help='download memory')
+    write.add_argument('address')
+    write.add_argument('data', help='bytes as a hex string, e.g. 0a0b0c')
+    daq = actions.add_parser('measure', help='record signals with a DAQ list')
+    daq.add_argument('--signal', action='append', required=True, metavar='NAME=ADDR:TYPE',
+                     help='signal to record, may be repeated')
+    daq.add_argument('--event', type=int, default=0, help='event channel, default 0')
+    daq.add_argument('--prescaler', type=int, default=1, help='sample every Nth event, default 1')
+    daq.add_argument('--duration', type=float, default=1.0, help='seconds to record, default 1')
+    daq.add_argument('-o', '--output', help='samples CSV, standard output if omitted')
+    args = parser.parse_args()
+
+    transport = None
+    try:
+        if args.serial:
+            transport = SerialTransport(args.serial, args.baud)
+        else:
+            transport = TcpTransport(args.tcp)
+        if args.shell:
+            transport.write(b'protocol start\r\n')
+            # Drop the echo of the command line
+            while transport.read(4096, 0.2):
+                pass
+        run(Xcp(transport), args)
+    except (ConfigError, ProtocolError, OSError) as e:
+        sys.stderr.write('daq_client: %s\n' % e)
+        return 1
+    finally:
+        if transport is not None:
+            transport.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,220 @@
+/* Host harness for the DAQ engine of
+ * Libraries/Service/CpuGeneric/SysSe/Comm/Ifx_Daq.c, driven by
+ * tools/daq_client.py over a TCP loopback.
+ *
+ * The engine is compiled unchanged against the stand-ins in
+ * tools/daq_sim/include.  The main thread runs Ifx_Daq_protocolExecute() on
+ * the accepted connection, as the shell task does on the target.  A second
+ * thread, the sampling core, updates a block of signals and raises event
+ * channel 1 after each update.  The signals live at SIM_SIGNALS, a fixed
+ * 32-bit address, so that the client can name them as on the target:
+ *
+ *     word 0       u32  update counter
+ *     word 1       f32  counter / 2
+ *     word 2..63   u32  counter + word index
+ *
+ * When the client disconnects, the harness prints the overruns of DAQ list 0,
+ * the events raised while it ran and the mean host time of Ifx_Daq_event()
+ * over them, then waits for the next connection.
+ *
+ * Build and run:
+ *     cc -O2 -pthread -Itools/daq_sim/include \
+ *         -ILibraries/Service/CpuGeneric -ILibraries/Service/CpuGeneric/SysSe/Comm \
+ *         -o daq_sim tools/daq_sim/daq_sim.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Comm/Ifx_Daq.c
+ *     ./daq_sim [PORT [EVENT_PERIOD_US]] &
+ *     tools/daq_client.py --tcp 127.0.0.1:5555 measure --event 1 --duration 5 \
+ *         --signal count=0x10000000:u32 --signal half=0x10000004:f32 ...
+ *
+ * The defaults are port 5555 and an event every 100 us.  The times printed
+ * are host times, not TriCore cycles, and the loopback is far faster than a
+ * serial line, so the rates say nothing about the target. */
+
+#define _GNU_SOURCE
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "SysSe/Comm/Ifx_Daq.h"
+#include "Stm/Std/IfxStm.h"
+
+#define SIM_SIGNALS        (0x10000000UL)
+#define SIM_SIGNAL_WORDS   (64)
+#define SIM_EVENT          (1)
+#define SIM_SEND_BUFFER    (60000)      /* Unsent bytes above which the pipe is full */
+#define SIM_POLL_US        (50)
+
+Ifx_STM MODULE_STM0;
+
+static Ifx_Daq            sim_daq;
+static Ifx_Shell          sim_shell;
+static volatile uint32   *sim_signals;
+static unsigned           sim_eventPeriod = 100;
+
+/* Event statistics of the current connection, written by the sampling thread */
+static volatile double    sim_eventTime;
+static volatile unsigned long sim_eventCount;
+
+void Ifx_Shell_protocolStop(Ifx_Shell *shell)
+{
+    shell->protocolStarted = FALSE;
+}
+
+
+boolean IfxStdIf_DPipe_canWriteCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    int queued = 0;
+
+    (void)count;
+    ioctl(stdif->socket, TIOCOUTQ, &queued);
+
+    /* A blocking write (a command response) always goes ahead */
+    return (timeout != 0) || (queued < SIM_SEND_BUFFER);
+}
+
+
+boolean IfxStdIf_DPipe_write(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    (void)timeout;
+    return send(stdif->socket, data, (size_t)*count, MSG_NOSIGNAL) == *count;
+}
+
+
+boolean IfxStdIf_DPipe_read(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    ssize_t received = recv(stdif->socket, data, (size_t)*count, MSG_DONTWAIT);
+
+    (void)timeout;
+    *count = (received > 0) ? (Ifx_SizeT)received : 0;
+    return TRUE;
+}
+
+
+sint32 IfxStdIf_DPipe_getReadCount(IfxStdIf_DPipe *stdif)
+{
+    int pending = 0;
+
+    ioctl(stdif->socket, FIONREAD, &pending);
+    return pending;
+}
+
+
+static double sim_seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec * 1.0e-9);
+}
+
+
+/* The sampling core */
+static void *sim_sample(void *arg)
+{
+    uint32 counter = 0;
+    double start;
+    int    word;
+
+    (void)arg;
+
+    for (;;)
+    {
+        counter++;
+        sim_signals[0]                        = counter;
+        ((volatile float32 *)sim_signals)[1] = (float32)counter * 0.5f;
+
+        for (word = 2; word < SIM_SIGNAL_WORDS; word++)
+        {
+            sim_signals[word] = counter + (uint32)word;
+        }
+
+        start = sim_seconds();
+        Ifx_Daq_event(&sim_daq, SIM_EVENT);
+
+        if ((sim_daq.listCount != 0) && (sim_daq.lists[0].running != FALSE))
+        {
+            sim_eventTime  = sim_eventTime + (sim_seconds() - start);
+            sim_eventCount = sim_eventCount + 1;
+        }
+
+        usleep(sim_eventPeriod);
+    }
+
+    return NULL;
+}
+
+
+int main(int argc, char **argv)
+{
+    struct sockaddr_in address = {0};
+    pthread_t          sampler;
+    int                listener;
+    int                one  = 1;
+    int                port = (argc > 1) ? atoi(argv[1]) : 5555;
+
+    if (argc > 2)
+    {
+        sim_eventPeriod = (unsigned)atoi(argv[2]);
+    }
+
+    sim_signals = mmap((void *)SIM_SIGNALS, 4096, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (sim_signals != (volatile uint32 *)SIM_SIGNALS)
+    {
+        fprintf(stderr, "daq_sim: cannot map the signals at 0x%08lX\n", SIM_SIGNALS);
+        return 1;
+    }
+
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons((uint16)port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if ((bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0) || (listen(listener, 1) != 0))
+    {
+        perror("daq_sim");
+        return 1;
+    }
+
+    Ifx_Daq_init(&sim_daq, &sim_shell);
+    pthread_create(&sampler, NULL, sim_sample, NULL);
+    fprintf(stderr, "daq_sim: listening on 127.0.0.1:%d, event %d every %u us\n", port, SIM_EVENT, sim_eventPeriod);
+
+    for (;;)
+    {
+        IfxStdIf_DPipe io;
+
+        io.socket = accept(listener, NULL, NULL);
+
+        if (io.socket < 0)
+        {
+            continue;
+        }
+
+        setsockopt(io.socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        (void)Ifx_Daq_protocolStart(&sim_daq, &io);
+        sim_shell.protocolStarted = TRUE;
+        sim_eventTime             = 0.0;
+        sim_eventCount            = 0;
+
+        while (sim_shell.protocolStarted != FALSE)
+        {
+            Ifx_Daq_protocolExecute(&sim_daq);
+            usleep(SIM_POLL_US);
+        }
+
+        fprintf(stderr, "daq_sim: overruns %u, events %lu, mean event %.0f ns\n",
+            (sim_daq.listCount != 0) ? sim_daq.lists[0].overruns : 0U, sim_eventCount,
+            (sim_eventCount != 0) ? ((sim_eventTime * 1.0e9) / (double)sim_eventCount) : 0.0);
+        close(io.socket);
+    }
+}
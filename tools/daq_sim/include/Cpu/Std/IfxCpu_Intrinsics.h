@@ -0,0 +1,10 @@
+#ifndef IFXCPU_INTRINSICS_H
+#define IFXCPU_INTRINSICS_H
+
+/* Host stand-in for the TriCore intrinsics used by Ifx_Daq, see tools/daq_sim.
+ * DSYNC becomes a full fence, as it acts between the cores of the target. */
+
+#define __dsync()         __sync_synchronize()
+#define __min(a, b)       (((a) < (b)) ? (a) : (b))
+
+#endif /* IFXCPU_INTRINSICS_H */
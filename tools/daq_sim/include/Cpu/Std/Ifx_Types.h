@@ -0,0 +1,36 @@
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H
+
+/* Host stand-in for the iLLD types used by Ifx_Daq, see tools/daq_sim. */
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef int64_t  sint64;
+typedef uint8_t  boolean;
+typedef float    float32;
+typedef sint32   Ifx_SizeT;
+typedef sint64   Ifx_TickTime;
+
+#ifndef TRUE
+#define TRUE          (1)
+#endif
+#ifndef FALSE
+#define FALSE         (0)
+#endif
+#define NULL_PTR      ((void *)0)
+
+#define IFX_INLINE    static inline
+#define IFX_STATIC    static
+#define IFX_EXTERN    extern
+
+#define TIME_INFINITE ((Ifx_TickTime)0x7FFFFFFFFFFFFFFFLL)
+
+#endif /* IFX_TYPES_H */
@@ -0,0 +1,7 @@
+#ifndef IFX_CFG_H
+#define IFX_CFG_H
+
+/* Host stand-in for the project configuration, see tools/daq_sim.  The DAQ
+ * engine runs with its default sizes. */
+
+#endif /* IFX_CFG_H */
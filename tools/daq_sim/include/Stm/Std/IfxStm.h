@@ -0,0 +1,29 @@
+#ifndef IFXSTM_H
+#define IFXSTM_H
+
+/* Host stand-in for the STM driver, see tools/daq_sim.  STM0 counts the
+ * monotonic clock at 100 MHz, as the target's does by default. */
+
+#include <time.h>
+#include "Cpu/Std/Ifx_Types.h"
+
+typedef int Ifx_STM;
+
+extern Ifx_STM MODULE_STM0;
+
+IFX_INLINE uint32 IfxStm_getLower(Ifx_STM *stm)
+{
+    struct timespec now;
+
+    (void)stm;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32)(((uint64)now.tv_sec * 100000000ULL) + ((uint64)now.tv_nsec / 10U));
+}
+
+IFX_INLINE float32 IfxStm_getFrequency(Ifx_STM *stm)
+{
+    (void)stm;
+    return 100.0e6f;
+}
+
+#endif /* IFXSTM_H */
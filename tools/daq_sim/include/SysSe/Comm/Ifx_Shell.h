@@ -0,0 +1,26 @@
+#ifndef IFX_SHELL_H
+#define IFX_SHELL_H
+
+/* Host stand-in for the parts of Ifx_Shell and IfxStdIf_DPipe that Ifx_Daq
+ * uses, see tools/daq_sim.  The pipe is a connected TCP socket. */
+
+#include "Cpu/Std/Ifx_Types.h"
+
+typedef struct
+{
+    int socket;
+} IfxStdIf_DPipe;
+
+typedef struct
+{
+    volatile boolean protocolStarted;
+} Ifx_Shell;
+
+IFX_EXTERN void    Ifx_Shell_protocolStop(Ifx_Shell *shell);
+
+IFX_EXTERN boolean IfxStdIf_DPipe_canWriteCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout);
+IFX_EXTERN boolean IfxStdIf_DPipe_write(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout);
+IFX_EXTERN boolean IfxStdIf_DPipe_read(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout);
+IFX_EXTERN sint32  IfxStdIf_DPipe_getReadCount(IfxStdIf_DPipe *stdif);
+
+#endif /* IFX_SHELL_H */
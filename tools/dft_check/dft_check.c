@@ -0,0 +1,389 @@
+/* Host check of the selected DFT bins of
+ * Libraries/Service/CpuGeneric/SysSe/Math/Ifx_DftF32.c, against a DFT in
+ * double precision and against Ifx_FftF32_radix2().
+ *
+ *  - Goertzel: for blocks of 256 to 4096 samples of three tones, an offset
+ *    and noise, 16 bins, integer and fractional, near 0 and near nX / 2.
+ *    The error of a bin is given relative to the sum of |x[n]| of the
+ *    block, the largest magnitude a bin can have, and compared with that of
+ *    the same bins of Ifx_FftF32_radix2();
+ *  - sliding DFT: a window of 1024 samples with 16 bins slides over
+ *    4000000 samples of the same signal, and the bins are compared with the
+ *    DFT of the window every 997 samples.  The classic recursion,
+ *    (sum + new - old) * e^(j * w) in float32, and the modulated recursion
+ *    without the restart, run alongside to show the drift corrected;
+ *  - the host times of Ifx_FftF32_radix2(), Ifx_DftF32_goertzel() for 1 to
+ *    16 bins and Ifx_DftF32_slide() per block, for 256 to 4096 samples.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/foc_ref/include \
+ *         -ILibraries/Service/CpuGeneric -ILibraries/Service/CpuGeneric/SysSe/Math \
+ *         -o dft_check tools/dft_check/dft_check.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_DftF32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_FftF32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_FftF32_BitReverseTable.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_FftF32_TwiddleTable.c -lm
+ *     ./dft_check
+ *
+ * The times are host times, not TriCore cycles: the ratios between the
+ * kernels, not the times themselves, carry over to the target. */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "SysSe/Math/Ifx_DftF32.h"
+#include "SysSe/Math/Ifx_FftF32.h"
+
+#define CHECK_MAX_LENGTH   (4096)
+#define CHECK_BINS         (16)
+#define CHECK_ROUNDS       (20)
+#define CHECK_SLIDE_LENGTH (1024)
+#define CHECK_SLIDE_STEPS  (4000000)
+#define CHECK_SLIDE_EVERY  (997)
+#define CHECK_BENCH_NS     (20.0e6)   /* Host time per measurement */
+
+static uint32 check_failures = 0;
+
+static uint32 check_rand(void)
+{
+    static uint64 state = 0x9E3779B97F4A7C15ULL;
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return (uint32)(state >> 16);
+}
+
+/* Uniform in -1 .. 1 */
+static double check_uniform(void)
+{
+    return ((double)check_rand() / 4294967296.0) * 2.0 - 1.0;
+}
+
+/* Three tones, an offset and noise, of about unit amplitude */
+static float32 check_signal(uint32 n)
+{
+    return (float32)(0.5 + sin(0.0123 * n) + 0.5 * sin(0.71 * n + 1.0) + 0.25 * cos(2.9 * n) + 0.2 * check_uniform());
+}
+
+/* Bin frequency of x[0 .. nX - 1], of x[start + n] with a circular x of
+ * length nX if start is not 0, in double */
+static void check_dft(double *real, double *imag, const float32 *x, uint32 nX, uint32 start, double frequency)
+{
+    double w = 2.0 * M_PI * frequency / nX;
+    uint32 n;
+
+    *real = 0.0;
+    *imag = 0.0;
+
+    for (n = 0; n < nX; n++)
+    {
+        double sample = x[(start + n) % nX];
+
+        *real += sample * cos(w * n);
+        *imag -= sample * sin(w * n);
+    }
+}
+
+static double check_error(const cfloat32 *bin, double real, double imag)
+{
+    return hypot(bin->real - real, bin->imag - imag);
+}
+
+static double check_cpuTime(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return (double)time.tv_sec * 1.0e9 + (double)time.tv_nsec;
+}
+
+/* Frequencies of CHECK_BINS bins of nX: near 0 and nX / 2, integer and
+ * fractional; the first 12 are integers, for the comparison with the FFT. */
+static void check_frequencies(float32 *frequencies, uint32 nX)
+{
+    uint32 k;
+
+    frequencies[0] = 1.0f;
+    frequencies[1] = 2.0f;
+    frequencies[2] = (float32)(nX / 2 - 1);
+    frequencies[3] = (float32)(nX / 4);
+
+    for (k = 4; k < 12; k++)
+    {
+        frequencies[k] = (float32)(1 + check_rand() % (nX / 2 - 1));
+    }
+
+    frequencies[12] = 0.5f;
+    frequencies[13] = 3.25f;
+    frequencies[14] = (float32)(nX / 8) + 0.5f;
+    frequencies[15] = (float32)(nX / 2) - 1.75f;
+}
+
+static void check_goertzel(void)
+{
+    static float32  x[CHECK_MAX_LENGTH];
+    static cfloat32 complexX[CHECK_MAX_LENGTH];
+    static cfloat32 spectrum[CHECK_MAX_LENGTH];
+    float32         frequencies[CHECK_BINS];
+    Ifx_DftF32_Bin  bins[CHECK_BINS];
+    cfloat32        result[CHECK_BINS];
+    uint32          nX, round, k, n;
+
+    printf("Goertzel, %u bins, error relative to the sum of |x|, worst of %u blocks:\n", CHECK_BINS, CHECK_ROUNDS);
+
+    for (nX = 256; nX <= CHECK_MAX_LENGTH; nX *= 2)
+    {
+        double worst    = 0.0;
+        double worstFft = 0.0;
+
+        for (round = 0; round < CHECK_ROUNDS; round++)
+        {
+            double magnitude = 0.0;
+
+            for (n = 0; n < nX; n++)
+            {
+                x[n]               = check_signal(round * nX + n);
+                complexX[n].real   = x[n];
+                complexX[n].imag   = 0.0f;
+                magnitude         += fabs(x[n]);
+            }
+
+            check_frequencies(frequencies, nX);
+            Ifx_DftF32_initBins(bins, frequencies, CHECK_BINS, nX);
+            Ifx_DftF32_goertzel(result, x, nX, bins, CHECK_BINS);
+            Ifx_FftF32_radix2(spectrum, complexX, (uint16)nX);
+
+            for (k = 0; k < CHECK_BINS; k++)
+            {
+                double real, imag;
+
+                check_dft(&real, &imag, x, nX, 0, frequencies[k]);
+                worst = fmax(worst, check_error(&result[k], real, imag) / magnitude);
+
+                if (k < 12)
+                {
+                    worstFft = fmax(worstFft, check_error(&spectrum[(uint32)frequencies[k]], real, imag) / magnitude);
+                }
+            }
+        }
+
+        printf("  nX %4u: %.2e, Ifx_FftF32_radix2 %.2e\n", nX, worst, worstFft);
+
+        if (!(worst < 1.0e-4))
+        {
+            printf("  FAIL Goertzel %u\n", nX);
+            check_failures++;
+        }
+    }
+}
+
+static void check_sliding(void)
+{
+    static float32     buffer[CHECK_SLIDE_LENGTH];
+    static float32     window[CHECK_SLIDE_LENGTH];
+    static cfloat32    classic[CHECK_BINS];
+    static cfloat32    noRestart[CHECK_BINS];
+    static cfloat32    rotation[CHECK_BINS];
+    uint16             bins[CHECK_BINS];
+    Ifx_DftF32_Sliding sliding;
+    cfloat32           result[CHECK_BINS];
+    double             worst = 0.0, worstClassic = 0.0, worstNoRestart = 0.0, lastClassic = 0.0;
+    double             magnitude = 0.0;
+    uint32             step, k;
+
+    for (k = 0; k < CHECK_BINS; k++)
+    {
+        bins[k]            = (uint16)((k == 0) ? 0 : ((k == 1) ? 1 : (check_rand() % CHECK_SLIDE_LENGTH)));
+        rotation[k].real   = (float32)cos(2.0 * M_PI * bins[k] / CHECK_SLIDE_LENGTH);
+        rotation[k].imag   = (float32)sin(2.0 * M_PI * bins[k] / CHECK_SLIDE_LENGTH);
+        IFX_Cf32_reset(&classic[k]);
+        IFX_Cf32_reset(&noRestart[k]);
+    }
+
+    if (Ifx_DftF32_initSliding(&sliding, buffer, CHECK_SLIDE_LENGTH, bins, CHECK_BINS) == FALSE)
+    {
+        printf("  FAIL initSliding\n");
+        check_failures++;
+        return;
+    }
+
+    memset(window, 0, sizeof(window));
+
+    for (step = 0; step < CHECK_SLIDE_STEPS; step++)
+    {
+        float32 sample = check_signal(step);
+        uint32  index  = step % CHECK_SLIDE_LENGTH;
+        float32 delta  = sample - window[index];
+
+        magnitude     += fabs(sample) - fabs(window[index]);
+        window[index]  = sample;
+        Ifx_DftF32_slide(&sliding, &sample, 1);
+
+        for (k = 0; k < CHECK_BINS; k++)
+        {
+            /* Classic: the window bin, rotated by e^(j * w) per sample */
+            cfloat32 sum = classic[k];
+
+            sum.real  += delta;
+            classic[k] = IFX_Cf32_mul(&sum, &rotation[k]);
+
+            /* Modulated, without the restart: the twiddle of the sample */
+            {
+                double w = -2.0 * M_PI * (double)(((uint64)bins[k] * index) % CHECK_SLIDE_LENGTH) / CHECK_SLIDE_LENGTH;
+
+                noRestart[k].real += delta * (float32)cos(w);
+                noRestart[k].imag += delta * (float32)sin(w);
+            }
+        }
+
+        if (((step % CHECK_SLIDE_EVERY) == 0) || (step == (CHECK_SLIDE_STEPS - 1)))
+        {
+            double scale = fmax(magnitude, 1.0);
+
+            Ifx_DftF32_getSliding(result, &sliding);
+            lastClassic = 0.0;
+
+            for (k = 0; k < CHECK_BINS; k++)
+            {
+                double   real, imag;
+                double   w = 2.0 * M_PI * (double)(((uint64)bins[k] * (index + 1)) % CHECK_SLIDE_LENGTH) / CHECK_SLIDE_LENGTH;
+                cfloat32 rotated;
+
+                check_dft(&real, &imag, window, CHECK_SLIDE_LENGTH, (index + 1) % CHECK_SLIDE_LENGTH, bins[k]);
+                worst        = fmax(worst, check_error(&result[k], real, imag) / scale);
+                lastClassic  = fmax(lastClassic, check_error(&classic[k], real, imag) / scale);
+                worstClassic = fmax(worstClassic, lastClassic);
+                rotated.real = (float32)(noRestart[k].real * cos(w) - noRestart[k].imag * sin(w));
+                rotated.imag = (float32)(noRestart[k].imag * cos(w) + noRestart[k].real * sin(w));
+                worstNoRestart = fmax(worstNoRestart, check_error(&rotated, real, imag) / scale);
+            }
+        }
+    }
+
+    printf("sliding DFT, window %u, %u bins, %u samples, error relative to the sum of |x|:\n"
+           "  Ifx_DftF32_slide %.2e, without the restart %.2e, classic recursion %.2e (%.2e at the end)\n",
+           CHECK_SLIDE_LENGTH, CHECK_BINS, CHECK_SLIDE_STEPS, worst, worstNoRestart, worstClassic, lastClassic);
+
+    if (!(worst < 1.0e-5))
+    {
+        printf("  FAIL sliding DFT\n");
+        check_failures++;
+    }
+}
+
+/* Host ns per call of the kernel selected by kind */
+static double check_time(int kind, uint32 nX, uint32 count)
+{
+    static float32     x[CHECK_MAX_LENGTH];
+    static float32     buffer[CHECK_MAX_LENGTH];
+    static cfloat32    complexX[CHECK_MAX_LENGTH];
+    static cfloat32    spectrum[CHECK_MAX_LENGTH];
+    float32            frequencies[CHECK_BINS];
+    uint16             bins[CHECK_BINS];
+    Ifx_DftF32_Bin     goertzelBins[CHECK_BINS];
+    Ifx_DftF32_Sliding sliding;
+    cfloat32           result[CHECK_BINS];
+    uint32             calls = 1, call, n;
+    double             start, elapsed;
+
+    for (n = 0; n < nX; n++)
+    {
+        x[n]             = check_signal(n);
+        complexX[n].real = x[n];
+        complexX[n].imag = 0.0f;
+    }
+
+    check_frequencies(frequencies, nX);
+
+    for (n = 0; n < CHECK_BINS; n++)
+    {
+        frequencies[n] = floorf(frequencies[n]);
+        bins[n]        = (uint16)frequencies[n];
+    }
+
+    Ifx_DftF32_initBins(goertzelBins, frequencies, count, nX);
+    Ifx_DftF32_initSliding(&sliding, buffer, nX, bins, count);
+
+    do
+    {
+        start = check_cpuTime();
+
+        for (call = 0; call < calls; call++)
+        {
+            if (kind == 0)
+            {
+                Ifx_FftF32_radix2(spectrum, complexX, (uint16)nX);
+            }
+            else if (kind == 1)
+            {
+                Ifx_DftF32_goertzel(result, x, nX, goertzelBins, count);
+            }
+            else
+            {
+                Ifx_DftF32_slide(&sliding, x, nX);
+                Ifx_DftF32_getSliding(result, &sliding);
+            }
+
+            __asm__ volatile ("" : : "r" (spectrum), "r" (result) : "memory");
+        }
+
+        elapsed = check_cpuTime() - start;
+        calls  *= 2;
+    } while (elapsed < CHECK_BENCH_NS);
+
+    return elapsed / (calls / 2);
+}
+
+static void check_bench(void)
+{
+    static const uint32 counts[] = {1, 2, 3, 4, 6, 8, 12, 16};
+    uint32              nX, i;
+
+    printf("host, not TriCore, us per block: Ifx_FftF32_radix2, Ifx_DftF32_goertzel for K bins, "
+           "Ifx_DftF32_slide for K bins\n");
+    printf("  nX      FFT |");
+
+    for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+    {
+        printf(" K=%-5u", counts[i]);
+    }
+
+    printf("| slide K=1  K=16 | Goertzel below FFT up to K\n");
+
+    for (nX = 256; nX <= CHECK_MAX_LENGTH; nX *= 2)
+    {
+        double fft       = check_time(0, nX, 0);
+        uint32 crossover = 0;
+        uint32 count;
+
+        printf("  %4u %8.2f |", nX, fft / 1000.0);
+
+        for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+        {
+            printf(" %7.2f", check_time(1, nX, counts[i]) / 1000.0);
+        }
+
+        for (count = 1; count <= CHECK_BINS; count++)
+        {
+            crossover = (check_time(1, nX, count) < fft) ? count : crossover;
+        }
+
+        printf(" | %7.2f %6.2f | %u\n", check_time(2, nX, 1) / 1000.0, check_time(2, nX, 16) / 1000.0, crossover);
+    }
+}
+
+int main(void)
+{
+    check_goertzel();
+    check_sliding();
+    check_bench();
+    printf("%u failures\n", check_failures);
+
+    return (check_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,520 @@
+/* Host reference model of the fused current controller of
+ * Libraries/Service/CpuGeneric/SysSe/Math/Ifx_FocF32.c.
+ *
+ * Four motors, each a permanent magnet synchronous machine in the d/q frame
+ * integrated in double precision, run in closed loop with Ifx_FocF32_step().
+ * Two other controllers are fed the same measurements at every step:
+ *
+ *  - the chained library blocks, Ifx_LutSincosF32_cossin(),
+ *    Ifx_LowPassPt1F32_do() and Ifx_IntegralF32_step() one call at a time,
+ *    the modulation written out the plain way.  Its on-times and state must
+ *    be bit identical to the kernel's;
+ *  - the same controller in double precision with exact sine and cosine,
+ *    started from the kernel's state at every step, which shows what the
+ *    12-bit angle table and float32 cost.
+ *
+ * The measured currents carry the quantisation of a 12-bit ADC over +-100 A
+ * and the angle that of the table.  The on-times of a step are applied, as
+ * their average voltages on vdc, until the next measurement.  One motor runs
+ * above the speed its voltage allows without a negative d current, so that
+ * the voltage limit and the integrator set-back are exercised until its d
+ * reference steps into field weakening.
+ *
+ * Build and run:
+ *     cc -O2 -ffp-contract=off -Itools/foc_ref/include \
+ *         -ILibraries/Service/CpuGeneric -ILibraries/Service/CpuGeneric/SysSe/Math \
+ *         -o foc_ref tools/foc_ref/foc_ref.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_FocF32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_LutSincosF32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_LutSincosF32_Table.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_LowPassPt1F32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_IntegralF32.c -lm
+ *     ./foc_ref
+ *
+ * -ffp-contract=off keeps the compiler from fusing multiplies and adds
+ * differently in the two controllers; on the target both must be compiled
+ * with the same contraction too.  The times printed last are host times of
+ * the kernel and of the chained calls, not TriCore cycles. */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "SysSe/Math/Ifx_FocF32.h"
+#include "SysSe/Math/Ifx_IntegralF32.h"
+#include "SysSe/Math/Ifx_LowPassPt1F32.h"
+#include "SysSe/Math/Ifx_LutSincosF32.h"
+
+#define REF_MOTORS       (4)
+#define REF_STEPS        (400000)      /* 20 s at 20 kHz                   */
+#define REF_TS           (50.0e-6)
+#define REF_PERIOD       (5000)        /* Timer ticks of the PWM period    */
+#define REF_VDC          (48.0)
+#define REF_ADC_RANGE    (100.0)       /* A at full scale, +-              */
+#define REF_ADC_BITS     (12)
+#define REF_BENCH_STEPS  (2000000)
+
+typedef struct
+{
+    double resistance;                 /* Ohm                              */
+    double inductance;                 /* H, the same on both axes         */
+    double flux;                       /* Vs of the magnets                */
+    double speed;                      /* Electrical rad/s                 */
+    double bandwidth;                  /* Current loop, rad/s              */
+    double cutOff;                     /* Hz of the current filters, 0     */
+    double iqStep;                     /* A                                */
+    double idStep;                     /* A                                */
+} RefMotorConfig;
+
+typedef struct
+{
+    double id;
+    double iq;
+    double angle;
+    double vd;                         /* Applied during the step          */
+    double vq;
+} RefPlant;
+
+/* The controller as the chain of library calls. */
+typedef struct
+{
+    Ifx_LowPassPt1F32 filterD;
+    Ifx_LowPassPt1F32 filterQ;
+    Ifx_IntegralF32   integralD;
+    Ifx_IntegralF32   integralQ;
+    float32           kp;
+    float32           voltageLimit;
+    float32           period;
+    float32           idRef;
+    float32           iqRef;
+    float32           vd;
+    float32           vq;
+} RefChain;
+
+static const RefMotorConfig ref_motors[REF_MOTORS] = {
+    {0.050, 100.0e-6, 0.010, 800.0, 6283.0, 0.0, 40.0, 0.0},
+    {0.120, 400.0e-6, 0.020, 400.0, 3142.0, 5000.0, 20.0, 0.0},
+    {0.020, 50.0e-6, 0.008, 2500.0, 12566.0, 2000.0, 60.0, -30.0},
+    {0.080, 200.0e-6, 0.015, 2200.0, 6283.0, 0.0, 30.0, -60.0},
+};
+
+static uint32 ref_random = 1;
+
+static uint32 ref_rand(void)
+{
+    ref_random ^= ref_random << 13;
+    ref_random ^= ref_random >> 17;
+    ref_random ^= ref_random << 5;
+
+    return ref_random;
+}
+
+/* A current as the ADC gives it, with one LSB of noise. */
+static float32 ref_measure(double current)
+{
+    double lsb  = (2.0 * REF_ADC_RANGE) / (1 << REF_ADC_BITS);
+    double code = floor((current + REF_ADC_RANGE) / lsb) + (double)((sint32)(ref_rand() % 3) - 1);
+
+    return (float32)((code * lsb) - REF_ADC_RANGE);
+}
+
+static void ref_initConfig(Ifx_FocF32_Config *config, const RefMotorConfig *motor)
+{
+    Ifx_FocF32_initConfig(config);
+    config->kp              = (float32)(motor->inductance * motor->bandwidth);
+    config->ki              = (float32)(motor->resistance * motor->bandwidth);
+    config->cutOffFrequency = (float32)motor->cutOff;
+    config->samplingTime    = (float32)REF_TS;
+    config->period          = REF_PERIOD;
+}
+
+static void ref_chainInit(RefChain *chain, const Ifx_FocF32_Config *config)
+{
+    Ifx_LowPassPt1F32_Config filter;
+
+    filter.cutOffFrequency = config->cutOffFrequency;
+    filter.gain            = 1.0f;
+    filter.samplingTime    = config->samplingTime;
+
+    if (config->cutOffFrequency > 0.0f)
+    {
+        Ifx_LowPassPt1F32_init(&chain->filterD, &filter);
+        Ifx_LowPassPt1F32_init(&chain->filterQ, &filter);
+    }
+    else
+    {
+        chain->filterD.a   = 1.0f;
+        chain->filterD.b   = 1.0f;
+        chain->filterD.out = 0.0f;
+        chain->filterQ     = chain->filterD;
+    }
+
+    Ifx_IntegralF32_init(&chain->integralD, config->ki, config->samplingTime);
+    Ifx_IntegralF32_init(&chain->integralQ, config->ki, config->samplingTime);
+    Ifx_IntegralF32_reset(&chain->integralD);
+    Ifx_IntegralF32_reset(&chain->integralQ);
+    chain->kp           = config->kp;
+    chain->voltageLimit = config->modulationLimit * IFX_ONE_OVER_SQRT_THREE;
+    chain->period       = (float32)config->period;
+    chain->idRef        = 0.0f;
+    chain->iqRef        = 0.0f;
+    chain->vd           = 0.0f;
+    chain->vq           = 0.0f;
+}
+
+static Ifx_TimerValue ref_onTime(float32 voltage, float32 vdc, float32 period)
+{
+    float32 duty   = 0.5f + (voltage * (1.0f / vdc));
+    float32 onTime = duty * period;
+
+    if (onTime < 0.0f)
+    {
+        onTime = 0.0f;
+    }
+
+    if (onTime > period)
+    {
+        onTime = period;
+    }
+
+    return (Ifx_TimerValue)(onTime + 0.5f);
+}
+
+static void ref_chainStep(RefChain *chain, const Ifx_FocF32_Input *in, Ifx_FocF32_Output *out)
+{
+    cfloat32 rotation = Ifx_LutSincosF32_cossin(in->angle);
+    float32  vMax     = in->vdc * chain->voltageLimit;
+    float32  alpha    = in->ia;
+    float32  beta     = (in->ia + in->ib + in->ib) * IFX_ONE_OVER_SQRT_THREE;
+    float32  id       = (alpha * rotation.real) + (beta * rotation.imag);
+    float32  iq       = (beta * rotation.real) - (alpha * rotation.imag);
+    float32  errorD;
+    float32  errorQ;
+    float32  pd;
+    float32  pq;
+    float32  vd;
+    float32  vq;
+    float32  phases[3];
+    float32  high;
+    float32  low;
+    uint32   phase;
+
+    id     = Ifx_LowPassPt1F32_do(&chain->filterD, id);
+    iq     = Ifx_LowPassPt1F32_do(&chain->filterQ, iq);
+    errorD = chain->idRef - id;
+    errorQ = chain->iqRef - iq;
+    pd     = chain->kp * errorD;
+    pq     = chain->kp * errorQ;
+    vd     = pd + Ifx_IntegralF32_step(&chain->integralD, errorD);
+    vq     = pq + Ifx_IntegralF32_step(&chain->integralQ, errorQ);
+
+    out->limited = FALSE;
+
+    if (fabsf(vd) > vMax)
+    {
+        vd                   = copysignf(vMax, vd);
+        chain->integralD.uk  = vd - pd;
+        out->limited         = TRUE;
+    }
+
+    if (((vd * vd) + (vq * vq)) > (vMax * vMax))
+    {
+        vq                   = copysignf(sqrtf((vMax * vMax) - (vd * vd)), vq);
+        chain->integralQ.uk  = vq - pq;
+        out->limited         = TRUE;
+    }
+
+    alpha     = (vd * rotation.real) - (vq * rotation.imag);
+    beta      = (vd * rotation.imag) + (vq * rotation.real);
+    phases[0] = alpha;
+    phases[1] = (beta * (IFX_SQRT_THREE / 2)) - (0.5f * alpha);
+    phases[2] = -(beta * (IFX_SQRT_THREE / 2)) - (0.5f * alpha);
+    high      = fmaxf(fmaxf(phases[0], phases[1]), phases[2]);
+    low       = fminf(fminf(phases[0], phases[1]), phases[2]);
+
+    for (phase = 0; phase < 3; phase++)
+    {
+        out->tOn[phase] = ref_onTime(phases[phase] - (0.5f * (high + low)), in->vdc, chain->period);
+    }
+
+    chain->vd = vd;
+    chain->vq = vq;
+}
+
+/* One step of the controller in double precision from the state of foc.
+ * Returns the largest on-time difference to out, in ticks. */
+static double ref_exactStep(const Ifx_FocF32 *foc, const Ifx_FocF32_Input *in, const Ifx_FocF32_Output *out)
+{
+    double angle  = (2.0 * M_PI * (in->angle & (IFX_LUT_ANGLE_RESOLUTION - 1))) / IFX_LUT_ANGLE_RESOLUTION;
+    double c      = cos(angle);
+    double s      = sin(angle);
+    double vMax   = (double)in->vdc * foc->voltageLimit;
+    double alpha  = in->ia;
+    double beta   = (in->ia + 2.0 * in->ib) / sqrt(3.0);
+    double id     = (alpha * c) + (beta * s);
+    double iq     = (beta * c) - (alpha * s);
+    double errorD;
+    double errorQ;
+    double vd;
+    double vq;
+    double phases[3];
+    double high;
+    double low;
+    double worst  = 0;
+    uint32 phase;
+
+    id     = foc->id + foc->filterA * id - foc->filterB * (double)foc->id;
+    iq     = foc->iq + foc->filterA * iq - foc->filterB * (double)foc->iq;
+    errorD = foc->idRef - id;
+    errorQ = foc->iqRef - iq;
+    vd     = (foc->kp * errorD) + foc->idIntegral + ((errorD + foc->idError) * foc->integralDelta);
+    vq     = (foc->kp * errorQ) + foc->iqIntegral + ((errorQ + foc->iqError) * foc->integralDelta);
+
+    if (fabs(vd) > vMax)
+    {
+        vd = copysign(vMax, vd);
+    }
+
+    if (((vd * vd) + (vq * vq)) > (vMax * vMax))
+    {
+        vq = copysign(sqrt((vMax * vMax) - (vd * vd)), vq);
+    }
+
+    alpha     = (vd * c) - (vq * s);
+    beta      = (vd * s) + (vq * c);
+    phases[0] = alpha;
+    phases[1] = (beta * sqrt(3.0) / 2.0) - (0.5 * alpha);
+    phases[2] = -(beta * sqrt(3.0) / 2.0) - (0.5 * alpha);
+    high      = fmax(fmax(phases[0], phases[1]), phases[2]);
+    low       = fmin(fmin(phases[0], phases[1]), phases[2]);
+
+    for (phase = 0; phase < 3; phase++)
+    {
+        double onTime = (0.5 + ((phases[phase] - (0.5 * (high + low))) / in->vdc)) * REF_PERIOD;
+        double error  = fabs(onTime - out->tOn[phase]);
+
+        worst = (error > worst) ? error : worst;
+    }
+
+    return worst;
+}
+
+/* Applies the on-times for one step: the plant sees the average phase
+ * voltages, rotated into d/q at the middle of the step. */
+static void ref_plantStep(RefPlant *plant, const RefMotorConfig *motor, const Ifx_FocF32_Output *out)
+{
+    double va    = ((double)out->tOn[0] / REF_PERIOD - 0.5) * REF_VDC;
+    double vb    = ((double)out->tOn[1] / REF_PERIOD - 0.5) * REF_VDC;
+    double vc    = ((double)out->tOn[2] / REF_PERIOD - 0.5) * REF_VDC;
+    double alpha = (2.0 * va - vb - vc) / 3.0;
+    double beta  = (vb - vc) / sqrt(3.0);
+    double theta = plant->angle + 0.5 * motor->speed * REF_TS;
+    uint32 sub;
+
+    plant->vd = (alpha * cos(theta)) + (beta * sin(theta));
+    plant->vq = (beta * cos(theta)) - (alpha * sin(theta));
+
+    for (sub = 0; sub < 10; sub++)
+    {
+        double h  = REF_TS / 10;
+        double dd = (plant->vd - motor->resistance * plant->id + motor->speed * motor->inductance * plant->iq) / motor->inductance;
+        double dq = (plant->vq - motor->resistance * plant->iq - motor->speed * (motor->inductance * plant->id + motor->flux)) / motor->inductance;
+
+        plant->id += h * dd;
+        plant->iq += h * dq;
+    }
+
+    plant->angle = fmod(plant->angle + motor->speed * REF_TS, 2.0 * M_PI);
+}
+
+static void ref_measurePlant(const RefPlant *plant, Ifx_FocF32_Input *in)
+{
+    double alpha = (plant->id * cos(plant->angle)) - (plant->iq * sin(plant->angle));
+    double beta  = (plant->id * sin(plant->angle)) + (plant->iq * cos(plant->angle));
+
+    in->ia    = ref_measure(alpha);
+    in->ib    = ref_measure((-0.5 * alpha) + (sqrt(3.0) / 2.0 * beta));
+    in->angle = (Ifx_Lut_FxpAngle)(plant->angle / (2.0 * M_PI) * IFX_LUT_ANGLE_RESOLUTION);
+    in->vdc   = (float32)REF_VDC;
+}
+
+static boolean ref_same(const Ifx_FocF32 *foc, const RefChain *chain, const Ifx_FocF32_Output *a, const Ifx_FocF32_Output *b)
+{
+    return (boolean)((memcmp(a->tOn, b->tOn, sizeof(a->tOn)) == 0) && (a->limited == b->limited)
+                     && (memcmp(&foc->id, &chain->filterD.out, sizeof(float32)) == 0)
+                     && (memcmp(&foc->iq, &chain->filterQ.out, sizeof(float32)) == 0)
+                     && (memcmp(&foc->idIntegral, &chain->integralD.uk, sizeof(float32)) == 0)
+                     && (memcmp(&foc->iqIntegral, &chain->integralQ.uk, sizeof(float32)) == 0)
+                     && (memcmp(&foc->vd, &chain->vd, sizeof(float32)) == 0)
+                     && (memcmp(&foc->vq, &chain->vq, sizeof(float32)) == 0));
+}
+
+static double ref_cpuTime(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return (double)time.tv_sec * 1.0e9 + (double)time.tv_nsec;
+}
+
+/* Host time per motor of the kernel and of the chained calls. */
+static void ref_bench(uint32 motors)
+{
+    static Ifx_FocF32        foc[8];
+    static RefChain          chain[8];
+    static Ifx_FocF32_Input  in[64][8];
+    static Ifx_FocF32_Output out[8];
+    Ifx_FocF32_Config        config;
+    double                   start;
+    double                   fused;
+    double                   chained;
+    uint32                   step;
+    uint32                   motor;
+
+    for (motor = 0; motor < motors; motor++)
+    {
+        ref_initConfig(&config, &ref_motors[motor % REF_MOTORS]);
+        Ifx_FocF32_init(&foc[motor], &config);
+        ref_chainInit(&chain[motor], &config);
+        Ifx_FocF32_setReference(&foc[motor], -5.0f, 20.0f);
+        chain[motor].idRef = -5.0f;
+        chain[motor].iqRef = 20.0f;
+    }
+
+    for (step = 0; step < 64; step++)
+    {
+        for (motor = 0; motor < motors; motor++)
+        {
+            in[step][motor].ia    = (float32)(ref_rand() % 2000) / 100.0f - 10.0f;
+            in[step][motor].ib    = (float32)(ref_rand() % 2000) / 100.0f - 10.0f;
+            in[step][motor].angle = (Ifx_Lut_FxpAngle)(ref_rand() % IFX_LUT_ANGLE_RESOLUTION);
+            in[step][motor].vdc   = (float32)REF_VDC;
+        }
+    }
+
+    start = ref_cpuTime();
+
+    for (step = 0; step < REF_BENCH_STEPS; step++)
+    {
+        Ifx_FocF32_step(foc, in[step & 63], out, motors);
+    }
+
+    fused = (ref_cpuTime() - start) / ((double)REF_BENCH_STEPS * motors);
+    start = ref_cpuTime();
+
+    for (step = 0; step < REF_BENCH_STEPS; step++)
+    {
+        for (motor = 0; motor < motors; motor++)
+        {
+            ref_chainStep(&chain[motor], &in[step & 63][motor], &out[motor]);
+        }
+    }
+
+    chained = (ref_cpuTime() - start) / ((double)REF_BENCH_STEPS * motors);
+    printf("  %u motors: %5.1f ns per motor fused, %5.1f ns chained\n", motors, fused, chained);
+}
+
+int main(void)
+{
+    static Ifx_FocF32        foc[REF_MOTORS];
+    static Ifx_FocF32        before[REF_MOTORS];
+    static RefChain          chain[REF_MOTORS];
+    static RefPlant          plant[REF_MOTORS];
+    static Ifx_FocF32_Input  in[REF_MOTORS];
+    static Ifx_FocF32_Output out[REF_MOTORS];
+    static Ifx_FocF32_Output outChain[REF_MOTORS];
+    Ifx_FocF32_Config        config;
+    double                   worst[REF_MOTORS];
+    double                   errorSquares[REF_MOTORS];
+    uint32                   errorCount[REF_MOTORS];
+    uint32                   limited[REF_MOTORS];
+    uint32                   mismatches = 0;
+    uint32                   step;
+    uint32                   motor;
+
+    memset(worst, 0, sizeof(worst));
+    memset(errorSquares, 0, sizeof(errorSquares));
+    memset(errorCount, 0, sizeof(errorCount));
+    memset(limited, 0, sizeof(limited));
+
+    for (motor = 0; motor < REF_MOTORS; motor++)
+    {
+        ref_initConfig(&config, &ref_motors[motor]);
+        Ifx_FocF32_init(&foc[motor], &config);
+        ref_chainInit(&chain[motor], &config);
+    }
+
+    for (step = 0; step < REF_STEPS; step++)
+    {
+        /* References: q steps up at 0.1 s, d at 0.5 s, both drop at 1 s,
+         * every 2 s. */
+        double time = fmod(step * REF_TS, 2.0);
+
+        for (motor = 0; motor < REF_MOTORS; motor++)
+        {
+            const RefMotorConfig *config = &ref_motors[motor];
+            float32               iqRef  = (float32)(((time >= 0.1) && (time < 1.0)) ? config->iqStep : 0.0);
+            float32               idRef  = (float32)(((time >= 0.5) && (time < 1.0)) ? config->idStep : 0.0);
+
+            Ifx_FocF32_setReference(&foc[motor], idRef, iqRef);
+            chain[motor].idRef = idRef;
+            chain[motor].iqRef = iqRef;
+            ref_measurePlant(&plant[motor], &in[motor]);
+        }
+
+        memcpy(before, foc, sizeof(before));
+        Ifx_FocF32_step(foc, in, out, REF_MOTORS);
+
+        for (motor = 0; motor < REF_MOTORS; motor++)
+        {
+            ref_chainStep(&chain[motor], &in[motor], &outChain[motor]);
+            worst[motor] = fmax(worst[motor], ref_exactStep(&before[motor], &in[motor], &out[motor]));
+
+            if (ref_same(&foc[motor], &chain[motor], &out[motor], &outChain[motor]) == FALSE)
+            {
+                if (mismatches < 5)
+                {
+                    printf("mismatch at step %u, motor %u: %u %u %u / %u %u %u\n", step, motor,
+                        out[motor].tOn[0], out[motor].tOn[1], out[motor].tOn[2],
+                        outChain[motor].tOn[0], outChain[motor].tOn[1], outChain[motor].tOn[2]);
+                }
+
+                mismatches++;
+            }
+
+            limited[motor] += out[motor].limited;
+            ref_plantStep(&plant[motor], &ref_motors[motor], &out[motor]);
+
+            /* Tracking once both references have settled. */
+            if ((time >= 0.7) && (time < 1.0))
+            {
+                double errorD = plant[motor].id - foc[motor].idRef;
+                double errorQ = plant[motor].iq - foc[motor].iqRef;
+
+                errorSquares[motor] += (errorD * errorD) + (errorQ * errorQ);
+                errorCount[motor]++;
+            }
+        }
+    }
+
+    printf("%u motors, %u steps of %.0f us: %u steps differ from the chained library calls\n",
+        REF_MOTORS, REF_STEPS, REF_TS * 1.0e6, mismatches);
+
+    for (motor = 0; motor < REF_MOTORS; motor++)
+    {
+        printf("  motor %u: on-times within %.2f ticks of %u of double precision, current rms error %.3f A, limited %.1f %% of steps\n",
+            motor, worst[motor], REF_PERIOD, sqrt(errorSquares[motor] / (errorCount[motor] ? errorCount[motor] : 1)),
+            100.0 * limited[motor] / REF_STEPS);
+    }
+
+    printf("host, not TriCore:\n");
+    ref_bench(1);
+    ref_bench(2);
+    ref_bench(4);
+    ref_bench(8);
+
+    return (mismatches == 0) ? 0 : 1;
+}
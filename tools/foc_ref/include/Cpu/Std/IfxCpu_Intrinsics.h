@@ -0,0 +1,11 @@
+#ifndef IFXCPU_INTRINSICS_H
+#define IFXCPU_INTRINSICS_H
+
+/* Host stand-in: the math library only needs the types, and Ifx_FftF32 the
+ * count of leading zeros. */
+
+#include "Cpu/Std/Ifx_Types.h"
+
+#define __clz(value) __builtin_clz(value)
+
+#endif /* IFXCPU_INTRINSICS_H */
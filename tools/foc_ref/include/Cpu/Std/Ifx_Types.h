@@ -0,0 +1,47 @@
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H
+
+/* Host stand-in for the iLLD types used by the SysSe math library, see tools/foc_ref. */
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef int64_t  sint64;
+typedef uint8_t  boolean;
+typedef float    float32;
+typedef double   float64;
+typedef uint32   Ifx_TimerValue;
+
+typedef struct
+{
+    float32 real;
+    float32 imag;
+} cfloat32;
+
+#ifndef TRUE
+#define TRUE     (1)
+#endif
+#ifndef FALSE
+#define FALSE    (0)
+#endif
+#define NULL_PTR ((void *)0)
+
+#define IFX_INLINE static inline
+#define IFX_STATIC static
+#define IFX_EXTERN extern
+#define IFX_CONST  const
+#define CONST_CFG  const
+
+#define IFX_PI                  (3.1415926535897932384626433832795f)
+#define IFX_ONE_OVER_SQRT_THREE (0.57735026918962576450914878050196f)
+#define IFX_SQRT_TWO            (1.4142135623730950488016887242097f)
+#define IFX_SQRT_THREE          (1.7320508075688772935274463415059f)
+
+#endif /* IFX_TYPES_H */
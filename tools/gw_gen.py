@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+"""
+Offline routing table generator for the CAN/Ethernet gateway (os/os_gw.h).
+
+Reads a route description (JSON, or YAML when PyYAML is installed) and emits
+a C source/header pair with the OsGw_Config of os_gw_init():
+
+  * the routes, their counters and the containers,
+  * a perfect hash of the (bus, CAN identifier) keys of the CAN
+    routes and another of the PDU identifiers of the Ethernet routes, built
+    with hash and displace: a key is hashed to a bucket and to a slot, and
+    the displacement of the bucket, chosen here, is XORed into the slot so
+    that no two keys share one.  A lookup on the target is two multiplies,
+    one displacement read and one key compare.
+
+Usage:
+    tools/gw_gen.py os/os_gw.json -o os/os_gw_cfg [--report]
+
+Description format (see os/os_gw.json):
+
+    port:       UDP port containers are sent from and received on
+    buses:      [name]                                  bus 0, 1, ... in order
+    containers: [{name, ip, port, size, timeout_us}]
+    routes:     [{name, from, id, extended, pdu, to, out_id, fd, trigger}]
+
+A route 'from' a bus matches the CAN identifier 'id' on it, 29 bits if
+'extended'; a route 'from' a container matches the PDU identifier 'pdu' of
+the datagrams received.  'to' lists buses and at most one container.  Frames
+are sent on 'out_id' (by default 'id'), as CAN FD frames if 'fd', and packed
+into the container as PDU 'pdu' (by default the CAN identifier, bit 31 set
+if extended).  'trigger' sends the container once the PDU is packed.  'name'
+is optional and gives the route a macro with its number.
+"""
+
+import argparse
+import json
+import os
+import random
+import re
+import sys
+
+MASK32 = 0xFFFFFFFF
+HASH_BUS = 0x9E3779B9           # OS_GW_HASH_BUS in os_gw.c
+ID_EXTENDED = 0x80000000
+ID_FD = 0x40000000
+BUS_PDU = 0xFE
+BUS_NONE = 0xFF
+NO_CONTAINER = 0xFF
+ROUTE_TRIGGER = 0x1
+MAX_BUSES = 8                   # OS_GW_MAX_BUSES
+MAX_CONTAINERS = 4              # OS_GW_MAX_CONTAINERS
+CONTAINER_SIZE = 1472           # OS_GW_CONTAINER_SIZE
+PDU_HEADER_SIZE = 8
+MAX_DATA_LENGTH = 64
+MAX_BITS = 16
+SEEDS = 64
+IDENT = re.compile(r'^[A-Za-z_][A-Za-z0-9_]*$')
+
+
+class ConfigError(Exception):
+    pass
+
+
+def load(path):
+    with open(path, 'r') as f:
+        text = f.read()
+    if path.endswith(('.yaml', '.yml')):
+        try:
+            import yaml
+        except ImportError:
+            raise ConfigError('PyYAML is required to read %s' % path)
+        return yaml.safe_load(text)
+    return json.loads(text)
+
+
+def number(kind, value, limit):
+    if isinstance(value, str):
+        value = int(value, 0)
+    if not isinstance(value, int) or not 0 <= value <= limit:
+        raise ConfigError('%s 0x%X is out of range' % (kind, value) if isinstance(value, int) else '%s is not a number' % kind)
+    return value
+
+
+def ip_address(value):
+    parts = value.split('.')
+    if len(parts) != 4 or not all(p.isdigit() and int(p) < 256 for p in parts):
+        raise ConfigError('"%s" is not an IPv4 address' % value)
+    result = 0
+    for p in parts:
+        result = (result << 8) | int(p)
+    return result
+
+
+def macro(name):
+    if not isinstance(name, str) or not IDENT.match(name):
+        raise ConfigError('"%s" is not a valid C identifier' % name)
+    return re.sub(r'(?<=[a-z0-9])(?=[A-Z])', '_', name).upper()
+
+
+def validate(system):
+    """Returns buses, containers and routes in the form of the C tables."""
+    names = {}
+    buses = system.get('buses', [])
+    if len(buses) > MAX_BUSES:
+        raise ConfigError('at most %d buses (OS_GW_MAX_BUSES)' % MAX_BUSES)
+    for index, bus in enumerate(buses):
+        macro(bus)
+        if bus in names:
+            raise ConfigError('duplicate name "%s"' % bus)
+        names[bus] = ('bus', index)
+
+    containers = []
+    for c in system.get('containers', []):
+        macro(c['name'])
+        if c['name'] in names:
+            raise ConfigError('duplicate name "%s"' % c['name'])
+        size = c.get('size', CONTAINER_SIZE)
+        if not PDU_HEADER_SIZE + MAX_DATA_LENGTH <= size <= CONTAINER_SIZE:
+            raise ConfigError('container "%s": size must be %d..%d' % (c['name'], PDU_HEADER_SIZE + MAX_DATA_LENGTH, CONTAINER_SIZE))
+        names[c['name']] = ('container', len(containers))
+        containers.append({'name': c['name'], 'ip': ip_address(c['ip']), 'ip_text': c['ip'],
+                           'port': number('container port', c['port'], 0xFFFF), 'size': size,
+                           'timeout': number('container timeout', c['timeout_us'], MASK32)})
+    if len(containers) > MAX_CONTAINERS:
+        raise ConfigError('at most %d containers (OS_GW_MAX_CONTAINERS)' % MAX_CONTAINERS)
+
+    routes = []
+    can_keys = {}
+    pdu_keys = {}
+    for r in system.get('routes', []):
+        label = r.get('name', '#%d' % len(routes))
+        if r['from'] not in names:
+            raise ConfigError('route "%s": unknown source "%s"' % (label, r['from']))
+        kind, source = names[r['from']]
+        extended = bool(r.get('extended', False))
+        if kind == 'bus':
+            ident = number('route "%s": id' % label, r['id'], ID_FD - 1 if extended else 0x7FF)
+            key = (source, ident | (ID_EXTENDED if extended else 0))
+            keys = can_keys
+        else:
+            ident = number('route "%s": id' % label, r.get('out_id', r.get('id', 0)), ID_FD - 1 if extended else 0x7FF)
+            key = (BUS_PDU, number('route "%s": pdu' % label, r['pdu'], MASK32))
+            keys = pdu_keys
+        if key in keys:
+            raise ConfigError('route "%s": the key of route "%s"' % (label, keys[key][1]))
+        keys[key] = (len(routes), label)
+
+        out_id = number('route "%s": out_id' % label, r.get('out_id', ident), ID_FD - 1 if extended else 0x7FF)
+        can_id = out_id | (ID_EXTENDED if extended else 0) | (ID_FD if r.get('fd', False) else 0)
+        mask = 0
+        container = NO_CONTAINER
+        for target in r['to']:
+            if target not in names:
+                raise ConfigError('route "%s": unknown destination "%s"' % (label, target))
+            tkind, tindex = names[target]
+            if tkind == 'bus':
+                if kind == 'bus' and tindex == source:
+                    raise ConfigError('route "%s": a frame may not be sent back on its bus' % label)
+                mask |= 1 << tindex
+            elif container != NO_CONTAINER:
+                raise ConfigError('route "%s": at most one container' % label)
+            else:
+                container = tindex
+        pdu = number('route "%s": pdu' % label, r['pdu'], MASK32) if 'pdu' in r else (ident | (ID_EXTENDED if extended else 0))
+        routes.append({'name': r.get('name'), 'label': label, 'can_id': can_id, 'pdu': pdu, 'buses': mask,
+                       'container': container, 'flags': ROUTE_TRIGGER if r.get('trigger', False) else 0})
+        if 'name' in r:
+            macro(r['name'])
+    if len(routes) > 0xFFFF:
+        raise ConfigError('at most 65535 routes')
+    return buses, containers, routes, can_keys, pdu_keys
+
+
+def mix(bus, ident):
+    return (ident ^ (bus * HASH_BUS)) & MASK32
+
+
+def hash_bits(key, multiplier, bits):
+    return ((key * multiplier) & MASK32) >> (32 - bits)
+
+
+def perfect_hash(keys):
+    """Returns (bucket multiplier, slot multiplier, bucket bits, slot bits,
+    displacements, slots) for keys, a dict of (bus, id) to route."""
+    rng = random.Random(0x6A09E667)
+    slot_bits = max(1, (len(keys) - 1).bit_length())
+    while slot_bits <= MAX_BITS:
+        slots = 1 << slot_bits
+        bucket_bits = max(1, slot_bits - 1)
+        for _ in range(SEEDS):
+            m1 = rng.getrandbits(32) | 1
+            m2 = rng.getrandbits(32) | 1
+            buckets = {}
+            for key in keys:
+                mixed = mix(*key)
+                buckets.setdefault(hash_bits(mixed, m1, bucket_bits), []).append((hash_bits(mixed, m2, slot_bits), key))
+            table = [None] * slots
+            displacements = [0] * (1 << bucket_bits)
+            placed = True
+            # Largest buckets first, while most slots are free.
+            for bucket, members in sorted(buckets.items(), key=lambda b: -len(b[1])):
+                found = False
+                for d in range(slots):
+                    targets = [h ^ d for h, _ in members]
+                    if len(set(targets)) == len(targets) and all(table[t] is None for t in targets):
+                        for t, (_, key) in zip(targets, members):
+                            table[t] = key
+                        displacements[bucket] = d
+                        found = True
+                        break
+                if not found:
+                    placed = False
+                    break
+            if placed:
+                return m1, m2, bucket_bits, slot_bits, displacements, table
+        slot_bits += 1
+    raise ConfigError('no perfect hash found for %d keys' % len(keys))
+
+
+def emit_header(buses, containers, routes, base, source):
+    guard = os.path.basename(base).upper() + '_H'
+    out = []
+    out.append('/* Generated by tools/gw_gen.py from %s - do not edit. */' % source)
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include "os_gw.h"')
+    out.append('')
+    out.append('#define %-32s (%d)' % ('OS_GW_CFG_NUM_BUSES', len(buses)))
+    for index, bus in enumerate(buses):
+        out.append('#define %-32s (%d)' % ('OS_GW_CFG_BUS_' + macro(bus), index))
+    for index, c in enumerate(containers):
+        out.append('#define %-32s (%d)' % ('OS_GW_CFG_CONTAINER_' + macro(c['name']), index))
+    for index, r in enumerate(routes):
+        if r['name'] is not None:
+            out.append('#define %-32s (%d)' % ('OS_GW_CFG_ROUTE_' + macro(r['name']), index))
+    out.append('')
+    out.append('extern const OsGw_Config os_gw_cfg;')
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+    return '\n'.join(out) + '\n'
+
+
+def emit_table(out, name, keys):
+    m1, m2, bucket_bits, slot_bits, displacements, table = perfect_hash(keys)
+    out.append('static const uint16 os_gw_cfg_%sDisplacements[%d] = {' % (name, len(displacements)))
+    for i in range(0, len(displacements), 12):
+        out.append('    ' + ' '.join('%d,' % d for d in displacements[i:i + 12]))
+    out.append('};')
+    out.append('')
+    out.append('static const OsGw_Key os_gw_cfg_%sKeys[%d] = {' % (name, len(table)))
+    for key in table:
+        if key is None:
+            out.append('    {0x00000000UL, 0, 0x%02XU, 0},' % BUS_NONE)
+        else:
+            out.append('    {0x%08XUL, %d, 0x%02XU, 0},' % (key[1], keys[key][0], key[0]))
+    out.append('};')
+    out.append('')
+    out.append('static const OsGw_Table os_gw_cfg_%sTable = {' % name)
+    out.append('    0x%08XUL, 0x%08XUL, %d, %d, os_gw_cfg_%sDisplacements, os_gw_cfg_%sKeys' % (
+        m1, m2, bucket_bits, slot_bits, name, name))
+    out.append('};')
+    out.append('')
+    return len(keys), len(table), len(displacements)
+
+
+def emit_source(buses, containers, routes, can_keys, pdu_keys, port, base, source):
+    out = []
+    out.append('/* Generated by tools/gw_gen.py from %s - do not edit. */' % source)
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*----------------------------------Includes----------------------------------*/')
+    out.append('/******************************************************************************/')
+    out.append('#include "%s.h"' % os.path.basename(base))
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*-------------------------Private Variables/Constants------------------------*/')
+    out.append('/******************************************************************************/')
+    sizes = {'can': emit_table(out, 'can', can_keys), 'pdu': emit_table(out, 'pdu', pdu_keys)}
+    out.append('/* canId, pduId, buses, container, flags */')
+    out.append('static const OsGw_Route os_gw_cfg_routes[%d] = {' % max(1, len(routes)))
+    for r in routes:
+        targets = [buses[b] for b in range(len(buses)) if r['buses'] & (1 << b)]
+        if r['container'] != NO_CONTAINER:
+            targets.append(containers[r['container']]['name'])
+        out.append('    {0x%08XUL, 0x%08XUL, 0x%02XU, 0x%02XU, 0x%X, 0},   /* %s: %s */' % (
+            r['can_id'], r['pdu'], r['buses'], r['container'], r['flags'], r['label'], ', '.join(targets)))
+    out.append('};')
+    out.append('')
+    out.append('static OsGw_Counters os_gw_cfg_counters[%d];' % max(1, len(routes)))
+    out.append('')
+    out.append('/* ip, port, size, timeout */')
+    out.append('static const OsGw_ContainerConfig os_gw_cfg_containers[%d] = {' % max(1, len(containers)))
+    for c in containers:
+        out.append('    {0x%08XUL, %d, %d, %d},   /* %s, %s */' % (c['ip'], c['port'], c['size'], c['timeout'], c['name'], c['ip_text']))
+    out.append('};')
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*------------------------------Global variables------------------------------*/')
+    out.append('/******************************************************************************/')
+    out.append('const OsGw_Config os_gw_cfg = {')
+    out.append('    &os_gw_cfg_canTable,')
+    out.append('    &os_gw_cfg_pduTable,')
+    out.append('    os_gw_cfg_routes,')
+    out.append('    os_gw_cfg_counters,')
+    out.append('    %d,' % len(routes))
+    out.append('    os_gw_cfg_containers,')
+    out.append('    %d,' % len(containers))
+    out.append('    %d,' % port)
+    out.append('};')
+    return '\n'.join(out) + '\n', sizes
+
+
+def report(routes, sizes):
+    print('table  keys  slots  buckets  load   ROM[B]')
+    for name in ('can', 'pdu'):
+        keys, slots, buckets = sizes[name]
+        print('%-5s  %4d  %5d  %7d  %4.2f  %7d' % (name, keys, slots, buckets, float(keys) / slots, slots * 8 + buckets * 2))
+    print('routes: %d, %d bytes ROM, %d bytes of counters' % (len(routes), len(routes) * 12, len(routes) * 16))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('config', help='route description (.json, .yaml)')
+    parser.add_argument('-o', '--output', required=True, help='output base path, .c and .h are appended')
+    parser.add_argument('--report', action='store_true', help='print the table sizes')
+    args = parser.parse_args()
+
+    try:
+        system = load(args.config)
+        buses, containers, routes, can_keys, pdu_keys = validate(system)
+        port = number('port', system.get('port', 30500), 0xFFFF)
+        source = os.path.basename(args.config)
+        text, sizes = emit_source(buses, containers, routes, can_keys, pdu_keys, port, args.output, source)
+    except (ConfigError, KeyError, ValueError, OSError) as e:
+        sys.stderr.write('gw_gen: %s\n' % (e if not isinstance(e, KeyError) else 'missing key %s' % e))
+        return 1
+
+    with open(args.output + '.h', 'w', newline='\r\n') as f:
+        f.write(emit_header(buses, containers, routes, args.output, source))
+    with open(args.output + '.c', 'w', newline='\r\n') as f:
+        f.write(text)
+    if args.report:
+        report(routes, sizes)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,983 @@
+/* Host model of the gateway engine of os/os_gw.c on 8 CAN buses at full load.
+ *
+ * The engine, unchanged, routes the frames of eight classic CAN buses of
+ * SIM_RATE bit/s with the tables tools/gw_gen.py compiles from
+ * tools/gw_sim/gw_sim.json: 24 routed identifiers per bus, each sent on to one
+ * or two other buses and a quarter of them packed into the Backbone container
+ * as well, and 16 PDUs the Backbone sends to the buses every SIM_ETH_PERIOD.
+ * Every bus also carries SIM_UNROUTED identifiers without a route.
+ *
+ * The external ECUs of a bus send their identifiers periodically, with
+ * periods drawn from 5 to 100 ms and then scaled together until the busiest
+ * bus, counting the frames the gateway sends to it, is offered the load of
+ * the scenario.  The buses arbitrate by identifier between the pending frames
+ * of the ECUs and the head of the gateway's Tx FIFO, and take the time of
+ * every frame bit by bit, dynamic stuff bits included.  A frame received
+ * waits in the Rx FIFO of its node for the CPU, which takes isrNs to enter the
+ * interrupt and frameNs per frame: these are assumptions, not target
+ * measurements.  The gateway task runs os_gw_poll() on every 1 ms tick, and
+ * a datagram from the Backbone reaches it at the second tick after it
+ * arrived, the net task of core 0 forwarding it at the first.
+ *
+ * Latency is taken from the end of the frame on its source bus, or from the
+ * arrival of the datagram, to the end of the frame on the destination bus, or
+ * to the last bit of the container on a 1 Gbit/s link.  The time of origin
+ * travels in the first bytes of the payload, so frames that waited in the
+ * queues of the engine are timed too.
+ *
+ * Build and run:
+ *     python3 tools/gw_gen.py tools/gw_sim/gw_sim.json -o /tmp/gw_sim_cfg
+ *     cc -O2 -Itools/net_tap/include -Ios -I/tmp -o gw_sim \
+ *         tools/gw_sim/gw_sim.c os/os_gw.c /tmp/gw_sim_cfg.c
+ *     ./gw_sim
+ *
+ * Rates and latencies are those of the bus model; the routing cost printed
+ * first is host thread time in os_gw_receiveCan() with a driver that takes
+ * every frame. */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "os_gw.h"
+#include "gw_sim_cfg.h"
+
+#define SIM_BUSES            OS_GW_CFG_NUM_BUSES
+#define SIM_MAX_MESSAGES     (64)          /* External identifiers per bus              */
+#define SIM_UNROUTED         (8)
+#define SIM_MAX_FIFO         (64)
+#define SIM_RATE             (500000)
+#define SIM_DURATION         (10.0e9)      /* ns simulated per scenario                 */
+#define SIM_TICK             (1.0e6)       /* ns, configTICK_RATE_HZ 1000               */
+#define SIM_ETH_PERIOD       (10.0e6)      /* ns between datagrams of the Backbone      */
+#define SIM_ETH_RATE         (1.0e9)       /* bit/s                                     */
+#define SIM_ETH_OVERHEAD     (8 + 14 + 20 + 8 + 4 + 12) /* Preamble, headers, FCS, gap  */
+#define SIM_BENCH_FRAMES     (20000000U)
+
+/* Source of a frame, in byte 6 of the payload. */
+#define SIM_FROM_CAN         (0U)
+#define SIM_FROM_ETH         (1U)
+
+#define SIM_CAN_TO_CAN       (0)
+#define SIM_CAN_TO_ETH       (1)
+#define SIM_ETH_TO_CAN       (2)
+#define SIM_PATHS            (3)
+
+typedef struct
+{
+    const char *name;
+    double      load;                      /* Offered to the busiest bus                */
+    boolean     synchronous;               /* All ECUs start together, else at random   */
+    uint32      txFifoSize;
+    uint32      rxFifoSize;
+    double      isrNs;                     /* Interrupt entry, per burst of frames      */
+    double      frameNs;                   /* CPU time per frame                        */
+} SimScenario;
+
+typedef struct
+{
+    uint32 id;
+    uint32 length;
+    uint8  data[OS_GW_MAX_DATA_LENGTH];
+} SimFrame;
+
+typedef struct
+{
+    uint32  id;
+    double  period;
+    double  next;
+    boolean pending;
+} SimMessage;
+
+typedef struct
+{
+    SimMessage messages[SIM_MAX_MESSAGES];
+    uint32     numMessages;
+    SimFrame   tx[SIM_MAX_FIFO];           /* Tx FIFO of the gateway's node              */
+    uint32     txHead;
+    uint32     txCount;
+    SimFrame   rx[SIM_MAX_FIFO];           /* Rx FIFO 0                                 */
+    double     rxTime[SIM_MAX_FIFO];
+    uint32     rxHead;
+    uint32     rxCount;
+    uint32     rxLost;
+    uint32     overruns;                   /* ECU frames replaced before they were sent */
+    boolean    busy;
+    double     end;
+    SimFrame   frame;
+    sint32     message;                    /* Sending ECU message, -1 for the gateway   */
+    double     busyTime;
+    double     offered;                    /* Load of the periods, for the report       */
+} SimBus;
+
+typedef struct
+{
+    double *values;
+    uint32  count;
+    uint32  size;
+} SimSamples;
+
+static const SimScenario *sim_scenario;
+static double             sim_now;
+static SimBus             sim_buses[SIM_BUSES];
+static SimSamples         sim_samples[SIM_PATHS];
+static double             sim_cpuFree;
+static double             sim_cpuBusy;
+static uint32             sim_received;
+static uint32             sim_routed;
+static SimFrame           sim_pdus[16];
+static uint32             sim_numPdus;
+static uint32             sim_random = 1;
+static uint32             sim_benchTime;
+
+/* xorshift32, the same sequence on every host. */
+static uint32 sim_rand(void)
+{
+    sim_random ^= sim_random << 13;
+    sim_random ^= sim_random >> 17;
+    sim_random ^= sim_random << 5;
+
+    return sim_random;
+}
+
+static void sim_putOrigin(uint8 *data, double time, uint32 source)
+{
+    uint64 ns = (uint64)time;
+    uint32 index;
+
+    for (index = 0; index < 6; index++)
+    {
+        data[index] = (uint8)(ns >> (8 * index));
+    }
+
+    data[6] = (uint8)source;
+}
+
+static double sim_getOrigin(const uint8 *data)
+{
+    uint64 ns = 0;
+    uint32 index;
+
+    for (index = 0; index < 6; index++)
+    {
+        ns |= (uint64)data[index] << (8 * index);
+    }
+
+    return (double)ns;
+}
+
+static void sim_sample(uint32 path, double latency)
+{
+    SimSamples *samples = &sim_samples[path];
+
+    if (samples->count == samples->size)
+    {
+        samples->size   = (samples->size != 0) ? (2 * samples->size) : 65536;
+        samples->values = realloc(samples->values, samples->size * sizeof(double));
+    }
+
+    samples->values[samples->count++] = latency;
+}
+
+/* Bit stuffing of a run of bits, continuing the state in last and run. */
+static uint32 sim_stuff(const uint8 *bits, uint32 count, uint8 *last, uint32 *run)
+{
+    uint32 stuffed = 0;
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        if (bits[index] == *last)
+        {
+            (*run)++;
+        }
+        else
+        {
+            *last = bits[index];
+            *run  = 1;
+        }
+
+        if (*run == 5)
+        {
+            stuffed++;
+            *last = (uint8)!*last;
+            *run  = 1;
+        }
+    }
+
+    return stuffed;
+}
+
+static uint32 sim_putBits(uint8 *bits, uint32 position, uint32 value, uint32 count)
+{
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        bits[position + index] = (uint8)((value >> (count - 1 - index)) & 1U);
+    }
+
+    return position + count;
+}
+
+static uint32 sim_crc15(const uint8 *bits, uint32 count)
+{
+    uint32 crc = 0;
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        uint32 next = bits[index] ^ ((crc >> 14) & 1U);
+
+        crc = (crc << 1) & 0x7FFFU;
+
+        if (next != 0)
+        {
+            crc ^= 0x4599U;
+        }
+    }
+
+    return crc;
+}
+
+/* Returns the ns a classic frame with an 11-bit identifier occupies the bus,
+ * from its start of frame to the end of the intermission. */
+static double sim_frameTime(const SimFrame *frame)
+{
+    uint8  bits[32 + 8 * 8];
+    uint32 position = 0;
+    uint8  last     = 2;
+    uint32 run      = 0;
+    uint32 index;
+
+    position = sim_putBits(bits, position, 0, 1);
+    position = sim_putBits(bits, position, frame->id & 0x7FFU, 11);
+    position = sim_putBits(bits, position, 0, 3);
+    position = sim_putBits(bits, position, frame->length, 4);
+
+    for (index = 0; index < frame->length; index++)
+    {
+        position = sim_putBits(bits, position, frame->data[index], 8);
+    }
+
+    position = sim_putBits(bits, position, sim_crc15(bits, position), 15);
+
+    return (position + sim_stuff(bits, position, &last, &run) + 13) * 1.0e9 / SIM_RATE;
+}
+
+/* Driver of the engine. */
+static boolean sim_canSend(void *context, uint32 bus, uint32 id, const uint8 *data, uint32 length)
+{
+    SimBus *target = &sim_buses[bus];
+    boolean sent   = (boolean)(target->txCount < sim_scenario->txFifoSize);
+
+    (void)context;
+
+    if (sent != FALSE)
+    {
+        SimFrame *frame = &target->tx[(target->txHead + target->txCount) % sim_scenario->txFifoSize];
+
+        frame->id     = id;
+        frame->length = length;
+        memcpy(frame->data, data, length);
+        target->txCount++;
+    }
+
+    return sent;
+}
+
+/* The container leaves on the link; every PDU in it is timed. */
+static boolean sim_ethSend(void *context, uint32 ip, uint16 port, const uint8 *data, uint32 length)
+{
+    double arrival = sim_now + ((length + SIM_ETH_OVERHEAD) * 8.0e9 / SIM_ETH_RATE);
+    uint32 offset  = 0;
+
+    (void)context;
+    (void)ip;
+    (void)port;
+
+    while ((offset + OS_GW_PDU_HEADER_SIZE) <= length)
+    {
+        uint32 pduLength = ((uint32)data[offset + 4] << 24) | ((uint32)data[offset + 5] << 16) | ((uint32)data[offset + 6] << 8) | data[offset + 7];
+
+        offset += OS_GW_PDU_HEADER_SIZE;
+        sim_sample(SIM_CAN_TO_ETH, arrival - sim_getOrigin(&data[offset]));
+        sim_routed++;
+        offset += pduLength;
+    }
+
+    return TRUE;
+}
+
+static uint32 sim_lock(void *context)
+{
+    (void)context;
+
+    return 0;
+}
+
+static void sim_unlock(void *context, uint32 state)
+{
+    (void)context;
+    (void)state;
+}
+
+static uint32 sim_getTime(void *context)
+{
+    (void)context;
+
+    return (uint32)(uint64)(sim_now / 1000.0);
+}
+
+static const OsGw_Driver sim_driver = {NULL, sim_canSend, sim_ethSend, sim_lock, sim_unlock, sim_getTime};
+
+/* Starts the pending ECU frame or gateway FIFO head with the lowest
+ * identifier on an idle bus. */
+static void sim_arbitrate(SimBus *bus)
+{
+    sint32 winner = -2;
+    uint32 best   = 0xFFFFFFFFU;
+    uint32 index;
+
+    if (bus->busy == FALSE)
+    {
+        for (index = 0; index < bus->numMessages; index++)
+        {
+            if ((bus->messages[index].pending != FALSE) && (bus->messages[index].id < best))
+            {
+                best   = bus->messages[index].id;
+                winner = (sint32)index;
+            }
+        }
+
+        if ((bus->txCount != 0) && ((bus->tx[bus->txHead].id & OS_GW_ID_MASK) < best))
+        {
+            winner = -1;
+        }
+
+        if (winner == -1)
+        {
+            bus->frame   = bus->tx[bus->txHead];
+            bus->txHead  = (bus->txHead + 1) % sim_scenario->txFifoSize;
+            bus->txCount--;
+        }
+        else if (winner >= 0)
+        {
+            SimMessage *message = &bus->messages[winner];
+
+            bus->frame.id     = message->id;
+            bus->frame.length = 8;
+
+            for (index = 0; index < 8; index++)
+            {
+                bus->frame.data[index] = (uint8)sim_rand();
+            }
+
+            message->pending = FALSE;
+        }
+        else {}
+
+        if (winner != -2)
+        {
+            bus->message  = winner;
+            bus->busy     = TRUE;
+            bus->end      = sim_now + sim_frameTime(&bus->frame);
+            bus->busyTime += bus->end - sim_now;
+        }
+    }
+}
+
+/* The frame on a bus ends: the gateway receives it, or it reached its
+ * destination. */
+static void sim_endFrame(SimBus *bus)
+{
+    bus->busy = FALSE;
+
+    if (bus->message < 0)
+    {
+        sim_sample((bus->frame.data[6] == SIM_FROM_ETH) ? SIM_ETH_TO_CAN : SIM_CAN_TO_CAN, sim_now - sim_getOrigin(bus->frame.data));
+        sim_routed++;
+    }
+    else if (bus->rxCount == sim_scenario->rxFifoSize)
+    {
+        bus->rxLost++;
+    }
+    else
+    {
+        uint32 slot = (bus->rxHead + bus->rxCount) % sim_scenario->rxFifoSize;
+
+        bus->rx[slot] = bus->frame;
+        sim_putOrigin(bus->rx[slot].data, sim_now, SIM_FROM_CAN);
+        bus->rxTime[slot] = sim_now;
+        bus->rxCount++;
+        sim_received++;
+    }
+
+    sim_arbitrate(bus);
+}
+
+/* Returns the bus whose Rx FIFO holds the oldest frame, or NULL. */
+static SimBus *sim_nextReceived(void)
+{
+    SimBus *oldest = NULL;
+    uint32  index;
+
+    for (index = 0; index < SIM_BUSES; index++)
+    {
+        SimBus *bus = &sim_buses[index];
+
+        if ((bus->rxCount != 0) && ((oldest == NULL) || (bus->rxTime[bus->rxHead] < oldest->rxTime[oldest->rxHead])))
+        {
+            oldest = bus;
+        }
+    }
+
+    return oldest;
+}
+
+/* Draws the periods of the external ECUs, then scales them so that the
+ * busiest bus is offered the load of the scenario. */
+static void sim_setupTraffic(void)
+{
+    static const double periods[] = {5.0e6, 10.0e6, 20.0e6, 50.0e6, 100.0e6};
+    const OsGw_Table   *table     = os_gw_cfg.canTable;
+    double              frameTime = 0;
+    double              scale     = 0;
+    double              routed[SIM_BUSES];
+    double              eth[SIM_BUSES];
+    uint32              index;
+    uint32              bus;
+    SimFrame            frame;
+
+    memset(sim_buses, 0, sizeof(sim_buses));
+    memset(routed, 0, sizeof(routed));
+    memset(eth, 0, sizeof(eth));
+    sim_random = 1;
+
+    /* Mean time of a frame of 8 random bytes. */
+    for (index = 0; index < 1000; index++)
+    {
+        uint32 byte;
+
+        frame.id     = 0x100U + (index & 0x3FFU);
+        frame.length = 8;
+
+        for (byte = 0; byte < 8; byte++)
+        {
+            frame.data[byte] = (uint8)sim_rand();
+        }
+
+        frameTime += sim_frameTime(&frame) / 1000.0;
+    }
+
+    /* The routed identifiers are the keys of the table, then the others. */
+    for (index = 0; index < (1UL << table->slotBits); index++)
+    {
+        const OsGw_Key *key = &table->keys[index];
+
+        if (key->bus < SIM_BUSES)
+        {
+            SimBus *source = &sim_buses[key->bus];
+
+            source->messages[source->numMessages].id     = key->id;
+            source->messages[source->numMessages].period = periods[sim_rand() % 5];
+            source->numMessages++;
+        }
+    }
+
+    for (bus = 0; bus < SIM_BUSES; bus++)
+    {
+        for (index = 0; index < SIM_UNROUTED; index++)
+        {
+            SimBus *source = &sim_buses[bus];
+
+            source->messages[source->numMessages].id     = 0x600U + (bus * SIM_UNROUTED) + index;
+            source->messages[source->numMessages].period = periods[sim_rand() % 5];
+            source->numMessages++;
+        }
+    }
+
+    /* Load of the unscaled periods: the ECUs of a bus, and the routes into it. */
+    for (bus = 0; bus < SIM_BUSES; bus++)
+    {
+        for (index = 0; index < sim_buses[bus].numMessages; index++)
+        {
+            const SimMessage *message = &sim_buses[bus].messages[index];
+            sint32            route   = os_gw_lookup(table, bus, message->id);
+            uint32            target;
+
+            routed[bus] += frameTime / message->period;
+
+            for (target = 0; (route >= 0) && (target < SIM_BUSES); target++)
+            {
+                if ((os_gw_cfg.routes[route].buses & (1U << target)) != 0)
+                {
+                    routed[target] += frameTime / message->period;
+                }
+            }
+        }
+    }
+
+    for (index = 0; index < (1UL << os_gw_cfg.pduTable->slotBits); index++)
+    {
+        const OsGw_Key *key = &os_gw_cfg.pduTable->keys[index];
+
+        for (bus = 0; (key->bus == OS_GW_BUS_PDU) && (bus < SIM_BUSES); bus++)
+        {
+            if ((os_gw_cfg.routes[key->route].buses & (1U << bus)) != 0)
+            {
+                eth[bus] += frameTime / SIM_ETH_PERIOD;
+            }
+        }
+    }
+
+    for (bus = 0; bus < SIM_BUSES; bus++)
+    {
+        double needed = routed[bus] / (sim_scenario->load - eth[bus]);
+
+        scale = (needed > scale) ? needed : scale;
+    }
+
+    for (bus = 0; bus < SIM_BUSES; bus++)
+    {
+        SimBus *source = &sim_buses[bus];
+
+        source->offered = (routed[bus] / scale) + eth[bus];
+
+        for (index = 0; index < source->numMessages; index++)
+        {
+            SimMessage *message = &source->messages[index];
+
+            message->period *= scale;
+            message->next    = (sim_scenario->synchronous != FALSE) ? 0 : (message->period * (sim_rand() % 1000) / 1000.0);
+        }
+    }
+
+    /* The datagram of the Backbone: one PDU for each of its routes. */
+    sim_numPdus = 0;
+
+    for (index = 0; index < (1UL << os_gw_cfg.pduTable->slotBits); index++)
+    {
+        const OsGw_Key *key = &os_gw_cfg.pduTable->keys[index];
+
+        if ((key->bus == OS_GW_BUS_PDU) && (sim_numPdus < 16))
+        {
+            sim_pdus[sim_numPdus].id     = key->id;
+            sim_pdus[sim_numPdus].length = 8;
+            sim_numPdus++;
+        }
+    }
+}
+
+/* Sends the datagram of the Backbone that arrived at time. */
+static void sim_receiveDatagram(double time)
+{
+    uint8  datagram[16 * (OS_GW_PDU_HEADER_SIZE + 8)];
+    uint32 length = 0;
+    uint32 index;
+
+    for (index = 0; index < sim_numPdus; index++)
+    {
+        uint8 *pdu = &datagram[length];
+
+        pdu[0] = (uint8)(sim_pdus[index].id >> 24);
+        pdu[1] = (uint8)(sim_pdus[index].id >> 16);
+        pdu[2] = (uint8)(sim_pdus[index].id >> 8);
+        pdu[3] = (uint8)sim_pdus[index].id;
+        pdu[4] = 0;
+        pdu[5] = 0;
+        pdu[6] = 0;
+        pdu[7] = 8;
+        memset(&pdu[8], 0x55, 8);
+        sim_putOrigin(&pdu[8], time, SIM_FROM_ETH);
+        length += OS_GW_PDU_HEADER_SIZE + 8;
+    }
+
+    os_gw_receivePdus(datagram, length);
+}
+
+static int sim_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static double sim_percentile(const SimSamples *samples, double fraction)
+{
+    uint32 index = (uint32)(fraction * (samples->count - 1));
+
+    return (samples->count != 0) ? samples->values[index] : 0;
+}
+
+static void sim_run(const SimScenario *scenario, boolean histogram)
+{
+    static const char *paths[SIM_PATHS] = {"CAN>CAN", "CAN>ETH", "ETH>CAN"};
+    OsGw_Status        status;
+    OsGw_Counters      counters;
+    OsGw_Counters      total;
+    double             nextTick    = SIM_TICK;
+    double             nextEth     = SIM_ETH_PERIOD / 2;
+    double             deliverEth  = -1;
+    double             arrivalEth  = 0;
+    double             maxLoad     = 0;
+    uint32             rxLost      = 0;
+    uint32             overruns    = 0;
+    uint32             index;
+    uint32             bus;
+
+    sim_scenario = scenario;
+    sim_now      = 0;
+    sim_cpuFree  = 0;
+    sim_cpuBusy  = 0;
+    sim_received = 0;
+    sim_routed   = 0;
+
+    for (index = 0; index < SIM_PATHS; index++)
+    {
+        sim_samples[index].count = 0;
+    }
+
+    sim_setupTraffic();
+    os_gw_init(&os_gw_cfg, &sim_driver);
+
+    while (sim_now < SIM_DURATION)
+    {
+        double  next     = nextTick;
+        SimBus *received = sim_nextReceived();
+        double  cpuDone  = -1;
+        sint32  event    = -1;         /* -1 tick, 0..7 end of frame, 8 CPU, 9 datagram, 10 release */
+
+        for (bus = 0; bus < SIM_BUSES; bus++)
+        {
+            if ((sim_buses[bus].busy != FALSE) && (sim_buses[bus].end < next))
+            {
+                next  = sim_buses[bus].end;
+                event = (sint32)bus;
+            }
+
+            for (index = 0; index < sim_buses[bus].numMessages; index++)
+            {
+                if (sim_buses[bus].messages[index].next < next)
+                {
+                    next  = sim_buses[bus].messages[index].next;
+                    event = 10;
+                }
+            }
+        }
+
+        if (received != NULL)
+        {
+            double arrival = received->rxTime[received->rxHead];
+            double start   = (arrival > sim_cpuFree) ? arrival : sim_cpuFree;
+
+            cpuDone = start + scenario->frameNs + ((arrival >= sim_cpuFree) ? scenario->isrNs : 0);
+
+            if (cpuDone < next)
+            {
+                next  = cpuDone;
+                event = 8;
+            }
+        }
+
+        if (nextEth < next)
+        {
+            next  = nextEth;
+            event = 9;
+        }
+
+        sim_now = next;
+
+        if (event == -1)
+        {
+            if ((deliverEth >= 0) && (deliverEth <= sim_now))
+            {
+                sim_receiveDatagram(arrivalEth);
+                deliverEth = -1;
+            }
+
+            (void)os_gw_poll();
+            nextTick += SIM_TICK;
+
+            for (bus = 0; bus < SIM_BUSES; bus++)
+            {
+                sim_arbitrate(&sim_buses[bus]);
+            }
+        }
+        else if (event < SIM_BUSES)
+        {
+            sim_endFrame(&sim_buses[event]);
+        }
+        else if (event == 8)
+        {
+            SimFrame *frame = &received->rx[received->rxHead];
+
+            sim_cpuBusy += cpuDone - ((received->rxTime[received->rxHead] > sim_cpuFree) ? received->rxTime[received->rxHead] : sim_cpuFree);
+            sim_cpuFree  = cpuDone;
+            (void)os_gw_receiveCan((uint32)(received - sim_buses), frame->id, frame->data, frame->length);
+            received->rxHead = (received->rxHead + 1) % scenario->rxFifoSize;
+            received->rxCount--;
+
+            for (bus = 0; bus < SIM_BUSES; bus++)
+            {
+                sim_arbitrate(&sim_buses[bus]);
+            }
+        }
+        else if (event == 9)
+        {
+            /* The net task forwards it at the next tick, the gateway task
+             * takes it at the one after. */
+            arrivalEth  = sim_now;
+            deliverEth  = (((uint64)(sim_now / SIM_TICK)) + 2) * SIM_TICK;
+            nextEth    += SIM_ETH_PERIOD;
+        }
+        else
+        {
+            for (bus = 0; bus < SIM_BUSES; bus++)
+            {
+                for (index = 0; index < sim_buses[bus].numMessages; index++)
+                {
+                    SimMessage *message = &sim_buses[bus].messages[index];
+
+                    if (message->next <= sim_now)
+                    {
+                        sim_buses[bus].overruns += (message->pending != FALSE) ? 1 : 0;
+                        message->pending         = TRUE;
+                        message->next           += message->period;
+                    }
+                }
+
+                sim_arbitrate(&sim_buses[bus]);
+            }
+        }
+    }
+
+    memset(&total, 0, sizeof(total));
+
+    for (index = 0; index < os_gw_cfg.numRoutes; index++)
+    {
+        (void)os_gw_getCounters(index, &counters);
+        total.received  += counters.received;
+        total.forwarded += counters.forwarded;
+        total.queued    += counters.queued;
+        total.dropped   += counters.dropped;
+    }
+
+    os_gw_getStatus(&status);
+
+    for (bus = 0; bus < SIM_BUSES; bus++)
+    {
+        double load = sim_buses[bus].busyTime / sim_now;
+
+        maxLoad   = (load > maxLoad) ? load : maxLoad;
+        rxLost   += sim_buses[bus].rxLost;
+        overruns += sim_buses[bus].overruns;
+    }
+
+    printf("%s\n", scenario->name);
+    printf("  bus load max %.1f %%, gateway CPU %.1f %%, received %.0f frames/s, routed %.0f frames/s (%.0f frames + PDUs delivered/s)\n",
+        100.0 * maxLoad, 100.0 * sim_cpuBusy / sim_now, sim_received * 1.0e9 / sim_now, total.forwarded * 1.0e9 / sim_now, sim_routed * 1.0e9 / sim_now);
+    printf("  queued %u, dropped %u, Rx FIFO lost %u, unrouted %u, most waiting %u, ECU overruns %u, containers %u\n",
+        total.queued, total.dropped, rxLost, status.unrouted, status.maxQueued, overruns, status.containers);
+    printf("  %-8s %9s %9s %9s %9s %9s %9s   (us)\n", "path", "samples", "p50", "p90", "p99", "p99.9", "max");
+
+    for (index = 0; index < SIM_PATHS; index++)
+    {
+        SimSamples *samples = &sim_samples[index];
+
+        qsort(samples->values, samples->count, sizeof(double), sim_compare);
+        printf("  %-8s %9u %9.0f %9.0f %9.0f %9.0f %9.0f\n", paths[index], samples->count,
+            sim_percentile(samples, 0.5) / 1000.0, sim_percentile(samples, 0.9) / 1000.0,
+            sim_percentile(samples, 0.99) / 1000.0, sim_percentile(samples, 0.999) / 1000.0,
+            sim_percentile(samples, 1.0) / 1000.0);
+    }
+
+    if (histogram != FALSE)
+    {
+        static const double bounds[] = {0.25e6, 0.5e6, 1.0e6, 2.0e6, 4.0e6, 8.0e6, 16.0e6, 1.0e12};
+        const SimSamples   *samples  = &sim_samples[SIM_CAN_TO_CAN];
+        uint32              position = 0;
+        uint32              bin;
+
+        printf("  CAN>CAN latency distribution\n");
+
+        for (bin = 0; bin < (sizeof(bounds) / sizeof(bounds[0])); bin++)
+        {
+            uint32 count = 0;
+
+            while ((position < samples->count) && (samples->values[position] < bounds[bin]))
+            {
+                position++;
+                count++;
+            }
+
+            if (bounds[bin] < 1.0e12)
+            {
+                printf("    < %6.0f us %7.3f %%\n", bounds[bin] / 1000.0, 100.0 * count / samples->count);
+            }
+            else
+            {
+                printf("    longer    %7.3f %%\n", 100.0 * count / samples->count);
+            }
+        }
+    }
+}
+
+static double sim_cpuTime(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return (double)time.tv_sec * 1.0e9 + (double)time.tv_nsec;
+}
+
+static boolean sim_benchCanSend(void *context, uint32 bus, uint32 id, const uint8 *data, uint32 length)
+{
+    (void)context;
+    (void)bus;
+    (void)id;
+    (void)data;
+    (void)length;
+
+    return TRUE;
+}
+
+static boolean sim_benchEthSend(void *context, uint32 ip, uint16 port, const uint8 *data, uint32 length)
+{
+    (void)context;
+    (void)ip;
+    (void)port;
+    (void)data;
+    (void)length;
+
+    return TRUE;
+}
+
+static uint32 sim_benchGetTime(void *context)
+{
+    (void)context;
+
+    return sim_benchTime;
+}
+
+/* Host cost of routing: three quarters of the frames have a route, and every
+ * bus takes every frame. */
+static void sim_bench(void)
+{
+    static const SimScenario scenario   = {"bench", 1.0, FALSE, 16, 16, 0, 0};
+    static const OsGw_Driver driver     = {NULL, sim_benchCanSend, sim_benchEthSend, sim_lock, sim_unlock, sim_benchGetTime};
+    static SimFrame          frames[4096];
+    static uint32            buses[4096];
+    uint8                    data[8]    = {1, 2, 3, 4, 5, 6, 7, 8};
+    volatile sint32          sink       = 0;
+    double                   start;
+    double                   routeNs;
+    double                   lookupNs;
+    uint32                   index;
+
+    sim_scenario = &scenario;
+    sim_setupTraffic();
+    os_gw_init(&os_gw_cfg, &driver);
+
+    for (index = 0; index < 4096; index++)
+    {
+        SimBus *bus = &sim_buses[sim_rand() % SIM_BUSES];
+
+        buses[index]     = (uint32)(bus - sim_buses);
+        frames[index].id = ((sim_rand() % 4) != 0) ? bus->messages[sim_rand() % (bus->numMessages - SIM_UNROUTED)].id
+                                                   : (0x600U + (sim_rand() % (SIM_BUSES * SIM_UNROUTED)));
+    }
+
+    start = sim_cpuTime();
+
+    for (index = 0; index < SIM_BENCH_FRAMES; index++)
+    {
+        (void)os_gw_receiveCan(buses[index & 4095], frames[index & 4095].id, data, 8);
+
+        if ((index & 63) == 63)
+        {
+            sim_benchTime += 100;
+            (void)os_gw_poll();
+        }
+    }
+
+    routeNs = (sim_cpuTime() - start) / SIM_BENCH_FRAMES;
+    start   = sim_cpuTime();
+
+    for (index = 0; index < SIM_BENCH_FRAMES; index++)
+    {
+        sink += os_gw_lookup(os_gw_cfg.canTable, buses[index & 4095], frames[index & 4095].id);
+    }
+
+    lookupNs = (sim_cpuTime() - start) / SIM_BENCH_FRAMES;
+
+    printf("host: %.1f ns per frame routed (%.1f Mframes/s, polls included), %.1f ns per table lookup\n\n",
+        routeNs, 1.0e3 / routeNs, lookupNs);
+}
+
+/* Every key of the tables is found, and no other identifier of the model. */
+static boolean sim_checkTables(void)
+{
+    const OsGw_Table *tables[2] = {os_gw_cfg.canTable, os_gw_cfg.pduTable};
+    boolean           ok        = TRUE;
+    uint32            table;
+    uint32            index;
+
+    for (table = 0; table < 2; table++)
+    {
+        for (index = 0; index < (1UL << tables[table]->slotBits); index++)
+        {
+            const OsGw_Key *key = &tables[table]->keys[index];
+
+            if ((key->bus != OS_GW_BUS_NONE) && (os_gw_lookup(tables[table], key->bus, key->id) != key->route))
+            {
+                ok = FALSE;
+            }
+        }
+    }
+
+    for (index = 0; index < 0x800U; index++)
+    {
+        uint32 bus;
+
+        for (bus = 0; bus < SIM_BUSES; bus++)
+        {
+            sint32 route = os_gw_lookup(os_gw_cfg.canTable, bus, index);
+
+            if ((route >= 0) && ((index < 0x080U) || (index >= 0x600U)))
+            {
+                ok = FALSE;
+            }
+        }
+    }
+
+    return ok;
+}
+
+int main(void)
+{
+    static const SimScenario scenarios[] = {
+        {"CAN 500k x 8, 80 % load, random phases",                0.80, FALSE, 16, 16, 500, 1000},
+        {"CAN 500k x 8, 95 % load, random phases",                0.95, FALSE, 16, 16, 500, 1000},
+        {"CAN 500k x 8, 95 % load, all ECUs start together",      0.95, TRUE,  16, 16, 500, 1000},
+        {"CAN 500k x 8, 95 % load, Tx FIFO 2",                    0.95, FALSE, 2,  16, 500, 1000},
+        {"CAN 500k x 8, 95 % load, 5 us per frame, Rx FIFO 4",    0.95, FALSE, 16, 4,  500, 5000},
+    };
+    uint32 index;
+
+    printf("%u routes, tables %s\n", os_gw_cfg.numRoutes,
+        (sim_checkTables() != FALSE) ? "checked" : "WRONG");
+    sim_bench();
+    printf("bus model, %.0f s per scenario, CPU interrupt entry and cost per frame assumed\n\n", SIM_DURATION / 1.0e9);
+
+    for (index = 0; index < (sizeof(scenarios) / sizeof(scenarios[0])); index++)
+    {
+        sim_run(&scenarios[index], (boolean)(index == 1));
+    }
+
+    return 0;
+}
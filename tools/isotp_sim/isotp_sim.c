@@ -0,0 +1,660 @@
+/* Host loopback of the ISO-TP engine of os/os_isotp.c on a virtual CAN bus.
+ *
+ * A tester and one or more ECUs are each an instance of os_isotp.c, unchanged,
+ * on an in-memory driver that models an MCMCAN node: a Tx FIFO sent in order,
+ * and an Rx FIFO 0 in blocking mode that loses frames arriving while it is
+ * full.  The bus arbitrates between the heads of the Tx FIFOs by identifier
+ * and takes the time of every frame bit by bit: the arbitration and end of
+ * frame at the nominal rate, the data phase of CAN FD frames at the data rate,
+ * and the dynamic stuff bits of the actual frame content, with the fixed stuff
+ * bits of the CAN FD CRC field.
+ *
+ * The tester flashes SIM_IMAGE_SIZE bytes into every ECU the UDS way: a
+ * TransferData request (0x36, sequence, block) per block of the ECU's block
+ * length, each answered with a positive response (0x76, sequence) once the
+ * ECU has received and checked the block.  Flash programming time is not
+ * modelled, nor are RequestDownload and the erase.  With several ECUs the
+ * tester runs one session per ECU in its one instance, and the ECUs share the
+ * bus.
+ *
+ * The tasks take no time.  By default they run as on the target, where the
+ * ISO-TP task is woken by the receive interrupt but only switched to at the
+ * next 1 ms tick, and polls every tick while busy; "wake" scenarios run them
+ * SIM_WAKE_LATENCY after each frame instead, for comparison.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/net_tap/include -Ios -o isotp_sim \
+ *         tools/isotp_sim/isotp_sim.c os/os_isotp.c
+ *     ./isotp_sim
+ *
+ * The rates are those of the bus model, not measured on a bus; CPU time is
+ * host thread time per frame in the engine and the driver model. */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "os_isotp.h"
+
+#define SIM_IMAGE_SIZE       (4U * 1024U * 1024U)
+#define SIM_MAX_NODES        (5)           /* The tester and up to 4 ECUs               */
+#define SIM_MAX_FIFO         (64)
+#define SIM_TICK             (1.0e6)       /* ns, configTICK_RATE_HZ 1000               */
+#define SIM_WAKE_LATENCY     (20.0e3)      /* ns from a frame to the task, wake mode    */
+#define SIM_STALL            (3.0e9)       /* ns without progress before giving up      */
+#define SIM_REQUEST_ID       (0x7E0U)      /* Physical requests, + ECU number           */
+#define SIM_RESPONSE_ID      (0x7E8U)
+
+typedef struct
+{
+    const char *name;
+    uint32      nominalRate;               /* bit/s                                     */
+    uint32      dataRate;                  /* bit/s of the CAN FD data phase            */
+    uint8       frameLength;
+    uint8       blockSize;                 /* Of the ECUs                               */
+    uint8       stMin;
+    uint32      blockLength;               /* Bytes of image per TransferData           */
+    uint32      rxFifoSize;
+    uint32      txFifoSize;
+    uint32      ecus;
+    boolean     wake;                      /* Tasks run on every frame, not on the tick */
+} SimScenario;
+
+typedef struct
+{
+    uint32  id;
+    uint32  length;
+    uint8   data[OS_ISOTP_MAX_FRAME_LENGTH];
+} SimFrame;
+
+typedef struct
+{
+    OsIsoTp        isotp;
+    OsIsoTp_Driver driver;
+    SimFrame       tx[SIM_MAX_FIFO];
+    uint32         txHead;
+    uint32         txCount;
+    SimFrame       rx[SIM_MAX_FIFO];
+    uint32         rxHead;
+    uint32         rxCount;
+    uint32         rxLost;
+    double         wakeTime;
+} SimNode;
+
+/* A transfer from the tester to one ECU. */
+typedef struct
+{
+    uint32                index;
+    sint32                testerSession;
+    OsIsoTp_SessionConfig testerConfig;
+    OsIsoTp_SessionConfig ecuConfig;
+    uint32                offset;          /* Bytes of image acknowledged               */
+    uint32                pending;         /* Bytes in the request in flight            */
+    uint8                 sequence;
+    uint8                *request;
+    uint8                *ecuBuffer;
+    uint8                 response[8];
+    uint8                 testerBuffer[8];
+    boolean               done;
+    boolean               failed;
+    OsIsoTp_Result        error;
+} SimTransfer;
+
+/* Frame length of every data length code. */
+static const uint8     sim_lengths[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+static const SimScenario *sim_scenario;
+static double          sim_now;
+static SimNode         sim_nodes[SIM_MAX_NODES];
+static SimTransfer     sim_transfers[SIM_MAX_NODES - 1];
+static uint8          *sim_image;
+static double          sim_busEnd;
+static boolean         sim_busBusy;
+static SimFrame        sim_busFrame;
+static double          sim_busTime;
+static uint32          sim_busFrames;
+static double          sim_progressTime;
+static double          sim_cpu;
+
+/* Wall time is the time of the bus model, in us for the engine. */
+static uint32 sim_getTime(void *context)
+{
+    (void)context;
+
+    return (uint32)(uint64)(sim_now / 1000.0);
+}
+
+static boolean sim_send(void *context, uint32 id, const uint8 *header, uint32 headerLength,
+                        const uint8 *payload, uint32 payloadLength, uint32 frameLength)
+{
+    SimNode *node = (SimNode *)context;
+    boolean  sent = FALSE;
+
+    if (node->txCount < sim_scenario->txFifoSize)
+    {
+        SimFrame *frame = &node->tx[(node->txHead + node->txCount) % sim_scenario->txFifoSize];
+
+        frame->id     = id;
+        frame->length = frameLength;
+        memcpy(frame->data, header, headerLength);
+        memcpy(&frame->data[headerLength], payload, payloadLength);
+        memset(&frame->data[headerLength + payloadLength], OS_ISOTP_PADDING, frameLength - headerLength - payloadLength);
+        node->txCount++;
+        sent = TRUE;
+    }
+
+    return sent;
+}
+
+/* Bit stuffing of a run of bits, continuing the state in last and run. */
+static uint32 sim_stuff(const uint8 *bits, uint32 count, uint8 *last, uint32 *run)
+{
+    uint32 stuffed = 0;
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        if (bits[index] == *last)
+        {
+            (*run)++;
+        }
+        else
+        {
+            *last = bits[index];
+            *run  = 1;
+        }
+
+        if (*run == 5)
+        {
+            stuffed++;
+            *last = (uint8)!*last;
+            *run  = 1;
+        }
+    }
+
+    return stuffed;
+}
+
+static uint32 sim_putBits(uint8 *bits, uint32 position, uint32 value, uint32 count)
+{
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        bits[position + index] = (uint8)((value >> (count - 1 - index)) & 1U);
+    }
+
+    return position + count;
+}
+
+static uint32 sim_crc15(const uint8 *bits, uint32 count)
+{
+    uint32 crc = 0;
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        uint32 next = bits[index] ^ ((crc >> 14) & 1U);
+
+        crc = (crc << 1) & 0x7FFFU;
+
+        if (next != 0)
+        {
+            crc ^= 0x4599U;
+        }
+    }
+
+    return crc;
+}
+
+/* Returns the ns a frame with an 11-bit identifier occupies the bus, from its
+ * start of frame to the end of the intermission. */
+static double sim_frameTime(const SimFrame *frame)
+{
+    const SimScenario *scenario = sim_scenario;
+    uint8              bits[32 + 8 * OS_ISOTP_MAX_FRAME_LENGTH];
+    uint32             position = 0;
+    uint32             code     = 0;
+    uint8              last     = 2;
+    uint32             run      = 0;
+    double             nominalBits;
+    double             dataBits;
+    uint32             index;
+
+    while (sim_lengths[code] < frame->length)
+    {
+        code++;
+    }
+
+    position = sim_putBits(bits, position, 0, 1);
+    position = sim_putBits(bits, position, frame->id & 0x7FFU, 11);
+
+    if ((frame->id & OS_ISOTP_ID_FD) == 0)
+    {
+        /* RTR, IDE, r0, DLC, data and the CRC all stuffed. */
+        position = sim_putBits(bits, position, 0, 3);
+        position = sim_putBits(bits, position, code, 4);
+
+        for (index = 0; index < frame->length; index++)
+        {
+            position = sim_putBits(bits, position, frame->data[index], 8);
+        }
+
+        position    = sim_putBits(bits, position, sim_crc15(bits, position), 15);
+        nominalBits = position + sim_stuff(bits, position, &last, &run) + 13;
+        dataBits    = 0;
+    }
+    else
+    {
+        /* RRS, IDE, FDF, res and BRS at the nominal rate, then ESI, DLC and
+         * data at the data rate.  Stuff count and CRC carry a fixed stuff bit
+         * every 4 bits.  CRC delimiter, ACK, EOF and intermission are
+         * nominal. */
+        uint32 crcLength = (frame->length <= 16) ? 17 : 21;
+        uint32 arbitration;
+
+        position    = sim_putBits(bits, position, 0x03U, 5);
+        arbitration = position;
+        position    = sim_putBits(bits, position, 0, 1);
+        position    = sim_putBits(bits, position, code, 4);
+
+        for (index = 0; index < frame->length; index++)
+        {
+            position = sim_putBits(bits, position, frame->data[index], 8);
+        }
+
+        nominalBits = arbitration + sim_stuff(bits, arbitration, &last, &run) + 13;
+        dataBits    = (position - arbitration) + sim_stuff(&bits[arbitration], position - arbitration, &last, &run)
+                      + 4 + crcLength + 1 + ((4 + crcLength) / 4);
+    }
+
+    return (nominalBits * 1.0e9 / scenario->nominalRate) + (dataBits * 1.0e9 / scenario->dataRate);
+}
+
+/* Starts the frame at the head of the Tx FIFO with the lowest identifier. */
+static void sim_arbitrate(void)
+{
+    SimNode *winner = NULL;
+    uint32   index;
+
+    for (index = 0; index <= sim_scenario->ecus; index++)
+    {
+        SimNode *node = &sim_nodes[index];
+
+        if ((node->txCount != 0) && ((winner == NULL) || ((node->tx[node->txHead].id & 0x7FFU) < (winner->tx[winner->txHead].id & 0x7FFU))))
+        {
+            winner = node;
+        }
+    }
+
+    if (winner != NULL)
+    {
+        double time;
+
+        sim_busFrame    = winner->tx[winner->txHead];
+        winner->txHead  = (winner->txHead + 1) % sim_scenario->txFifoSize;
+        winner->txCount--;
+        time            = sim_frameTime(&sim_busFrame);
+        sim_busBusy     = TRUE;
+        sim_busEnd      = sim_now + time;
+        sim_busTime    += time;
+        sim_busFrames++;
+    }
+}
+
+/* Delivers the frame on the bus to the nodes with a session on its
+ * identifier. */
+static void sim_deliver(void)
+{
+    uint32 index;
+
+    for (index = 0; index <= sim_scenario->ecus; index++)
+    {
+        SimNode *node  = &sim_nodes[index];
+        boolean  match = FALSE;
+        uint32   session;
+
+        for (session = 0; session < node->isotp.numSessions; session++)
+        {
+            if (node->isotp.sessions[session].config->rxId == (sim_busFrame.id & 0x7FFU))
+            {
+                match = TRUE;
+            }
+        }
+
+        if (match == FALSE)
+        {}
+        else if (node->rxCount == sim_scenario->rxFifoSize)
+        {
+            node->rxLost++;
+        }
+        else
+        {
+            node->rx[(node->rxHead + node->rxCount) % sim_scenario->rxFifoSize] = sim_busFrame;
+            node->rxCount++;
+
+            if ((sim_scenario->wake != FALSE) && isinf(node->wakeTime))
+            {
+                node->wakeTime = sim_now + SIM_WAKE_LATENCY;
+            }
+        }
+    }
+
+    sim_busBusy = FALSE;
+}
+
+static double sim_cpuTime(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return (double)time.tv_sec * 1.0e9 + (double)time.tv_nsec;
+}
+
+/* The ISO-TP task of a node: the Rx FIFO, then the timers. */
+static void sim_runTask(SimNode *node)
+{
+    double start = sim_cpuTime();
+
+    while (node->rxCount != 0)
+    {
+        SimFrame *frame = &node->rx[node->rxHead];
+
+        os_isotp_receive(&node->isotp, frame->id & 0x7FFU, frame->data, frame->length);
+        node->rxHead = (node->rxHead + 1) % sim_scenario->rxFifoSize;
+        node->rxCount--;
+    }
+
+    os_isotp_poll(&node->isotp);
+    sim_cpu += sim_cpuTime() - start;
+}
+
+/* Sends the next TransferData request of a transfer. */
+static void sim_sendRequest(SimTransfer *transfer)
+{
+    uint32         length = SIM_IMAGE_SIZE - transfer->offset;
+    OsIsoTp_Result result;
+
+    if (length > sim_scenario->blockLength)
+    {
+        length = sim_scenario->blockLength;
+    }
+
+    transfer->sequence++;
+    transfer->pending    = length;
+    transfer->request[0] = 0x36;
+    transfer->request[1] = transfer->sequence;
+    memcpy(&transfer->request[2], &sim_image[transfer->offset], length);
+    result = os_isotp_send(&sim_nodes[0].isotp, (uint32)transfer->testerSession, transfer->request, length + 2);
+
+    if (result != OsIsoTp_Result_ok)
+    {
+        transfer->failed = TRUE;
+        transfer->error  = result;
+    }
+}
+
+/* The ECU checks the block against the image, as it would program it, and
+ * answers. */
+static void sim_ecuReceived(void *arg, uint8 *data, uint32 length, OsIsoTp_Result result)
+{
+    SimTransfer *transfer = (SimTransfer *)arg;
+    SimNode     *ecu      = &sim_nodes[1 + transfer->index];
+
+    if (result != OsIsoTp_Result_ok)
+    {
+        transfer->failed = TRUE;
+        transfer->error  = result;
+    }
+    else if ((data[0] != 0x36) || (memcmp(&data[2], &sim_image[transfer->offset], length - 2) != 0))
+    {
+        fprintf(stderr, "ECU %u: block %u corrupted\n", transfer->index, data[1]);
+        exit(1);
+    }
+    else
+    {
+        transfer->response[0] = 0x76;
+        transfer->response[1] = data[1];
+        (void)os_isotp_send(&ecu->isotp, 0, transfer->response, 2);
+    }
+
+    (void)os_isotp_setRxBuffer(&ecu->isotp, 0, transfer->ecuBuffer, sim_scenario->blockLength + 2);
+}
+
+static void sim_testerReceived(void *arg, uint8 *data, uint32 length, OsIsoTp_Result result)
+{
+    SimTransfer *transfer = (SimTransfer *)arg;
+
+    if ((result == OsIsoTp_Result_ok) && (length == 2) && (data[0] == 0x76) && (data[1] == transfer->sequence))
+    {
+        transfer->offset += transfer->pending;
+        transfer->pending = 0;
+        sim_progressTime  = sim_now;
+
+        if (transfer->offset == SIM_IMAGE_SIZE)
+        {
+            transfer->done = TRUE;
+        }
+        else
+        {
+            sim_sendRequest(transfer);
+        }
+    }
+
+    (void)os_isotp_setRxBuffer(&sim_nodes[0].isotp, (uint32)transfer->testerSession, transfer->testerBuffer, sizeof(transfer->testerBuffer));
+}
+
+static void sim_testerSent(void *arg, OsIsoTp_Result result)
+{
+    SimTransfer *transfer = (SimTransfer *)arg;
+
+    if (result != OsIsoTp_Result_ok)
+    {
+        transfer->failed = TRUE;
+        transfer->error  = result;
+    }
+}
+
+static const char *sim_resultName(OsIsoTp_Result result)
+{
+    static const char *const names[] = {
+        "ok", "busy", "invalid", "N_As/N_Ar timeout", "N_Bs timeout", "N_Cr timeout", "wrong sequence", "overflow", "aborted"
+    };
+
+    return names[result];
+}
+
+static void sim_run(const SimScenario *scenario)
+{
+    OsIsoTp_Status status;
+    double         nextTick = 0;
+    boolean        running  = TRUE;
+    uint32         index;
+    uint32         lost     = 0;
+    uint32         done     = 0;
+    const char    *error    = NULL;
+    double         seconds;
+
+    sim_scenario     = scenario;
+    sim_now          = 0;
+    sim_busBusy      = FALSE;
+    sim_busTime      = 0;
+    sim_busFrames    = 0;
+    sim_progressTime = 0;
+    sim_cpu          = 0;
+    memset(sim_nodes, 0, sizeof(sim_nodes));
+
+    for (index = 0; index <= scenario->ecus; index++)
+    {
+        sim_nodes[index].driver.context = &sim_nodes[index];
+        sim_nodes[index].driver.send    = sim_send;
+        sim_nodes[index].driver.getTime = sim_getTime;
+        sim_nodes[index].wakeTime       = INFINITY;
+    }
+
+    for (index = 0; index < scenario->ecus; index++)
+    {
+        SimTransfer *transfer = &sim_transfers[index];
+        SimNode     *ecu      = &sim_nodes[1 + index];
+
+        free(transfer->request);
+        free(transfer->ecuBuffer);
+        memset(transfer, 0, sizeof(*transfer));
+        transfer->index     = index;
+        transfer->request   = malloc(scenario->blockLength + 2);
+        transfer->ecuBuffer = malloc(scenario->blockLength + 2);
+
+        transfer->testerConfig = (OsIsoTp_SessionConfig){
+            SIM_REQUEST_ID + index, SIM_RESPONSE_ID + index, scenario->frameLength, 0, 0,
+            sim_testerReceived, sim_testerSent, transfer
+        };
+        transfer->ecuConfig = (OsIsoTp_SessionConfig){
+            SIM_RESPONSE_ID + index, SIM_REQUEST_ID + index, scenario->frameLength, scenario->blockSize, scenario->stMin,
+            sim_ecuReceived, NULL, transfer
+        };
+
+        transfer->testerSession = os_isotp_open(&sim_nodes[0].isotp, &transfer->testerConfig);
+        (void)os_isotp_open(&ecu->isotp, &transfer->ecuConfig);
+        (void)os_isotp_setRxBuffer(&sim_nodes[0].isotp, (uint32)transfer->testerSession, transfer->testerBuffer, sizeof(transfer->testerBuffer));
+        (void)os_isotp_setRxBuffer(&ecu->isotp, 0, transfer->ecuBuffer, scenario->blockLength + 2);
+    }
+
+    for (index = 0; index <= scenario->ecus; index++)
+    {
+        os_isotp_start(&sim_nodes[index].isotp, &sim_nodes[index].driver);
+    }
+
+    for (index = 0; index < scenario->ecus; index++)
+    {
+        sim_sendRequest(&sim_transfers[index]);
+    }
+
+    sim_arbitrate();
+
+    while (running != FALSE)
+    {
+        double next = nextTick;
+
+        if ((sim_busBusy != FALSE) && (sim_busEnd < next))
+        {
+            next = sim_busEnd;
+        }
+
+        for (index = 0; index <= scenario->ecus; index++)
+        {
+            if (sim_nodes[index].wakeTime < next)
+            {
+                next = sim_nodes[index].wakeTime;
+            }
+        }
+
+        sim_now = next;
+
+        if ((sim_busBusy != FALSE) && (sim_busEnd <= sim_now))
+        {
+            sim_deliver();
+        }
+
+        for (index = 0; index <= scenario->ecus; index++)
+        {
+            if ((nextTick <= sim_now) || (sim_nodes[index].wakeTime <= sim_now))
+            {
+                sim_nodes[index].wakeTime = INFINITY;
+                sim_runTask(&sim_nodes[index]);
+            }
+        }
+
+        if (nextTick <= sim_now)
+        {
+            nextTick += SIM_TICK;
+        }
+
+        if (sim_busBusy == FALSE)
+        {
+            sim_arbitrate();
+        }
+
+        done = 0;
+
+        for (index = 0; index < scenario->ecus; index++)
+        {
+            if (sim_transfers[index].done != FALSE)
+            {
+                done++;
+            }
+            else if ((sim_transfers[index].failed != FALSE) && (error == NULL))
+            {
+                error = sim_resultName(sim_transfers[index].error);
+            }
+            else
+            {}
+        }
+
+        if ((done == scenario->ecus) || ((sim_now - sim_progressTime) > SIM_STALL))
+        {
+            running = FALSE;
+        }
+    }
+
+    for (index = 0; index <= scenario->ecus; index++)
+    {
+        lost += sim_nodes[index].rxLost;
+    }
+
+    os_isotp_getStatus(&sim_nodes[0].isotp, &status);
+    seconds = sim_progressTime / 1.0e9;
+
+    if (done == scenario->ecus)
+    {
+        printf("%-34s %8.2f s %8.1f kB/s %5.1f %% %8u %6u %6.0f ns\n", scenario->name, seconds,
+            (double)SIM_IMAGE_SIZE * scenario->ecus / 1024.0 / seconds, 100.0 * sim_busTime / sim_progressTime,
+            sim_busFrames, lost, sim_cpu / sim_busFrames);
+    }
+    else
+    {
+        printf("%-34s FAILED after %u of %u blocks: %s, %u frames lost\n", scenario->name,
+            sim_transfers[0].offset / scenario->blockLength, (SIM_IMAGE_SIZE + scenario->blockLength - 1) / scenario->blockLength,
+            (error != NULL) ? error : "stalled", lost);
+    }
+}
+
+int main(void)
+{
+    static const SimScenario scenarios[] = {
+        {"CAN 500k, 8 B, BS 0",              500000,  500000,  8, 0, 0,    4093,  32, 32, 1, FALSE},
+        {"FD 500k/2M, 64 B, BS 0",           500000,  2000000, 64, 0, 0,   4093,  32, 32, 1, FALSE},
+        {"FD 500k/2M, BS 0, 64 KiB blocks",  500000,  2000000, 64, 0, 0,   65536, 32, 32, 1, FALSE},
+        {"FD 500k/2M, BS 8",                 500000,  2000000, 64, 8, 0,   4093,  32, 32, 1, FALSE},
+        {"FD 500k/2M, BS 32",                500000,  2000000, 64, 32, 0,  4093,  32, 32, 1, FALSE},
+        {"FD 500k/2M, BS 8, wake",           500000,  2000000, 64, 8, 0,   4093,  32, 32, 1, TRUE},
+        {"FD 500k/2M, BS 0, STmin 300 us",   500000,  2000000, 64, 0, 0xF3, 4093, 32, 32, 1, FALSE},
+        {"FD 500k/2M, BS 0, STmin 1 ms",     500000,  2000000, 64, 0, 1,   4093,  32, 32, 1, FALSE},
+        {"FD 1M/5M, 64 B, BS 0",             1000000, 5000000, 64, 0, 0,   4093,  32, 32, 1, FALSE},
+        {"FD 1M/5M, BS 0, Rx FIFO 4",        1000000, 5000000, 64, 0, 0,   4093,  4,  32, 1, FALSE},
+        {"FD 1M/5M, BS 4, Rx FIFO 4",        1000000, 5000000, 64, 4, 0,   4093,  4,  32, 1, FALSE},
+        {"FD 1M/5M, BS 4, Rx FIFO 4, wake",  1000000, 5000000, 64, 4, 0,   4093,  4,  32, 1, TRUE},
+        {"FD 500k/2M, BS 0, 4 ECUs",         500000,  2000000, 64, 0, 0,   4093,  32, 32, 4, FALSE},
+    };
+    uint32 index;
+
+    sim_image = malloc(SIM_IMAGE_SIZE);
+
+    for (index = 0; index < SIM_IMAGE_SIZE; index++)
+    {
+        sim_image[index] = (uint8)(((uint64)index * 2654435761ULL) >> 13);
+    }
+
+    printf("%u bytes to every ECU, UDS TransferData, flash programming time not modelled\n", SIM_IMAGE_SIZE);
+    printf("%-34s %10s %13s %7s %8s %6s %9s\n", "scenario", "time", "rate", "bus", "frames", "lost", "cpu/frame");
+
+    for (index = 0; index < (sizeof(scenarios) / sizeof(scenarios[0])); index++)
+    {
+        sim_run(&scenarios[index]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,849 @@
+/* Host check of the generated fixed-size matrix and Kalman filter functions
+ * of Libraries/Service/CpuGeneric/SysSe/Math, Ifx_MatF32.c, Ifx_MatQ31.c and
+ * Ifx_KalmanF32.c, against plain loops in double precision.
+ *
+ * For every size, on random operands:
+ *
+ *  - add and transpose must be exact, multiply and matrix-vector multiply
+ *    within a relative 1e-6 of the double result;
+ *  - the Cholesky factor of a positive definite matrix, and the LDL'
+ *    factors of an indefinite one, must give back the matrix, and their
+ *    solves a small residual, also when factoring and solving in place;
+ *    a matrix that is not positive definite must be refused by Cholesky;
+ *  - the Q31 functions must be within one LSB of the rounded double result,
+ *    and saturate;
+ *  - the Kalman prediction and update must match the textbook form
+ *    K = P H' (H P H' + R)^-1, x + K y, P - K H P, computed in double with
+ *    Gaussian elimination, and the update must refuse an innovation
+ *    covariance that is not positive definite, leaving x and P unchanged.
+ *
+ * Last, an extended filter with 6 states and 3 measurements, a target
+ * moving in the plane with position, velocity and heading observed by
+ * range, bearing and speed, runs for 100000 steps, and the host times of
+ * its prediction and update are printed.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/foc_ref/include \
+ *         -ILibraries/Service/CpuGeneric -ILibraries/Service/CpuGeneric/SysSe/Math \
+ *         -o mat_check tools/mat_check/mat_check.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_MatF32.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_MatQ31.c \
+ *         Libraries/Service/CpuGeneric/SysSe/Math/Ifx_KalmanF32.c -lm
+ *     ./mat_check
+ *
+ * The times are host times, not TriCore cycles.  The functions checked are
+ * those of tools/mat_gen.py's default sizes, listed in CHECK_SIZES and
+ * CHECK_KALMAN. */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "SysSe/Math/Ifx_KalmanF32.h"
+#include "SysSe/Math/Ifx_MatF32.h"
+#include "SysSe/Math/Ifx_MatQ31.h"
+
+#define CHECK_MAX     (12)
+#define CHECK_ROUNDS  (200)
+#define CHECK_EKF_STEPS (100000)
+#define CHECK_BENCH   (1000000)
+
+#define CHECK_SIZES(X) X(2) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12)
+#define CHECK_KALMAN(X) X(2, 1) X(3, 1) X(4, 2) X(6, 2) X(6, 3) X(8, 4) X(9, 3) X(12, 6)
+
+typedef struct
+{
+    uint32 n;
+    void    (*add)(float32 *c, const float32 *a, const float32 *b);
+    void    (*transpose)(float32 *c, const float32 *a);
+    void    (*mul)(float32 *c, const float32 *a, const float32 *b);
+    void    (*mulVec)(float32 *y, const float32 *a, const float32 *x);
+    boolean (*cholesky)(float32 *l, const float32 *a);
+    void    (*choleskySolve)(float32 *x, const float32 *l, const float32 *b);
+    boolean (*ldl)(float32 *l, float32 *d, const float32 *a);
+    void    (*ldlSolve)(float32 *x, const float32 *l, const float32 *d, const float32 *b);
+    void    (*addQ31)(sint32 *c, const sint32 *a, const sint32 *b);
+    void    (*transposeQ31)(sint32 *c, const sint32 *a);
+    void    (*mulQ31)(sint32 *c, const sint32 *a, const sint32 *b);
+    void    (*mulVecQ31)(sint32 *y, const sint32 *a, const sint32 *x);
+} CheckSize;
+
+typedef struct
+{
+    uint32 n;
+    uint32 m;
+    void    (*predict)(float32 *p, const float32 *f, const float32 *q);
+    boolean (*update)(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);
+} CheckKalman;
+
+#define CHECK_SIZE_ENTRY(n)                                                                            \
+    {n, Ifx_MatF32_add##n, Ifx_MatF32_transpose##n, Ifx_MatF32_mul##n, Ifx_MatF32_mulVec##n,             \
+     Ifx_MatF32_cholesky##n, Ifx_MatF32_choleskySolve##n, Ifx_MatF32_ldl##n, Ifx_MatF32_ldlSolve##n,     \
+     Ifx_MatQ31_add##n, Ifx_MatQ31_transpose##n, Ifx_MatQ31_mul##n, Ifx_MatQ31_mulVec##n},
+#define CHECK_KALMAN_ENTRY(n, m) {n, m, Ifx_KalmanF32_predict##n, Ifx_KalmanF32_update##n##x##m},
+
+static const CheckSize   check_sizes[]  = {CHECK_SIZES(CHECK_SIZE_ENTRY)};
+static const CheckKalman check_kalman[] = {CHECK_KALMAN(CHECK_KALMAN_ENTRY)};
+
+static uint32 check_failures = 0;
+
+static uint32 check_rand(void)
+{
+    static uint64 state = 0x2545F4914F6CDD1DULL;
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return (uint32)(state >> 16);
+}
+
+/* Uniform in -1 .. 1 */
+static double check_uniform(void)
+{
+    return ((double)check_rand() / 4294967296.0) * 2.0 - 1.0;
+}
+
+static void check_random(float32 *a, uint32 count)
+{
+    uint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        a[i] = (float32)check_uniform();
+    }
+}
+
+/* a = b * b' + diagonal * I, b random: symmetric positive definite */
+static void check_spd(float32 *a, uint32 n, double diagonal)
+{
+    float32 b[CHECK_MAX * CHECK_MAX];
+    uint32  i, j, k;
+
+    check_random(b, n * n);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            double sum = (i == j) ? diagonal : 0.0;
+
+            for (k = 0; k < n; k++)
+            {
+                sum += (double)b[i * n + k] * b[j * n + k];
+            }
+
+            a[i * n + j] = (float32)sum;
+            a[j * n + i] = (float32)sum;
+        }
+    }
+}
+
+/* c = a * b of an n x k and a k x m matrix, in double; a or b transposed if
+ * their flag is set, their storage then being k x n or m x k. */
+static void check_mul(double *c, const double *a, const double *b, uint32 n, uint32 k, uint32 m, int ta, int tb)
+{
+    uint32 i, j, l;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            double sum = 0.0;
+
+            for (l = 0; l < k; l++)
+            {
+                sum += (ta ? a[l * n + i] : a[i * k + l]) * (tb ? b[j * k + l] : b[l * m + j]);
+            }
+
+            c[i * m + j] = sum;
+        }
+    }
+}
+
+static void check_toDouble(double *d, const float32 *f, uint32 count)
+{
+    uint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        d[i] = f[i];
+    }
+}
+
+/* max |a - b| / max |b| */
+static double check_error(const float32 *a, const double *b, uint32 count)
+{
+    double diff  = 0.0;
+    double scale = 0.0;
+    uint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        diff  = fmax(diff, fabs(a[i] - b[i]));
+        scale = fmax(scale, fabs(b[i]));
+    }
+
+    return diff / ((scale > 0.0) ? scale : 1.0);
+}
+
+/* x = a^-1 * b of an n x n a and an n x m b, Gaussian elimination with
+ * partial pivoting; a and b are overwritten. */
+static void check_solve(double *x, double *a, double *b, uint32 n, uint32 m)
+{
+    uint32 i, j, k;
+
+    for (k = 0; k < n; k++)
+    {
+        uint32 pivot = k;
+
+        for (i = k + 1; i < n; i++)
+        {
+            pivot = (fabs(a[i * n + k]) > fabs(a[pivot * n + k])) ? i : pivot;
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            double t = a[k * n + j]; a[k * n + j] = a[pivot * n + j]; a[pivot * n + j] = t;
+        }
+
+        for (j = 0; j < m; j++)
+        {
+            double t = b[k * m + j]; b[k * m + j] = b[pivot * m + j]; b[pivot * m + j] = t;
+        }
+
+        for (i = k + 1; i < n; i++)
+        {
+            double factor = a[i * n + k] / a[k * n + k];
+
+            for (j = k; j < n; j++)
+            {
+                a[i * n + j] -= factor * a[k * n + j];
+            }
+
+            for (j = 0; j < m; j++)
+            {
+                b[i * m + j] -= factor * b[k * m + j];
+            }
+        }
+    }
+
+    for (k = n; k-- > 0;)
+    {
+        for (j = 0; j < m; j++)
+        {
+            double sum = b[k * m + j];
+
+            for (i = k + 1; i < n; i++)
+            {
+                sum -= a[k * n + i] * x[i * m + j];
+            }
+
+            x[k * m + j] = sum / a[k * n + k];
+        }
+    }
+}
+
+static void check_report(const char *what, uint32 n, double error, double limit)
+{
+    if (!(error <= limit))
+    {
+        if (check_failures < 10)
+        {
+            printf("  FAIL %s %u: error %.3g above %.3g\n", what, n, error, limit);
+        }
+
+        check_failures++;
+    }
+}
+
+static void check_f32(const CheckSize *size, double *worst)
+{
+    uint32  n = size->n;
+    float32 a[CHECK_MAX * CHECK_MAX], b[CHECK_MAX * CHECK_MAX], c[CHECK_MAX * CHECK_MAX];
+    float32 l[CHECK_MAX * CHECK_MAX], d[CHECK_MAX], x[CHECK_MAX], v[CHECK_MAX];
+    double  ad[CHECK_MAX * CHECK_MAX], bd[CHECK_MAX * CHECK_MAX], cd[CHECK_MAX * CHECK_MAX];
+    double  ld[CHECK_MAX * CHECK_MAX];
+    double  error;
+    uint32  round, i, j;
+
+    for (round = 0; round < CHECK_ROUNDS; round++)
+    {
+        check_random(a, n * n);
+        check_random(b, n * n);
+        check_random(v, n);
+        check_toDouble(ad, a, n * n);
+        check_toDouble(bd, b, n * n);
+
+        /* add, transpose: exact */
+        size->add(c, a, b);
+
+        for (i = 0; i < n * n; i++)
+        {
+            if (c[i] != a[i] + b[i])
+            {
+                check_report("add", n, 1.0, 0.0);
+                break;
+            }
+        }
+
+        size->transpose(c, a);
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                if (c[i * n + j] != a[j * n + i])
+                {
+                    check_report("transpose", n, 1.0, 0.0);
+                    i = n;
+                    break;
+                }
+            }
+        }
+
+        /* mul, mulVec */
+        size->mul(c, a, b);
+        check_mul(cd, ad, bd, n, n, n, 0, 0);
+        error    = check_error(c, cd, n * n);
+        worst[0] = fmax(worst[0], error);
+        check_report("mul", n, error, 1.0e-6);
+
+        size->mulVec(x, a, v);
+        check_toDouble(bd, v, n);
+        check_mul(cd, ad, bd, n, n, 1, 0, 0);
+        error    = check_error(x, cd, n);
+        worst[0] = fmax(worst[0], error);
+        check_report("mulVec", n, error, 1.0e-6);
+
+        /* Cholesky: l * l' = a, in place on alternate rounds */
+        check_spd(a, n, n);
+        check_toDouble(ad, a, n * n);
+        memcpy(l, a, sizeof(float32) * n * n);
+
+        if (((round & 1) ? size->cholesky(l, l) : size->cholesky(l, a)) == FALSE)
+        {
+            check_report("cholesky refused", n, 1.0, 0.0);
+        }
+
+        check_toDouble(ld, l, n * n);
+        check_mul(cd, ld, ld, n, n, n, 0, 1);
+        error    = check_error(a, cd, n * n);   /* symmetric, so a against cd */
+        worst[1] = fmax(worst[1], error);
+        check_report("cholesky", n, error, 1.0e-6);
+
+        memcpy(x, v, sizeof(float32) * n);
+        size->choleskySolve(x, l, x);
+        check_toDouble(bd, x, n);
+        check_mul(cd, ad, bd, n, n, 1, 0, 0);
+        error    = check_error(v, cd, n);       /* |b - a * x| / |a * x| */
+        worst[1] = fmax(worst[1], error);
+        check_report("choleskySolve residual", n, error, 1.0e-5);
+
+        /* Not positive definite: a negative pivot in the middle */
+        a[(n / 2) * n + (n / 2)] = -a[(n / 2) * n + (n / 2)];
+
+        if (size->cholesky(l, a) != FALSE)
+        {
+            check_report("cholesky accepted", n, 1.0, 0.0);
+        }
+
+        /* LDL': a symmetric indefinite, the diagonal of alternate signs */
+        check_spd(a, n, n);
+
+        for (i = 0; i < n; i += 2)
+        {
+            for (j = 0; j < n; j++)
+            {
+                a[i * n + j] = -a[i * n + j];
+                a[j * n + i] = -a[j * n + i];
+            }
+        }
+
+        check_toDouble(ad, a, n * n);
+        memcpy(l, a, sizeof(float32) * n * n);
+
+        if (((round & 1) ? size->ldl(l, d, l) : size->ldl(l, d, a)) == FALSE)
+        {
+            check_report("ldl refused", n, 1.0, 0.0);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                ld[i * n + j] = (double)l[i * n + j] * d[j];
+            }
+        }
+
+        check_toDouble(bd, l, n * n);
+        check_mul(cd, ld, bd, n, n, n, 0, 1);
+        error    = check_error(a, cd, n * n);
+        worst[1] = fmax(worst[1], error);
+        check_report("ldl", n, error, 1.0e-6);
+
+        memcpy(x, v, sizeof(float32) * n);
+        size->ldlSolve(x, l, d, x);
+        check_toDouble(bd, x, n);
+        check_mul(cd, ad, bd, n, n, 1, 0, 0);
+        error    = check_error(v, cd, n);       /* |b - a * x| / |a * x| */
+        worst[1] = fmax(worst[1], error);
+        check_report("ldlSolve residual", n, error, 1.0e-5);
+    }
+}
+
+/* Q31 of a double, rounded and saturated */
+static sint32 check_q31(double value)
+{
+    value = floor(value * 2147483648.0 + 0.5);
+
+    return (sint32)((value > 2147483647.0) ? 2147483647.0 : ((value < -2147483648.0) ? -2147483648.0 : value));
+}
+
+
+/* Q31 of a sum of Q62 products, rounded and saturated */
+static sint32 check_q31Sum(__int128 sum)
+{
+    sum = (sum + ((__int128)1 << 30)) >> 31;
+
+    return (sint32)((sum > 0x7FFFFFFF) ? 0x7FFFFFFF : ((sum < -0x7FFFFFFF - 1) ? (-0x7FFFFFFF - 1) : sum));
+}
+
+static void check_q31Size(const CheckSize *size, double *worst)
+{
+    uint32 n = size->n;
+    sint32 a[CHECK_MAX * CHECK_MAX], b[CHECK_MAX * CHECK_MAX], c[CHECK_MAX * CHECK_MAX];
+    sint32 v[CHECK_MAX], y[CHECK_MAX];
+    uint32 round, i, j, k;
+
+    for (round = 0; round < CHECK_ROUNDS; round++)
+    {
+        /* Full scale on odd rounds, so that sums saturate; within 1 / n on
+         * even rounds, so that they do not. */
+        double scale = (round & 1) ? 1.0 : 1.0 / n;
+
+        for (i = 0; i < n * n; i++)
+        {
+            a[i] = check_q31(check_uniform() * scale);
+            b[i] = check_q31(check_uniform() * scale);
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            v[i] = check_q31(check_uniform() * scale);
+        }
+
+        if (round == 1)
+        {
+            /* -1 * -1 summed n times, and -1 + -1 */
+            for (i = 0; i < n * n; i++)
+            {
+                a[i] = -0x7FFFFFFF - 1;
+                b[i] = -0x7FFFFFFF - 1;
+            }
+        }
+
+        size->addQ31(c, a, b);
+
+        for (i = 0; i < n * n; i++)
+        {
+            if (c[i] != check_q31Sum(((__int128)a[i] + b[i]) << 31))
+            {
+                check_report("Q31 add", n, 1.0, 0.0);
+                break;
+            }
+        }
+
+        size->transposeQ31(c, a);
+
+        for (i = 0; i < n * n; i++)
+        {
+            if (c[i] != a[(i % n) * n + (i / n)])
+            {
+                check_report("Q31 transpose", n, 1.0, 0.0);
+                break;
+            }
+        }
+
+        size->mulQ31(c, a, b);
+        size->mulVecQ31(y, a, v);
+
+        for (i = 0; i < n; i++)
+        {
+            __int128 sum = 0;
+
+            for (j = 0; j < n; j++)
+            {
+                __int128 element = 0;
+
+                for (k = 0; k < n; k++)
+                {
+                    element += (__int128)((sint64)a[i * n + k] * b[k * n + j]);
+                }
+
+                worst[2] = fmax(worst[2], fabs((double)c[i * n + j] - check_q31Sum(element)));
+                sum     += (__int128)((sint64)a[i * n + j] * v[j]);
+            }
+
+            worst[2] = fmax(worst[2], fabs((double)y[i] - check_q31Sum(sum)));
+        }
+
+        if (round == 1)
+        {
+            if (c[0] != 0x7FFFFFFF)
+            {
+                check_report("Q31 saturation", n, 1.0, 0.0);
+            }
+        }
+    }
+
+    check_report("Q31 mul, LSB", n, worst[2], 1.0);
+}
+
+/* The Kalman prediction and update against the textbook form in double. */
+static void check_kalmanSize(const CheckKalman *kalman, double *worst)
+{
+    uint32  n = kalman->n;
+    uint32  m = kalman->m;
+    float32 x[CHECK_MAX], p[CHECK_MAX * CHECK_MAX], f[CHECK_MAX * CHECK_MAX], q[CHECK_MAX * CHECK_MAX];
+    float32 h[CHECK_MAX * CHECK_MAX], r[CHECK_MAX * CHECK_MAX], y[CHECK_MAX];
+    float32 x0[CHECK_MAX], p0[CHECK_MAX * CHECK_MAX];
+    double  xd[CHECK_MAX], pd[CHECK_MAX * CHECK_MAX], fd[CHECK_MAX * CHECK_MAX], hd[CHECK_MAX * CHECK_MAX];
+    double  t[CHECK_MAX * CHECK_MAX], hp[CHECK_MAX * CHECK_MAX], s[CHECK_MAX * CHECK_MAX];
+    double  kt[CHECK_MAX * CHECK_MAX], yd[CHECK_MAX];
+    double  error;
+    uint32  round, i, j;
+
+    for (round = 0; round < CHECK_ROUNDS; round++)
+    {
+        check_spd(p, n, 1.0);
+        check_random(f, n * n);
+        check_spd(q, n, 0.1);
+        check_random(h, m * n);
+        check_spd(r, m, 0.5);
+        check_random(x, n);
+        check_random(y, m);
+
+        /* p = f * p * f' + q */
+        check_toDouble(pd, p, n * n);
+        check_toDouble(fd, f, n * n);
+        check_mul(t, fd, pd, n, n, n, 0, 0);
+        check_mul(pd, t, fd, n, n, n, 0, 1);
+
+        for (i = 0; i < n * n; i++)
+        {
+            pd[i] += q[i];
+        }
+
+        kalman->predict(p, f, q);
+        error    = check_error(p, pd, n * n);
+        worst[3] = fmax(worst[3], error);
+        check_report("predict", n, error, 1.0e-5);
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < i; j++)
+            {
+                if (p[i * n + j] != p[j * n + i])
+                {
+                    check_report("predict symmetry", n, 1.0, 0.0);
+                }
+            }
+        }
+
+        /* k' = (h p h' + r)^-1 * (h p), x + k y, p - k (h p) */
+        check_toDouble(pd, p, n * n);
+        check_toDouble(hd, h, m * n);
+        check_toDouble(xd, x, n);
+        check_toDouble(yd, y, m);
+        check_mul(hp, hd, pd, m, n, n, 0, 0);
+        check_mul(s, hp, hd, m, n, m, 0, 1);
+
+        for (i = 0; i < m * m; i++)
+        {
+            s[i] += r[i];
+        }
+
+        memcpy(t, hp, sizeof(double) * m * n);
+        check_solve(kt, s, t, m, n);
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < m; j++)
+            {
+                xd[i] += kt[j * n + i] * yd[j];
+            }
+        }
+
+        check_mul(t, kt, hp, n, m, n, 1, 0);
+
+        for (i = 0; i < n * n; i++)
+        {
+            pd[i] -= t[i];
+        }
+
+        if (kalman->update(x, p, h, r, y) == FALSE)
+        {
+            check_report("update refused", n * 100 + m, 1.0, 0.0);
+        }
+
+        error    = check_error(x, xd, n);
+        worst[4] = fmax(worst[4], error);
+        check_report("update x", n * 100 + m, error, 1.0e-4);
+        error    = check_error(p, pd, n * n);
+        worst[4] = fmax(worst[4], error);
+        check_report("update p", n * 100 + m, error, 1.0e-4);
+
+        /* Not positive definite: p = 0, r = -I */
+        memset(p, 0, sizeof(p));
+        memset(r, 0, sizeof(r));
+
+        for (i = 0; i < m; i++)
+        {
+            r[i * m + i] = -1.0f;
+        }
+
+        memcpy(x0, x, sizeof(x));
+        memcpy(p0, p, sizeof(p));
+
+        if ((kalman->update(x, p, h, r, y) != FALSE) || (memcmp(x, x0, sizeof(x)) != 0) || (memcmp(p, p0, sizeof(p)) != 0))
+        {
+            check_report("update accepted", n * 100 + m, 1.0, 0.0);
+        }
+    }
+}
+
+/* The extended filter: state px, py (m), speed (m/s), heading (rad), turn
+ * rate (rad/s) and acceleration (m/s^2); measurements range (m), bearing
+ * (rad) and speed, of a target near (100 m, 50 m) at 100 Hz. */
+#define EKF_DT (0.01)
+
+static void ekf_state(double *x, double dt)
+{
+    x[0] += x[2] * cos(x[3]) * dt;
+    x[1] += x[2] * sin(x[3]) * dt;
+    x[2] += x[5] * dt;
+    x[3] += x[4] * dt;
+}
+
+static void ekf_jacobian(float32 *f, const float32 *x)
+{
+    float32 c = cosf(x[3]) * (float32)EKF_DT;
+    float32 s = sinf(x[3]) * (float32)EKF_DT;
+
+    memset(f, 0, sizeof(float32) * 36);
+    f[0]  = 1.0f;
+    f[2]  = c;
+    f[3]  = -x[2] * s;
+    f[7]  = 1.0f;
+    f[8]  = s;
+    f[9]  = x[2] * c;
+    f[14] = 1.0f;
+    f[17] = (float32)EKF_DT;
+    f[21] = 1.0f;
+    f[22] = (float32)EKF_DT;
+    f[28] = 1.0f;
+    f[35] = 1.0f;
+}
+
+static void ekf_measure(double *z, const double *x)
+{
+    z[0] = sqrt(x[0] * x[0] + x[1] * x[1]);
+    z[1] = atan2(x[1], x[0]);
+    z[2] = x[2];
+}
+
+static void ekf_h(float32 *h, const float32 *x)
+{
+    float32 r2 = x[0] * x[0] + x[1] * x[1];
+    float32 r  = sqrtf(r2);
+
+    memset(h, 0, sizeof(float32) * 18);
+    h[0]  = x[0] / r;
+    h[1]  = x[1] / r;
+    h[6]  = -x[1] / r2;
+    h[7]  = x[0] / r2;
+    h[14] = 1.0f;
+}
+
+/* Normal, Box-Muller */
+static double check_normal(void)
+{
+    double u = ((double)check_rand() + 1.0) / 4294967297.0;
+    double v = ((double)check_rand() + 1.0) / 4294967297.0;
+
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static double check_cpuTime(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    return (double)time.tv_sec * 1.0e9 + (double)time.tv_nsec;
+}
+
+static void check_ekf(void)
+{
+    static const double noise[3] = {0.5, 0.005, 0.1};   /* Standard deviations of the measurements */
+    double  truth[6] = {100.0, 50.0, 5.0, 0.0, 0.0, 0.0};
+    double  z[3], zPredicted[3], xd[6];
+    float32 x[6], p[36], f[36], q[36], h[18], r[9], y[3], p0[36], x0[6];
+    double  filterSquares = 0.0, measuredSquares = 0.0;
+    double  start, predictTime, stepTime, copyTime;
+    uint32  refused = 0, counted = 0;
+    uint32  step, i;
+
+    memset(p, 0, sizeof(p));
+    memset(q, 0, sizeof(q));
+    memset(r, 0, sizeof(r));
+
+    for (i = 0; i < 6; i++)
+    {
+        x[i] = (float32)truth[i];
+    }
+
+    x[0] += 2.0f;
+    x[2] -= 1.0f;
+    p[0]  = p[7] = 4.0f;
+    p[14] = 1.0f;
+    p[21] = 0.1f;
+    p[28] = 0.01f;
+    p[35] = 0.1f;
+    q[0]  = q[7] = 1.0e-6f;
+    q[14] = 1.0e-4f;
+    q[21] = 1.0e-6f;
+    q[28] = 1.0e-4f;
+    q[35] = 1.0e-3f;
+
+    for (i = 0; i < 3; i++)
+    {
+        r[i * 3 + i] = (float32)(noise[i] * noise[i]);
+    }
+
+    for (step = 0; step < CHECK_EKF_STEPS; step++)
+    {
+        /* The target turns and accelerates, changing every 10 s. */
+        if ((step % 1000) == 0)
+        {
+            truth[4] = 0.05 * check_uniform();
+            truth[5] = 0.2 * check_uniform() - 0.02 * (truth[2] - 5.0);
+        }
+
+        ekf_state(truth, EKF_DT);
+        ekf_measure(z, truth);
+
+        for (i = 0; i < 3; i++)
+        {
+            z[i] += noise[i] * check_normal();
+        }
+
+        /* Predict */
+        ekf_jacobian(f, x);
+        check_toDouble(xd, x, 6);
+        ekf_state(xd, EKF_DT);
+
+        for (i = 0; i < 6; i++)
+        {
+            x[i] = (float32)xd[i];
+        }
+
+        Ifx_KalmanF32_predict6(p, f, q);
+
+        /* Update */
+        ekf_measure(zPredicted, xd);
+        ekf_h(h, x);
+        y[0] = (float32)(z[0] - zPredicted[0]);
+        y[1] = (float32)remainder(z[1] - zPredicted[1], 2.0 * M_PI);
+        y[2] = (float32)(z[2] - zPredicted[2]);
+        refused += (Ifx_KalmanF32_update6x3(x, p, h, r, y) == FALSE);
+
+        if (step >= 1000)
+        {
+            double mx = z[0] * cos(z[1]);
+            double my = z[0] * sin(z[1]);
+
+            filterSquares   += (x[0] - truth[0]) * (x[0] - truth[0]) + (x[1] - truth[1]) * (x[1] - truth[1]);
+            measuredSquares += (mx - truth[0]) * (mx - truth[0]) + (my - truth[1]) * (my - truth[1]);
+            counted++;
+        }
+    }
+
+    printf("EKF 6 states, 3 measurements, %u steps: position rms error %.3f m, of the measurements alone %.3f m, "
+           "%u updates refused\n", CHECK_EKF_STEPS, sqrt(filterSquares / counted), sqrt(measuredSquares / counted), refused);
+
+    if ((refused != 0) || !(filterSquares < measuredSquares))
+    {
+        check_report("EKF", 6, 1.0, 0.0);
+    }
+
+    /* Host times, the covariance restored before every call */
+    memcpy(p0, p, sizeof(p));
+    memcpy(x0, x, sizeof(x));
+    start = check_cpuTime();
+
+    for (step = 0; step < CHECK_BENCH; step++)
+    {
+        memcpy(p, p0, sizeof(p));
+        memcpy(x, x0, sizeof(x));
+        __asm__ volatile ("" : : "r" (p), "r" (x) : "memory");
+    }
+
+    copyTime = check_cpuTime() - start;
+    start    = check_cpuTime();
+
+    for (step = 0; step < CHECK_BENCH; step++)
+    {
+        memcpy(p, p0, sizeof(p));
+        memcpy(x, x0, sizeof(x));
+        Ifx_KalmanF32_predict6(p, f, q);
+        __asm__ volatile ("" : : "r" (p), "r" (x) : "memory");
+    }
+
+    predictTime = check_cpuTime() - start;
+    start       = check_cpuTime();
+
+    for (step = 0; step < CHECK_BENCH; step++)
+    {
+        memcpy(p, p0, sizeof(p));
+        memcpy(x, x0, sizeof(x));
+        Ifx_KalmanF32_update6x3(x, p, h, r, y);
+        __asm__ volatile ("" : : "r" (p), "r" (x) : "memory");
+    }
+
+    stepTime = check_cpuTime() - start;
+    printf("host, not TriCore: Ifx_KalmanF32_predict6 %.1f ns, Ifx_KalmanF32_update6x3 %.1f ns\n",
+           (predictTime - copyTime) / CHECK_BENCH, (stepTime - copyTime) / CHECK_BENCH);
+}
+
+int main(void)
+{
+    double worst[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+    uint32 i;
+
+    for (i = 0; i < sizeof(check_sizes) / sizeof(check_sizes[0]); i++)
+    {
+        double q31[3] = {0.0, 0.0, 0.0};
+
+        check_f32(&check_sizes[i], worst);
+        check_q31Size(&check_sizes[i], q31);
+        worst[2] = fmax(worst[2], q31[2]);
+    }
+
+    for (i = 0; i < sizeof(check_kalman) / sizeof(check_kalman[0]); i++)
+    {
+        check_kalmanSize(&check_kalman[i], worst);
+    }
+
+    printf("sizes 2 to 12, %u rounds each: mul %.2g, factorisations %.2g relative, Q31 within %.0f LSB\n",
+           CHECK_ROUNDS, worst[0], worst[1], worst[2]);
+    printf("Kalman, %u sizes: predict %.2g, update %.2g relative to double\n",
+           (uint32)(sizeof(check_kalman) / sizeof(check_kalman[0])), worst[3], worst[4]);
+    check_ekf();
+    printf("%u failures\n", check_failures);
+
+    return (check_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,526 @@
+#!/usr/bin/env python3
+"""
+Generator of the fixed-size matrix and Kalman filter functions of the SysSe
+math library (Ifx_MatF32, Ifx_MatQ31 and Ifx_KalmanF32).
+
+Every function is specialised for one size and written out with constant
+indices, without loops, so that the compiler keeps the elements in
+registers and schedules the multiplies freely:
+
+  * Ifx_MatF32: add, transpose, multiply and matrix-vector multiply of n x n
+    float32 matrices, the Cholesky and LDL' factorisations and their solves;
+  * Ifx_MatQ31: add, transpose, multiply and matrix-vector multiply of n x n
+    Q31 matrices, saturating;
+  * Ifx_KalmanF32: the covariance prediction of an n state filter and the
+    measurement update of an n state filter with m measurements, computing
+    one triangle of every symmetric matrix.
+
+Usage:
+    tools/mat_gen.py -o Libraries/Service/CpuGeneric/SysSe/Math \\
+        [--sizes 2-12] [--kalman 2x1,3x1,4x2,6x2,6x3,8x4,9x3,12x6]
+
+The files in the library were generated with the defaults; generate another
+set of sizes into the application rather than editing them.
+"""
+
+import argparse
+import os
+import sys
+
+DEFAULT_SIZES = '2-12'
+DEFAULT_KALMAN = '2x1,3x1,4x2,6x2,6x3,8x4,9x3,12x6'
+WIDTH = 110
+
+LICENSE = """ * \\copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+"""
+
+
+class ConfigError(Exception):
+    pass
+
+
+def parse_sizes(text):
+    sizes = set()
+    for part in text.split(','):
+        bounds = part.split('-')
+        if len(bounds) > 2:
+            raise ConfigError('bad size range %r' % part)
+        low, high = int(bounds[0]), int(bounds[-1])
+        if not 2 <= low <= high <= 16:
+            raise ConfigError('sizes must be within 2 to 16: %r' % part)
+        sizes.update(range(low, high + 1))
+    return sorted(sizes)
+
+
+def parse_kalman(text):
+    pairs = set()
+    for part in text.split(','):
+        n, _, m = part.partition('x')
+        n, m = int(n), int(m)
+        if not (2 <= n <= 16 and 1 <= m <= n):
+            raise ConfigError('Kalman sizes must be n x m with 2 <= n <= 16, 1 <= m <= n: %r' % part)
+        pairs.add((n, m))
+    return sorted(pairs)
+
+
+def statement(lhs, terms, op='=', indent='    ', opening='', closing=''):
+    """lhs op opening terms[0] + terms[1] ... closing; wrapped after WIDTH
+    columns, the continuation lines aligned on the first term."""
+    head = '%s%s %s %s' % (indent, lhs, op, opening)
+    lines = []
+    line = head
+    for index, term in enumerate(terms):
+        text = term if index == 0 else ' + ' + term
+        if index > 0 and len(line) + len(text) > WIDTH:
+            lines.append(line)
+            line = ' ' * (len(head) - 2) + '+ ' + term
+        else:
+            line += text
+    lines.append(line + closing + ';')
+    return lines
+
+
+def difference(lhs, first, terms, indent='    ', scale=''):
+    """lhs = (first - (terms[0] + terms[1] ...)) scale, scale being e.g. ' * inv[0]'"""
+    if not terms:
+        return ['%s%s = %s%s;' % (indent, lhs, first, scale)] if (first != lhs) or scale else []
+    if scale:
+        return statement(lhs, terms, '=', indent, '(%s - (' % first, '))' + scale)
+    return statement(lhs, terms, '=', indent, '%s - (' % first, ')')
+
+
+def banner(name, brief, doc):
+    return ['/**', ' * \\file %s' % name, ' * \\brief %s' % brief, ' *', ' * Generated by tools/mat_gen.py - do not edit.',
+            ' *'] + LICENSE.rstrip('\n').split('\n') + [' *'] + doc + [' */', '']
+
+
+# ----------------------------------------------------------------------------
+# Ifx_MatF32
+
+def f32_add(n):
+    out = ['void Ifx_MatF32_add%d(float32 *c, const float32 *a, const float32 *b)' % n, '{']
+    out += ['    c[%d] = a[%d] + b[%d];' % (i, i, i) for i in range(n * n)]
+    return out + ['}']
+
+
+def f32_transpose(n):
+    out = ['void Ifx_MatF32_transpose%d(float32 *c, const float32 *a)' % n, '{']
+    out += ['    c[%d] = a[%d];' % (i * n + j, j * n + i) for i in range(n) for j in range(n)]
+    return out + ['}']
+
+
+def f32_mul(n):
+    out = ['void Ifx_MatF32_mul%d(float32 *c, const float32 *a, const float32 *b)' % n, '{']
+    for i in range(n):
+        for j in range(n):
+            out += statement('c[%d]' % (i * n + j), ['a[%d] * b[%d]' % (i * n + k, k * n + j) for k in range(n)])
+    return out + ['}']
+
+
+def f32_mul_vec(n):
+    out = ['void Ifx_MatF32_mulVec%d(float32 *y, const float32 *a, const float32 *x)' % n, '{']
+    for i in range(n):
+        out += statement('y[%d]' % i, ['a[%d] * x[%d]' % (i * n + k, k) for k in range(n)])
+    return out + ['}']
+
+
+def cholesky_body(n, a, l, inv, indent='    '):
+    """Lower Cholesky factor of a into l, in place if a is l; the reciprocal
+    pivots in inv. Clears ok if a pivot is not positive."""
+    out = []
+    for j in range(n):
+        jj = j * n + j
+        out += difference('pivot', '%s[%d]' % (a, jj), ['%s[%d] * %s[%d]' % (l, j * n + k, l, j * n + k) for k in range(j)], indent)
+        out += ['%sok &= (boolean)(pivot > 0.0f);' % indent,
+                '%s%s[%d] = sqrtf((pivot > 0.0f) ? pivot : 1.0f);' % (indent, l, jj),
+                '%s%s[%d] = 1.0f / %s[%d];' % (indent, inv, j, l, jj)]
+        for i in range(j + 1, n):
+            terms = ['%s[%d] * %s[%d]' % (l, i * n + k, l, j * n + k) for k in range(j)]
+            out += difference('%s[%d]' % (l, i * n + j), '%s[%d]' % (a, i * n + j), terms, indent, ' * %s[%d]' % (inv, j))
+    return out
+
+
+def f32_cholesky(n):
+    out = ['boolean Ifx_MatF32_cholesky%d(float32 *l, const float32 *a)' % n, '{',
+           '    float32 inv[%d];' % n, '    float32 pivot;', '    boolean ok = TRUE;', '']
+    out += cholesky_body(n, 'a', 'l', 'inv')
+    out += ['    l[%d] = 0.0f;' % (i * n + j) for i in range(n) for j in range(i + 1, n)]
+    return out + ['', '    return ok;', '}']
+
+
+def f32_cholesky_solve(n):
+    out = ['void Ifx_MatF32_choleskySolve%d(float32 *x, const float32 *l, const float32 *b)' % n, '{']
+    for i in range(n):
+        out += difference('x[%d]' % i, 'b[%d]' % i, ['l[%d] * x[%d]' % (i * n + k, k) for k in range(i)], scale=' / l[%d]' % (i * n + i))
+    for i in reversed(range(n)):
+        out += difference('x[%d]' % i, 'x[%d]' % i, ['l[%d] * x[%d]' % (k * n + i, k) for k in range(i + 1, n)],
+                          scale=' / l[%d]' % (i * n + i))
+    return out + ['}']
+
+
+def f32_ldl(n):
+    out = ['boolean Ifx_MatF32_ldl%d(float32 *l, float32 *d, const float32 *a)' % n, '{',
+           '    float32 v[%d];' % n, '    float32 inv;', '    boolean ok = TRUE;', '']
+    for j in range(n):
+        jj = j * n + j
+        out += ['    v[%d] = l[%d] * d[%d];' % (k, j * n + k, k) for k in range(j)]
+        out += difference('d[%d]' % j, 'a[%d]' % jj, ['l[%d] * v[%d]' % (j * n + k, k) for k in range(j)])
+        out += ['    ok  &= (boolean)(d[%d] != 0.0f);' % j,
+                '    inv  = 1.0f / ((d[%d] != 0.0f) ? d[%d] : 1.0f);' % (j, j)]
+        for i in range(j + 1, n):
+            out += difference('l[%d]' % (i * n + j), 'a[%d]' % (i * n + j), ['l[%d] * v[%d]' % (i * n + k, k) for k in range(j)],
+                              scale=' * inv')
+        out += ['    l[%d] = 1.0f;' % jj]
+    out += ['    l[%d] = 0.0f;' % (i * n + j) for i in range(n) for j in range(i + 1, n)]
+    return out + ['', '    return ok;', '}']
+
+
+def f32_ldl_solve(n):
+    out = ['void Ifx_MatF32_ldlSolve%d(float32 *x, const float32 *l, const float32 *d, const float32 *b)' % n, '{']
+    for i in range(n):
+        out += difference('x[%d]' % i, 'b[%d]' % i, ['l[%d] * x[%d]' % (i * n + k, k) for k in range(i)])
+    out += ['    x[%d] = x[%d] / d[%d];' % (i, i, i) for i in range(n)]
+    for i in reversed(range(n)):
+        out += difference('x[%d]' % i, 'x[%d]' % i, ['l[%d] * x[%d]' % (k * n + i, k) for k in range(i + 1, n)])
+    return out + ['}']
+
+
+F32_FUNCTIONS = (f32_add, f32_transpose, f32_mul, f32_mul_vec, f32_cholesky, f32_cholesky_solve, f32_ldl, f32_ldl_solve)
+
+F32_PROTOTYPES = [
+    'IFX_EXTERN void    Ifx_MatF32_add%(n)d(float32 *c, const float32 *a, const float32 *b);',
+    'IFX_EXTERN void    Ifx_MatF32_transpose%(n)d(float32 *c, const float32 *a);',
+    'IFX_EXTERN void    Ifx_MatF32_mul%(n)d(float32 *c, const float32 *a, const float32 *b);',
+    'IFX_EXTERN void    Ifx_MatF32_mulVec%(n)d(float32 *y, const float32 *a, const float32 *x);',
+    'IFX_EXTERN boolean Ifx_MatF32_cholesky%(n)d(float32 *l, const float32 *a);',
+    'IFX_EXTERN void    Ifx_MatF32_choleskySolve%(n)d(float32 *x, const float32 *l, const float32 *b);',
+    'IFX_EXTERN boolean Ifx_MatF32_ldl%(n)d(float32 *l, float32 *d, const float32 *a);',
+    'IFX_EXTERN void    Ifx_MatF32_ldlSolve%(n)d(float32 *x, const float32 *l, const float32 *d, const float32 *b);',
+]
+
+F32_DOC = """ * \\defgroup library_srvsw_sysse_math_f32_mat Fixed-size matrices
+ * This module holds the operations on n x n float32 matrices for n = %(sizes)s,
+ * one function per operation and size, named after the size, e.g.
+ * Ifx_MatF32_mul6(). Every function is written out with constant indices,
+ * without loops.
+ *
+ * A matrix is an array of n * n float32 in row-major order, element (i, j)
+ * at index i * n + j; a vector is an array of n float32. The result must
+ * not overlap an operand, except where stated.
+ *
+ * - Ifx_MatF32_addN(): c = a + b, c may be a or b
+ * - Ifx_MatF32_transposeN(): c = a'
+ * - Ifx_MatF32_mulN(): c = a * b
+ * - Ifx_MatF32_mulVecN(): y = a * x
+ * - Ifx_MatF32_choleskyN(): lower l with l * l' = a, of a symmetric positive
+ *   definite a of which only the lower triangle is read; l may be a. Returns
+ *   FALSE if a is not positive definite, l is then not valid.
+ * - Ifx_MatF32_choleskySolveN(): x with l * l' * x = b; x may be b.
+ * - Ifx_MatF32_ldlN(): unit lower l and diagonal d with l * diag(d) * l' = a,
+ *   of a symmetric a of which only the lower triangle is read, without square
+ *   roots; l may be a. Returns FALSE on a zero pivot.
+ * - Ifx_MatF32_ldlSolveN(): x with l * diag(d) * l' * x = b; x may be b.
+ *
+ * See Ifx_KalmanF32.h for the filters built on them, and tools/mat_check for
+ * the host checks against a reference implementation.
+ *
+ * \\ingroup library_srvsw_sysse_math_f32"""
+
+
+def emit_f32(sizes):
+    header = banner('Ifx_MatF32.h', 'Fixed-size float32 matrices', (F32_DOC % {'sizes': size_text(sizes)}).split('\n'))
+    header += ['#ifndef IFX_MATF32_H', '#define IFX_MATF32_H 1', '', '#include "Cpu/Std/Ifx_Types.h"', '',
+               '/** \\addtogroup library_srvsw_sysse_math_f32_mat', ' * \\{ */']
+    for n in sizes:
+        header += ['', '/** \\name %d x %d' % (n, n), ' * \\{ */']
+        header += [p % {'n': n} for p in F32_PROTOTYPES]
+        header += ['/** \\} */']
+    header += ['', '/** \\} */', '', '#endif /* IFX_MATF32_H */']
+
+    source = banner('Ifx_MatF32.c', 'Fixed-size float32 matrices', [])
+    source += ['#include "Ifx_MatF32.h"', '#include <math.h>']
+    for n in sizes:
+        for function in F32_FUNCTIONS:
+            source += ['', ''] + function(n)
+    return header, source
+
+
+# ----------------------------------------------------------------------------
+# Ifx_MatQ31
+
+def q31_add(n):
+    out = ['void Ifx_MatQ31_add%d(sint32 *c, const sint32 *a, const sint32 *b)' % n, '{']
+    out += ['    c[%d] = Ifx_MatQ31_saturate((sint64)a[%d] + b[%d]);' % (i, i, i) for i in range(n * n)]
+    return out + ['}']
+
+
+def q31_transpose(n):
+    out = ['void Ifx_MatQ31_transpose%d(sint32 *c, const sint32 *a)' % n, '{']
+    out += ['    c[%d] = a[%d];' % (i * n + j, j * n + i) for i in range(n) for j in range(n)]
+    return out + ['}']
+
+
+def q31_sum(lhs, products):
+    lines = statement('sum', ['IFX_MATQ31_Q58(%s)' % p for p in products])
+    return lines + ['    %s = Ifx_MatQ31_fromQ58(sum);' % lhs]
+
+
+def q31_mul(n):
+    out = ['void Ifx_MatQ31_mul%d(sint32 *c, const sint32 *a, const sint32 *b)' % n, '{', '    sint64 sum;', '']
+    for i in range(n):
+        for j in range(n):
+            out += q31_sum('c[%d]' % (i * n + j), ['a[%d], b[%d]' % (i * n + k, k * n + j) for k in range(n)])
+    return out + ['}']
+
+
+def q31_mul_vec(n):
+    out = ['void Ifx_MatQ31_mulVec%d(sint32 *y, const sint32 *a, const sint32 *x)' % n, '{', '    sint64 sum;', '']
+    for i in range(n):
+        out += q31_sum('y[%d]' % i, ['a[%d], x[%d]' % (i * n + k, k) for k in range(n)])
+    return out + ['}']
+
+
+Q31_FUNCTIONS = (q31_add, q31_transpose, q31_mul, q31_mul_vec)
+
+Q31_PROTOTYPES = [
+    'IFX_EXTERN void Ifx_MatQ31_add%(n)d(sint32 *c, const sint32 *a, const sint32 *b);',
+    'IFX_EXTERN void Ifx_MatQ31_transpose%(n)d(sint32 *c, const sint32 *a);',
+    'IFX_EXTERN void Ifx_MatQ31_mul%(n)d(sint32 *c, const sint32 *a, const sint32 *b);',
+    'IFX_EXTERN void Ifx_MatQ31_mulVec%(n)d(sint32 *y, const sint32 *a, const sint32 *x);',
+]
+
+Q31_DOC = """ * \\defgroup library_srvsw_sysse_math_q31_mat Fixed-size Q31 matrices
+ * This module holds the operations on n x n Q31 matrices for n = %(sizes)s,
+ * laid out as those of \\ref library_srvsw_sysse_math_f32_mat: add,
+ * transpose, multiply and matrix-vector multiply. An element is a sint32
+ * with 1.0 at 2^31.
+ *
+ * Products are summed exactly to 58 fractional bits, which holds 16 full
+ * scale products without overflow, rounded once to Q31 and saturated.
+ * Additions saturate. The factorisations and the Kalman filter are float32
+ * only, their intermediate values needing more range than Q31 has.
+ *
+ * \\ingroup library_srvsw_sysse_math"""
+
+Q31_HELPERS = """/** \\brief Product of two Q31 values in Q58 */
+#define IFX_MATQ31_Q58(a, b) (((sint64)(a) * (b)) >> 4)
+
+/** \\brief Saturate to Q31
+ * \\param value Sum of two Q31 values
+ * \\return value limited to -1 .. 1 - 2^-31
+ */
+IFX_INLINE sint32 Ifx_MatQ31_saturate(sint64 value)
+{
+    return (sint32)((value > 0x7FFFFFFF) ? 0x7FFFFFFF : ((value < -0x7FFFFFFF - 1) ? (-0x7FFFFFFF - 1) : value));
+}
+
+
+/** \\brief Round a Q58 sum to Q31 and saturate
+ * \\param sum Sum of IFX_MATQ31_Q58() products
+ * \\return Q31 value
+ */
+IFX_INLINE sint32 Ifx_MatQ31_fromQ58(sint64 sum)
+{
+    return Ifx_MatQ31_saturate((sum + (1LL << 26)) >> 27);
+}
+"""
+
+
+def emit_q31(sizes):
+    header = banner('Ifx_MatQ31.h', 'Fixed-size Q31 matrices', (Q31_DOC % {'sizes': size_text(sizes)}).split('\n'))
+    header += ['#ifndef IFX_MATQ31_H', '#define IFX_MATQ31_H 1', '', '#include "Cpu/Std/Ifx_Types.h"', '']
+    header += Q31_HELPERS.rstrip('\n').split('\n')
+    header += ['', '/** \\addtogroup library_srvsw_sysse_math_q31_mat', ' * \\{ */']
+    for n in sizes:
+        header += ['', '/** \\name %d x %d' % (n, n), ' * \\{ */']
+        header += [p % {'n': n} for p in Q31_PROTOTYPES]
+        header += ['/** \\} */']
+    header += ['', '/** \\} */', '', '#endif /* IFX_MATQ31_H */']
+
+    source = banner('Ifx_MatQ31.c', 'Fixed-size Q31 matrices', [])
+    source += ['#include "Ifx_MatQ31.h"']
+    for n in sizes:
+        for function in Q31_FUNCTIONS:
+            source += ['', ''] + function(n)
+    return header, source
+
+
+# ----------------------------------------------------------------------------
+# Ifx_KalmanF32
+
+def kalman_predict(n):
+    out = ['void Ifx_KalmanF32_predict%d(float32 *p, const float32 *f, const float32 *q)' % n, '{',
+           '    float32 t[%d];' % (n * n), '']
+    for i in range(n):
+        for j in range(n):
+            out += statement('t[%d]' % (i * n + j), ['f[%d] * p[%d]' % (i * n + k, k * n + j) for k in range(n)])
+    out += ['']
+    for i in range(n):
+        for j in range(i, n):
+            out += statement('p[%d]' % (i * n + j), ['t[%d] * f[%d]' % (i * n + k, j * n + k) for k in range(n)] + ['q[%d]' % (i * n + j)])
+    out += ['']
+    out += ['    p[%d] = p[%d];' % (j * n + i, i * n + j) for i in range(n) for j in range(i + 1, n)]
+    return out + ['}']
+
+
+def kalman_update(n, m):
+    out = ['boolean Ifx_KalmanF32_update%dx%d(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y)' % (n, m), '{',
+           '    float32 u[%d];' % (n * m), '    float32 s[%d];' % (m * m), '    float32 v[%d];' % m, '    float32 inv[%d];' % m,
+           '    float32 pivot;', '    boolean ok = TRUE;', '', '    /* u = p * h\' */']
+    for i in range(n):
+        for k in range(m):
+            out += statement('u[%d]' % (i * m + k), ['p[%d] * h[%d]' % (i * n + j, k * n + j) for j in range(n)])
+    out += ['', '    /* s = h * u + r, lower triangle */']
+    for k in range(m):
+        for l in range(k + 1):
+            out += statement('s[%d]' % (k * m + l), ['h[%d] * u[%d]' % (k * n + i, i * m + l) for i in range(n)] + ['r[%d]' % (k * m + l)])
+    out += ['', '    /* s = L * L\' */']
+    out += cholesky_body(m, 's', 's', 'inv')
+    out += ['', '    /* u = u * L^-T, v = L^-1 * y */']
+    for i in range(n):
+        for l in range(m):
+            terms = ['u[%d] * s[%d]' % (i * m + k, l * m + k) for k in range(l)]
+            out += difference('u[%d]' % (i * m + l), 'u[%d]' % (i * m + l), terms, scale=' * inv[%d]' % l)
+    for l in range(m):
+        out += difference('v[%d]' % l, 'y[%d]' % l, ['s[%d] * v[%d]' % (l * m + k, k) for k in range(l)], scale=' * inv[%d]' % l)
+    out += ['', '    if (ok != FALSE)', '    {', '        /* x = x + u * v, p = p - u * u\', upper triangle */']
+    for i in range(n):
+        out += statement('x[%d]' % i, ['u[%d] * v[%d]' % (i * m + l, l) for l in range(m)], '+=', '        ')
+    for i in range(n):
+        for j in range(i, n):
+            out += statement('p[%d]' % (i * n + j), ['u[%d] * u[%d]' % (i * m + l, j * m + l) for l in range(m)], '-=', '        ')
+    out += ['']
+    out += ['        p[%d] = p[%d];' % (j * n + i, i * n + j) for i in range(n) for j in range(i + 1, n)]
+    out += ['    }', '', '    return ok;', '}']
+    return out
+
+
+KALMAN_DOC = """ * \\defgroup library_srvsw_sysse_math_f32_kalman Kalman filter
+ * This module holds the covariance prediction and the measurement update of
+ * linear and extended Kalman filters, for n states and m measurements:
+ * Ifx_KalmanF32_predictN() for n = %(predict)s, and
+ * Ifx_KalmanF32_updateNxM() for n x m = %(update)s.
+ * Like \\ref library_srvsw_sysse_math_f32_mat they are written out for
+ * their size; tools/mat_gen.py generates other sizes.
+ *
+ * The state x is a vector of n float32, the covariance p a symmetric n x n
+ * matrix in row-major order, both halves valid. The noise covariances q and
+ * r must be symmetric too.
+ *
+ * Ifx_KalmanF32_predictN() sets p = f * p * f' + q for the transition f
+ * (the Jacobian of the state function of an extended filter) and the
+ * process noise q. The caller propagates the state, e.g. with
+ * Ifx_MatF32_mulVecN() or its own state function.
+ *
+ * Ifx_KalmanF32_updateNxM() takes the m x n measurement matrix h (the
+ * Jacobian of an extended filter), the m x m measurement noise r and the
+ * innovation y = z - h(x). It factors s = h * p * h' + r = L * L' with
+ * Cholesky, so that with u = p * h' * L^-T the gain applied is
+ * u * L^-1 and p becomes p - u * u'. Only one triangle of p, s and of
+ * p * f' is computed and the other is copied, so that p stays exactly
+ * symmetric. It returns FALSE, and leaves x and p unchanged, if s is not
+ * positive definite.
+ *
+ * Example, an extended filter with 6 states and 3 measurements:
+ * \\code
+ * float32 x[6], p[6 * 6], f[6 * 6], q[6 * 6], h[3 * 6], r[3 * 3], y[3];
+ *
+ *     stateFunction(x, u, dt);     // x = f(x, u), and its Jacobian into f
+ *     Ifx_KalmanF32_predict6(p, f, q);
+ *     ...
+ *     measurementFunction(y, h, x); // y = h(x), and its Jacobian into h
+ *     y[0] = z[0] - y[0]; y[1] = z[1] - y[1]; y[2] = z[2] - y[2];
+ *     if (Ifx_KalmanF32_update6x3(x, p, h, r, y) == FALSE) { ... }
+ * \\endcode
+ * Reading IfxCpu_getClockCounter() before and after the calls gives their
+ * cycles on the target; tools/mat_check runs this filter on the host.
+ *
+ * \\ingroup library_srvsw_sysse_math_f32"""
+
+
+def emit_kalman(pairs):
+    predicts = sorted(set(n for n, _ in pairs))
+    doc = KALMAN_DOC % {'predict': ', '.join(str(n) for n in predicts),
+                        'update': ', '.join('%dx%d' % pair for pair in pairs)}
+    header = banner('Ifx_KalmanF32.h', 'Kalman filter of fixed size', doc.split('\n'))
+    header += ['#ifndef IFX_KALMANF32_H', '#define IFX_KALMANF32_H 1', '', '#include "SysSe/Math/Ifx_MatF32.h"', '',
+               '/** \\addtogroup library_srvsw_sysse_math_f32_kalman', ' * \\{ */', '']
+    header += ['IFX_EXTERN void    Ifx_KalmanF32_predict%d(float32 *p, const float32 *f, const float32 *q);' % n for n in predicts]
+    header += ['']
+    header += ['IFX_EXTERN boolean Ifx_KalmanF32_update%dx%d(float32 *x, float32 *p, const float32 *h, const float32 *r, const float32 *y);' % pair
+               for pair in pairs]
+    header += ['', '/** \\} */', '', '#endif /* IFX_KALMANF32_H */']
+
+    source = banner('Ifx_KalmanF32.c', 'Kalman filter of fixed size', [])
+    source += ['#include "Ifx_KalmanF32.h"', '#include <math.h>']
+    for n in predicts:
+        source += ['', ''] + kalman_predict(n)
+    for n, m in pairs:
+        source += ['', ''] + kalman_update(n, m)
+    return header, source
+
+
+def size_text(sizes):
+    if sizes == list(range(sizes[0], sizes[-1] + 1)):
+        return '%d to %d' % (sizes[0], sizes[-1])
+    return ', '.join(str(n) for n in sizes)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('-o', '--output', required=True, help='output directory')
+    parser.add_argument('--sizes', default=DEFAULT_SIZES, help='matrix sizes, e.g. 2-12 or 3,6 (default %s)' % DEFAULT_SIZES)
+    parser.add_argument('--kalman', default=DEFAULT_KALMAN, help='Kalman filter sizes n x m (default %s)' % DEFAULT_KALMAN)
+    args = parser.parse_args()
+
+    try:
+        sizes = parse_sizes(args.sizes)
+        pairs = parse_kalman(args.kalman)
+        files = {}
+        for base, (header, source) in (('Ifx_MatF32', emit_f32(sizes)), ('Ifx_MatQ31', emit_q31(sizes)),
+                                       ('Ifx_KalmanF32', emit_kalman(pairs))):
+            files[base + '.h'] = header
+            files[base + '.c'] = source
+        for name, lines in files.items():
+            with open(os.path.join(args.output, name), 'w', newline='\r\n') as f:
+                f.write('\n'.join(lines) + '\n')
+    except (ConfigError, ValueError, OSError) as e:
+        sys.stderr.write('mat_gen: %s\n' % e)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,16 @@
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/* Host stand-in for the parts of the kernel os/os_net.c uses: every thread of
+ * net_tap.c plays one core. */
+
+#include "Ifx_Types.h"
+
+#define configNUM_CORES       (7)
+
+extern __thread uint32 net_tap_coreId;
+
+#define portGET_CORE_ID()     (net_tap_coreId)
+#define portMEMORY_BARRIER()  __sync_synchronize()
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,28 @@
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H
+
+/* Host stand-in for the iLLD base types, see net_tap.c, tools/tsn_sim and tools/ptp_sim. */
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef int64_t  sint64;
+typedef uint8_t  boolean;
+typedef float    float32;
+
+#ifndef TRUE
+#define TRUE     (1)
+#endif
+#ifndef FALSE
+#define FALSE    (0)
+#endif
+#define NULL_PTR ((void *)0)
+
+#endif /* IFX_TYPES_H */
@@ -0,0 +1,485 @@
+/* Linux TAP stand-in for the GETH driver of the UDP/IPv4 stack (os/os_net.c).
+ *
+ * The stack runs unchanged on a TAP interface, with one thread per core:
+ * core 0 polls the interface, UDP port 7 (echo) is bound to core 1 and port 9
+ * (discard) to core 2, so that datagrams cross cores the way they do on the
+ * target.  The interface gets 10.0.0.1/24 on the host side, the stack answers
+ * ARP, ping and the two ports at 10.0.0.2.
+ *
+ * Build and run, as root or with CAP_NET_ADMIN:
+ *     cc -O2 -pthread -Itools/net_tap/include -Ios -o net_tap \
+ *         tools/net_tap/net_tap.c os/os_net.c
+ *     ./net_tap [-i tap0] [--bench [seconds]]
+ *
+ * Without --bench it serves until interrupted, e.g. for ping 10.0.0.2 or
+ * "nc -u 10.0.0.2 7".  With --bench it measures from a host UDP socket:
+ *   - the round trip of 64 byte datagrams through the echo port,
+ *   - datagrams/s a flood to the discard port is delivered at,
+ *   - datagrams/s core 3 sends to the host, zero-copy, at.
+ *
+ * The numbers include the Linux network stack and TAP on both sides and
+ * only compare builds on the same host; they are not target figures. */
+
+#define _GNU_SOURCE
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+#include "os_net.h"
+
+#define NET_TAP_RX_BUFFERS   (8)          /* As IFXGETH_MAX_RX_DESCRIPTORS       */
+#define NET_TAP_BUFFER_SIZE  (1536)
+#define NET_TAP_ECHO_PORT    (7)
+#define NET_TAP_DISCARD_PORT (9)
+#define NET_TAP_HOST_PORT    (5000)
+#define NET_TAP_ROUNDS       (20000)
+
+__thread uint32 net_tap_coreId;
+
+static int              net_tap_fd = -1;
+static uint8            net_tap_rx[NET_TAP_RX_BUFFERS][NET_TAP_BUFFER_SIZE];
+static volatile boolean net_tap_rxUsed[NET_TAP_RX_BUFFERS];
+static uint8            net_tap_tx[configNUM_CORES][NET_TAP_BUFFER_SIZE];
+static volatile int     net_tap_running = 1;
+static volatile int     net_tap_sending;
+static volatile uint32  net_tap_discarded;
+
+/******************************************************************************/
+/* Driver                                                                     */
+/******************************************************************************/
+
+static uint8 *net_tap_receive(void *context, uint32 *length, uint32 *flags, uint64 *timestamp)
+{
+    uint8  *frame = NULL_PTR;
+    uint32  index;
+    ssize_t size;
+
+    (void)context;
+    (void)timestamp;
+
+    for (index = 0; (index < NET_TAP_RX_BUFFERS) && (frame == NULL_PTR); index++)
+    {
+        if (net_tap_rxUsed[index] == FALSE)
+        {
+            frame = net_tap_rx[index];
+        }
+    }
+
+    if (frame != NULL_PTR)
+    {
+        size = read(net_tap_fd, frame, NET_TAP_BUFFER_SIZE);
+
+        if (size <= 0)
+        {
+            frame = NULL_PTR;
+        }
+        else
+        {
+            net_tap_rxUsed[(frame - net_tap_rx[0]) / NET_TAP_BUFFER_SIZE] = TRUE;
+            *length = (uint32)size;
+            *flags  = 0;
+        }
+    }
+
+    return frame;
+}
+
+static void net_tap_release(void *context, uint8 *frame)
+{
+    (void)context;
+    __sync_synchronize();
+    net_tap_rxUsed[(frame - net_tap_rx[0]) / NET_TAP_BUFFER_SIZE] = FALSE;
+}
+
+static uint8 *net_tap_getTxBuffer(void *context)
+{
+    (void)context;
+    return net_tap_tx[portGET_CORE_ID()];
+}
+
+static boolean net_tap_send(void *context, uint8 *frame, uint32 length, uint32 flags)
+{
+    (void)context;
+    (void)flags;
+    return (boolean)(write(net_tap_fd, frame, length) == (ssize_t)length);
+}
+
+static const OsNet_Driver net_tap_driver = {
+    .context           = NULL_PTR,
+    .receive           = net_tap_receive,
+    .release           = net_tap_release,
+    .getTxBuffer       = net_tap_getTxBuffer,
+    .send              = net_tap_send,
+    .getTxTimestamp    = NULL_PTR,
+    .txChecksumOffload = FALSE,
+};
+
+/******************************************************************************/
+/* Ports and cores                                                            */
+/******************************************************************************/
+
+static void net_tap_echo(void *arg, const OsNet_Datagram *datagram)
+{
+    uint8 *payload = os_net_udpGetBuffer();
+
+    (void)arg;
+
+    if (payload != NULL_PTR)
+    {
+        memcpy(payload, datagram->payload, datagram->length);
+        (void)os_net_udpSend(payload, datagram->length, datagram->port, datagram->sourceIp, datagram->sourcePort);
+    }
+}
+
+static void net_tap_discard(void *arg, const OsNet_Datagram *datagram)
+{
+    (void)arg;
+    (void)datagram;
+    net_tap_discarded++;
+}
+
+static void *net_tap_poller(void *arg)
+{
+    struct pollfd fd = {.fd = net_tap_fd, .events = POLLIN};
+
+    net_tap_coreId = (uint32)(uintptr_t)arg;
+
+    while (net_tap_running)
+    {
+        if (os_net_poll(8) == 0)
+        {
+            (void)poll(&fd, 1, 10);
+        }
+    }
+
+    return NULL;
+}
+
+static void *net_tap_dispatcher(void *arg)
+{
+    net_tap_coreId = (uint32)(uintptr_t)arg;
+
+    while (net_tap_running)
+    {
+        if (os_net_dispatch() == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* Core 3: sends numbered datagrams to the host port while net_tap_sending. */
+static void *net_tap_sender(void *arg)
+{
+    uint32 sequence = 0;
+
+    net_tap_coreId = (uint32)(uintptr_t)arg;
+
+    while (net_tap_running)
+    {
+        uint8 *payload = net_tap_sending ? os_net_udpGetBuffer() : NULL_PTR;
+
+        if (payload == NULL_PTR)
+        {
+            usleep(1000);
+        }
+        else
+        {
+            memset(payload, 0, 64);
+            memcpy(payload, &sequence, sizeof(sequence));
+            (void)os_net_udpSend(payload, 64, NET_TAP_DISCARD_PORT, OS_NET_IP(10, 0, 0, 1), NET_TAP_HOST_PORT);
+            sequence++;
+        }
+    }
+
+    return NULL;
+}
+
+/******************************************************************************/
+/* Host side                                                                  */
+/******************************************************************************/
+
+static int net_tap_open(const char *name)
+{
+    struct ifreq       request;
+    struct sockaddr_in address;
+    int                control;
+    int                fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+
+    if (fd < 0)
+    {
+        perror("net_tap: /dev/net/tun");
+        return -1;
+    }
+
+    memset(&request, 0, sizeof(request));
+    request.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(request.ifr_name, name, IFNAMSIZ - 1);
+
+    if (ioctl(fd, TUNSETIFF, &request) < 0)
+    {
+        perror("net_tap: TUNSETIFF");
+        close(fd);
+        return -1;
+    }
+
+    /* 10.0.0.1/24 on the host side, and up. */
+    control = socket(AF_INET, SOCK_DGRAM, 0);
+    memset(&address, 0, sizeof(address));
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(OS_NET_IP(10, 0, 0, 1));
+    memcpy(&request.ifr_addr, &address, sizeof(address));
+
+    if (ioctl(control, SIOCSIFADDR, &request) < 0)
+    {
+        perror("net_tap: SIOCSIFADDR");
+    }
+
+    address.sin_addr.s_addr = htonl(OS_NET_IP(255, 255, 255, 0));
+    memcpy(&request.ifr_netmask, &address, sizeof(address));
+
+    if (ioctl(control, SIOCSIFNETMASK, &request) < 0)
+    {
+        perror("net_tap: SIOCSIFNETMASK");
+    }
+
+    if (ioctl(control, SIOCGIFFLAGS, &request) == 0)
+    {
+        request.ifr_flags |= IFF_UP | IFF_RUNNING;
+        (void)ioctl(control, SIOCSIFFLAGS, &request);
+    }
+
+    close(control);
+
+    return fd;
+}
+
+static double net_tap_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+static int net_tap_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void net_tap_status(void)
+{
+    OsNet_Status total = {0};
+    OsNet_Status core;
+    uint32       coreId;
+
+    for (coreId = 0; coreId < configNUM_CORES; coreId++)
+    {
+        if (os_net_getStatus(coreId, &core) != FALSE)
+        {
+            total.rxFrames         += core.rxFrames;
+            total.rxDatagrams      += core.rxDatagrams;
+            total.rxDropped        += core.rxDropped;
+            total.rxChecksumErrors += core.rxChecksumErrors;
+            total.dispatchOverruns += core.dispatchOverruns;
+            total.txFrames         += core.txFrames;
+            total.txFailed         += core.txFailed;
+        }
+    }
+
+    printf("stack: rx %u frames, %u datagrams, %u dropped, %u checksum errors, %u overruns; tx %u frames, %u failed\n",
+        total.rxFrames, total.rxDatagrams, total.rxDropped, total.rxChecksumErrors, total.dispatchOverruns,
+        total.txFrames, total.txFailed);
+    fflush(stdout);
+}
+
+static int net_tap_bench(double seconds)
+{
+    struct sockaddr_in stack = {.sin_family = AF_INET};
+    struct sockaddr_in host  = {.sin_family = AF_INET};
+    struct timeval     timeout = {.tv_sec = 1};
+    static double      rtt[NET_TAP_ROUNDS];
+    uint8              buffer[64] = {0};
+    uint32             rounds     = 0;
+    uint32             received   = 0;
+    uint32             sent       = 0;
+    uint32             start;
+    double             begin;
+    double             end;
+    int                s          = socket(AF_INET, SOCK_DGRAM, 0);
+
+    host.sin_addr.s_addr = htonl(OS_NET_IP(10, 0, 0, 1));
+    host.sin_port        = htons(NET_TAP_HOST_PORT);
+
+    if ((s < 0) || (bind(s, (struct sockaddr *)&host, sizeof(host)) < 0))
+    {
+        perror("net_tap: host socket");
+        return 1;
+    }
+
+    (void)setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    stack.sin_addr.s_addr = htonl(OS_NET_IP(10, 0, 0, 2));
+
+    /* Round trips; the first resolves the stack by ARP. */
+    stack.sin_port = htons(NET_TAP_ECHO_PORT);
+
+    while (rounds < NET_TAP_ROUNDS)
+    {
+        double sentAt = net_tap_now();
+
+        memcpy(buffer, &rounds, sizeof(rounds));
+        (void)sendto(s, buffer, sizeof(buffer), 0, (struct sockaddr *)&stack, sizeof(stack));
+
+        if (recv(s, buffer, sizeof(buffer), 0) != (ssize_t)sizeof(buffer))
+        {
+            fprintf(stderr, "net_tap: no echo for round %u\n", rounds);
+            return 1;
+        }
+
+        rtt[rounds++] = (net_tap_now() - sentAt) * 1e6;
+    }
+
+    qsort(rtt, NET_TAP_ROUNDS, sizeof(rtt[0]), net_tap_compare);
+    printf("echo, 64 byte payload, %u rounds: rtt median %.1f us, p99 %.1f us, max %.1f us\n",
+        NET_TAP_ROUNDS, rtt[NET_TAP_ROUNDS / 2], rtt[(NET_TAP_ROUNDS * 99) / 100], rtt[NET_TAP_ROUNDS - 1]);
+
+    /* Flood to the discard port on core 2. */
+    stack.sin_port = htons(NET_TAP_DISCARD_PORT);
+    start          = net_tap_discarded;
+    begin          = net_tap_now();
+
+    do
+    {
+        /* Yield to the stack threads before the TAP queue overflows, the
+         * host may have a single CPU. */
+        if (sendto(s, buffer, sizeof(buffer), 0, (struct sockaddr *)&stack, sizeof(stack)) > 0)
+        {
+            sent++;
+        }
+
+        if ((sent % 32) == 0)
+        {
+            sched_yield();
+        }
+    } while ((net_tap_now() - begin) < seconds);
+
+    usleep(100000);
+    end = net_tap_now() - begin;
+    printf("rx, 64 byte payload: %u sent, %u delivered on core 2, %.0f datagrams/s\n",
+        sent, net_tap_discarded - start, (double)(net_tap_discarded - start) / end);
+
+    /* Datagrams from core 3 to the host. */
+    net_tap_sending = 1;
+    begin           = net_tap_now();
+
+    do
+    {
+        if (recv(s, buffer, sizeof(buffer), 0) > 0)
+        {
+            received++;
+        }
+    } while ((net_tap_now() - begin) < seconds);
+
+    net_tap_sending = 0;
+    end             = net_tap_now() - begin;
+    printf("tx, 64 byte payload: %u received from core 3, %.0f datagrams/s\n", received, (double)received / end);
+
+    close(s);
+    net_tap_status();
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static const OsNet_Config config = {
+        .mac     = {0x02, 0x00, 0x00, 0x00, 0x03, 0x97},
+        .ip      = OS_NET_IP(10, 0, 0, 2),
+        .netmask = OS_NET_IP(255, 255, 255, 0),
+        .gateway = 0,
+    };
+    const char *name    = "tap0";
+    double      seconds = 0;
+    pthread_t   threads[4];
+    int         result  = 0;
+    int         index;
+
+    for (index = 1; index < argc; index++)
+    {
+        if ((strcmp(argv[index], "-i") == 0) && ((index + 1) < argc))
+        {
+            name = argv[++index];
+        }
+        else if (strcmp(argv[index], "--bench") == 0)
+        {
+            seconds = ((index + 1) < argc) ? atof(argv[++index]) : 2.0;
+            seconds = (seconds > 0) ? seconds : 2.0;
+        }
+        else
+        {
+            fprintf(stderr, "usage: net_tap [-i tap0] [--bench [seconds]]\n");
+            return 2;
+        }
+    }
+
+    net_tap_fd = net_tap_open(name);
+
+    if (net_tap_fd < 0)
+    {
+        return 1;
+    }
+
+    (void)os_net_bind(NET_TAP_ECHO_PORT, 1, net_tap_echo, NULL);
+    (void)os_net_bind(NET_TAP_DISCARD_PORT, 2, net_tap_discard, NULL);
+    os_net_init(&config, &net_tap_driver);
+
+    pthread_create(&threads[0], NULL, net_tap_poller, (void *)(uintptr_t)0);
+    pthread_create(&threads[1], NULL, net_tap_dispatcher, (void *)(uintptr_t)1);
+    pthread_create(&threads[2], NULL, net_tap_dispatcher, (void *)(uintptr_t)2);
+    pthread_create(&threads[3], NULL, net_tap_sender, (void *)(uintptr_t)3);
+
+    if (seconds > 0)
+    {
+        result = net_tap_bench(seconds);
+    }
+    else
+    {
+        printf("stack at 10.0.0.2 on %s, echo on port %d, discard on port %d\n", name, NET_TAP_ECHO_PORT, NET_TAP_DISCARD_PORT);
+
+        while (1)
+        {
+            sleep(5);
+            net_tap_status();
+        }
+    }
+
+    net_tap_running = 0;
+
+    for (index = 0; index < 4; index++)
+    {
+        pthread_join(threads[index], NULL);
+    }
+
+    close(net_tap_fd);
+
+    return result;
+}
@@ -0,0 +1,346 @@
+#!/usr/bin/env python3
+"""
+Offline system generator for the TC397 FreeRTOS SMP project.
+
+Reads a declarative system description (JSON, or YAML when PyYAML is
+installed) listing tasks, queues and interrupts per core and emits a C
+source/header pair with:
+
+  * statically allocated TCBs, stacks and queue storage, placed in one
+    linker section per core (.bss.os_core<N>, see Lcf_Tasking_Tricore_Tc.lsl),
+  * constant per-core creation tables indexed by the hardware core ID, so the
+    logical core 5 is mapped to core ID 6 in exactly one place,
+  * interrupt vector stubs and a service request initialisation table.
+
+Usage:
+    tools/os_gen.py os/os_system.json -o os/os_gen_cfg [--report]
+
+Description format (see os/os_system.json):
+
+    limits: {max_priorities, min_stack}                 optional
+    tasks:  [{name, entry, core, priority, stack, label, parameter}]
+    queues: [{name, core, length, item_size}]
+    isrs:   [{name, handler, core, priority, src}]
+
+'core' is the logical core 0..5, 'stack' is in words, 'src' is the service
+request register, e.g. MODULE_SRC.CAN.CAN[0].INT[0].
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+NUM_LOGICAL_CORES = 6
+# TC39x: CPU5 reports CORE_ID 6, ID 5 is unused.
+CORE_ID = {0: 0, 1: 1, 2: 2, 3: 3, 4: 4, 5: 6}
+NUM_CORE_IDS = 7
+STACK_WORD_SIZE = 4
+IDENT = re.compile(r'^[A-Za-z_][A-Za-z0-9_]*$')
+
+
+class ConfigError(Exception):
+    pass
+
+
+def load(path):
+    with open(path, 'r') as f:
+        text = f.read()
+    if path.endswith(('.yaml', '.yml')):
+        try:
+            import yaml
+        except ImportError:
+            raise ConfigError('PyYAML is required to read %s' % path)
+        return yaml.safe_load(text)
+    return json.loads(text)
+
+
+def check_ident(kind, value):
+    if not isinstance(value, str) or not IDENT.match(value):
+        raise ConfigError('%s "%s" is not a valid C identifier' % (kind, value))
+
+
+def check_core(kind, name, core):
+    if not isinstance(core, int) or core not in CORE_ID:
+        raise ConfigError('%s "%s": core must be 0..%d' % (kind, name, NUM_LOGICAL_CORES - 1))
+
+
+def validate(system):
+    limits = system.get('limits', {})
+    max_prio = limits.get('max_priorities', 32)
+    min_stack = limits.get('min_stack', 128)
+    names = set()
+
+    def unique(kind, name):
+        check_ident(kind, name)
+        if name in names:
+            raise ConfigError('duplicate object name "%s"' % name)
+        names.add(name)
+
+    for t in system.get('tasks', []):
+        unique('task', t['name'])
+        check_ident('task entry', t['entry'])
+        check_core('task', t['name'], t['core'])
+        if not 0 < t['priority'] < max_prio:
+            raise ConfigError('task "%s": priority must be 1..%d' % (t['name'], max_prio - 1))
+        if t.get('stack', min_stack) < min_stack:
+            raise ConfigError('task "%s": stack below %d words' % (t['name'], min_stack))
+
+    for q in system.get('queues', []):
+        unique('queue', q['name'])
+        check_core('queue', q['name'], q['core'])
+        if q['length'] <= 0 or q['item_size'] <= 0:
+            raise ConfigError('queue "%s": length and item_size must be positive' % q['name'])
+
+    prios = set()
+    for i in system.get('isrs', []):
+        unique('isr', i['name'])
+        check_ident('isr handler', i['handler'])
+        check_core('isr', i['name'], i['core'])
+        if not 0 < i['priority'] < 256:
+            raise ConfigError('isr "%s": priority must be 1..255' % i['name'])
+        key = (i['core'], i['priority'])
+        if key in prios:
+            raise ConfigError('isr "%s": priority %d already used on core %d' % (i['name'], i['priority'], i['core']))
+        prios.add(key)
+    return min_stack
+
+
+def per_core(items):
+    cores = {c: [] for c in range(NUM_LOGICAL_CORES)}
+    for item in items:
+        cores[item['core']].append(item)
+    return cores
+
+
+def section(core):
+    return 'OS_GEN_SECTION(".bss.os_core%d")' % core
+
+
+def emit_header(system, base, source):
+    guard = os.path.basename(base).upper() + '_H'
+    out = []
+    out.append('/* Generated by tools/os_gen.py from %s - do not edit. */' % source)
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include "FreeRTOS.h"')
+    out.append('#include "task.h"')
+    if system.get('queues'):
+        out.append('#include "queue.h"')
+    out.append('')
+    out.append('typedef struct')
+    out.append('{')
+    out.append('    TaskFunction_t  entry;')
+    out.append('    const char     *name;')
+    out.append('    uint32_t        stackDepth;')
+    out.append('    void           *parameter;')
+    out.append('    UBaseType_t     priority;')
+    out.append('    StackType_t    *stack;')
+    out.append('    StaticTask_t   *tcb;')
+    out.append('    TaskHandle_t   *handle;')
+    out.append('} OsGen_Task;')
+    out.append('')
+    out.append('typedef struct')
+    out.append('{')
+    out.append('    UBaseType_t     length;')
+    out.append('    UBaseType_t     itemSize;')
+    out.append('    uint8_t        *storage;')
+    out.append('    void           *queue;      /* StaticQueue_t */')
+    out.append('    void          **handle;     /* QueueHandle_t */')
+    out.append('} OsGen_Queue;')
+    out.append('')
+    out.append('typedef struct')
+    out.append('{')
+    out.append('    volatile void  *src;        /* Ifx_SRC_SRCR */')
+    out.append('    uint32_t        typeOfService;')
+    out.append('    uint32_t        priority;')
+    out.append('} OsGen_Isr;')
+    out.append('')
+    out.append('typedef struct')
+    out.append('{')
+    out.append('    const OsGen_Task  *tasks;')
+    out.append('    uint32_t           numTasks;')
+    out.append('    const OsGen_Queue *queues;')
+    out.append('    uint32_t           numQueues;')
+    out.append('    const OsGen_Isr   *isrs;')
+    out.append('    uint32_t           numIsrs;')
+    out.append('} OsGen_Core;')
+    out.append('')
+    out.append('/* Indexed by portGET_CORE_ID(). */')
+    out.append('extern const OsGen_Core os_gen_cores[configNUM_CORES];')
+    out.append('')
+    for t in system.get('tasks', []):
+        out.append('extern TaskHandle_t %sHandle;' % t['name'])
+    for q in system.get('queues', []):
+        out.append('extern QueueHandle_t %sHandle;' % q['name'])
+    out.append('')
+    out.append('/* Creates the tasks and queues of the calling core and enables its interrupts. */')
+    out.append('extern void os_gen_init(void);')
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+    return '\n'.join(out) + '\n'
+
+
+def emit_source(system, base, source, min_stack):
+    tasks = per_core(system.get('tasks', []))
+    queues = per_core(system.get('queues', []))
+    isrs = per_core(system.get('isrs', []))
+    out = []
+    out.append('/* Generated by tools/os_gen.py from %s - do not edit. */' % source)
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*----------------------------------Includes----------------------------------*/')
+    out.append('/******************************************************************************/')
+    out.append('#include "%s.h"' % os.path.basename(base))
+    if system.get('isrs'):
+        out.append('#include "Ifx_Types.h"')
+        out.append('#include "Src/Std/IfxSrc.h"')
+    out.append('')
+    out.append('#if defined(__TASKING__) || defined(__GNUC__)')
+    out.append('#define OS_GEN_SECTION(name) __attribute__((section(name)))')
+    out.append('#else')
+    out.append('#define OS_GEN_SECTION(name)')
+    out.append('#endif')
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*------------------------------Global variables------------------------------*/')
+    out.append('/******************************************************************************/')
+    for t in system.get('tasks', []):
+        out.append('TaskHandle_t %sHandle;' % t['name'])
+    for q in system.get('queues', []):
+        out.append('QueueHandle_t %sHandle;' % q['name'])
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*-------------------------Private Variables/Constants------------------------*/')
+    out.append('/******************************************************************************/')
+    entries = sorted(set(t['entry'] for t in system.get('tasks', [])))
+    for e in entries:
+        out.append('extern void %s(void *arg);' % e)
+    for i in system.get('isrs', []):
+        out.append('extern void %s(void);' % i['handler'])
+    out.append('')
+    for core in range(NUM_LOGICAL_CORES):
+        for t in tasks[core]:
+            out.append('static StaticTask_t %sTcb %s;' % (t['name'], section(core)))
+            out.append('static StackType_t  %sStack[%d] %s;' % (t['name'], t.get('stack', min_stack), section(core)))
+        for q in queues[core]:
+            out.append('static StaticQueue_t %sQueue %s;' % (q['name'], section(core)))
+            out.append('static uint8_t       %sStorage[%d * %d] %s;' % (q['name'], q['length'], q['item_size'], section(core)))
+    out.append('')
+    for core in range(NUM_LOGICAL_CORES):
+        if tasks[core]:
+            out.append('static const OsGen_Task os_gen_tasks_core%d[] = {' % core)
+            for t in tasks[core]:
+                param = t.get('parameter', 'NULL')
+                out.append('    {%s, "%s", %d, %s, %d, %sStack, &%sTcb, &%sHandle},' % (
+                    t['entry'], t.get('label', t['name']), t.get('stack', min_stack), param,
+                    t['priority'], t['name'], t['name'], t['name']))
+            out.append('};')
+        if queues[core]:
+            out.append('static const OsGen_Queue os_gen_queues_core%d[] = {' % core)
+            for q in queues[core]:
+                out.append('    {%d, %d, %sStorage, &%sQueue, (void **)&%sHandle},' % (
+                    q['length'], q['item_size'], q['name'], q['name'], q['name']))
+            out.append('};')
+        if isrs[core]:
+            out.append('static const OsGen_Isr os_gen_isrs_core%d[] = {' % core)
+            for i in isrs[core]:
+                out.append('    {&%s, IfxSrc_Tos_cpu%d, %d},' % (i['src'], core, i['priority']))
+            out.append('};')
+    out.append('')
+
+    def ref(table, core, items):
+        if items[core]:
+            return 'os_gen_%s_core%d, %d' % (table, core, len(items[core]))
+        return 'NULL, 0'
+
+    out.append('const OsGen_Core os_gen_cores[configNUM_CORES] = {')
+    logical = {v: k for k, v in CORE_ID.items()}
+    for core_id in range(NUM_CORE_IDS):
+        if core_id in logical:
+            c = logical[core_id]
+            out.append('    {%s, %s, %s},   /* core %d */' % (ref('tasks', c, tasks), ref('queues', c, queues), ref('isrs', c, isrs), c))
+        else:
+            out.append('    {NULL, 0, NULL, 0, NULL, 0},  /* unused core ID */')
+    out.append('};')
+    out.append('')
+    out.append('/******************************************************************************/')
+    out.append('/*--------------------------Function Implementations--------------------------*/')
+    out.append('/******************************************************************************/')
+    for i in system.get('isrs', []):
+        out.append('IFX_INTERRUPT(%s_vector, %d, %d);' % (i['name'], i['core'], i['priority']))
+        out.append('void %s_vector(void)' % i['name'])
+        out.append('{')
+        out.append('    %s();' % i['handler'])
+        out.append('}')
+        out.append('')
+    out.append('void os_gen_init(void)')
+    out.append('{')
+    out.append('    const OsGen_Core *core = &os_gen_cores[portGET_CORE_ID()];')
+    out.append('    uint32_t          i;')
+    out.append('')
+    if system.get('queues'):
+        out.append('    for (i = 0; i < core->numQueues; i++)')
+        out.append('    {')
+        out.append('        const OsGen_Queue *q = &core->queues[i];')
+        out.append('        *q->handle = xQueueCreateStatic(q->length, q->itemSize, q->storage, (StaticQueue_t *)q->queue);')
+        out.append('    }')
+        out.append('')
+    out.append('    for (i = 0; i < core->numTasks; i++)')
+    out.append('    {')
+    out.append('        const OsGen_Task *t = &core->tasks[i];')
+    out.append('        *t->handle = xTaskCreateStatic(t->entry, t->name, t->stackDepth, t->parameter, t->priority, t->stack, t->tcb);')
+    out.append('    }')
+    if system.get('isrs'):
+        out.append('')
+        out.append('    for (i = 0; i < core->numIsrs; i++)')
+        out.append('    {')
+        out.append('        const OsGen_Isr *isr = &core->isrs[i];')
+        out.append('        IfxSrc_init((volatile Ifx_SRC_SRCR *)isr->src, (IfxSrc_Tos)isr->typeOfService, (Ifx_Priority)isr->priority);')
+        out.append('        IfxSrc_enable((volatile Ifx_SRC_SRCR *)isr->src);')
+        out.append('    }')
+    out.append('}')
+    return '\n'.join(out) + '\n'
+
+
+def report(system, min_stack):
+    tasks = per_core(system.get('tasks', []))
+    queues = per_core(system.get('queues', []))
+    print('core  tasks  stack[B]  queues  storage[B]')
+    total = 0
+    for core in range(NUM_LOGICAL_CORES):
+        stack = sum(t.get('stack', min_stack) * STACK_WORD_SIZE for t in tasks[core])
+        storage = sum(q['length'] * q['item_size'] for q in queues[core])
+        total += stack + storage
+        print('%4d  %5d  %8d  %6d  %10d' % (core, len(tasks[core]), stack, len(queues[core]), storage))
+    print('static stack + queue storage: %d bytes (TCB and queue control blocks not included)' % total)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('config', help='system description (.json, .yaml)')
+    parser.add_argument('-o', '--output', required=True, help='output base path, .c and .h are appended')
+    parser.add_argument('--report', action='store_true', help='print the static RAM per core')
+    args = parser.parse_args()
+
+    try:
+        system = load(args.config)
+        min_stack = validate(system)
+    except (ConfigError, KeyError, ValueError, OSError) as e:
+        sys.stderr.write('os_gen: %s\n' % (e if not isinstance(e, KeyError) else 'missing key %s' % e))
+        return 1
+
+    source = os.path.basename(args.config)
+    with open(args.output + '.h', 'w', newline='\r\n') as f:
+        f.write(emit_header(system, args.output, source))
+    with open(args.output + '.c', 'w', newline='\r\n') as f:
+        f.write(emit_source(system, args.output, source, min_stack))
+    if args.report:
+        report(system, min_stack)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
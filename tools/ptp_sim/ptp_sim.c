@@ -0,0 +1,626 @@
+/* Host loopback of the PTP slave of os/os_ptp.c against a simulated master.
+ *
+ * The slave is os_ptp.c on os_net.c, unchanged, on an in-memory driver that
+ * models the GETH clock: an oscillator off by SIM_DRIFT, which STM0 shares,
+ * the addend adjustment of the servo, timestamps truncated to the sub-second
+ * increment, and the time register reads take.  The master is ideal, sends
+ * Sync and Follow_Up every sync interval and answers Delay_Req.  The link
+ * delays every frame by a base delay plus a random jitter, in both directions
+ * alike.  The net task runs when a frame arrives and every 10 ms, as on the
+ * target.
+ *
+ * The time from which the slave clock stays within 250 ns of the master is
+ * reported.  After SIM_SETTLE s the true offset of the slave clock is sampled every
+ * millisecond, and os_ptp_toNetworkTime() of STM0 is compared with the
+ * master time at the same instants.  CPU time is host thread time spent in
+ * os_net_poll() and os_ptp_poll() per Sync, including the model of the driver
+ * and the wait for the transmit timestamp, and host time per
+ * os_ptp_getTime() call.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/net_tap/include -Ios -o ptp_sim \
+ *         tools/ptp_sim/ptp_sim.c os/os_net.c os/os_ptp.c -lm
+ *     ./ptp_sim [seconds]
+ *
+ * This checks the protocol and the servo, not the silicon: the figures are
+ * host figures and the timestamp model is as documented, not measured. */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+#include "os_net.h"
+#include "os_ptp.h"
+
+#define SIM_RX_BUFFERS       (8)           /* As IFXGETH_MAX_RX_DESCRIPTORS          */
+#define SIM_BUFFER_SIZE      (1536)
+#define SIM_EVENTS           (64)
+#define SIM_STM_FREQUENCY    (100000000U)
+#define SIM_INCREMENT        (14.0)        /* ns, SSINC at fGETH = 150 MHz            */
+#define SIM_MASTER_INCREMENT (8.0)         /* ns of the master timestamps             */
+#define SIM_DRIFT            (37.5e-6)     /* Oscillator of the slave                 */
+#define SIM_INITIAL_OFFSET   (730.0e6)     /* ns the slave clock starts ahead         */
+#define SIM_READ_TIME        (40.0)        /* ns a read of the system time takes      */
+#define SIM_TX_LATENCY       (1000.0)      /* ns from send to the timestamp point     */
+#define SIM_IRQ_LATENCY      (5000.0)      /* ns from arrival to the net task         */
+#define SIM_POLL_PERIOD      (10.0e6)      /* ns, OS_NET_GETH_POLL_MS                 */
+#define SIM_SYNC_INTERVAL    (125.0e6)     /* ns, OS_PTP_LOG_SYNC_INTERVAL -3         */
+#define SIM_FOLLOW_UP_DELAY  (20000.0)     /* ns from Sync to Follow_Up on the master */
+#define SIM_RESPONSE_DELAY   (30000.0)     /* ns from Delay_Req to Delay_Resp         */
+#define SIM_SETTLE           (30.0)        /* s before the statistics start           */
+#define SIM_PROBE_PERIOD     (1.0e6)       /* ns between offset samples               */
+#define SIM_MASTER_IP        OS_NET_IP(192, 168, 0, 1)
+#define SIM_SLAVE_IP         OS_NET_IP(192, 168, 0, 2)
+
+typedef enum
+{
+    SimEvent_sync,                         /* Master sends Sync                       */
+    SimEvent_followUp,                     /* Master sends Follow_Up                  */
+    SimEvent_toSlave,                      /* Frame arrives at the slave MAC          */
+    SimEvent_toMaster,                     /* Frame arrives at the master             */
+    SimEvent_wake,                         /* Net task runs                           */
+    SimEvent_probe
+} SimEvent_Type;
+
+typedef struct
+{
+    double        time;
+    SimEvent_Type type;
+    uint32        length;
+    uint8         frame[128];
+} SimEvent;
+
+typedef struct
+{
+    const char *name;
+    double      delay;                     /* ns one way                              */
+    double      jitter;                    /* ns, uniform on top of the delay         */
+} SimScenario;
+
+__thread uint32        net_tap_coreId;
+
+static double          sim_now;
+static SimEvent        sim_events[SIM_EVENTS];
+static uint32          sim_eventCount;
+static const SimScenario *sim_scenario;
+static uint64          sim_random = 88172645463325252ULL;
+
+/* Slave clock: value at clockStart, advancing at clockRate ns per ns. */
+static double          sim_clockStart;
+static double          sim_clockValue;
+static double          sim_clockRate;
+
+/* Driver state of the slave. */
+static uint8           sim_rx[SIM_RX_BUFFERS][SIM_BUFFER_SIZE];
+static boolean         sim_rxUsed[SIM_RX_BUFFERS];
+static uint32          sim_rxLength[SIM_RX_BUFFERS];
+static uint64          sim_rxStamp[SIM_RX_BUFFERS];
+static uint32          sim_rxOrder[SIM_RX_BUFFERS];
+static uint32          sim_rxHead;
+static uint32          sim_rxTail;
+static uint8           sim_tx[SIM_BUFFER_SIZE];
+static boolean         sim_txStamped;
+static double          sim_txDeparture;
+static uint64          sim_txStamp;
+
+/* Master. */
+static uint16          sim_masterSequence;
+static uint64          sim_masterOrigin;
+
+static const uint8     sim_slaveMac[6]  = {0x02, 0x00, 0x00, 0x00, 0x03, 0x97};
+static const uint8     sim_masterMac[6] = {0x02, 0x00, 0x00, 0x00, 0x03, 0x01};
+
+/******************************************************************************/
+/* Model                                                                      */
+/******************************************************************************/
+
+static double sim_uniform(void)
+{
+    sim_random ^= sim_random << 13;
+    sim_random ^= sim_random >> 7;
+    sim_random ^= sim_random << 17;
+
+    return (double)(sim_random >> 11) / 9007199254740992.0;
+}
+
+static double sim_clock(double time)
+{
+    return sim_clockValue + ((time - sim_clockStart) * sim_clockRate);
+}
+
+static uint64 sim_stamp(double clock, double increment)
+{
+    return (uint64)(floor(clock / increment) * increment);
+}
+
+static uint64 sim_stm(double time)
+{
+    return (uint64)(time * (1.0 + SIM_DRIFT) * (SIM_STM_FREQUENCY / 1e9));
+}
+
+static void sim_schedule(double time, SimEvent_Type type, const uint8 *frame, uint32 length)
+{
+    SimEvent *event = &sim_events[sim_eventCount++];
+
+    if (sim_eventCount > SIM_EVENTS)
+    {
+        fprintf(stderr, "event queue full\n");
+        exit(1);
+    }
+
+    event->time   = time;
+    event->type   = type;
+    event->length = length;
+
+    if (length != 0)
+    {
+        memcpy(event->frame, frame, length);
+    }
+}
+
+static double sim_linkDelay(void)
+{
+    return sim_scenario->delay + (sim_uniform() * sim_scenario->jitter);
+}
+
+/******************************************************************************/
+/* Slave driver and clock                                                     */
+/******************************************************************************/
+
+static uint8 *sim_receive(void *context, uint32 *length, uint32 *flags, uint64 *timestamp)
+{
+    uint8 *frame = NULL_PTR;
+
+    (void)context;
+
+    if (sim_rxTail != sim_rxHead)
+    {
+        uint32 index = sim_rxOrder[sim_rxTail % SIM_RX_BUFFERS];
+
+        sim_rxTail++;
+        frame      = sim_rx[index];
+        *length    = sim_rxLength[index];
+        *flags     = OS_NET_RX_CHECKSUM_VERIFIED | OS_NET_RX_TIMESTAMP;
+        *timestamp = sim_rxStamp[index];
+    }
+
+    return frame;
+}
+
+static void sim_release(void *context, uint8 *frame)
+{
+    (void)context;
+    sim_rxUsed[(frame - sim_rx[0]) / SIM_BUFFER_SIZE] = FALSE;
+}
+
+static uint8 *sim_getTxBuffer(void *context)
+{
+    (void)context;
+    return sim_tx;
+}
+
+static boolean sim_send(void *context, uint8 *frame, uint32 length, uint32 flags)
+{
+    double departure = sim_now + SIM_TX_LATENCY;
+
+    (void)context;
+
+    if ((flags & OS_NET_TX_TIMESTAMP) != 0)
+    {
+        sim_txStamped   = TRUE;
+        sim_txDeparture = departure;
+        sim_txStamp     = sim_stamp(sim_clock(departure), SIM_INCREMENT);
+    }
+
+    sim_schedule(departure + sim_linkDelay(), SimEvent_toMaster, frame, length);
+
+    return TRUE;
+}
+
+static boolean sim_getTxTimestamp(void *context, uint64 *timestamp)
+{
+    boolean result = FALSE;
+
+    (void)context;
+
+    if ((sim_txStamped != FALSE) && (sim_now >= sim_txDeparture))
+    {
+        *timestamp    = sim_txStamp;
+        sim_txStamped = FALSE;
+        result        = TRUE;
+    }
+
+    return result;
+}
+
+static uint64 sim_getTime(void *context, uint64 *local)
+{
+    (void)context;
+
+    sim_now += SIM_READ_TIME;
+    *local   = sim_stm(sim_now);
+
+    return sim_stamp(sim_clock(sim_now), SIM_INCREMENT);
+}
+
+static void sim_adjustFrequency(void *context, sint32 ppb)
+{
+    (void)context;
+
+    sim_clockValue = sim_clock(sim_now);
+    sim_clockStart = sim_now;
+    sim_clockRate  = (1.0 + SIM_DRIFT) * (1.0 + (ppb * 1e-9));
+}
+
+static void sim_step(void *context, sint64 offset)
+{
+    (void)context;
+
+    sim_clockValue = sim_clock(sim_now) + (double)offset;
+    sim_clockStart = sim_now;
+}
+
+static uint64 sim_getLocal(void)
+{
+    return sim_stm(sim_now);
+}
+
+static const OsNet_Driver sim_driver = {
+    .context           = NULL_PTR,
+    .receive           = sim_receive,
+    .release           = sim_release,
+    .getTxBuffer       = sim_getTxBuffer,
+    .send              = sim_send,
+    .getTxTimestamp    = sim_getTxTimestamp,
+    .txChecksumOffload = FALSE,
+};
+
+static const OsPtp_Clock sim_ptpClock = {
+    .context         = NULL_PTR,
+    .getTime         = sim_getTime,
+    .adjustFrequency = sim_adjustFrequency,
+    .step            = sim_step,
+    .getLocal        = sim_getLocal,
+    .localFrequency  = SIM_STM_FREQUENCY,
+};
+
+/******************************************************************************/
+/* Master                                                                     */
+/******************************************************************************/
+
+static void sim_put16(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)(value >> 8);
+    data[1] = (uint8)value;
+}
+
+static void sim_put32(uint8 *data, uint32 value)
+{
+    sim_put16(data, value >> 16);
+    sim_put16(&data[2], value);
+}
+
+static void sim_putTimestamp(uint8 *data, uint64 time)
+{
+    sim_put16(data, (uint32)((time / 1000000000U) >> 32));
+    sim_put32(&data[2], (uint32)(time / 1000000000U));
+    sim_put32(&data[6], (uint32)(time % 1000000000U));
+}
+
+/* Builds a PTP message from the master to the slave, returns its length. */
+static uint32 sim_masterMessage(uint8 *frame, uint8 type, uint16 sequence, uint64 time, const uint8 *request)
+{
+    uint8  *ip      = &frame[14];
+    uint8  *udp     = &frame[34];
+    uint8  *message = &frame[42];
+    uint32  size    = (type == 0x9U) ? 54U : 44U;
+    uint16  port    = (type == 0x0U) ? 319U : 320U;
+
+    memset(frame, 0, 42 + size);
+    memcpy(&frame[0], sim_slaveMac, 6);
+    memcpy(&frame[6], sim_masterMac, 6);
+    sim_put16(&frame[12], 0x0800);
+    ip[0] = 0x45;
+    sim_put16(&ip[2], 20 + 8 + size);
+    ip[8] = 64;
+    ip[9] = 17;
+    sim_put32(&ip[12], SIM_MASTER_IP);
+    sim_put32(&ip[16], SIM_SLAVE_IP);
+    sim_put16(&udp[0], port);
+    sim_put16(&udp[2], port);
+    sim_put16(&udp[4], 8 + size);
+
+    message[0] = type;
+    message[1] = 2;
+    sim_put16(&message[2], size);
+    sim_put16(&message[6], 0x0400U | ((type == 0x0U) ? 0x0200U : 0U));
+    memcpy(&message[20], "\x02\x00\x00\xFF\xFE\x00\x03\x01\x00\x01", 10);
+    sim_put16(&message[30], sequence);
+    message[33] = (uint8)-3;
+    sim_putTimestamp(&message[34], time);
+
+    if (request != NULL_PTR)
+    {
+        memcpy(&message[8], &request[8], 8);      /* Correction  */
+        memcpy(&message[44], &request[20], 10);   /* Requesting  */
+    }
+
+    return 42 + size;
+}
+
+static void sim_masterReceive(const SimEvent *event)
+{
+    const uint8 *message = &event->frame[42];
+    uint8        frame[128];
+    uint32       length;
+
+    /* Delay_Req on the event port: answer with the master time it arrived. */
+    if ((event->length >= 86) && (event->frame[36] == 0x01) && (event->frame[37] == 0x3F) && ((message[0] & 0x0FU) == 0x1U))
+    {
+        length = sim_masterMessage(frame, 0x9U, (uint16)((message[30] << 8) | message[31]),
+                                   sim_stamp(event->time, SIM_MASTER_INCREMENT), message);
+        sim_schedule(event->time + SIM_RESPONSE_DELAY + sim_linkDelay(), SimEvent_toSlave, frame, length);
+    }
+}
+
+static void sim_slaveReceive(const SimEvent *event)
+{
+    uint32 index;
+
+    for (index = 0; (index < SIM_RX_BUFFERS) && (sim_rxUsed[index] != FALSE); index++)
+    {}
+
+    /* A full ring drops the frame, as the DMA would. */
+    if (index < SIM_RX_BUFFERS)
+    {
+        sim_rxUsed[index]                        = TRUE;
+        sim_rxLength[index]                      = event->length;
+        sim_rxStamp[index]                       = sim_stamp(sim_clock(event->time), SIM_INCREMENT);
+        sim_rxOrder[sim_rxHead % SIM_RX_BUFFERS] = index;
+        sim_rxHead++;
+        memcpy(sim_rx[index], event->frame, event->length);
+        sim_schedule(event->time + SIM_IRQ_LATENCY, SimEvent_wake, NULL_PTR, 0);
+    }
+}
+
+/******************************************************************************/
+/* Run                                                                        */
+/******************************************************************************/
+
+static double sim_cpuTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+static int sim_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void sim_report(const char *name, double *values, uint32 count)
+{
+    double sum    = 0.0;
+    double square = 0.0;
+    uint32 index;
+
+    for (index = 0; index < count; index++)
+    {
+        sum    += values[index];
+        square += values[index] * values[index];
+    }
+
+    for (index = 0; index < count; index++)
+    {
+        values[index] = fabs(values[index]);
+    }
+
+    qsort(values, count, sizeof(double), sim_compare);
+    printf("  %-22s mean %7.1f ns, rms %6.1f ns, |99.9%%| %6.1f ns, |max| %6.1f ns\n", name, sum / count,
+           sqrt(square / count), values[(count * 999U) / 1000U], values[count - 1]);
+}
+
+static void sim_run(const SimScenario *scenario, double seconds)
+{
+    OsNet_Config config    = {{0x02, 0x00, 0x00, 0x00, 0x03, 0x97}, SIM_SLAVE_IP, OS_NET_IP(255, 255, 255, 0), 0};
+    OsPtp_Config ptpConfig = {OsPtp_Role_slave, SIM_MASTER_IP, {0}};
+    uint32       capacity  = (uint32)(((seconds - SIM_SETTLE) * 1e9) / SIM_PROBE_PERIOD) + 1U;
+    double      *offsets   = malloc(capacity * sizeof(double));
+    double      *mapped    = malloc(capacity * sizeof(double));
+    uint32       samples   = 0;
+    double       cpu       = 0.0;
+    uint32       syncsAtSettle = 0;
+    double       locked    = 0.0;
+    double       nextPoll  = SIM_POLL_PERIOD;
+    OsPtp_Status status;
+
+    sim_scenario   = scenario;
+    sim_now        = 0.0;
+    sim_eventCount = 0;
+    sim_clockStart = 0.0;
+    sim_clockValue = SIM_INITIAL_OFFSET;
+    sim_clockRate  = 1.0 + SIM_DRIFT;
+
+    (void)os_net_addPeer(SIM_MASTER_IP, sim_masterMac);
+    os_ptp_init(&ptpConfig, &sim_ptpClock, config.mac);
+    os_net_init(&config, &sim_driver);
+
+    sim_schedule(SIM_SYNC_INTERVAL, SimEvent_sync, NULL_PTR, 0);
+    sim_schedule(SIM_PROBE_PERIOD, SimEvent_probe, NULL_PTR, 0);
+
+    while (sim_now < (seconds * 1e9))
+    {
+        uint32   next = 0;
+        uint32   index;
+        SimEvent event;
+        uint8    frame[128];
+        uint32   length;
+
+        for (index = 1; index < sim_eventCount; index++)
+        {
+            if (sim_events[index].time < sim_events[next].time)
+            {
+                next = index;
+            }
+        }
+
+        /* The net task also runs every poll period. */
+        if ((sim_eventCount == 0) || (nextPoll < sim_events[next].time))
+        {
+            event.time = nextPoll;
+            event.type = SimEvent_wake;
+            nextPoll  += SIM_POLL_PERIOD;
+        }
+        else
+        {
+            event                = sim_events[next];
+            sim_events[next]     = sim_events[sim_eventCount - 1U];
+            sim_eventCount--;
+        }
+
+        if (event.time > sim_now)
+        {
+            sim_now = event.time;
+        }
+
+        switch (event.type)
+        {
+        case SimEvent_sync:
+            sim_masterOrigin = sim_stamp(event.time, SIM_MASTER_INCREMENT);
+            length           = sim_masterMessage(frame, 0x0U, sim_masterSequence, sim_masterOrigin, NULL_PTR);
+            sim_schedule(event.time + sim_linkDelay(), SimEvent_toSlave, frame, length);
+            sim_schedule(event.time + SIM_FOLLOW_UP_DELAY, SimEvent_followUp, NULL_PTR, 0);
+            sim_schedule(event.time + SIM_SYNC_INTERVAL, SimEvent_sync, NULL_PTR, 0);
+            break;
+        case SimEvent_followUp:
+            length = sim_masterMessage(frame, 0x8U, sim_masterSequence, sim_masterOrigin, NULL_PTR);
+            sim_schedule(event.time + sim_linkDelay(), SimEvent_toSlave, frame, length);
+            sim_masterSequence++;
+            break;
+        case SimEvent_toSlave:
+            sim_slaveReceive(&event);
+            break;
+        case SimEvent_toMaster:
+            sim_masterReceive(&event);
+            break;
+        case SimEvent_wake:
+        {
+            double start = sim_cpuTime();
+
+            while (os_net_poll(8) == 8)
+            {}
+
+            os_ptp_poll();
+            cpu += sim_cpuTime() - start;
+            break;
+        }
+        case SimEvent_probe:
+        {
+            double offset = sim_clock(sim_now) - sim_now;
+
+            if (fabs(offset) >= 250.0)
+            {
+                locked = sim_now + SIM_PROBE_PERIOD;
+            }
+
+            if ((samples == 0) && (sim_now >= (SIM_SETTLE * 1e9)))
+            {
+                cpu = 0.0;
+                os_ptp_getStatus(&status);
+                syncsAtSettle = status.syncs;
+            }
+
+            if ((sim_now >= (SIM_SETTLE * 1e9)) && (samples < capacity))
+            {
+                offsets[samples] = offset;
+                mapped[samples]  = (double)os_ptp_toNetworkTime(sim_stm(sim_now)) - sim_now;
+                samples++;
+            }
+
+            sim_schedule(sim_now + SIM_PROBE_PERIOD, SimEvent_probe, NULL_PTR, 0);
+            break;
+        }
+        }
+    }
+
+    os_ptp_getStatus(&status);
+    printf("%s: link %.0f ns + up to %.0f ns jitter, oscillator %+.1f ppm\n", scenario->name, scenario->delay,
+           scenario->jitter, SIM_DRIFT * 1e6);
+    printf("  state %d, %u steps, path delay %u ns, frequency %+d ppb (ideal %+.0f), %u missing timestamps, %u dropped\n",
+           (int)status.state, status.steps, status.pathDelay, status.frequency, (1.0 / (1.0 + SIM_DRIFT) - 1.0) * 1e9,
+           status.missingTimestamps, status.dropped);
+    printf("  within 250 ns of the master from %.2f s on\n", locked * 1e-9);
+    sim_report("clock - master", offsets, samples);
+    sim_report("STM mapping - master", mapped, samples);
+    printf("  host CPU %.2f us per Sync\n\n", (cpu / 1e3) / (double)(status.syncs - syncsAtSettle));
+
+    free(offsets);
+    free(mapped);
+}
+
+/* Host time of os_ptp_getTime(), which reads STM0 through the clock. */
+static void sim_measureGetTime(void)
+{
+    const uint32    calls = 20000000U;
+    volatile uint64 sink  = 0;
+    double          start = sim_cpuTime();
+    uint32          index;
+
+    for (index = 0; index < calls; index++)
+    {
+        sink += os_ptp_getTime();
+    }
+
+    printf("os_ptp_getTime(): %.1f ns per call on the host\n", (sim_cpuTime() - start) / calls);
+    (void)sink;
+}
+
+int main(int argc, char **argv)
+{
+    static const SimScenario scenarios[] = {
+        {"direct link", 600.0, 8.0},
+        {"one switch", 3000.0, 200.0},
+    };
+    double seconds = (argc > 1) ? atof(argv[1]) : 120.0;
+    uint32 index;
+
+    if (seconds <= SIM_SETTLE)
+    {
+        fprintf(stderr, "run longer than %.0f s\n", SIM_SETTLE);
+        return 1;
+    }
+
+    /* The stack and the service keep their state in statics: every scenario
+     * runs in a process of its own. */
+    for (index = 0; index < (sizeof(scenarios) / sizeof(scenarios[0])); index++)
+    {
+        pid_t child;
+
+        fflush(stdout);
+        child = fork();
+
+        if (child == 0)
+        {
+            sim_run(&scenarios[index], seconds);
+            return 0;
+        }
+
+        (void)waitpid(child, NULL, 0);
+    }
+
+    sim_measureGetTime();
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/* Host configuration of tools/queue_sim: one thread, no scheduler, the queue
+ * API of the target configuration without the objects queue.c links against
+ * only through the other kernel files. */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES                    32
+#define configMINIMAL_STACK_SIZE                ( ( uint16_t ) 128 )
+#define configUSE_16_BIT_TICKS                  0
+#define configNUM_CORES                         1
+
+#define configUSE_MUTEXES                       0
+#define configUSE_RECURSIVE_MUTEXES             0
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               0
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_EVENT_MUX                     0
+
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        0
+
+#define configUSE_TRACE_FACILITY                0
+#define configUSE_CO_ROUTINES                   0
+#define configUSE_TIMERS                        0
+
+#define INCLUDE_xTaskGetSchedulerState          1
+
+#define configASSERT( x )                       assert( x )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,485 @@
+/* Host check of the block copies of os/FreeRTOS-Kernel-10.4.3/queue.c, behind
+ * xQueueSendMultiple() and xQueueReceiveMultiple(), and their throughput.
+ *
+ * queue.c and list.c are compiled unchanged against the stand-ins in
+ * tools/queue_sim/include.  There is a single thread and no scheduler: the
+ * task functions the queue calls are stubs in which a block time always
+ * expires, so a call that would block returns what it could do at once.
+ *
+ * The check runs queues of several lengths and item sizes through random
+ * sequences of single and block sends and receives from task and ISR,
+ * xQueueSendToFront(), xQueuePeek() and, on a queue of length 1,
+ * xQueueOverwrite(), and compares every item and count with a model ring.
+ * Directed cases cover a block that wraps the end of the storage area on the
+ * way in and out, a full queue, a partial send and receive, and a block
+ * receive after xQueueOverwrite().
+ *
+ * The benchmark then passes SIM_BENCH_ITEMS items of SIM_BENCH_ITEM_SIZE bytes
+ * through a queue of SIM_BENCH_LENGTH, one per xQueueSend()/xQueueReceive()
+ * and in blocks of 1, 8 and 32, and prints items/s and critical sections per
+ * item.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/queue_sim/include -Ios/FreeRTOS-Kernel-10.4.3/include \
+ *         -o queue_sim tools/queue_sim/queue_sim.c \
+ *         os/FreeRTOS-Kernel-10.4.3/queue.c os/FreeRTOS-Kernel-10.4.3/list.c
+ *     ./queue_sim
+ *
+ * Critical sections are counted, not executed, so items/s is host time with
+ * free critical sections.  On the target each one masks interrupts, and the
+ * count per item is the part of the saving that carries over. */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#define SIM_MAX_LENGTH        (40)
+#define SIM_MAX_ITEM_SIZE     (24)
+#define SIM_RANDOM_OPS        (200000)
+#define SIM_BENCH_LENGTH      (64)
+#define SIM_BENCH_ITEM_SIZE   (16)
+#define SIM_BENCH_ITEMS       (20000000UL)
+
+unsigned long ulSimCriticalSections;
+
+static unsigned long sim_failures;
+static unsigned long sim_checks;
+
+/* Task stubs, nothing is ever waiting */
+void vTaskSuspendAll(void)
+{
+}
+
+
+BaseType_t xTaskResumeAll(void)
+{
+    return pdFALSE;
+}
+
+
+BaseType_t xTaskGetSchedulerState(void)
+{
+    return taskSCHEDULER_RUNNING;
+}
+
+
+void vTaskInternalSetTimeOutState(TimeOut_t * const pxTimeOut)
+{
+    (void)pxTimeOut;
+}
+
+
+/* Every block time expires at its first check */
+BaseType_t xTaskCheckForTimeOut(TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait)
+{
+    (void)pxTimeOut;
+    *pxTicksToWait = 0;
+    return pdTRUE;
+}
+
+
+void vTaskPlaceOnEventList(List_t * const pxEventList, const TickType_t xTicksToWait)
+{
+    (void)pxEventList;
+    (void)xTicksToWait;
+    fprintf(stderr, "queue_sim: a call blocked\n");
+    abort();
+}
+
+
+BaseType_t xTaskRemoveFromEventList(const List_t * const pxEventList)
+{
+    (void)pxEventList;
+    return pdFALSE;
+}
+
+
+void vTaskMissedYield(void)
+{
+}
+
+
+/* The model: a ring of item sequence numbers */
+typedef struct
+{
+    unsigned long items[SIM_MAX_LENGTH];
+    unsigned      head;
+    unsigned      count;
+    unsigned      length;
+} SimModel;
+
+typedef struct
+{
+    StaticQueue_t buffer;
+    uint8_t       storage[SIM_MAX_LENGTH * SIM_MAX_ITEM_SIZE];
+    QueueHandle_t queue;
+    unsigned      itemSize;
+    SimModel      model;
+    unsigned long next;                /* Sequence number of the next item made */
+} SimQueue;
+
+static unsigned long sim_random(void)
+{
+    static unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return (unsigned long)(state >> 16);
+}
+
+
+/* Every byte of an item depends on its sequence number and position */
+static void sim_makeItem(uint8_t *item, unsigned size, unsigned long sequence)
+{
+    unsigned byte;
+
+    for (byte = 0; byte < size; byte++)
+    {
+        item[byte] = (uint8_t)((sequence * 131U) + (byte * 7U) + (sequence >> 8));
+    }
+}
+
+
+static void sim_check(int condition, const char *what, unsigned long op)
+{
+    sim_checks++;
+
+    if (!condition)
+    {
+        if (sim_failures < 10)
+        {
+            printf("FAIL op %lu: %s\n", op, what);
+            fflush(stdout);
+        }
+
+        sim_failures++;
+    }
+}
+
+
+static void sim_checkItems(SimQueue *q, const uint8_t *items, unsigned count, const unsigned long *expected, const char *what, unsigned long op)
+{
+    uint8_t  reference[SIM_MAX_ITEM_SIZE];
+    unsigned index;
+
+    for (index = 0; index < count; index++)
+    {
+        sim_makeItem(reference, q->itemSize, expected[index]);
+        sim_check(memcmp(&items[index * q->itemSize], reference, q->itemSize) == 0, what, op);
+    }
+}
+
+
+static void sim_checkCount(SimQueue *q, unsigned long op)
+{
+    sim_check(uxQueueMessagesWaiting(q->queue) == q->model.count, "items waiting", op);
+    sim_check(uxQueueSpacesAvailable(q->queue) == (q->model.length - q->model.count), "spaces available", op);
+}
+
+
+static void sim_open(SimQueue *q, unsigned length, unsigned itemSize)
+{
+    memset(q, 0, sizeof(*q));
+    q->itemSize     = itemSize;
+    q->model.length = length;
+    q->queue        = xQueueCreateStatic(length, itemSize, q->storage, &q->buffer);
+}
+
+
+static void sim_modelPushBack(SimModel *model, unsigned long sequence)
+{
+    model->items[(model->head + model->count) % model->length] = sequence;
+    model->count++;
+}
+
+
+static unsigned long sim_modelPop(SimModel *model)
+{
+    unsigned long sequence = model->items[model->head];
+
+    model->head = (model->head + 1) % model->length;
+    model->count--;
+    return sequence;
+}
+
+
+/* Block send of count new items, from a task or an ISR */
+static void sim_sendBlock(SimQueue *q, unsigned count, int fromIsr, TickType_t ticks, unsigned long op)
+{
+    uint8_t       items[2 * SIM_MAX_LENGTH * SIM_MAX_ITEM_SIZE];
+    unsigned      expected = q->model.length - q->model.count;
+    unsigned      index;
+    UBaseType_t   sent;
+    BaseType_t    woken = pdFALSE;
+
+    for (index = 0; index < count; index++)
+    {
+        sim_makeItem(&items[index * q->itemSize], q->itemSize, q->next + index);
+    }
+
+    sent = fromIsr ? xQueueSendMultipleFromISR(q->queue, items, count, &woken)
+                   : xQueueSendMultiple(q->queue, items, count, ticks);
+
+    expected = (expected < count) ? expected : count;
+    sim_check(sent == expected, "block send count", op);
+
+    /* The items sent are the first ones of the block */
+    for (index = 0; index < sent; index++)
+    {
+        sim_modelPushBack(&q->model, q->next + index);
+    }
+
+    q->next += count;
+    sim_checkCount(q, op);
+}
+
+
+static void sim_receiveBlock(SimQueue *q, unsigned count, int fromIsr, TickType_t ticks, unsigned long op)
+{
+    uint8_t       items[2 * SIM_MAX_LENGTH * SIM_MAX_ITEM_SIZE];
+    unsigned long expected[2 * SIM_MAX_LENGTH];
+    unsigned      available = q->model.count;
+    unsigned      index;
+    UBaseType_t   received;
+    BaseType_t    woken = pdFALSE;
+
+    received = fromIsr ? xQueueReceiveMultipleFromISR(q->queue, items, count, &woken)
+                       : xQueueReceiveMultiple(q->queue, items, count, ticks);
+
+    available = (available < count) ? available : count;
+    sim_check(received == available, "block receive count", op);
+
+    for (index = 0; (index < received) && (q->model.count != 0); index++)
+    {
+        expected[index] = sim_modelPop(&q->model);
+    }
+
+    sim_checkItems(q, items, index, expected, "block receive data", op);
+    sim_checkCount(q, op);
+}
+
+
+static void sim_sendOne(SimQueue *q, int front, unsigned long op)
+{
+    uint8_t    item[SIM_MAX_ITEM_SIZE];
+    BaseType_t result;
+    int        room = q->model.count < q->model.length;
+
+    sim_makeItem(item, q->itemSize, q->next);
+    result = front ? xQueueSendToFront(q->queue, item, 0) : xQueueSend(q->queue, item, 0);
+    sim_check((result == pdPASS) == room, "single send result", op);
+
+    if (room)
+    {
+        if (front)
+        {
+            q->model.head = (q->model.head + q->model.length - 1) % q->model.length;
+            q->model.items[q->model.head] = q->next;
+            q->model.count++;
+        }
+        else
+        {
+            sim_modelPushBack(&q->model, q->next);
+        }
+    }
+
+    q->next++;
+    sim_checkCount(q, op);
+}
+
+
+static void sim_receiveOne(SimQueue *q, int peek, unsigned long op)
+{
+    uint8_t       item[SIM_MAX_ITEM_SIZE];
+    unsigned long expected;
+    BaseType_t    result;
+    int           available = q->model.count != 0;
+
+    result = peek ? xQueuePeek(q->queue, item, 0) : xQueueReceive(q->queue, item, 0);
+    sim_check((result == pdPASS) == available, "single receive result", op);
+
+    if (available)
+    {
+        expected = peek ? q->model.items[q->model.head] : sim_modelPop(&q->model);
+        sim_checkItems(q, item, 1, &expected, peek ? "peek data" : "single receive data", op);
+    }
+
+    sim_checkCount(q, op);
+}
+
+
+static void sim_overwrite(SimQueue *q, unsigned long op)
+{
+    uint8_t item[SIM_MAX_ITEM_SIZE];
+
+    sim_makeItem(item, q->itemSize, q->next);
+    sim_check(xQueueOverwrite(q->queue, item) == pdPASS, "overwrite result", op);
+    q->model.head     = 0;
+    q->model.count    = 1;
+    q->model.items[0] = q->next;
+    q->next++;
+    sim_checkCount(q, op);
+}
+
+
+static void sim_randomRun(unsigned length, unsigned itemSize, unsigned long ops)
+{
+    SimQueue      q;
+    unsigned long op;
+
+    sim_open(&q, length, itemSize);
+
+    for (op = 0; op < ops; op++)
+    {
+        unsigned count = 1 + (unsigned)(sim_random() % (2 * length));
+        int      isr   = (sim_random() & 1) != 0;
+
+        switch (sim_random() % ((length == 1) ? 9 : 8))
+        {
+        case 0: sim_sendOne(&q, 0, op); break;
+        case 1: sim_sendOne(&q, 1, op); break;
+        case 2: sim_receiveOne(&q, 0, op); break;
+        case 3: sim_receiveOne(&q, 1, op); break;
+        case 4:
+        case 5: sim_sendBlock(&q, count, isr, (TickType_t)(sim_random() & 1), op); break;
+        case 6:
+        case 7: sim_receiveBlock(&q, count, isr, (TickType_t)(sim_random() & 1), op); break;
+        default: sim_overwrite(&q, op); break;
+        }
+    }
+}
+
+
+static void sim_directed(void)
+{
+    SimQueue q;
+
+    /* A block in and out across the end of the storage area: 5 items from
+     * slot 6 of 8 are slots 6, 7, 0, 1, 2 */
+    sim_open(&q, 8, 12);
+    sim_sendBlock(&q, 6, 0, 0, 1);
+    sim_receiveBlock(&q, 6, 0, 0, 2);
+    sim_sendBlock(&q, 5, 0, 0, 3);
+    sim_receiveBlock(&q, 2, 1, 0, 4);
+    sim_sendBlock(&q, 5, 1, 0, 5);
+    sim_receiveBlock(&q, 8, 0, 0, 6);
+
+    /* A full queue takes nothing, from a task with a block time that expires
+     * or from an ISR, then gives all its items back in order */
+    sim_sendBlock(&q, 8, 0, 0, 7);
+    sim_sendBlock(&q, 3, 0, 10, 8);
+    sim_sendBlock(&q, 3, 1, 0, 9);
+    sim_receiveBlock(&q, 16, 0, 0, 10);
+    sim_receiveBlock(&q, 4, 0, 10, 11);
+
+    /* A partial send and receive */
+    sim_sendBlock(&q, 5, 0, 0, 12);
+    sim_sendBlock(&q, 5, 0, 0, 13);
+    sim_receiveBlock(&q, 3, 0, 0, 14);
+    sim_sendOne(&q, 1, 15);
+    sim_receiveBlock(&q, 20, 1, 0, 16);
+
+    /* A block receive after xQueueOverwrite(), which rewrites the one slot */
+    sim_open(&q, 1, 20);
+    sim_sendBlock(&q, 1, 0, 0, 17);
+    sim_overwrite(&q, 18);
+    sim_overwrite(&q, 19);
+    sim_sendBlock(&q, 2, 1, 0, 20);
+    sim_receiveBlock(&q, 4, 0, 0, 21);
+    sim_overwrite(&q, 22);
+    sim_receiveOne(&q, 1, 23);
+    sim_receiveBlock(&q, 1, 1, 0, 24);
+}
+
+
+static double sim_seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec * 1.0e-9);
+}
+
+
+/* Passes SIM_BENCH_ITEMS items through the queue, batch 0 item by item */
+static void sim_bench(unsigned batch)
+{
+    static StaticQueue_t buffer;
+    static uint8_t       storage[SIM_BENCH_LENGTH * SIM_BENCH_ITEM_SIZE];
+    static uint8_t       in[32 * SIM_BENCH_ITEM_SIZE];
+    static uint8_t       out[32 * SIM_BENCH_ITEM_SIZE];
+    QueueHandle_t        queue = xQueueCreateStatic(SIM_BENCH_LENGTH, SIM_BENCH_ITEM_SIZE, storage, &buffer);
+    unsigned long        moved = 0;
+    unsigned long        sections;
+    double               start;
+    double               elapsed;
+
+    memset(in, 0x5A, sizeof(in));
+    ulSimCriticalSections = 0;
+    start                 = sim_seconds();
+
+    while (moved < SIM_BENCH_ITEMS)
+    {
+        if (batch == 0)
+        {
+            (void)xQueueSend(queue, in, 0);
+            (void)xQueueReceive(queue, out, 0);
+            moved++;
+        }
+        else
+        {
+            moved += xQueueSendMultiple(queue, in, batch, 0);
+            (void)xQueueReceiveMultiple(queue, out, batch, 0);
+        }
+    }
+
+    elapsed  = sim_seconds() - start;
+    sections = ulSimCriticalSections;
+
+    if (batch == 0)
+    {
+        printf("%-28s", "xQueueSend/xQueueReceive");
+    }
+    else
+    {
+        printf("block of %-19u", batch);
+    }
+
+    printf(" %7.1f Mitems/s  %5.3f critical sections per item\n",
+        (double)moved / elapsed * 1.0e-6, (double)sections / (double)moved);
+}
+
+
+int main(void)
+{
+    static const unsigned lengths[]   = {1, 2, 3, 8, 17, SIM_MAX_LENGTH};
+    static const unsigned itemSizes[] = {1, 4, 12, 24};
+    unsigned              l;
+    unsigned              s;
+
+    sim_directed();
+
+    for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        for (s = 0; s < sizeof(itemSizes) / sizeof(itemSizes[0]); s++)
+        {
+            sim_randomRun(lengths[l], itemSizes[s], SIM_RANDOM_OPS);
+        }
+    }
+
+    printf("%lu checks, %lu failed\n\n", sim_checks, sim_failures);
+    printf("%lu items of %u bytes through a queue of %u:\n", SIM_BENCH_ITEMS, SIM_BENCH_ITEM_SIZE, SIM_BENCH_LENGTH);
+    sim_bench(0);
+    sim_bench(1);
+    sim_bench(8);
+    sim_bench(32);
+
+    return (sim_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+Decoder for the GPIO trace of the TC397 FreeRTOS SMP project.
+
+Reads a logic analyser export of the trace pins (see os/os_trace.h) and
+writes one timeline per core:
+
+  * 'task' intervals, from a change of the ID pins to the next change, with
+    the TCB number of the running task modulo 8,
+  * 'isr' intervals, while the ISR pin of the core is high.
+
+Usage:
+    tools/trace_decode.py capture.csv --core 0:0,1,2,3 --core 1:4,5,6,7 \\
+        [-o timeline.csv] [--names 1=Core0Task,2=DvfsTask] [--stats]
+
+The capture is a CSV file with a header line.  The first column is the time
+in seconds, every further column one digital channel; values of 0/1 or
+voltages (compared against --threshold) are accepted.  Exports that only
+hold a row per edge and exports with a row per sample decode the same way.
+
+'--core N:ID0,ID1,ID2,ISR' maps the pins of logical core N to channels,
+given as column names or as 0-based channel numbers (the time column not
+counted), ID bit 0 first.  The pin groups of the cores are listed in
+os/os_trace.c.
+
+Interrupts are stacked on the task they preempt: the task interval keeps
+running through them and --stats reports its time both with and without
+them.
+"""
+
+import argparse
+import csv
+import sys
+
+NUM_LOGICAL_CORES = 6
+ID_BITS = 3
+
+
+class ConfigError(Exception):
+    pass
+
+
+def parse_core(spec, header):
+    try:
+        core, pins = spec.split(':', 1)
+        core = int(core)
+    except ValueError:
+        raise ConfigError('core map "%s" is not N:ID0,ID1,ID2,ISR' % spec)
+    if core < 0 or core >= NUM_LOGICAL_CORES:
+        raise ConfigError('core map "%s": core must be 0..%d' % (spec, NUM_LOGICAL_CORES - 1))
+    pins = pins.split(',')
+    if len(pins) != ID_BITS + 1:
+        raise ConfigError('core map "%s": %d channels expected' % (spec, ID_BITS + 1))
+    columns = []
+    for pin in pins:
+        pin = pin.strip()
+        if pin in header[1:]:
+            columns.append(header.index(pin, 1))
+        elif pin.isdigit() and int(pin) + 1 < len(header):
+            columns.append(int(pin) + 1)
+        else:
+            raise ConfigError('core map "%s": no channel "%s" in the capture' % (spec, pin))
+    return core, columns
+
+
+def parse_names(spec):
+    names = {}
+    for item in spec.split(',') if spec else []:
+        try:
+            number, name = item.split('=', 1)
+            names[int(number)] = name
+        except ValueError:
+            raise ConfigError('task name "%s" is not NUMBER=NAME' % item)
+    return names
+
+
+class CoreDecoder(object):
+    def __init__(self, core, columns, threshold):
+        self.core = core
+        self.columns = columns
+        self.threshold = threshold
+        self.task = None
+        self.task_start = None
+        self.isr = False
+        self.isr_start = None
+        self.intervals = []
+
+    def level(self, value):
+        return float(value) >= self.threshold
+
+    def sample(self, time, row):
+        bits = [self.level(row[c]) for c in self.columns]
+        task = sum(1 << i for i in range(ID_BITS) if bits[i])
+        isr = bits[ID_BITS]
+
+        # The state found in the first row began before the capture.  Its
+        # intervals have no known start and are not reported, nor are the
+        # ones still open at the end of the capture.
+        first = self.task is None
+        if task != self.task:
+            if self.task_start is not None:
+                self.intervals.append((self.task_start, time, 'task', self.task))
+            self.task = task
+            self.task_start = None if first else time
+        if isr != self.isr:
+            if not isr and self.isr_start is not None:
+                self.intervals.append((self.isr_start, time, 'isr', self.task))
+            self.isr = isr
+            self.isr_start = None if first else time
+
+    def finish(self):
+        self.intervals.sort()
+
+
+def decode(path, core_specs, threshold):
+    with open(path, 'r', newline='') as f:
+        reader = csv.reader(f)
+        header = next(reader, None)
+        if header is None or len(header) < 2:
+            raise ConfigError('%s has no channels' % path)
+        header = [h.strip() for h in header]
+        decoders = []
+        for spec in core_specs:
+            core, columns = parse_core(spec, header)
+            if any(d.core == core for d in decoders):
+                raise ConfigError('core %d mapped twice' % core)
+            decoders.append(CoreDecoder(core, columns, threshold))
+
+        for line, row in enumerate(reader, 2):
+            if not row:
+                continue
+            try:
+                time = float(row[0])
+                for d in decoders:
+                    d.sample(time, row)
+            except (ValueError, IndexError):
+                raise ConfigError('%s:%d: malformed row' % (path, line))
+
+    for d in decoders:
+        d.finish()
+    return decoders
+
+
+def write_timeline(decoders, names, out):
+    writer = csv.writer(out, lineterminator='\n')
+    writer.writerow(['core', 'start_s', 'end_s', 'kind', 'task', 'duration_us'])
+    for d in sorted(decoders, key=lambda d: d.core):
+        for start, end, kind, task in d.intervals:
+            writer.writerow([d.core, '%.9f' % start, '%.9f' % end, kind, names.get(task, task),
+                             '%.3f' % ((end - start) * 1e6)])
+
+
+def report(decoders, names):
+    print('core  task              count    total[ms]  w/o isr[ms]  min[us]    max[us]')
+    for d in sorted(decoders, key=lambda d: d.core):
+        tasks = {}
+        isrs = [(s, e) for s, e, kind, _ in d.intervals if kind == 'isr']
+        for start, end, kind, task in d.intervals:
+            if kind != 'task':
+                continue
+            inside = sum(min(e, end) - max(s, start) for s, e in isrs if s < end and e > start)
+            tasks.setdefault(task, []).append((end - start, end - start - inside))
+        for task in sorted(tasks):
+            spans = tasks[task]
+            total = sum(s[0] for s in spans)
+            net = sum(s[1] for s in spans)
+            print('%4d  %-16s  %5d  %11.3f  %11.3f  %9.3f  %9.3f' % (
+                d.core, names.get(task, task), len(spans), total * 1e3, net * 1e3,
+                min(s[0] for s in spans) * 1e6, max(s[0] for s in spans) * 1e6))
+        if isrs:
+            lengths = [e - s for s, e in isrs]
+            print('%4d  %-16s  %5d  %11.3f  %11s  %9.3f  %9.3f' % (
+                d.core, '(isr)', len(lengths), sum(lengths) * 1e3, '',
+                min(lengths) * 1e6, max(lengths) * 1e6))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('capture', help='logic analyser export (.csv)')
+    parser.add_argument('--core', action='append', required=True, metavar='N:ID0,ID1,ID2,ISR',
+                        help='channels of the pins of logical core N, may be repeated')
+    parser.add_argument('-o', '--output', help='timeline CSV, standard output if omitted')
+    parser.add_argument('--names', help='task names by TCB number, e.g. 1=Core0Task,2=DvfsTask')
+    parser.add_argument('--threshold', type=float, default=0.5, help='logic level threshold, default 0.5')
+    parser.add_argument('--stats', action='store_true', help='print the time per task and interrupt')
+    args = parser.parse_args()
+
+    try:
+        names = parse_names(args.names)
+        decoders = decode(args.capture, args.core, args.threshold)
+    except (ConfigError, OSError) as e:
+        sys.stderr.write('trace_decode: %s\n' % e)
+        return 1
+
+    if args.output:
+        with open(args.output, 'w', newline='') as f:
+            write_timeline(decoders, names, f)
+    else:
+        write_timeline(decoders, names, sys.stdout)
+    if args.stats:
+        report(decoders, names)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,313 @@
+/* Host model of the GETH transmit scheduler with the traffic classes of
+ * os/os_tsn.c, to compare control frame latency under bulk load.
+ *
+ * Queue 0 is saturated with bulk frames of 1518 bytes; queue 1 gets a 128 byte
+ * control frame every 250 us.  The model runs the 1000 Mbps link one MAC
+ * clock (8 bits) at a time: strict priority or round robin between the
+ * queues, the credit based shaper with the register values os_tsn_getShaper()
+ * computes, and the software gate list with a switch latency drawn up to
+ * OS_TSN_GATE_LATENCY, after which a closed queue still starts the one frame
+ * its MTL queue holds.  Latency is from the release of a control frame to its
+ * last bit on the wire.
+ *
+ * Build and run:
+ *     cc -O2 -Itools/net_tap/include -Ios -o tsn_sim \
+ *         tools/tsn_sim/tsn_sim.c os/os_tsn.c
+ *     ./tsn_sim [frames]
+ *
+ * This models the scheduler as documented, not the silicon: DMA fetch
+ * latency, descriptor handling and the PHY are not included. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Ifx_Types.h"
+#include "os_tsn.h"
+
+#define TSN_SIM_LINK_RATE      (1000000000U)
+#define TSN_SIM_NS_PER_CYCLE   (8U)
+#define TSN_SIM_BULK_SIZE      (1518U)
+#define TSN_SIM_CONTROL_SIZE   (128U)
+#define TSN_SIM_PERIOD         (250000U)    /* ns between control frames */
+#define TSN_SIM_PENDING        (64U)
+
+typedef struct
+{
+    const char  *name;
+    OsTsn_Config config;
+    boolean      roundRobin;
+    uint32       offset;                    /* ns from the period start to the release */
+} TsnSim_Scenario;
+
+typedef struct
+{
+    uint64 *latency;
+    uint32  count;
+    uint64  bulkBits;
+    uint64  elapsed;
+} TsnSim_Result;
+
+static const TsnSim_Scenario tsn_sim_scenarios[] = {
+    {"round robin, no shaper (previous)",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_strictPriority, 10000000U, OS_TSN_MAX_FRAME_SIZE}},
+      2, {{0, 0}}, 0, 0},
+     TRUE, 0},
+    {"strict priority, CBS 100 Mbit/s (default)",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_creditBased, 100000000U, OS_TSN_MAX_FRAME_SIZE}},
+      2, {{0, 0}}, 0, 0},
+     FALSE, 0},
+    {"strict priority, 30 us control window per 250 us",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_strictPriority, 10000000U, 256}},
+      2, {{30000U, 0x2U}, {220000U, 0x1U}}, 2, 0},
+     FALSE, 28000U},
+};
+
+/* Configurations admission control must reject. */
+static const struct
+{
+    const char  *name;
+    OsTsn_Config config;
+} tsn_sim_rejected[] = {
+    {"CBS 800 Mbit/s",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_creditBased, 800000000U, OS_TSN_MAX_FRAME_SIZE}},
+      2, {{0, 0}}, 0, 0}},
+    {"10 us control window",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_strictPriority, 1000000U, 256}},
+      2, {{10000U, 0x2U}, {240000U, 0x1U}}, 2, 0}},
+    {"window too rare for 10 Mbit/s",
+     {{{OsTsn_Shaper_strictPriority, 0, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_strictPriority, 10000000U, 256}},
+      2, {{30000U, 0x2U}, {970000U, 0x1U}}, 2, 0}},
+    {"shaper on queue 0",
+     {{{OsTsn_Shaper_creditBased, 100000000U, OS_TSN_MAX_FRAME_SIZE}, {OsTsn_Shaper_strictPriority, 10000000U, 256}},
+      2, {{0, 0}}, 0, 0}},
+};
+
+static const char *const tsn_sim_resultNames[] = {"ok", "invalid", "overbooked", "gateTooShort"};
+
+static sint64 tsn_sim_signExtend(uint32 credit)
+{
+    return ((credit & 0x10000000U) != 0) ? (sint64)credit - 0x20000000LL : (sint64)credit;
+}
+
+static int tsn_sim_compare(const void *a, const void *b)
+{
+    uint64 x = *(const uint64 *)a;
+    uint64 y = *(const uint64 *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Gates in force at time ns, and the time of the next switch.  Each switch
+ * takes effect latency ns after its scheduled time. */
+static uint8 tsn_sim_gates(const OsTsn_Config *config, uint64 ns, const uint32 *latency, uint32 *entryOut)
+{
+    uint32 cycle = os_tsn_getCycle(config);
+    uint64 inCycle;
+    uint32 start = 0;
+    uint32 entry;
+
+    if (config->gateListLength == 0)
+    {
+        *entryOut = 0;
+        return 0xFFU;
+    }
+
+    inCycle = (ns + cycle - config->phase) % cycle;
+
+    for (entry = 0; entry < config->gateListLength; entry++)
+    {
+        if (inCycle < (start + config->gateList[entry].interval + latency[(entry + 1U) % config->gateListLength]))
+        {
+            break;
+        }
+
+        start += config->gateList[entry].interval;
+    }
+
+    /* Before the delayed first switch the last entry is still in force. */
+    if ((entry == 0) && (inCycle < latency[0]))
+    {
+        entry = config->gateListLength - 1U;
+    }
+    else if (entry == config->gateListLength)
+    {
+        entry = 0;
+    }
+
+    *entryOut = entry;
+    return config->gateList[entry].gates;
+}
+
+static void tsn_sim_run(const TsnSim_Scenario *scenario, uint32 frames, TsnSim_Result *result)
+{
+    const OsTsn_Config   *config = &scenario->config;
+    OsTsn_ShaperRegisters shaper = {0};
+    uint64                pending[TSN_SIM_PENDING];
+    uint32                head = 0, tail = 0;
+    uint32                latency[OS_TSN_GATE_ENTRIES] = {0};
+    uint32                entry = 0, lastEntry = 0;
+    uint8                 gates, lastGates = 0xFFU;
+    uint32                leak[2] = {0, 0};
+    uint64                cycle;
+    uint64                nextRelease = scenario->offset;
+    uint64                busyEnd     = 0;
+    sint32                busyQueue   = -1;
+    uint32                lastServed  = 1;
+    sint64                credit      = 0;
+    boolean               shaped      = (config->classes[1].shaper == OsTsn_Shaper_creditBased) ? TRUE : FALSE;
+
+    if (shaped != FALSE)
+    {
+        os_tsn_getShaper(config, 1, TSN_SIM_LINK_RATE, &shaper);
+    }
+
+    result->count    = 0;
+    result->bulkBits = 0;
+
+    for (cycle = 0; result->count < frames; cycle++)
+    {
+        uint64 ns = cycle * TSN_SIM_NS_PER_CYCLE;
+
+        if (ns >= nextRelease)
+        {
+            pending[head++ % TSN_SIM_PENDING] = nextRelease;
+            nextRelease += TSN_SIM_PERIOD;
+        }
+
+        gates = tsn_sim_gates(config, ns, latency, &entry);
+
+        if (entry != lastEntry)
+        {
+            /* A new ISR latency for the switch after next. */
+            latency[(entry + 1U) % config->gateListLength] = (uint32)(rand() % (OS_TSN_GATE_LATENCY + 1));
+            lastEntry = entry;
+        }
+
+        if (gates != lastGates)
+        {
+            leak[0]   = ((lastGates & ~gates & 0x1U) != 0) ? 1U : 0U;
+            leak[1]   = ((lastGates & ~gates & 0x2U) != 0) ? 1U : 0U;
+            lastGates = gates;
+        }
+
+        if (shaped != FALSE)
+        {
+            if (busyQueue == 1)
+            {
+                credit -= shaper.sendSlope;
+                credit  = (credit < tsn_sim_signExtend(shaper.loCredit)) ? tsn_sim_signExtend(shaper.loCredit) : credit;
+            }
+            else if (head != tail)
+            {
+                credit += shaper.idleSlope;
+                credit  = (credit > (sint64)shaper.hiCredit) ? (sint64)shaper.hiCredit : credit;
+            }
+            else if (credit < 0)
+            {
+                credit += shaper.idleSlope;
+                credit  = (credit > 0) ? 0 : credit;
+            }
+            else
+            {
+                credit = 0;
+            }
+        }
+
+        if ((busyQueue >= 0) && (ns >= busyEnd))
+        {
+            if (busyQueue == 1)
+            {
+                result->latency[result->count++] = ns - pending[tail++ % TSN_SIM_PENDING];
+            }
+            else
+            {
+                result->bulkBits += TSN_SIM_BULK_SIZE * 8U;
+            }
+
+            busyQueue = -1;
+        }
+
+        if (busyQueue < 0)
+        {
+            boolean control = ((head != tail) && (((gates & 0x2U) != 0) || (leak[1] != 0)) && ((shaped == FALSE) || (credit >= 0)))
+                              ? TRUE : FALSE;
+            boolean bulk    = (((gates & 0x1U) != 0) || (leak[0] != 0)) ? TRUE : FALSE;
+            sint32  queue   = -1;
+
+            if ((control != FALSE) && ((bulk == FALSE) || (scenario->roundRobin == FALSE) || (lastServed == 0)))
+            {
+                queue = 1;
+            }
+            else if (bulk != FALSE)
+            {
+                queue = 0;
+            }
+
+            if (queue >= 0)
+            {
+                uint32 size = (queue == 1) ? TSN_SIM_CONTROL_SIZE : TSN_SIM_BULK_SIZE;
+
+                if ((gates & (1U << queue)) == 0)
+                {
+                    leak[queue]--;
+                }
+
+                busyQueue  = queue;
+                busyEnd    = ns + os_tsn_getFrameTime(size, TSN_SIM_LINK_RATE);
+                lastServed = (uint32)queue;
+            }
+        }
+    }
+
+    result->elapsed = cycle * TSN_SIM_NS_PER_CYCLE;
+}
+
+int main(int argc, char **argv)
+{
+    uint32        frames = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : 4000U;
+    TsnSim_Result result;
+    uint32        index;
+
+    result.latency = malloc(frames * sizeof(uint64));
+
+    if ((frames == 0) || (result.latency == NULL))
+    {
+        return 1;
+    }
+
+    srand(1);
+    printf("%u control frames of %u bytes every %u us, bulk frames of %u bytes, %u Mbps\n\n",
+        frames, TSN_SIM_CONTROL_SIZE, TSN_SIM_PERIOD / 1000U, TSN_SIM_BULK_SIZE, TSN_SIM_LINK_RATE / 1000000U);
+    printf("%-48s %8s %8s %8s %8s %8s %10s\n", "scenario", "min us", "median", "p99", "max", "jitter", "bulk Mbps");
+
+    for (index = 0; index < (sizeof(tsn_sim_scenarios) / sizeof(tsn_sim_scenarios[0])); index++)
+    {
+        const TsnSim_Scenario *scenario = &tsn_sim_scenarios[index];
+        OsTsn_Result           check    = os_tsn_check(&scenario->config, TSN_SIM_LINK_RATE);
+
+        if (check != OsTsn_Result_ok)
+        {
+            printf("%-48s rejected: %s\n", scenario->name, tsn_sim_resultNames[check]);
+            continue;
+        }
+
+        tsn_sim_run(scenario, frames, &result);
+        qsort(result.latency, result.count, sizeof(uint64), tsn_sim_compare);
+        printf("%-48s %8.2f %8.2f %8.2f %8.2f %8.2f %10.1f\n", scenario->name,
+            result.latency[0] / 1000.0, result.latency[result.count / 2] / 1000.0,
+            result.latency[(result.count * 99U) / 100U] / 1000.0, result.latency[result.count - 1] / 1000.0,
+            (result.latency[result.count - 1] - result.latency[0]) / 1000.0,
+            (double)result.bulkBits * 1000.0 / (double)result.elapsed);
+    }
+
+    printf("\nadmission control\n");
+
+    for (index = 0; index < (sizeof(tsn_sim_rejected) / sizeof(tsn_sim_rejected[0])); index++)
+    {
+        printf("  %-46s %s\n", tsn_sim_rejected[index].name,
+            tsn_sim_resultNames[os_tsn_check(&tsn_sim_rejected[index].config, TSN_SIM_LINK_RATE)]);
+    }
+
+    free(result.latency);
+    return 0;
+}